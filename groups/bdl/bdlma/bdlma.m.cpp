@@ -0,0 +1,248 @@
+// bdlma.m.cpp                                                        -*-C++-*-
+
+//@PURPOSE: Compare the 'bdlma' allocators on typical allocation workloads.
+//
+//@SEE_ALSO: bslbench_allocatorsweep, bdlma_multipoolallocator,
+//           bdlma_sequentialallocator, bdlma_bufferedsequentialallocator
+//
+//@DESCRIPTION: This program runs the default workloads of
+// 'bslbench::AllocatorSweep' (building and destroying containers, churning
+// blocks of random sizes, passing messages through a queue, and serving a
+// request) against each of the following allocators:
+//..
+//  Name          Allocator
+//  ----------    ----------------------------------------------------
+//  newdelete     bslma::NewDeleteAllocator
+//  mallocfree    bslma::MallocFreeAllocator
+//  multipool     bdlma::MultipoolAllocator
+//  sequential    bdlma::SequentialAllocator
+//  buffered      bdlma::BufferedSequentialAllocator, with a 16K buffer
+//..
+// and prints, for each workload and allocator, the median time of a run,
+// the number of allocations per second, the peak number of bytes in use by
+// the workload, the peak number of bytes drawn by the allocator from the
+// system, and the fraction of those not in use (fragmentation).  A new
+// allocator is created for each run, so that the memory held by the pools
+// is released at the end of each run.  Its command line is:
+//..
+//  bdlma.m [-f table|csv|json] [-r repetitions] [-w warmups]
+//          [-t milliseconds] [filter]
+//..
+// where the options are those of 'bslbench.m', and 'filter', if given, runs
+// only the pairs whose name, "<workload>/<size>/<allocator>", contains it
+// (e.g., "multipool").
+//
+// 'bdlma::Multipool', which does not implement the 'bslma::Allocator'
+// protocol, is measured through 'bdlma::MultipoolAllocator', which adapts
+// it to the protocol at the cost of a virtual call.
+//
+// Note that the program must be built in an optimized build mode for the
+// results to be meaningful.
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+// 'bdl' is built in 'BSL_OVERRIDES_STD' mode, in which the 'bslstl'
+// containers used by 'bslbench' must first be included through their 'bsl'
+// headers.
+
+#include <bsl_deque.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <bslbench_allocatorsweep.h>
+#include <bslbench_runner.h>
+
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef bslbench::Runner Runner;
+
+                     // ==================================
+                     // class BufferedSequentialFactory
+                     // ==================================
+
+class BufferedSequentialFactory : public bslbench::AllocatorFactory {
+    // This class implements the 'bslbench::AllocatorFactory' protocol for
+    // 'bdlma::BufferedSequentialAllocator', giving each allocator an initial
+    // buffer of 'k_BUFFER_SIZE' bytes.  The buffer is drawn from the upstream
+    // allocator, rather than being on the stack as it usually is, so that it
+    // is included in the footprint of the allocator.
+
+    enum { k_BUFFER_SIZE = 16 * 1024 };
+
+    // DATA
+    bsls::ObjectBuffer<bdlma::BufferedSequentialAllocator>
+                      d_allocator;   // current allocator
+
+    char             *d_buffer_p;    // buffer of the current allocator
+
+    bslma::Allocator *d_upstream_p;  // upstream of the current allocator
+
+  public:
+    // CREATORS
+    BufferedSequentialFactory()
+        // Create a factory of 'bdlma::BufferedSequentialAllocator' objects.
+    : d_buffer_p(0)
+    , d_upstream_p(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual bslma::Allocator *createAllocator(bslma::Allocator *upstream)
+        // Return the address of a new 'bdlma::BufferedSequentialAllocator'
+        // having a buffer drawn from the specified 'upstream' allocator, and
+        // drawing further memory from 'upstream'.
+    {
+        d_upstream_p = upstream;
+        d_buffer_p   = static_cast<char *>(upstream->allocate(k_BUFFER_SIZE));
+        return new (d_allocator.buffer()) bdlma::BufferedSequentialAllocator(
+                                                                d_buffer_p,
+                                                                k_BUFFER_SIZE,
+                                                                upstream);
+    }
+
+    virtual void deleteAllocator(bslma::Allocator *)
+        // Destroy the current allocator, and return its buffer.
+    {
+        d_allocator.object().~BufferedSequentialAllocator();
+        d_upstream_p->deallocate(d_buffer_p);
+    }
+};
+
+void printUsage(const char *program)
+    // Write the command-line usage of the specified 'program' to the
+    // standard error.
+{
+    fprintf(stderr,
+            "usage: %s [-f table|csv|json] [-r repetitions] [-w warmups]\n"
+            "          [-t milliseconds] [filter]\n",
+            program);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Runner         runner;
+    Runner::Format format = Runner::BSLBENCH_TABLE;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if ('-' != arg[0]) {
+            runner.setFilter(arg);
+            continue;                                               // CONTINUE
+        }
+        if (0 == strcmp(arg, "-h") || i + 1 == argc || 2 != strlen(arg)) {
+            printUsage(argv[0]);
+            return 0 == strcmp(arg, "-h") ? 0 : 1;                    // RETURN
+        }
+
+        const char *value = argv[++i];
+        switch (arg[1]) {
+          case 'f': {
+            if (0 == strcmp(value, "table")) {
+                format = Runner::BSLBENCH_TABLE;
+            }
+            else if (0 == strcmp(value, "csv")) {
+                format = Runner::BSLBENCH_CSV;
+            }
+            else if (0 == strcmp(value, "json")) {
+                format = Runner::BSLBENCH_JSON;
+            }
+            else {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+          } break;
+          case 'r': {
+            const int repetitions = atoi(value);
+            if (repetitions <= 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setRepetitions(repetitions);
+          } break;
+          case 'w': {
+            const int warmups = atoi(value);
+            if (warmups < 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setWarmupRepetitions(warmups);
+          } break;
+          case 't': {
+            const double milliseconds = atof(value);
+            if (milliseconds < 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setMinRepetitionTime(
+                       static_cast<bsls::Types::Int64>(milliseconds * 1e6));
+          } break;
+          default: {
+            printUsage(argv[0]);
+            return 1;                                                 // RETURN
+          }
+        }
+    }
+
+    bslbench::SharedAllocatorFactory newDelete(
+                                     &bslma::NewDeleteAllocator::singleton());
+    bslbench::SharedAllocatorFactory mallocFree(
+                                    &bslma::MallocFreeAllocator::singleton());
+    bslbench::AllocatorFactoryImp<bdlma::MultipoolAllocator>  multipool;
+    bslbench::AllocatorFactoryImp<bdlma::SequentialAllocator> sequential;
+    BufferedSequentialFactory                                 buffered;
+
+    bslbench::AllocatorSweep sweep;
+    sweep.addAllocator("newdelete",  &newDelete);
+    sweep.addAllocator("mallocfree", &mallocFree);
+    sweep.addAllocator("multipool",  &multipool);
+    sweep.addAllocator("sequential", &sequential);
+    sweep.addAllocator("buffered",   &buffered);
+    sweep.addDefaultWorkloads();
+
+    sweep.run(&runner);
+    sweep.print(stdout, format);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -6,6 +6,7 @@ BSLS_IDENT_RCSID(bdlma_pool_cpp,"$Id$ $CSID$")
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_performancehint.h>
+#include <bsls_tracerecorder.h>
 
 #include <bsl_algorithm.h>
 
@@ -80,6 +81,8 @@ namespace bdlma {
 // PRIVATE MANIPULATORS
 void Pool::replenish()
 {
+    BSLS_TRACERECORDER_LIBRARY_SCOPE("bdlma", "Pool::replenish");
+
     d_freeList_p = static_cast<Link *>(replenishImp(&d_blockList,
                                                     d_internalBlockSize,
                                                     d_chunkSize,
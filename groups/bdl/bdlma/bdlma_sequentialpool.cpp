@@ -2,6 +2,7 @@
 #include <bdlma_sequentialpool.h>
 
 #include <bsls_performancehint.h>
+#include <bsls_tracerecorder.h>
 
 #include <bsl_climits.h>  // 'INT_MAX'
 
@@ -235,6 +236,8 @@ void *SequentialPool::allocate(bsls::Types::size_type size)
         }
     }
 
+    BSLS_TRACERECORDER_LIBRARY_SCOPE("bdlma", "SequentialPool::allocate");
+
     const int nextSize = calculateNextBufferSize(size);
 
     if (nextSize < static_cast<int>(size)) {
@@ -0,0 +1,459 @@
+// bdlmt.m.cpp                                                        -*-C++-*-
+
+//@PURPOSE: Measure the scaling of the work-stealing scheduler.
+//
+//@SEE_ALSO: bdlmt_workstealingscheduler, bslbench_runner
+//
+//@DESCRIPTION: This program measures 'bdlmt::WorkStealingScheduler' on two
+// fork/join computations:
+//..
+//  Name                       Computation
+//  -----------------------    ------------------------------------------------
+//  fibonacci/<rank>           naive recursive Fibonacci number, serial below
+//                             rank 20
+//  quicksort/<size>           quick sort of pseudo-random 'int' keys, serial
+//                             ('bsl::sort') below 4096 keys
+//..
+// for schedulers of 1, 2, 4, ... worker threads up to the number of hardware
+// threads.  Benchmark names have the form "<computation>/threads:<n>", so
+// that the scaling of each computation can be read off the consecutive
+// results.  In the table format, the counters of the scheduler (tasks
+// executed, successful and failed steals, and idle time of the workers) over
+// all the repetitions of each benchmark are printed after the times.  Its
+// command line is:
+//..
+//  bdlmt.m [-f table|csv|json] [-r repetitions] [-w warmups]
+//          [-t milliseconds] [filter]
+//..
+// where the options are those of 'bslbench.m', and 'filter', if given, runs
+// only the benchmarks whose name contains it (e.g., "quicksort").
+//
+// Note that the program must be built in an optimized build mode for the
+// results to be meaningful.
+
+#include <bdlmt_workstealingscheduler.h>
+
+// 'bdl' is built in 'BSL_OVERRIDES_STD' mode, in which the 'bslstl'
+// containers used by 'bslbench' must first be included through their 'bsl'
+// headers.
+
+#include <bsl_algorithm.h>
+#include <bsl_deque.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <bslbench_runner.h>
+
+#include <bsls_parallelutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef bslbench::Runner              Runner;
+typedef bdlmt::WorkStealingScheduler  Scheduler;
+typedef bsls::Types::Int64            Int64;
+
+                              // ===============
+                              // class Fibonacci
+                              // ===============
+
+int serialFibonacci(int n)
+    // Return the Fibonacci number of the specified rank 'n', computed by the
+    // naive recursive definition.
+{
+    return n < 2 ? n : serialFibonacci(n - 1) + serialFibonacci(n - 2);
+}
+
+class Fibonacci {
+    // This class is a functor computing a Fibonacci number by the naive
+    // recursive definition, splitting the computation in two with 'invoke'
+    // down to rank 'k_CUTOFF'.
+
+    enum { k_CUTOFF = 20 };
+
+    // DATA
+    Scheduler *d_scheduler_p;  // scheduler (held, not owned)
+    int        d_n;            // rank
+    int       *d_result_p;     // result (held, not owned)
+
+  public:
+    // CREATORS
+    Fibonacci(Scheduler *scheduler, int n, int *result)
+        // Create a functor loading the Fibonacci number of the specified
+        // rank 'n' into the specified 'result', computed on the specified
+        // 'scheduler'.
+    : d_scheduler_p(scheduler)
+    , d_n(n)
+    , d_result_p(result)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Compute the Fibonacci number of this functor.
+    {
+        if (d_n < k_CUTOFF) {
+            *d_result_p = serialFibonacci(d_n);
+            return;                                                   // RETURN
+        }
+
+        int first, second;
+        d_scheduler_p->invoke(Fibonacci(d_scheduler_p, d_n - 1, &first),
+                              Fibonacci(d_scheduler_p, d_n - 2, &second));
+        *d_result_p = first + second;
+    }
+};
+
+                              // ===============
+                              // class QuickSort
+                              // ===============
+
+class QuickSort {
+    // This class is a functor sorting a range of 'int' keys, partitioning it
+    // around the median of three keys and sorting the two sides with
+    // 'invoke' down to ranges of 'k_CUTOFF' keys, which are sorted serially.
+
+    enum { k_CUTOFF = 4096 };
+
+    // DATA
+    Scheduler *d_scheduler_p;  // scheduler (held, not owned)
+    int       *d_begin_p;      // first key
+    int       *d_end_p;        // past the last key
+
+  public:
+    // CREATORS
+    QuickSort(Scheduler *scheduler, int *begin, int *end)
+        // Create a functor sorting the keys in the specified '[begin, end)'
+        // on the specified 'scheduler'.
+    : d_scheduler_p(scheduler)
+    , d_begin_p(begin)
+    , d_end_p(end)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Sort the keys of this functor.
+    {
+        if (d_end_p - d_begin_p < k_CUTOFF) {
+            bsl::sort(d_begin_p, d_end_p);
+            return;                                                   // RETURN
+        }
+
+        int a = *d_begin_p;
+        int b = d_begin_p[(d_end_p - d_begin_p) / 2];
+        int c = d_end_p[-1];
+        if (a > b) bsl::swap(a, b);
+        if (b > c) bsl::swap(b, c);
+        if (a > b) bsl::swap(a, b);
+        const int pivot = b;
+
+        // Partition into keys less than, equal to, and greater than the
+        // pivot, so that ranges of equal keys are not sorted again.
+
+        int *lower = d_begin_p;
+        int *upper = d_end_p;
+        int *i     = d_begin_p;
+        while (i < upper) {
+            if (*i < pivot) {
+                bsl::swap(*i++, *lower++);
+            }
+            else if (pivot < *i) {
+                bsl::swap(*i, *--upper);
+            }
+            else {
+                ++i;
+            }
+        }
+
+        d_scheduler_p->invoke(QuickSort(d_scheduler_p, d_begin_p, lower),
+                              QuickSort(d_scheduler_p, upper, d_end_p));
+    }
+};
+
+                         // =======================
+                         // struct SchedulerContext
+                         // =======================
+
+struct SchedulerContext {
+    // This 'struct' holds the scheduler on which a benchmark runs, the input
+    // of the quick sort benchmarks, and a vector to copy it into before each
+    // sort.
+
+    Scheduler              *d_scheduler_p;
+    int                     d_rank;
+    const bsl::vector<int> *d_input_p;
+    bsl::vector<int>        d_work;
+};
+
+void fibonacci(int numIterations, void *context)
+    // Compute the Fibonacci number of the rank of the 'SchedulerContext' at
+    // the specified 'context' on the scheduler of that context, the
+    // specified 'numIterations' times.
+{
+    SchedulerContext& scheduler = *static_cast<SchedulerContext *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        int result = 0;
+        scheduler.d_scheduler_p->run(Fibonacci(scheduler.d_scheduler_p,
+                                               scheduler.d_rank,
+                                               &result));
+        Runner::doNotOptimize(&result);
+    }
+}
+
+void quickSort(int numIterations, void *context)
+    // Copy the input of the 'SchedulerContext' at the specified 'context' and
+    // sort the copy on the scheduler of that context, the specified
+    // 'numIterations' times.
+{
+    SchedulerContext& scheduler = *static_cast<SchedulerContext *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        scheduler.d_work = *scheduler.d_input_p;
+        int *begin = scheduler.d_work.data();
+        int *end   = begin + scheduler.d_work.size();
+        scheduler.d_scheduler_p->run(QuickSort(scheduler.d_scheduler_p,
+                                               begin,
+                                               end));
+        Runner::doNotOptimize(&scheduler.d_work);
+    }
+}
+
+                          // ====================
+                          // struct CounterRecord
+                          // ====================
+
+struct CounterRecord {
+    // This 'struct' holds the counters of the scheduler over all the
+    // repetitions of a benchmark.
+
+    const char *d_name_p;
+    Int64       d_numTasksExecuted;
+    Int64       d_numSteals;
+    Int64       d_numFailedSteals;
+    Int64       d_idleTime;
+};
+
+void runBenchmarks(Runner                     *runner,
+                   bsl::deque<bsl::string>    *names,
+                   bsl::vector<CounterRecord> *counters)
+    // Run every benchmark with the specified 'runner', appending the
+    // benchmark names, which must outlive the results of 'runner', to the
+    // specified 'names', and the counters of the scheduler for each
+    // benchmark to the specified 'counters'.  The keys of the quick sort
+    // benchmarks are built only if one of them passes the filter of
+    // 'runner'.
+{
+    struct Computation {
+        const char                *d_name_p;
+        Runner::BenchmarkFunction  d_function;
+    };
+
+    static const Computation COMPUTATIONS[] = {
+        { "fibonacci/30",       &fibonacci },
+        { "quicksort/1000000",  &quickSort }
+    };
+    const int NUM_COMPUTATIONS = sizeof COMPUTATIONS / sizeof *COMPUTATIONS;
+
+    const int RANK = 30;
+    const int SIZE = 1000000;
+
+    const int maxThreads = bsls::ParallelUtil::numHardwareThreads();
+
+    bsl::vector<int> keys;
+    for (int i = 0; i < NUM_COMPUTATIONS; ++i) {
+        for (int threads = 1; ; threads *= 2) {
+            if (threads > maxThreads) {
+                threads = maxThreads;
+            }
+
+            char buffer[128];
+            snprintf(buffer,
+                     sizeof buffer,
+                     "%s/threads:%d",
+                     COMPUTATIONS[i].d_name_p,
+                     threads);
+
+            if (runner->matchesFilter(buffer)) {
+                if (&quickSort == COMPUTATIONS[i].d_function && keys.empty()) {
+                    const unsigned int multiplier = 2654435761u;
+                    for (int j = 0; j < SIZE; ++j) {
+                        const unsigned int key =
+                                     static_cast<unsigned int>(j) * multiplier;
+                        keys.push_back(static_cast<int>(key));
+                    }
+                }
+
+                names->push_back(buffer);
+
+                Scheduler scheduler(threads);
+                if (0 != scheduler.start()) {
+                    fprintf(stderr, "cannot start %d threads\n", threads);
+                    return;                                           // RETURN
+                }
+
+                SchedulerContext context = { &scheduler,
+                                             RANK,
+                                             &keys,
+                                             bsl::vector<int>() };
+                runner->run(names->back().c_str(),
+                            COMPUTATIONS[i].d_function,
+                            &context);
+
+                CounterRecord record = { names->back().c_str(),
+                                         scheduler.numTasksExecuted(),
+                                         scheduler.numSteals(),
+                                         scheduler.numFailedSteals(),
+                                         scheduler.idleTime() };
+                counters->push_back(record);
+            }
+
+            if (threads == maxThreads) {
+                break;                                                 // BREAK
+            }
+        }
+    }
+}
+
+void printCounters(FILE *stream, const bsl::vector<CounterRecord>& counters)
+    // Write the specified 'counters' to the specified 'stream' as an aligned
+    // table.
+{
+    fprintf(stream,
+            "\n%-32s %14s %12s %14s %12s\n",
+            "Scheduler counters",
+            "tasks",
+            "steals",
+            "failed steals",
+            "idle (ms)");
+    for (int i = 0; i < static_cast<int>(counters.size()); ++i) {
+        const CounterRecord& record = counters[i];
+        fprintf(stream,
+                "%-32s %14lld %12lld %14lld %12.1f\n",
+                record.d_name_p,
+                record.d_numTasksExecuted,
+                record.d_numSteals,
+                record.d_numFailedSteals,
+                static_cast<double>(record.d_idleTime) * 1e-6);
+    }
+}
+
+void printUsage(const char *program)
+    // Write the command-line usage of the specified 'program' to the
+    // standard error.
+{
+    fprintf(stderr,
+            "usage: %s [-f table|csv|json] [-r repetitions] [-w warmups]\n"
+            "          [-t milliseconds] [filter]\n",
+            program);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Runner         runner;
+    Runner::Format format = Runner::BSLBENCH_TABLE;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if ('-' != arg[0]) {
+            runner.setFilter(arg);
+            continue;                                               // CONTINUE
+        }
+        if (0 == strcmp(arg, "-h") || i + 1 == argc || 2 != strlen(arg)) {
+            printUsage(argv[0]);
+            return 0 == strcmp(arg, "-h") ? 0 : 1;                    // RETURN
+        }
+
+        const char *value = argv[++i];
+        switch (arg[1]) {
+          case 'f': {
+            if (0 == strcmp(value, "table")) {
+                format = Runner::BSLBENCH_TABLE;
+            }
+            else if (0 == strcmp(value, "csv")) {
+                format = Runner::BSLBENCH_CSV;
+            }
+            else if (0 == strcmp(value, "json")) {
+                format = Runner::BSLBENCH_JSON;
+            }
+            else {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+          } break;
+          case 'r': {
+            const int repetitions = atoi(value);
+            if (repetitions <= 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setRepetitions(repetitions);
+          } break;
+          case 'w': {
+            const int warmups = atoi(value);
+            if (warmups < 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setWarmupRepetitions(warmups);
+          } break;
+          case 't': {
+            const double milliseconds = atof(value);
+            if (milliseconds < 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setMinRepetitionTime(
+                       static_cast<bsls::Types::Int64>(milliseconds * 1e6));
+          } break;
+          default: {
+            printUsage(argv[0]);
+            return 1;                                                 // RETURN
+          }
+        }
+    }
+
+    bsl::deque<bsl::string>    names;
+    bsl::vector<CounterRecord> counters;
+    runBenchmarks(&runner, &names, &counters);
+
+    runner.print(stdout, format);
+    if (Runner::BSLBENCH_TABLE == format) {
+        printCounters(stdout, counters);
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
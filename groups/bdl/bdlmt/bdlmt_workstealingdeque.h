@@ -0,0 +1,484 @@
+// bdlmt_workstealingdeque.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGDEQUE
+#define INCLUDED_BDLMT_WORKSTEALINGDEQUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free deque with one owner and many stealers.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingDeque: Chase-Lev deque of pointers
+//
+//@SEE_ALSO: bdlmt_workstealingscheduler
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlmt::WorkStealingDeque', implementing the dynamic circular work-stealing
+// deque of Chase and Lev on 'bsls' atomics.  A deque holds non-null pointers
+// to 'TYPE' objects (usually tasks) and is operated on by one *owner* thread,
+// which pushes and pops items at the bottom of the deque, in last-in
+// first-out order, and by any number of *stealer* threads, which take items
+// from the top of the deque, in first-in first-out order.  The owner's
+// operations do not use any read-modify-write instruction except when the
+// deque holds a single item, so that a thread working through its own items
+// does not contend with the stealers.
+//
+///Capacity
+///--------
+// The items are held in a circular array whose capacity is a power of two.
+// When 'pushBottom' finds the array full, it allocates an array of twice the
+// capacity from the allocator supplied at construction and copies the items
+// into it.  Stealers may still be reading the replaced array, so it is not
+// released until the deque is destroyed; since the capacities double, the
+// replaced arrays take at most as much memory as the current one.  The
+// capacity never shrinks.
+//
+///Thread Safety
+///-------------
+// 'pushBottom', 'popBottom', and 'capacity' may be called only by the owner
+// thread, which is the thread that created the deque unless the deque is
+// handed over to another thread with suitable synchronization.  'steal',
+// 'isEmpty', and 'length' may be called by any thread concurrently with
+// every other method.  A 'steal' may fail, returning 0, although the deque
+// is not empty, if it races with another 'steal' or with a 'popBottom'
+// taking the last item; a caller that must find an item should retry.
+//
+// The store with which 'pushBottom' publishes an item is sequentially
+// consistent, so that a thread that pushes an item and then reads some other
+// variable (e.g., a count of sleeping stealers) and a thread that writes that
+// variable and then calls 'isEmpty' cannot both miss each other's writes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Distributing Jobs
+/// - - - - - - - - - - - - - -
+// Suppose that a thread produces jobs for itself, and that idle threads may
+// help it by stealing some of them.  First, we define a job:
+//..
+//  struct Job {
+//      int d_id;
+//  };
+//..
+// Then, the owner creates a deque and pushes the jobs:
+//..
+//  bdlmt::WorkStealingDeque<Job> deque;
+//
+//  Job jobs[3] = { { 0 }, { 1 }, { 2 } };
+//  for (int i = 0; i < 3; ++i) {
+//      deque.pushBottom(&jobs[i]);
+//  }
+//  assert(3 == deque.length());
+//..
+// Next, another thread (here, the same thread for simplicity) steals the
+// oldest job:
+//..
+//  Job *stolen = deque.steal();
+//  assert(&jobs[0] == stolen);
+//..
+// Finally, the owner pops the remaining jobs, newest first, until the deque
+// is empty:
+//..
+//  assert(&jobs[2] == deque.popBottom());
+//  assert(&jobs[1] == deque.popBottom());
+//  assert(0        == deque.popBottom());
+//  assert(deque.isEmpty());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>          // placement 'new'
+#define INCLUDED_NEW
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                     // ================================
+                     // struct WorkStealingDeque_Array
+                     // ================================
+
+template <class TYPE>
+struct WorkStealingDeque_Array {
+    // This component-private 'struct' holds a circular array of item slots
+    // of a 'WorkStealingDeque<TYPE>', and links the arrays that the deque
+    // has replaced.
+
+    // DATA
+    bsls::Types::Int64              d_mask;     // capacity minus one
+    bsls::AtomicPointer<TYPE>      *d_slots_p;  // 'd_mask + 1' slots
+    WorkStealingDeque_Array<TYPE>  *d_next_p;   // next replaced array, or 0
+
+    // ACCESSORS
+    bsls::AtomicPointer<TYPE>& slot(bsls::Types::Int64 index) const;
+        // Return a reference providing modifiable access to the slot holding
+        // the item of the specified 'index'.
+};
+
+                        // =======================
+                        // class WorkStealingDeque
+                        // =======================
+
+template <class TYPE>
+class WorkStealingDeque {
+    // This class implements a double-ended queue of non-null pointers to
+    // 'TYPE', pushed and popped at the bottom by one owner thread and stolen
+    // from the top by any thread.  See {Thread Safety}.
+
+    // PRIVATE TYPES
+    typedef WorkStealingDeque_Array<TYPE> Array;
+    typedef bsls::Types::Int64            Int64;
+
+    enum {
+        k_CACHE_LINE_SIZE = 64  // assumed size of a cache line
+    };
+
+    // DATA
+    bsls::AtomicInt64          d_top;       // index of the oldest item,
+                                            // advanced by stealers
+
+    char                       d_topPad[k_CACHE_LINE_SIZE
+                                                  - sizeof(bsls::AtomicInt64)];
+                                            // keeps 'd_top' and 'd_bottom'
+                                            // in different cache lines
+
+    bsls::AtomicInt64          d_bottom;    // index past the newest item,
+                                            // written by the owner
+
+    bsls::AtomicPointer<Array> d_array_p;   // current array of slots
+
+    Array                     *d_retired_p; // replaced arrays, newest first
+
+    bslma::Allocator          *d_allocator_p;  // memory allocator (held, not
+                                               // owned)
+
+    // NOT IMPLEMENTED
+    WorkStealingDeque(const WorkStealingDeque&);
+    WorkStealingDeque& operator=(const WorkStealingDeque&);
+
+    // PRIVATE MANIPULATORS
+    Array *createArray(Int64 capacity);
+        // Return a new array of the specified 'capacity' slots, allocated
+        // from the allocator of this deque.
+
+    void destroyArray(Array *array);
+        // Return the specified 'array' to the allocator of this deque.
+
+    Array *grow(Array *array, Int64 top, Int64 bottom);
+        // Replace the specified 'array', holding the items of the indices in
+        // the specified range '[top, bottom)', by an array of twice its
+        // capacity holding the same items, and return the new array.
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingDeque(bslma::Allocator *basicAllocator = 0);
+    explicit
+    WorkStealingDeque(int               initialCapacity,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create an empty deque.  Optionally specify an 'initialCapacity'
+        // number of items that the deque can hold before it allocates a
+        // larger array; if 'initialCapacity' is not specified, 64 is used,
+        // and otherwise it is rounded up to a power of two.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  The behavior is undefined unless '0 < initialCapacity'.
+
+    ~WorkStealingDeque();
+        // Destroy this deque.  The items that it holds, if any, are not
+        // affected.
+
+    // MANIPULATORS
+    TYPE *popBottom();
+        // Remove the newest item from this deque and return it, or return 0
+        // if this deque is empty.  The behavior is undefined unless this
+        // method is called by the owner thread.
+
+    void pushBottom(TYPE *item);
+        // Add the specified 'item' at the bottom of this deque.  If an
+        // exception is thrown while allocating a larger array, this deque is
+        // unchanged.  The behavior is undefined unless this method is called
+        // by the owner thread and '0 != item'.
+
+    TYPE *steal();
+        // Remove the oldest item from this deque and return it, or return 0
+        // if this deque is empty or if the item was taken concurrently by
+        // another thread.  This method may be called by any thread.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the number of items that this deque can hold before
+        // allocating a larger array.  The behavior is undefined unless this
+        // method is called by the owner thread.
+
+    bool isEmpty() const;
+        // Return 'true' if this deque held no item at some moment during the
+        // call, and 'false' otherwise.  This method may be called by any
+        // thread.
+
+    Int64 length() const;
+        // Return the number of items that this deque held at some moment
+        // during the call.  This method may be called by any thread.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // struct WorkStealingDeque_Array
+                     // --------------------------------
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsls::AtomicPointer<TYPE>&
+WorkStealingDeque_Array<TYPE>::slot(bsls::Types::Int64 index) const
+{
+    return d_slots_p[index & d_mask];
+}
+
+                        // -----------------------
+                        // class WorkStealingDeque
+                        // -----------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+typename WorkStealingDeque<TYPE>::Array *
+WorkStealingDeque<TYPE>::createArray(Int64 capacity)
+{
+    Array *array = static_cast<Array *>(
+                                      d_allocator_p->allocate(sizeof(Array)));
+    array->d_slots_p = 0;
+    array->d_next_p  = 0;
+    array->d_mask    = capacity - 1;
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(array,
+                                                        d_allocator_p);
+    void *slots = d_allocator_p->allocate(
+                   static_cast<bsls::Types::size_type>(capacity)
+                                          * sizeof(bsls::AtomicPointer<TYPE>));
+    array->d_slots_p = static_cast<bsls::AtomicPointer<TYPE> *>(slots);
+    proctor.release();
+
+    for (Int64 i = 0; i < capacity; ++i) {
+        new (array->d_slots_p + i) bsls::AtomicPointer<TYPE>();
+    }
+    return array;
+}
+
+template <class TYPE>
+void WorkStealingDeque<TYPE>::destroyArray(Array *array)
+{
+    d_allocator_p->deallocate(array->d_slots_p);
+    d_allocator_p->deallocate(array);
+}
+
+template <class TYPE>
+typename WorkStealingDeque<TYPE>::Array *
+WorkStealingDeque<TYPE>::grow(Array *array, Int64 top, Int64 bottom)
+{
+    Array *result = createArray(2 * (array->d_mask + 1));
+    for (Int64 i = top; i < bottom; ++i) {
+        result->slot(i).storeRelaxed(array->slot(i).loadRelaxed());
+    }
+
+    array->d_next_p = d_retired_p;
+    d_retired_p     = array;
+    d_array_p.storeRelease(result);
+    return result;
+}
+
+// CREATORS
+template <class TYPE>
+WorkStealingDeque<TYPE>::WorkStealingDeque(bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_bottom(0)
+, d_array_p(0)
+, d_retired_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_array_p.storeRelaxed(createArray(64));
+}
+
+template <class TYPE>
+WorkStealingDeque<TYPE>::WorkStealingDeque(int               initialCapacity,
+                                           bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_bottom(0)
+, d_array_p(0)
+, d_retired_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialCapacity);
+
+    Int64 capacity = 1;
+    while (capacity < initialCapacity) {
+        capacity *= 2;
+    }
+    d_array_p.storeRelaxed(createArray(capacity));
+}
+
+template <class TYPE>
+WorkStealingDeque<TYPE>::~WorkStealingDeque()
+{
+    destroyArray(d_array_p.loadRelaxed());
+    while (d_retired_p) {
+        Array *next = d_retired_p->d_next_p;
+        destroyArray(d_retired_p);
+        d_retired_p = next;
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE *WorkStealingDeque<TYPE>::popBottom()
+{
+    const Int64  bottom = d_bottom.loadRelaxed() - 1;
+    Array       *array  = d_array_p.loadRelaxed();
+
+    // Reserve the bottom item before reading 'd_top': the sequentially
+    // consistent store and load ensure that a concurrent 'steal' either sees
+    // the reservation or is seen by this thread.
+
+    d_bottom = bottom;
+    const Int64 top = d_top;
+
+    if (top > bottom) {
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    TYPE *item = array->slot(bottom).loadRelaxed();
+    if (top == bottom) {
+        // The last item: race the stealers for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            item = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+    return item;
+}
+
+template <class TYPE>
+inline
+void WorkStealingDeque<TYPE>::pushBottom(TYPE *item)
+{
+    BSLS_ASSERT_SAFE(item);
+
+    const Int64  bottom = d_bottom.loadRelaxed();
+    const Int64  top    = d_top.loadAcquire();
+    Array       *array  = d_array_p.loadRelaxed();
+
+    if (bottom - top > array->d_mask) {
+        array = grow(array, top, bottom);
+    }
+
+    array->slot(bottom).storeRelaxed(item);
+    d_bottom = bottom + 1;
+}
+
+template <class TYPE>
+inline
+TYPE *WorkStealingDeque<TYPE>::steal()
+{
+    const Int64 top    = d_top;
+    const Int64 bottom = d_bottom;
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    // A replaced array still holds the item of 'top' if the 'testAndSwap'
+    // below succeeds, since the owner does not reuse a slot before 'd_top'
+    // moves past it.
+
+    TYPE *item = d_array_p.loadAcquire()->slot(top).loadRelaxed();
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        return 0;                                                     // RETURN
+    }
+    return item;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int WorkStealingDeque<TYPE>::capacity() const
+{
+    return static_cast<int>(d_array_p.loadRelaxed()->d_mask + 1);
+}
+
+template <class TYPE>
+inline
+bool WorkStealingDeque<TYPE>::isEmpty() const
+{
+    return 0 >= length();
+}
+
+template <class TYPE>
+inline
+bsls::Types::Int64 WorkStealingDeque<TYPE>::length() const
+{
+    const Int64 top    = d_top;
+    const Int64 bottom = d_bottom;
+    return bottom > top ? bottom - top : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,577 @@
+// bdlmt_workstealingdeque.t.cpp                                      -*-C++-*-
+#include <bdlmt_workstealingdeque.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_parallelutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a lock-free deque.  Its sequential behavior
+// (last-in first-out at the bottom, first-in first-out at the top, growth of
+// the circular array, and memory use) is tested first by a single thread.
+// Then, an owner thread pushes and pops items while several threads steal
+// them, and we verify that every item is taken exactly once.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit WorkStealingDeque(bslma::Allocator *ba = 0);
+// [ 2] explicit WorkStealingDeque(int initialCapacity, *ba = 0);
+// [ 2] ~WorkStealingDeque();
+//
+// MANIPULATORS
+// [ 2] TYPE *popBottom();
+// [ 2] void pushBottom(TYPE *item);
+// [ 3] TYPE *steal();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] Int64 length() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: every item is taken once by concurrent owner and stealers
+// [ 5] USAGE EXAMPLE
+// [ 2] CONCERN: all memory comes from the supplied allocator
+// [ *] CONCERN: precondition violations are detected when enabled
+
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct Item {
+    // This 'struct' is an item identified by its index.
+
+    int             d_index;  // index of this item
+    bsls::AtomicInt d_taken;  // number of times this item was taken
+};
+
+typedef bdlmt::WorkStealingDeque<Item> Obj;
+
+                            // ==================
+                            // struct RaceContext
+                            // ==================
+
+struct RaceContext {
+    // This 'struct' holds the state shared by the owner (task 0) and the
+    // stealers (other tasks) of a race on a deque.
+
+    Obj             *d_deque_p;      // deque raced on
+    Item            *d_items_p;      // items pushed by the owner
+    int              d_numItems;     // number of items
+    bsls::AtomicInt  d_isOwnerDone;  // 1 once the owner has popped the
+                                     // items left
+    bsls::AtomicInt  d_numStolen;    // number of items stolen
+};
+
+void race(void *context, int taskIndex)
+    // Run the task of the specified 'taskIndex' of a race on the
+    // 'RaceContext' at the specified 'context': task 0 pushes every item,
+    // popping one every third push, then pops the items left; other tasks
+    // steal items until the owner is done and the deque is empty.
+{
+    RaceContext& race = *static_cast<RaceContext *>(context);
+
+    if (0 == taskIndex) {
+        for (int i = 0; i < race.d_numItems; ++i) {
+            race.d_deque_p->pushBottom(&race.d_items_p[i]);
+            if (2 == i % 3) {
+                Item *item = race.d_deque_p->popBottom();
+                if (item) {
+                    item->d_taken.add(1);
+                }
+            }
+        }
+        while (Item *item = race.d_deque_p->popBottom()) {
+            item->d_taken.add(1);
+        }
+        race.d_isOwnerDone = 1;
+        return;                                                       // RETURN
+    }
+
+    while (!race.d_isOwnerDone.load() || !race.d_deque_p->isEmpty()) {
+        Item *item = race.d_deque_p->steal();
+        if (item) {
+            item->d_taken.add(1);
+            race.d_numStolen.add(1);
+        }
+    }
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Distributing Jobs
+/// - - - - - - - - - - - - - -
+// Suppose that a thread produces jobs for itself, and that idle threads may
+// help it by stealing some of them.  First, we define a job:
+//..
+    struct Job {
+        int d_id;
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, the owner creates a deque and pushes the jobs:
+//..
+    bdlmt::WorkStealingDeque<Job> deque;
+
+    Job jobs[3] = { { 0 }, { 1 }, { 2 } };
+    for (int i = 0; i < 3; ++i) {
+        deque.pushBottom(&jobs[i]);
+    }
+    ASSERT(3 == deque.length());
+//..
+// Next, another thread (here, the same thread for simplicity) steals the
+// oldest job:
+//..
+    Job *stolen = deque.steal();
+    ASSERT(&jobs[0] == stolen);
+//..
+// Finally, the owner pops the remaining jobs, newest first, until the deque
+// is empty:
+//..
+    ASSERT(&jobs[2] == deque.popBottom());
+    ASSERT(&jobs[1] == deque.popBottom());
+    ASSERT(0        == deque.popBottom());
+    ASSERT(deque.isEmpty());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT OWNER AND STEALERS
+        //
+        // Concerns:
+        //: 1 When an owner pushes and pops items while other threads steal,
+        //:   every item is taken exactly once, by the owner or by a stealer.
+        //:
+        //: 2 The array may grow while stealers read it.
+        //
+        // Plan:
+        //: 1 For 1 to 8 stealers, use 'bsls::ParallelUtil::run' to race an
+        //:   owner pushing 100000 items on a deque of initial capacity 2, and
+        //:   popping one every third push, against the stealers.  Verify
+        //:   that each item was taken once.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: every item is taken once by concurrent owner and stealers
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT OWNER AND STEALERS" << endl
+                                  << "=============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int NUM_ITEMS = 100000;
+
+        for (int numStealers = 1; numStealers <= 8; ++numStealers) {
+            Item *items = new Item[NUM_ITEMS];
+            for (int i = 0; i < NUM_ITEMS; ++i) {
+                items[i].d_index = i;
+            }
+
+            Obj mX(2, &oa);
+
+            RaceContext context;
+            context.d_deque_p  = &mX;
+            context.d_items_p  = items;
+            context.d_numItems = NUM_ITEMS;
+
+            bsls::ParallelUtil::run(&race,
+                                    &context,
+                                    numStealers + 1,
+                                    numStealers + 1);
+
+            if (veryVerbose) {
+                P_(numStealers) P(context.d_numStolen.load());
+            }
+
+            int numBad = 0;
+            for (int i = 0; i < NUM_ITEMS; ++i) {
+                numBad += 1 != items[i].d_taken.load();
+            }
+            LOOP_ASSERT(numStealers, 0 == numBad);
+            LOOP_ASSERT(numStealers, mX.isEmpty());
+
+            delete[] items;
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // STEAL
+        //
+        // Concerns:
+        //: 1 'steal' takes the oldest item, and returns 0 on an empty deque.
+        //:
+        //: 2 'steal' and 'popBottom' interleave correctly, including on the
+        //:   last item and after the array wraps around.
+        //
+        // Plan:
+        //: 1 Push items, then alternate 'steal' and 'popBottom', verifying
+        //:   the item returned and the length.  (C-1)
+        //:
+        //: 2 On a deque of capacity 4, push and steal items in turns for
+        //:   several times the capacity, so that the indices wrap around.
+        //:   (C-2)
+        //
+        // Testing:
+        //   TYPE *steal();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "STEAL" << endl
+                                  << "=====" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Item items[10];
+        for (int i = 0; i < 10; ++i) {
+            items[i].d_index = i;
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.steal());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.pushBottom(&items[i]);
+            }
+
+            for (int i = 0; i < 5; ++i) {
+                LOOP_ASSERT(i, &items[i]     == mX.steal());
+                LOOP_ASSERT(i, &items[9 - i] == mX.popBottom());
+                LOOP_ASSERT(i, 8 - 2 * i     == X.length());
+            }
+            ASSERT(0 == mX.steal());
+            ASSERT(0 == mX.popBottom());
+            ASSERT(X.isEmpty());
+
+            mX.pushBottom(&items[0]);
+            ASSERT(&items[0] == mX.steal());
+            ASSERT(0         == mX.popBottom());
+        }
+
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 40; ++i) {
+                mX.pushBottom(&items[i % 10]);
+                mX.pushBottom(&items[(i + 1) % 10]);
+                LOOP_ASSERT(i, &items[i % 10] == mX.steal());
+                LOOP_ASSERT(i, 1              == X.length());
+                LOOP_ASSERT(i, &items[(i + 1) % 10] == mX.steal());
+            }
+            ASSERT(4 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PUSH AND POP AT THE BOTTOM
+        //
+        // Concerns:
+        //: 1 A deque is created empty, with a capacity of 64 by default, and
+        //:   otherwise the initial capacity rounded up to a power of two.
+        //:
+        //: 2 'popBottom' returns the items in the reverse order of
+        //:   'pushBottom', and 0 on an empty deque.
+        //:
+        //: 3 The capacity doubles when the array is full, and the items are
+        //:   kept.
+        //:
+        //: 4 All memory comes from the supplied allocator, and is released
+        //:   by the destructor.
+        //:
+        //: 5 Pushing a null pointer is detected.
+        //
+        // Plan:
+        //: 1 For several initial capacities, create a deque, push 300 items,
+        //:   verifying the length and capacity, then pop them, verifying the
+        //:   items returned.  Verify the memory use of a test allocator.
+        //:   (C-1..4)
+        //:
+        //: 2 Use 'BSLS_ASSERTTEST_*' to verify defensive checks.  (C-5)
+        //
+        // Testing:
+        //   explicit WorkStealingDeque(bslma::Allocator *ba = 0);
+        //   explicit WorkStealingDeque(int initialCapacity, *ba = 0);
+        //   ~WorkStealingDeque();
+        //   TYPE *popBottom();
+        //   void pushBottom(TYPE *item);
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   Int64 length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PUSH AND POP AT THE BOTTOM" << endl
+                                  << "==========================" << endl;
+
+        const int NUM_ITEMS = 300;
+
+        Item items[NUM_ITEMS];
+        for (int i = 0; i < NUM_ITEMS; ++i) {
+            items[i].d_index = i;
+        }
+
+        static const struct {
+            int d_line;
+            int d_initialCapacity;  // 0 for the default constructor
+            int d_expCapacity;
+        } DATA[] = {
+            //LINE  INIT  EXP
+            //----  ----  ---
+            { L_,      0,  64 },
+            { L_,      1,   1 },
+            { L_,      2,   2 },
+            { L_,      3,   4 },
+            { L_,    100, 128 },
+            { L_,    512, 512 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int INIT = DATA[ti].d_initialCapacity;
+            const int EXP  = DATA[ti].d_expCapacity;
+
+            bslma::TestAllocator         oa("object", veryVeryVerbose);
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            {
+                Obj *objPtr = INIT ? new (da) Obj(INIT, &oa)
+                                   : new (da) Obj(&oa);
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                LOOP_ASSERT(LINE, EXP == X.capacity());
+                LOOP_ASSERT(LINE, 0   == X.length());
+                LOOP_ASSERT(LINE, X.isEmpty());
+                LOOP_ASSERT(LINE, 0   == mX.popBottom());
+                LOOP_ASSERT(LINE, 2   == oa.numBlocksInUse());
+
+                int expCapacity = EXP;
+                for (int i = 0; i < NUM_ITEMS; ++i) {
+                    mX.pushBottom(&items[i]);
+                    if (i + 1 > expCapacity) {
+                        expCapacity *= 2;
+                    }
+                    LOOP2_ASSERT(LINE, i, i + 1 == X.length());
+                    LOOP2_ASSERT(LINE, i, expCapacity == X.capacity());
+                    LOOP2_ASSERT(LINE, i, !X.isEmpty());
+                }
+
+                for (int i = NUM_ITEMS - 1; i >= 0; --i) {
+                    LOOP2_ASSERT(LINE, i, &items[i] == mX.popBottom());
+                    LOOP2_ASSERT(LINE, i, i == X.length());
+                }
+                LOOP_ASSERT(LINE, 0 == mX.popBottom());
+                LOOP_ASSERT(LINE, X.isEmpty());
+                LOOP_ASSERT(LINE, expCapacity == X.capacity());
+
+                da.deleteObject(objPtr);
+            }
+            LOOP_ASSERT(LINE, 0 == oa.numBlocksInUse());
+            LOOP_ASSERT(LINE, 0 <  oa.numBlocksTotal());
+            LOOP_ASSERT(LINE, 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            Obj mX(&oa);
+
+            ASSERT_SAFE_PASS(mX.pushBottom(&items[0]));
+            ASSERT_SAFE_FAIL(mX.pushBottom(0));
+
+            ASSERT_FAIL(Obj(0, &oa));
+            ASSERT_PASS(Obj(1, &oa));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push, pop, and steal a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Item a, b, c;
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.isEmpty());
+
+        mX.pushBottom(&a);
+        mX.pushBottom(&b);
+        mX.pushBottom(&c);
+        ASSERT(3  == X.length());
+        ASSERT(&c == mX.popBottom());
+        ASSERT(&a == mX.steal());
+        ASSERT(&b == mX.popBottom());
+        ASSERT(0  == mX.steal());
+        ASSERT(X.isEmpty());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,679 @@
+// bdlmt_workstealingscheduler.cpp                                    -*-C++-*-
+#include <bdlmt_workstealingscheduler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingscheduler_cpp,"$Id$ $CSID$")
+
+#include <bdlmt_workstealingdeque.h>
+
+#include <bdlma_pool.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+
+#include <bsls_bsllock.h>
+#include <bsls_bslthreadutil.h>
+#include <bsls_parallelutil.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_deque.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bsls::Types::Int64 Int64;
+
+enum {
+    k_NUM_SPINS = 64  // number of rounds of failed searches for a task after
+                      // which a worker goes to sleep
+};
+
+void increment(bsls::AtomicInt64 *counter, Int64 value)
+    // Add the specified 'value' to the specified 'counter', which is written
+    // by the calling thread only.
+{
+    counter->storeRelaxed(counter->loadRelaxed() + value);
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                     // ==================================
+                     // class WorkStealingScheduler_Worker
+                     // ==================================
+
+class WorkStealingScheduler_Worker {
+    // This component-private class holds the state of one worker thread of
+    // a 'WorkStealingScheduler'.
+
+  public:
+    // PUBLIC DATA
+    WorkStealingScheduler_Imp                     *d_imp_p;
+                                        // shared state (held, not owned)
+
+    int                                            d_index;
+                                        // index of this worker
+
+    WorkStealingDeque<WorkStealingScheduler_Task>  d_deque;
+                                        // tasks pushed by this worker
+
+    bdlma::Pool                                    d_taskPool;
+                                        // memory of the tasks pushed by this
+                                        // worker
+
+    unsigned int                                   d_randomState;
+                                        // state of the generator choosing
+                                        // the victims of steals
+
+    bsls::BslThreadUtil::Handle                    d_thread;
+                                        // thread running this worker
+
+    bsls::AtomicInt64                              d_numTasksExecuted;
+    bsls::AtomicInt64                              d_numSteals;
+    bsls::AtomicInt64                              d_numFailedSteals;
+    bsls::AtomicInt64                              d_idleTime;
+                                        // counters, written by this worker
+
+    // CREATORS
+    WorkStealingScheduler_Worker(WorkStealingScheduler_Imp *imp,
+                                 int                        index,
+                                 bslma::Allocator          *basicAllocator)
+        // Create a worker of the specified 'index' sharing the specified
+        // 'imp', using the specified 'basicAllocator' to supply memory.
+    : d_imp_p(imp)
+    , d_index(index)
+    , d_deque(basicAllocator)
+    , d_taskPool(sizeof(WorkStealingScheduler_Task), basicAllocator)
+    , d_randomState(2654435761u * static_cast<unsigned int>(index + 1))
+    , d_numTasksExecuted(0)
+    , d_numSteals(0)
+    , d_numFailedSteals(0)
+    , d_idleTime(0)
+    {
+    }
+
+    // MANIPULATORS
+    int nextRandom()
+        // Return the next non-negative pseudo-random number of this worker.
+    {
+        d_randomState ^= d_randomState << 13;
+        d_randomState ^= d_randomState >> 17;
+        d_randomState ^= d_randomState << 5;
+        return static_cast<int>(d_randomState >> 1);
+    }
+
+    void resetCounters()
+        // Reset the counters of this worker to 0.
+    {
+        d_numTasksExecuted.storeRelaxed(0);
+        d_numSteals.storeRelaxed(0);
+        d_numFailedSteals.storeRelaxed(0);
+        d_idleTime.storeRelaxed(0);
+    }
+};
+
+                      // ===============================
+                      // class WorkStealingScheduler_Imp
+                      // ===============================
+
+class WorkStealingScheduler_Imp {
+    // This component-private class holds the workers of a started
+    // 'WorkStealingScheduler' and the state that they share.
+
+    // PRIVATE TYPES
+    typedef WorkStealingScheduler_Task   Task;
+    typedef WorkStealingScheduler_Worker Worker;
+
+  public:
+    // PUBLIC DATA
+    bsl::vector<Worker *> d_workers;        // workers, by index
+
+    bsls::BslLock         d_mutex;          // protects 'd_submitted' and the
+                                            // sleeping of workers
+
+    bsls::BslCondition    d_workCondition;  // signaled when a task is
+                                            // submitted or pushed while a
+                                            // worker sleeps, or on stop
+
+    bsls::BslCondition    d_doneCondition;  // signaled when a submitted task
+                                            // is done
+
+    bsl::deque<Task *>    d_submitted;      // tasks submitted by 'run' and
+                                            // not yet taken by a worker
+
+    bsls::AtomicInt       d_numSubmitted;   // length of 'd_submitted'
+
+    bsls::AtomicInt       d_numSleeping;    // number of sleeping workers
+
+    bsls::AtomicInt       d_isStopping;     // 1 once the workers must stop
+
+    bsls::BslThreadLocalPointer
+                          d_currentWorker;  // worker of the calling thread
+
+    int                   d_numStarted;     // number of workers, first in
+                                            // 'd_workers', having a thread
+
+    bslma::Allocator     *d_allocator_p;    // memory allocator (held, not
+                                            // owned)
+
+    // CREATORS
+    explicit
+    WorkStealingScheduler_Imp(bslma::Allocator *basicAllocator)
+        // Create the shared state of a scheduler having no worker, using the
+        // specified 'basicAllocator' to supply memory.
+    : d_workers(basicAllocator)
+    , d_submitted(basicAllocator)
+    , d_numSubmitted(0)
+    , d_numSleeping(0)
+    , d_isStopping(0)
+    , d_numStarted(0)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    ~WorkStealingScheduler_Imp()
+        // Destroy this object and the workers in 'd_workers', whose threads
+        // must have terminated.
+    {
+        for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+            d_allocator_p->deleteObject(d_workers[i]);
+        }
+    }
+
+    // MANIPULATORS
+    void execute(Worker *worker, Task *task);
+        // Run the specified 'task' on the specified 'worker' and mark it as
+        // done.  Note that 'task' must not be accessed afterwards, unless it
+        // was pushed by 'worker'.
+
+    Task *findTask(Worker *worker);
+        // Return a task for the specified 'worker' popped from its deque,
+        // submitted by 'run', or stolen from another worker, or 0 if no task
+        // was found.
+
+    Task *steal(Worker *thief);
+        // Try to steal a task from each worker other than the specified
+        // 'thief', in a pseudo-random order, and return the first task
+        // stolen, or 0 if none was.
+
+    Task *takeSubmitted();
+        // Remove the oldest task submitted by 'run' and return it, or return
+        // 0 if there is none.
+
+    Task *waitForTask(Worker *worker);
+        // Look for a task for the specified 'worker', sleeping if none is
+        // found for a while, and return it, or return 0 if the scheduler is
+        // stopping.
+
+    void wakeWorker();
+        // Wake a sleeping worker, if any, to look for a newly pushed task.
+
+    void workerMain(Worker *worker);
+        // Run tasks on the specified 'worker' until the scheduler stops.
+
+    // ACCESSORS
+    bool hasWork() const;
+        // Return 'true' if a task was submitted or pushed and not yet taken,
+        // and 'false' otherwise.
+};
+
+// MANIPULATORS
+void WorkStealingScheduler_Imp::execute(Worker *worker, Task *task)
+{
+    task->d_function(task->d_functor_p);
+    increment(&worker->d_numTasksExecuted, 1);
+
+    if (task->d_isExternal) {
+        // The submitter waits on 'd_doneCondition'; it may destroy 'task'
+        // once 'd_mutex' is unlocked.
+
+        d_mutex.lock();
+        task->d_isDone.storeRelease(1);
+        d_doneCondition.broadcast();
+        d_mutex.unlock();
+    }
+    else {
+        task->d_isDone.storeRelease(1);
+    }
+}
+
+WorkStealingScheduler_Task *
+WorkStealingScheduler_Imp::findTask(Worker *worker)
+{
+    Task *task = worker->d_deque.popBottom();
+    if (task) {
+        return task;                                                  // RETURN
+    }
+
+    task = takeSubmitted();
+    if (task) {
+        return task;                                                  // RETURN
+    }
+
+    return steal(worker);
+}
+
+WorkStealingScheduler_Task *WorkStealingScheduler_Imp::steal(Worker *thief)
+{
+    const int numWorkers = static_cast<int>(d_workers.size());
+    if (1 == numWorkers) {
+        return 0;                                                     // RETURN
+    }
+
+    const int start = thief->nextRandom() % numWorkers;
+    for (int i = 0; i < numWorkers; ++i) {
+        Worker *victim = d_workers[(start + i) % numWorkers];
+        if (victim == thief) {
+            continue;                                               // CONTINUE
+        }
+
+        Task *task = victim->d_deque.steal();
+        if (task) {
+            increment(&thief->d_numSteals, 1);
+            return task;                                              // RETURN
+        }
+        increment(&thief->d_numFailedSteals, 1);
+    }
+    return 0;
+}
+
+WorkStealingScheduler_Task *WorkStealingScheduler_Imp::takeSubmitted()
+{
+    if (0 == d_numSubmitted.load()) {
+        return 0;                                                     // RETURN
+    }
+
+    Task *task = 0;
+    d_mutex.lock();
+    if (!d_submitted.empty()) {
+        task = d_submitted.front();
+        d_submitted.pop_front();
+        d_numSubmitted.storeRelaxed(static_cast<int>(d_submitted.size()));
+    }
+    d_mutex.unlock();
+    return task;
+}
+
+WorkStealingScheduler_Task *WorkStealingScheduler_Imp::waitForTask(
+                                                                Worker *worker)
+{
+    const Int64 start  = bsls::TimeUtil::getTimer();
+    Task       *result = 0;
+
+    for (int spin = 0; !d_isStopping.load(); ++spin) {
+        result = findTask(worker);
+        if (result) {
+            break;                                                     // BREAK
+        }
+
+        if (spin < k_NUM_SPINS) {
+            bsls::BslThreadUtil::yield();
+            continue;                                               // CONTINUE
+        }
+
+        // Go to sleep.  A worker pushing a task reads 'd_numSleeping' after
+        // publishing the task, and this worker reads the deques after
+        // incrementing 'd_numSleeping', so that one of them sees the other.
+
+        d_mutex.lock();
+        d_numSleeping.add(1);
+        while (!d_isStopping.load() && !hasWork()) {
+            d_workCondition.wait(&d_mutex);
+        }
+        d_numSleeping.add(-1);
+        d_mutex.unlock();
+        spin = 0;
+    }
+
+    increment(&worker->d_idleTime, bsls::TimeUtil::getTimer() - start);
+    return result;
+}
+
+void WorkStealingScheduler_Imp::wakeWorker()
+{
+    if (0 < d_numSleeping.load()) {
+        d_mutex.lock();
+        d_workCondition.signal();
+        d_mutex.unlock();
+    }
+}
+
+void WorkStealingScheduler_Imp::workerMain(Worker *worker)
+{
+    d_currentWorker.set(worker);
+
+    for (;;) {
+        Task *task = findTask(worker);
+        if (!task) {
+            task = waitForTask(worker);
+            if (!task) {
+                break;                                                 // BREAK
+            }
+        }
+        execute(worker, task);
+    }
+
+    d_currentWorker.set(0);
+}
+
+// ACCESSORS
+bool WorkStealingScheduler_Imp::hasWork() const
+{
+    if (0 < d_numSubmitted.load()) {
+        return true;                                                  // RETURN
+    }
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        if (!d_workers[i]->d_deque.isEmpty()) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+}  // close package namespace
+
+namespace {
+
+void runWorker(void *worker)
+    // Run the specified 'worker', of type 'WorkStealingScheduler_Worker',
+    // until its scheduler stops.
+{
+    typedef bdlmt::WorkStealingScheduler_Worker Worker;
+
+    Worker *w = static_cast<Worker *>(worker);
+    w->d_imp_p->workerMain(w);
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                        // ---------------------------
+                        // class WorkStealingScheduler
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+WorkStealingScheduler_Task *
+WorkStealingScheduler::fork(WorkStealingScheduler_Worker  *worker,
+                            void                         (*function)(
+                                                                 const void *),
+                            const void                    *functor)
+{
+    void *memory = worker->d_taskPool.allocate();
+    bslma::DeallocatorProctor<bdlma::Pool> proctor(memory,
+                                                   &worker->d_taskPool);
+
+    WorkStealingScheduler_Task *task = new (memory)
+                                                  WorkStealingScheduler_Task();
+    task->d_function   = function;
+    task->d_functor_p  = functor;
+    task->d_isExternal = false;
+
+    worker->d_deque.pushBottom(task);
+    proctor.release();
+
+    d_imp_p->wakeWorker();
+    return task;
+}
+
+void WorkStealingScheduler::join(WorkStealingScheduler_Worker *worker,
+                                 WorkStealingScheduler_Task   *task)
+{
+    WorkStealingScheduler_Task *popped = worker->d_deque.popBottom();
+    if (popped) {
+        // The deque holds the tasks of the enclosing 'invoke' calls, which
+        // are stolen oldest first; so, if any task is left, it is 'task'.
+
+        BSLS_ASSERT_SAFE(popped == task);
+
+        task->d_function(task->d_functor_p);
+        increment(&worker->d_numTasksExecuted, 1);
+        worker->d_taskPool.deallocate(task);
+        return;                                                       // RETURN
+    }
+
+    // 'task' was stolen: help the other workers until the thief is done.
+
+    Int64 idleStart = 0;
+    while (!task->d_isDone.loadAcquire()) {
+        WorkStealingScheduler_Task *other = d_imp_p->steal(worker);
+        if (other) {
+            if (idleStart) {
+                increment(&worker->d_idleTime,
+                          bsls::TimeUtil::getTimer() - idleStart);
+                idleStart = 0;
+            }
+            d_imp_p->execute(worker, other);
+        }
+        else {
+            if (!idleStart) {
+                idleStart = bsls::TimeUtil::getTimer();
+            }
+            bsls::BslThreadUtil::yield();
+        }
+    }
+    if (idleStart) {
+        increment(&worker->d_idleTime,
+                  bsls::TimeUtil::getTimer() - idleStart);
+    }
+
+    worker->d_taskPool.deallocate(task);
+}
+
+void WorkStealingScheduler::runExternal(WorkStealingScheduler_Task *task)
+{
+    BSLS_ASSERT(task);
+    BSLS_ASSERT(task->d_isExternal);
+
+    WorkStealingScheduler_Imp *imp = d_imp_p;
+
+    imp->d_mutex.lock();
+    imp->d_submitted.push_back(task);
+    imp->d_numSubmitted.storeRelaxed(
+                                  static_cast<int>(imp->d_submitted.size()));
+    imp->d_workCondition.signal();
+    while (!task->d_isDone.loadRelaxed()) {
+        imp->d_doneCondition.wait(&imp->d_mutex);
+    }
+    imp->d_mutex.unlock();
+}
+
+// PRIVATE ACCESSORS
+WorkStealingScheduler_Worker *WorkStealingScheduler::currentWorker() const
+{
+    return d_imp_p
+           ? static_cast<WorkStealingScheduler_Worker *>(
+                                              d_imp_p->d_currentWorker.get())
+           : 0;
+}
+
+// CREATORS
+WorkStealingScheduler::WorkStealingScheduler(int               numThreads,
+                                             bslma::Allocator *basicAllocator)
+: d_numThreads(numThreads)
+, d_imp_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= numThreads);
+
+    if (0 == d_numThreads) {
+        d_numThreads = bsls::ParallelUtil::numHardwareThreads();
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    stop();
+}
+
+// MANIPULATORS
+void WorkStealingScheduler::resetCounters()
+{
+    BSLS_ASSERT(isStarted());
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_imp_p->d_workers[i]->resetCounters();
+    }
+}
+
+int WorkStealingScheduler::start()
+{
+    BSLS_ASSERT(!isStarted());
+
+    // Create every worker before starting any thread, since the threads
+    // steal from each other.
+
+    WorkStealingScheduler_Imp *imp = new (*d_allocator_p)
+                                      WorkStealingScheduler_Imp(d_allocator_p);
+    bslma::RawDeleterProctor<WorkStealingScheduler_Imp, bslma::Allocator>
+                                                   proctor(imp, d_allocator_p);
+
+    imp->d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        imp->d_workers.push_back(new (*d_allocator_p)
+                          WorkStealingScheduler_Worker(imp, i, d_allocator_p));
+    }
+    proctor.release();
+    d_imp_p = imp;
+
+    for (; imp->d_numStarted < d_numThreads; ++imp->d_numStarted) {
+        WorkStealingScheduler_Worker *worker =
+                                            imp->d_workers[imp->d_numStarted];
+        if (0 != bsls::BslThreadUtil::create(&worker->d_thread,
+                                             &runWorker,
+                                             worker)) {
+            break;                                                     // BREAK
+        }
+    }
+
+    if (imp->d_numStarted < d_numThreads) {
+        stop();
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+void WorkStealingScheduler::stop()
+{
+    WorkStealingScheduler_Imp *imp = d_imp_p;
+    if (!imp) {
+        return;                                                       // RETURN
+    }
+
+    imp->d_isStopping = 1;
+    imp->d_mutex.lock();
+    imp->d_workCondition.broadcast();
+    imp->d_mutex.unlock();
+
+    for (int i = 0; i < imp->d_numStarted; ++i) {
+        bsls::BslThreadUtil::join(&imp->d_workers[i]->d_thread);
+    }
+
+    d_imp_p = 0;
+    d_allocator_p->deleteObject(imp);
+}
+
+// ACCESSORS
+bsls::Types::Int64 WorkStealingScheduler::idleTime() const
+{
+    Int64 result = 0;
+    for (int i = 0; i < d_numThreads; ++i) {
+        result += idleTime(i);
+    }
+    return result;
+}
+
+bsls::Types::Int64 WorkStealingScheduler::idleTime(int workerIndex) const
+{
+    BSLS_ASSERT(isStarted());
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return d_imp_p->d_workers[workerIndex]->d_idleTime.loadRelaxed();
+}
+
+bsls::Types::Int64 WorkStealingScheduler::numFailedSteals() const
+{
+    Int64 result = 0;
+    for (int i = 0; i < d_numThreads; ++i) {
+        result += numFailedSteals(i);
+    }
+    return result;
+}
+
+bsls::Types::Int64
+WorkStealingScheduler::numFailedSteals(int workerIndex) const
+{
+    BSLS_ASSERT(isStarted());
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return d_imp_p->d_workers[workerIndex]->d_numFailedSteals.loadRelaxed();
+}
+
+bsls::Types::Int64 WorkStealingScheduler::numSteals() const
+{
+    Int64 result = 0;
+    for (int i = 0; i < d_numThreads; ++i) {
+        result += numSteals(i);
+    }
+    return result;
+}
+
+bsls::Types::Int64 WorkStealingScheduler::numSteals(int workerIndex) const
+{
+    BSLS_ASSERT(isStarted());
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return d_imp_p->d_workers[workerIndex]->d_numSteals.loadRelaxed();
+}
+
+bsls::Types::Int64 WorkStealingScheduler::numTasksExecuted() const
+{
+    Int64 result = 0;
+    for (int i = 0; i < d_numThreads; ++i) {
+        result += numTasksExecuted(i);
+    }
+    return result;
+}
+
+bsls::Types::Int64
+WorkStealingScheduler::numTasksExecuted(int workerIndex) const
+{
+    BSLS_ASSERT(isStarted());
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return d_imp_p->d_workers[workerIndex]->d_numTasksExecuted.loadRelaxed();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,614 @@
+// bdlmt_workstealingscheduler.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGSCHEDULER
+#define INCLUDED_BDLMT_WORKSTEALINGSCHEDULER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fork/join task scheduler using work stealing.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingScheduler: pool of worker threads stealing tasks
+//
+//@SEE_ALSO: bdlmt_workstealingdeque, bsls_parallelutil
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlmt::WorkStealingScheduler', that runs fork/join computations on a
+// fixed set of worker threads.  A computation is started from any thread by
+// 'run', which hands a functor to the workers and waits for it to return.
+// Within a computation, 'invoke' runs two functors, possibly in parallel,
+// and returns when both have returned, and 'parallelFor' calls a functor for
+// each index of a range by splitting the range recursively with 'invoke'.
+// Fork/join computations nest freely, so that divide-and-conquer algorithms
+// (e.g., quick sort, or the naive recursive computation of Fibonacci
+// numbers) are expressed directly:
+//..
+//  void operator()() const
+//  {
+//      // ...
+//      scheduler->invoke(leftHalf, rightHalf);
+//      // both halves are done here
+//  }
+//..
+// Both 'invoke' and 'parallelFor' may also be called from a thread that is
+// not a worker of the scheduler, in which case they are run as a computation
+// by 'run'.
+//
+///Scheduling
+///----------
+// Each worker owns a 'bdlmt::WorkStealingDeque' of tasks.  'invoke(a, b)',
+// called on a worker, pushes a task for 'b' to the bottom of the deque of
+// that worker, calls 'a', and then pops the task back and calls 'b' itself,
+// unless the task was stolen by an idle worker in the meantime; in that
+// case the worker steals and runs other tasks until the thief has run 'b'.
+// A worker finding its deque empty takes a computation submitted by 'run',
+// if any, or tries to steal the oldest task of the other workers, visited in
+// a pseudo-random order.  Since the oldest task of a divide-and-conquer
+// computation is the largest, a thief usually steals enough work to keep it
+// busy for a while, and workers rarely interact.
+//
+// A worker that has found no task for a while sleeps until a task is pushed
+// or submitted.  A worker pushing a task checks whether a worker sleeps (a
+// load of a shared counter) and, if so, wakes one.
+//
+///Task Storage
+///------------
+// A task does not copy its functor: the functor is referenced on the stack
+// of the thread calling 'invoke', which waits for it.  The task itself, a
+// few words holding the address of the functor and a completion flag, is
+// allocated from a 'bdlma::Pool' owned by the worker that pushes it, and is
+// returned to that pool by the same worker after the join, so that forking
+// and joining neither touches the global heap nor synchronizes on an
+// allocator.  The pools, the deques, and the workers themselves are
+// allocated from the allocator supplied at construction, which must be
+// thread-safe, when the scheduler is started.
+//
+///Counters
+///--------
+// Each worker counts the tasks that it executes (including those that it
+// pops back in 'invoke'), the tasks that it steals, the steal attempts that
+// find no task, and the time that it spends looking for a task in vain or
+// sleeping.  The counters are written by their worker only and may be read,
+// per worker or summed over all workers, by any thread at any time; they
+// are reset by 'start' and 'resetCounters'.  'numSteals' relative to
+// 'numTasksExecuted' measures how often the work had to be redistributed,
+// and 'idleTime' relative to the elapsed time of a computation multiplied
+// by 'numThreads' measures the parallelism lost to load imbalance.
+//
+///Thread Safety
+///-------------
+// 'run', 'invoke', and 'parallelFor' may be called concurrently by any
+// number of threads on a started scheduler.  'start', 'stop', and
+// 'resetCounters' must not be called while a computation is running.  The
+// behavior is undefined if a functor run by a scheduler throws an
+// exception.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing a Fibonacci Number
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to compute Fibonacci numbers by the naive recursive
+// definition, as a stand-in for a divide-and-conquer computation whose
+// subproblems are independent.  First, we define a functor computing the
+// number of a given rank, which splits the computation in two until the rank
+// is small enough for the serial computation to be cheaper than a fork:
+//..
+//  int serialFibonacci(int n)
+//  {
+//      return n < 2 ? n : serialFibonacci(n - 1) + serialFibonacci(n - 2);
+//  }
+//
+//  class Fibonacci {
+//      // DATA
+//      bdlmt::WorkStealingScheduler *d_scheduler_p;
+//      int                           d_n;
+//      int                          *d_result_p;
+//
+//    public:
+//      // CREATORS
+//      Fibonacci(bdlmt::WorkStealingScheduler *scheduler,
+//                int                           n,
+//                int                          *result)
+//      : d_scheduler_p(scheduler)
+//      , d_n(n)
+//      , d_result_p(result)
+//      {
+//      }
+//
+//      // ACCESSORS
+//      void operator()() const
+//      {
+//          if (d_n < 20) {
+//              *d_result_p = serialFibonacci(d_n);
+//              return;                                               // RETURN
+//          }
+//
+//          int first, second;
+//          d_scheduler_p->invoke(Fibonacci(d_scheduler_p, d_n - 1, &first),
+//                                Fibonacci(d_scheduler_p, d_n - 2, &second));
+//          *d_result_p = first + second;
+//      }
+//  };
+//..
+// Then, we create a scheduler with four workers and start it:
+//..
+//  bdlmt::WorkStealingScheduler scheduler(4);
+//  int rc = scheduler.start();
+//  assert(0 == rc);
+//..
+// Now, we run the computation from the main thread, which waits for it:
+//..
+//  int result = 0;
+//  scheduler.run(Fibonacci(&scheduler, 30, &result));
+//  assert(832040 == result);
+//..
+// Finally, we observe that the workers executed the tasks of the
+// computation, and stop the scheduler:
+//..
+//  assert(0 < scheduler.numTasksExecuted());
+//  scheduler.stop();
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+class WorkStealingScheduler;
+class WorkStealingScheduler_Imp;
+class WorkStealingScheduler_Worker;
+
+                     // =================================
+                     // struct WorkStealingScheduler_Task
+                     // =================================
+
+struct WorkStealingScheduler_Task {
+    // This component-private 'struct' describes a call of a functor to be
+    // made by a worker of a 'WorkStealingScheduler'.
+
+    // DATA
+    void           (*d_function)(const void *);  // calls '*d_functor_p'
+    const void      *d_functor_p;                // functor to call
+    bsls::AtomicInt  d_isDone;                   // 1 once the call returned
+    bool             d_isExternal;               // 'true' if submitted by
+                                                 // 'run' from a thread that
+                                                 // is not a worker
+};
+
+                    // ===================================
+                    // struct WorkStealingScheduler_Caller
+                    // ===================================
+
+template <class FUNCTOR>
+struct WorkStealingScheduler_Caller {
+    // This component-private 'struct' provides a function that calls a
+    // 'FUNCTOR' through a type-erased pointer.
+
+    // CLASS METHODS
+    static void call(const void *functor);
+        // Call the 'FUNCTOR' object at the specified 'functor' address.
+};
+
+                   // ======================================
+                   // class WorkStealingScheduler_Invocation
+                   // ======================================
+
+template <class FIRST, class SECOND>
+class WorkStealingScheduler_Invocation {
+    // This component-private class is a functor calling 'invoke' on a
+    // scheduler, so that 'invoke' can be run as a computation when it is
+    // called from a thread that is not a worker.
+
+    // DATA
+    WorkStealingScheduler *d_scheduler_p;  // scheduler (held, not owned)
+    const FIRST           *d_first_p;      // first functor (held, not owned)
+    const SECOND          *d_second_p;     // second functor (held, not owned)
+
+  public:
+    // CREATORS
+    WorkStealingScheduler_Invocation(WorkStealingScheduler *scheduler,
+                                     const FIRST           *first,
+                                     const SECOND          *second);
+        // Create a functor calling 'invoke' on the specified 'scheduler'
+        // with the specified 'first' and 'second' functors.
+
+    // ACCESSORS
+    void operator()() const;
+        // Call 'invoke' on the scheduler of this object with its functors.
+};
+
+                   // =======================================
+                   // class WorkStealingScheduler_ParallelFor
+                   // =======================================
+
+template <class FUNCTOR>
+class WorkStealingScheduler_ParallelFor {
+    // This component-private class is a functor calling a body for each
+    // index of a range, by calling itself on both halves of the range with
+    // 'invoke' until the range is no larger than a grain.
+
+    // DATA
+    WorkStealingScheduler *d_scheduler_p;  // scheduler (held, not owned)
+    int                    d_begin;        // first index of the range
+    int                    d_end;          // index past the range
+    int                    d_grainSize;    // largest range called serially
+    const FUNCTOR         *d_body_p;       // body (held, not owned)
+
+  public:
+    // CREATORS
+    WorkStealingScheduler_ParallelFor(WorkStealingScheduler *scheduler,
+                                      int                    begin,
+                                      int                    end,
+                                      int                    grainSize,
+                                      const FUNCTOR         *body);
+        // Create a functor calling the specified 'body' for each index in
+        // the range '[begin, end)', split down to ranges of at most the
+        // specified 'grainSize' indices, on the specified 'scheduler'.
+
+    // ACCESSORS
+    void operator()() const;
+        // Call the body of this object for each index of its range.
+};
+
+                        // ===========================
+                        // class WorkStealingScheduler
+                        // ===========================
+
+class WorkStealingScheduler {
+    // This class provides a fixed set of worker threads running fork/join
+    // computations by work stealing.  See {Scheduling}.
+
+    // DATA
+    int                        d_numThreads;   // number of workers
+    WorkStealingScheduler_Imp *d_imp_p;        // workers and shared state
+                                               // while started, or 0
+    bslma::Allocator          *d_allocator_p;  // memory allocator (held, not
+                                               // owned)
+
+    // NOT IMPLEMENTED
+    WorkStealingScheduler(const WorkStealingScheduler&);
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&);
+
+    // PRIVATE MANIPULATORS
+    WorkStealingScheduler_Task *fork(WorkStealingScheduler_Worker *worker,
+                                     void        (*function)(const void *),
+                                     const void   *functor);
+        // Push to the deque of the specified 'worker', which must be the
+        // worker running the calling thread, a task calling the specified
+        // 'function' with the specified 'functor', and return the task.
+
+    void join(WorkStealingScheduler_Worker *worker,
+              WorkStealingScheduler_Task   *task);
+        // Run the specified 'task', last pushed by 'fork' on the specified
+        // 'worker', if it was not stolen, and otherwise run other tasks
+        // until it is done; then release 'task'.
+
+    void runExternal(WorkStealingScheduler_Task *task);
+        // Submit the specified 'task' to the workers of this scheduler and
+        // wait until it is done.  The behavior is undefined if the calling
+        // thread is a worker of this scheduler.
+
+    // PRIVATE ACCESSORS
+    WorkStealingScheduler_Worker *currentWorker() const;
+        // Return the worker of this scheduler running the calling thread, or
+        // 0 if the calling thread is not a worker of this scheduler.
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingScheduler(int               numThreads     = 0,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create a stopped scheduler having the optionally specified
+        // 'numThreads' worker threads.  If 'numThreads' is not specified or
+        // is 0, the number of hardware threads is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  The
+        // behavior is undefined unless '0 <= numThreads' and the allocator
+        // is thread-safe.
+
+    ~WorkStealingScheduler();
+        // Stop and destroy this scheduler.  The behavior is undefined if a
+        // computation is running.
+
+    // MANIPULATORS
+    template <class FIRST, class SECOND>
+    void invoke(const FIRST& first, const SECOND& second);
+        // Call the specified 'first' and 'second' functors, possibly in
+        // parallel, and return when both have returned.  'first' is called
+        // by the calling thread if it is a worker of this scheduler, and
+        // 'second' by that thread or by another worker.  The behavior is
+        // undefined unless this scheduler is started and both functors can
+        // be called as 'first()' and 'second()' through 'const' references.
+
+    template <class FUNCTOR>
+    void parallelFor(int            begin,
+                     int            end,
+                     int            grainSize,
+                     const FUNCTOR& body);
+        // Call the specified 'body' as 'body(i)' for each index 'i' in the
+        // range '[begin, end)', possibly in parallel, and return when every
+        // call has returned.  The range is split in halves recursively down
+        // to ranges of at most the specified 'grainSize' indices, whose
+        // indices are passed to 'body' in increasing order by one thread.
+        // The behavior is undefined unless this scheduler is started and
+        // '0 < grainSize'.
+
+    void resetCounters();
+        // Reset the counters of every worker of this scheduler to 0.  The
+        // behavior is undefined unless this scheduler is started and no
+        // computation is running.
+
+    template <class FUNCTOR>
+    void run(const FUNCTOR& functor);
+        // Call the specified 'functor' as 'functor()' on a worker of this
+        // scheduler and return when the call has returned.  If the calling
+        // thread is a worker of this scheduler, 'functor' is called directly.
+        // The behavior is undefined unless this scheduler is started.
+
+    int start();
+        // Create the worker threads of this scheduler and reset its
+        // counters.  Return 0 on success, and a non-zero value, leaving this
+        // scheduler stopped, if a thread could not be created.  The behavior
+        // is undefined unless this scheduler is stopped.
+
+    void stop();
+        // Stop the worker threads of this scheduler, wait for them to
+        // terminate, and release the memory used by the workers.  This
+        // method has no effect if this scheduler is stopped.  The behavior
+        // is undefined if a computation is running.
+
+    // ACCESSORS
+    bsls::Types::Int64 idleTime() const;
+    bsls::Types::Int64 idleTime(int workerIndex) const;
+        // Return the time, in nanoseconds, spent by the workers of this
+        // scheduler, or by the worker of the optionally specified
+        // 'workerIndex', looking for a task in vain or sleeping since the
+        // counters were last reset.  The behavior is undefined unless this
+        // scheduler is started and '0 <= workerIndex < numThreads()'.
+
+    bool isStarted() const;
+        // Return 'true' if this scheduler is started, and 'false' otherwise.
+
+    bsls::Types::Int64 numFailedSteals() const;
+    bsls::Types::Int64 numFailedSteals(int workerIndex) const;
+        // Return the number of attempts by the workers of this scheduler, or
+        // by the worker of the optionally specified 'workerIndex', to steal
+        // a task from another worker that found no task, since the counters
+        // were last reset.  The behavior is undefined unless this scheduler
+        // is started and '0 <= workerIndex < numThreads()'.
+
+    bsls::Types::Int64 numSteals() const;
+    bsls::Types::Int64 numSteals(int workerIndex) const;
+        // Return the number of tasks stolen by the workers of this scheduler,
+        // or by the worker of the optionally specified 'workerIndex', since
+        // the counters were last reset.  The behavior is undefined unless
+        // this scheduler is started and '0 <= workerIndex < numThreads()'.
+
+    bsls::Types::Int64 numTasksExecuted() const;
+    bsls::Types::Int64 numTasksExecuted(int workerIndex) const;
+        // Return the number of tasks executed by the workers of this
+        // scheduler, or by the worker of the optionally specified
+        // 'workerIndex', since the counters were last reset.  The behavior
+        // is undefined unless this scheduler is started and
+        // '0 <= workerIndex < numThreads()'.
+
+    int numThreads() const;
+        // Return the number of worker threads of this scheduler.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                    // -----------------------------------
+                    // struct WorkStealingScheduler_Caller
+                    // -----------------------------------
+
+// CLASS METHODS
+template <class FUNCTOR>
+void WorkStealingScheduler_Caller<FUNCTOR>::call(const void *functor)
+{
+    (*static_cast<const FUNCTOR *>(functor))();
+}
+
+                   // --------------------------------------
+                   // class WorkStealingScheduler_Invocation
+                   // --------------------------------------
+
+// CREATORS
+template <class FIRST, class SECOND>
+inline
+WorkStealingScheduler_Invocation<FIRST, SECOND>::
+WorkStealingScheduler_Invocation(WorkStealingScheduler *scheduler,
+                                 const FIRST           *first,
+                                 const SECOND          *second)
+: d_scheduler_p(scheduler)
+, d_first_p(first)
+, d_second_p(second)
+{
+}
+
+// ACCESSORS
+template <class FIRST, class SECOND>
+inline
+void WorkStealingScheduler_Invocation<FIRST, SECOND>::operator()() const
+{
+    d_scheduler_p->invoke(*d_first_p, *d_second_p);
+}
+
+                   // ---------------------------------------
+                   // class WorkStealingScheduler_ParallelFor
+                   // ---------------------------------------
+
+// CREATORS
+template <class FUNCTOR>
+inline
+WorkStealingScheduler_ParallelFor<FUNCTOR>::WorkStealingScheduler_ParallelFor(
+                                              WorkStealingScheduler *scheduler,
+                                              int                    begin,
+                                              int                    end,
+                                              int                    grainSize,
+                                              const FUNCTOR         *body)
+: d_scheduler_p(scheduler)
+, d_begin(begin)
+, d_end(end)
+, d_grainSize(grainSize)
+, d_body_p(body)
+{
+}
+
+// ACCESSORS
+template <class FUNCTOR>
+void WorkStealingScheduler_ParallelFor<FUNCTOR>::operator()() const
+{
+    if (d_end - d_begin <= d_grainSize) {
+        for (int i = d_begin; i < d_end; ++i) {
+            (*d_body_p)(i);
+        }
+        return;                                                       // RETURN
+    }
+
+    const int middle = d_begin + (d_end - d_begin) / 2;
+    d_scheduler_p->invoke(
+             WorkStealingScheduler_ParallelFor(d_scheduler_p,
+                                               d_begin,
+                                               middle,
+                                               d_grainSize,
+                                               d_body_p),
+             WorkStealingScheduler_ParallelFor(d_scheduler_p,
+                                               middle,
+                                               d_end,
+                                               d_grainSize,
+                                               d_body_p));
+}
+
+                        // ---------------------------
+                        // class WorkStealingScheduler
+                        // ---------------------------
+
+// MANIPULATORS
+template <class FIRST, class SECOND>
+void WorkStealingScheduler::invoke(const FIRST& first, const SECOND& second)
+{
+    BSLS_ASSERT(isStarted());
+
+    WorkStealingScheduler_Worker *worker = currentWorker();
+    if (!worker) {
+        run(WorkStealingScheduler_Invocation<FIRST, SECOND>(this,
+                                                            &first,
+                                                            &second));
+        return;                                                       // RETURN
+    }
+
+    WorkStealingScheduler_Task *task =
+                      fork(worker,
+                           &WorkStealingScheduler_Caller<SECOND>::call,
+                           &second);
+    first();
+    join(worker, task);
+}
+
+template <class FUNCTOR>
+void WorkStealingScheduler::parallelFor(int            begin,
+                                        int            end,
+                                        int            grainSize,
+                                        const FUNCTOR& body)
+{
+    BSLS_ASSERT(isStarted());
+    BSLS_ASSERT(0 < grainSize);
+
+    if (begin >= end) {
+        return;                                                       // RETURN
+    }
+
+    WorkStealingScheduler_ParallelFor<FUNCTOR> range(this,
+                                                     begin,
+                                                     end,
+                                                     grainSize,
+                                                     &body);
+    if (currentWorker()) {
+        range();
+    }
+    else {
+        run(range);
+    }
+}
+
+template <class FUNCTOR>
+void WorkStealingScheduler::run(const FUNCTOR& functor)
+{
+    BSLS_ASSERT(isStarted());
+
+    if (currentWorker()) {
+        functor();
+        return;                                                       // RETURN
+    }
+
+    WorkStealingScheduler_Task task;
+    task.d_function   = &WorkStealingScheduler_Caller<FUNCTOR>::call;
+    task.d_functor_p  = &functor;
+    task.d_isExternal = true;
+    runExternal(&task);
+}
+
+// ACCESSORS
+inline
+bool WorkStealingScheduler::isStarted() const
+{
+    return 0 != d_imp_p;
+}
+
+inline
+int WorkStealingScheduler::numThreads() const
+{
+    return d_numThreads;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
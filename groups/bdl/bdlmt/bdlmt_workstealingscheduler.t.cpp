@@ -0,0 +1,985 @@
+// bdlmt_workstealingscheduler.t.cpp                                  -*-C++-*-
+#include <bdlmt_workstealingscheduler.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_parallelutil.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a scheduler running fork/join computations on
+// worker threads.  The results of fork/join computations do not depend on
+// the schedule, and the number of tasks executed does not either (each
+// 'invoke' executes exactly one task, popped back or stolen), so both are
+// verified exactly for several numbers of workers.  The other counters
+// depend on the schedule, and are only checked for consistency.  Note that
+// the machine running the tests may have a single processor, in which case
+// the workers are interleaved rather than parallel.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit WorkStealingScheduler(int numThreads = 0, *ba = 0);
+// [ 2] ~WorkStealingScheduler();
+//
+// MANIPULATORS
+// [ 4] void invoke(const FIRST& first, const SECOND& second);
+// [ 5] void parallelFor(int begin, int end, int grainSize, const F& body);
+// [ 4] void resetCounters();
+// [ 3] void run(const FUNCTOR& functor);
+// [ 2] int start();
+// [ 2] void stop();
+//
+// ACCESSORS
+// [ 4] Int64 idleTime() const;
+// [ 4] Int64 idleTime(int workerIndex) const;
+// [ 2] bool isStarted() const;
+// [ 4] Int64 numFailedSteals() const;
+// [ 4] Int64 numFailedSteals(int workerIndex) const;
+// [ 4] Int64 numSteals() const;
+// [ 4] Int64 numSteals(int workerIndex) const;
+// [ 3] Int64 numTasksExecuted() const;
+// [ 3] Int64 numTasksExecuted(int workerIndex) const;
+// [ 2] int numThreads() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: RECURSIVE FIBONACCI
+// [ 2] CONCERN: all memory comes from the supplied allocator
+// [ *] CONCERN: precondition violations are detected when enabled
+
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingScheduler Obj;
+typedef bsls::Types::Int64           Int64;
+
+static const int THREADS[] = { 1, 2, 3, 4, 8 };
+const int NUM_THREADS = sizeof THREADS / sizeof *THREADS;
+
+                              // =============
+                              // class Counter
+                              // =============
+
+class Counter {
+    // This class is a functor adding one to a counter.
+
+    // DATA
+    bsls::AtomicInt *d_count_p;  // counter (held, not owned)
+
+  public:
+    // CREATORS
+    explicit Counter(bsls::AtomicInt *count)
+        // Create a functor adding one to the specified 'count'.
+    : d_count_p(count)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Add one to the counter of this functor.
+    {
+        d_count_p->add(1);
+    }
+};
+
+                               // ==========
+                               // class Tree
+                               // ==========
+
+class Tree {
+    // This class is a functor splitting itself in two with 'invoke' down to
+    // a given depth, and counting the leaves reached.
+
+    // DATA
+    Obj             *d_scheduler_p;  // scheduler (held, not owned)
+    int              d_depth;        // remaining number of levels
+    bsls::AtomicInt *d_numLeaves_p;  // counter (held, not owned)
+
+  public:
+    // CREATORS
+    Tree(Obj *scheduler, int depth, bsls::AtomicInt *numLeaves)
+        // Create a functor splitting itself down the specified 'depth' on
+        // the specified 'scheduler' and counting leaves in the specified
+        // 'numLeaves'.
+    : d_scheduler_p(scheduler)
+    , d_depth(depth)
+    , d_numLeaves_p(numLeaves)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Split this functor in two, or count a leaf if its depth is 0.
+    {
+        if (0 == d_depth) {
+            d_numLeaves_p->add(1);
+            return;                                                   // RETURN
+        }
+        d_scheduler_p->invoke(Tree(d_scheduler_p, d_depth - 1, d_numLeaves_p),
+                              Tree(d_scheduler_p, d_depth - 1, d_numLeaves_p));
+    }
+};
+
+                             // ===============
+                             // class NestedRun
+                             // ===============
+
+class NestedRun {
+    // This class is a functor calling 'run' on a scheduler from within a
+    // computation, and recording the number of tasks executed around it.
+
+    // DATA
+    Obj             *d_scheduler_p;  // scheduler (held, not owned)
+    bsls::AtomicInt *d_count_p;      // counter (held, not owned)
+    Int64           *d_before_p;     // tasks executed before the nested run
+    Int64           *d_after_p;      // tasks executed after the nested run
+
+  public:
+    // CREATORS
+    NestedRun(Obj             *scheduler,
+              bsls::AtomicInt *count,
+              Int64           *before,
+              Int64           *after)
+        // Create a functor running a 'Counter' of the specified 'count' on
+        // the specified 'scheduler', and loading the number of tasks
+        // executed before and after into the specified 'before' and
+        // 'after'.
+    : d_scheduler_p(scheduler)
+    , d_count_p(count)
+    , d_before_p(before)
+    , d_after_p(after)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Run a 'Counter' on the scheduler of this functor.
+    {
+        *d_before_p = d_scheduler_p->numTasksExecuted();
+        d_scheduler_p->run(Counter(d_count_p));
+        *d_after_p = d_scheduler_p->numTasksExecuted();
+    }
+};
+
+                              // ===========
+                              // class Visit
+                              // ===========
+
+class Visit {
+    // This class is a functor counting the visits of each index.
+
+    // DATA
+    bsls::AtomicInt *d_visits_p;  // counters, by index (held, not owned)
+    int              d_offset;    // index of 'd_visits_p[0]'
+
+  public:
+    // CREATORS
+    Visit(bsls::AtomicInt *visits, int offset)
+        // Create a functor counting the visits of index 'i' in
+        // 'visits[i - offset]' for the specified 'visits' and 'offset'.
+    : d_visits_p(visits)
+    , d_offset(offset)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(int index) const
+        // Count a visit of the specified 'index'.
+    {
+        d_visits_p[index - d_offset].add(1);
+    }
+};
+
+                         // =======================
+                         // class NestedParallelFor
+                         // =======================
+
+class NestedParallelFor {
+    // This class is a functor calling 'parallelFor' from within a
+    // computation.
+
+    // DATA
+    Obj          *d_scheduler_p;  // scheduler (held, not owned)
+    const Visit  *d_visit_p;      // body (held, not owned)
+    int           d_begin;        // first index
+    int           d_end;          // index past the range
+
+  public:
+    // CREATORS
+    NestedParallelFor(Obj         *scheduler,
+                      const Visit *visit,
+                      int          begin,
+                      int          end)
+        // Create a functor calling the specified 'visit' for each index in
+        // '[begin, end)' on the specified 'scheduler'.
+    : d_scheduler_p(scheduler)
+    , d_visit_p(visit)
+    , d_begin(begin)
+    , d_end(end)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Call 'parallelFor' with the range of this functor, in grains of 3.
+    {
+        d_scheduler_p->parallelFor(d_begin, d_end, 3, *d_visit_p);
+    }
+};
+
+                          // =====================
+                          // struct ExternalRunner
+                          // =====================
+
+struct ExternalRunner {
+    // This 'struct' holds a scheduler on which several threads run
+    // computations concurrently.
+
+    Obj             *d_scheduler_p;  // scheduler (held, not owned)
+    bsls::AtomicInt  d_numLeaves;    // leaves counted by the computations
+};
+
+void runExternally(void *context, int)
+    // Run a 'Tree' of depth 6 on the scheduler of the 'ExternalRunner' at the
+    // specified 'context'.
+{
+    ExternalRunner& runner = *static_cast<ExternalRunner *>(context);
+    runner.d_scheduler_p->run(Tree(runner.d_scheduler_p,
+                                   6,
+                                   &runner.d_numLeaves));
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing a Fibonacci Number
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to compute Fibonacci numbers by the naive recursive
+// definition, as a stand-in for a divide-and-conquer computation whose
+// subproblems are independent.  First, we define a functor computing the
+// number of a given rank, which splits the computation in two until the rank
+// is small enough for the serial computation to be cheaper than a fork:
+//..
+    int serialFibonacci(int n)
+    {
+        return n < 2 ? n : serialFibonacci(n - 1) + serialFibonacci(n - 2);
+    }
+
+    class Fibonacci {
+        // DATA
+        bdlmt::WorkStealingScheduler *d_scheduler_p;
+        int                           d_n;
+        int                          *d_result_p;
+
+      public:
+        // CREATORS
+        Fibonacci(bdlmt::WorkStealingScheduler *scheduler,
+                  int                           n,
+                  int                          *result)
+        : d_scheduler_p(scheduler)
+        , d_n(n)
+        , d_result_p(result)
+        {
+        }
+
+        // ACCESSORS
+        void operator()() const
+        {
+            if (d_n < 20) {
+                *d_result_p = serialFibonacci(d_n);
+                return;                                               // RETURN
+            }
+
+            int first, second;
+            d_scheduler_p->invoke(Fibonacci(d_scheduler_p, d_n - 1, &first),
+                                  Fibonacci(d_scheduler_p, d_n - 2, &second));
+            *d_result_p = first + second;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, we create a scheduler with four workers and start it:
+//..
+    bdlmt::WorkStealingScheduler scheduler(4);
+    int rc = scheduler.start();
+    ASSERT(0 == rc);
+//..
+// Now, we run the computation from the main thread, which waits for it:
+//..
+    int result = 0;
+    scheduler.run(Fibonacci(&scheduler, 30, &result));
+    ASSERT(832040 == result);
+//..
+// Finally, we observe that the workers executed the tasks of the
+// computation, and stop the scheduler:
+//..
+    ASSERT(0 < scheduler.numTasksExecuted());
+    scheduler.stop();
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PARALLEL FOR
+        //
+        // Concerns:
+        //: 1 'parallelFor' calls the body once for each index of the range,
+        //:   and never for other indices, for any grain size.
+        //:
+        //: 2 An empty range calls nothing.
+        //:
+        //: 3 'parallelFor' may be called from a thread that is not a worker
+        //:   and from within a computation.
+        //:
+        //: 4 A non-positive grain size is detected.
+        //
+        // Plan:
+        //: 1 For several numbers of workers, ranges, and grain sizes, call
+        //:   'parallelFor' with a body counting the visits of each index in
+        //:   an array having a margin around the range, from the main thread
+        //:   and from a computation run by 'run'.  Verify the counts.
+        //:   (C-1..3)
+        //:
+        //: 2 Use 'BSLS_ASSERTTEST_*' to verify defensive checks.  (C-4)
+        //
+        // Testing:
+        //   void parallelFor(int begin, int end, int grainSize, const F&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PARALLEL FOR" << endl
+                                  << "============" << endl;
+
+        static const struct {
+            int d_line;
+            int d_begin;
+            int d_end;
+            int d_grainSize;
+        } DATA[] = {
+            //LINE  BEGIN   END  GRAIN
+            //----  -----  ----  -----
+            { L_,       0,    0,     1 },
+            { L_,       5,    3,     1 },
+            { L_,       0,    1,     1 },
+            { L_,       0,    2,     1 },
+            { L_,       0,  100,     1 },
+            { L_,       0,  100,     7 },
+            { L_,     -50,   50,    10 },
+            { L_,       3,  997,    16 },
+            { L_,       0, 1000,  1000 },
+            { L_,       0, 1000,  5000 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MARGIN = 4;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            Obj mX(THREADS[ti], &oa);
+            ASSERT(0 == mX.start());
+
+            for (int di = 0; di < NUM_DATA; ++di) {
+                const int LINE  = DATA[di].d_line;
+                const int BEGIN = DATA[di].d_begin;
+                const int END   = DATA[di].d_end;
+                const int GRAIN = DATA[di].d_grainSize;
+
+                const int SIZE   = END > BEGIN ? END - BEGIN : 0;
+                const int OFFSET = BEGIN - MARGIN;
+
+                for (int nested = 0; nested < 2; ++nested) {
+                    bsls::AtomicInt *visits =
+                                     new bsls::AtomicInt[SIZE + 2 * MARGIN];
+                    Visit visit(visits, OFFSET);
+
+                    if (nested) {
+                        mX.run(NestedParallelFor(&mX, &visit, BEGIN, END));
+                    }
+                    else {
+                        mX.parallelFor(BEGIN, END, GRAIN, visit);
+                    }
+
+                    for (int i = 0; i < SIZE + 2 * MARGIN; ++i) {
+                        const int EXP = MARGIN <= i && i < MARGIN + SIZE;
+                        LOOP4_ASSERT(LINE, THREADS[ti], nested, i,
+                                     EXP == visits[i].load());
+                    }
+                    delete[] visits;
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bsls::AtomicInt visits[4];
+            Visit           visit(visits, 0);
+
+            Obj mX(1, &oa);
+            ASSERT_FAIL(mX.parallelFor(0, 4, 1, visit));
+
+            ASSERT(0 == mX.start());
+            ASSERT_PASS(mX.parallelFor(0, 4, 1, visit));
+            ASSERT_FAIL(mX.parallelFor(0, 4, 0, visit));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INVOKE AND COUNTERS
+        //
+        // Concerns:
+        //: 1 'invoke' calls both functors and returns after both returned,
+        //:   at any depth of nesting.
+        //:
+        //: 2 Each 'invoke' executes exactly one task, so that a computation
+        //:   making 'n' calls to 'invoke' executes 'n + 1' tasks.
+        //:
+        //: 3 'invoke' may be called from a thread that is not a worker.
+        //:
+        //: 4 The counters summed over the workers equal the totals, steals
+        //:   are no more than the tasks executed, and 'resetCounters' resets
+        //:   every counter.
+        //:
+        //: 5 Calling 'invoke' on a stopped scheduler is detected, as is a
+        //:   worker index out of range.
+        //
+        // Plan:
+        //: 1 For several numbers of workers, run a 'Tree' of depth 12, whose
+        //:   leaves are counted, and verify the number of leaves and of
+        //:   tasks executed.  Verify the counters.  (C-1..2, 4)
+        //:
+        //: 2 Call 'invoke' with two 'Counter' functors from the main thread
+        //:   and verify that both were called and that two tasks were
+        //:   executed.  (C-3)
+        //:
+        //: 3 Use 'BSLS_ASSERTTEST_*' to verify defensive checks.  (C-5)
+        //
+        // Testing:
+        //   void invoke(const FIRST& first, const SECOND& second);
+        //   void resetCounters();
+        //   Int64 idleTime() const;
+        //   Int64 idleTime(int workerIndex) const;
+        //   Int64 numFailedSteals() const;
+        //   Int64 numFailedSteals(int workerIndex) const;
+        //   Int64 numSteals() const;
+        //   Int64 numSteals(int workerIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "INVOKE AND COUNTERS" << endl
+                                  << "===================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int DEPTH = 12;
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int N = THREADS[ti];
+
+            Obj mX(N, &oa);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            for (int round = 0; round < 3; ++round) {
+                mX.resetCounters();
+                LOOP_ASSERT(N, 0 == X.numTasksExecuted());
+                LOOP_ASSERT(N, 0 == X.numSteals());
+                LOOP_ASSERT(N, 0 == X.numFailedSteals());
+                LOOP_ASSERT(N, 0 == X.idleTime());
+
+                bsls::AtomicInt numLeaves(0);
+                mX.run(Tree(&mX, DEPTH, &numLeaves));
+
+                LOOP_ASSERT(N, (1 << DEPTH) == numLeaves.load());
+                LOOP2_ASSERT(N,
+                             X.numTasksExecuted(),
+                             (1 << DEPTH) == X.numTasksExecuted());
+
+                Int64 numTasks = 0, numSteals = 0, numFailed = 0, idle = 0;
+                for (int i = 0; i < N; ++i) {
+                    numTasks  += X.numTasksExecuted(i);
+                    numSteals += X.numSteals(i);
+                    numFailed += X.numFailedSteals(i);
+                    idle      += X.idleTime(i);
+                    LOOP2_ASSERT(N, i, 0 <= X.idleTime(i));
+                }
+                LOOP_ASSERT(N, numTasks  == X.numTasksExecuted());
+                LOOP_ASSERT(N, numSteals == X.numSteals());
+                LOOP_ASSERT(N, numFailed == X.numFailedSteals());
+                LOOP_ASSERT(N, idle      == X.idleTime());
+                LOOP_ASSERT(N, numSteals <= numTasks);
+                if (1 == N) {
+                    LOOP_ASSERT(N, 0 == numSteals);
+                    LOOP_ASSERT(N, 0 == numFailed);
+                }
+
+                if (veryVerbose) {
+                    P_(N) P_(numTasks) P_(numSteals) P_(numFailed) P(idle);
+                }
+            }
+
+            mX.resetCounters();
+
+            bsls::AtomicInt count(0);
+            mX.invoke(Counter(&count), Counter(&count));
+            LOOP_ASSERT(N, 2 == count.load());
+            LOOP_ASSERT(N, 2 == X.numTasksExecuted());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bsls::AtomicInt count(0);
+
+            Obj mX(2, &oa);  const Obj& X = mX;
+            ASSERT_FAIL(mX.invoke(Counter(&count), Counter(&count)));
+            ASSERT_FAIL(mX.resetCounters());
+            ASSERT_FAIL(X.numSteals());
+
+            ASSERT(0 == mX.start());
+            ASSERT_PASS(mX.invoke(Counter(&count), Counter(&count)));
+            ASSERT_PASS(mX.resetCounters());
+
+            ASSERT_FAIL(X.idleTime(-1));
+            ASSERT_PASS(X.idleTime(0));
+            ASSERT_PASS(X.idleTime(1));
+            ASSERT_FAIL(X.idleTime(2));
+            ASSERT_FAIL(X.numFailedSteals(2));
+            ASSERT_FAIL(X.numSteals(2));
+            ASSERT_FAIL(X.numTasksExecuted(2));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RUN
+        //
+        // Concerns:
+        //: 1 'run' called from a thread that is not a worker calls the
+        //:   functor on a worker, as one task, and returns after the call
+        //:   returned.
+        //:
+        //: 2 'run' called from within a computation calls the functor
+        //:   directly.
+        //:
+        //: 3 Several threads may call 'run' concurrently.
+        //:
+        //: 4 Calling 'run' on a stopped scheduler is detected.
+        //
+        // Plan:
+        //: 1 For several numbers of workers, run a 'Counter' and verify the
+        //:   count and the number of tasks executed.  (C-1)
+        //:
+        //: 2 Run a 'NestedRun' functor and verify that the nested 'run' did
+        //:   not execute a task.  (C-2)
+        //:
+        //: 3 Use 'bsls::ParallelUtil::run' to run 'Tree' computations from 8
+        //:   threads at once, and verify the total number of leaves.  (C-3)
+        //:
+        //: 4 Use 'BSLS_ASSERTTEST_*' to verify defensive checks.  (C-4)
+        //
+        // Testing:
+        //   void run(const FUNCTOR& functor);
+        //   Int64 numTasksExecuted() const;
+        //   Int64 numTasksExecuted(int workerIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "RUN" << endl
+                                  << "===" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int N = THREADS[ti];
+
+            Obj mX(N, &oa);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt count(0);
+            for (int i = 1; i <= 10; ++i) {
+                mX.run(Counter(&count));
+                LOOP2_ASSERT(N, i, i == count.load());
+                LOOP2_ASSERT(N, i, i == X.numTasksExecuted());
+            }
+
+            Int64 before = -1, after = -1;
+            mX.run(NestedRun(&mX, &count, &before, &after));
+            LOOP_ASSERT(N, 11     == count.load());
+            LOOP_ASSERT(N, before == after);
+            LOOP_ASSERT(N, 11     == X.numTasksExecuted());
+
+            ExternalRunner runner;
+            runner.d_scheduler_p = &mX;
+            bsls::ParallelUtil::run(&runExternally, &runner, 8, 8);
+            LOOP_ASSERT(N, 8 * (1 << 6) == runner.d_numLeaves.load());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bsls::AtomicInt count(0);
+
+            Obj mX(1, &oa);
+            ASSERT_FAIL(mX.run(Counter(&count)));
+
+            ASSERT(0 == mX.start());
+            ASSERT_PASS(mX.run(Counter(&count)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, START, AND STOP
+        //
+        // Concerns:
+        //: 1 A scheduler is created stopped, with the specified number of
+        //:   workers, or with the number of hardware threads by default.
+        //:
+        //: 2 'start' starts the workers, and 'stop' stops them and releases
+        //:   their memory; a scheduler may be started again after 'stop',
+        //:   and 'stop' has no effect on a stopped scheduler.
+        //:
+        //: 3 The destructor stops a started scheduler.
+        //:
+        //: 4 All memory comes from the supplied allocator.
+        //:
+        //: 5 A negative number of threads, and starting a started scheduler,
+        //:   are detected.
+        //
+        // Plan:
+        //: 1 For several numbers of workers, create a scheduler with a test
+        //:   allocator while a test allocator is installed as the default,
+        //:   and start and stop it a few times, running a computation each
+        //:   time.  Verify 'isStarted', 'numThreads', and the memory use of
+        //:   both allocators.  Destroy a started scheduler.  (C-1..4)
+        //:
+        //: 2 Use 'BSLS_ASSERTTEST_*' to verify defensive checks.  (C-5)
+        //
+        // Testing:
+        //   explicit WorkStealingScheduler(int numThreads = 0, *ba = 0);
+        //   ~WorkStealingScheduler();
+        //   int start();
+        //   void stop();
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATORS, START, AND STOP" << endl
+                                  << "=========================" << endl;
+
+        {
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(bsls::ParallelUtil::numHardwareThreads() == X.numThreads());
+            ASSERT(!X.isStarted());
+            ASSERT(0 == da.numBlocksTotal());
+
+            ASSERT(0 == mX.start());
+            ASSERT(X.isStarted());
+            ASSERT(0 <  da.numBlocksInUse());
+
+            mX.stop();
+            ASSERT(!X.isStarted());
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int N = THREADS[ti];
+
+            bslma::TestAllocator         oa("object", veryVeryVerbose);
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            {
+                Obj mX(N, &oa);  const Obj& X = mX;
+                LOOP_ASSERT(N, N == X.numThreads());
+                LOOP_ASSERT(N, !X.isStarted());
+                LOOP_ASSERT(N, 0 == oa.numBlocksTotal());
+
+                mX.stop();
+                LOOP_ASSERT(N, !X.isStarted());
+
+                for (int round = 0; round < 3; ++round) {
+                    LOOP2_ASSERT(N, round, 0 == mX.start());
+                    LOOP2_ASSERT(N, round, X.isStarted());
+                    LOOP2_ASSERT(N, round, 0 == X.numTasksExecuted());
+                    LOOP2_ASSERT(N, round, 0 <  oa.numBlocksInUse());
+
+                    bsls::AtomicInt numLeaves(0);
+                    mX.run(Tree(&mX, 8, &numLeaves));
+                    LOOP2_ASSERT(N, round, 256 == numLeaves.load());
+
+                    mX.stop();
+                    LOOP2_ASSERT(N, round, !X.isStarted());
+                    LOOP2_ASSERT(N, round, 0 == oa.numBlocksInUse());
+
+                    mX.stop();
+                    LOOP2_ASSERT(N, round, !X.isStarted());
+                }
+
+                LOOP_ASSERT(N, 0 == mX.start());
+            }
+            LOOP_ASSERT(N, 0 == oa.numBlocksInUse());
+            LOOP_ASSERT(N, 0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            ASSERT_FAIL(Obj(-1, &oa));
+            ASSERT_PASS(Obj( 0, &oa));
+            ASSERT_PASS(Obj( 1, &oa));
+
+            Obj mX(1, &oa);
+            ASSERT_PASS(mX.start());
+            ASSERT_FAIL(mX.start());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a scheduler, run a few computations, and stop it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(2, &oa);  const Obj& X = mX;
+        ASSERT(!X.isStarted());
+        ASSERT(0 == mX.start());
+        ASSERT(X.isStarted());
+
+        bsls::AtomicInt count(0);
+        mX.run(Counter(&count));
+        ASSERT(1 == count.load());
+
+        mX.invoke(Counter(&count), Counter(&count));
+        ASSERT(3 == count.load());
+
+        bsls::AtomicInt numLeaves(0);
+        mX.run(Tree(&mX, 4, &numLeaves));
+        ASSERT(16 == numLeaves.load());
+
+        mX.stop();
+        ASSERT(!X.isStarted());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RECURSIVE FIBONACCI
+        //
+        // Concerns:
+        //: 1 Fork/join computations speed up with the number of workers, up
+        //:   to the number of hardware threads.
+        //
+        // Plan:
+        //: 1 Compute the Fibonacci number of rank 35 (or the rank given as
+        //:   the second argument) with a serial cutoff of 20, for 1, 2, 4,
+        //:   ... workers up to twice the number of hardware threads, and
+        //:   print the times and counters.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: RECURSIVE FIBONACCI
+        // --------------------------------------------------------------------
+
+        cout << endl << "PERFORMANCE: RECURSIVE FIBONACCI" << endl
+                     << "================================" << endl;
+
+        const int RANK     = argc > 2 ? atoi(argv[2]) : 35;
+        const int MAX      = 2 * bsls::ParallelUtil::numHardwareThreads();
+        const int EXPECTED = serialFibonacci(RANK);
+
+        for (int n = 1; n <= MAX; n *= 2) {
+            Obj mX(n);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            int         result = 0;
+            const Int64 start  = bsls::TimeUtil::getTimer();
+            mX.run(Fibonacci(&mX, RANK, &result));
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+            LOOP_ASSERT(n, EXPECTED == result);
+
+            cout << "threads: " << n
+                 << "  seconds: " << static_cast<double>(elapsed) * 1e-9
+                 << "  tasks: " << X.numTasksExecuted()
+                 << "  steals: " << X.numSteals()
+                 << "  failed steals: " << X.numFailedSteals()
+                 << "  idle seconds: "
+                 << static_cast<double>(X.idleTime()) * 1e-9 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
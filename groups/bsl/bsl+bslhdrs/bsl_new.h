@@ -23,6 +23,12 @@ BSLS_IDENT("$Id: $")
 
 #include <new>
 
+// 'terminate_handler', 'bad_exception', and the other names imported below
+// that are not part of '<new>' are declared by '<exception>', which newer
+// native libraries do not include from '<new>'.
+
+#include <exception>
+
 namespace bsl
 {
     // Import selected symbols into bsl namespace
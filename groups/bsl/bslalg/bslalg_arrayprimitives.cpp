@@ -131,7 +131,15 @@ void ArrayPrimitives_Imp::bitwiseFillN(char      *begin,
     BSLS_ASSERT_SAFE(begin || 0 == numBytes);
     BSLS_ASSERT(numBytesInitialized <= numBytes);
 
-    // Copy the destination onto itself, doubling size at every iteration.
+    // Copy the destination onto itself, doubling size at every iteration
+    // until the source block reaches 'k_FILL_BLOCK_SIZE' bytes.  From then on
+    // the same block, which stays in the L1 cache, is stored again and again,
+    // instead of reading back the (much larger, and already evicted) part of
+    // the range written so far.  Note that the block size must not be bounded
+    // in a way visible to the compiler, or 'memcpy' may be expanded inline
+    // into a slow string instruction.
+
+    enum { k_FILL_BLOCK_SIZE = 4096 };
 
     char *end = begin + numBytesInitialized;
     numBytes -= numBytesInitialized;            // bytes remaining to be copied
@@ -140,7 +148,9 @@ void ArrayPrimitives_Imp::bitwiseFillN(char      *begin,
         std::memcpy(end, begin, numBytesInitialized);
         end += numBytesInitialized;
         numBytes -= numBytesInitialized;
-        numBytesInitialized *= 2;
+        if (numBytesInitialized < k_FILL_BLOCK_SIZE) {
+            numBytesInitialized *= 2;
+        }
     }
     if (0 < numBytes) {
         std::memcpy(end, begin, numBytes);   // finish copying end of the range
@@ -3444,6 +3444,43 @@ int main(int argc, char *argv[])
             testUninitializedFillNBCT<const int *>((const int*)&test);
             testUninitializedFillNBCT<const int *>((const int*)~0LL);
         }
+
+        if (verbose) printf("\n\t...with ranges larger than a fill block.\n");
+        {
+            // 'bitwiseFillN' doubles the initialized prefix only up to a
+            // block size, then stores that block repeatedly.  Check patterns
+            // whose sizes do not divide the block size, and patterns larger
+            // than a block, in ranges spanning several blocks.
+
+            const int INITS[]   = { 1, 3, 12, 100, 4095, 5000 };
+            const int NUM_INITS = sizeof INITS / sizeof *INITS;
+
+            const int MAX_BYTES = 30000;
+            static char buffer[MAX_BYTES + 1];
+
+            for (int ti = 0; ti < NUM_INITS; ++ti) {
+                const int INIT = INITS[ti];
+
+                int numBytes = INIT;
+                for (; numBytes <= MAX_BYTES; numBytes += 1 + numBytes / 3) {
+                    for (int i = 0; i < INIT; ++i) {
+                        buffer[i] = (char)('a' + i % 23);
+                    }
+                    memset(buffer + INIT, '#', MAX_BYTES + 1 - INIT);
+
+                    bslalg::ArrayPrimitives_Imp::bitwiseFillN(buffer,
+                                                              INIT,
+                                                              numBytes);
+
+                    int numErrors = 0;
+                    for (int i = 0; i < numBytes; ++i) {
+                        numErrors += buffer[i] != buffer[i % INIT];
+                    }
+                    LOOP2_ASSERT(INIT, numBytes, 0 == numErrors);
+                    LOOP2_ASSERT(INIT, numBytes, '#' == buffer[numBytes]);
+                }
+            }
+        }
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -18,6 +18,15 @@ BSLS_IDENT("$Id: $")
 // pointers, rapidly.  Note that when a pointer is passed, only the bits in the
 // pointer itself are hashed, the memory the pointer refers to is not examined.
 //
+// 'computeHash' is defined inline.  It widens its argument to 64 bits, and
+// applies a multiply-xorshift mixer in which every bit of the argument
+// affects every bit of the result, so the result uses all the bits of a
+// 64-bit 'native_std::size_t' (and is folded to 32 bits where
+// 'native_std::size_t' has 32 bits).  Since the mixer works on the value of
+// the argument rather than on its bytes, the hash of a value is the same on
+// all platforms having the same size of 'native_std::size_t', irrespective of
+// endianness, and, in particular, is stable within a process.
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -156,57 +165,58 @@ BSLS_IDENT("$Id: $")
 //      }
 //  }
 //..
-// The output produced by this usage example follows:
+// The output produced by this usage example on a platform having a 64-bit
+// 'size_t' follows:
 //..
 //  Straight hash:
-//        508,   501,   511,   502,   522,   524,   515,   500
-//        501,   519,   523,   520,   495,   514,   540,   497
-//        500,   523,   525,   518,   491,   515,   527,   509
-//        513,   500,   511,   520,   487,   515,   505,   520
-//        519,   516,   505,   534,   507,   514,   522,   517
-//        538,   514,   510,   510,   531,   491,   513,   506
-//        515,   497,   504,   496,   541,   508,   501,   523
-//        501,   523,   485,   492,   517,   510,   503,   534
+//        568,   513,   537,   516,   499,   515,   487,   506
+//        481,   503,   531,   532,   510,   496,   498,   515
+//        512,   498,   490,   547,   521,   519,   492,   500
+//        471,   538,   549,   487,   486,   522,   517,   496
+//        490,   506,   488,   513,   472,   501,   519,   540
+//        498,   532,   487,   515,   503,   510,   523,   537
+//        505,   503,   499,   543,   510,   487,   509,   532
+//        529,   498,   536,   521,   519,   508,   547,   536
 //
 //  Straight * 4 hash:
-//        513,   512,   493,   517,   514,   472,   501,   527
-//        528,   504,   527,   507,   516,   494,   534,   514
-//        517,   500,   513,   533,   507,   499,   511,   540
-//        492,   518,   530,   522,   503,   522,   505,   494
-//        520,   492,   490,   508,   538,   560,   522,   487
-//        521,   516,   493,   491,   532,   504,   497,   530
-//        495,   534,   537,   504,   487,   525,   533,   497
-//        510,   499,   511,   506,   523,   512,   498,   517
+//        541,   527,   511,   490,   497,   506,   484,   465
+//        511,   472,   487,   502,   543,   511,   508,   516
+//        544,   506,   502,   477,   538,   524,   543,   521
+//        497,   546,   534,   512,   529,   553,   511,   544
+//        542,   484,   489,   502,   479,   477,   518,   507
+//        550,   529,   500,   520,   538,   501,   484,   556
+//        472,   494,   513,   580,   543,   499,   525,   498
+//        477,   474,   537,   487,   530,   512,   490,   509
 //
 //  Folded hash:
-//        537,   493,   517,   544,   501,   508,   535,   528
-//        502,   530,   536,   541,   500,   475,   540,   510
-//        521,   513,   501,   525,   497,   511,   521,   513
-//        522,   523,   479,   479,   508,   490,   507,   523
-//        577,   490,   520,   514,   493,   465,   468,   511
-//        518,   544,   503,   484,   550,   514,   517,   500
-//        510,   501,   542,   528,   517,   456,   513,   530
-//        518,   484,   510,   506,   522,   477,   563,   493
+//        547,   506,   484,   518,   524,   468,   578,   524
+//        529,   494,   491,   520,   524,   491,   468,   543
+//        522,   497,   487,   504,   478,   521,   506,   514
+//        519,   531,   500,   491,   502,   517,   511,   504
+//        491,   485,   504,   516,   524,   515,   568,   506
+//        508,   545,   548,   513,   527,   509,   519,   503
+//        496,   474,   524,   493,   494,   538,   530,   511
+//        535,   478,   496,   513,   547,   498,   539,   508
 //
 //  Diff hash:
-//        329,   329,   526,   660,   755,   726,   466,   398
-//        235,   410,   424,   713,   695,   714,   535,   314
-//        342,   274,   598,   662,   711,   772,   498,   463
-//        268,   360,   399,   655,   672,   694,   584,   311
-//        404,   282,   601,   678,   660,   661,   418,   377
-//        245,   425,   462,   762,   682,   627,   588,   295
-//        369,   331,   529,   712,   659,   688,   418,   357
-//        238,   387,   467,   687,   730,   695,   540,   302
+//        537,   564,   506,   508,   501,   504,   525,   524
+//        546,   500,   527,   534,   492,   469,   493,   502
+//        565,   495,   506,   522,   561,   514,   518,   539
+//        511,   509,   492,   516,   525,   517,   527,   531
+//        475,   532,   494,   490,   486,   531,   511,   498
+//        516,   551,   534,   497,   495,   512,   509,   480
+//        486,   491,   504,   553,   475,   506,   516,   513
+//        485,   508,   519,   493,   513,   530,   455,   530
 //
 //  Xor diff hash:
-//        329,   142,   535,   475,   781,   800,   567,   510
-//        258,   258,   378,   549,   664,   906,   477,   496
-//        298,   118,   554,   467,   765,   883,   576,   418
-//        233,   226,   375,   608,   633,   903,   422,   388
-//        404,   133,   648,   412,   658,   896,   521,   459
-//        258,   256,   383,   601,   699,   836,   511,   599
-//        413,   169,   660,   450,   658,   826,   524,   560
-//        237,   255,   383,   573,   706,   834,   539,   715
+//        537,   558,   491,   505,   499,   527,   510,   516
+//        504,   502,   508,   535,   496,   522,   504,   477
+//        546,   493,   502,   455,   484,   532,   526,   526
+//        506,   484,   532,   507,   524,   519,   482,   526
+//        475,   519,   520,   524,   527,   528,   517,   495
+//        514,   551,   502,   503,   489,   503,   503,   525
+//        505,   479,   503,   493,   505,   507,   513,   523
+//        534,   585,   542,   518,   524,   497,   481,   529
 //..
 
 #ifndef INCLUDED_BSLSCM_VERSION
@@ -217,6 +227,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_nativestd.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -231,6 +245,14 @@ namespace bslalg {
 struct HashUtil {
     // This 'struct' provides a namespace for hash functions.
 
+  private:
+    // PRIVATE CLASS METHODS
+    static native_std::size_t mix(bsls::Types::Uint64 key);
+        // Return a hash value for the specified 'key' computed by a
+        // multiply-xorshift mixer, folded to the width of 'native_std::size_t'
+        // if that type has fewer than 64 bits.
+
+  public:
     // CLASS METHODS
     static native_std::size_t computeHash(char key);
     static native_std::size_t computeHash(signed char key);
@@ -247,20 +269,143 @@ struct HashUtil {
     static native_std::size_t computeHash(double key);
     static native_std::size_t computeHash(const void *key);
         // Return a 'size_t' hash value corresponding to the specified 'key'.
-        // Note that the return value is seemingly random (i.e., the hash is
-        // good) but identical on all platforms (irrespective of endianness).
+        // Integral keys having the same value hash to the same value
+        // irrespective of their type, and floating-point keys comparing equal
+        // (e.g., '0.0' and '-0.0') hash to the same value.  Note that the
+        // return value is seemingly random (i.e., the hash is good) but
+        // identical on all platforms having the same size of
+        // 'native_std::size_t' (irrespective of endianness).
         //
         // NOTE: We reserve the right to change these hash functions to return
-        // different values.  The current implementation only returns a 32 bit
-        // value -- when 'native_std::size_t' is 64 bits, the high-order 32
-        // bits of the return value are all zero.  This is not a feature, it is
-        // a bug that we will fix in a later release.
+        // different values.
 };
 
 // ===========================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ===========================================================================
 
+                        // ---------------
+                        // struct HashUtil
+                        // ---------------
+
+// PRIVATE CLASS METHODS
+inline
+native_std::size_t HashUtil::mix(bsls::Types::Uint64 key)
+{
+    // This is the 'Mix13' variant, found by David Stafford, of the 64-bit
+    // finalizer of MurmurHash3, which is also the output function of
+    // SplitMix64.  It is a bijection on 64-bit values.
+
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+
+#ifdef BSLS_PLATFORM_CPU_64_BIT
+    return static_cast<native_std::size_t>(key);
+#else
+    return static_cast<native_std::size_t>(key ^ (key >> 32));
+#endif
+}
+
+// CLASS METHODS
+inline
+native_std::size_t HashUtil::computeHash(char key)
+{
+    return mix(static_cast<bsls::Types::Uint64>(key));
+}
+
+inline
+native_std::size_t HashUtil::computeHash(signed char key)
+{
+    return mix(static_cast<bsls::Types::Uint64>(key));
+}
+
+inline
+native_std::size_t HashUtil::computeHash(unsigned char key)
+{
+    return mix(key);
+}
+
+inline
+native_std::size_t HashUtil::computeHash(short key)
+{
+    return mix(static_cast<bsls::Types::Uint64>(key));
+}
+
+inline
+native_std::size_t HashUtil::computeHash(unsigned short key)
+{
+    return mix(key);
+}
+
+inline
+native_std::size_t HashUtil::computeHash(int key)
+{
+    return mix(static_cast<bsls::Types::Uint64>(key));
+}
+
+inline
+native_std::size_t HashUtil::computeHash(unsigned int key)
+{
+    return mix(key);
+}
+
+inline
+native_std::size_t HashUtil::computeHash(long key)
+{
+    return mix(static_cast<bsls::Types::Uint64>(key));
+}
+
+inline
+native_std::size_t HashUtil::computeHash(unsigned long key)
+{
+    return mix(key);
+}
+
+inline
+native_std::size_t HashUtil::computeHash(long long key)
+{
+    return mix(static_cast<bsls::Types::Uint64>(key));
+}
+
+inline
+native_std::size_t HashUtil::computeHash(unsigned long long key)
+{
+    return mix(key);
+}
+
+inline
+native_std::size_t HashUtil::computeHash(float key)
+{
+    union {
+        float        d_value;
+        unsigned int d_bits;
+    } u;
+    u.d_value = 0 == key ? 0.0f : key;  // '-0.0f' has other bits than '0.0f'
+
+    return mix(u.d_bits);
+}
+
+inline
+native_std::size_t HashUtil::computeHash(double key)
+{
+    union {
+        double              d_value;
+        bsls::Types::Uint64 d_bits;
+    } u;
+    u.d_value = 0 == key ? 0.0 : key;   // '-0.0' has other bits than '0.0'
+
+    return mix(u.d_bits);
+}
+
+inline
+native_std::size_t HashUtil::computeHash(const void *key)
+{
+    return mix(reinterpret_cast<bsls::Types::UintPtr>(key));
+}
+
 }  // close namespace BloombergLP::bslalg
 }  // close namespace BloombergLP
 
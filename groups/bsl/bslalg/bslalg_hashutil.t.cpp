@@ -299,12 +299,27 @@ int main(int argc, char *argv[])
         // TESTING HASHING FUNDAMENTAL TYPES
         //
         // Concerns:
-        //   The hash should output a reasonable value, which does not depend
-        //   on the endianness of the platform.
+        //: 1 The hash should output a reasonable value, which does not depend
+        //:   on the endianness of the platform.
+        //:
+        //: 2 On platforms having a 64-bit 'size_t', the hash sets the
+        //:   high-order 32 bits of the result.
+        //:
+        //: 3 Integral keys having the same value hash to the same value
+        //:   irrespective of their type, including negative values.
+        //:
+        //: 4 Floating-point keys that compare equal (i.e., '0.0' and '-0.0')
+        //:   hash to the same value.
         //
         // Plan:
-        //   Compare return value to expected values computed on a given
-        //   platform.
+        //: 1 Compare return value to expected values computed, for each size
+        //:   of 'size_t', from the specification of the mixer.  (C-1..2)
+        //:
+        //: 2 Hash '-1' as each signed integral type, and compare the results.
+        //:   (C-3)
+        //:
+        //: 3 Hash '0.0' and '-0.0' as 'float' and 'double', and compare the
+        //:   results.  (C-4)
         //
         // Testing:
         //    HashUtil::computeHash(char);
@@ -326,29 +341,60 @@ int main(int argc, char *argv[])
         if (verbose) printf("\nHASHING FUNDAMENTAL TYPES"
                             "\n=========================\n");
 
-        ASSERT(3392050242U == HashUtil::computeHash((char)'a'));
-        ASSERT(3392050242U == HashUtil::computeHash((signed char)'a'));
-        ASSERT(3392050242U == HashUtil::computeHash((unsigned char)'a'));
-        ASSERT(3111500981U == HashUtil::computeHash((short)12355));
-        ASSERT(3111500981U == HashUtil::computeHash((unsigned short)12355));
-        ASSERT(2509914878U == HashUtil::computeHash((int)0x12345678));
-        ASSERT(2509914878U == HashUtil::computeHash((unsigned int)0x12345678));
-        ASSERT(2509914878U == HashUtil::computeHash((long)0x12345678));
-        ASSERT(2509914878U ==
-                             HashUtil::computeHash((unsigned long)0x12345678));
-        ASSERT(2509914878U ==
-                   HashUtil::computeHash((long long)0x12345678));
-        ASSERT(2509914878U ==
-                  HashUtil::computeHash((unsigned long long)0x12345678));
-        ASSERT(2343743579U == HashUtil::computeHash((float)3.1415926536));
-        ASSERT(3721749206U ==
-                        HashUtil::computeHash((double)3.14159265358979323844));
+        typedef native_std::size_t size_t;
+
 #ifdef BSLS_PLATFORM_CPU_64_BIT
-        ASSERT(2631003531U ==
-                           HashUtil::computeHash((void*)0xffab13f1324e5473LL));
+        const size_t CHAR_HASH   = 0xaeff7d4b5b72ec99ULL;
+        const size_t SHORT_HASH  = 0x08e64a265b7de620ULL;
+        const size_t INT_HASH    = 0x99a584650fae6a61ULL;
+        const size_t FLOAT_HASH  = 0x97c5bf6183fe3167ULL;
+        const size_t DOUBLE_HASH = 0x8adacf46b9fc1df0ULL;
+        const size_t PTR_HASH    = 0x27c0b1402d07f255ULL;
+        const void  *PTR         = (void *) 0xffab13f1324e5473ULL;
 #else
-        ASSERT(1747622670U == HashUtil::computeHash((void*)0xffab13f1));
+        const size_t CHAR_HASH   = 4119695826U;
+        const size_t SHORT_HASH  = 1402711046U;
+        const size_t INT_HASH    = 2517364228U;
+        const size_t FLOAT_HASH  =  339447302U;
+        const size_t DOUBLE_HASH =  858182326U;
+        const size_t PTR_HASH    = 3429519416U;
+        const void  *PTR         = (void *) 0xffab13f1;
 #endif
+
+        if (verbose) printf("Expected values\n");
+
+        ASSERT(CHAR_HASH   == HashUtil::computeHash((char)'a'));
+        ASSERT(CHAR_HASH   == HashUtil::computeHash((signed char)'a'));
+        ASSERT(CHAR_HASH   == HashUtil::computeHash((unsigned char)'a'));
+        ASSERT(SHORT_HASH  == HashUtil::computeHash((short)12355));
+        ASSERT(SHORT_HASH  == HashUtil::computeHash((unsigned short)12355));
+        ASSERT(INT_HASH    == HashUtil::computeHash((int)0x12345678));
+        ASSERT(INT_HASH    == HashUtil::computeHash((unsigned int)0x12345678));
+        ASSERT(INT_HASH    == HashUtil::computeHash((long)0x12345678));
+        ASSERT(INT_HASH    ==
+                             HashUtil::computeHash((unsigned long)0x12345678));
+        ASSERT(INT_HASH    == HashUtil::computeHash((long long)0x12345678));
+        ASSERT(INT_HASH    ==
+                        HashUtil::computeHash((unsigned long long)0x12345678));
+        ASSERT(FLOAT_HASH  == HashUtil::computeHash((float)3.1415926536));
+        ASSERT(DOUBLE_HASH ==
+                        HashUtil::computeHash((double)3.14159265358979323844));
+        ASSERT(PTR_HASH    == HashUtil::computeHash(PTR));
+
+        if (verbose) printf("Negative values\n");
+
+        const size_t NEG_HASH = HashUtil::computeHash((long long)-1);
+
+        ASSERT(NEG_HASH == HashUtil::computeHash((signed char)-1));
+        ASSERT(NEG_HASH == HashUtil::computeHash((short)-1));
+        ASSERT(NEG_HASH == HashUtil::computeHash((int)-1));
+        ASSERT(NEG_HASH == HashUtil::computeHash((long)-1));
+        ASSERT(NEG_HASH == HashUtil::computeHash((unsigned long long)-1));
+
+        if (verbose) printf("Signed zeros\n");
+
+        ASSERT(HashUtil::computeHash(0.0f) == HashUtil::computeHash(-0.0f));
+        ASSERT(HashUtil::computeHash(0.0)  == HashUtil::computeHash(-0.0));
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -362,10 +408,8 @@ int main(int argc, char *argv[])
         // Plan:
         //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
         //:   Verify that small changes to the input value result in many
-        //:   bits being toggled in the output.  Note that the hash function
-        //:   currently only sets the low-order 32 bits of the result.  When
-        //:   this is fixed the asserts should be changed to demand that at
-        //:   least a quarter of the bits in a 'size_t' have chagned.
+        //:   bits being toggled in the output: at least a quarter of the
+        //:   bits of a 'size_t'.
         //
         // Testing:
         //   BREATHING TEST
@@ -381,8 +425,7 @@ int main(int argc, char *argv[])
             native_std::size_t hash = HashUtil::computeHash(i);
             unsigned changed = countBits(hash ^ lastHash);
             ASSERTV(i, changed, hash, lastHash,
-                                           changed > sizeof(unsigned) * 8 / 4);
-            ASSERT(changed > sizeof(unsigned) * 8 / 4);
+                                 changed > sizeof(native_std::size_t) * 8 / 4);
             if (verbose) printf(
                          "%2d: %8x, hash: %8x, lastHash: %8x, changed: %d\n",
                   i, i, (unsigned) hash, (unsigned) lastHash, changed);
@@ -397,7 +440,7 @@ int main(int argc, char *argv[])
             valueToHash = (long long) 1 << i;
             native_std::size_t hash = HashUtil::computeHash(valueToHash);
             unsigned changed = countBits(hash ^ lastHash);
-            ASSERT(changed > sizeof(unsigned) * 8 / 4);
+            ASSERT(changed > sizeof(native_std::size_t) * 8 / 4);
             if (verbose) printf(
                         "%2d: %16llx, hash: %8x, lastHash: %8x, changed: %d\n",
                 i, valueToHash, (unsigned) hash, (unsigned) lastHash, changed);
@@ -413,7 +456,7 @@ int main(int argc, char *argv[])
             native_std::size_t hash = HashUtil::computeHash(
                                                            (long long) 1 << i);
             unsigned changed = countBits(hash ^ lastHash);
-            ASSERT(changed > sizeof(unsigned) * 8 / 4);
+            ASSERT(changed > sizeof(native_std::size_t) * 8 / 4);
             if (verbose) printf(
                         "%2d: %16llx, hash: %8x, lastHash: %8x, changed: %d\n",
                 i, valueToHash, (unsigned) hash, (unsigned) lastHash, changed);
@@ -428,7 +471,7 @@ int main(int argc, char *argv[])
             native_std::size_t hash = HashUtil::computeHash(
                                                            (long long) 1 << i);
             unsigned changed = countBits(hash ^ lastHash);
-            ASSERT(changed > sizeof(unsigned) * 8 / 4);
+            ASSERT(changed > sizeof(native_std::size_t) * 8 / 4);
             if (verbose) printf(
                         "%2d: %16llx, hash: %8x, lastHash: %8x, changed: %d\n",
                 i, valueToHash, (unsigned) hash, (unsigned) lastHash, changed);
@@ -0,0 +1,905 @@
+// bslalg_parallelarrayprimitives.h                                   -*-C++-*-
+#ifndef INCLUDED_BSLALG_PARALLELARRAYPRIMITIVES
+#define INCLUDED_BSLALG_PARALLELARRAYPRIMITIVES
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide array construction and destruction split across threads.
+//
+//@CLASSES:
+//  bslalg::ParallelArrayPrimitives: namespace for parallel array algorithms
+//
+//@SEE_ALSO: bslalg_arrayprimitives, bslalg_arraydestructionprimitives,
+//           bsls_parallelutil
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'bslalg::ParallelArrayPrimitives', for overloads of the fill, default
+// construction, copy construction, and destruction primitives of
+// 'bslalg::ArrayPrimitives' and 'bslalg::ArrayDestructionPrimitives' that take
+// a 'bsls::ParallelPolicy'.  The policy splits a large range into chunks that
+// are run on several threads, each chunk by the corresponding serial
+// primitive; a range too small for the policy to split is processed on the
+// calling thread, exactly as by the serial primitive.  Using a policy is
+// strictly opt-in: no other primitive, and no container that is not passed a
+// policy, ever creates a thread.
+//
+///Exception Safety
+///----------------
+// Each chunk is constructed by the serial primitive, which destroys the
+// elements of its chunk that were constructed before an exception is thrown.
+// An exception cannot leave the thread on which it was thrown, so the first
+// exception thrown by a chunk is recorded, and the other chunks run to
+// completion (or to their own exceptions, which are discarded).  Once all
+// chunks are done, if any chunk failed, the elements of the chunks that
+// succeeded are destroyed, and the recorded exception is thrown on the calling
+// thread, so that the array is left uninitialized as by the serial primitive.
+// No element is constructed more than once.
+//
+// Where the native library provides 'std::exception_ptr' (C++11), the
+// recorded exception is rethrown unchanged, and the macro
+// 'BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS' is defined.
+// Otherwise, an exception cannot be copied to another thread without knowing
+// its type: a 'std::bad_alloc' is reported by throwing a 'std::bad_alloc', and
+// any other exception by throwing a 'std::bad_exception' (the type that the
+// standard uses for an exception that cannot be propagated).  In either case,
+// a range that is not split is processed on the calling thread, and its
+// exceptions propagate unchanged.
+//
+///Thread Safety
+///-------------
+// The constructors and destructors of the elements, and the allocator passed
+// to the elements (if any), are called concurrently from several threads.  It
+// is therefore required that they be safe to call concurrently on distinct
+// objects, and that the allocator be fully thread-safe, when a policy allows
+// more than one thread.  All allocators provided by 'bslma' are.  The value
+// copied by a fill, and the range copied by a copy construction, are accessed
+// concurrently but only through 'const' references.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.  Note that this
+// component is for use by the 'bslstl' package.  Other clients should use the
+// containers that accept a 'bsls::ParallelPolicy', such as 'bsl::vector'.
+//
+///Example 1: Fill and Destroy a Large Array of Objects
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we construct many copies of a type that has a non-trivial
+// copy constructor, splitting the work across up to four threads.
+//
+// First, we define a simple type that counts its live objects:
+//..
+//  class Counted {
+//      // This class holds an 'int' value and counts its live objects.
+//
+//      // DATA
+//      int d_value;
+//
+//    public:
+//      // CLASS DATA
+//      static bsls::AtomicInt s_numLive;   // number of live objects
+//
+//      // CREATORS
+//      explicit Counted(int value)
+//      : d_value(value)
+//      {
+//          s_numLive.add(1);
+//      }
+//
+//      Counted(const Counted& original)
+//      : d_value(original.d_value)
+//      {
+//          s_numLive.add(1);
+//      }
+//
+//      ~Counted()
+//      {
+//          s_numLive.add(-1);
+//      }
+//
+//      // ACCESSORS
+//      int value() const
+//      {
+//          return d_value;
+//      }
+//  };
+//
+//  bsls::AtomicInt Counted::s_numLive(0);
+//..
+// Then, we obtain uninitialized storage for the array:
+//..
+//  enum { k_NUM_ELEMENTS = 10000 };
+//
+//  bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//  Counted *array = static_cast<Counted *>(
+//                     allocator->allocate(k_NUM_ELEMENTS * sizeof(Counted)));
+//..
+// Next, we create a policy that uses up to four threads, and chunks of at
+// least 1000 elements:
+//..
+//  const bsls::ParallelPolicy policy(4, 1000);
+//..
+// Now, we fill the array with copies of a value:
+//..
+//  bslalg::ParallelArrayPrimitives::uninitializedFillN(array,
+//                                                      k_NUM_ELEMENTS,
+//                                                      Counted(7),
+//                                                      allocator,
+//                                                      policy);
+//
+//  assert(k_NUM_ELEMENTS == Counted::s_numLive);
+//  assert(7 == array[0].value());
+//  assert(7 == array[k_NUM_ELEMENTS - 1].value());
+//..
+// Finally, we destroy the elements, again in parallel, and release the
+// storage:
+//..
+//  bslalg::ParallelArrayPrimitives::destroy(array,
+//                                           array + k_NUM_ELEMENTS,
+//                                           policy);
+//  assert(0 == Counted::s_numLive);
+//
+//  allocator->deallocate(array);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLEXCEPTIONUTIL
+#include <bsls_bslexceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PARALLELUTIL
+#include <bsls_parallelutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // size_t
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>  // 'bad_alloc'
+#define INCLUDED_NEW
+#endif
+
+#if defined(BDE_BUILD_TARGET_EXC)                                             \
+ && ((defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VER_MAJOR >= 1600) \
+  || (defined(BSLS_PLATFORM_CMP_GNU)  && defined(__GXX_EXPERIMENTAL_CXX0X__)) \
+  || __cplusplus >= 201103L)
+    // The native library provides 'std::exception_ptr'.
+
+#define BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS 1
+
+#ifndef INCLUDED_EXCEPTION
+#include <exception>  // 'exception_ptr'
+#define INCLUDED_EXCEPTION
+#endif
+
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                       // ==============================
+                       // struct ParallelArrayPrimitives
+                       // ==============================
+
+struct ParallelArrayPrimitives {
+    // This 'struct' provides a namespace for a suite of utility functions that
+    // construct and destroy arrays of elements of the parameterized type
+    // 'TARGET_TYPE', splitting large arrays across threads as allowed by a
+    // 'bsls::ParallelPolicy'.  Each function has the contract of the
+    // corresponding function of 'ArrayPrimitives' or
+    // 'ArrayDestructionPrimitives', with the additional requirements described
+    // in the "Thread Safety" section of the component-level documentation.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class TARGET_TYPE>
+    static void destroy(TARGET_TYPE                 *begin,
+                        TARGET_TYPE                 *end,
+                        const bsls::ParallelPolicy&  policy,
+                        bsl::true_type);
+    template <class TARGET_TYPE>
+    static void destroy(TARGET_TYPE                 *begin,
+                        TARGET_TYPE                 *end,
+                        const bsls::ParallelPolicy&  policy,
+                        bsl::false_type);
+        // Destroy the elements in the array beginning at the specified 'begin'
+        // address and ending immediately before the specified 'end' address,
+        // using the specified 'policy'.  The last argument is used to
+        // dispatch on whether 'TARGET_TYPE' is bitwise copyable, in which case
+        // there is nothing worth splitting.
+
+    template <class OPERATION>
+    static void runConstruction(const OPERATION&            operation,
+                                std::size_t                 numElements,
+                                const bsls::ParallelPolicy& policy);
+        // Construct the specified 'numElements' elements of the array of the
+        // specified 'operation' using the specified 'policy', by applying
+        // 'operation' to each chunk, and, if any chunk fails, destroying the
+        // other chunks and throwing the first exception recorded (see
+        // "Exception Safety" in the component-level documentation).
+
+  public:
+    // TYPES
+    typedef ArrayPrimitives::size_type size_type;
+
+    // CLASS METHODS
+    template <class TARGET_TYPE, class ALLOCATOR>
+    static void defaultConstruct(TARGET_TYPE                 *begin,
+                                 size_type                    numElements,
+                                 ALLOCATOR                   *allocator,
+                                 const bsls::ParallelPolicy&  policy);
+        // Value-initialize the specified 'numElements' elements of the
+        // uninitialized array starting at the specified 'begin' address, as
+        // if by 'ArrayPrimitives::defaultConstruct' with the specified
+        // 'allocator', splitting the work as allowed by the specified
+        // 'policy'.  If an exception is thrown, the array is left
+        // uninitialized.
+
+    template <class TARGET_TYPE, class ALLOCATOR>
+    static void uninitializedFillN(TARGET_TYPE                 *begin,
+                                   size_type                    numElements,
+                                   const TARGET_TYPE&           value,
+                                   ALLOCATOR                   *allocator,
+                                   const bsls::ParallelPolicy&  policy);
+        // Construct copies of the specified 'value' into the specified
+        // 'numElements' elements of the uninitialized array starting at the
+        // specified 'begin' address, as if by
+        // 'ArrayPrimitives::uninitializedFillN' with the specified
+        // 'allocator', splitting the work as allowed by the specified
+        // 'policy'.  If an exception is thrown, the array is left
+        // uninitialized.  The behavior is undefined unless 'value' is not an
+        // element of the array.
+
+    template <class TARGET_TYPE, class ALLOCATOR>
+    static void copyConstruct(TARGET_TYPE                 *toBegin,
+                              const TARGET_TYPE           *fromBegin,
+                              const TARGET_TYPE           *fromEnd,
+                              ALLOCATOR                   *allocator,
+                              const bsls::ParallelPolicy&  policy);
+        // Copy the elements of the array starting at the specified
+        // 'fromBegin' address and ending immediately before the specified
+        // 'fromEnd' address into the uninitialized array starting at the
+        // specified 'toBegin' address, as if by
+        // 'ArrayPrimitives::copyConstruct' with the specified 'allocator',
+        // splitting the work as allowed by the specified 'policy'.  If an
+        // exception is thrown, the target array is left uninitialized.  The
+        // behavior is undefined unless the target and source arrays do not
+        // overlap.
+
+    template <class TARGET_TYPE>
+    static void destroy(TARGET_TYPE                 *begin,
+                        TARGET_TYPE                 *end,
+                        const bsls::ParallelPolicy&  policy);
+        // Destroy the elements of the array beginning at the specified 'begin'
+        // address and ending immediately before the specified 'end' address,
+        // as if by 'ArrayDestructionPrimitives::destroy', splitting the work
+        // as allowed by the specified 'policy'.  The behavior is undefined
+        // unless either (1) 'begin <= end', 'begin != 0', and 'end != 0', or
+        // (2) 'begin == 0 && end == 0'.  Note that the destructors of
+        // bitwise-copyable types are not called, so the work on such types is
+        // never split.
+};
+
+                    // ==========================================
+                    // class ParallelArrayPrimitives_FillN<T, A>
+                    // ==========================================
+
+template <class TARGET_TYPE, class ALLOCATOR>
+class ParallelArrayPrimitives_FillN {
+    // This component-private class fills a chunk of an array with copies of a
+    // value.
+
+    // DATA
+    TARGET_TYPE       *d_begin_p;      // start of the whole array
+    const TARGET_TYPE *d_value_p;      // value to copy
+    ALLOCATOR         *d_allocator_p;  // allocator for the elements
+
+  public:
+    // CREATORS
+    ParallelArrayPrimitives_FillN(TARGET_TYPE        *begin,
+                                  const TARGET_TYPE&  value,
+                                  ALLOCATOR          *allocator);
+        // Create an operation that fills the array starting at the specified
+        // 'begin' address with copies of the specified 'value' using the
+        // specified 'allocator'.
+
+    // ACCESSORS
+    void operator()(std::size_t first, std::size_t last) const;
+        // Fill the elements of the array having indices in the range
+        // '[first, last)'.
+
+    TARGET_TYPE *target() const;
+        // Return the address of the start of the array.
+};
+
+              // =====================================================
+              // class ParallelArrayPrimitives_DefaultConstruct<T, A>
+              // =====================================================
+
+template <class TARGET_TYPE, class ALLOCATOR>
+class ParallelArrayPrimitives_DefaultConstruct {
+    // This component-private class value-initializes a chunk of an array.
+
+    // DATA
+    TARGET_TYPE *d_begin_p;      // start of the whole array
+    ALLOCATOR   *d_allocator_p;  // allocator for the elements
+
+  public:
+    // CREATORS
+    ParallelArrayPrimitives_DefaultConstruct(TARGET_TYPE *begin,
+                                             ALLOCATOR   *allocator);
+        // Create an operation that value-initializes the array starting at
+        // the specified 'begin' address using the specified 'allocator'.
+
+    // ACCESSORS
+    void operator()(std::size_t first, std::size_t last) const;
+        // Value-initialize the elements of the array having indices in the
+        // range '[first, last)'.
+
+    TARGET_TYPE *target() const;
+        // Return the address of the start of the array.
+};
+
+               // =================================================
+               // class ParallelArrayPrimitives_CopyConstruct<T, A>
+               // =================================================
+
+template <class TARGET_TYPE, class ALLOCATOR>
+class ParallelArrayPrimitives_CopyConstruct {
+    // This component-private class copies a chunk of an array into the
+    // corresponding chunk of another, uninitialized, array.
+
+    // DATA
+    TARGET_TYPE       *d_toBegin_p;    // start of the whole target array
+    const TARGET_TYPE *d_fromBegin_p;  // start of the whole source array
+    ALLOCATOR         *d_allocator_p;  // allocator for the elements
+
+  public:
+    // CREATORS
+    ParallelArrayPrimitives_CopyConstruct(TARGET_TYPE       *toBegin,
+                                          const TARGET_TYPE *fromBegin,
+                                          ALLOCATOR         *allocator);
+        // Create an operation that copies the array starting at the specified
+        // 'fromBegin' address into the array starting at the specified
+        // 'toBegin' address using the specified 'allocator'.
+
+    // ACCESSORS
+    void operator()(std::size_t first, std::size_t last) const;
+        // Copy the elements of the source array having indices in the range
+        // '[first, last)' into the target array.
+
+    TARGET_TYPE *target() const;
+        // Return the address of the start of the target array.
+};
+
+                    // ========================================
+                    // class ParallelArrayPrimitives_Destroy<T>
+                    // ========================================
+
+template <class TARGET_TYPE>
+class ParallelArrayPrimitives_Destroy {
+    // This component-private class destroys a chunk of an array.
+
+    // DATA
+    TARGET_TYPE *d_begin_p;  // start of the whole array
+
+  public:
+    // CREATORS
+    explicit ParallelArrayPrimitives_Destroy(TARGET_TYPE *begin);
+        // Create an operation that destroys elements of the array starting at
+        // the specified 'begin' address.
+
+    // ACCESSORS
+    void operator()(std::size_t first, std::size_t last) const;
+        // Destroy the elements of the array having indices in the range
+        // '[first, last)'.
+};
+
+                    // ========================================
+                    // struct ParallelArrayPrimitives_Job<OP>
+                    // ========================================
+
+template <class OPERATION>
+struct ParallelArrayPrimitives_Job {
+    // This component-private 'struct' holds the state shared by the chunks of
+    // an operation on an array, and provides the task function run for each
+    // chunk.
+
+    // DATA
+    const OPERATION *d_operation_p;  // operation applied to each chunk
+    std::size_t      d_numElements;  // number of elements in the array
+    int              d_numChunks;    // number of chunks
+    bool             d_failed[bsls::ParallelPolicy::BSLS_MAX_CHUNKS];
+                                     // whether each chunk threw
+
+    bsls::AtomicInt  d_hasFailure;   // 1 once the first exception thrown by
+                                     // a chunk is being recorded, and 0
+                                     // before
+
+#ifdef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+    native_std::exception_ptr
+                     d_failure;      // first exception thrown by a chunk
+#else
+    bool             d_isBadAlloc;   // whether the first exception thrown
+                                     // by a chunk is a 'std::bad_alloc'
+#endif
+
+    // CREATORS
+    ParallelArrayPrimitives_Job();
+        // Create a job that has recorded no failure.  Its other fields must
+        // be set before it is run.
+
+    // CLASS METHODS
+    static void runChunk(void *job, int chunkIndex);
+        // Apply the operation of the 'ParallelArrayPrimitives_Job' at the
+        // specified 'job' address to the chunk having the specified
+        // 'chunkIndex', recording whether it threw an exception, and, if it
+        // is the first chunk to throw, the exception.
+
+    // ACCESSORS
+    std::size_t chunkBegin(int chunkIndex) const;
+        // Return the index of the first element of the chunk having the
+        // specified 'chunkIndex'.
+
+    void throwFailure() const;
+        // Throw the exception recorded by 'runChunk' (see "Exception Safety"
+        // in the component-level documentation).  The behavior is undefined
+        // unless a chunk failed.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                    // ------------------------------------------
+                    // class ParallelArrayPrimitives_FillN<T, A>
+                    // ------------------------------------------
+
+// CREATORS
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+ParallelArrayPrimitives_FillN<TARGET_TYPE, ALLOCATOR>::
+ParallelArrayPrimitives_FillN(TARGET_TYPE        *begin,
+                              const TARGET_TYPE&  value,
+                              ALLOCATOR          *allocator)
+: d_begin_p(begin)
+, d_value_p(&value)
+, d_allocator_p(allocator)
+{
+}
+
+// ACCESSORS
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+void ParallelArrayPrimitives_FillN<TARGET_TYPE, ALLOCATOR>::operator()(
+                                                       std::size_t first,
+                                                       std::size_t last) const
+{
+    ArrayPrimitives::uninitializedFillN(d_begin_p + first,
+                                        last - first,
+                                        *d_value_p,
+                                        d_allocator_p);
+}
+
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+TARGET_TYPE *
+ParallelArrayPrimitives_FillN<TARGET_TYPE, ALLOCATOR>::target() const
+{
+    return d_begin_p;
+}
+
+              // -----------------------------------------------------
+              // class ParallelArrayPrimitives_DefaultConstruct<T, A>
+              // -----------------------------------------------------
+
+// CREATORS
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+ParallelArrayPrimitives_DefaultConstruct<TARGET_TYPE, ALLOCATOR>::
+ParallelArrayPrimitives_DefaultConstruct(TARGET_TYPE *begin,
+                                         ALLOCATOR   *allocator)
+: d_begin_p(begin)
+, d_allocator_p(allocator)
+{
+}
+
+// ACCESSORS
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+void
+ParallelArrayPrimitives_DefaultConstruct<TARGET_TYPE, ALLOCATOR>::operator()(
+                                                       std::size_t first,
+                                                       std::size_t last) const
+{
+    ArrayPrimitives::defaultConstruct(d_begin_p + first,
+                                      last - first,
+                                      d_allocator_p);
+}
+
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+TARGET_TYPE *
+ParallelArrayPrimitives_DefaultConstruct<TARGET_TYPE, ALLOCATOR>::target()
+                                                                         const
+{
+    return d_begin_p;
+}
+
+               // -------------------------------------------------
+               // class ParallelArrayPrimitives_CopyConstruct<T, A>
+               // -------------------------------------------------
+
+// CREATORS
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+ParallelArrayPrimitives_CopyConstruct<TARGET_TYPE, ALLOCATOR>::
+ParallelArrayPrimitives_CopyConstruct(TARGET_TYPE       *toBegin,
+                                      const TARGET_TYPE *fromBegin,
+                                      ALLOCATOR         *allocator)
+: d_toBegin_p(toBegin)
+, d_fromBegin_p(fromBegin)
+, d_allocator_p(allocator)
+{
+}
+
+// ACCESSORS
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+void
+ParallelArrayPrimitives_CopyConstruct<TARGET_TYPE, ALLOCATOR>::operator()(
+                                                       std::size_t first,
+                                                       std::size_t last) const
+{
+    ArrayPrimitives::copyConstruct(d_toBegin_p + first,
+                                   d_fromBegin_p + first,
+                                   d_fromBegin_p + last,
+                                   d_allocator_p);
+}
+
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+TARGET_TYPE *
+ParallelArrayPrimitives_CopyConstruct<TARGET_TYPE, ALLOCATOR>::target() const
+{
+    return d_toBegin_p;
+}
+
+                    // ----------------------------------------
+                    // class ParallelArrayPrimitives_Destroy<T>
+                    // ----------------------------------------
+
+// CREATORS
+template <class TARGET_TYPE>
+inline
+ParallelArrayPrimitives_Destroy<TARGET_TYPE>::ParallelArrayPrimitives_Destroy(
+                                                            TARGET_TYPE *begin)
+: d_begin_p(begin)
+{
+}
+
+// ACCESSORS
+template <class TARGET_TYPE>
+inline
+void ParallelArrayPrimitives_Destroy<TARGET_TYPE>::operator()(
+                                                       std::size_t first,
+                                                       std::size_t last) const
+{
+    ArrayDestructionPrimitives::destroy(d_begin_p + first, d_begin_p + last);
+}
+
+                    // ----------------------------------------
+                    // struct ParallelArrayPrimitives_Job<OP>
+                    // ----------------------------------------
+
+// CREATORS
+template <class OPERATION>
+inline
+ParallelArrayPrimitives_Job<OPERATION>::ParallelArrayPrimitives_Job()
+: d_operation_p(0)
+, d_numElements(0)
+, d_numChunks(0)
+, d_hasFailure(0)
+#ifndef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+, d_isBadAlloc(false)
+#endif
+{
+}
+
+// CLASS METHODS
+template <class OPERATION>
+void ParallelArrayPrimitives_Job<OPERATION>::runChunk(void *job,
+                                                      int   chunkIndex)
+{
+    ParallelArrayPrimitives_Job& self =
+                              *static_cast<ParallelArrayPrimitives_Job *>(job);
+
+    // Only the first chunk to throw writes the recorded exception; the
+    // calling thread reads it once 'bsls::ParallelUtil::run' has joined every
+    // thread.
+
+    self.d_failed[chunkIndex] = false;
+    BSLS_TRY {
+        (*self.d_operation_p)(self.chunkBegin(chunkIndex),
+                              self.chunkBegin(chunkIndex + 1));
+    }
+#ifdef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+    BSLS_CATCH(...) {
+        self.d_failed[chunkIndex] = true;
+        if (0 == self.d_hasFailure.testAndSwap(0, 1)) {
+            self.d_failure = native_std::current_exception();
+        }
+    }
+#else
+    BSLS_CATCH(const native_std::bad_alloc&) {
+        self.d_failed[chunkIndex] = true;
+        if (0 == self.d_hasFailure.testAndSwap(0, 1)) {
+            self.d_isBadAlloc = true;
+        }
+    }
+    BSLS_CATCH(...) {
+        self.d_failed[chunkIndex] = true;
+        self.d_hasFailure.testAndSwap(0, 1);
+    }
+#endif
+}
+
+// ACCESSORS
+template <class OPERATION>
+inline
+std::size_t
+ParallelArrayPrimitives_Job<OPERATION>::chunkBegin(int chunkIndex) const
+{
+    return bsls::ParallelUtil::chunkBegin(d_numElements,
+                                          d_numChunks,
+                                          chunkIndex);
+}
+
+template <class OPERATION>
+void ParallelArrayPrimitives_Job<OPERATION>::throwFailure() const
+{
+#ifdef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+    native_std::rethrow_exception(d_failure);
+#else
+    if (d_isBadAlloc) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+    bsls::BslExceptionUtil::throwBadException();
+#endif
+}
+
+                       // ------------------------------
+                       // struct ParallelArrayPrimitives
+                       // ------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TARGET_TYPE>
+inline
+void ParallelArrayPrimitives::destroy(TARGET_TYPE                 *begin,
+                                      TARGET_TYPE                 *end,
+                                      const bsls::ParallelPolicy&  ,
+                                      bsl::true_type)
+{
+    ArrayDestructionPrimitives::destroy(begin, end);
+}
+
+template <class TARGET_TYPE>
+void ParallelArrayPrimitives::destroy(TARGET_TYPE                 *begin,
+                                      TARGET_TYPE                 *end,
+                                      const bsls::ParallelPolicy&  policy,
+                                      bsl::false_type)
+{
+    const std::size_t numElements = end - begin;
+    const int         numChunks   = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        ArrayDestructionPrimitives::destroy(begin, end);
+        return;                                                       // RETURN
+    }
+
+    typedef ParallelArrayPrimitives_Destroy<TARGET_TYPE> Operation;
+
+    const Operation                        operation(begin);
+    ParallelArrayPrimitives_Job<Operation> job;
+    job.d_operation_p = &operation;
+    job.d_numElements = numElements;
+    job.d_numChunks   = numChunks;
+
+    bsls::ParallelUtil::run(&ParallelArrayPrimitives_Job<Operation>::runChunk,
+                            &job,
+                            numChunks,
+                            policy.numThreads());
+}
+
+template <class OPERATION>
+void ParallelArrayPrimitives::runConstruction(
+                                      const OPERATION&            operation,
+                                      std::size_t                 numElements,
+                                      const bsls::ParallelPolicy& policy)
+{
+    const int numChunks = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        operation(0, numElements);
+        return;                                                       // RETURN
+    }
+
+    ParallelArrayPrimitives_Job<OPERATION> job;
+    job.d_operation_p = &operation;
+    job.d_numElements = numElements;
+    job.d_numChunks   = numChunks;
+
+    bsls::ParallelUtil::run(&ParallelArrayPrimitives_Job<OPERATION>::runChunk,
+                            &job,
+                            numChunks,
+                            policy.numThreads());
+
+    bool failed = false;
+    for (int i = 0; i < numChunks; ++i) {
+        failed = failed || job.d_failed[i];
+    }
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!failed)) {
+        return;                                                       // RETURN
+    }
+
+    // Some chunk threw.  Tear down the chunks that were constructed (a chunk
+    // that threw has already torn itself down), and throw the first recorded
+    // exception on this thread.
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    for (int i = 0; i < numChunks; ++i) {
+        if (!job.d_failed[i]) {
+            ArrayDestructionPrimitives::destroy(
+                                   operation.target() + job.chunkBegin(i),
+                                   operation.target() + job.chunkBegin(i + 1));
+        }
+    }
+    job.throwFailure();
+}
+
+// CLASS METHODS
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+void ParallelArrayPrimitives::defaultConstruct(
+                                     TARGET_TYPE                 *begin,
+                                     size_type                    numElements,
+                                     ALLOCATOR                   *allocator,
+                                     const bsls::ParallelPolicy&  policy)
+{
+    BSLS_ASSERT_SAFE(begin || 0 == numElements);
+
+    typedef ParallelArrayPrimitives_DefaultConstruct<TARGET_TYPE, ALLOCATOR>
+                                                                     Operation;
+
+    runConstruction(Operation(begin, allocator), numElements, policy);
+}
+
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+void ParallelArrayPrimitives::uninitializedFillN(
+                                     TARGET_TYPE                 *begin,
+                                     size_type                    numElements,
+                                     const TARGET_TYPE&           value,
+                                     ALLOCATOR                   *allocator,
+                                     const bsls::ParallelPolicy&  policy)
+{
+    BSLS_ASSERT_SAFE(begin || 0 == numElements);
+
+    typedef ParallelArrayPrimitives_FillN<TARGET_TYPE, ALLOCATOR> Operation;
+
+    runConstruction(Operation(begin, value, allocator), numElements, policy);
+}
+
+template <class TARGET_TYPE, class ALLOCATOR>
+inline
+void ParallelArrayPrimitives::copyConstruct(
+                                        TARGET_TYPE                 *toBegin,
+                                        const TARGET_TYPE           *fromBegin,
+                                        const TARGET_TYPE           *fromEnd,
+                                        ALLOCATOR                   *allocator,
+                                        const bsls::ParallelPolicy&  policy)
+{
+    BSLS_ASSERT_SAFE(toBegin || fromBegin == fromEnd);
+    BSLS_ASSERT_SAFE(fromBegin || !fromEnd);
+    BSLS_ASSERT_SAFE(fromBegin <= fromEnd);
+
+    typedef ParallelArrayPrimitives_CopyConstruct<TARGET_TYPE, ALLOCATOR>
+                                                                     Operation;
+
+    runConstruction(Operation(toBegin, fromBegin, allocator),
+                    fromEnd - fromBegin,
+                    policy);
+}
+
+template <class TARGET_TYPE>
+inline
+void ParallelArrayPrimitives::destroy(TARGET_TYPE                 *begin,
+                                      TARGET_TYPE                 *end,
+                                      const bsls::ParallelPolicy&  policy)
+{
+    BSLS_ASSERT_SAFE(begin || !end);
+    BSLS_ASSERT_SAFE(end   || !begin);
+    BSLS_ASSERT_SAFE(begin <= end);
+
+    destroy(begin,
+            end,
+            policy,
+            typename bsl::is_trivially_copyable<TARGET_TYPE>::type());
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
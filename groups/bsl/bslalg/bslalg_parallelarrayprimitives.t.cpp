@@ -0,0 +1,899 @@
+// bslalg_parallelarrayprimitives.t.cpp                               -*-C++-*-
+#include <bslalg_parallelarrayprimitives.h>
+
+#include <bslma_allocator.h>                     // for testing only
+#include <bslma_default.h>                       // for testing only
+#include <bslma_newdeleteallocator.h>            // for testing only
+#include <bslma_defaultallocatorguard.h>         // for testing only
+#include <bslma_testallocator.h>                 // for testing only
+#include <bslma_usesbslmaallocator.h>            // for testing only
+#include <bslmf_nestedtraitdeclaration.h>        // for testing only
+#include <bsls_asserttest.h>                     // for testing only
+#include <bsls_atomic.h>                         // for testing only
+#include <bsls_bsltestutil.h>                    // for testing only
+#include <bsls_exceptionutil.h>                  // for testing only
+#include <bsls_parallelutil.h>                   // for testing only
+#include <bsls_stopwatch.h>                      // for testing only
+
+#include <exception>   // 'bad_exception'
+
+#include <stdio.h>
+#include <stdlib.h>    // atoi()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides overloads of array primitives that split
+// their work across threads.  Each chunk is handled by the serial primitive,
+// which is tested in its own component, so the concerns here are that every
+// element is constructed or destroyed exactly once whatever the policy and the
+// size of the range, that the same values result as with the serial
+// primitives, and that an exception thrown in any chunk reaches the caller
+// with the array left uninitialized, no memory leaked, and no element
+// constructed twice.
+//
+// Elements are counted by a test type that allocates its value from a
+// 'bslma::TestAllocator' (which is thread-safe), and that throws from its
+// constructors when constructed at a chosen address.  Each function is tested
+// with this type and with 'int', for a table of range sizes and policies,
+// including policies that run every range serially.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void defaultConstruct(T *b, size_type n, A *a, const Policy& p);
+// [ 3] void uninitializedFillN(T *b, size_type n, const T& v, A *a, P&);
+// [ 4] void copyConstruct(T *to, const T *fb, const T *fe, A *a, P&);
+// [ 5] void destroy(T *b, T *e, const Policy& p);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS/TYPES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::ParallelArrayPrimitives Obj;
+typedef bsls::ParallelPolicy            Policy;
+
+static bool verbose;
+static bool veryVerbose;
+
+                               // ===============
+                               // class AllocType
+                               // ===============
+
+class AllocType {
+    // This test type holds an 'int' value in storage obtained from its
+    // allocator, and counts its live objects.  A constructor called to create
+    // an object at the address 's_throwAt_p' throws an 'int'.  The number of
+    // constructions attempted, including those that throw, is also counted.
+
+    // DATA
+    int              *d_value_p;      // owned value
+    bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    AllocType& operator=(const AllocType&);
+
+    // PRIVATE MANIPULATORS
+    void initialize(int value);
+        // Throw if this object is at 's_throwAt_p', and otherwise allocate
+        // the value of this object and set it to the specified 'value'.
+
+  public:
+    // CLASS DATA
+    static bsls::AtomicInt  s_numLive;      // number of live objects
+    static bsls::AtomicInt  s_numAttempts;  // number of constructions
+                                            // attempted
+    static const AllocType *s_throwAt_p;    // address at which to throw
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AllocType, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AllocType(bslma::Allocator *basicAllocator = 0);
+        // Create an object having the value 0.  Optionally specify a
+        // 'basicAllocator' used to supply memory.
+
+    explicit AllocType(int value, bslma::Allocator *basicAllocator = 0);
+        // Create an object having the specified 'value'.  Optionally specify
+        // a 'basicAllocator' used to supply memory.
+
+    AllocType(const AllocType& original, bslma::Allocator *basicAllocator = 0);
+        // Create an object having the value of the specified 'original'
+        // object.  Optionally specify a 'basicAllocator' used to supply
+        // memory.
+
+    ~AllocType();
+        // Destroy this object.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator of this object.
+
+    int value() const;
+        // Return the value of this object.
+};
+
+bsls::AtomicInt  AllocType::s_numLive(0);
+bsls::AtomicInt  AllocType::s_numAttempts(0);
+const AllocType *AllocType::s_throwAt_p = 0;
+
+// PRIVATE MANIPULATORS
+void AllocType::initialize(int value)
+{
+    s_numAttempts.add(1);
+#ifdef BDE_BUILD_TARGET_EXC
+    if (this == s_throwAt_p) {
+        throw value;
+    }
+#endif
+    d_value_p = static_cast<int *>(d_allocator_p->allocate(sizeof(int)));
+    *d_value_p = value;
+    s_numLive.add(1);
+}
+
+// CREATORS
+AllocType::AllocType(bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(0);
+}
+
+AllocType::AllocType(int value, bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(value);
+}
+
+AllocType::AllocType(const AllocType&  original,
+                     bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(original.value());
+}
+
+AllocType::~AllocType()
+{
+    d_allocator_p->deallocate(d_value_p);
+    s_numLive.add(-1);
+}
+
+// ACCESSORS
+bslma::Allocator *AllocType::allocator() const
+{
+    return d_allocator_p;
+}
+
+int AllocType::value() const
+{
+    return *d_value_p;
+}
+
+                               // ==============
+                               // struct Storage
+                               // ==============
+
+template <class TYPE>
+struct Storage {
+    // This 'struct' owns uninitialized storage for an array of 'TYPE'.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;
+    TYPE             *d_array_p;
+
+    // CREATORS
+    Storage(int numElements, bslma::Allocator *allocator)
+    : d_allocator_p(allocator)
+    , d_array_p(static_cast<TYPE *>(
+                      allocator->allocate((numElements + 1) * sizeof(TYPE))))
+        // Create storage for the specified 'numElements' objects, using the
+        // specified 'allocator'.
+    {
+    }
+
+    ~Storage()
+        // Release the storage.
+    {
+        d_allocator_p->deallocate(d_array_p);
+    }
+};
+
+//=============================================================================
+//                       TABLES OF SIZES AND POLICIES
+//-----------------------------------------------------------------------------
+
+const int SIZES[]   = { 0, 1, 2, 3, 10, 63, 100, 1000, 4097 };
+const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+const struct {
+    int d_numThreads;    // threads of the policy
+    int d_minChunkSize;  // minimum chunk size of the policy
+} POLICIES[] = {
+    { 1,    1 },
+    { 4,    1 },
+    { 3,    7 },
+    { 2, 1000 },
+    { 0,   16 },
+};
+const int NUM_POLICIES = static_cast<int>(sizeof POLICIES / sizeof *POLICIES);
+
+Policy policy(int index)
+    // Return the policy at the specified 'index' in 'POLICIES'.
+{
+    return Policy(POLICIES[index].d_numThreads,
+                  POLICIES[index].d_minChunkSize);
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace usage {
+
+class Counted {
+    // This class holds an 'int' value and counts its live objects.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static bsls::AtomicInt s_numLive;   // number of live objects
+
+    // CREATORS
+    explicit Counted(int value)
+    : d_value(value)
+    {
+        s_numLive.add(1);
+    }
+
+    Counted(const Counted& original)
+    : d_value(original.d_value)
+    {
+        s_numLive.add(1);
+    }
+
+    ~Counted()
+    {
+        s_numLive.add(-1);
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+bsls::AtomicInt Counted::s_numLive(0);
+
+}  // close namespace usage
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    bslma::TestAllocator         ta("test", veryVerbose);
+    bslma::TestAllocator         sa("storage", veryVerbose);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace usage;
+
+        enum { k_NUM_ELEMENTS = 10000 };
+
+        bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+        Counted *array = static_cast<Counted *>(
+                       allocator->allocate(k_NUM_ELEMENTS * sizeof(Counted)));
+
+        const bsls::ParallelPolicy policy(4, 1000);
+
+        bslalg::ParallelArrayPrimitives::uninitializedFillN(array,
+                                                            k_NUM_ELEMENTS,
+                                                            Counted(7),
+                                                            allocator,
+                                                            policy);
+
+        ASSERT(k_NUM_ELEMENTS == Counted::s_numLive);
+        ASSERT(7 == array[0].value());
+        ASSERT(7 == array[k_NUM_ELEMENTS - 1].value());
+
+        bslalg::ParallelArrayPrimitives::destroy(array,
+                                                 array + k_NUM_ELEMENTS,
+                                                 policy);
+        ASSERT(0 == Counted::s_numLive);
+
+        allocator->deallocate(array);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'destroy'
+        //
+        // Concerns:
+        //: 1 Every element is destroyed exactly once, for any policy and
+        //:   range size.
+        //:
+        //: 2 Arrays of bitwise-copyable types are accepted, and no element of
+        //:   them is touched in non-safe builds.
+        //:
+        //: 3 An empty range given by two null pointers is accepted.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each size and policy in the tables, construct an array of
+        //:   'AllocType', destroy it, and check that no object is live and no
+        //:   memory of the elements is in use.  (C-1)
+        //:
+        //: 2 Destroy arrays of 'int', and an empty null range.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void destroy(T *b, T *e, const Policy& p);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD 'destroy'"
+                            "\n======================\n");
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+                const int N = SIZES[si];
+
+                Storage<AllocType> storage(N, &sa);
+                AllocType *array = storage.d_array_p;
+
+                bslalg::ArrayPrimitives::uninitializedFillN(array,
+                                                            N,
+                                                            AllocType(3),
+                                                            &ta);
+                ASSERTV(N, pi, N == AllocType::s_numLive);
+
+                Obj::destroy(array, array + N, policy(pi));
+
+                ASSERTV(N, pi, 0 == AllocType::s_numLive);
+                ASSERTV(N, pi, 0 == ta.numBlocksInUse());
+
+                Storage<int> intStorage(N, &sa);
+                int *intArray = intStorage.d_array_p;
+                for (int i = 0; i < N; ++i) {
+                    intArray[i] = i;
+                }
+                Obj::destroy(intArray, intArray + N, policy(pi));
+            }
+        }
+
+        Obj::destroy(static_cast<AllocType *>(0),
+                     static_cast<AllocType *>(0),
+                     Policy(4, 1));
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            int a[2];
+            int *null = 0;
+
+            ASSERT_SAFE_PASS(Obj::destroy(a, a + 2, Policy()));
+            ASSERT_SAFE_PASS(Obj::destroy(null, null, Policy()));
+            ASSERT_SAFE_FAIL(Obj::destroy(a + 2, a, Policy()));
+            ASSERT_SAFE_FAIL(Obj::destroy(null, a, Policy()));
+            ASSERT_SAFE_FAIL(Obj::destroy(a, null, Policy()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'copyConstruct'
+        //
+        // Concerns:
+        //: 1 Every element is copied exactly once from the corresponding
+        //:   source element, for any policy and range size, using the
+        //:   supplied allocator.
+        //:
+        //: 2 If the copy of any element throws, the exception reaches the
+        //:   caller, no element is left constructed, no memory is leaked, and
+        //:   no element is copied twice.
+        //
+        // Plan:
+        //: 1 For each size and policy in the tables, copy an array of
+        //:   distinct values of 'AllocType' and of 'int', and check each
+        //:   element, its allocator, and the number of live objects.  (C-1)
+        //:
+        //: 2 For each size and policy, and for the first, a middle, and the
+        //:   last element, copy an array with the copy of that element set to
+        //:   throw, and check that an exception is caught, that the only live
+        //:   objects and memory in use are those of the source, and that at
+        //:   most one copy per element was attempted.  (C-2)
+        //
+        // Testing:
+        //   void copyConstruct(T *to, const T *fb, const T *fe, A *a, P&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD 'copyConstruct'"
+                            "\n============================\n");
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+                const int N = SIZES[si];
+
+                if (veryVerbose) { T_ P_(N) P(pi) }
+
+                Storage<AllocType> fromStorage(N, &sa);
+                Storage<AllocType> toStorage(N, &sa);
+                AllocType *from = fromStorage.d_array_p;
+                AllocType *to   = toStorage.d_array_p;
+
+                for (int i = 0; i < N; ++i) {
+                    new (from + i) AllocType(i, &sa);
+                }
+
+                Obj::copyConstruct(to, from, from + N, &ta, policy(pi));
+
+                ASSERTV(N, pi, 2 * N == AllocType::s_numLive);
+                ASSERTV(N, pi, N == ta.numBlocksInUse());
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(N, pi, i, i == to[i].value());
+                    ASSERTV(N, pi, i, &ta == to[i].allocator());
+                }
+                bslalg::ArrayDestructionPrimitives::destroy(to, to + N);
+
+#ifdef BDE_BUILD_TARGET_EXC
+                const int THROW_AT[] = { 0, N / 2, N - 1 };
+                for (int ti = 0; N && ti < 3; ++ti) {
+                    AllocType::s_throwAt_p = to + THROW_AT[ti];
+                    AllocType::s_numAttempts = 0;
+
+                    bool caught = false;
+                    try {
+                        Obj::copyConstruct(to, from, from + N, &ta,
+                                           policy(pi));
+                    }
+                    catch (int) {
+                        caught = true;
+                    }
+#ifndef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+                    catch (const std::bad_exception&) {
+                        // Thrown instead of the 'int' if the range was split.
+
+                        caught = true;
+                    }
+#endif
+                    AllocType::s_throwAt_p = 0;
+
+                    ASSERTV(N, pi, ti, caught);
+                    ASSERTV(N, pi, ti, AllocType::s_numAttempts,
+                            AllocType::s_numAttempts <= N);
+                    ASSERTV(N, pi, ti, N == AllocType::s_numLive);
+                    ASSERTV(N, pi, ti, 0 == ta.numBlocksInUse());
+                }
+#endif
+
+                bslalg::ArrayDestructionPrimitives::destroy(from, from + N);
+                ASSERTV(N, pi, 0 == AllocType::s_numLive);
+
+                Storage<int> intFromStorage(N, &sa);
+                Storage<int> intToStorage(N, &sa);
+                int *intFrom = intFromStorage.d_array_p;
+                int *intTo   = intToStorage.d_array_p;
+                for (int i = 0; i < N; ++i) {
+                    intFrom[i] = i;
+                }
+
+                Obj::copyConstruct(intTo,
+                                   intFrom,
+                                   intFrom + N,
+                                   &ta,
+                                   policy(pi));
+
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(N, pi, i, i == intTo[i]);
+                }
+            }
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'uninitializedFillN'
+        //
+        // Concerns:
+        //: 1 Every element is constructed exactly once as a copy of the value,
+        //:   for any policy and range size, using the supplied allocator.
+        //:
+        //: 2 If the copy into any element throws, the exception reaches the
+        //:   caller, no element is left constructed, no memory is leaked, and
+        //:   no element is constructed twice.
+        //
+        // Plan:
+        //: 1 For each size and policy in the tables, fill arrays of
+        //:   'AllocType' and of 'int', and check each element, its
+        //:   allocator, and the number of live objects.  (C-1)
+        //:
+        //: 2 For each size and policy, and for the first, a middle, and the
+        //:   last element, fill an array with the copy into that element set
+        //:   to throw, and check that an exception is caught, that no object
+        //:   is live and no memory is in use, and that at most one
+        //:   construction per element was attempted.  (C-2)
+        //
+        // Testing:
+        //   void uninitializedFillN(T *b, size_type n, const T& v, A *a, P&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD 'uninitializedFillN'"
+                            "\n=================================\n");
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+                const int N = SIZES[si];
+
+                if (veryVerbose) { T_ P_(N) P(pi) }
+
+                Storage<AllocType> storage(N, &sa);
+                AllocType *array = storage.d_array_p;
+                {
+                    const AllocType VALUE(42, &sa);
+
+                    Obj::uninitializedFillN(array, N, VALUE, &ta, policy(pi));
+
+                    ASSERTV(N, pi, N + 1 == AllocType::s_numLive);
+                    ASSERTV(N, pi, N == ta.numBlocksInUse());
+                    for (int i = 0; i < N; ++i) {
+                        ASSERTV(N, pi, i, 42 == array[i].value());
+                        ASSERTV(N, pi, i, &ta == array[i].allocator());
+                    }
+                    bslalg::ArrayDestructionPrimitives::destroy(array,
+                                                                array + N);
+
+#ifdef BDE_BUILD_TARGET_EXC
+                    const int THROW_AT[] = { 0, N / 2, N - 1 };
+                    for (int ti = 0; N && ti < 3; ++ti) {
+                        AllocType::s_throwAt_p = array + THROW_AT[ti];
+                        AllocType::s_numAttempts = 0;
+
+                        bool caught = false;
+                        try {
+                            Obj::uninitializedFillN(array, N, VALUE, &ta,
+                                                    policy(pi));
+                        }
+                        catch (int) {
+                            caught = true;
+                        }
+#ifndef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+                        catch (const std::bad_exception&) {
+                            // Thrown instead of the 'int' if the range was
+                            // split.
+
+                            caught = true;
+                        }
+#endif
+                        AllocType::s_throwAt_p = 0;
+
+                        ASSERTV(N, pi, ti, caught);
+                        ASSERTV(N, pi, ti, AllocType::s_numAttempts,
+                                AllocType::s_numAttempts <= N);
+                        ASSERTV(N, pi, ti, 1 == AllocType::s_numLive);
+                        ASSERTV(N, pi, ti, 0 == ta.numBlocksInUse());
+                    }
+#endif
+                }
+                ASSERTV(N, pi, 0 == AllocType::s_numLive);
+
+                Storage<int> intStorage(N, &sa);
+                int *intArray = intStorage.d_array_p;
+
+                Obj::uninitializedFillN(intArray, N, -5, &ta, policy(pi));
+
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(N, pi, i, -5 == intArray[i]);
+                }
+            }
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'defaultConstruct'
+        //
+        // Concerns:
+        //: 1 Every element is value-initialized exactly once, for any policy
+        //:   and range size, using the supplied allocator.
+        //:
+        //: 2 If the construction of any element throws, the exception reaches
+        //:   the caller, no element is left constructed, no memory is leaked,
+        //:   and no element is constructed twice.
+        //
+        // Plan:
+        //: 1 For each size and policy in the tables, default construct arrays
+        //:   of 'AllocType' and of 'int' (the latter filled with garbage
+        //:   beforehand), and check each element, its allocator, and the
+        //:   number of live objects.  (C-1)
+        //:
+        //: 2 For each size and policy, and for the first, a middle, and the
+        //:   last element, construct an array with the construction of that
+        //:   element set to throw, and check that an exception is caught, that
+        //:   no object is live and no memory is in use, and that at most one
+        //:   construction per element was attempted.  (C-2)
+        //
+        // Testing:
+        //   void defaultConstruct(T *b, size_type n, A *a, const Policy& p);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD 'defaultConstruct'"
+                            "\n===============================\n");
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+                const int N = SIZES[si];
+
+                if (veryVerbose) { T_ P_(N) P(pi) }
+
+                Storage<AllocType> storage(N, &sa);
+                AllocType *array = storage.d_array_p;
+
+                Obj::defaultConstruct(array, N, &ta, policy(pi));
+
+                ASSERTV(N, pi, N == AllocType::s_numLive);
+                ASSERTV(N, pi, N == ta.numBlocksInUse());
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(N, pi, i, 0 == array[i].value());
+                    ASSERTV(N, pi, i, &ta == array[i].allocator());
+                }
+                bslalg::ArrayDestructionPrimitives::destroy(array, array + N);
+
+#ifdef BDE_BUILD_TARGET_EXC
+                const int THROW_AT[] = { 0, N / 2, N - 1 };
+                for (int ti = 0; N && ti < 3; ++ti) {
+                    AllocType::s_throwAt_p = array + THROW_AT[ti];
+                    AllocType::s_numAttempts = 0;
+
+                    bool caught = false;
+                    try {
+                        Obj::defaultConstruct(array, N, &ta, policy(pi));
+                    }
+                    catch (int) {
+                        caught = true;
+                    }
+#ifndef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+                    catch (const std::bad_exception&) {
+                        // Thrown instead of the 'int' if the range was split.
+
+                        caught = true;
+                    }
+#endif
+                    AllocType::s_throwAt_p = 0;
+
+                    ASSERTV(N, pi, ti, caught);
+                    ASSERTV(N, pi, ti, AllocType::s_numAttempts,
+                            AllocType::s_numAttempts <= N);
+                    ASSERTV(N, pi, ti, 0 == AllocType::s_numLive);
+                    ASSERTV(N, pi, ti, 0 == ta.numBlocksInUse());
+                }
+#endif
+
+                Storage<int> intStorage(N, &sa);
+                int *intArray = intStorage.d_array_p;
+                for (int i = 0; i < N; ++i) {
+                    intArray[i] = i + 1;
+                }
+
+                Obj::defaultConstruct(intArray, N, &ta, policy(pi));
+
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(N, pi, i, 0 == intArray[i]);
+                }
+            }
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Fill, copy, and destroy an array of 'AllocType' with a policy of
+        //:   four threads, checking the values and the number of live
+        //:   objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        enum { k_N = 1000 };
+
+        const Policy POLICY(4, 10);
+
+        Storage<AllocType> fromStorage(k_N, &sa);
+        Storage<AllocType> toStorage(k_N, &sa);
+        AllocType *from = fromStorage.d_array_p;
+        AllocType *to   = toStorage.d_array_p;
+
+        Obj::uninitializedFillN(from, k_N, AllocType(9), &ta, POLICY);
+        ASSERT(k_N == AllocType::s_numLive);
+
+        Obj::copyConstruct(to, from, from + k_N, &ta, POLICY);
+        ASSERT(2 * k_N == AllocType::s_numLive);
+        ASSERT(9 == to[0].value());
+        ASSERT(9 == to[k_N - 1].value());
+
+        Obj::destroy(from, from + k_N, POLICY);
+        Obj::destroy(to, to + k_N, POLICY);
+        ASSERT(0 == AllocType::s_numLive);
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Splitting the construction and destruction of a large array of
+        //:   objects that allocate across threads reduces the elapsed time.
+        //
+        // Plan:
+        //: 1 Time the fill and the destruction of an array of one million
+        //:   'AllocType' objects for 1, 2, 4, and 8 threads, using the
+        //:   thread-safe new/delete allocator, and report the times.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        enum { k_N = 1000000 };
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        Storage<AllocType> storage(k_N, allocator);
+        AllocType *array = storage.d_array_p;
+
+        for (int threads = 1; threads <= 8; threads *= 2) {
+            const Policy POLICY(threads);
+
+            bsls::Stopwatch fillTimer;
+            fillTimer.start();
+            Obj::uninitializedFillN(array, k_N, AllocType(1), allocator,
+                                    POLICY);
+            fillTimer.stop();
+
+            bsls::Stopwatch destroyTimer;
+            destroyTimer.start();
+            Obj::destroy(array, array + k_N, POLICY);
+            destroyTimer.stop();
+
+            printf("%d threads: fill %.3f s, destroy %.3f s\n",
+                   threads,
+                   fillTimer.elapsedTime(),
+                   destroyTimer.elapsedTime());
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -8,8 +8,115 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bslalg_typetraitusesbslmaallocator.h>         // for testing only
 
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define BSLALG_RANGECOMPARE_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
 namespace BloombergLP {
 
+namespace {
+
+inline
+int firstSetBit(unsigned int value)
+    // Return the index of the least-significant set bit of the specified
+    // 'value'.  The behavior is undefined unless '0 != value'.
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(value);
+#else
+    int index = 0;
+    while (!(value & 1)) {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bslalg {
+
+                       // -----------------------
+                       // struct RangeCompare_Imp
+                       // -----------------------
+
+// CLASS METHODS
+std::size_t RangeCompare_Imp::mismatchBytes(const void  *lhs,
+                                            const void  *rhs,
+                                            std::size_t  numBytes)
+{
+    const unsigned char *lhsBytes = static_cast<const unsigned char *>(lhs);
+    const unsigned char *rhsBytes = static_cast<const unsigned char *>(rhs);
+
+    std::size_t offset = 0;
+
+#if defined(BSLALG_RANGECOMPARE_USE_SSE2)
+    // Skip 64 equal bytes at a time, then find the differing byte 16 bytes at
+    // a time: 'mask' has a bit set for each equal byte.
+
+    for (; offset + 64 <= numBytes; offset += 64) {
+        const __m128i *lhsBlock =
+                      reinterpret_cast<const __m128i *>(lhsBytes + offset);
+        const __m128i *rhsBlock =
+                      reinterpret_cast<const __m128i *>(rhsBytes + offset);
+        const __m128i equal01 = _mm_and_si128(
+                 _mm_cmpeq_epi8(_mm_loadu_si128(lhsBlock),
+                                _mm_loadu_si128(rhsBlock)),
+                 _mm_cmpeq_epi8(_mm_loadu_si128(lhsBlock + 1),
+                                _mm_loadu_si128(rhsBlock + 1)));
+        const __m128i equal23 = _mm_and_si128(
+                 _mm_cmpeq_epi8(_mm_loadu_si128(lhsBlock + 2),
+                                _mm_loadu_si128(rhsBlock + 2)),
+                 _mm_cmpeq_epi8(_mm_loadu_si128(lhsBlock + 3),
+                                _mm_loadu_si128(rhsBlock + 3)));
+        if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(equal01, equal23))) {
+            break;
+        }
+    }
+
+    for (; offset + 16 <= numBytes; offset += 16) {
+        const __m128i lhsBlock = _mm_loadu_si128(
+                         reinterpret_cast<const __m128i *>(lhsBytes + offset));
+        const __m128i rhsBlock = _mm_loadu_si128(
+                         reinterpret_cast<const __m128i *>(rhsBytes + offset));
+        const unsigned int mask = static_cast<unsigned int>(
+                  _mm_movemask_epi8(_mm_cmpeq_epi8(lhsBlock, rhsBlock)));
+        if (0xFFFF != mask) {
+            return offset + firstSetBit(~mask);                       // RETURN
+        }
+    }
+#else
+    // Compare a machine word at a time, and leave the search for the first
+    // differing byte of a differing word to the loop below.
+
+    typedef bsls::Types::Uint64 Word;
+
+    for (; offset + sizeof(Word) <= numBytes; offset += sizeof(Word)) {
+        Word lhsWord;
+        Word rhsWord;
+        std::memcpy(&lhsWord, lhsBytes + offset, sizeof(Word));
+        std::memcpy(&rhsWord, rhsBytes + offset, sizeof(Word));
+        if (lhsWord != rhsWord) {
+            break;
+        }
+    }
+#endif
+
+    for (; offset < numBytes; ++offset) {
+        if (lhsBytes[offset] != rhsBytes[offset]) {
+            break;
+        }
+    }
+    return offset;
+}
+
+}  // close package namespace
+
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
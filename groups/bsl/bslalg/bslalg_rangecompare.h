@@ -36,6 +36,15 @@ BSLS_IDENT("$Id: $")
 //: o The input iterators are convertible to pointers to a wide or unsigned
 //    character type.
 //
+// Otherwise, 'bslalg::RangeCompare::lexicographical' may search for the first
+// pair of corresponding elements that differ bit-wise, and compare only that
+// pair with 'operator<', when the two criteria for a bit-wise 'equal' are met.
+// The search compares 16 bytes at a time with SSE2 instructions on x86
+// platforms, and a machine word at a time elsewhere.  Note that two elements
+// that differ bit-wise may still be equivalent (e.g., the 'double' values
+// '-0.0' and '+0.0'), in which case the search resumes after them, so that the
+// result is always that of comparing the elements with 'operator<'.
+//
 // Note that a class having the 'bslmf::IsBitwiseEqualityComparable'
 // trait can be described as bit-wise comparable and should meet the following
 // criteria:
@@ -459,8 +468,10 @@ struct RangeCompare {
         // '[start1, end1)', and 'length2' is either unspecified or equals the
         // length of the range '[start2, end2)'.  Note that this implementation
         // uses 'std::memcmp' for unsigned character comparisons,
-        // 'std::wmemcmp' for wide character comparisons, and 'operator<' for
-        // all other types.
+        // 'std::wmemcmp' for wide character comparisons, a bit-wise search
+        // for the first differing elements followed by 'operator<' for other
+        // pointer ranges of bit-wise equality-comparable types, and
+        // 'operator<' element-by-element for all other types.
 };
 
                        // =======================
@@ -646,6 +657,61 @@ struct RangeCompare_Imp {
         // than the second range, 0 if they are the same length and compare
         // lexicographically equal, and a positive value if the first range
         // compares lexicographically greater than the second range.
+
+    template <typename INPUT_ITER, typename VALUE_TYPE>
+    static int lexicographicalBitwiseEqualityComparable(
+                                                    INPUT_ITER        start1,
+                                                    INPUT_ITER        end1,
+                                                    INPUT_ITER        start2,
+                                                    const VALUE_TYPE&);
+        // Compare the range beginning at the specified 'start1' position and
+        // ending immediately before the specified 'end1' position with the
+        // range beginning at the specified 'start2' position of the same
+        // length, using a bit-wise search for the first differing elements if
+        // 'INPUT_ITER' is convertible to 'const VALUE_TYPE *' and
+        // 'VALUE_TYPE' has the bit-wise equality-comparable trait, and
+        // 'operator<' element-by-element otherwise.  The unnamed 'VALUE_TYPE'
+        // argument is for automatic type deduction, and is ignored.  Return a
+        // negative value if the first range compares lexicographically less
+        // than the second range, 0 if they compare lexicographically equal,
+        // and a positive value otherwise.
+
+    template <typename VALUE_TYPE>
+    static int lexicographicalBitwise(const VALUE_TYPE *start1,
+                                      const VALUE_TYPE *end1,
+                                      const VALUE_TYPE *start2,
+                                      bsl::true_type);
+        // Compare the range beginning at the specified 'start1' position and
+        // ending immediately before the specified 'end1' position with the
+        // range beginning at the specified 'start2' position of the same
+        // length, by searching bit-wise for the first pair of corresponding
+        // elements that differ, and comparing that pair with 'operator<'.
+        // The last argument is for removing overload ambiguities, and is not
+        // used.  Return a negative value if the first range compares
+        // lexicographically less than the second range, 0 if they compare
+        // lexicographically equal, and a positive value otherwise.
+
+    template <typename INPUT_ITER>
+    static int lexicographicalBitwise(INPUT_ITER      start1,
+                                      INPUT_ITER      end1,
+                                      INPUT_ITER      start2,
+                                      bsl::false_type);
+        // Compare the range beginning at the specified 'start1' position and
+        // ending immediately before the specified 'end1' position with the
+        // range beginning at the specified 'start2' position of the same
+        // length, using 'operator<' element-by-element.  The last argument is
+        // for removing overload ambiguities, and is not used.  Return a
+        // negative value if the first range compares lexicographically less
+        // than the second range, 0 if they compare lexicographically equal,
+        // and a positive value otherwise.
+
+    static std::size_t mismatchBytes(const void  *lhs,
+                                     const void  *rhs,
+                                     std::size_t  numBytes);
+        // Return the offset of the first byte at which the memory at the
+        // specified 'lhs' address differs from the memory at the specified
+        // 'rhs' address, or the specified 'numBytes' if the first 'numBytes'
+        // bytes at both addresses are the same.
 };
 
 // ===========================================================================
@@ -1000,11 +1066,77 @@ int RangeCompare_Imp::lexicographical(INPUT_ITER start1,
                                       INPUT_ITER start2)
 {
     if (start1 != end1) {
-        return lexicographical(start1, end1, start2, *start1);        // RETURN
+        return lexicographicalBitwiseEqualityComparable(start1,
+                                                        end1,
+                                                        start2,
+                                                        *start1);     // RETURN
     }
     return 0;
 }
 
+template <typename INPUT_ITER, typename VALUE_TYPE>
+inline
+int RangeCompare_Imp::lexicographicalBitwiseEqualityComparable(
+                                                    INPUT_ITER        start1,
+                                                    INPUT_ITER        end1,
+                                                    INPUT_ITER        start2,
+                                                    const VALUE_TYPE&)
+{
+    typedef bsl::integral_constant<bool,
+             bslmf::IsBitwiseEqualityComparable<VALUE_TYPE>::value
+          && bsl::is_convertible<INPUT_ITER, const VALUE_TYPE *>::value>
+                                               CanUseBitwiseSearchOptimization;
+
+    return lexicographicalBitwise(start1,
+                                  end1,
+                                  start2,
+                                  CanUseBitwiseSearchOptimization());
+}
+
+                 // *** lexicographicalBitwise overloads: ***
+
+template <typename VALUE_TYPE>
+int RangeCompare_Imp::lexicographicalBitwise(const VALUE_TYPE *start1,
+                                             const VALUE_TYPE *end1,
+                                             const VALUE_TYPE *start2,
+                                             bsl::true_type)
+{
+    while (start1 != end1) {
+        const std::size_t numBytes = reinterpret_cast<const char *>(end1)
+                                   - reinterpret_cast<const char *>(start1);
+        const std::size_t offset   = mismatchBytes(start1, start2, numBytes)
+                                   / sizeof(VALUE_TYPE);
+        start1 += offset;
+        start2 += offset;
+        if (start1 == end1) {
+            break;
+        }
+        if (*start1 < *start2) {
+            return -1;                                                // RETURN
+        }
+        if (*start2 < *start1) {
+            return 1;                                                 // RETURN
+        }
+
+        // The elements differ bit-wise but are equivalent (e.g., '-0.0' and
+        // '+0.0'), so resume the search after them.
+
+        ++start1;
+        ++start2;
+    }
+    return 0;
+}
+
+template <typename INPUT_ITER>
+inline
+int RangeCompare_Imp::lexicographicalBitwise(INPUT_ITER      start1,
+                                             INPUT_ITER      end1,
+                                             INPUT_ITER      start2,
+                                             bsl::false_type)
+{
+    return lexicographical(start1, end1, start2, bslmf::MatchAnyType(0));
+}
+
 }  // close package namespace
 
 
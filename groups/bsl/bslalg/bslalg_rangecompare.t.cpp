@@ -49,11 +49,13 @@ using namespace std;
 //-----------------------------------------------------------------------------
 // [ 3] bool equal(start1, end1, length1, start2, end2, length2);
 // [ 4] bool lexicographical(start1, end1, length1, start2, end2, length2);
+// [ 5] size_t RangeCompare_Imp::mismatchBytes(lhs, rhs, numBytes);
+// [ 5] int lexicographical(start1, end1, start2, end2);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TEST APPARATUS
 // [-1] PERFORMANCE TEST
-// [ 5] USAGE EXAMPLE
+// [ 6] USAGE EXAMPLE
 
 //==========================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -2113,7 +2115,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2143,6 +2145,151 @@ int main(int argc, char *argv[])
         // Compare (bit-wise comparable) primitive types.
         usageTestInt();
      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING BIT-WISE SEARCH FOR THE FIRST DIFFERENCE
+        //
+        // Concerns:
+        //: 1 'mismatchBytes' returns the offset of the first differing byte,
+        //:   at every offset, for every length, and for unaligned addresses.
+        //:
+        //: 2 'mismatchBytes' returns 'numBytes' for equal ranges, including
+        //:   empty ranges.
+        //:
+        //: 3 'lexicographical' on pointer ranges of multibyte bit-wise
+        //:   equality-comparable types orders the ranges by the first pair of
+        //:   elements that are not equivalent under 'operator<'.
+        //:
+        //: 4 Elements that differ bit-wise but are equivalent (the 'double'
+        //:   values '-0.0' and '+0.0') do not end the comparison.
+        //
+        // Plan:
+        //: 1 For every length up to 80 and every misalignment up to 7, make
+        //:   two equal byte buffers, check 'mismatchBytes' on them, and then
+        //:   change each byte in turn, checking that its offset is returned.
+        //:   (C-1..2)
+        //:
+        //: 2 For 'int', 'unsigned short', and 'double' arrays, change each
+        //:   element in turn to a greater and a lesser value, and check the
+        //:   sign of 'lexicographical' both ways.  (C-3)
+        //:
+        //: 3 Compare 'double' arrays that differ only by the sign of zeros,
+        //:   with and without a difference after them.  (C-4)
+        //
+        // Testing:
+        //   size_t RangeCompare_Imp::mismatchBytes(lhs, rhs, numBytes);
+        //   int lexicographical(start1, end1, start2, end2);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING BIT-WISE SEARCH FOR THE FIRST DIFFERENCE"
+                          "\n================================================"
+                          "\n");
+
+        typedef bslalg::RangeCompare     Obj;
+        typedef bslalg::RangeCompare_Imp Imp;
+
+        if (verbose) printf("\nTesting 'mismatchBytes'.\n");
+        {
+            enum { k_MAX_LENGTH = 80, k_MAX_SKEW = 8 };
+
+            unsigned char lhs[k_MAX_LENGTH + k_MAX_SKEW];
+            unsigned char rhs[k_MAX_LENGTH + k_MAX_SKEW];
+
+            for (int skew = 0; skew < k_MAX_SKEW; ++skew) {
+                for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                    unsigned char *const L = lhs + skew;
+                    unsigned char *const R = rhs + (k_MAX_SKEW - 1 - skew);
+                    for (int i = 0; i < length; ++i) {
+                        L[i] = R[i] = static_cast<unsigned char>(i * 7 + 1);
+                    }
+                    LOOP2_ASSERT(skew, length,
+                                 static_cast<std::size_t>(length) ==
+                                            Imp::mismatchBytes(L, R, length));
+
+                    for (int i = 0; i < length; ++i) {
+                        R[i] ^= 0x80;
+                        LOOP3_ASSERT(skew, length, i,
+                                     static_cast<std::size_t>(i) ==
+                                            Imp::mismatchBytes(L, R, length));
+                        R[i] ^= 0x80;
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'lexicographical' on integers.\n");
+        {
+            enum { k_LENGTH = 37 };
+
+            int            a[k_LENGTH];
+            int            b[k_LENGTH];
+            unsigned short c[k_LENGTH];
+            unsigned short d[k_LENGTH];
+            for (int i = 0; i < k_LENGTH; ++i) {
+                a[i] = b[i] = i * 1000 - 5000;
+                c[i] = d[i] = static_cast<unsigned short>(i * 1000 + 255);
+            }
+            ASSERT(0 == Obj::lexicographical(a, a + k_LENGTH,
+                                             b, b + k_LENGTH));
+            ASSERT(0 == Obj::lexicographical(c, c + k_LENGTH,
+                                             d, d + k_LENGTH));
+            ASSERT(0 >  Obj::lexicographical(a, a + k_LENGTH - 1,
+                                             b, b + k_LENGTH));
+            ASSERT(0 <  Obj::lexicographical(a, a + k_LENGTH,
+                                             b, b + k_LENGTH - 1));
+
+            for (int i = 0; i < k_LENGTH; ++i) {
+                b[i] += 256;
+                d[i] = static_cast<unsigned short>(d[i] - 1);
+                LOOP_ASSERT(i, 0 > Obj::lexicographical(a, a + k_LENGTH,
+                                                        b, b + k_LENGTH));
+                LOOP_ASSERT(i, 0 < Obj::lexicographical(b, b + k_LENGTH,
+                                                        a, a + k_LENGTH));
+                LOOP_ASSERT(i, 0 < Obj::lexicographical(c, c + k_LENGTH,
+                                                        d, d + k_LENGTH));
+                LOOP_ASSERT(i, 0 > Obj::lexicographical(d, d + k_LENGTH,
+                                                        c, c + k_LENGTH));
+                b[i] -= 256;
+                d[i] = static_cast<unsigned short>(d[i] + 1);
+            }
+        }
+
+        if (verbose) printf("\nTesting 'lexicographical' on 'double'.\n");
+        {
+            enum { k_LENGTH = 9 };
+
+            double a[k_LENGTH];
+            double b[k_LENGTH];
+            for (int i = 0; i < k_LENGTH; ++i) {
+                a[i] = b[i] = i * 0.5 - 1.0;
+            }
+            for (int i = 0; i < k_LENGTH; ++i) {
+                b[i] = a[i] + 0.25;
+                LOOP_ASSERT(i, 0 > Obj::lexicographical(a, a + k_LENGTH,
+                                                        b, b + k_LENGTH));
+                LOOP_ASSERT(i, 0 < Obj::lexicographical(b, b + k_LENGTH,
+                                                        a, a + k_LENGTH));
+                b[i] = a[i];
+            }
+
+            // Signed zeros differ bit-wise, but are equivalent.
+
+            const double zero = 0.0;
+            for (int i = 0; i < k_LENGTH; ++i) {
+                a[i] = zero;
+                b[i] = -zero;
+            }
+            ASSERT(0 == Obj::lexicographical(a, a + k_LENGTH,
+                                             b, b + k_LENGTH));
+
+            b[k_LENGTH - 1] = 1.0;
+            ASSERT(0 >  Obj::lexicographical(a, a + k_LENGTH,
+                                             b, b + k_LENGTH));
+            ASSERT(0 <  Obj::lexicographical(b, b + k_LENGTH,
+                                             a, a + k_LENGTH));
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING 'lexicographical'
@@ -0,0 +1,63 @@
+// bslalg_searchutil.cpp                                              -*-C++-*-
+#include <bslalg_searchutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                            // -----------------
+                            // struct SearchUtil
+                            // -----------------
+
+// PRIVATE CLASS METHODS
+native_std::size_t SearchUtil::buildEytzingerPermutationImp(
+                                         native_std::size_t *result,
+                                         native_std::size_t  numElements,
+                                         native_std::size_t  sortedIndex,
+                                         native_std::size_t  eytzingerIndex)
+{
+    // An in-order traversal of the implicit tree visits the nodes in sorted
+    // order.  The recursion depth is bounded by 'log2(numElements) + 1'.
+
+    if (eytzingerIndex <= numElements) {
+        sortedIndex = buildEytzingerPermutationImp(result,
+                                                   numElements,
+                                                   sortedIndex,
+                                                   2 * eytzingerIndex);
+        result[eytzingerIndex - 1] = sortedIndex++;
+        sortedIndex = buildEytzingerPermutationImp(result,
+                                                   numElements,
+                                                   sortedIndex,
+                                                   2 * eytzingerIndex + 1);
+    }
+    return sortedIndex;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
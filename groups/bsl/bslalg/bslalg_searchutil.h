@@ -0,0 +1,386 @@
+// bslalg_searchutil.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLALG_SEARCHUTIL
+#define INCLUDED_BSLALG_SEARCHUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide branch-free searches on sorted and Eytzinger arrays.
+//
+//@CLASSES:
+//  bslalg::SearchUtil: namespace for sorted-array search algorithms
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmap
+//
+//@DESCRIPTION: This component provides a namespace, 'bslalg::SearchUtil',
+// containing a suite of utility functions for locating a key in a contiguous
+// array of elements ordered according to a user-supplied comparator.  The
+// functions are intended for use in the implementation of containers that
+// keep their elements in a contiguous, sorted buffer (e.g., 'bsl::flat_set'
+// and 'bsl::flat_map').
+//
+// Two array layouts are supported:
+//
+//: o *Sorted* layout: the elements are stored in ascending order.  The
+//:   'lowerBound' and 'upperBound' functions perform a binary search whose
+//:   loop body contains no data-dependent branch; the next probe is selected
+//:   with an expression that compilers typically reduce to a conditional
+//:   move.  This avoids the branch mispredictions that dominate the cost of a
+//:   conventional binary search over arrays that fit in cache.
+//:
+//: o *Eytzinger* layout: the elements are stored in the order of a
+//:   breadth-first traversal of an implicit, complete binary search tree
+//:   (the layout used for binary heaps).  Position 'k' (counting from 1) has
+//:   its children at positions '2 * k' and '2 * k + 1', so the elements
+//:   visited during the first levels of a search are clustered at the front
+//:   of the array and the descendants of a node a few levels down can be
+//:   prefetched ahead of time.  For arrays much larger than the data cache
+//:   'eytzingerLowerBound' is substantially faster than a search of the
+//:   sorted layout.  The 'buildEytzingerPermutation' function computes, for
+//:   each position of the Eytzinger layout, the index of the corresponding
+//:   element in the sorted layout, allowing a client to build an Eytzinger
+//:   copy of a sorted array, and to map a search result back to the sorted
+//:   array.
+//
+// The 'COMPARATOR' (template parameter) type supplied to the search functions
+// must be a functor (or function pointer) type whose function-call operator
+// can be invoked with an element of the array and the searched-for key, in
+// either order, returning a value convertible to 'bool' that is 'true' if the
+// first argument is ordered before the second.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted Array
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we have a sorted array of integers and want to find the first
+// element not less than a given key.
+//
+// First, we define the array:
+//..
+//  const int DATA[]   = { 1, 3, 3, 5, 8, 13, 21 };
+//  const int NUM_DATA = sizeof DATA / sizeof *DATA;
+//..
+// Then, we search the array with 'lowerBound' and 'upperBound':
+//..
+//  const int *lower = bslalg::SearchUtil::lowerBound(DATA,
+//                                                    DATA + NUM_DATA,
+//                                                    3,
+//                                                    std::less<int>());
+//  const int *upper = bslalg::SearchUtil::upperBound(DATA,
+//                                                    DATA + NUM_DATA,
+//                                                    3,
+//                                                    std::less<int>());
+//  assert(DATA + 1 == lower);
+//  assert(DATA + 3 == upper);
+//..
+///Example 2: Building and Searching an Eytzinger Array
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Next, we build an Eytzinger copy of the same array.
+//
+// First, we compute the permutation mapping each Eytzinger position to the
+// corresponding sorted position:
+//..
+//  std::size_t permutation[NUM_DATA];
+//  bslalg::SearchUtil::buildEytzingerPermutation(permutation, NUM_DATA);
+//..
+// Then, we use the permutation to populate the Eytzinger array:
+//..
+//  int eytzinger[NUM_DATA];
+//  for (int i = 0; i < NUM_DATA; ++i) {
+//      eytzinger[i] = DATA[permutation[i]];
+//  }
+//..
+// Finally, we search the Eytzinger array and map the resulting position back
+// to the sorted array:
+//..
+//  std::size_t position = bslalg::SearchUtil::eytzingerLowerBound(
+//                                                           eytzinger,
+//                                                           NUM_DATA,
+//                                                           4,
+//                                                           std::less<int>());
+//  assert(NUM_DATA != position);
+//  assert(3        == permutation[position]);
+//  assert(5        == eytzinger[position]);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                            // =================
+                            // struct SearchUtil
+                            // =================
+
+struct SearchUtil {
+    // This 'struct' provides a namespace for a suite of utility functions
+    // that search for a key in an array of elements laid out either in sorted
+    // order or in Eytzinger order (see the component-level documentation).
+
+  private:
+    // PRIVATE CLASS METHODS
+    static native_std::size_t buildEytzingerPermutationImp(
+                                         native_std::size_t *result,
+                                         native_std::size_t  numElements,
+                                         native_std::size_t  sortedIndex,
+                                         native_std::size_t  eytzingerIndex);
+        // Load, into the subtree of the specified 'result' rooted at the
+        // specified (1-based) 'eytzingerIndex', the sorted indices starting
+        // from the specified 'sortedIndex' for an array having the specified
+        // 'numElements', and return the next unused sorted index.
+
+  public:
+    // TYPES
+    enum {
+        // This enumeration defines the number of levels of the implicit tree
+        // below the current node whose elements are prefetched by
+        // 'eytzingerLowerBound'.
+
+        k_EYTZINGER_PREFETCH_LEVELS = 4
+    };
+
+    // CLASS METHODS
+    template <class VALUE, class KEY, class COMPARATOR>
+    static const VALUE *lowerBound(const VALUE *first,
+                                   const VALUE *last,
+                                   const KEY&   key,
+                                   COMPARATOR   comparator);
+    template <class VALUE, class KEY, class COMPARATOR>
+    static VALUE *lowerBound(VALUE       *first,
+                             VALUE       *last,
+                             const KEY&   key,
+                             COMPARATOR   comparator);
+        // Return the address of the first element in the specified sorted
+        // range '[first, last)' that is not ordered before the specified
+        // 'key' according to the specified 'comparator', or 'last' if no such
+        // element exists.  The behavior is undefined unless '[first, last)' is
+        // a valid range sorted according to 'comparator'.
+
+    template <class VALUE, class KEY, class COMPARATOR>
+    static const VALUE *upperBound(const VALUE *first,
+                                   const VALUE *last,
+                                   const KEY&   key,
+                                   COMPARATOR   comparator);
+    template <class VALUE, class KEY, class COMPARATOR>
+    static VALUE *upperBound(VALUE       *first,
+                             VALUE       *last,
+                             const KEY&   key,
+                             COMPARATOR   comparator);
+        // Return the address of the first element in the specified sorted
+        // range '[first, last)' before which the specified 'key' is ordered
+        // according to the specified 'comparator', or 'last' if no such
+        // element exists.  The behavior is undefined unless '[first, last)' is
+        // a valid range sorted according to 'comparator'.
+
+    static void buildEytzingerPermutation(native_std::size_t *result,
+                                          native_std::size_t  numElements);
+        // Load into each element 'result[i]', for 'i' in the range
+        // '[0, numElements)', the index, within a sorted array having the
+        // specified 'numElements', of the element that occupies position 'i'
+        // of the Eytzinger layout of that array.  The behavior is undefined
+        // unless 'result' refers to an array of at least 'numElements'
+        // elements.
+
+    template <class VALUE, class KEY, class COMPARATOR>
+    static native_std::size_t eytzingerLowerBound(
+                                       const VALUE        *array,
+                                       native_std::size_t  numElements,
+                                       const KEY&          key,
+                                       COMPARATOR          comparator);
+        // Return the position, within the specified 'array' of the specified
+        // 'numElements' laid out in Eytzinger order, of the least element that
+        // is not ordered before the specified 'key' according to the
+        // specified 'comparator', or 'numElements' if no such element exists.
+        // The behavior is undefined unless 'array' holds 'numElements'
+        // elements, sorted according to 'comparator', in Eytzinger order.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -----------------
+                            // struct SearchUtil
+                            // -----------------
+
+// CLASS METHODS
+template <class VALUE, class KEY, class COMPARATOR>
+inline
+const VALUE *SearchUtil::lowerBound(const VALUE *first,
+                                    const VALUE *last,
+                                    const KEY&   key,
+                                    COMPARATOR   comparator)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    native_std::size_t length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    // Invariant: the result is in the closed range '[first, first + length]'.
+
+    while (length > 1) {
+        const native_std::size_t half = length / 2;
+        first   = comparator(first[half], key) ? first + half : first;
+        length -= half;
+    }
+    return first + (comparator(*first, key) ? 1 : 0);
+}
+
+template <class VALUE, class KEY, class COMPARATOR>
+inline
+VALUE *SearchUtil::lowerBound(VALUE      *first,
+                              VALUE      *last,
+                              const KEY&  key,
+                              COMPARATOR  comparator)
+{
+    return const_cast<VALUE *>(lowerBound(const_cast<const VALUE *>(first),
+                                          const_cast<const VALUE *>(last),
+                                          key,
+                                          comparator));
+}
+
+template <class VALUE, class KEY, class COMPARATOR>
+inline
+const VALUE *SearchUtil::upperBound(const VALUE *first,
+                                    const VALUE *last,
+                                    const KEY&   key,
+                                    COMPARATOR   comparator)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    native_std::size_t length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    while (length > 1) {
+        const native_std::size_t half = length / 2;
+        first   = comparator(key, first[half]) ? first : first + half;
+        length -= half;
+    }
+    return first + (comparator(key, *first) ? 0 : 1);
+}
+
+template <class VALUE, class KEY, class COMPARATOR>
+inline
+VALUE *SearchUtil::upperBound(VALUE      *first,
+                              VALUE      *last,
+                              const KEY&  key,
+                              COMPARATOR  comparator)
+{
+    return const_cast<VALUE *>(upperBound(const_cast<const VALUE *>(first),
+                                          const_cast<const VALUE *>(last),
+                                          key,
+                                          comparator));
+}
+
+inline
+void SearchUtil::buildEytzingerPermutation(native_std::size_t *result,
+                                           native_std::size_t  numElements)
+{
+    BSLS_ASSERT_SAFE(result || 0 == numElements);
+
+    buildEytzingerPermutationImp(result, numElements, 0, 1);
+}
+
+template <class VALUE, class KEY, class COMPARATOR>
+native_std::size_t SearchUtil::eytzingerLowerBound(
+                                           const VALUE        *array,
+                                           native_std::size_t  numElements,
+                                           const KEY&          key,
+                                           COMPARATOR          comparator)
+{
+    BSLS_ASSERT_SAFE(array || 0 == numElements);
+
+    static const native_std::size_t k_STRIDE =
+                                    native_std::size_t(1)
+                                        << k_EYTZINGER_PREFETCH_LEVELS;
+
+    // Descend the implicit tree using 1-based positions; each step appends
+    // one bit (1 for "go right") to 'position'.
+
+    native_std::size_t position = 1;
+    while (position <= numElements) {
+        // Prefetching an address beyond the array is harmless, but forming
+        // such an address is not, hence the address arithmetic is performed
+        // on integers.
+
+        const native_std::size_t ahead =
+                               reinterpret_cast<native_std::size_t>(array)
+                                 + (k_STRIDE * position - 1) * sizeof(VALUE);
+        bsls::PerformanceHint::prefetchForReading(
+                                        reinterpret_cast<const void *>(ahead));
+        position = 2 * position + (comparator(array[position - 1], key)
+                                   ? 1
+                                   : 0);
+    }
+
+    // The result is the last node at which the search went left: strip the
+    // trailing right turns (1 bits) and then the final left turn.
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    position >>= __builtin_ctzll(~static_cast<unsigned long long>(position))
+                                                                         + 1;
+#else
+    while (position & 1) {
+        position >>= 1;
+    }
+    position >>= 1;
+#endif
+
+    return 0 == position ? numElements : position - 1;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,597 @@
+// bslalg_searchutil.t.cpp                                            -*-C++-*-
+
+#include <bslalg_searchutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a suite of stateless search functions.
+// Each function is tested against the corresponding standard algorithm (or,
+// for the Eytzinger layout, against a straightforward reference computation)
+// for every key in and around a set of sorted arrays of every length up to a
+// small bound, both with and without duplicate elements.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] const VALUE *lowerBound(const VALUE *, const VALUE *, KEY, COMP);
+// [ 2] VALUE *lowerBound(VALUE *, VALUE *, KEY, COMP);
+// [ 2] const VALUE *upperBound(const VALUE *, const VALUE *, KEY, COMP);
+// [ 2] VALUE *upperBound(VALUE *, VALUE *, KEY, COMP);
+// [ 3] void buildEytzingerPermutation(size_t *, size_t);
+// [ 4] size_t eytzingerLowerBound(const VALUE *, size_t, KEY, COMP);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::SearchUtil Obj;
+
+namespace {
+
+struct ReverseCompare {
+    // This 'struct' provides a comparator that orders integers in descending
+    // order, used to verify that the search functions honor the supplied
+    // comparator.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+void fillSorted(std::vector<int> *result, int length, int step)
+    // Load into the specified 'result' an ascending sequence of the specified
+    // 'length' whose elements are each the index divided by the specified
+    // 'step', multiplied by 2 (so that odd keys fall between elements).
+{
+    result->resize(length);
+    for (int i = 0; i < length; ++i) {
+        (*result)[i] = 2 * (i / step);
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted Array
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we have a sorted array of integers and want to find the first
+// element not less than a given key.
+//
+// First, we define the array:
+//..
+    const int DATA[]   = { 1, 3, 3, 5, 8, 13, 21 };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+//..
+// Then, we search the array with 'lowerBound' and 'upperBound':
+//..
+    const int *lower = bslalg::SearchUtil::lowerBound(DATA,
+                                                      DATA + NUM_DATA,
+                                                      3,
+                                                      std::less<int>());
+    const int *upper = bslalg::SearchUtil::upperBound(DATA,
+                                                      DATA + NUM_DATA,
+                                                      3,
+                                                      std::less<int>());
+    ASSERT(DATA + 1 == lower);
+    ASSERT(DATA + 3 == upper);
+//..
+///Example 2: Building and Searching an Eytzinger Array
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Next, we build an Eytzinger copy of the same array.
+//
+// First, we compute the permutation mapping each Eytzinger position to the
+// corresponding sorted position:
+//..
+    std::size_t permutation[NUM_DATA];
+    bslalg::SearchUtil::buildEytzingerPermutation(permutation, NUM_DATA);
+//..
+// Then, we use the permutation to populate the Eytzinger array:
+//..
+    int eytzinger[NUM_DATA];
+    for (int i = 0; i < NUM_DATA; ++i) {
+        eytzinger[i] = DATA[permutation[i]];
+    }
+//..
+// Finally, we search the Eytzinger array and map the resulting position back
+// to the sorted array:
+//..
+    std::size_t position = bslalg::SearchUtil::eytzingerLowerBound(
+                                                             eytzinger,
+                                                             NUM_DATA,
+                                                             4,
+                                                             std::less<int>());
+    ASSERT(NUM_DATA != position);
+    ASSERT(3        == permutation[position]);
+    ASSERT(5        == eytzinger[position]);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'eytzingerLowerBound'
+        //
+        // Concerns:
+        //: 1 The position returned refers to the Eytzinger element whose
+        //:   sorted index is that of 'std::lower_bound' on the sorted array.
+        //:
+        //: 2 'numElements' is returned if every element is less than the key.
+        //:
+        //: 3 The supplied comparator is honored.
+        //
+        // Plan:
+        //: 1 For arrays of every length up to a bound, with and without
+        //:   duplicates, build the Eytzinger layout using
+        //:   'buildEytzingerPermutation', and compare the result of searching
+        //:   for every key in and around the array, mapped back through the
+        //:   permutation, with 'std::lower_bound'.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for a descending array using 'ReverseCompare'.  (C-3)
+        //
+        // Testing:
+        //   size_t eytzingerLowerBound(const VALUE *, size_t, KEY, COMP);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'eytzingerLowerBound'"
+                            "\n=====================\n");
+
+        for (int step = 1; step <= 3; ++step) {
+            for (int len = 0; len <= 70; ++len) {
+                std::vector<int> sorted;
+                fillSorted(&sorted, len, step);
+
+                std::vector<std::size_t> perm(len + 1);
+                Obj::buildEytzingerPermutation(&perm[0], len);
+
+                std::vector<int> eytz(len + 1);
+                std::vector<int> reverseEytz(len + 1);
+                for (int i = 0; i < len; ++i) {
+                    eytz[i]        = sorted[perm[i]];
+                    reverseEytz[i] = sorted[len - 1 - perm[i]];
+                }
+
+                for (int key = -1; key <= 2 * len + 1; ++key) {
+                    const std::size_t EXP = std::lower_bound(sorted.begin(),
+                                                             sorted.end(),
+                                                             key)
+                                                             - sorted.begin();
+
+                    const std::size_t POS = Obj::eytzingerLowerBound(
+                                                             &eytz[0],
+                                                             len,
+                                                             key,
+                                                             std::less<int>());
+                    const std::size_t RESULT = len == (int)POS
+                                               ? len
+                                               : perm[POS];
+                    ASSERTV(step, len, key, EXP, RESULT, EXP == RESULT);
+
+                    // Descending array: the lower bound of 'key' is preceded
+                    // by exactly the elements greater than 'key'.
+
+                    const std::size_t REXP = len - (std::upper_bound(
+                                                                sorted.begin(),
+                                                                sorted.end(),
+                                                                key)
+                                                             - sorted.begin());
+                    const std::size_t RPOS = Obj::eytzingerLowerBound(
+                                                             &reverseEytz[0],
+                                                             len,
+                                                             key,
+                                                             ReverseCompare());
+                    const std::size_t RRESULT = len == (int)RPOS
+                                                ? len
+                                                : perm[RPOS];
+                    ASSERTV(step, len, key, REXP, RRESULT, REXP == RRESULT);
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'buildEytzingerPermutation'
+        //
+        // Concerns:
+        //: 1 The result is a permutation of '[0, numElements)'.
+        //:
+        //: 2 The result satisfies the search-tree property: the sorted index
+        //:   at position 'k' exceeds every index in the left subtree of 'k'
+        //:   and is exceeded by every index in its right subtree.
+        //:
+        //: 3 A length of 0 is handled, and no element beyond 'numElements' is
+        //:   written.
+        //
+        // Plan:
+        //: 1 For every length up to a bound, build the permutation into a
+        //:   buffer with a sentinel following it, and verify the permutation,
+        //:   the ordering between each node and its children, and the
+        //:   sentinel.  (C-1..3)
+        //
+        // Testing:
+        //   void buildEytzingerPermutation(size_t *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'buildEytzingerPermutation'"
+                            "\n===========================\n");
+
+        const std::size_t SENTINEL = 0xdeadbeef;
+
+        for (std::size_t len = 0; len <= 130; ++len) {
+            std::vector<std::size_t> perm(len + 1, SENTINEL);
+            Obj::buildEytzingerPermutation(&perm[0], len);
+
+            ASSERTV(len, SENTINEL == perm[len]);
+
+            std::vector<bool> seen(len, false);
+            for (std::size_t i = 0; i < len; ++i) {
+                ASSERTV(len, i, perm[i] < len);
+                if (perm[i] < len) {
+                    ASSERTV(len, i, !seen[perm[i]]);
+                    seen[perm[i]] = true;
+                }
+                const std::size_t k = i + 1;
+                if (2 * k <= len) {
+                    ASSERTV(len, i, perm[2 * k - 1] < perm[i]);
+                }
+                if (2 * k + 1 <= len) {
+                    ASSERTV(len, i, perm[2 * k] > perm[i]);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'lowerBound' AND 'upperBound'
+        //
+        // Concerns:
+        //: 1 The results match 'std::lower_bound' and 'std::upper_bound' for
+        //:   every key in, between, before, and after the elements of the
+        //:   array.
+        //:
+        //: 2 Empty ranges and ranges with duplicates are handled.
+        //:
+        //: 3 The supplied comparator is honored.
+        //:
+        //: 4 The 'const' and non-'const' overloads return the same position.
+        //
+        // Plan:
+        //: 1 For arrays of every length up to a bound, with runs of equal
+        //:   elements of several lengths, compare the results of both
+        //:   overloads with those of the standard algorithms.  (C-1..2, 4)
+        //:
+        //: 2 Repeat P-1 for a descending array using 'ReverseCompare'.  (C-3)
+        //
+        // Testing:
+        //   const VALUE *lowerBound(const VALUE *, const VALUE *, KEY, COMP);
+        //   VALUE *lowerBound(VALUE *, VALUE *, KEY, COMP);
+        //   const VALUE *upperBound(const VALUE *, const VALUE *, KEY, COMP);
+        //   VALUE *upperBound(VALUE *, VALUE *, KEY, COMP);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'lowerBound' AND 'upperBound'"
+                            "\n=============================\n");
+
+        for (int step = 1; step <= 4; ++step) {
+            for (int len = 0; len <= 40; ++len) {
+                std::vector<int> sorted;
+                fillSorted(&sorted, len, step);
+                sorted.push_back(0);  // avoid taking '&sorted[0]' of empty
+
+                int       *B  = &sorted[0];
+                int       *E  = B + len;
+                const int *CB = B;
+                const int *CE = E;
+
+                std::vector<int> reversed(sorted.rbegin() + 1, sorted.rend());
+                reversed.push_back(0);
+                const int *RB = &reversed[0];
+                const int *RE = RB + len;
+
+                for (int key = -1; key <= 2 * len + 1; ++key) {
+                    const int *EXP_L = std::lower_bound(CB, CE, key);
+                    const int *EXP_U = std::upper_bound(CB, CE, key);
+
+                    ASSERTV(step, len, key,
+                            EXP_L == Obj::lowerBound(CB, CE, key,
+                                                     std::less<int>()));
+                    ASSERTV(step, len, key,
+                            EXP_L == Obj::lowerBound(B, E, key,
+                                                     std::less<int>()));
+                    ASSERTV(step, len, key,
+                            EXP_U == Obj::upperBound(CB, CE, key,
+                                                     std::less<int>()));
+                    ASSERTV(step, len, key,
+                            EXP_U == Obj::upperBound(B, E, key,
+                                                     std::less<int>()));
+
+                    const int *REXP_L = std::lower_bound(RB, RE, key,
+                                                         ReverseCompare());
+                    const int *REXP_U = std::upper_bound(RB, RE, key,
+                                                         ReverseCompare());
+                    ASSERTV(step, len, key,
+                            REXP_L == Obj::lowerBound(RB, RE, key,
+                                                      ReverseCompare()));
+                    ASSERTV(step, len, key,
+                            REXP_U == Obj::upperBound(RB, RE, key,
+                                                      ReverseCompare()));
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform some ad-hoc searches of a small array.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const int A[] = { 10, 20, 30 };
+        const int N   = 3;
+
+        ASSERT(A     == Obj::lowerBound(A, A + N,  5, std::less<int>()));
+        ASSERT(A     == Obj::lowerBound(A, A + N, 10, std::less<int>()));
+        ASSERT(A + 1 == Obj::upperBound(A, A + N, 10, std::less<int>()));
+        ASSERT(A + 3 == Obj::lowerBound(A, A + N, 31, std::less<int>()));
+        ASSERT(A     == Obj::lowerBound(A, A,     10, std::less<int>()));
+
+        std::size_t perm[N];
+        Obj::buildEytzingerPermutation(perm, N);
+        ASSERT(1 == perm[0]);
+        ASSERT(0 == perm[1]);
+        ASSERT(2 == perm[2]);
+
+        const int EYTZ[] = { 20, 10, 30 };
+        ASSERT(1 == Obj::eytzingerLowerBound(EYTZ, N, 10, std::less<int>()));
+        ASSERT(0 == Obj::eytzingerLowerBound(EYTZ, N, 11, std::less<int>()));
+        ASSERT(2 == Obj::eytzingerLowerBound(EYTZ, N, 25, std::less<int>()));
+        ASSERT(N == Obj::eytzingerLowerBound(EYTZ, N, 31, std::less<int>()));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The branch-free searches are faster than 'std::lower_bound', and
+        //:   the Eytzinger search is faster still for arrays that do not fit
+        //:   in the data cache.
+        //
+        // Plan:
+        //: 1 For arrays of several sizes, time a fixed number of searches for
+        //:   pseudo-random keys using 'std::lower_bound', 'lowerBound', and
+        //:   'eytzingerLowerBound', and report the average time per search.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int NUM_SEARCHES = 1000000;
+
+        const int SIZES[] = { 1 << 6, 1 << 10, 1 << 14, 1 << 18, 1 << 22 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%10s %14s %14s %14s\n",
+               "size", "std (ns)", "branchless", "eytzinger");
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE = SIZES[si];
+
+            std::vector<int> sorted;
+            fillSorted(&sorted, SIZE, 1);
+
+            std::vector<std::size_t> perm(SIZE);
+            Obj::buildEytzingerPermutation(&perm[0], SIZE);
+            std::vector<int> eytz(SIZE);
+            for (int i = 0; i < SIZE; ++i) {
+                eytz[i] = sorted[perm[i]];
+            }
+
+            std::vector<int> keys(NUM_SEARCHES);
+            unsigned int seed = 12345;
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                seed = seed * 1103515245 + 12345;
+                keys[i] = (int)((seed >> 8) % (2u * SIZE));
+            }
+
+            const int *B = &sorted[0];
+            const int *E = B + SIZE;
+
+            std::size_t checksum[3] = { 0, 0, 0 };
+            double      elapsed[3];
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                checksum[0] += std::lower_bound(B, E, keys[i]) - B;
+            }
+            timer.stop();
+            elapsed[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                checksum[1] += Obj::lowerBound(B, E, keys[i],
+                                               std::less<int>()) - B;
+            }
+            timer.stop();
+            elapsed[1] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                const std::size_t pos = Obj::eytzingerLowerBound(
+                                                             &eytz[0],
+                                                             SIZE,
+                                                             keys[i],
+                                                             std::less<int>());
+                checksum[2] += SIZE == (int)pos ? SIZE : perm[pos];
+            }
+            timer.stop();
+            elapsed[2] = timer.elapsedTime();
+
+            ASSERTV(SIZE, checksum[0] == checksum[1]);
+            ASSERTV(SIZE, checksum[0] == checksum[2]);
+
+            printf("%10d %14.2f %14.2f %14.2f\n",
+                   SIZE,
+                   elapsed[0] * 1e9 / NUM_SEARCHES,
+                   elapsed[1] * 1e9 / NUM_SEARCHES,
+                   elapsed[2] * 1e9 / NUM_SEARCHES);
+        }
+
+        (void)veryVerbose;
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
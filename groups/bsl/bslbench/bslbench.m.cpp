@@ -0,0 +1,1052 @@
+// bslbench.m.cpp                                                     -*-C++-*-
+
+//@PURPOSE: Run the microbenchmarks of the 'bsl' containers.
+//
+//@SEE_ALSO: bslbench_runner, bslbench_allocatorsweep
+//
+//@DESCRIPTION: This program measures common operations on the 'bsl'
+// containers ('bsl::vector', 'bsl::deque', 'bsl::list', 'bsl::map',
+// 'bsl::unordered_map', which is implemented by 'bslstl::HashTable', and
+// 'bsl::string') and the 'bsl::hash' functors using 'bslbench::Runner', and
+// prints the results to the standard output.  Its command line is:
+//..
+//  bslbench.m [-a] [-f table|csv|json] [-r repetitions] [-w warmups]
+//             [-t milliseconds] [filter]
+//..
+// where '-a' runs the allocator sweep described below instead of the
+// container benchmarks, '-f' selects the output format (an aligned table by
+// default), '-r' and '-w' set the numbers of timed and untimed repetitions,
+// '-t' sets the minimum duration of a repetition, and 'filter', if given,
+// runs only the benchmarks whose name contains it (e.g., "unordered_map").
+//
+// Benchmark names have the form "<container>/<operation>/<size>", and each
+// result is the time of one whole operation on 'size' elements (e.g.,
+// building a container of 'size' elements, or 'size' lookups).  To compare
+// two builds, save the output of each in CSV or JSON format and run:
+//..
+//  python tools/bslbench_compare.py before.csv after.csv
+//..
+// The allocator sweep runs the default workloads of
+// 'bslbench::AllocatorSweep' against 'bslma::NewDeleteAllocator' and
+// 'bslma::MallocFreeAllocator', and reports the time, throughput, peak
+// memory, and fragmentation of each allocator on each workload.  The
+// 'bdlma' allocators are measured on the same workloads by the 'bdlma.m'
+// program of the 'bdl' package group.
+//
+// The benchmarks of 'bslstl::ParallelAlgorithmUtil' are named
+// "parallel/<algorithm>/<size>/threads:<n>", and run each algorithm on the
+// same input under policies of 1, 2, 4, ... threads up to the number of
+// hardware threads, so that the scaling of each algorithm can be read off
+// the consecutive results (e.g., with the filter "parallel/sort/").
+//
+// Note that the program must be built in an optimized build mode for the
+// results to be meaningful.
+
+#include <bslbench_allocatorsweep.h>
+#include <bslbench_runner.h>
+
+#include <bslstl_deque.h>
+#include <bslstl_hash.h>
+#include <bslstl_list.h>
+#include <bslstl_map.h>
+#include <bslstl_pair.h>
+#include <bslstl_parallelalgorithm.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmap.h>
+#include <bslstl_vector.h>
+
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_parallelutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef bslbench::Runner Runner;
+
+                            // ======================
+                            // struct BenchmarkConfig
+                            // ======================
+
+struct BenchmarkConfig {
+    // This 'struct' holds the data shared by the benchmarks of one size:
+    // 'd_size' distinct pseudo-random keys in 'd_keys', other keys that are
+    // not in 'd_keys' in 'd_missingKeys', and a string key for each key.
+
+    int                      d_size;
+    bsl::vector<int>         d_keys;
+    bsl::vector<int>         d_missingKeys;
+    bsl::vector<bsl::string> d_stringKeys;
+};
+
+void loadConfig(BenchmarkConfig *config, int size)
+    // Load into the specified 'config' the data for the specified 'size'.
+{
+    config->d_size = size;
+    config->d_keys.clear();
+    config->d_missingKeys.clear();
+    config->d_stringKeys.clear();
+
+    // Multiplication by an odd number is a bijection modulo 2^32, so the
+    // keys, scrambled from the indices '[0, size)', are distinct, and differ
+    // from the missing keys, scrambled from the indices '[size, 2 * size)'.
+
+    const unsigned int  multiplier = 2654435761u;
+    bsls::Types::Uint64 state      = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < size; ++i) {
+        const unsigned int key = static_cast<unsigned int>(i) * multiplier;
+        const unsigned int missingKey =
+                             static_cast<unsigned int>(size + i) * multiplier;
+        config->d_keys.push_back(static_cast<int>(key));
+        config->d_missingKeys.push_back(static_cast<int>(missingKey));
+
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        char buffer[64];
+        snprintf(buffer,
+                 sizeof buffer,
+                 "instrument.%08x.%llu",
+                 key,
+                 static_cast<unsigned long long>(state >> 40));
+        config->d_stringKeys.push_back(buffer);
+    }
+}
+
+                        // -----------------------------
+                        // sequence container benchmarks
+                        // -----------------------------
+
+template <class CONTAINER>
+void pushBack(int numIterations, void *context)
+    // Build a 'CONTAINER' of the configured size by 'push_back', the
+    // specified 'numIterations' times, using the 'BenchmarkConfig' at the
+    // specified 'context'.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        CONTAINER container;
+        for (int j = 0; j < config.d_size; ++j) {
+            container.push_back(config.d_keys[j]);
+        }
+        Runner::doNotOptimize(&container);
+    }
+}
+
+void reservePushBackVector(int numIterations, void *context)
+    // Build a 'bsl::vector<int>' of the configured size by 'reserve' and
+    // 'push_back', the specified 'numIterations' times, using the
+    // 'BenchmarkConfig' at the specified 'context'.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::vector<int> container;
+        container.reserve(config.d_size);
+        for (int j = 0; j < config.d_size; ++j) {
+            container.push_back(config.d_keys[j]);
+        }
+        Runner::doNotOptimize(&container);
+    }
+}
+
+void pushBackStringVector(int numIterations, void *context)
+    // Build a 'bsl::vector<bsl::string>' of the configured size, the
+    // specified 'numIterations' times, using the 'BenchmarkConfig' at the
+    // specified 'context'.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::vector<bsl::string> container;
+        for (int j = 0; j < config.d_size; ++j) {
+            container.push_back(config.d_stringKeys[j]);
+        }
+        Runner::doNotOptimize(&container);
+    }
+}
+
+void pushBackPairVector(int numIterations, void *context)
+    // Build a 'bsl::vector<bsl::pair<bsl::string, int> >' of the configured
+    // size, the specified 'numIterations' times, using the 'BenchmarkConfig'
+    // at the specified 'context'.
+{
+    typedef bsl::pair<bsl::string, int> Pair;
+
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::vector<Pair> container;
+        for (int j = 0; j < config.d_size; ++j) {
+            container.push_back(Pair(config.d_stringKeys[j], j));
+        }
+        Runner::doNotOptimize(&container);
+    }
+}
+
+template <class VALUE_TYPE>
+void resizeVector(int numIterations, void *context)
+    // Grow an empty 'bsl::vector<VALUE_TYPE>' to the configured size by a
+    // single 'resize', the specified 'numIterations' times, using the
+    // 'BenchmarkConfig' at the specified 'context'.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::vector<VALUE_TYPE> container;
+        container.resize(config.d_size);
+        Runner::doNotOptimize(&container);
+    }
+}
+
+void iterateVector(int numIterations, void *context)
+    // Sum the elements of the vector of keys of the 'BenchmarkConfig' at the
+    // specified 'context', the specified 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        unsigned int sum = 0;
+        for (bsl::vector<int>::const_iterator it = config.d_keys.begin();
+             it != config.d_keys.end();
+             ++it) {
+            sum += static_cast<unsigned int>(*it);
+        }
+        Runner::doNotOptimize(&sum);
+    }
+}
+
+void queueDeque(int numIterations, void *context)
+    // Push each key of the 'BenchmarkConfig' at the specified 'context' to
+    // the back of a 'bsl::deque<int>' holding 64 elements and pop one from
+    // the front, the specified 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::deque<int> queue(64, 0);
+        for (int j = 0; j < config.d_size; ++j) {
+            queue.push_back(config.d_keys[j]);
+            queue.pop_front();
+        }
+        Runner::doNotOptimize(&queue);
+    }
+}
+
+template <class VALUE_TYPE>
+struct FillContext {
+    // This 'struct' holds the parameters of a benchmark building a large
+    // vector of copies of one value: the number of elements, the value, and
+    // the policy passed to the constructor and to 'clear'.
+
+    int                  d_size;
+    VALUE_TYPE           d_value;
+    bsls::ParallelPolicy d_policy;
+};
+
+template <class VALUE_TYPE>
+void fillVector(int numIterations, void *context)
+    // Build a 'bsl::vector<VALUE_TYPE>' of copies of the value of the
+    // 'FillContext<VALUE_TYPE>' at the specified 'context' and 'clear' it,
+    // under the policy of that context, the specified 'numIterations' times.
+{
+    const FillContext<VALUE_TYPE>& fill =
+                              *static_cast<FillContext<VALUE_TYPE> *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::vector<VALUE_TYPE> container(fill.d_size,
+                                          fill.d_value,
+                                          fill.d_policy);
+        Runner::doNotOptimize(&container);
+        container.clear(fill.d_policy);
+    }
+}
+
+template <class VALUE_TYPE>
+struct CompareContext {
+    // This 'struct' holds two vectors made from the keys of a
+    // 'BenchmarkConfig' that differ only in their last elements, so that
+    // comparing them visits every element.
+
+    bsl::vector<VALUE_TYPE> d_lhs;
+    bsl::vector<VALUE_TYPE> d_rhs;
+
+    explicit CompareContext(const BenchmarkConfig& config)
+        // Create the vectors from the keys of the specified 'config'.
+    {
+        for (int i = 0; i < config.d_size; ++i) {
+            d_lhs.push_back(static_cast<VALUE_TYPE>(config.d_keys[i]));
+        }
+        d_rhs = d_lhs;
+        d_rhs.back() = d_rhs.back() + 1;
+    }
+};
+
+template <class VALUE_TYPE>
+void equalVector(int numIterations, void *context)
+    // Compare the vectors of the 'CompareContext<VALUE_TYPE>' at the
+    // specified 'context' with 'operator==', the specified 'numIterations'
+    // times.
+{
+    const CompareContext<VALUE_TYPE>& vectors =
+                           *static_cast<CompareContext<VALUE_TYPE> *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bool result = vectors.d_lhs == vectors.d_rhs;
+        Runner::doNotOptimize(&result);
+    }
+}
+
+template <class VALUE_TYPE>
+void lessVector(int numIterations, void *context)
+    // Compare the vectors of the 'CompareContext<VALUE_TYPE>' at the
+    // specified 'context' with 'operator<', the specified 'numIterations'
+    // times.
+{
+    const CompareContext<VALUE_TYPE>& vectors =
+                           *static_cast<CompareContext<VALUE_TYPE> *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bool result = vectors.d_lhs < vectors.d_rhs;
+        Runner::doNotOptimize(&result);
+    }
+}
+
+                        // --------------------------------
+                        // associative container benchmarks
+                        // --------------------------------
+
+template <class MAP>
+void insertMap(int numIterations, void *context)
+    // Build a 'MAP' from 'int' to 'int' holding each key of the
+    // 'BenchmarkConfig' at the specified 'context', the specified
+    // 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        MAP map;
+        for (int j = 0; j < config.d_size; ++j) {
+            map.insert(typename MAP::value_type(config.d_keys[j], j));
+        }
+        Runner::doNotOptimize(&map);
+    }
+}
+
+void subscriptMap(int numIterations, void *context)
+    // Build a 'bsl::map<int, int>' holding each key of the 'BenchmarkConfig'
+    // at the specified 'context' by 'operator[]', the specified
+    // 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::map<int, int> map;
+        for (int j = 0; j < config.d_size; ++j) {
+            map[config.d_keys[j]] = j;
+        }
+        Runner::doNotOptimize(&map);
+    }
+}
+
+void subscriptStringMap(int numIterations, void *context)
+    // Build a 'bsl::map<bsl::string, int>' holding each string key of the
+    // 'BenchmarkConfig' at the specified 'context' by 'operator[]', the
+    // specified 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::map<bsl::string, int> map;
+        for (int j = 0; j < config.d_size; ++j) {
+            map[config.d_stringKeys[j]] = j;
+        }
+        Runner::doNotOptimize(&map);
+    }
+}
+
+enum MapInsertMethod {
+    // This enumeration lists the ways of adding an element to a map measured
+    // by 'buildStringVectorMap'.
+
+    e_INSERT,       // 'insert' of a 'value_type' temporary
+    e_EMPLACE,      // 'emplace' of the key and mapped value
+    e_TRY_EMPLACE   // 'try_emplace' of the key and mapped value
+};
+
+struct StringVectorMapContext {
+    // This 'struct' holds the string keys of a 'BenchmarkConfig', the vector
+    // to map each of them to, and the number of times to add each key.
+
+    const BenchmarkConfig *d_config_p;
+    bsl::vector<int>       d_value;
+    int                    d_numPasses;
+};
+
+template <MapInsertMethod METHOD>
+void buildStringVectorMap(int numIterations, void *context)
+    // Build a 'bsl::map<bsl::string, bsl::vector<int> >' mapping each string
+    // key of the 'StringVectorMapContext' at the specified 'context' to its
+    // vector, adding each key as many times as the number of passes of the
+    // context by the (template parameter) 'METHOD', the specified
+    // 'numIterations' times.  Note that every pass after the first adds only
+    // keys that are already in the map.
+{
+    typedef bsl::map<bsl::string, bsl::vector<int> > Map;
+
+    const StringVectorMapContext& build =
+                               *static_cast<StringVectorMapContext *>(context);
+    const bsl::vector<bsl::string>& keys  = build.d_config_p->d_stringKeys;
+    const bsl::vector<int>&         value = build.d_value;
+
+    const int size = static_cast<int>(keys.size());
+    for (int i = 0; i < numIterations; ++i) {
+        Map map;
+        for (int pass = 0; pass < build.d_numPasses; ++pass) {
+            for (int j = 0; j < size; ++j) {
+                switch (METHOD) {
+                  case e_INSERT: {
+                    map.insert(Map::value_type(keys[j], value));
+                  } break;
+                  case e_EMPLACE: {
+                    map.emplace(keys[j], value);
+                  } break;
+                  case e_TRY_EMPLACE: {
+                    map.try_emplace(keys[j], value);
+                  } break;
+                }
+            }
+        }
+        Runner::doNotOptimize(&map);
+    }
+}
+
+void insertReservedUnorderedMap(int numIterations, void *context)
+    // Build a 'bsl::unordered_map<int, int>' holding each key of the
+    // 'BenchmarkConfig' at the specified 'context', having first reserved
+    // space for them, the specified 'numIterations' times.
+{
+    typedef bsl::unordered_map<int, int> Map;
+
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        Map map;
+        map.reserve(config.d_size);
+        for (int j = 0; j < config.d_size; ++j) {
+            map.insert(Map::value_type(config.d_keys[j], j));
+        }
+        Runner::doNotOptimize(&map);
+    }
+}
+
+template <class MAP>
+struct LookupContext {
+    // This 'struct' holds a map built from the keys of a 'BenchmarkConfig',
+    // and the keys to look up in it.
+
+    const MAP              *d_map_p;
+    const bsl::vector<int> *d_keys_p;
+};
+
+template <class MAP>
+void findMap(int numIterations, void *context)
+    // Look up each key of the 'LookupContext<MAP>' at the specified 'context'
+    // in its map, the specified 'numIterations' times.
+{
+    const LookupContext<MAP>& lookup =
+                                   *static_cast<LookupContext<MAP> *>(context);
+    const MAP&              map  = *lookup.d_map_p;
+    const bsl::vector<int>& keys = *lookup.d_keys_p;
+
+    const int size = static_cast<int>(keys.size());
+    for (int i = 0; i < numIterations; ++i) {
+        int found = 0;
+        for (int j = 0; j < size; ++j) {
+            found += map.find(keys[j]) != map.end();
+        }
+        Runner::doNotOptimize(&found);
+    }
+}
+
+void eraseUnorderedMap(int numIterations, void *context)
+    // Build a 'bsl::unordered_map<int, int>' holding each key of the
+    // 'BenchmarkConfig' at the specified 'context', then erase each key, the
+    // specified 'numIterations' times.
+{
+    typedef bsl::unordered_map<int, int> Map;
+
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        Map map;
+        for (int j = 0; j < config.d_size; ++j) {
+            map.insert(Map::value_type(config.d_keys[j], j));
+        }
+        for (int j = 0; j < config.d_size; ++j) {
+            map.erase(config.d_keys[j]);
+        }
+        Runner::doNotOptimize(&map);
+    }
+}
+
+struct StringLookupContext {
+    // This 'struct' holds a map from string keys, and the keys to look up.
+
+    const bsl::unordered_map<bsl::string, int> *d_map_p;
+    const bsl::vector<bsl::string>             *d_keys_p;
+};
+
+void findStringUnorderedMap(int numIterations, void *context)
+    // Look up each key of the 'StringLookupContext' at the specified
+    // 'context' in its map, the specified 'numIterations' times.
+{
+    const StringLookupContext& lookup =
+                                  *static_cast<StringLookupContext *>(context);
+
+    const int size = static_cast<int>(lookup.d_keys_p->size());
+    for (int i = 0; i < numIterations; ++i) {
+        int found = 0;
+        for (int j = 0; j < size; ++j) {
+            found += lookup.d_map_p->find((*lookup.d_keys_p)[j])
+                                                      != lookup.d_map_p->end();
+        }
+        Runner::doNotOptimize(&found);
+    }
+}
+
+                        // ------------------------
+                        // hash function benchmarks
+                        // ------------------------
+
+template <class KEY>
+void hashKeys(int numIterations, void *context)
+    // Hash each key of the 'BenchmarkConfig' at the specified 'context',
+    // converted to the (template parameter) type 'KEY', by 'bsl::hash<KEY>',
+    // the specified 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    const bsl::hash<KEY>   hasher = bsl::hash<KEY>();
+    for (int i = 0; i < numIterations; ++i) {
+        native_std::size_t sum = 0;
+        for (int j = 0; j < config.d_size; ++j) {
+            sum += hasher(static_cast<KEY>(config.d_keys[j]));
+        }
+        Runner::doNotOptimize(&sum);
+    }
+}
+
+void hashAddresses(int numIterations, void *context)
+    // Hash the address of each key of the 'BenchmarkConfig' at the specified
+    // 'context' by 'bsl::hash<const int *>', the specified 'numIterations'
+    // times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    const bsl::hash<const int *> hasher = bsl::hash<const int *>();
+    for (int i = 0; i < numIterations; ++i) {
+        native_std::size_t sum = 0;
+        for (int j = 0; j < config.d_size; ++j) {
+            sum += hasher(&config.d_keys[j]);
+        }
+        Runner::doNotOptimize(&sum);
+    }
+}
+
+                        // -----------------
+                        // string benchmarks
+                        // -----------------
+
+void copyStrings(int numIterations, void *context)
+    // Copy-construct each string key of the 'BenchmarkConfig' at the
+    // specified 'context', the specified 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        for (int j = 0; j < config.d_size; ++j) {
+            bsl::string copy(config.d_stringKeys[j]);
+            Runner::doNotOptimize(&copy);
+        }
+    }
+}
+
+void copyShortStrings(int numIterations, void *context)
+    // Construct a short string, fitting in the small-string buffer, from
+    // each string key of the 'BenchmarkConfig' at the specified 'context',
+    // the specified 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        for (int j = 0; j < config.d_size; ++j) {
+            bsl::string copy(config.d_stringKeys[j], 0, 8);
+            Runner::doNotOptimize(&copy);
+        }
+    }
+}
+
+void appendString(int numIterations, void *context)
+    // Build a string by appending each string key of the 'BenchmarkConfig'
+    // at the specified 'context', the specified 'numIterations' times.
+{
+    const BenchmarkConfig& config = *static_cast<BenchmarkConfig *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::string result;
+        for (int j = 0; j < config.d_size; ++j) {
+            result.append(config.d_stringKeys[j]);
+            result.push_back(',');
+        }
+        Runner::doNotOptimize(&result);
+    }
+}
+
+                        // ------------------------------
+                        // parallel algorithm benchmarks
+                        // ------------------------------
+
+struct ParallelContext {
+    // This 'struct' holds the input of the benchmarks of
+    // 'bslstl::ParallelAlgorithmUtil', a vector to copy it into before each
+    // run of a mutating algorithm, and the policy under which to run.
+
+    const bsl::vector<int> *d_input_p;
+    bsl::vector<int>        d_work;
+    bsls::ParallelPolicy    d_policy;
+};
+
+void parallelSort(int numIterations, void *context)
+    // Copy the input of the 'ParallelContext' at the specified 'context' and
+    // sort the copy under the policy of that context, the specified
+    // 'numIterations' times.
+{
+    ParallelContext& parallel = *static_cast<ParallelContext *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        parallel.d_work = *parallel.d_input_p;
+        bslstl::ParallelAlgorithmUtil::sort(parallel.d_policy,
+                                            parallel.d_work.begin(),
+                                            parallel.d_work.end());
+        Runner::doNotOptimize(&parallel.d_work);
+    }
+}
+
+void parallelStableSort(int numIterations, void *context)
+    // Copy the input of the 'ParallelContext' at the specified 'context' and
+    // stably sort the copy under the policy of that context, the specified
+    // 'numIterations' times.
+{
+    ParallelContext& parallel = *static_cast<ParallelContext *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        parallel.d_work = *parallel.d_input_p;
+        bslstl::ParallelAlgorithmUtil::stable_sort(parallel.d_policy,
+                                                   parallel.d_work.begin(),
+                                                   parallel.d_work.end());
+        Runner::doNotOptimize(&parallel.d_work);
+    }
+}
+
+void parallelReduce(int numIterations, void *context)
+    // Sum the input of the 'ParallelContext' at the specified 'context'
+    // under the policy of that context, the specified 'numIterations' times.
+{
+    ParallelContext& parallel = *static_cast<ParallelContext *>(context);
+    for (int i = 0; i < numIterations; ++i) {
+        bsls::Types::Int64 sum = bslstl::ParallelAlgorithmUtil::reduce(
+                                                   parallel.d_policy,
+                                                   parallel.d_input_p->begin(),
+                                                   parallel.d_input_p->end(),
+                                                   bsls::Types::Int64(0));
+        Runner::doNotOptimize(&sum);
+    }
+}
+
+void parallelInclusiveScan(int numIterations, void *context)
+    // Write the prefix sums of the input of the 'ParallelContext' at the
+    // specified 'context' to its work vector under the policy of that
+    // context, the specified 'numIterations' times.
+{
+    ParallelContext& parallel = *static_cast<ParallelContext *>(context);
+    parallel.d_work.resize(parallel.d_input_p->size());
+    for (int i = 0; i < numIterations; ++i) {
+        bslstl::ParallelAlgorithmUtil::inclusive_scan(
+                                                   parallel.d_policy,
+                                                   parallel.d_input_p->begin(),
+                                                   parallel.d_input_p->end(),
+                                                   parallel.d_work.begin());
+        Runner::doNotOptimize(&parallel.d_work);
+    }
+}
+
+void runParallelAlgorithmBenchmarks(Runner                  *runner,
+                                    bsl::deque<bsl::string> *names,
+                                    int                      size)
+    // Run the benchmarks of 'bslstl::ParallelAlgorithmUtil' on the specified
+    // 'size' pseudo-random keys with the specified 'runner', under policies
+    // of 1, 2, 4, ... threads up to the number of hardware threads, appending
+    // the benchmark names, which must outlive the results of 'runner', to the
+    // specified 'names'.  The keys are built only if one of the benchmarks
+    // passes the filter of 'runner'.
+{
+    struct Algorithm {
+        const char                *d_name_p;
+        Runner::BenchmarkFunction  d_function;
+    };
+
+    static const Algorithm ALGORITHMS[] = {
+        { "sort",           &parallelSort          },
+        { "stable_sort",    &parallelStableSort    },
+        { "reduce",         &parallelReduce        },
+        { "inclusive_scan", &parallelInclusiveScan }
+    };
+    const int NUM_ALGORITHMS = sizeof ALGORITHMS / sizeof *ALGORITHMS;
+
+    const int maxThreads = bsls::ParallelUtil::numHardwareThreads();
+
+    bsl::vector<int> keys;
+    for (int i = 0; i < NUM_ALGORITHMS; ++i) {
+        for (int threads = 1; ; threads *= 2) {
+            if (threads > maxThreads) {
+                threads = maxThreads;
+            }
+
+            char buffer[128];
+            snprintf(buffer,
+                     sizeof buffer,
+                     "parallel/%s/%d/threads:%d",
+                     ALGORITHMS[i].d_name_p,
+                     size,
+                     threads);
+
+            if (runner->matchesFilter(buffer)) {
+                if (keys.empty()) {
+                    const unsigned int multiplier = 2654435761u;
+                    for (int j = 0; j < size; ++j) {
+                        const unsigned int key =
+                                     static_cast<unsigned int>(j) * multiplier;
+                        keys.push_back(static_cast<int>(key));
+                    }
+                }
+
+                names->push_back(buffer);
+
+                ParallelContext context = { &keys,
+                                            bsl::vector<int>(),
+                                            bsls::ParallelPolicy(threads) };
+                runner->run(names->back().c_str(),
+                            ALGORITHMS[i].d_function,
+                            &context);
+            }
+
+            if (threads == maxThreads) {
+                break;                                                 // BREAK
+            }
+        }
+    }
+}
+
+                        // ------
+                        // driver
+                        // ------
+
+void runBenchmarks(Runner *runner, bsl::deque<bsl::string> *names)
+    // Run every benchmark with the specified 'runner', appending the names
+    // that are built at run time, which must outlive the results of
+    // 'runner', to the specified 'names'.
+{
+    typedef bsl::vector<int>             Vector;
+    typedef bsl::list<int>               List;
+    typedef bsl::map<int, int>           Map;
+    typedef bsl::unordered_map<int, int> UnorderedMap;
+
+    BenchmarkConfig small;
+    BenchmarkConfig large;
+    loadConfig(&small, 1000);
+    loadConfig(&large, 100000);
+
+    runner->run("vector<int>/push_back/1000", &pushBack<Vector>, &small);
+    runner->run("vector<int>/push_back/100000", &pushBack<Vector>, &large);
+    runner->run("vector<int>/reserve+push_back/1000",
+                &reservePushBackVector,
+                &small);
+    runner->run("vector<int>/iterate/100000", &iterateVector, &large);
+    runner->run("vector<string>/push_back/1000",
+                &pushBackStringVector,
+                &small);
+    runner->run("vector<pair<string,int>>/push_back/1000",
+                &pushBackPairVector,
+                &small);
+    runner->run("vector<int>/resize/100000", &resizeVector<int>, &large);
+    runner->run("vector<string>/resize/100000",
+                &resizeVector<bsl::string>,
+                &large);
+
+    // Building and destroying large vectors, serially and under a policy
+    // using every hardware thread.
+
+    const bsl::string longString("a string too long for the short buffer");
+    const bsls::ParallelPolicy serial(bsls::ParallelPolicy::serial());
+    const bsls::ParallelPolicy parallel;
+
+    FillContext<int> intFill         = { 10000000, 1, serial };
+    FillContext<int> parallelIntFill = { 10000000, 1, parallel };
+
+    FillContext<bsl::string> stringFill = { large.d_size, longString, serial };
+    FillContext<bsl::string> parallelStringFill = {
+                                          large.d_size, longString, parallel };
+
+    runner->run("vector<int>/fill+clear/10000000",
+                &fillVector<int>,
+                &intFill);
+    runner->run("vector<int>/fill+clear-parallel/10000000",
+                &fillVector<int>,
+                &parallelIntFill);
+    runner->run("vector<string>/fill+clear/100000",
+                &fillVector<bsl::string>,
+                &stringFill);
+    runner->run("vector<string>/fill+clear-parallel/100000",
+                &fillVector<bsl::string>,
+                &parallelStringFill);
+
+    CompareContext<int>    intVectors(small);
+    CompareContext<double> doubleVectors(small);
+    runner->run("vector<int>/equal/1000", &equalVector<int>, &intVectors);
+    runner->run("vector<int>/less/1000", &lessVector<int>, &intVectors);
+    runner->run("vector<double>/equal/1000",
+                &equalVector<double>,
+                &doubleVectors);
+    runner->run("vector<double>/less/1000",
+                &lessVector<double>,
+                &doubleVectors);
+
+    runner->run("deque<int>/push_back+pop_front/1000", &queueDeque, &small);
+    runner->run("list<int>/push_back/1000", &pushBack<List>, &small);
+
+    runner->run("map<int,int>/insert/1000", &insertMap<Map>, &small);
+    runner->run("map<int,int>/operator[]/1000", &subscriptMap, &small);
+    runner->run("map<string,int>/operator[]/1000",
+                &subscriptStringMap,
+                &small);
+
+    // Building a map whose elements own memory, adding each key once, and a
+    // second time after the map holds it.
+
+    StringVectorMapContext buildOnce  = { &small, Vector(8, 1), 1 };
+    StringVectorMapContext buildTwice = { &small, Vector(8, 1), 2 };
+    runner->run("map<string,vector<int>>/insert/1000",
+                &buildStringVectorMap<e_INSERT>,
+                &buildOnce);
+    runner->run("map<string,vector<int>>/emplace/1000",
+                &buildStringVectorMap<e_EMPLACE>,
+                &buildOnce);
+    runner->run("map<string,vector<int>>/try_emplace/1000",
+                &buildStringVectorMap<e_TRY_EMPLACE>,
+                &buildOnce);
+    runner->run("map<string,vector<int>>/insert-twice/1000",
+                &buildStringVectorMap<e_INSERT>,
+                &buildTwice);
+    runner->run("map<string,vector<int>>/emplace-twice/1000",
+                &buildStringVectorMap<e_EMPLACE>,
+                &buildTwice);
+    runner->run("map<string,vector<int>>/try_emplace-twice/1000",
+                &buildStringVectorMap<e_TRY_EMPLACE>,
+                &buildTwice);
+
+    runner->run("unordered_map<int,int>/insert/1000",
+                &insertMap<UnorderedMap>,
+                &small);
+    runner->run("unordered_map<int,int>/insert/100000",
+                &insertMap<UnorderedMap>,
+                &large);
+    runner->run("unordered_map<int,int>/reserve+insert/1000",
+                &insertReservedUnorderedMap,
+                &small);
+    runner->run("unordered_map<int,int>/insert+erase/1000",
+                &eraseUnorderedMap,
+                &small);
+
+    // Lookups in prebuilt maps, which are built only if a lookup benchmark
+    // passes the filter.
+
+    if (runner->matchesFilter("map<int,int>/find")
+     || runner->matchesFilter("unordered_map<int,int>/find")) {
+        Map          map;
+        UnorderedMap unorderedMap;
+        UnorderedMap largeUnorderedMap;
+        for (int i = 0; i < small.d_size; ++i) {
+            map.insert(Map::value_type(small.d_keys[i], i));
+            unorderedMap.insert(UnorderedMap::value_type(small.d_keys[i], i));
+        }
+        for (int i = 0; i < large.d_size; ++i) {
+            largeUnorderedMap.insert(
+                               UnorderedMap::value_type(large.d_keys[i], i));
+        }
+
+        LookupContext<Map> mapHit = { &map, &small.d_keys };
+        runner->run("map<int,int>/find-hit/1000", &findMap<Map>, &mapHit);
+
+        LookupContext<UnorderedMap> hit = { &unorderedMap, &small.d_keys };
+        LookupContext<UnorderedMap> miss = {
+                                         &unorderedMap, &small.d_missingKeys };
+        LookupContext<UnorderedMap> largeHit = {
+                                          &largeUnorderedMap, &large.d_keys };
+        runner->run("unordered_map<int,int>/find-hit/1000",
+                    &findMap<UnorderedMap>,
+                    &hit);
+        runner->run("unordered_map<int,int>/find-miss/1000",
+                    &findMap<UnorderedMap>,
+                    &miss);
+        runner->run("unordered_map<int,int>/find-hit/100000",
+                    &findMap<UnorderedMap>,
+                    &largeHit);
+    }
+
+    if (runner->matchesFilter("unordered_map<string,int>/find")) {
+        bsl::unordered_map<bsl::string, int> stringMap;
+        for (int i = 0; i < small.d_size; ++i) {
+            stringMap[small.d_stringKeys[i]] = i;
+        }
+
+        StringLookupContext lookup = { &stringMap, &small.d_stringKeys };
+        runner->run("unordered_map<string,int>/find-hit/1000",
+                    &findStringUnorderedMap,
+                    &lookup);
+    }
+
+    runner->run("hash<int>/1000", &hashKeys<int>, &small);
+    runner->run("hash<long long>/1000", &hashKeys<long long>, &small);
+    runner->run("hash<const int*>/1000", &hashAddresses, &small);
+
+    runner->run("string/copy-long/1000", &copyStrings, &small);
+    runner->run("string/copy-short/1000", &copyShortStrings, &small);
+    runner->run("string/append/1000", &appendString, &small);
+
+    runParallelAlgorithmBenchmarks(runner, names, 1000000);
+}
+
+void runAllocatorSweep(Runner *runner, Runner::Format format)
+    // Run the default workloads of 'bslbench::AllocatorSweep' against the
+    // 'bslma' allocators with the specified 'runner', and print the results
+    // in the specified 'format'.
+{
+    bslbench::SharedAllocatorFactory newDelete(
+                                     &bslma::NewDeleteAllocator::singleton());
+    bslbench::SharedAllocatorFactory mallocFree(
+                                    &bslma::MallocFreeAllocator::singleton());
+
+    bslbench::AllocatorSweep sweep;
+    sweep.addAllocator("newdelete", &newDelete);
+    sweep.addAllocator("mallocfree", &mallocFree);
+    sweep.addDefaultWorkloads();
+
+    sweep.run(runner);
+    sweep.print(stdout, format);
+}
+
+void printUsage(const char *program)
+    // Write the command-line usage of the specified 'program' to the
+    // standard error.
+{
+    fprintf(stderr,
+            "usage: %s [-a] [-f table|csv|json] [-r repetitions]"
+            " [-w warmups]\n"
+            "          [-t milliseconds] [filter]\n",
+            program);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Runner         runner;
+    Runner::Format format         = Runner::BSLBENCH_TABLE;
+    bool           allocatorSweep = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if ('-' != arg[0]) {
+            runner.setFilter(arg);
+            continue;                                               // CONTINUE
+        }
+        if (0 == strcmp(arg, "-a")) {
+            allocatorSweep = true;
+            continue;                                               // CONTINUE
+        }
+        if (0 == strcmp(arg, "-h") || i + 1 == argc || 2 != strlen(arg)) {
+            printUsage(argv[0]);
+            return 0 == strcmp(arg, "-h") ? 0 : 1;                    // RETURN
+        }
+
+        const char *value = argv[++i];
+        switch (arg[1]) {
+          case 'f': {
+            if (0 == strcmp(value, "table")) {
+                format = Runner::BSLBENCH_TABLE;
+            }
+            else if (0 == strcmp(value, "csv")) {
+                format = Runner::BSLBENCH_CSV;
+            }
+            else if (0 == strcmp(value, "json")) {
+                format = Runner::BSLBENCH_JSON;
+            }
+            else {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+          } break;
+          case 'r': {
+            const int repetitions = atoi(value);
+            if (repetitions <= 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setRepetitions(repetitions);
+          } break;
+          case 'w': {
+            const int warmups = atoi(value);
+            if (warmups < 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setWarmupRepetitions(warmups);
+          } break;
+          case 't': {
+            const double milliseconds = atof(value);
+            if (milliseconds < 0) {
+                printUsage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            runner.setMinRepetitionTime(
+                       static_cast<bsls::Types::Int64>(milliseconds * 1e6));
+          } break;
+          default: {
+            printUsage(argv[0]);
+            return 1;                                                 // RETURN
+          }
+        }
+    }
+
+    if (allocatorSweep) {
+        runAllocatorSweep(&runner, format);
+    }
+    else {
+        bsl::deque<bsl::string> names;
+        runBenchmarks(&runner, &names);
+        runner.print(stdout, format);
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
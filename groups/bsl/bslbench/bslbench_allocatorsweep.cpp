@@ -0,0 +1,466 @@
+// bslbench_allocatorsweep.cpp                                        -*-C++-*-
+#include <bslbench_allocatorsweep.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslstl_map.h>
+
+#include <bslma_newdeleteallocator.h>
+
+#include <string.h>
+
+namespace BloombergLP {
+namespace bslbench {
+
+namespace {
+
+typedef bsls::Types::Int64 Int64;
+
+                          // =======================
+                          // class CountingAllocator
+                          // =======================
+
+class CountingAllocator : public bslma::Allocator {
+    // This class implements an allocator that forwards to a target
+    // allocator, and records the number of allocations and the number of
+    // bytes in use, and its peak, of the memory obtained through it.  The
+    // size of each block in use is held in a map, rather than in a header
+    // within the block, so that the memory requested from the target is
+    // exactly that requested from this object.
+
+    // DATA
+    bslma::Allocator            *d_target_p;         // target allocator
+                                                     // (held, not owned)
+
+    bsl::map<void *, size_type>  d_sizes;            // sizes of the blocks
+                                                     // in use
+
+    Int64                        d_numAllocations;   // allocations made
+
+    Int64                        d_numBytesInUse;    // bytes in use
+
+    Int64                        d_peakBytesInUse;   // maximum bytes in use
+
+    // NOT IMPLEMENTED
+    CountingAllocator(const CountingAllocator&);
+    CountingAllocator& operator=(const CountingAllocator&);
+
+  public:
+    // CREATORS
+    CountingAllocator(bslma::Allocator *target,
+                      bslma::Allocator *basicAllocator)
+        // Create an allocator forwarding to the specified 'target', and
+        // using the specified 'basicAllocator' to supply memory for its
+        // bookkeeping.
+    : d_target_p(target)
+    , d_sizes(basicAllocator)
+    , d_numAllocations(0)
+    , d_numBytesInUse(0)
+    , d_peakBytesInUse(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+        // Return a newly allocated block of memory of (at least) the
+        // specified positive 'size' (in bytes) obtained from the target
+        // allocator, or 0 if 'size' is 0.
+    {
+        if (0 == size) {
+            return 0;                                                 // RETURN
+        }
+        void *address = d_target_p->allocate(size);
+        d_sizes[address] = size;
+
+        ++d_numAllocations;
+        d_numBytesInUse += static_cast<Int64>(size);
+        if (d_numBytesInUse > d_peakBytesInUse) {
+            d_peakBytesInUse = d_numBytesInUse;
+        }
+        return address;
+    }
+
+    virtual void deallocate(void *address)
+        // Return the memory block at the specified 'address' to the target
+        // allocator.  If 'address' is 0, this function has no effect.
+    {
+        if (0 == address) {
+            return;                                                   // RETURN
+        }
+        bsl::map<void *, size_type>::iterator it = d_sizes.find(address);
+        BSLS_ASSERT(it != d_sizes.end());
+
+        d_numBytesInUse -= static_cast<Int64>(it->second);
+        d_sizes.erase(it);
+        d_target_p->deallocate(address);
+    }
+
+    // ACCESSORS
+    Int64 numAllocations() const
+        // Return the number of allocations made through this object.
+    {
+        return d_numAllocations;
+    }
+
+    Int64 peakBytesInUse() const
+        // Return the maximum number of bytes that were in use at once.
+    {
+        return d_peakBytesInUse;
+    }
+};
+
+struct WorkloadContext {
+    // This 'struct' holds the arguments of 'runWorkload'.
+
+    AllocatorFactory                 *d_factory_p;  // allocators to create
+    AllocatorSweep::WorkloadFunction  d_function;   // workload to run
+    int                               d_size;       // size of the workload
+};
+
+void runWorkload(int numIterations, void *context)
+    // Run the workload described by the 'WorkloadContext' at the specified
+    // 'context' the specified 'numIterations' times, each with a new
+    // allocator created by the factory of the workload.
+{
+    const WorkloadContext& workload =
+                                   *static_cast<WorkloadContext *>(context);
+
+    for (int i = 0; i < numIterations; ++i) {
+        bslma::Allocator *allocator = workload.d_factory_p->createAllocator(
+                                     &bslma::NewDeleteAllocator::singleton());
+        workload.d_function(allocator, workload.d_size);
+        workload.d_factory_p->deleteAllocator(allocator);
+    }
+}
+
+void printCsvName(FILE *stream, const char *name)
+    // Write the specified 'name' to the specified 'stream' as a CSV field,
+    // quoted if it contains a comma or a double quote.
+{
+    if (0 == strpbrk(name, ",\"")) {
+        fputs(name, stream);
+        return;                                                       // RETURN
+    }
+    fputc('"', stream);
+    for (const char *p = name; *p; ++p) {
+        if ('"' == *p) {
+            fputc('"', stream);
+        }
+        fputc(*p, stream);
+    }
+    fputc('"', stream);
+}
+
+void printJsonName(FILE *stream, const char *name)
+    // Write the specified 'name' to the specified 'stream' as a JSON string.
+{
+    fputc('"', stream);
+    for (const char *p = name; *p; ++p) {
+        if ('"' == *p || '\\' == *p) {
+            fputc('\\', stream);
+            fputc(*p, stream);
+        }
+        else if (static_cast<unsigned char>(*p) < 0x20) {
+            fprintf(stream, "\\u%04x", static_cast<unsigned char>(*p));
+        }
+        else {
+            fputc(*p, stream);
+        }
+    }
+    fputc('"', stream);
+}
+
+}  // close unnamed namespace
+
+                           // ----------------------
+                           // class AllocatorFactory
+                           // ----------------------
+
+// CREATORS
+AllocatorFactory::~AllocatorFactory()
+{
+}
+
+                        // ----------------------------
+                        // class SharedAllocatorFactory
+                        // ----------------------------
+
+// CREATORS
+SharedAllocatorFactory::~SharedAllocatorFactory()
+{
+}
+
+// MANIPULATORS
+bslma::Allocator *SharedAllocatorFactory::createAllocator(bslma::Allocator *)
+{
+    return d_allocator_p;
+}
+
+void SharedAllocatorFactory::deleteAllocator(bslma::Allocator *allocator)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == allocator);
+
+    (void)allocator;
+}
+
+                            // --------------------
+                            // class AllocatorSweep
+                            // --------------------
+
+// CREATORS
+AllocatorSweep::AllocatorSweep(bslma::Allocator *basicAllocator)
+: d_allocators(basicAllocator)
+, d_workloads(basicAllocator)
+, d_names(basicAllocator)
+, d_results(basicAllocator)
+{
+}
+
+AllocatorSweep::~AllocatorSweep()
+{
+}
+
+// MANIPULATORS
+void AllocatorSweep::addAllocator(const char *name, AllocatorFactory *factory)
+{
+    BSLS_ASSERT(name);
+    BSLS_ASSERT(factory);
+
+    AllocatorEntry entry = { name, factory };
+    d_allocators.push_back(entry);
+}
+
+void AllocatorSweep::addDefaultWorkloads()
+{
+    addWorkload("containers", &AllocatorWorkload::buildContainers,   1000);
+    addWorkload("churn",      &AllocatorWorkload::churnRandomSizes,  100000);
+    addWorkload("queue",      &AllocatorWorkload::produceAndConsume, 100000);
+    addWorkload("request",    &AllocatorWorkload::serveRequest,      1000);
+}
+
+void AllocatorSweep::addWorkload(const char       *name,
+                                 WorkloadFunction  function,
+                                 int               size)
+{
+    BSLS_ASSERT(name);
+    BSLS_ASSERT(function);
+    BSLS_ASSERT(0 <= size);
+
+    WorkloadEntry entry = { name, function, size };
+    d_workloads.push_back(entry);
+}
+
+void AllocatorSweep::run(Runner *runner)
+{
+    BSLS_ASSERT(runner);
+
+    bslma::Allocator *upstream = &bslma::NewDeleteAllocator::singleton();
+
+    for (int w = 0; w < numWorkloads(); ++w) {
+        const WorkloadEntry& workload = d_workloads[w];
+
+        char size[16];
+        sprintf(size, "/%d/", workload.d_size);
+
+        for (int a = 0; a < numAllocators(); ++a) {
+            const AllocatorEntry& entry = d_allocators[a];
+
+            bsl::string name(workload.d_name_p, allocator());
+            name += size;
+            name += entry.d_name_p;
+            if (!runner->matchesFilter(name.c_str())) {
+                continue;                                           // CONTINUE
+            }
+
+            // Measure the memory in one run, counting both the requests of
+            // the workload and those of the allocator to its upstream.
+
+            AllocatorSweepResult result;
+            result.d_workloadName_p  = workload.d_name_p;
+            result.d_allocatorName_p = entry.d_name_p;
+            result.d_size            = workload.d_size;
+            {
+                CountingAllocator footprint(upstream, allocator());
+                AllocatorFactory *factory = entry.d_factory_p;
+                bslma::Allocator *tested  =
+                                          factory->createAllocator(&footprint);
+                {
+                    CountingAllocator inUse(tested, allocator());
+                    workload.d_function(&inUse, workload.d_size);
+
+                    result.d_numAllocations = inUse.numAllocations();
+                    result.d_peakBytesInUse = inUse.peakBytesInUse();
+                }
+                factory->deleteAllocator(tested);
+
+                result.d_peakFootprint = footprint.peakBytesInUse();
+            }
+            result.d_fragmentation =
+                  0 < result.d_peakFootprint
+                  ? 1.0 - static_cast<double>(result.d_peakBytesInUse)
+                                 / static_cast<double>(result.d_peakFootprint)
+                  : -1.0;
+
+            // Measure the time without counting.  The runner holds the name
+            // of the benchmark, which must outlive its result.
+
+            d_names.push_back(name);
+
+            WorkloadContext context = { entry.d_factory_p,
+                                        workload.d_function,
+                                        workload.d_size };
+            runner->run(d_names.back().c_str(), &runWorkload, &context);
+
+            const Result& timing = runner->result(runner->numResults() - 1);
+
+            result.d_medianTime           = timing.d_median;
+            result.d_allocationsPerSecond =
+                    0 < result.d_medianTime
+                    ? static_cast<double>(result.d_numAllocations) * 1.0e9
+                                                         / result.d_medianTime
+                    : 0.0;
+
+            d_results.push_back(result);
+        }
+    }
+}
+
+// ACCESSORS
+void AllocatorSweep::print(FILE *stream, Runner::Format format) const
+{
+    BSLS_ASSERT(stream);
+
+    const int numResults = this->numResults();
+
+    switch (format) {
+      case Runner::BSLBENCH_TABLE: {
+        int workloadWidth  = static_cast<int>(strlen("workload"));
+        int allocatorWidth = static_cast<int>(strlen("allocator"));
+        for (int i = 0; i < numResults; ++i) {
+            const int workloadLength =
+                       static_cast<int>(strlen(d_results[i].d_workloadName_p));
+            const int allocatorLength =
+                      static_cast<int>(strlen(d_results[i].d_allocatorName_p));
+            if (workloadLength > workloadWidth) {
+                workloadWidth = workloadLength;
+            }
+            if (allocatorLength > allocatorWidth) {
+                allocatorWidth = allocatorLength;
+            }
+        }
+
+        fprintf(stream,
+                "%-*s %8s %-*s %12s %10s %12s %14s %6s\n",
+                workloadWidth,
+                "workload",
+                "size",
+                allocatorWidth,
+                "allocator",
+                "median ns",
+                "M alloc/s",
+                "peak in use",
+                "peak footprint",
+                "frag");
+        for (int i = 0; i < numResults; ++i) {
+            const AllocatorSweepResult& r = d_results[i];
+            fprintf(stream,
+                    "%-*s %8d %-*s %12.0f %10.2f %12lld %14lld ",
+                    workloadWidth,
+                    r.d_workloadName_p,
+                    r.d_size,
+                    allocatorWidth,
+                    r.d_allocatorName_p,
+                    r.d_medianTime,
+                    r.d_allocationsPerSecond / 1.0e6,
+                    r.d_peakBytesInUse,
+                    r.d_peakFootprint);
+            if (0 <= r.d_fragmentation) {
+                fprintf(stream, "%5.1f%%\n", r.d_fragmentation * 100.0);
+            }
+            else {
+                fputs("     -\n", stream);
+            }
+        }
+      } break;
+      case Runner::BSLBENCH_CSV: {
+        fputs("workload,size,allocator,median_ns,allocations,"
+              "allocations_per_s,peak_in_use_bytes,peak_footprint_bytes,"
+              "fragmentation\n",
+              stream);
+        for (int i = 0; i < numResults; ++i) {
+            const AllocatorSweepResult& r = d_results[i];
+            printCsvName(stream, r.d_workloadName_p);
+            fprintf(stream, ",%d,", r.d_size);
+            printCsvName(stream, r.d_allocatorName_p);
+            fprintf(stream,
+                    ",%.3f,%lld,%.0f,%lld,%lld,",
+                    r.d_medianTime,
+                    r.d_numAllocations,
+                    r.d_allocationsPerSecond,
+                    r.d_peakBytesInUse,
+                    r.d_peakFootprint);
+            if (0 <= r.d_fragmentation) {
+                fprintf(stream, "%.4f", r.d_fragmentation);
+            }
+            fputc('\n', stream);
+        }
+      } break;
+      case Runner::BSLBENCH_JSON: {
+        fputs("{\n  \"allocator_sweep\": [", stream);
+        for (int i = 0; i < numResults; ++i) {
+            const AllocatorSweepResult& r = d_results[i];
+            fputs(i ? ",\n    {\"workload\": " : "\n    {\"workload\": ",
+                  stream);
+            printJsonName(stream, r.d_workloadName_p);
+            fprintf(stream, ", \"size\": %d, \"allocator\": ", r.d_size);
+            printJsonName(stream, r.d_allocatorName_p);
+            fprintf(stream,
+                    ", \"median_ns\": %.3f, \"allocations\": %lld,"
+                    " \"allocations_per_s\": %.0f,"
+                    " \"peak_in_use_bytes\": %lld,"
+                    " \"peak_footprint_bytes\": %lld, \"fragmentation\": ",
+                    r.d_medianTime,
+                    r.d_numAllocations,
+                    r.d_allocationsPerSecond,
+                    r.d_peakBytesInUse,
+                    r.d_peakFootprint);
+            if (0 <= r.d_fragmentation) {
+                fprintf(stream, "%.4f}", r.d_fragmentation);
+            }
+            else {
+                fputs("null}", stream);
+            }
+        }
+        fputs(numResults ? "\n  ]\n}\n" : "]\n}\n", stream);
+      } break;
+      default: {
+        BSLS_ASSERT(!"Unknown format");
+      }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
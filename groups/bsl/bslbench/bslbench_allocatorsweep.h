@@ -0,0 +1,651 @@
+// bslbench_allocatorsweep.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLBENCH_ALLOCATORSWEEP
+#define INCLUDED_BSLBENCH_ALLOCATORSWEEP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a benchmark running workloads against many allocators.
+//
+//@CLASSES:
+//  bslbench::AllocatorFactory: protocol for creating allocators to measure
+//  bslbench::AllocatorFactoryImp: factory constructing a given allocator type
+//  bslbench::SharedAllocatorFactory: factory supplying an existing allocator
+//  bslbench::AllocatorSweepResult: measurements of a workload on an allocator
+//  bslbench::AllocatorSweep: mechanism measuring workloads on allocators
+//
+//@SEE_ALSO: bslbench_allocatorworkload, bslbench_runner
+//
+//@DESCRIPTION: This component provides a mechanism, 'AllocatorSweep', that
+// runs each of a set of workloads against each of a set of allocators, and
+// reports, for each pair, the throughput of the allocator, the peak memory
+// it draws from the system, and its fragmentation.  Workloads are functions
+// taking a 'bslma::Allocator' (such as those of 'AllocatorWorkload'), and
+// allocators are supplied through the 'AllocatorFactory' protocol, so that
+// any allocator, including one defined by the user, can be measured.
+//
+// For each workload and allocator, the sweep creates a fresh allocator from
+// the factory, runs the workload once, and destroys the allocator, so that
+// memory held by pools and arenas is released at the end of every run, as
+// it would be at the end of a request or a transaction.  The allocator is
+// given an *upstream* allocator, from which pools and arenas obtain their
+// blocks, which is 'bslma::NewDeleteAllocator::singleton()'.
+//
+// Each pair is measured twice:
+//
+//: 1 The memory is measured in one untimed run, with a counting allocator
+//:   placed between the workload and the allocator under test, measuring the
+//:   bytes the workload holds, and another placed between the allocator and
+//:   its upstream allocator, measuring the bytes the allocator holds.
+//:
+//: 2 The time is measured by a 'bslbench::Runner', without the counting
+//:   allocators, under the name "<workload>/<size>/<allocator>", which is
+//:   also matched against the filter of the runner to select the pairs run.
+//
+// The results are, for each pair:
+//
+//: 'd_medianTime': the median time of one run, in nanoseconds
+//:
+//: 'd_numAllocations': the number of allocations made by one run
+//:
+//: 'd_allocationsPerSecond': the throughput of the allocator, i.e., the
+//:   number of allocations (and the corresponding deallocations) per second
+//:
+//: 'd_peakBytesInUse': the peak number of bytes held by the workload
+//:
+//: 'd_peakFootprint': the peak number of bytes drawn by the allocator from
+//:   its upstream allocator, which is 0 for allocators that obtain memory
+//:   elsewhere (e.g., 'bslma::MallocFreeAllocator')
+//:
+//: 'd_fragmentation': the fraction of the peak footprint not holding
+//:   memory in use by the workload, i.e.,
+//:   '1 - d_peakBytesInUse / d_peakFootprint', or a negative value if the
+//:   peak footprint is 0
+//
+// Note that the counting allocators are implemented in this component,
+// because the 'bdlma::CountingAllocator' of the 'bdl' package group, which
+// does not record a peak, cannot be used at this level.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Comparing Two Allocators
+/// - - - - - - - - - - - - - - - - -
+// Suppose that we want to compare the default allocator of a program,
+// 'bslma::NewDeleteAllocator', with 'bslma::MallocFreeAllocator' on the
+// workloads of 'AllocatorWorkload'.  First, we create factories supplying
+// the two allocators, which, being singletons, take no upstream allocator:
+//..
+//  bslbench::SharedAllocatorFactory newDelete(
+//                                   &bslma::NewDeleteAllocator::singleton());
+//  bslbench::SharedAllocatorFactory mallocFree(
+//                                  &bslma::MallocFreeAllocator::singleton());
+//..
+// Then, we create a sweep, and add the allocators and the workloads:
+//..
+//  bslbench::AllocatorSweep sweep;
+//  sweep.addAllocator("newdelete", &newDelete);
+//  sweep.addAllocator("mallocfree", &mallocFree);
+//
+//  typedef bslbench::AllocatorWorkload Workload;
+//  sweep.addWorkload("containers", &Workload::buildContainers, 100);
+//  sweep.addWorkload("churn", &Workload::churnRandomSizes, 1000);
+//..
+// Next, we create a runner making quick measurements, and run the sweep:
+//..
+//  bslbench::Runner runner;
+//  runner.setMinRepetitionTime(100 * 1000);  // 0.1 milliseconds
+//  runner.setWarmupRepetitions(1);
+//  runner.setRepetitions(3);
+//
+//  sweep.run(&runner);
+//  assert(4 == sweep.numResults());
+//..
+// Then, we verify that the results are in the order of the workloads, then
+// of the allocators, and that both allocators saw the same requests:
+//..
+//  const bslbench::AllocatorSweepResult& first  = sweep.result(0);
+//  const bslbench::AllocatorSweepResult& second = sweep.result(1);
+//
+//  assert(0 == strcmp("containers", first.d_workloadName_p));
+//  assert(0 == strcmp("newdelete",  first.d_allocatorName_p));
+//  assert(0 == strcmp("mallocfree", second.d_allocatorName_p));
+//  assert(first.d_numAllocations == second.d_numAllocations);
+//  assert(first.d_peakBytesInUse == second.d_peakBytesInUse);
+//..
+// Since neither allocator draws memory from an upstream allocator, their
+// footprint and fragmentation are unknown:
+//..
+//  assert(0 == first.d_peakFootprint);
+//  assert(first.d_fragmentation < 0);
+//..
+// Finally, we print the results as a table:
+//..
+//  sweep.print(stdout, bslbench::Runner::BSLBENCH_TABLE);
+//..
+//
+///Example 2: Measuring a Pool
+/// - - - - - - - - - - - - -
+// Suppose that we have a pooling allocator, 'my_PoolAllocator', which
+// obtains its blocks from an allocator supplied at construction:
+//..
+//  class my_PoolAllocator : public bslma::Allocator {
+//      // This class implements an allocator that obtains memory from an
+//      // upstream allocator in blocks of 4 kilobytes (or more, for large
+//      // allocations), carving allocations from the latest block.
+//      // Deallocations are no-ops, and the memory is released when the
+//      // allocator is destroyed.
+//
+//      enum { k_BLOCK_SIZE = 4096 };
+//
+//      // DATA
+//      bsl::vector<void *>  d_blocks;      // blocks obtained from upstream
+//      int                  d_cursor;      // offset of free space in the
+//                                          // latest block
+//      bslma::Allocator    *d_upstream_p;  // upstream (held, not owned)
+//
+//    public:
+//      explicit my_PoolAllocator(bslma::Allocator *upstream)
+//      : d_blocks(upstream)
+//      , d_cursor(k_BLOCK_SIZE)
+//      , d_upstream_p(upstream)
+//      {
+//      }
+//
+//      ~my_PoolAllocator()
+//      {
+//          while (!d_blocks.empty()) {
+//              d_upstream_p->deallocate(d_blocks.back());
+//              d_blocks.pop_back();
+//          }
+//      }
+//
+//      void *allocate(size_type size)
+//      {
+//          if (0 == size) {
+//              return 0;                                             // RETURN
+//          }
+//          const int length = static_cast<int>((size + 15) / 16 * 16);
+//          if (length > k_BLOCK_SIZE - d_cursor) {
+//              d_blocks.push_back(d_upstream_p->allocate(
+//                                  length > k_BLOCK_SIZE ? length
+//                                                        : k_BLOCK_SIZE));
+//              d_cursor = 0;
+//          }
+//          void *result = static_cast<char *>(d_blocks.back()) + d_cursor;
+//          d_cursor += length;
+//          return result;
+//      }
+//
+//      void deallocate(void *)
+//      {
+//      }
+//  };
+//..
+// Then, we create a factory that constructs a 'my_PoolAllocator' for each
+// run, and measure it:
+//..
+//  bslbench::AllocatorFactoryImp<my_PoolAllocator> poolFactory;
+//
+//  bslbench::AllocatorSweep poolSweep;
+//  poolSweep.addAllocator("pool", &poolFactory);
+//  poolSweep.addWorkload("request", &Workload::serveRequest, 100);
+//  poolSweep.run(&runner);
+//  assert(1 == poolSweep.numResults());
+//..
+// Finally, we observe that the pool draws memory from its upstream
+// allocator, and so reports a footprint at least as large as the memory
+// used by the workload:
+//..
+//  const bslbench::AllocatorSweepResult& pool = poolSweep.result(0);
+//  assert(pool.d_peakBytesInUse <= pool.d_peakFootprint);
+//  assert(0 <= pool.d_fragmentation);
+//  assert(pool.d_fragmentation < 1);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLBENCH_ALLOCATORWORKLOAD
+#include <bslbench_allocatorworkload.h>
+#endif
+
+#ifndef INCLUDED_BSLBENCH_RUNNER
+#include <bslbench_runner.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_DEQUE
+#include <bslstl_deque.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRING
+#include <bslstl_string.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDIO_H
+#include <stdio.h>
+#define INCLUDED_STDIO_H
+#endif
+
+namespace BloombergLP {
+namespace bslbench {
+
+                           // ======================
+                           // class AllocatorFactory
+                           // ======================
+
+class AllocatorFactory {
+    // This protocol class creates and destroys the allocators measured by an
+    // 'AllocatorSweep'.
+
+  public:
+    // CREATORS
+    virtual ~AllocatorFactory();
+        // Destroy this object.
+
+    // MANIPULATORS
+    virtual bslma::Allocator *createAllocator(bslma::Allocator *upstream) = 0;
+        // Return the address of an allocator that, if it obtains memory from
+        // another allocator, obtains it from the specified 'upstream'
+        // allocator.  The allocator remains valid until it is passed to
+        // 'deleteAllocator'.
+
+    virtual void deleteAllocator(bslma::Allocator *allocator) = 0;
+        // Destroy the specified 'allocator', releasing any memory it holds.
+        // The behavior is undefined unless 'allocator' was returned by the
+        // latest call to 'createAllocator' and has not been deleted since.
+};
+
+                         // =========================
+                         // class AllocatorFactoryImp
+                         // =========================
+
+template <class ALLOCATOR>
+class AllocatorFactoryImp : public AllocatorFactory {
+    // This class implements the 'AllocatorFactory' protocol for the
+    // (template parameter) 'ALLOCATOR' type, which must derive from
+    // 'bslma::Allocator' and be constructible from the address of its
+    // upstream allocator.  At most one allocator created by an object of
+    // this class exists at a time, and it is held in a buffer within the
+    // object, so that creating it does not allocate memory.
+
+    // DATA
+    bsls::ObjectBuffer<ALLOCATOR> d_allocator;  // current allocator
+
+    // NOT IMPLEMENTED
+    AllocatorFactoryImp(const AllocatorFactoryImp&);
+    AllocatorFactoryImp& operator=(const AllocatorFactoryImp&);
+
+  public:
+    // CREATORS
+    AllocatorFactoryImp();
+        // Create a factory of 'ALLOCATOR' objects.
+
+    virtual ~AllocatorFactoryImp();
+        // Destroy this object.
+
+    // MANIPULATORS
+    virtual bslma::Allocator *createAllocator(bslma::Allocator *upstream);
+        // Return the address of a new 'ALLOCATOR' object constructed with
+        // the specified 'upstream' allocator.  The behavior is undefined
+        // unless the 'ALLOCATOR' most recently created by this factory, if
+        // any, has been deleted.
+
+    virtual void deleteAllocator(bslma::Allocator *allocator);
+        // Destroy the specified 'allocator'.  The behavior is undefined
+        // unless 'allocator' is the 'ALLOCATOR' most recently created by
+        // this factory, and has not been deleted since.
+};
+
+                        // ============================
+                        // class SharedAllocatorFactory
+                        // ============================
+
+class SharedAllocatorFactory : public AllocatorFactory {
+    // This class implements the 'AllocatorFactory' protocol by supplying the
+    // same, existing allocator every time, ignoring the upstream allocator.
+    // It is used to measure allocators that cannot be created on demand,
+    // such as 'bslma::NewDeleteAllocator::singleton()'.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // supplied allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    SharedAllocatorFactory(const SharedAllocatorFactory&);
+    SharedAllocatorFactory& operator=(const SharedAllocatorFactory&);
+
+  public:
+    // CREATORS
+    explicit SharedAllocatorFactory(bslma::Allocator *allocator);
+        // Create a factory supplying the specified 'allocator'.  The behavior
+        // is undefined unless '0 != allocator'.
+
+    virtual ~SharedAllocatorFactory();
+        // Destroy this object.
+
+    // MANIPULATORS
+    virtual bslma::Allocator *createAllocator(bslma::Allocator *upstream);
+        // Return the allocator supplied by this factory, ignoring the
+        // specified 'upstream' allocator.
+
+    virtual void deleteAllocator(bslma::Allocator *allocator);
+        // Do nothing with the specified 'allocator', which remains valid.
+};
+
+                         // ===========================
+                         // struct AllocatorSweepResult
+                         // ===========================
+
+struct AllocatorSweepResult {
+    // This 'struct' holds the measurements of one workload run against one
+    // allocator by an 'AllocatorSweep'.  See the component documentation for
+    // the meaning of each measurement.
+
+    // PUBLIC DATA
+    const char         *d_workloadName_p;        // workload (held, not owned)
+
+    const char         *d_allocatorName_p;       // allocator (held, not
+                                                 // owned)
+
+    int                 d_size;                  // size of the workload
+
+    double              d_medianTime;            // nanoseconds per run
+
+    bsls::Types::Int64  d_numAllocations;        // allocations per run
+
+    double              d_allocationsPerSecond;  // throughput
+
+    bsls::Types::Int64  d_peakBytesInUse;        // held by the workload
+
+    bsls::Types::Int64  d_peakFootprint;         // drawn from upstream
+
+    double              d_fragmentation;         // unused fraction of the
+                                                 // footprint, or negative
+};
+
+                            // ====================
+                            // class AllocatorSweep
+                            // ====================
+
+class AllocatorSweep {
+    // This mechanism class measures each of a set of workloads against each
+    // of a set of allocators, and records the measurements in a sequence of
+    // 'AllocatorSweepResult' objects that can be accessed or printed.  See
+    // the component documentation for the measurement procedure.
+
+  public:
+    // TYPES
+    typedef AllocatorWorkload::Function WorkloadFunction;
+        // A 'WorkloadFunction' runs a workload of a given size, obtaining
+        // memory from a given allocator.
+
+  private:
+    // PRIVATE TYPES
+    struct AllocatorEntry {
+        const char       *d_name_p;     // name (held, not owned)
+        AllocatorFactory *d_factory_p;  // factory (held, not owned)
+    };
+
+    struct WorkloadEntry {
+        const char       *d_name_p;     // name (held, not owned)
+        WorkloadFunction  d_function;   // workload
+        int               d_size;       // size of the workload
+    };
+
+    // DATA
+    bsl::vector<AllocatorEntry>        d_allocators;  // allocators measured
+
+    bsl::vector<WorkloadEntry>         d_workloads;   // workloads run
+
+    bsl::deque<bsl::string>            d_names;       // benchmark names given
+                                                      // to runners, which
+                                                      // hold them
+
+    bsl::vector<AllocatorSweepResult>  d_results;     // results, in order run
+
+    // NOT IMPLEMENTED
+    AllocatorSweep(const AllocatorSweep&);
+    AllocatorSweep& operator=(const AllocatorSweep&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AllocatorSweep,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AllocatorSweep(bslma::Allocator *basicAllocator = 0);
+        // Create a sweep having no allocators, no workloads, and no results.
+        // Optionally specify a 'basicAllocator' used to supply memory,
+        // including the bookkeeping of the counting allocators.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~AllocatorSweep();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void addAllocator(const char *name, AllocatorFactory *factory);
+        // Add the allocators created by the specified 'factory', having the
+        // specified 'name', to the allocators measured by this sweep.  The
+        // behavior is undefined unless 'name' and 'factory' remain valid for
+        // the lifetime of this object.
+
+    void addDefaultWorkloads();
+        // Add the workloads of 'AllocatorWorkload' to the workloads of this
+        // sweep, named and sized as follows:
+        //..
+        //  Name          Function             Size
+        //  ----------    -----------------    ------
+        //  containers    buildContainers        1000
+        //  churn         churnRandomSizes     100000
+        //  queue         produceAndConsume    100000
+        //  request       serveRequest           1000
+        //..
+
+    void addWorkload(const char       *name,
+                     WorkloadFunction  function,
+                     int               size);
+        // Add the specified 'function', run with the specified 'size' and
+        // having the specified 'name', to the workloads of this sweep.  The
+        // behavior is undefined unless '0 != function', '0 <= size', and
+        // 'name' remains valid for the lifetime of this object.
+
+    void clearResults();
+        // Remove all results recorded by this sweep.
+
+    void run(Runner *runner);
+        // Measure each workload of this sweep, in the order added, against
+        // each allocator, in the order added, timing the runs with the
+        // specified 'runner', and append the measurements to the results of
+        // this sweep.  Skip the pairs whose benchmark name does not match
+        // the filter of 'runner'.  Note that 'runner' records a result for
+        // each pair measured, holding a name owned by this object.
+
+    // ACCESSORS
+    int numAllocators() const;
+        // Return the number of allocators measured by this sweep.
+
+    int numResults() const;
+        // Return the number of results recorded by this sweep.
+
+    int numWorkloads() const;
+        // Return the number of workloads run by this sweep.
+
+    void print(FILE *stream, Runner::Format format) const;
+        // Write the results recorded by this sweep to the specified 'stream'
+        // in the specified 'format'.  The CSV format has the fields
+        // 'workload', 'size', 'allocator', 'median_ns', 'allocations',
+        // 'allocations_per_s', 'peak_in_use_bytes', 'peak_footprint_bytes',
+        // and 'fragmentation', the last being empty if it is unknown; the
+        // JSON format is an object with an "allocator_sweep" array of
+        // objects having the same fields, the last being 'null' if unknown.
+
+    const AllocatorSweepResult& result(int index) const;
+        // Return a reference providing non-modifiable access to the result
+        // at the specified 'index' in the order measured.  The behavior is
+        // undefined unless '0 <= index < numResults()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class AllocatorFactoryImp
+                         // -------------------------
+
+// CREATORS
+template <class ALLOCATOR>
+inline
+AllocatorFactoryImp<ALLOCATOR>::AllocatorFactoryImp()
+{
+}
+
+template <class ALLOCATOR>
+inline
+AllocatorFactoryImp<ALLOCATOR>::~AllocatorFactoryImp()
+{
+}
+
+// MANIPULATORS
+template <class ALLOCATOR>
+inline
+bslma::Allocator *
+AllocatorFactoryImp<ALLOCATOR>::createAllocator(bslma::Allocator *upstream)
+{
+    return new (d_allocator.buffer()) ALLOCATOR(upstream);
+}
+
+template <class ALLOCATOR>
+inline
+void AllocatorFactoryImp<ALLOCATOR>::deleteAllocator(
+                                                  bslma::Allocator *allocator)
+{
+    BSLS_ASSERT_SAFE(&d_allocator.object() == allocator);
+
+    (void)allocator;
+    d_allocator.object().~ALLOCATOR();
+}
+
+                        // ----------------------------
+                        // class SharedAllocatorFactory
+                        // ----------------------------
+
+// CREATORS
+inline
+SharedAllocatorFactory::SharedAllocatorFactory(bslma::Allocator *allocator)
+: d_allocator_p(allocator)
+{
+    BSLS_ASSERT_SAFE(allocator);
+}
+
+                            // --------------------
+                            // class AllocatorSweep
+                            // --------------------
+
+// MANIPULATORS
+inline
+void AllocatorSweep::clearResults()
+{
+    d_results.clear();
+}
+
+// ACCESSORS
+inline
+int AllocatorSweep::numAllocators() const
+{
+    return static_cast<int>(d_allocators.size());
+}
+
+inline
+int AllocatorSweep::numResults() const
+{
+    return static_cast<int>(d_results.size());
+}
+
+inline
+int AllocatorSweep::numWorkloads() const
+{
+    return static_cast<int>(d_workloads.size());
+}
+
+inline
+const AllocatorSweepResult& AllocatorSweep::result(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numResults());
+
+    return d_results[index];
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *AllocatorSweep::allocator() const
+{
+    return d_results.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1126 @@
+// bslbench_allocatorsweep.t.cpp                                      -*-C++-*-
+#include <bslbench_allocatorsweep.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a mechanism measuring the time and the
+// memory of workloads run against allocators.  The memory measurements are
+// verified exactly with a workload making a known sequence of allocations,
+// run against a shared allocator and against an allocator, created by an
+// 'AllocatorFactoryImp', that draws a known amount of memory from its
+// upstream allocator.  The output formats are verified by writing them to a
+// temporary file and reading them back.
+//-----------------------------------------------------------------------------
+// AllocatorFactoryImp
+// [ 2] AllocatorFactoryImp();
+// [ 2] virtual bslma::Allocator *createAllocator(bslma::Allocator *);
+// [ 2] virtual void deleteAllocator(bslma::Allocator *allocator);
+//
+// SharedAllocatorFactory
+// [ 2] explicit SharedAllocatorFactory(bslma::Allocator *allocator);
+// [ 2] virtual bslma::Allocator *createAllocator(bslma::Allocator *);
+// [ 2] virtual void deleteAllocator(bslma::Allocator *allocator);
+//
+// AllocatorSweep
+// [ 3] explicit AllocatorSweep(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~AllocatorSweep();
+// [ 3] void addAllocator(const char *name, AllocatorFactory *factory);
+// [ 3] void addDefaultWorkloads();
+// [ 3] void addWorkload(const char *, WorkloadFunction, int);
+// [ 4] void clearResults();
+// [ 4] void run(Runner *runner);
+// [ 3] int numAllocators() const;
+// [ 4] int numResults() const;
+// [ 3] int numWorkloads() const;
+// [ 5] void print(FILE *stream, Runner::Format format) const;
+// [ 4] const AllocatorSweepResult& result(int index) const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslbench::AllocatorSweep         Obj;
+typedef bslbench::AllocatorSweepResult   Result;
+typedef bslbench::Runner                 Runner;
+typedef bslbench::SharedAllocatorFactory SharedFactory;
+typedef bslbench::AllocatorWorkload      Workload;
+typedef bsls::Types::Int64               Int64;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+class ReservingAllocator : public bslma::Allocator {
+    // This class implements an allocator that draws a reserve of
+    // 'k_RESERVE' bytes from its upstream allocator when constructed, and
+    // forwards every allocation to the upstream allocator, so that the
+    // memory it draws is exactly the reserve plus the memory in use.
+
+  public:
+    enum { k_RESERVE = 1000 };
+
+    static int s_numLive;  // number of objects of this class in existence
+
+  private:
+    // DATA
+    bslma::Allocator *d_upstream_p;  // upstream allocator (held, not owned)
+    void             *d_reserve_p;   // reserve (owned)
+
+  public:
+    // CREATORS
+    explicit ReservingAllocator(bslma::Allocator *upstream)
+        // Create an allocator drawing memory from the specified 'upstream'
+        // allocator.
+    : d_upstream_p(upstream)
+    , d_reserve_p(upstream->allocate(k_RESERVE))
+    {
+        ++s_numLive;
+    }
+
+    ~ReservingAllocator()
+        // Destroy this object, returning its reserve.
+    {
+        d_upstream_p->deallocate(d_reserve_p);
+        --s_numLive;
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size)
+        // Return a block of the specified 'size' from the upstream
+        // allocator.
+    {
+        return d_upstream_p->allocate(size);
+    }
+
+    void deallocate(void *address)
+        // Return the block at the specified 'address' to the upstream
+        // allocator.
+    {
+        d_upstream_p->deallocate(address);
+    }
+
+    // ACCESSORS
+    bslma::Allocator *upstream() const
+        // Return the upstream allocator of this object.
+    {
+        return d_upstream_p;
+    }
+};
+
+int ReservingAllocator::s_numLive = 0;
+
+typedef bslbench::AllocatorFactoryImp<ReservingAllocator> ReservingFactory;
+
+void fixedWorkload(bslma::Allocator *allocator, int size)
+    // Allocate the specified 'size' blocks of 100 bytes from the specified
+    // 'allocator' and return them, then allocate and return a block of 50
+    // bytes.  The behavior is undefined unless '0 <= size <= 16'.
+{
+    void *blocks[16];
+    for (int i = 0; i < size; ++i) {
+        blocks[i] = allocator->allocate(100);
+    }
+    for (int i = 0; i < size; ++i) {
+        allocator->deallocate(blocks[i]);
+    }
+    allocator->deallocate(allocator->allocate(50));
+}
+
+void setQuick(Runner *runner)
+    // Set the specified 'runner' to measure with a single, short repetition.
+{
+    runner->setMinRepetitionTime(0);
+    runner->setWarmupRepetitions(0);
+    runner->setRepetitions(1);
+}
+
+bsl::string readFile(FILE *file)
+    // Return the contents of the specified 'file', read from its beginning.
+{
+    bsl::string result;
+    rewind(file);
+    char buffer[256];
+    size_t length;
+    while (0 < (length = fread(buffer, 1, sizeof buffer, file))) {
+        result.append(buffer, length);
+    }
+    return result;
+}
+
+int countLines(const bsl::string& text)
+    // Return the number of newline characters in the specified 'text'.
+{
+    int result = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        result += '\n' == text[i];
+    }
+    return result;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 2: Measuring a Pool
+/// - - - - - - - - - - - - -
+// Suppose that we have a pooling allocator, 'my_PoolAllocator', which
+// obtains its blocks from an allocator supplied at construction:
+//..
+    class my_PoolAllocator : public bslma::Allocator {
+        // This class implements an allocator that obtains memory from an
+        // upstream allocator in blocks of 4 kilobytes (or more, for large
+        // allocations), carving allocations from the latest block.
+        // Deallocations are no-ops, and the memory is released when the
+        // allocator is destroyed.
+
+        enum { k_BLOCK_SIZE = 4096 };
+
+        // DATA
+        bsl::vector<void *>  d_blocks;      // blocks obtained from upstream
+        int                  d_cursor;      // offset of free space in the
+                                            // latest block
+        bslma::Allocator    *d_upstream_p;  // upstream (held, not owned)
+
+      public:
+        explicit my_PoolAllocator(bslma::Allocator *upstream)
+        : d_blocks(upstream)
+        , d_cursor(k_BLOCK_SIZE)
+        , d_upstream_p(upstream)
+        {
+        }
+
+        ~my_PoolAllocator()
+        {
+            while (!d_blocks.empty()) {
+                d_upstream_p->deallocate(d_blocks.back());
+                d_blocks.pop_back();
+            }
+        }
+
+        void *allocate(size_type size)
+        {
+            if (0 == size) {
+                return 0;                                             // RETURN
+            }
+            const int length = static_cast<int>((size + 15) / 16 * 16);
+            if (length > k_BLOCK_SIZE - d_cursor) {
+                d_blocks.push_back(d_upstream_p->allocate(
+                                    length > k_BLOCK_SIZE ? length
+                                                          : k_BLOCK_SIZE));
+                d_cursor = 0;
+            }
+            void *result = static_cast<char *>(d_blocks.back()) + d_cursor;
+            d_cursor += length;
+            return result;
+        }
+
+        void deallocate(void *)
+        {
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    setbuf(stdout, NULL);    // Use unbuffered output.
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Comparing Two Allocators
+/// - - - - - - - - - - - - - - - - -
+// Suppose that we want to compare the default allocator of a program,
+// 'bslma::NewDeleteAllocator', with 'bslma::MallocFreeAllocator' on the
+// workloads of 'AllocatorWorkload'.  First, we create factories supplying
+// the two allocators, which, being singletons, take no upstream allocator:
+//..
+    bslbench::SharedAllocatorFactory newDelete(
+                                     &bslma::NewDeleteAllocator::singleton());
+    bslbench::SharedAllocatorFactory mallocFree(
+                                    &bslma::MallocFreeAllocator::singleton());
+//..
+// Then, we create a sweep, and add the allocators and the workloads:
+//..
+    bslbench::AllocatorSweep sweep;
+    sweep.addAllocator("newdelete", &newDelete);
+    sweep.addAllocator("mallocfree", &mallocFree);
+
+    typedef bslbench::AllocatorWorkload Workload;
+    sweep.addWorkload("containers", &Workload::buildContainers, 100);
+    sweep.addWorkload("churn", &Workload::churnRandomSizes, 1000);
+//..
+// Next, we create a runner making quick measurements, and run the sweep:
+//..
+    bslbench::Runner runner;
+    runner.setMinRepetitionTime(100 * 1000);  // 0.1 milliseconds
+    runner.setWarmupRepetitions(1);
+    runner.setRepetitions(3);
+
+    sweep.run(&runner);
+    ASSERT(4 == sweep.numResults());
+//..
+// Then, we verify that the results are in the order of the workloads, then
+// of the allocators, and that both allocators saw the same requests:
+//..
+    const bslbench::AllocatorSweepResult& first  = sweep.result(0);
+    const bslbench::AllocatorSweepResult& second = sweep.result(1);
+
+    ASSERT(0 == strcmp("containers", first.d_workloadName_p));
+    ASSERT(0 == strcmp("newdelete",  first.d_allocatorName_p));
+    ASSERT(0 == strcmp("mallocfree", second.d_allocatorName_p));
+    ASSERT(first.d_numAllocations == second.d_numAllocations);
+    ASSERT(first.d_peakBytesInUse == second.d_peakBytesInUse);
+//..
+// Since neither allocator draws memory from an upstream allocator, their
+// footprint and fragmentation are unknown:
+//..
+    ASSERT(0 == first.d_peakFootprint);
+    ASSERT(first.d_fragmentation < 0);
+//..
+// Finally, we print the results as a table:
+//..
+    if (verbose) {
+        sweep.print(stdout, bslbench::Runner::BSLBENCH_TABLE);
+    }
+//..
+// Then, we create a factory that constructs a 'my_PoolAllocator' for each
+// run, and measure it:
+//..
+    bslbench::AllocatorFactoryImp<my_PoolAllocator> poolFactory;
+
+    bslbench::AllocatorSweep poolSweep;
+    poolSweep.addAllocator("pool", &poolFactory);
+    poolSweep.addWorkload("request", &Workload::serveRequest, 100);
+    poolSweep.run(&runner);
+    ASSERT(1 == poolSweep.numResults());
+//..
+// Finally, we observe that the pool draws memory from its upstream
+// allocator, and so reports a footprint at least as large as the memory
+// used by the workload:
+//..
+    const bslbench::AllocatorSweepResult& pool = poolSweep.result(0);
+    ASSERT(pool.d_peakBytesInUse <= pool.d_peakFootprint);
+    ASSERT(0 <= pool.d_fragmentation);
+    ASSERT(pool.d_fragmentation < 1);
+//..
+
+        if (verbose) {
+            poolSweep.print(stdout, bslbench::Runner::BSLBENCH_TABLE);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'print'
+        //
+        // Concerns:
+        //: 1 The table format has a header line and one line per result,
+        //:   showing "-" for an unknown fragmentation.
+        //:
+        //: 2 The CSV format has the documented header line, and one line per
+        //:   result with the nine fields, names being quoted if they contain
+        //:   a comma or a double quote, and an unknown fragmentation empty.
+        //:
+        //: 3 The JSON format is an object with an "allocator_sweep" array of
+        //:   one object per result, names being escaped as JSON strings, and
+        //:   an unknown fragmentation being 'null'.
+        //:
+        //: 4 Each format is well-formed when there are no results.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Print a sweep without results, and a sweep with results of a
+        //:   shared allocator and of a reserving allocator, having names that
+        //:   need quoting, in each format, to a temporary file, and verify
+        //:   the contents.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   void print(FILE *stream, Runner::Format format) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'print'"
+                            "\n=======\n");
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        SharedFactory    shared(&sa);
+        ReservingFactory reserving;
+
+        Runner runner(&sa);
+        setQuick(&runner);
+
+        Obj mX(&sa);  const Obj& X = mX;
+
+        if (verbose) printf("\tNo results.\n");
+        {
+            FILE *file = tmpfile();
+            ASSERT(file);
+
+            X.print(file, Runner::BSLBENCH_CSV);
+            ASSERT("workload,size,allocator,median_ns,allocations,"
+                   "allocations_per_s,peak_in_use_bytes,"
+                   "peak_footprint_bytes,fragmentation\n" == readFile(file));
+            fclose(file);
+
+            file = tmpfile();
+            X.print(file, Runner::BSLBENCH_JSON);
+            ASSERT("{\n  \"allocator_sweep\": []\n}\n" == readFile(file));
+            fclose(file);
+
+            file = tmpfile();
+            X.print(file, Runner::BSLBENCH_TABLE);
+            const bsl::string TABLE = readFile(file);
+            ASSERTV(TABLE.c_str(), 0 == TABLE.find("workload "));
+            ASSERT(1 == countLines(TABLE));
+            fclose(file);
+        }
+
+        mX.addAllocator("shared", &shared);
+        mX.addAllocator("reserving \"1000\"", &reserving);
+        mX.addWorkload("fixed,4", &fixedWorkload, 4);
+        mX.run(&runner);
+        ASSERT(2 == X.numResults());
+
+        if (verbose) printf("\tTable format.\n");
+        {
+            FILE *file = tmpfile();
+            X.print(file, Runner::BSLBENCH_TABLE);
+            const bsl::string TABLE = readFile(file);
+            fclose(file);
+
+            if (veryVerbose) printf("%s", TABLE.c_str());
+
+            ASSERT(3 == countLines(TABLE));
+
+            const size_t first  = TABLE.find('\n') + 1;
+            const size_t second = TABLE.find('\n', first) + 1;
+            ASSERT(0 == TABLE.compare(first, 8, "fixed,4 "));
+            ASSERT(0 == TABLE.compare(second - 3, 3, " -\n"));
+            ASSERT(0 == TABLE.compare(TABLE.size() - 2, 2, "%\n"));
+            ASSERT(bsl::string::npos != TABLE.find(" 1400 "));
+        }
+
+        if (verbose) printf("\tCSV format.\n");
+        {
+            FILE *file = tmpfile();
+            X.print(file, Runner::BSLBENCH_CSV);
+            const bsl::string CSV = readFile(file);
+            fclose(file);
+
+            if (veryVerbose) printf("%s", CSV.c_str());
+
+            ASSERT(3 == countLines(CSV));
+
+            const size_t first  = CSV.find('\n') + 1;
+            const size_t second = CSV.find('\n', first) + 1;
+
+            const char SHARED[] = "\"fixed,4\",4,shared,";
+            const char RESERVING[] =
+                                   "\"fixed,4\",4,\"reserving \"\"1000\"\"\",";
+            ASSERT(0 == CSV.compare(first,  sizeof SHARED - 1, SHARED));
+            ASSERT(0 == CSV.compare(second, sizeof RESERVING - 1, RESERVING));
+
+            // The shared allocator has no footprint and an empty
+            // fragmentation; the reserving allocator holds the reserve and
+            // four blocks of 100 bytes at its peak.
+
+            ASSERT(bsl::string::npos != CSV.find(",5,", first));
+            ASSERT(bsl::string::npos != CSV.find(",5,", second));
+            ASSERT(bsl::string::npos != CSV.find(",400,0,\n"));
+            ASSERT(bsl::string::npos != CSV.find(",400,1400,0.7143\n"));
+        }
+
+        if (verbose) printf("\tJSON format.\n");
+        {
+            FILE *file = tmpfile();
+            X.print(file, Runner::BSLBENCH_JSON);
+            const bsl::string JSON = readFile(file);
+            fclose(file);
+
+            if (veryVerbose) printf("%s", JSON.c_str());
+
+            ASSERT(0 == JSON.find("{\n  \"allocator_sweep\": [\n"
+                                  "    {\"workload\": \"fixed,4\", "
+                                  "\"size\": 4, \"allocator\": \"shared\", "
+                                  "\"median_ns\": "));
+            ASSERT(bsl::string::npos != JSON.find(
+                       "\"allocations\": 5, \"allocations_per_s\": "));
+            ASSERT(bsl::string::npos != JSON.find(
+                       "\"peak_in_use_bytes\": 400, "
+                       "\"peak_footprint_bytes\": 0, "
+                       "\"fragmentation\": null},\n"
+                       "    {\"workload\": \"fixed,4\", \"size\": 4, "
+                       "\"allocator\": \"reserving \\\"1000\\\"\", "));
+            ASSERT(bsl::string::npos != JSON.find(
+                       "\"peak_footprint_bytes\": 1400, "
+                       "\"fragmentation\": 0.7143}\n  ]\n}\n"));
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            FILE *file = tmpfile();
+            ASSERT_PASS(X.print(file, Runner::BSLBENCH_CSV));
+            ASSERT_FAIL(X.print(0, Runner::BSLBENCH_CSV));
+            fclose(file);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'run'
+        //
+        // Concerns:
+        //: 1 Each workload is run against each allocator, the results being
+        //:   ordered by workload, then by allocator.
+        //:
+        //: 2 The number of allocations and the peak bytes in use are those of
+        //:   the workload, whatever the allocator.
+        //:
+        //: 3 The peak footprint is the peak memory drawn by the allocator
+        //:   from its upstream allocator, or 0 if it draws none, and the
+        //:   fragmentation is computed from it, or negative if it is 0.
+        //:
+        //: 4 The runner records one result per pair, named
+        //:   "<workload>/<size>/<allocator>", and the median time and the
+        //:   throughput of the sweep are consistent with it.
+        //:
+        //: 5 Pairs whose name does not match the filter of the runner are
+        //:   skipped.
+        //:
+        //: 6 Every allocator created by a factory is deleted.
+        //:
+        //: 7 The bookkeeping of the sweep uses the allocator of the sweep,
+        //:   and not the default allocator.
+        //:
+        //: 8 'clearResults' removes the results.
+        //:
+        //: 9 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Run a workload making a known sequence of allocations, with two
+        //:   sizes, against a shared test allocator and a reserving
+        //:   allocator, and verify every measurement.  (C-1..4, 6..8)
+        //:
+        //: 2 Set a filter on the runner and run again.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-9)
+        //
+        // Testing:
+        //   void clearResults();
+        //   void run(Runner *runner);
+        //   int numResults() const;
+        //   const AllocatorSweepResult& result(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'run'"
+                            "\n=====\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator ra("runner", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("shared", veryVeryVeryVerbose);
+
+        SharedFactory    shared(&ta);
+        ReservingFactory reserving;
+
+        Runner runner(&ra);
+        setQuick(&runner);
+
+        Obj mX(&sa);  const Obj& X = mX;
+        mX.addAllocator("shared", &shared);
+        mX.addAllocator("reserving", &reserving);
+        mX.addWorkload("fixed", &fixedWorkload, 3);
+        mX.addWorkload("fixed", &fixedWorkload, 5);
+
+        if (verbose) printf("\tMeasurements.\n");
+
+        mX.run(&runner);
+
+        ASSERT(0 == ReservingAllocator::s_numLive);
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 <  ta.numAllocations());
+        ASSERT(0 == da.numBlocksTotal());
+
+        ASSERTV(X.numResults(), 4 == X.numResults());
+        ASSERTV(runner.numResults(), 4 == runner.numResults());
+
+        static const struct {
+            int         d_line;
+            const char *d_allocator_p;
+            int         d_size;
+            Int64       d_footprint;
+            const char *d_name_p;
+        } DATA[] = {
+            //LINE  ALLOCATOR     SIZE  FOOTPRINT  NAME
+            //----  -----------   ----  ---------  -------------------
+            { L_,   "shared",     3,       0,      "fixed/3/shared"    },
+            { L_,   "reserving",  3,    1300,      "fixed/3/reserving" },
+            { L_,   "shared",     5,       0,      "fixed/5/shared"    },
+            { L_,   "reserving",  5,    1500,      "fixed/5/reserving" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE      = DATA[ti].d_line;
+            const char  *ALLOCATOR = DATA[ti].d_allocator_p;
+            const int    SIZE      = DATA[ti].d_size;
+            const Int64  FOOTPRINT = DATA[ti].d_footprint;
+            const char  *NAME      = DATA[ti].d_name_p;
+
+            const Result& R = X.result(ti);
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(R.d_medianTime) P_(R.d_numAllocations)
+                P_(R.d_peakBytesInUse) P_(R.d_peakFootprint)
+                P(R.d_fragmentation)
+            }
+
+            ASSERTV(LINE, 0 == strcmp("fixed", R.d_workloadName_p));
+            ASSERTV(LINE, 0 == strcmp(ALLOCATOR, R.d_allocatorName_p));
+            ASSERTV(LINE, SIZE == R.d_size);
+            ASSERTV(LINE, SIZE + 1 == R.d_numAllocations);
+            ASSERTV(LINE, 100 * SIZE == R.d_peakBytesInUse);
+            ASSERTV(LINE, FOOTPRINT == R.d_peakFootprint);
+
+            if (FOOTPRINT) {
+                const double EXPECTED =
+                          1.0 - 100.0 * SIZE / static_cast<double>(FOOTPRINT);
+                ASSERTV(LINE, R.d_fragmentation,
+                        EXPECTED - 1e-9 < R.d_fragmentation &&
+                        R.d_fragmentation < EXPECTED + 1e-9);
+            }
+            else {
+                ASSERTV(LINE, R.d_fragmentation < 0);
+            }
+
+            const bslbench::Result& TIMING = runner.result(ti);
+            ASSERTV(LINE, 0 == strcmp(NAME, TIMING.d_name_p));
+            ASSERTV(LINE, TIMING.d_median == R.d_medianTime);
+            ASSERTV(LINE, 0 <= R.d_medianTime);
+            if (0 < R.d_medianTime) {
+                const double EXPECTED = (SIZE + 1) * 1.0e9 / R.d_medianTime;
+                ASSERTV(LINE, R.d_allocationsPerSecond,
+                        EXPECTED * 0.999 < R.d_allocationsPerSecond &&
+                        R.d_allocationsPerSecond < EXPECTED * 1.001);
+            }
+        }
+
+        if (verbose) printf("\t'clearResults'.\n");
+        {
+            mX.clearResults();
+            ASSERT(0 == X.numResults());
+            ASSERT(4 == runner.numResults());
+
+            // The names held by the runner remain valid.
+
+            ASSERT(0 == strcmp("fixed/3/shared", runner.result(0).d_name_p));
+        }
+
+        if (verbose) printf("\tFilter.\n");
+        {
+            runner.setFilter("/reserving");
+            mX.run(&runner);
+
+            ASSERT(2 == X.numResults());
+            ASSERT(6 == runner.numResults());
+            ASSERT(3 == X.result(0).d_size);
+            ASSERT(5 == X.result(1).d_size);
+            ASSERT(0 == strcmp("reserving", X.result(0).d_allocatorName_p));
+            ASSERT(0 == strcmp("reserving", X.result(1).d_allocatorName_p));
+
+            runner.setFilter("5/reserving");
+            mX.clearResults();
+            mX.run(&runner);
+
+            ASSERT(1 == X.numResults());
+            ASSERT(0 == strcmp("reserving", X.result(0).d_allocatorName_p));
+            ASSERT(5 == X.result(0).d_size);
+
+            runner.setFilter("nothing");
+            mX.clearResults();
+            mX.run(&runner);
+
+            ASSERT(0 == X.numResults());
+        }
+
+        ASSERT(0 == ReservingAllocator::s_numLive);
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(mX.run(&runner));
+            ASSERT_FAIL(mX.run(0));
+
+            ASSERT_SAFE_FAIL(X.result(-1));
+            ASSERT_SAFE_FAIL(X.result(X.numResults()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS, ADDERS, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed sweep has no allocators, no workloads, and
+        //:   no results.
+        //:
+        //: 2 The allocator is the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 3 Each adder increments the corresponding count, and no other.
+        //:
+        //: 4 'addDefaultWorkloads' adds the four documented workloads, with
+        //:   the documented names and sizes.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create sweeps with and without an allocator, add allocators and
+        //:   workloads, and verify the accessors.  (C-1..3)
+        //:
+        //: 2 Add the default workloads, and run each, selected by a filter
+        //:   naming it, against a test allocator.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   explicit AllocatorSweep(bslma::Allocator *basicAllocator = 0);
+        //   ~AllocatorSweep();
+        //   void addAllocator(const char *name, AllocatorFactory *factory);
+        //   void addDefaultWorkloads();
+        //   void addWorkload(const char *, WorkloadFunction, int);
+        //   int numAllocators() const;
+        //   int numWorkloads() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, ADDERS, AND BASIC ACCESSORS"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        SharedFactory factory(&bslma::NewDeleteAllocator::singleton());
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+        }
+        const Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+            ASSERT(&sa == X.allocator());
+            ASSERT(0 == X.numAllocators());
+            ASSERT(0 == X.numWorkloads());
+            ASSERT(0 == X.numResults());
+
+            mX.addAllocator("a", &factory);
+            ASSERT(1 == X.numAllocators());
+            ASSERT(0 == X.numWorkloads());
+
+            mX.addWorkload("w", &Workload::buildContainers, 0);
+            ASSERT(1 == X.numAllocators());
+            ASSERT(1 == X.numWorkloads());
+
+            mX.addAllocator("b", &factory);
+            mX.addWorkload("x", &Workload::serveRequest, 10);
+            mX.addWorkload("y", &Workload::churnRandomSizes, 20);
+            ASSERT(2 == X.numAllocators());
+            ASSERT(3 == X.numWorkloads());
+            ASSERT(0 == X.numResults());
+
+            mX.addDefaultWorkloads();
+            ASSERT(2 == X.numAllocators());
+            ASSERT(7 == X.numWorkloads());
+        }
+
+        if (verbose) printf("\tDefault workloads.\n");
+        {
+            // Run the default workloads against a test allocator, with a
+            // filter selecting each in turn, to verify their names and sizes.
+
+            bslma::TestAllocator ta("shared", veryVeryVeryVerbose);
+            SharedFactory        shared(&ta);
+
+            Runner runner(&sa);
+            setQuick(&runner);
+
+            Obj mX(&sa);  const Obj& X = mX;
+            mX.addAllocator("test", &shared);
+            mX.addDefaultWorkloads();
+            ASSERT(4 == X.numWorkloads());
+
+            static const struct {
+                int         d_line;
+                const char *d_filter_p;
+                int         d_size;
+            } DATA[] = {
+                //LINE  FILTER                     SIZE
+                //----  -----------------------    ------
+                { L_,   "containers/1000/test",      1000 },
+                { L_,   "churn/100000/test",       100000 },
+                { L_,   "queue/100000/test",       100000 },
+                { L_,   "request/1000/test",         1000 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const char *FILTER = DATA[ti].d_filter_p;
+                const int   SIZE   = DATA[ti].d_size;
+
+                runner.setFilter(FILTER);
+                mX.clearResults();
+                mX.run(&runner);
+
+                ASSERTV(LINE, 1 == X.numResults());
+                ASSERTV(LINE, SIZE == X.result(0).d_size);
+                ASSERTV(LINE, 0 < X.result(0).d_numAllocations);
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+        ASSERT(NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&sa);
+
+            ASSERT_PASS(mX.addAllocator("a", &factory));
+            ASSERT_FAIL(mX.addAllocator(0, &factory));
+            ASSERT_FAIL(mX.addAllocator("a", 0));
+
+            ASSERT_PASS(mX.addWorkload("w", &Workload::serveRequest, 0));
+            ASSERT_FAIL(mX.addWorkload(0, &Workload::serveRequest, 0));
+            ASSERT_FAIL(mX.addWorkload("w", 0, 0));
+            ASSERT_FAIL(mX.addWorkload("w", &Workload::serveRequest, -1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FACTORIES
+        //
+        // Concerns:
+        //: 1 'AllocatorFactoryImp' constructs a new 'ALLOCATOR' with the
+        //:   upstream allocator, without allocating memory, and
+        //:   'deleteAllocator' destroys it.
+        //:
+        //: 2 'SharedAllocatorFactory' supplies its allocator, whatever the
+        //:   upstream allocator, and 'deleteAllocator' leaves it valid.
+        //:
+        //: 3 Both are usable through the 'AllocatorFactory' protocol.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create and delete allocators through each factory, using a
+        //:   reference to the protocol, and verify the allocators, the number
+        //:   of 'ReservingAllocator' objects alive, and the memory drawn from
+        //:   test allocators.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   AllocatorFactoryImp();
+        //   virtual bslma::Allocator *createAllocator(bslma::Allocator *);
+        //   virtual void deleteAllocator(bslma::Allocator *allocator);
+        //   explicit SharedAllocatorFactory(bslma::Allocator *allocator);
+        //   virtual bslma::Allocator *createAllocator(bslma::Allocator *);
+        //   virtual void deleteAllocator(bslma::Allocator *allocator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFACTORIES"
+                            "\n=========\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("shared", veryVeryVeryVerbose);
+
+        if (verbose) printf("\t'AllocatorFactoryImp'.\n");
+        {
+            ReservingFactory                  mF;
+            bslbench::AllocatorFactory& F = mF;
+
+            for (int i = 0; i < 3; ++i) {
+                bslma::Allocator *a = F.createAllocator(&ua);
+                ASSERTV(i, 1 == ReservingAllocator::s_numLive);
+                ASSERTV(i, ReservingAllocator::k_RESERVE ==
+                                                         ua.numBytesInUse());
+                ASSERTV(i, &ua ==
+                         dynamic_cast<ReservingAllocator *>(a)->upstream());
+
+                F.deleteAllocator(a);
+                ASSERTV(i, 0 == ReservingAllocator::s_numLive);
+                ASSERTV(i, 0 == ua.numBytesInUse());
+            }
+        }
+
+        if (verbose) printf("\t'SharedAllocatorFactory'.\n");
+        {
+            SharedFactory               mF(&sa);
+            bslbench::AllocatorFactory& F = mF;
+
+            bslma::Allocator *a = F.createAllocator(&ua);
+            ASSERT(&sa == a);
+            ASSERT(&sa == F.createAllocator(0));
+
+            F.deleteAllocator(a);
+            a->deallocate(a->allocate(10));
+            ASSERT(1 == sa.numAllocations());
+            ASSERT(3 == ua.numAllocations());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS((void)SharedFactory(&sa));
+            ASSERT_SAFE_FAIL((void)SharedFactory(0));
+
+            SharedFactory mF(&sa);
+            ASSERT_SAFE_PASS(mF.deleteAllocator(&sa));
+            ASSERT_SAFE_FAIL(mF.deleteAllocator(&ua));
+
+            ReservingFactory  mR;
+            bslma::Allocator *a = mR.createAllocator(&ua);
+            ASSERT_SAFE_FAIL(mR.deleteAllocator(&ua));
+            mR.deleteAllocator(a);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Run every workload against a shared and a created allocator, and
+        //:   print the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        SharedFactory    newDelete(&bslma::NewDeleteAllocator::singleton());
+        ReservingFactory reserving;
+
+        Runner runner;
+        setQuick(&runner);
+
+        Obj mX;  const Obj& X = mX;
+        mX.addAllocator("newdelete", &newDelete);
+        mX.addAllocator("reserving", &reserving);
+        mX.addWorkload("containers", &Workload::buildContainers, 100);
+        mX.addWorkload("churn", &Workload::churnRandomSizes, 100);
+        mX.addWorkload("queue", &Workload::produceAndConsume, 100);
+        mX.addWorkload("request", &Workload::serveRequest, 100);
+        mX.run(&runner);
+
+        ASSERT(8 == X.numResults());
+        ASSERT(0 == ReservingAllocator::s_numLive);
+        for (int i = 0; i < X.numResults(); ++i) {
+            ASSERTV(i, 0 < X.result(i).d_numAllocations);
+            ASSERTV(i, 0 < X.result(i).d_peakBytesInUse);
+        }
+
+        if (verbose) {
+            X.print(stdout, Runner::BSLBENCH_TABLE);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,248 @@
+// bslbench_allocatorworkload.cpp                                     -*-C++-*-
+#include <bslbench_allocatorworkload.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslbench_runner.h>
+
+#include <bslstl_map.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmap.h>
+#include <bslstl_vector.h>
+
+#include <bsls_assert.h>
+
+#include <string.h>
+
+namespace BloombergLP {
+namespace bslbench {
+
+namespace {
+
+enum {
+    k_QUEUE_CAPACITY = 64,    // messages in flight in 'produceAndConsume'
+    k_NUM_SLOTS      = 1024   // live blocks in 'churnRandomSizes'
+};
+
+class Random {
+    // This class implements a linear congruential generator, so that the
+    // workloads draw the same sequence of values on every platform.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed)
+    : d_state(seed)
+        // Create a generator with the specified 'seed'.
+    {
+    }
+
+    // MANIPULATORS
+    unsigned int next(unsigned int limit)
+        // Return the next value of the sequence, in the range '[0 .. limit)'.
+        // The behavior is undefined unless '0 < limit'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return (d_state >> 8) % limit;
+    }
+};
+
+int blockSize(Random *random)
+    // Return a random block size drawn using the specified 'random'
+    // generator: three times in four between 8 and 128 bytes, otherwise
+    // between 129 and 1024 bytes or, once in sixteen times, between 1025 and
+    // 8192 bytes.
+{
+    const unsigned int kind = random->next(16);
+    if (kind < 12) {
+        return static_cast<int>(8 + random->next(121));               // RETURN
+    }
+    if (kind < 15) {
+        return static_cast<int>(129 + random->next(896));             // RETURN
+    }
+    return static_cast<int>(1025 + random->next(7168));
+}
+
+void formatField(char *buffer, int index)
+    // Load into the specified 'buffer' a null-terminated header field name
+    // ending with the decimal digits of the specified 'index'.  The behavior
+    // is undefined unless 'buffer' has room for 32 characters and
+    // '0 <= index'.
+{
+    static const char k_PREFIX[] = "x-request-header-";
+    memcpy(buffer, k_PREFIX, sizeof k_PREFIX - 1);
+
+    char  digits[16];
+    char *end = digits + sizeof digits;
+    char *p   = end;
+    do {
+        *--p   = static_cast<char>('0' + index % 10);
+        index /= 10;
+    } while (index);
+
+    char *out = buffer + sizeof k_PREFIX - 1;
+    while (p != end) {
+        *out++ = *p++;
+    }
+    *out = '\0';
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // struct AllocatorWorkload
+                          // ------------------------
+
+// CLASS METHODS
+void AllocatorWorkload::buildContainers(bslma::Allocator *allocator, int size)
+{
+    BSLS_ASSERT(allocator);
+    BSLS_ASSERT(0 <= size);
+
+    static const char k_VALUE[] = "a value too long for the short string";
+
+    bsl::vector<int> vector(allocator);
+    for (int i = 0; i < size; ++i) {
+        vector.push_back(i);
+    }
+    Runner::doNotOptimize(&vector);
+
+    bsl::map<int, bsl::string> map(allocator);
+    for (int i = 0; i < size; ++i) {
+        map[i] = k_VALUE;
+    }
+    Runner::doNotOptimize(&map);
+
+    bsl::unordered_map<int, int> hashMap(allocator);
+    for (int i = 0; i < size; ++i) {
+        hashMap[i] = i;
+    }
+    Runner::doNotOptimize(&hashMap);
+}
+
+void AllocatorWorkload::churnRandomSizes(bslma::Allocator *allocator,
+                                         int               size)
+{
+    BSLS_ASSERT(allocator);
+    BSLS_ASSERT(0 <= size);
+
+    Random  random(2);
+    void   *slots[k_NUM_SLOTS] = { 0 };
+
+    for (int i = 0; i < size; ++i) {
+        void *&slot = slots[random.next(k_NUM_SLOTS)];
+        allocator->deallocate(slot);
+
+        const int length = blockSize(&random);
+        slot = allocator->allocate(length);
+        memset(slot, i, 8);
+    }
+    Runner::doNotOptimize(slots);
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        allocator->deallocate(slots[i]);
+    }
+}
+
+void AllocatorWorkload::produceAndConsume(bslma::Allocator *allocator,
+                                          int               size)
+{
+    BSLS_ASSERT(allocator);
+    BSLS_ASSERT(0 <= size);
+
+    Random        random(3);
+    char         *queue[k_QUEUE_CAPACITY];
+    int           head     = 0;  // index of the oldest message
+    int           length   = 0;  // number of messages in the queue
+    int           produced = 0;
+    unsigned int  checksum = 0;
+
+    while (produced < size || length) {
+        // Produce a burst, up to the capacity of the queue.
+
+        int burst = static_cast<int>(1 + random.next(k_QUEUE_CAPACITY));
+        while (burst-- && length < k_QUEUE_CAPACITY && produced < size) {
+            const int messageSize = static_cast<int>(16 + random.next(497));
+            char *message = static_cast<char *>(
+                                          allocator->allocate(messageSize));
+            memset(message, produced, 16);
+            message[messageSize - 1] = 0;
+
+            queue[(head + length) % k_QUEUE_CAPACITY] = message;
+            ++length;
+            ++produced;
+        }
+
+        // Consume a burst, up to the whole queue.
+
+        burst = static_cast<int>(1 + random.next(k_QUEUE_CAPACITY));
+        while (burst-- && length) {
+            char *message = queue[head];
+            checksum += static_cast<unsigned char>(message[0]);
+            allocator->deallocate(message);
+
+            head = (head + 1) % k_QUEUE_CAPACITY;
+            --length;
+        }
+    }
+    Runner::doNotOptimize(&checksum);
+}
+
+void AllocatorWorkload::serveRequest(bslma::Allocator *allocator, int size)
+{
+    BSLS_ASSERT(allocator);
+    BSLS_ASSERT(0 <= size);
+
+    static const char k_VALUE[] = "text/plain; charset=utf-8; q=0.9";
+
+    bsl::vector<bsl::string>           fields(allocator);
+    bsl::map<bsl::string, bsl::string> headers(allocator);
+    bsl::string                        response(allocator);
+
+    char name[32];
+    for (int i = 0; i < size; ++i) {
+        formatField(name, i);
+        fields.push_back(name);
+        headers[fields.back()] = k_VALUE;
+    }
+
+    response = "HTTP/1.1 200 OK\r\n";
+    for (bsl::map<bsl::string, bsl::string>::const_iterator it =
+                                                            headers.begin();
+         it != headers.end();
+         ++it) {
+        response.append(it->first);
+        response.append(": ");
+        response.append(it->second);
+        response.append("\r\n");
+    }
+    Runner::doNotOptimize(&response);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
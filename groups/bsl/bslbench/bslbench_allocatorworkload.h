@@ -0,0 +1,149 @@
+// bslbench_allocatorworkload.h                                       -*-C++-*-
+#ifndef INCLUDED_BSLBENCH_ALLOCATORWORKLOAD
+#define INCLUDED_BSLBENCH_ALLOCATORWORKLOAD
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide allocation workloads that run on any 'bslma::Allocator'.
+//
+//@CLASSES:
+//  bslbench::AllocatorWorkload: namespace for allocation workload functions
+//
+//@SEE_ALSO: bslbench_allocatorsweep, bslma_allocator
+//
+//@DESCRIPTION: This component provides a 'struct', 'AllocatorWorkload', that
+// serves as a namespace for functions exercising an allocator with patterns
+// of allocation typical of real programs.  Each workload takes the address
+// of a 'bslma::Allocator', through which it obtains all of its memory, and a
+// 'size' scaling the amount of work done.  Each workload returns all of the
+// memory it allocates before returning, and performs the same sequence of
+// allocations every time it is called with the same 'size' (random sizes
+// and orders are drawn from a fixed-seed generator), so that measurements
+// of different allocators are comparable.  The workloads are:
+//
+//: 'buildContainers': Build a 'bsl::vector<int>', a
+//:   'bsl::map<int, bsl::string>', and a 'bsl::unordered_map<int, int>', of
+//:   'size' elements each, then destroy them.  This is dominated by one
+//:   allocation of a few dozen bytes per string, and by the geometric growth
+//:   of contiguous buffers and of the node pools of the containers.
+//:
+//: 'produceAndConsume': Pass 'size' messages of 16 to 512 bytes through a
+//:   bounded queue, the producer and the consumer taking turns in bursts of
+//:   random length.  Memory is deallocated in the order it was allocated,
+//:   long after, which defeats allocators that favor last-in, first-out
+//:   reuse.
+//:
+//: 'churnRandomSizes': Keep a table of live blocks and, 'size' times, free
+//:   a random block and allocate a block of random size in its place.  Sizes
+//:   are mostly small (up to 128 bytes) with a tail up to 8 kilobytes, which
+//:   exposes fragmentation.
+//:
+//: 'serveRequest': Handle a request of 'size' header fields: tokenize,
+//:   index the fields in a 'bsl::map', and format a response, all in objects
+//:   that live until the end of the request.  This is the pattern served by
+//:   a request-scoped arena, whose deallocations are no-ops and whose memory
+//:   is released at once when it is destroyed.
+//
+// The workloads are single-threaded: the producer and consumer of
+// 'produceAndConsume' alternate in one thread, so that the workload measures
+// the pattern of allocation, and not synchronization.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Memory Used by a Workload
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the largest amount of memory that
+// 'churnRandomSizes' holds at once.  We run the workload with a
+// 'bslma::TestAllocator', which records the number of bytes in use:
+//..
+//  bslma::TestAllocator ta;
+//  bslbench::AllocatorWorkload::churnRandomSizes(&ta, 10000);
+//..
+// Then, we verify that all the memory was returned, and look at the peak:
+//..
+//  assert(0 == ta.numBytesInUse());
+//  assert(0 <  ta.numBytesMax());
+//  assert(10000 == ta.numAllocations());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+namespace BloombergLP {
+namespace bslbench {
+
+                          // ========================
+                          // struct AllocatorWorkload
+                          // ========================
+
+struct AllocatorWorkload {
+    // This 'struct' provides a namespace for workload functions that
+    // exercise a 'bslma::Allocator' with typical patterns of allocation.
+    // See the component documentation for a description of each.
+
+    // TYPES
+    typedef void (*Function)(bslma::Allocator *allocator, int size);
+        // A 'Function' runs a workload scaled by the specified 'size',
+        // obtaining memory from the specified 'allocator'.
+
+    // CLASS METHODS
+    static void buildContainers(bslma::Allocator *allocator, int size);
+        // Build a vector, a map, and an unordered map of the specified 'size'
+        // elements each using the specified 'allocator', then destroy them.
+        // The behavior is undefined unless '0 != allocator' and '0 <= size'.
+
+    static void churnRandomSizes(bslma::Allocator *allocator, int size);
+        // Replace a random block in a table of live blocks with a block of
+        // random size the specified 'size' times using the specified
+        // 'allocator', then free all the blocks.  The behavior is undefined
+        // unless '0 != allocator' and '0 <= size'.
+
+    static void produceAndConsume(bslma::Allocator *allocator, int size);
+        // Pass the specified 'size' messages of random size, allocated from
+        // the specified 'allocator', through a bounded queue, deallocating
+        // each when it is consumed.  The behavior is undefined unless
+        // '0 != allocator' and '0 <= size'.
+
+    static void serveRequest(bslma::Allocator *allocator, int size);
+        // Serve a request of the specified 'size' header fields, allocating
+        // all the objects of the request from the specified 'allocator', and
+        // destroying them when done.  The behavior is undefined unless
+        // '0 != allocator' and '0 <= size'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
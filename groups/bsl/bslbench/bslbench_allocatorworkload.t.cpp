@@ -0,0 +1,499 @@
+// bslbench_allocatorworkload.t.cpp                                   -*-C++-*-
+#include <bslbench_allocatorworkload.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides functions whose only observable effect
+// is the sequence of allocations they make.  Each is run with a
+// 'bslma::TestAllocator', which records the number of allocations and the
+// number of bytes in use, to verify that all memory is returned, that the
+// sequence is the same on every call, and that it scales with the size of
+// the workload as documented.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static void buildContainers(bslma::Allocator *allocator, int size);
+// [ 3] static void churnRandomSizes(bslma::Allocator *allocator, int size);
+// [ 4] static void produceAndConsume(bslma::Allocator *allocator, int size);
+// [ 5] static void serveRequest(bslma::Allocator *allocator, int size);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslbench::AllocatorWorkload Obj;
+typedef bsls::Types::Int64          Int64;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Footprint {
+    // This 'struct' holds the counts recorded by a test allocator for one
+    // run of a workload.
+
+    Int64 d_numAllocations;
+    Int64 d_numBytesMax;
+    Int64 d_numBytesTotal;
+};
+
+Footprint measure(Obj::Function function, int size)
+    // Run the specified 'function' with the specified 'size' using a test
+    // allocator, verify that it returns all the memory it allocates, and
+    // return the counts recorded by the allocator.
+{
+    bslma::TestAllocator ta("workload", veryVeryVeryVerbose);
+
+    function(&ta, size);
+
+    ASSERTV(size, ta.numBytesInUse(), 0 == ta.numBytesInUse());
+    ASSERTV(size, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+    Footprint result = { ta.numAllocations(),
+                         ta.numBytesMax(),
+                         ta.numBytesTotal() };
+    return result;
+}
+
+void verifyCommonProperties(Obj::Function function)
+    // Verify that the specified 'function' returns all its memory, makes the
+    // same allocations every time it is run with a given size, and makes
+    // more allocations when run with a larger size.  Also verify that, in
+    // appropriate build modes, defensive checks are triggered for invalid
+    // arguments.
+{
+    static const int SIZES[] = { 0, 1, 2, 10, 100, 1000 };
+    const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+    Int64 previousAllocations = -1;
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int SIZE = SIZES[ti];
+
+        const Footprint X = measure(function, SIZE);
+        const Footprint Y = measure(function, SIZE);
+
+        if (veryVerbose) {
+            T_ P_(SIZE) P_(X.d_numAllocations) P(X.d_numBytesMax)
+        }
+
+        ASSERTV(SIZE, X.d_numAllocations == Y.d_numAllocations);
+        ASSERTV(SIZE, X.d_numBytesMax    == Y.d_numBytesMax);
+        ASSERTV(SIZE, X.d_numBytesTotal  == Y.d_numBytesTotal);
+
+        ASSERTV(SIZE, previousAllocations <= X.d_numAllocations);
+        if (SIZE >= 10) {
+            ASSERTV(SIZE, previousAllocations < X.d_numAllocations);
+        }
+        previousAllocations = X.d_numAllocations;
+    }
+
+    if (verbose) printf("\tNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        bslma::TestAllocator ta("negative", veryVeryVeryVerbose);
+
+        ASSERT_PASS(function(&ta, 0));
+        ASSERT_FAIL(function(0, 0));
+        ASSERT_FAIL(function(&ta, -1));
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    setbuf(stdout, NULL);    // Use unbuffered output.
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Memory Used by a Workload
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the largest amount of memory that
+// 'churnRandomSizes' holds at once.  We run the workload with a
+// 'bslma::TestAllocator', which records the number of bytes in use:
+//..
+    bslma::TestAllocator ta;
+    bslbench::AllocatorWorkload::churnRandomSizes(&ta, 10000);
+//..
+// Then, we verify that all the memory was returned, and look at the peak:
+//..
+    ASSERT(0 == ta.numBytesInUse());
+    ASSERT(0 <  ta.numBytesMax());
+    ASSERT(10000 == ta.numAllocations());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'serveRequest'
+        //
+        // Concerns:
+        //: 1 The workload returns all the memory it allocates.
+        //:
+        //: 2 The workload makes the same allocations on every call with a
+        //:   given size, and more allocations with a larger size.
+        //:
+        //: 3 The objects of a request are all live at the end of the request,
+        //:   so that the peak memory in use grows with the size.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Run the workload with a test allocator for several sizes, twice
+        //:   each, and compare the counts of the test allocator.  (C-1..2, 4)
+        //:
+        //: 2 Verify that the peak number of bytes in use grows at least
+        //:   linearly with the size.  (C-3)
+        //
+        // Testing:
+        //   static void serveRequest(bslma::Allocator *allocator, int size);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'serveRequest'"
+                            "\n==============\n");
+
+        verifyCommonProperties(&Obj::serveRequest);
+
+        if (verbose) printf("\tPeak memory in use.\n");
+        {
+            // Each header field has a name and a value in the map, and the
+            // field name is also held in the vector of fields.
+
+            const Footprint X = measure(&Obj::serveRequest, 100);
+            const Footprint Y = measure(&Obj::serveRequest, 1000);
+
+            ASSERTV(X.d_numBytesMax, 100 * 3 * 16 < X.d_numBytesMax);
+            ASSERTV(X.d_numBytesMax, Y.d_numBytesMax,
+                    9 * X.d_numBytesMax < Y.d_numBytesMax);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'produceAndConsume'
+        //
+        // Concerns:
+        //: 1 The workload returns all the memory it allocates.
+        //:
+        //: 2 The workload makes the same allocations on every call with a
+        //:   given size, and exactly one allocation per message.
+        //:
+        //: 3 At most 64 messages of at most 512 bytes are in flight at once.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Run the workload with a test allocator for several sizes, twice
+        //:   each, and compare the counts of the test allocator with the
+        //:   documented properties.  (C-1..4)
+        //
+        // Testing:
+        //   static void produceAndConsume(bslma::Allocator *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'produceAndConsume'"
+                            "\n===================\n");
+
+        verifyCommonProperties(&Obj::produceAndConsume);
+
+        if (verbose) printf("\tCounts and bounds.\n");
+
+        static const int SIZES[] = { 0, 1, 63, 64, 65, 1000, 10000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            const Footprint X = measure(&Obj::produceAndConsume, SIZE);
+
+            ASSERTV(SIZE, X.d_numAllocations, SIZE == X.d_numAllocations);
+            ASSERTV(SIZE, X.d_numBytesMax, X.d_numBytesMax <= 64 * 512);
+            ASSERTV(SIZE, X.d_numBytesTotal,
+                    16 * SIZE <= X.d_numBytesTotal &&
+                    X.d_numBytesTotal <= 512 * SIZE);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'churnRandomSizes'
+        //
+        // Concerns:
+        //: 1 The workload returns all the memory it allocates.
+        //:
+        //: 2 The workload makes the same allocations on every call with a
+        //:   given size, and exactly one allocation per replacement.
+        //:
+        //: 3 At most 1024 blocks of at most 8 kilobytes are live at once,
+        //:   and most blocks are small.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Run the workload with a test allocator for several sizes, twice
+        //:   each, and compare the counts of the test allocator with the
+        //:   documented properties.  (C-1..4)
+        //
+        // Testing:
+        //   static void churnRandomSizes(bslma::Allocator *allocator, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'churnRandomSizes'"
+                            "\n==================\n");
+
+        verifyCommonProperties(&Obj::churnRandomSizes);
+
+        if (verbose) printf("\tCounts and bounds.\n");
+
+        static const int SIZES[] = { 0, 1, 1023, 1024, 1025, 10000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            const Footprint X = measure(&Obj::churnRandomSizes, SIZE);
+
+            ASSERTV(SIZE, X.d_numAllocations, SIZE == X.d_numAllocations);
+            ASSERTV(SIZE, X.d_numBytesMax, X.d_numBytesMax <= 1024 * 8192);
+            ASSERTV(SIZE, X.d_numBytesTotal,
+                    8 * SIZE <= X.d_numBytesTotal &&
+                    X.d_numBytesTotal <= 8192 * SIZE);
+
+            // The mean block size is about 900 bytes, far below the middle
+            // of the range of sizes.
+
+            if (1000 <= SIZE) {
+                ASSERTV(SIZE, X.d_numBytesTotal,
+                        X.d_numBytesTotal < 2000 * SIZE);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'buildContainers'
+        //
+        // Concerns:
+        //: 1 The workload returns all the memory it allocates.
+        //:
+        //: 2 The workload makes the same allocations on every call with a
+        //:   given size, and more allocations with a larger size.
+        //:
+        //: 3 The workload makes at least one allocation per element, for the
+        //:   string of each map value, the nodes being pooled by the
+        //:   containers.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Run the workload with a test allocator for several sizes, twice
+        //:   each, and compare the counts of the test allocator.  (C-1..4)
+        //
+        // Testing:
+        //   static void buildContainers(bslma::Allocator *allocator, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'buildContainers'"
+                            "\n=================\n");
+
+        verifyCommonProperties(&Obj::buildContainers);
+
+        if (verbose) printf("\tAllocations per element.\n");
+        {
+            const Footprint X = measure(&Obj::buildContainers, 1000);
+            ASSERTV(X.d_numAllocations, 1000 <= X.d_numAllocations);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The workloads are sufficiently functional to enable
+        //:   comprehensive testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Run each workload with a test allocator and verify that memory
+        //:   was allocated and returned.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const Obj::Function FUNCTIONS[] = { &Obj::buildContainers,
+                                            &Obj::churnRandomSizes,
+                                            &Obj::produceAndConsume,
+                                            &Obj::serveRequest };
+        const int NUM_FUNCTIONS = sizeof FUNCTIONS / sizeof *FUNCTIONS;
+
+        for (int ti = 0; ti < NUM_FUNCTIONS; ++ti) {
+            bslma::TestAllocator ta("workload", veryVeryVeryVerbose);
+
+            FUNCTIONS[ti](&ta, 100);
+
+            ASSERTV(ti, 0 < ta.numAllocations());
+            ASSERTV(ti, 0 == ta.numBytesInUse());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
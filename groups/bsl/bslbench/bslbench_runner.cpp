@@ -0,0 +1,310 @@
+// bslbench_runner.cpp                                                -*-C++-*-
+#include <bslbench_runner.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_nativestd.h>
+#include <bsls_timeutil.h>
+
+#include <algorithm>  // 'native_std::sort'
+
+#include <string.h>
+
+namespace BloombergLP {
+namespace bslbench {
+
+namespace {
+
+typedef bsls::Types::Int64 Int64;
+
+enum { k_MAX_ITERATIONS = 1 << 30 };
+
+Int64 timeCall(Runner::BenchmarkFunction  function,
+               int                        numIterations,
+               void                      *context)
+    // Return the number of nanoseconds taken by calling the specified
+    // 'function' with the specified 'numIterations' and 'context'.
+{
+    const Int64 start = bsls::TimeUtil::getTimer();
+    function(numIterations, context);
+    return bsls::TimeUtil::getTimer() - start;
+}
+
+void printCsvName(FILE *stream, const char *name)
+    // Write the specified 'name' to the specified 'stream' as a CSV field,
+    // quoted if it contains a comma or a double quote.
+{
+    if (0 == strpbrk(name, ",\"")) {
+        fputs(name, stream);
+        return;                                                       // RETURN
+    }
+    fputc('"', stream);
+    for (const char *p = name; *p; ++p) {
+        if ('"' == *p) {
+            fputc('"', stream);
+        }
+        fputc(*p, stream);
+    }
+    fputc('"', stream);
+}
+
+void printJsonName(FILE *stream, const char *name)
+    // Write the specified 'name' to the specified 'stream' as a JSON string.
+{
+    fputc('"', stream);
+    for (const char *p = name; *p; ++p) {
+        if ('"' == *p || '\\' == *p) {
+            fputc('\\', stream);
+            fputc(*p, stream);
+        }
+        else if (static_cast<unsigned char>(*p) < 0x20) {
+            fprintf(stream, "\\u%04x", static_cast<unsigned char>(*p));
+        }
+        else {
+            fputc(*p, stream);
+        }
+    }
+    fputc('"', stream);
+}
+
+}  // close unnamed namespace
+
+                                // ------------
+                                // class Runner
+                                // ------------
+
+// CLASS METHODS
+double Runner::percentile(const double *sortedSamples,
+                          int           numSamples,
+                          double        fraction)
+{
+    BSLS_ASSERT(sortedSamples);
+    BSLS_ASSERT(0 < numSamples);
+    BSLS_ASSERT(0 <= fraction);
+    BSLS_ASSERT(fraction <= 1);
+
+    const double position = fraction * (numSamples - 1);
+    const int    lower    = static_cast<int>(position);
+    if (lower + 1 >= numSamples) {
+        return sortedSamples[numSamples - 1];                         // RETURN
+    }
+
+    const double weight = position - lower;
+    return sortedSamples[lower] * (1 - weight)
+         + sortedSamples[lower + 1] * weight;
+}
+
+// CREATORS
+Runner::Runner(bslma::Allocator *basicAllocator)
+: d_warmupRepetitions(BSLBENCH_DEFAULT_WARMUP_REPETITIONS)
+, d_repetitions(BSLBENCH_DEFAULT_REPETITIONS)
+, d_minRepetitionTime(BSLBENCH_DEFAULT_MIN_REPETITION_TIME)
+, d_filter_p(0)
+, d_results(basicAllocator)
+, d_samples(basicAllocator)
+{
+    bsls::TimeUtil::initialize();
+}
+
+Runner::~Runner()
+{
+}
+
+// MANIPULATORS
+int Runner::run(const char        *name,
+                BenchmarkFunction  function,
+                void              *context)
+{
+    BSLS_ASSERT(name);
+    BSLS_ASSERT(function);
+
+    if (!matchesFilter(name)) {
+        return -1;                                                    // RETURN
+    }
+
+    // Calibrate the number of iterations, growing it by at most a factor of
+    // ten at a time, aiming 20% above the minimum repetition time.
+
+    int   numIterations = 1;
+    Int64 elapsed       = timeCall(function, numIterations, context);
+    while (elapsed < d_minRepetitionTime && numIterations < k_MAX_ITERATIONS) {
+        double scale = elapsed > 0
+                     ? 1.2 * static_cast<double>(d_minRepetitionTime)
+                                                 / static_cast<double>(elapsed)
+                     : 10.0;
+        scale = scale < 2.0 ? 2.0 : scale > 10.0 ? 10.0 : scale;
+
+        const double next = numIterations * scale;
+        numIterations = next < k_MAX_ITERATIONS
+                      ? static_cast<int>(next)
+                      : static_cast<int>(k_MAX_ITERATIONS);
+        elapsed = timeCall(function, numIterations, context);
+    }
+
+    for (int i = 0; i < d_warmupRepetitions; ++i) {
+        function(numIterations, context);
+    }
+
+    d_samples.resize(d_repetitions);
+    double sum = 0;
+    for (int i = 0; i < d_repetitions; ++i) {
+        const Int64 duration = timeCall(function, numIterations, context);
+        d_samples[i] = static_cast<double>(duration) / numIterations;
+        sum += d_samples[i];
+    }
+    native_std::sort(d_samples.begin(), d_samples.end());
+
+    const double *samples = &d_samples[0];
+
+    Result result;
+    result.d_name_p       = name;
+    result.d_iterations   = numIterations;
+    result.d_repetitions  = d_repetitions;
+    result.d_minimum      = samples[0];
+    result.d_median       = percentile(samples, d_repetitions, 0.5);
+    result.d_percentile90 = percentile(samples, d_repetitions, 0.9);
+    result.d_maximum      = samples[d_repetitions - 1];
+    result.d_mean         = sum / d_repetitions;
+
+    d_results.push_back(result);
+    return 0;
+}
+
+void Runner::setMinRepetitionTime(bsls::Types::Int64 nanoseconds)
+{
+    BSLS_ASSERT(0 <= nanoseconds);
+
+    d_minRepetitionTime = nanoseconds;
+}
+
+void Runner::setRepetitions(int numRepetitions)
+{
+    BSLS_ASSERT(0 < numRepetitions);
+
+    d_repetitions = numRepetitions;
+}
+
+void Runner::setWarmupRepetitions(int numRepetitions)
+{
+    BSLS_ASSERT(0 <= numRepetitions);
+
+    d_warmupRepetitions = numRepetitions;
+}
+
+// ACCESSORS
+bool Runner::matchesFilter(const char *name) const
+{
+    BSLS_ASSERT(name);
+
+    return 0 == d_filter_p || 0 != strstr(name, d_filter_p);
+}
+
+void Runner::print(FILE *stream, Format format) const
+{
+    BSLS_ASSERT(stream);
+
+    const int numResults = this->numResults();
+
+    switch (format) {
+      case BSLBENCH_TABLE: {
+        int nameWidth = static_cast<int>(strlen("benchmark"));
+        for (int i = 0; i < numResults; ++i) {
+            const int length = static_cast<int>(strlen(d_results[i].d_name_p));
+            nameWidth = length > nameWidth ? length : nameWidth;
+        }
+
+        fprintf(stream,
+                "%-*s %10s %5s %12s %12s %12s %12s\n",
+                nameWidth,
+                "benchmark",
+                "iterations",
+                "reps",
+                "min ns",
+                "median ns",
+                "p90 ns",
+                "max ns");
+        for (int i = 0; i < numResults; ++i) {
+            const Result& r = d_results[i];
+            fprintf(stream,
+                    "%-*s %10d %5d %12.2f %12.2f %12.2f %12.2f\n",
+                    nameWidth,
+                    r.d_name_p,
+                    r.d_iterations,
+                    r.d_repetitions,
+                    r.d_minimum,
+                    r.d_median,
+                    r.d_percentile90,
+                    r.d_maximum);
+        }
+      } break;
+      case BSLBENCH_CSV: {
+        fputs("name,iterations,repetitions,"
+              "min_ns,median_ns,p90_ns,max_ns,mean_ns\n",
+              stream);
+        for (int i = 0; i < numResults; ++i) {
+            const Result& r = d_results[i];
+            printCsvName(stream, r.d_name_p);
+            fprintf(stream,
+                    ",%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                    r.d_iterations,
+                    r.d_repetitions,
+                    r.d_minimum,
+                    r.d_median,
+                    r.d_percentile90,
+                    r.d_maximum,
+                    r.d_mean);
+        }
+      } break;
+      case BSLBENCH_JSON: {
+        fputs("{\n  \"benchmarks\": [", stream);
+        for (int i = 0; i < numResults; ++i) {
+            const Result& r = d_results[i];
+            fputs(i ? ",\n    {\"name\": " : "\n    {\"name\": ", stream);
+            printJsonName(stream, r.d_name_p);
+            fprintf(stream,
+                    ", \"iterations\": %d, \"repetitions\": %d,"
+                    " \"min_ns\": %.3f, \"median_ns\": %.3f,"
+                    " \"p90_ns\": %.3f, \"max_ns\": %.3f,"
+                    " \"mean_ns\": %.3f}",
+                    r.d_iterations,
+                    r.d_repetitions,
+                    r.d_minimum,
+                    r.d_median,
+                    r.d_percentile90,
+                    r.d_maximum,
+                    r.d_mean);
+        }
+        fputs(numResults ? "\n  ]\n}\n" : "]\n}\n", stream);
+      } break;
+      default: {
+        BSLS_ASSERT(!"Unknown format");
+      }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
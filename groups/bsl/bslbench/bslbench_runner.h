@@ -0,0 +1,470 @@
+// bslbench_runner.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLBENCH_RUNNER
+#define INCLUDED_BSLBENCH_RUNNER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a harness that times benchmarks and reports statistics.
+//
+//@CLASSES:
+//  bslbench::Result: statistics of the time per iteration of one benchmark
+//  bslbench::Runner: mechanism that runs benchmarks and reports the results
+//
+//@SEE_ALSO: bsls_timeutil, bsls_stopwatch
+//
+//@DESCRIPTION: This component provides a mechanism, 'bslbench::Runner', that
+// runs benchmark functions, measures the time each takes per iteration with
+// 'bsls::TimeUtil::getTimer', and reports the results as an aligned table,
+// as CSV, or as JSON.  It also provides a 'struct', 'bslbench::Result',
+// holding the statistics measured for one benchmark.
+//
+// A benchmark is a function taking a number of iterations and an opaque
+// context pointer, which performs the operation being measured that many
+// times.  The runner measures a benchmark in three phases:
+//
+//: 1 *Calibration*: the number of iterations is increased, starting from one,
+//:   until a single call takes at least 'minRepetitionTime' nanoseconds, so
+//:   that the resolution of the timer and the overhead of the call are
+//:   negligible.
+//:
+//: 2 *Warmup*: the benchmark is called 'warmupRepetitions' times without
+//:   being timed, to bring caches, branch predictors, allocators, and the
+//:   processor clock speed to a steady state.
+//:
+//: 3 *Measurement*: the benchmark is called 'repetitions' times, and each
+//:   call is timed separately.
+//:
+// The time per iteration of each measured repetition is a *sample*, and the
+// runner reports the minimum, median, 90th percentile, maximum, and mean of
+// the samples.  The median is the most robust estimate of the typical cost,
+// since it is unaffected by occasional interruptions (e.g., by the operating
+// system), which show as a gap between the median and the maximum.
+//
+///Preventing Elision
+///------------------
+// An optimizing compiler may remove a computation whose result is not used,
+// which makes a benchmark measure nothing.  'Runner::doNotOptimize' forces
+// the compiler to assume that the object at a given address is read, and
+// that any memory may have been modified, without generating any code (on
+// GNU-compatible compilers) or with a single volatile store (otherwise).
+//
+///Output Formats
+///--------------
+// 'Runner::print' writes the results recorded so far in one of three
+// formats:
+//
+//: 'BSLBENCH_TABLE': an aligned table for reading in a terminal
+//:
+//: 'BSLBENCH_CSV': a header line followed by one line per benchmark, with
+//:   the fields 'name', 'iterations', 'repetitions', 'min_ns', 'median_ns',
+//:   'p90_ns', 'max_ns', and 'mean_ns'
+//:
+//: 'BSLBENCH_JSON': an object with a "benchmarks" array holding one object
+//:   per benchmark, with the same fields as the CSV format
+//
+// The machine-readable formats are understood by the
+// 'tools/bslbench_compare.py' script, which compares the median times of two
+// runs and reports the benchmarks that became slower by more than a given
+// threshold.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Comparing Two Ways of Building a Vector
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know how much reserving capacity speeds up
+// building a 'bsl::vector'.  First, we define two benchmark functions,
+// taking the length of the vector from the context:
+//..
+//  void buildVector(int numIterations, void *context)
+//  {
+//      const int length = *static_cast<int *>(context);
+//      for (int i = 0; i < numIterations; ++i) {
+//          bsl::vector<int> v;
+//          for (int j = 0; j < length; ++j) {
+//              v.push_back(j);
+//          }
+//          bslbench::Runner::doNotOptimize(&v);
+//      }
+//  }
+//
+//  void buildReservedVector(int numIterations, void *context)
+//  {
+//      const int length = *static_cast<int *>(context);
+//      for (int i = 0; i < numIterations; ++i) {
+//          bsl::vector<int> v;
+//          v.reserve(length);
+//          for (int j = 0; j < length; ++j) {
+//              v.push_back(j);
+//          }
+//          bslbench::Runner::doNotOptimize(&v);
+//      }
+//  }
+//..
+// Then, we create a runner, and make the measurement quick for the purpose
+// of this example:
+//..
+//  bslbench::Runner runner;
+//  runner.setMinRepetitionTime(100 * 1000);  // 0.1 milliseconds
+//  runner.setWarmupRepetitions(1);
+//  runner.setRepetitions(5);
+//..
+// Next, we run both benchmarks:
+//..
+//  int length = 100;
+//  runner.run("vector/push_back/100", &buildVector, &length);
+//  runner.run("vector/reserve+push_back/100", &buildReservedVector, &length);
+//  assert(2 == runner.numResults());
+//..
+// Then, we inspect the results:
+//..
+//  const bslbench::Result& plain    = runner.result(0);
+//  const bslbench::Result& reserved = runner.result(1);
+//
+//  assert(5 == plain.d_repetitions);
+//  assert(plain.d_minimum      <= plain.d_median);
+//  assert(plain.d_median       <= plain.d_percentile90);
+//  assert(plain.d_percentile90 <= plain.d_maximum);
+//
+//  printf("reserving capacity saves %.0f%%\n",
+//         100.0 * (1.0 - reserved.d_median / plain.d_median));
+//..
+// Finally, we write the results as CSV, e.g., to be saved and later compared
+// with another run by 'tools/bslbench_compare.py':
+//..
+//  runner.print(stdout, bslbench::Runner::BSLBENCH_CSV);
+//..
+// which writes something like:
+//..
+//  name,iterations,repetitions,min_ns,median_ns,p90_ns,max_ns,mean_ns
+//  vector/push_back/100,640,5,391.120,395.478,413.047,418.813,400.266
+//  vector/reserve+push_back/100,1280,5,94.164,95.026,98.789,100.338,96.105
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDIO_H
+#include <stdio.h>
+#define INCLUDED_STDIO_H
+#endif
+
+namespace BloombergLP {
+namespace bslbench {
+
+                                // =============
+                                // struct Result
+                                // =============
+
+struct Result {
+    // This 'struct' holds the statistics of the time per iteration, in
+    // nanoseconds, measured by a 'Runner' for one benchmark.
+
+    // PUBLIC DATA
+    const char *d_name_p;        // name of the benchmark (held, not owned)
+
+    int         d_iterations;    // iterations per repetition
+
+    int         d_repetitions;   // number of measured repetitions
+
+    double      d_minimum;       // fastest repetition
+
+    double      d_median;        // median repetition
+
+    double      d_percentile90;  // 90th percentile repetition
+
+    double      d_maximum;       // slowest repetition
+
+    double      d_mean;          // mean of all measured repetitions
+};
+
+                                // ============
+                                // class Runner
+                                // ============
+
+class Runner {
+    // This mechanism class runs benchmark functions, measures the time per
+    // iteration of each, and records the statistics of the measurements in a
+    // sequence of 'Result' objects that can be accessed or printed.  See the
+    // component documentation for the measurement procedure.
+
+  public:
+    // TYPES
+    typedef void (*BenchmarkFunction)(int numIterations, void *context);
+        // A 'BenchmarkFunction' performs the operation being measured the
+        // specified 'numIterations' times, using the specified 'context'.
+
+    enum Format {
+        // Enumerate the formats in which results can be printed.
+
+        BSLBENCH_TABLE,  // aligned columns, for reading
+        BSLBENCH_CSV,    // comma-separated values, with a header line
+        BSLBENCH_JSON    // JSON object with a "benchmarks" array
+    };
+
+    enum {
+        BSLBENCH_DEFAULT_WARMUP_REPETITIONS   = 3,
+        BSLBENCH_DEFAULT_REPETITIONS          = 15,
+        BSLBENCH_DEFAULT_MIN_REPETITION_TIME  = 10 * 1000 * 1000  // 10 ms
+    };
+
+  private:
+    // DATA
+    int                      d_warmupRepetitions;  // untimed calls
+
+    int                      d_repetitions;        // timed calls
+
+    bsls::Types::Int64       d_minRepetitionTime;  // minimum duration of a
+                                                   // call, in nanoseconds
+
+    const char              *d_filter_p;           // names to run (held, not
+                                                   // owned), or 0 for all
+
+    bsl::vector<Result>      d_results;            // results, in order run
+
+    bsl::vector<double>      d_samples;            // scratch for the samples
+                                                   // of a benchmark
+
+    // NOT IMPLEMENTED
+    Runner(const Runner&);
+    Runner& operator=(const Runner&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Runner, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static void doNotOptimize(const void *address);
+        // Force the compiler to assume that the object at the specified
+        // 'address' is read, and that any object in memory may have been
+        // modified, so that the computation of the object is not elided.
+
+    static double percentile(const double *sortedSamples,
+                             int           numSamples,
+                             double        fraction);
+        // Return the specified 'fraction' percentile of the specified
+        // 'numSamples' values in the specified 'sortedSamples' array,
+        // interpolating linearly between the two nearest samples.  The
+        // behavior is undefined unless '0 < numSamples', 'sortedSamples' is
+        // sorted in non-decreasing order, and '0 <= fraction <= 1'.
+
+    // CREATORS
+    explicit Runner(bslma::Allocator *basicAllocator = 0);
+        // Create a runner having the default settings and no results.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~Runner();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clearResults();
+        // Remove all results recorded by this runner.
+
+    int run(const char        *name,
+            BenchmarkFunction  function,
+            void              *context);
+        // Measure the specified 'function', called with the specified
+        // 'context', as the benchmark having the specified 'name', and append
+        // its statistics to the results of this runner, if 'name' matches the
+        // filter of this runner.  Return 0 if the benchmark was run, and a
+        // non-zero value otherwise.  The behavior is undefined unless 'name'
+        // remains valid for as long as the result is held by this runner.
+
+    void setFilter(const char *filter);
+        // Run only the benchmarks whose name contains the specified 'filter'
+        // as a substring, or every benchmark if 'filter' is 0.  The behavior
+        // is undefined unless 'filter' remains valid for as long as it is the
+        // filter of this runner.
+
+    void setMinRepetitionTime(bsls::Types::Int64 nanoseconds);
+        // Set the minimum duration of each repetition of a benchmark to the
+        // specified 'nanoseconds'.  The behavior is undefined unless
+        // '0 <= nanoseconds'.
+
+    void setRepetitions(int numRepetitions);
+        // Set the number of timed repetitions of each benchmark to the
+        // specified 'numRepetitions'.  The behavior is undefined unless
+        // '0 < numRepetitions'.
+
+    void setWarmupRepetitions(int numRepetitions);
+        // Set the number of untimed repetitions of each benchmark to the
+        // specified 'numRepetitions'.  The behavior is undefined unless
+        // '0 <= numRepetitions'.
+
+    // ACCESSORS
+    const char *filter() const;
+        // Return the filter of this runner, or 0 if it runs every benchmark.
+
+    bool matchesFilter(const char *name) const;
+        // Return 'true' if the specified 'name' matches the filter of this
+        // runner, and 'false' otherwise.
+
+    bsls::Types::Int64 minRepetitionTime() const;
+        // Return the minimum duration, in nanoseconds, of each repetition.
+
+    int numResults() const;
+        // Return the number of results recorded by this runner.
+
+    void print(FILE *stream, Format format) const;
+        // Write the results recorded by this runner to the specified 'stream'
+        // in the specified 'format'.
+
+    int repetitions() const;
+        // Return the number of timed repetitions of each benchmark.
+
+    const Result& result(int index) const;
+        // Return a reference providing non-modifiable access to the result
+        // at the specified 'index' in the order the benchmarks were run.  The
+        // behavior is undefined unless '0 <= index < numResults()'.
+
+    int warmupRepetitions() const;
+        // Return the number of untimed repetitions of each benchmark.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                                // ------------
+                                // class Runner
+                                // ------------
+
+// CLASS METHODS
+inline
+void Runner::doNotOptimize(const void *address)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    asm volatile("" : : "g"(address) : "memory");
+#else
+    static const void *volatile sink;
+    sink = address;
+#endif
+}
+
+// MANIPULATORS
+inline
+void Runner::clearResults()
+{
+    d_results.clear();
+}
+
+inline
+void Runner::setFilter(const char *filter)
+{
+    d_filter_p = filter;
+}
+
+// ACCESSORS
+inline
+const char *Runner::filter() const
+{
+    return d_filter_p;
+}
+
+inline
+bsls::Types::Int64 Runner::minRepetitionTime() const
+{
+    return d_minRepetitionTime;
+}
+
+inline
+int Runner::numResults() const
+{
+    return static_cast<int>(d_results.size());
+}
+
+inline
+int Runner::repetitions() const
+{
+    return d_repetitions;
+}
+
+inline
+const Result& Runner::result(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numResults());
+
+    return d_results[index];
+}
+
+inline
+int Runner::warmupRepetitions() const
+{
+    return d_warmupRepetitions;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *Runner::allocator() const
+{
+    return d_results.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
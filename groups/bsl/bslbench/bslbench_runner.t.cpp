@@ -0,0 +1,897 @@
+// bslbench_runner.t.cpp                                              -*-C++-*-
+#include <bslbench_runner.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a mechanism whose results depend on the
+// time taken by the functions it runs.  The statistics are verified with a
+// benchmark function that waits for a known time per iteration, and with a
+// function that counts its calls; the output formats are verified by writing
+// them to a temporary file and reading them back.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static double percentile(const double *, int, double);
+// [ 4] static void doNotOptimize(const void *address);
+//
+// CREATORS
+// [ 3] explicit Runner(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~Runner();
+//
+// MANIPULATORS
+// [ 4] void clearResults();
+// [ 4] int run(const char *, BenchmarkFunction, void *);
+// [ 3] void setFilter(const char *filter);
+// [ 3] void setMinRepetitionTime(bsls::Types::Int64 nanoseconds);
+// [ 3] void setRepetitions(int numRepetitions);
+// [ 3] void setWarmupRepetitions(int numRepetitions);
+//
+// ACCESSORS
+// [ 3] const char *filter() const;
+// [ 3] bool matchesFilter(const char *name) const;
+// [ 3] bsls::Types::Int64 minRepetitionTime() const;
+// [ 4] int numResults() const;
+// [ 5] void print(FILE *stream, Format format) const;
+// [ 3] int repetitions() const;
+// [ 4] const Result& result(int index) const;
+// [ 3] int warmupRepetitions() const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslbench::Runner Obj;
+typedef bslbench::Result Result;
+typedef bsls::Types::Int64 Int64;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct CallCounter {
+    // This 'struct' records the calls made to 'countCalls'.
+
+    int d_numCalls;
+    int d_totalIterations;
+    int d_lastIterations;
+};
+
+void countCalls(int numIterations, void *context)
+    // Record a call with the specified 'numIterations' in the 'CallCounter'
+    // at the specified 'context'.
+{
+    CallCounter *counter = static_cast<CallCounter *>(context);
+    ++counter->d_numCalls;
+    counter->d_totalIterations += numIterations;
+    counter->d_lastIterations   = numIterations;
+}
+
+void spin(int numIterations, void *context)
+    // Wait, without sleeping, for the number of nanoseconds at the specified
+    // 'context', an 'Int64', multiplied by the specified 'numIterations'.
+{
+    const Int64 duration = *static_cast<Int64 *>(context) * numIterations;
+    const Int64 start    = bsls::TimeUtil::getTimer();
+    while (bsls::TimeUtil::getTimer() - start < duration) {
+    }
+}
+
+bsl::string readFile(FILE *file)
+    // Return the contents of the specified 'file', read from its beginning.
+{
+    bsl::string result;
+    rewind(file);
+    char buffer[256];
+    size_t length;
+    while (0 < (length = fread(buffer, 1, sizeof buffer, file))) {
+        result.append(buffer, length);
+    }
+    return result;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Comparing Two Ways of Building a Vector
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know how much reserving capacity speeds up
+// building a 'bsl::vector'.  First, we define two benchmark functions,
+// taking the length of the vector from the context:
+//..
+    void buildVector(int numIterations, void *context)
+    {
+        const int length = *static_cast<int *>(context);
+        for (int i = 0; i < numIterations; ++i) {
+            bsl::vector<int> v;
+            for (int j = 0; j < length; ++j) {
+                v.push_back(j);
+            }
+            bslbench::Runner::doNotOptimize(&v);
+        }
+    }
+
+    void buildReservedVector(int numIterations, void *context)
+    {
+        const int length = *static_cast<int *>(context);
+        for (int i = 0; i < numIterations; ++i) {
+            bsl::vector<int> v;
+            v.reserve(length);
+            for (int j = 0; j < length; ++j) {
+                v.push_back(j);
+            }
+            bslbench::Runner::doNotOptimize(&v);
+        }
+    }
+//..
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    setbuf(stdout, NULL);    // Use unbuffered output.
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a runner, and make the measurement quick for the purpose
+// of this example:
+//..
+    bslbench::Runner runner;
+    runner.setMinRepetitionTime(100 * 1000);  // 0.1 milliseconds
+    runner.setWarmupRepetitions(1);
+    runner.setRepetitions(5);
+//..
+// Next, we run both benchmarks:
+//..
+    int length = 100;
+    runner.run("vector/push_back/100", &buildVector, &length);
+    runner.run("vector/reserve+push_back/100", &buildReservedVector, &length);
+    ASSERT(2 == runner.numResults());
+//..
+// Then, we inspect the results:
+//..
+    const bslbench::Result& plain    = runner.result(0);
+    const bslbench::Result& reserved = runner.result(1);
+
+    ASSERT(5 == plain.d_repetitions);
+    ASSERT(plain.d_minimum      <= plain.d_median);
+    ASSERT(plain.d_median       <= plain.d_percentile90);
+    ASSERT(plain.d_percentile90 <= plain.d_maximum);
+
+    if (verbose) {
+        printf("reserving capacity saves %.0f%%\n",
+               100.0 * (1.0 - reserved.d_median / plain.d_median));
+    }
+//..
+// Finally, we write the results as CSV, e.g., to be saved and later compared
+// with another run by 'tools/bslbench_compare.py':
+//..
+    if (verbose) {
+        runner.print(stdout, bslbench::Runner::BSLBENCH_CSV);
+    }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'print'
+        //
+        // Concerns:
+        //: 1 The table format has a header line and one line per result.
+        //:
+        //: 2 The CSV format has the documented header line, and one line per
+        //:   result with the name and the eight fields, the name being quoted
+        //:   if it contains a comma or a double quote.
+        //:
+        //: 3 The JSON format is an object with a "benchmarks" array of one
+        //:   object per result, with the name escaped as a JSON string.
+        //:
+        //: 4 Each format is well-formed when there are no results.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Print a runner without results, and a runner with results whose
+        //:   names need quoting, in each format, to a temporary file, and
+        //:   verify the structure of the contents.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   void print(FILE *stream, Format format) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'print'"
+                            "\n=======\n");
+
+        CallCounter counter = { 0, 0, 0 };
+
+        Obj mX;  const Obj& X = mX;
+        mX.setMinRepetitionTime(0);
+        mX.setWarmupRepetitions(0);
+        mX.setRepetitions(3);
+
+        if (verbose) printf("\tNo results.\n");
+        {
+            FILE *file = tmpfile();
+            ASSERT(file);
+
+            X.print(file, Obj::BSLBENCH_CSV);
+            ASSERT("name,iterations,repetitions,"
+                   "min_ns,median_ns,p90_ns,max_ns,mean_ns\n" ==
+                                                              readFile(file));
+            fclose(file);
+
+            file = tmpfile();
+            X.print(file, Obj::BSLBENCH_JSON);
+            ASSERT("{\n  \"benchmarks\": []\n}\n" == readFile(file));
+            fclose(file);
+
+            file = tmpfile();
+            X.print(file, Obj::BSLBENCH_TABLE);
+            const bsl::string TABLE = readFile(file);
+            ASSERTV(TABLE.c_str(), 0 == TABLE.find("benchmark "));
+            ASSERT(TABLE.find('\n') == TABLE.size() - 1);
+            fclose(file);
+        }
+
+        mX.run("plain", &countCalls, &counter);
+        mX.run("with,comma", &countCalls, &counter);
+        mX.run("with \"quotes\" and \\", &countCalls, &counter);
+        ASSERT(3 == X.numResults());
+
+        if (verbose) printf("\tTable format.\n");
+        {
+            FILE *file = tmpfile();
+            X.print(file, Obj::BSLBENCH_TABLE);
+            const bsl::string TABLE = readFile(file);
+            fclose(file);
+
+            if (veryVerbose) printf("%s", TABLE.c_str());
+
+            int numLines = 0;
+            for (size_t i = 0; i < TABLE.size(); ++i) {
+                numLines += '\n' == TABLE[i];
+            }
+            ASSERTV(numLines, 4 == numLines);
+            ASSERT(bsl::string::npos != TABLE.find("\nplain "));
+            ASSERT(bsl::string::npos != TABLE.find("\nwith,comma "));
+        }
+
+        if (verbose) printf("\tCSV format.\n");
+        {
+            FILE *file = tmpfile();
+            X.print(file, Obj::BSLBENCH_CSV);
+            const bsl::string CSV = readFile(file);
+            fclose(file);
+
+            if (veryVerbose) printf("%s", CSV.c_str());
+
+            const char *LINE_STARTS[] = {
+                "name,iterations,repetitions,"
+                                   "min_ns,median_ns,p90_ns,max_ns,mean_ns\n",
+                "plain,1,3,",
+                "\"with,comma\",1,3,",
+                "\"with \"\"quotes\"\" and \\\",1,3,"
+            };
+
+            size_t position = 0;
+            for (int i = 0; i < 4; ++i) {
+                const size_t length = strlen(LINE_STARTS[i]);
+                ASSERTV(i, 0 == CSV.compare(position, length, LINE_STARTS[i]));
+
+                const size_t end = CSV.find('\n', position);
+                ASSERTV(i, bsl::string::npos != end);
+
+                if (i) {
+                    int numCommas = 0;
+                    for (size_t j = position + length; j < end; ++j) {
+                        numCommas += ',' == CSV[j];
+                    }
+                    ASSERTV(i, numCommas, 4 == numCommas);
+                }
+                position = end + 1;
+            }
+            ASSERT(CSV.size() == position);
+        }
+
+        if (verbose) printf("\tJSON format.\n");
+        {
+            FILE *file = tmpfile();
+            X.print(file, Obj::BSLBENCH_JSON);
+            const bsl::string JSON = readFile(file);
+            fclose(file);
+
+            if (veryVerbose) printf("%s", JSON.c_str());
+
+            ASSERT(0 == JSON.find("{\n  \"benchmarks\": [\n    {\"name\": "
+                                  "\"plain\", \"iterations\": 1, "
+                                  "\"repetitions\": 3, \"min_ns\": "));
+            ASSERT(bsl::string::npos !=
+                          JSON.find("},\n    {\"name\": \"with,comma\", "));
+            ASSERT(bsl::string::npos !=
+                  JSON.find("{\"name\": \"with \\\"quotes\\\" and \\\\\", "));
+            ASSERT(JSON.size() - 8 == JSON.find("}\n  ]\n}\n"));
+
+            const char *FIELDS[] = { "\"min_ns\": ",
+                                     "\"median_ns\": ",
+                                     "\"p90_ns\": ",
+                                     "\"max_ns\": ",
+                                     "\"mean_ns\": " };
+            for (int i = 0; i < 5; ++i) {
+                size_t count = 0;
+                size_t position = 0;
+                while (bsl::string::npos !=
+                                (position = JSON.find(FIELDS[i], position))) {
+                    ++count;
+                    ++position;
+                }
+                ASSERTV(i, count, 3 == count);
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            FILE *file = tmpfile();
+            ASSERT_PASS(X.print(file, Obj::BSLBENCH_CSV));
+            ASSERT_FAIL(X.print(0, Obj::BSLBENCH_CSV));
+            fclose(file);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'run'
+        //
+        // Concerns:
+        //: 1 A benchmark is called once with one iteration if the minimum
+        //:   repetition time is zero, then 'warmupRepetitions' times and
+        //:   'repetitions' times with the calibrated number of iterations.
+        //:
+        //: 2 The calibrated number of iterations makes a repetition last at
+        //:   least the minimum repetition time, and not much more.
+        //:
+        //: 3 The statistics are the time per iteration, and are ordered.
+        //:
+        //: 4 A benchmark whose name does not match the filter is not called,
+        //:   and 'run' returns a non-zero value.
+        //:
+        //: 5 Results are held in the order run, and 'clearResults' removes
+        //:   them.
+        //:
+        //: 6 'doNotOptimize' can be called with any address.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Run a benchmark that counts its calls and iterations, with a
+        //:   zero minimum repetition time.  (C-1)
+        //:
+        //: 2 Run a benchmark that waits for a known time per iteration, and
+        //:   verify its calibration and statistics.  (C-2..3)
+        //:
+        //: 3 Set a filter, and run matching and non-matching benchmarks.
+        //:   (C-4..5)
+        //:
+        //: 4 Call 'doNotOptimize' with the addresses of local objects.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-7)
+        //
+        // Testing:
+        //   static void doNotOptimize(const void *address);
+        //   void clearResults();
+        //   int run(const char *, BenchmarkFunction, void *);
+        //   int numResults() const;
+        //   const Result& result(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'run'"
+                            "\n=====\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        Obj mX(&sa);  const Obj& X = mX;
+
+        if (verbose) printf("\tCall counts.\n");
+        {
+            mX.setMinRepetitionTime(0);
+            mX.setWarmupRepetitions(2);
+            mX.setRepetitions(7);
+
+            CallCounter counter = { 0, 0, 0 };
+            ASSERT(0 == mX.run("count", &countCalls, &counter));
+
+            ASSERTV(counter.d_numCalls, 1 + 2 + 7 == counter.d_numCalls);
+            ASSERT(1 + 2 + 7 == counter.d_totalIterations);
+            ASSERT(1 == X.numResults());
+
+            const Result& R = X.result(0);
+            ASSERT(0 == strcmp("count", R.d_name_p));
+            ASSERT(1 == R.d_iterations);
+            ASSERT(7 == R.d_repetitions);
+        }
+
+        if (verbose) printf("\tCalibration and statistics.\n");
+        {
+            mX.clearResults();
+            ASSERT(0 == X.numResults());
+
+            Int64 nanosecondsPerIteration = 1000;
+
+            mX.setMinRepetitionTime(1000 * 1000);
+            mX.setWarmupRepetitions(1);
+            mX.setRepetitions(5);
+
+            ASSERT(0 == mX.run("spin", &spin, &nanosecondsPerIteration));
+            ASSERT(1 == X.numResults());
+
+            const Result& R = X.result(0);
+            if (veryVerbose) {
+                P_(R.d_iterations) P_(R.d_minimum) P_(R.d_median)
+                P_(R.d_percentile90) P_(R.d_maximum) P(R.d_mean)
+            }
+
+            // At least 1000 iterations are needed to spin for a millisecond,
+            // and growth by a factor of at most 10 overshoots by at most 10
+            // times.
+
+            ASSERTV(R.d_iterations, 1000 <= R.d_iterations);
+            ASSERTV(R.d_iterations, R.d_iterations <= 12000);
+            ASSERTV(R.d_minimum, 1000 <= R.d_minimum);
+            ASSERT(R.d_minimum      <= R.d_median);
+            ASSERT(R.d_median       <= R.d_percentile90);
+            ASSERT(R.d_percentile90 <= R.d_maximum);
+            ASSERT(R.d_minimum      <= R.d_mean);
+            ASSERT(R.d_mean         <= R.d_maximum);
+        }
+
+        if (verbose) printf("\tFilter.\n");
+        {
+            mX.clearResults();
+            mX.setMinRepetitionTime(0);
+            mX.setFilter("map/");
+
+            CallCounter counter = { 0, 0, 0 };
+            ASSERT(0 != mX.run("vector/push_back", &countCalls, &counter));
+            ASSERT(0 == counter.d_numCalls);
+            ASSERT(0 == mX.run("map/insert", &countCalls, &counter));
+            ASSERT(0 == mX.run("unordered_map/insert", &countCalls, &counter));
+            ASSERT(0 != mX.run("map", &countCalls, &counter));
+
+            ASSERT(2 == X.numResults());
+            ASSERT(0 == strcmp("map/insert", X.result(0).d_name_p));
+            ASSERT(0 == strcmp("unordered_map/insert", X.result(1).d_name_p));
+
+            mX.setFilter(0);
+            ASSERT(0 == mX.run("vector/push_back", &countCalls, &counter));
+            ASSERT(3 == X.numResults());
+        }
+
+        if (verbose) printf("\t'doNotOptimize'.\n");
+        {
+            int    i = 5;
+            double d = 1.5;
+            Obj::doNotOptimize(&i);
+            Obj::doNotOptimize(&d);
+            Obj::doNotOptimize(0);
+            ASSERT(5 == i);
+            ASSERT(1.5 == d);
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            CallCounter counter = { 0, 0, 0 };
+
+            ASSERT_FAIL(mX.run(0, &countCalls, &counter));
+            ASSERT_FAIL(mX.run("name", 0, &counter));
+            ASSERT_PASS(mX.run("name", &countCalls, &counter));
+
+            ASSERT_SAFE_FAIL(X.result(-1));
+            ASSERT_SAFE_PASS(X.result(X.numResults() - 1));
+            ASSERT_SAFE_FAIL(X.result(X.numResults()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS, SETTERS, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed runner has the documented default settings,
+        //:   no filter, and no results.
+        //:
+        //: 2 The allocator is the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 3 Each setter sets the value returned by the corresponding
+        //:   accessor, and no other.
+        //:
+        //: 4 'matchesFilter' returns 'true' for every name if there is no
+        //:   filter, and for the names containing the filter otherwise.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create runners with and without an allocator, verify the
+        //:   defaults, then call each setter and verify all accessors.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   explicit Runner(bslma::Allocator *basicAllocator = 0);
+        //   ~Runner();
+        //   void setFilter(const char *filter);
+        //   void setMinRepetitionTime(bsls::Types::Int64 nanoseconds);
+        //   void setRepetitions(int numRepetitions);
+        //   void setWarmupRepetitions(int numRepetitions);
+        //   const char *filter() const;
+        //   bool matchesFilter(const char *name) const;
+        //   bsls::Types::Int64 minRepetitionTime() const;
+        //   int repetitions() const;
+        //   int warmupRepetitions() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, SETTERS, AND BASIC ACCESSORS"
+                            "\n======================================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+        }
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+            ASSERT(&sa == X.allocator());
+
+            ASSERT(Obj::BSLBENCH_DEFAULT_WARMUP_REPETITIONS ==
+                                                      X.warmupRepetitions());
+            ASSERT(Obj::BSLBENCH_DEFAULT_REPETITIONS == X.repetitions());
+            ASSERT(Obj::BSLBENCH_DEFAULT_MIN_REPETITION_TIME ==
+                                                      X.minRepetitionTime());
+            ASSERT(0 == X.filter());
+            ASSERT(0 == X.numResults());
+            ASSERT(X.matchesFilter(""));
+            ASSERT(X.matchesFilter("anything"));
+
+            mX.setWarmupRepetitions(0);
+            ASSERT(0  == X.warmupRepetitions());
+            ASSERT(Obj::BSLBENCH_DEFAULT_REPETITIONS == X.repetitions());
+
+            mX.setRepetitions(1);
+            ASSERT(1  == X.repetitions());
+            ASSERT(0  == X.warmupRepetitions());
+
+            mX.setMinRepetitionTime(12345);
+            ASSERT(12345 == X.minRepetitionTime());
+            ASSERT(1  == X.repetitions());
+
+            const char *FILTER = "map";
+            mX.setFilter(FILTER);
+            ASSERT(FILTER == X.filter());
+            ASSERT( X.matchesFilter("map"));
+            ASSERT( X.matchesFilter("unordered_map/find"));
+            ASSERT(!X.matchesFilter("vector/push_back"));
+            ASSERT(!X.matchesFilter("ma"));
+            ASSERT(!X.matchesFilter(""));
+
+            mX.setFilter("");
+            ASSERT(X.matchesFilter(""));
+            ASSERT(X.matchesFilter("vector"));
+
+            mX.setFilter(0);
+            ASSERT(0 == X.filter());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_PASS(mX.setWarmupRepetitions(0));
+            ASSERT_FAIL(mX.setWarmupRepetitions(-1));
+
+            ASSERT_PASS(mX.setRepetitions(1));
+            ASSERT_FAIL(mX.setRepetitions(0));
+
+            ASSERT_PASS(mX.setMinRepetitionTime(0));
+            ASSERT_FAIL(mX.setMinRepetitionTime(-1));
+
+            ASSERT_FAIL(X.matchesFilter(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'percentile'
+        //
+        // Concerns:
+        //: 1 The 0 and 1 fractions return the first and last samples.
+        //:
+        //: 2 Fractions falling on a sample return that sample, and others
+        //:   interpolate linearly between the two nearest samples.
+        //:
+        //: 3 A single sample is every percentile.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, compute percentiles of small
+        //:   sample arrays and compare with the expected values.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   static double percentile(const double *, int, double);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'percentile'"
+                            "\n============\n");
+
+        const double SAMPLES[] = { 10, 20, 30, 40, 50 };
+
+        static const struct {
+            int    d_line;
+            int    d_numSamples;
+            double d_fraction;
+            double d_expected;
+        } DATA[] = {
+            //LINE  NUM  FRACTION  EXPECTED
+            //----  ---  --------  --------
+            { L_,   1,   0.0,      10       },
+            { L_,   1,   0.5,      10       },
+            { L_,   1,   1.0,      10       },
+            { L_,   2,   0.0,      10       },
+            { L_,   2,   0.5,      15       },
+            { L_,   2,   1.0,      20       },
+            { L_,   5,   0.0,      10       },
+            { L_,   5,   0.25,     20       },
+            { L_,   5,   0.5,      30       },
+            { L_,   5,   0.9,      46       },
+            { L_,   5,   1.0,      50       },
+            { L_,   4,   0.5,      25       },
+            { L_,   4,   0.9,      37       },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE     = DATA[ti].d_line;
+            const int    NUM      = DATA[ti].d_numSamples;
+            const double FRACTION = DATA[ti].d_fraction;
+            const double EXPECTED = DATA[ti].d_expected;
+
+            const double result = Obj::percentile(SAMPLES, NUM, FRACTION);
+            ASSERTV(LINE, EXPECTED, result,
+                    EXPECTED - 1e-9 < result && result < EXPECTED + 1e-9);
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(Obj::percentile(SAMPLES, 1, 0.5));
+            ASSERT_FAIL(Obj::percentile(0, 1, 0.5));
+            ASSERT_FAIL(Obj::percentile(SAMPLES, 0, 0.5));
+            ASSERT_FAIL(Obj::percentile(SAMPLES, 1, -0.1));
+            ASSERT_FAIL(Obj::percentile(SAMPLES, 1, 1.1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Run a trivial benchmark and print the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        CallCounter counter = { 0, 0, 0 };
+
+        Obj mX;  const Obj& X = mX;
+        mX.setMinRepetitionTime(10 * 1000);
+        ASSERT(0 == mX.run("breathing", &countCalls, &counter));
+        ASSERT(1 == X.numResults());
+        ASSERT(0 < counter.d_numCalls);
+        ASSERT(0 < X.result(0).d_iterations);
+
+        if (verbose) {
+            X.print(stdout, Obj::BSLBENCH_TABLE);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -1,8 +1,10 @@
 // bsls_atomic.t.cpp                                                  -*-C++-*-
 #include <bsls_atomic.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <stdio.h>                // printf()
 #include <stdlib.h>               // atoi(), rand()
 #include <iostream>
 
@@ -86,6 +88,7 @@ using namespace std;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COST OF EACH MEMORY ORDERING
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -2402,6 +2405,94 @@ int main(int argc, char *argv[])
         ASSERT(PVC == pResult);
         ASSERT(((APTestObj*)0) == mP1);
 
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COST OF EACH MEMORY ORDERING
+        //
+        // Concerns:
+        //: 1 Report the cost of each operation, for each memory ordering it
+        //:   supports, so that the benefit of a weaker ordering can be
+        //:   weighed against its complexity.
+        //
+        // Plan:
+        //: 1 For 'AtomicInt' and 'AtomicInt64', time a long, uncontended loop
+        //:   of each load, store, add, swap, and test-and-swap operation, in
+        //:   each of its orderings, and print the time per operation.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COST OF EACH MEMORY ORDERING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: COST OF EACH MEMORY ORDERING"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        const int NUM_ITERATIONS = 20000000;
+
+#define MEASURE(NAME, EXPR)                                                   \
+        do {                                                                  \
+            bsls::Stopwatch timer;                                            \
+            timer.start();                                                    \
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {                        \
+                EXPR;                                                         \
+            }                                                                 \
+            timer.stop();                                                     \
+            printf("%-28s %8.2f\n",                                           \
+                   NAME,                                                      \
+                   timer.elapsedTime() * 1e9 / NUM_ITERATIONS);               \
+        } while (0)
+
+        printf("%-28s %8s\n", "operation", "ns/op");
+
+        {
+            bsls::AtomicInt mX(0);
+            int             sink = 0;
+
+            MEASURE("AtomicInt load",              sink += mX.load());
+            MEASURE("AtomicInt loadAcquire",       sink += mX.loadAcquire());
+            MEASURE("AtomicInt loadRelaxed",       sink += mX.loadRelaxed());
+            MEASURE("AtomicInt operator=",         mX = i);
+            MEASURE("AtomicInt storeRelease",      mX.storeRelease(i));
+            MEASURE("AtomicInt storeRelaxed",      mX.storeRelaxed(i));
+            MEASURE("AtomicInt add",               mX.add(1));
+            MEASURE("AtomicInt addAcqRel",         mX.addAcqRel(1));
+            MEASURE("AtomicInt addRelaxed",        mX.addRelaxed(1));
+            MEASURE("AtomicInt swap",              sink += mX.swap(i));
+            MEASURE("AtomicInt swapAcqRel",        sink += mX.swapAcqRel(i));
+            MEASURE("AtomicInt testAndSwap",
+                    sink += mX.testAndSwap(i, i + 1));
+            MEASURE("AtomicInt testAndSwapAcqRel",
+                    sink += mX.testAndSwapAcqRel(i, i + 1));
+
+            if (veryVerbose) { P(sink) }
+        }
+        {
+            bsls::AtomicInt64  mX(0);
+            bsls::Types::Int64 sink = 0;
+
+            MEASURE("AtomicInt64 load",            sink += mX.load());
+            MEASURE("AtomicInt64 loadAcquire",     sink += mX.loadAcquire());
+            MEASURE("AtomicInt64 loadRelaxed",     sink += mX.loadRelaxed());
+            MEASURE("AtomicInt64 operator=",       mX = i);
+            MEASURE("AtomicInt64 storeRelease",    mX.storeRelease(i));
+            MEASURE("AtomicInt64 storeRelaxed",    mX.storeRelaxed(i));
+            MEASURE("AtomicInt64 add",             mX.add(1));
+            MEASURE("AtomicInt64 addAcqRel",       mX.addAcqRel(1));
+            MEASURE("AtomicInt64 addRelaxed",      mX.addRelaxed(1));
+            MEASURE("AtomicInt64 swap",            sink += mX.swap(i));
+            MEASURE("AtomicInt64 swapAcqRel",      sink += mX.swapAcqRel(i));
+            MEASURE("AtomicInt64 testAndSwap",
+                    sink += mX.testAndSwap(i, i + 1));
+            MEASURE("AtomicInt64 testAndSwapAcqRel",
+                    sink += mX.testAndSwapAcqRel(i, i + 1));
+
+            if (veryVerbose) { P(sink) }
+        }
+
+#undef MEASURE
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -21,6 +21,12 @@ BSLS_IDENT("$Id: $")
 ///-----
 //: o GCC atomic intrinsics are used where possible instead of the assembly
 //:   code,
+//: o where the compiler provides the '__atomic' builtins (GCC 4.7 and later,
+//:   and Clang), every operation, including those with a relaxed, acquire,
+//:   release, or acquire/release consistency guarantee, is implemented with
+//:   them.  A sequentially consistent store is then a single 'xchg', and a
+//:   sequentially consistent load, like any other load, is a plain 'mov'; the
+//:   assembly implementation instead issues an 'mfence' in both,
 //: o "+m" constraint may cause an 'inconsistent operand constraint' error in
 //:   GCC 3.x in optimized builds, therefore sometimes a combination of output
 //:   "=m" and input "m" constraints is used.
@@ -98,6 +104,22 @@ struct AtomicOperations_X64_ALL_GCC
 
     static int addIntNv(AtomicTypes::Int *atomicInt, int value);
 
+#if defined(__ATOMIC_SEQ_CST)
+    static int getIntRelaxed(const AtomicTypes::Int *atomicInt);
+
+    static void setIntRelaxed(AtomicTypes::Int *atomicInt, int value);
+
+    static int swapIntAcqRel(AtomicTypes::Int *atomicInt, int swapValue);
+
+    static int testAndSwapIntAcqRel(AtomicTypes::Int *atomicInt,
+                                    int compareValue,
+                                    int swapValue);
+
+    static int addIntNvRelaxed(AtomicTypes::Int *atomicInt, int value);
+
+    static int addIntNvAcqRel(AtomicTypes::Int *atomicInt, int value);
+#endif
+
         // *** atomic functions for Int64 ***
 
     static Types::Int64 getInt64(const AtomicTypes::Int64 *atomicInt);
@@ -118,6 +140,26 @@ struct AtomicOperations_X64_ALL_GCC
 
     static Types::Int64 addInt64Nv(AtomicTypes::Int64 *atomicInt,
                                    Types::Int64 value);
+
+#if defined(__ATOMIC_SEQ_CST)
+    static Types::Int64 getInt64Relaxed(const AtomicTypes::Int64 *atomicInt);
+
+    static void setInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                Types::Int64 value);
+
+    static Types::Int64 swapInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                        Types::Int64 swapValue);
+
+    static Types::Int64 testAndSwapInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                               Types::Int64 compareValue,
+                                               Types::Int64 swapValue);
+
+    static Types::Int64 addInt64NvRelaxed(AtomicTypes::Int64 *atomicInt,
+                                          Types::Int64 value);
+
+    static Types::Int64 addInt64NvAcqRel(AtomicTypes::Int64 *atomicInt,
+                                         Types::Int64 value);
+#endif
 };
 
 // ===========================================================================
@@ -128,6 +170,238 @@ struct AtomicOperations_X64_ALL_GCC
                      // struct AtomicOperations_X64_ALL_GCC
                      // -----------------------------------
 
+#if defined(__ATOMIC_SEQ_CST)
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    getInt(const AtomicTypes::Int *atomicInt)
+{
+    return __atomic_load_n(&atomicInt->d_value, __ATOMIC_SEQ_CST);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    getIntRelaxed(const AtomicTypes::Int *atomicInt)
+{
+    return __atomic_load_n(&atomicInt->d_value, __ATOMIC_RELAXED);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    getIntAcquire(const AtomicTypes::Int *atomicInt)
+{
+    return __atomic_load_n(&atomicInt->d_value, __ATOMIC_ACQUIRE);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    setInt(AtomicTypes::Int *atomicInt, int value)
+{
+    __atomic_store_n(&atomicInt->d_value, value, __ATOMIC_SEQ_CST);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    setIntRelaxed(AtomicTypes::Int *atomicInt, int value)
+{
+    __atomic_store_n(&atomicInt->d_value, value, __ATOMIC_RELAXED);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    setIntRelease(AtomicTypes::Int *atomicInt, int value)
+{
+    __atomic_store_n(&atomicInt->d_value, value, __ATOMIC_RELEASE);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    swapInt(AtomicTypes::Int *atomicInt, int swapValue)
+{
+    return __atomic_exchange_n(&atomicInt->d_value,
+                               swapValue,
+                               __ATOMIC_SEQ_CST);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    swapIntAcqRel(AtomicTypes::Int *atomicInt, int swapValue)
+{
+    return __atomic_exchange_n(&atomicInt->d_value,
+                               swapValue,
+                               __ATOMIC_ACQ_REL);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    testAndSwapInt(AtomicTypes::Int *atomicInt,
+                   int compareValue,
+                   int swapValue)
+{
+    __atomic_compare_exchange_n(&atomicInt->d_value,
+                                &compareValue,
+                                swapValue,
+                                false,
+                                __ATOMIC_SEQ_CST,
+                                __ATOMIC_SEQ_CST);
+    return compareValue;
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    testAndSwapIntAcqRel(AtomicTypes::Int *atomicInt,
+                         int compareValue,
+                         int swapValue)
+{
+    __atomic_compare_exchange_n(&atomicInt->d_value,
+                                &compareValue,
+                                swapValue,
+                                false,
+                                __ATOMIC_ACQ_REL,
+                                __ATOMIC_ACQUIRE);
+    return compareValue;
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    addIntNv(AtomicTypes::Int *atomicInt, int value)
+{
+    return __atomic_add_fetch(&atomicInt->d_value, value, __ATOMIC_SEQ_CST);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    addIntNvRelaxed(AtomicTypes::Int *atomicInt, int value)
+{
+    return __atomic_add_fetch(&atomicInt->d_value, value, __ATOMIC_RELAXED);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    addIntNvAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    return __atomic_add_fetch(&atomicInt->d_value, value, __ATOMIC_ACQ_REL);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    getInt64(const AtomicTypes::Int64 *atomicInt)
+{
+    return __atomic_load_n(&atomicInt->d_value, __ATOMIC_SEQ_CST);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    getInt64Relaxed(const AtomicTypes::Int64 *atomicInt)
+{
+    return __atomic_load_n(&atomicInt->d_value, __ATOMIC_RELAXED);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    getInt64Acquire(const AtomicTypes::Int64 *atomicInt)
+{
+    return __atomic_load_n(&atomicInt->d_value, __ATOMIC_ACQUIRE);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    setInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    __atomic_store_n(&atomicInt->d_value, value, __ATOMIC_SEQ_CST);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    setInt64Relaxed(AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    __atomic_store_n(&atomicInt->d_value, value, __ATOMIC_RELAXED);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    setInt64Release(AtomicTypes::Int64 *atomicInt,
+                    Types::Int64 value)
+{
+    __atomic_store_n(&atomicInt->d_value, value, __ATOMIC_RELEASE);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    swapInt64(AtomicTypes::Int64 *atomicInt,
+              Types::Int64 swapValue)
+{
+    return __atomic_exchange_n(&atomicInt->d_value,
+                               swapValue,
+                               __ATOMIC_SEQ_CST);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    swapInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                    Types::Int64 swapValue)
+{
+    return __atomic_exchange_n(&atomicInt->d_value,
+                               swapValue,
+                               __ATOMIC_ACQ_REL);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    testAndSwapInt64(AtomicTypes::Int64 *atomicInt,
+                     Types::Int64 compareValue,
+                     Types::Int64 swapValue)
+{
+    __atomic_compare_exchange_n(&atomicInt->d_value,
+                                &compareValue,
+                                swapValue,
+                                false,
+                                __ATOMIC_SEQ_CST,
+                                __ATOMIC_SEQ_CST);
+    return compareValue;
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    testAndSwapInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                           Types::Int64 compareValue,
+                           Types::Int64 swapValue)
+{
+    __atomic_compare_exchange_n(&atomicInt->d_value,
+                                &compareValue,
+                                swapValue,
+                                false,
+                                __ATOMIC_ACQ_REL,
+                                __ATOMIC_ACQUIRE);
+    return compareValue;
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    addInt64Nv(AtomicTypes::Int64 *atomicInt,
+               Types::Int64 value)
+{
+    return __atomic_add_fetch(&atomicInt->d_value, value, __ATOMIC_SEQ_CST);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    addInt64NvRelaxed(AtomicTypes::Int64 *atomicInt,
+                      Types::Int64 value)
+{
+    return __atomic_add_fetch(&atomicInt->d_value, value, __ATOMIC_RELAXED);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    addInt64NvAcqRel(AtomicTypes::Int64 *atomicInt,
+                     Types::Int64 value)
+{
+    return __atomic_add_fetch(&atomicInt->d_value, value, __ATOMIC_ACQ_REL);
+}
+
+#else
+
 inline
 int AtomicOperations_X64_ALL_GCC::
     getInt(const AtomicTypes::Int *atomicInt)
@@ -313,6 +587,8 @@ Types::Int64 AtomicOperations_X64_ALL_GCC::
     return __sync_add_and_fetch(&atomicInt->d_value, value);
 }
 
+#endif // defined(__ATOMIC_SEQ_CST)
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -13,7 +13,7 @@ BSLS_IDENT("$Id: $")
 //  bsls::BslLock: platform-independent mutex
 //  bsls::BslLockGuard: RAII mechanism for locking/unlocking a 'BslLock'
 //
-//@SEE_ALSO: bslmt_mutex
+//@SEE_ALSO: bslmt_mutex, bsls_bslthreadutil
 //
 //@DESCRIPTION: This component provides a mutually exclusive lock primitive
 // ("mutex") by wrapping a suitable platform-specific mechanism.  The
@@ -144,14 +144,18 @@ class BslLock {
     // by this class is *non*-recursive.  Note that 'BslLock' is *not* intended
     // for direct use by client code; it is meant for internal use only.
 
-    // DATA
+  public:
+    // PUBLIC TYPES
 #ifdef BSLS_PLATFORM_OS_WINDOWS
-    CRITICAL_SECTION d_lock;  // Windows critical section
+    typedef CRITICAL_SECTION NativeType;  // Windows critical section
 #else
-    pthread_mutex_t  d_lock;  // pthreads mutex object
+    typedef pthread_mutex_t  NativeType;  // pthreads mutex object
 #endif
 
   private:
+    // DATA
+    NativeType d_lock;  // platform-specific mutex
+
     // NOT IMPLEMENTED
     BslLock(const BslLock&);             // = delete
     BslLock& operator=(const BslLock&);  // = delete
@@ -179,6 +183,12 @@ class BslLock {
         // through a call to 'lock', enabling another thread to acquire the
         // lock.  The behavior is undefined unless the calling thread holds the
         // lock on this object.
+
+    NativeType& nativeLock();
+        // Return a reference to the platform-specific mutex underlying this
+        // object.  Note that this method is provided for the use of
+        // 'bsls::BslCondition', which must release and reacquire the mutex
+        // while waiting.
 };
 
                              // ==================
@@ -292,6 +302,12 @@ void BslLock::unlock()
 #endif
 }
 
+inline
+BslLock::NativeType& BslLock::nativeLock()
+{
+    return d_lock;
+}
+
                              // ------------------
                              // class BslLockGuard
                              // ------------------
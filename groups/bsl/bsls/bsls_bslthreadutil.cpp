@@ -0,0 +1,116 @@
+// bsls_bslthreadutil.cpp                                             -*-C++-*-
+#include <bsls_bslthreadutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_atomic.h>         // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+#include <sched.h>
+#endif
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+extern "C" DWORD WINAPI bsls_BslThreadUtil_threadMain(LPVOID handle)
+    // Call the function of the specified 'handle' with its argument.
+{
+    typedef BloombergLP::bsls::BslThreadUtil::Handle Handle;
+
+    Handle *h = static_cast<Handle *>(handle);
+    h->d_function(h->d_argument_p);
+    return 0;
+}
+#else
+extern "C" void *bsls_BslThreadUtil_threadMain(void *handle)
+    // Call the function of the specified 'handle' with its argument.
+{
+    typedef BloombergLP::bsls::BslThreadUtil::Handle Handle;
+
+    Handle *h = static_cast<Handle *>(handle);
+    h->d_function(h->d_argument_p);
+    return 0;
+}
+#endif
+
+namespace BloombergLP {
+namespace bsls {
+
+                            // --------------------
+                            // struct BslThreadUtil
+                            // --------------------
+
+// CLASS METHODS
+int BslThreadUtil::create(Handle         *handle,
+                          ThreadFunction  function,
+                          void           *argument)
+{
+    BSLS_ASSERT(handle);
+    BSLS_ASSERT(function);
+
+    handle->d_function   = function;
+    handle->d_argument_p = argument;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    handle->d_native = CreateThread(0,
+                                    0,
+                                    &bsls_BslThreadUtil_threadMain,
+                                    handle,
+                                    0,
+                                    0);
+    return 0 == handle->d_native ? -1 : 0;
+#else
+    return pthread_create(&handle->d_native,
+                          0,
+                          &bsls_BslThreadUtil_threadMain,
+                          handle);
+#endif
+}
+
+int BslThreadUtil::join(Handle *handle)
+{
+    BSLS_ASSERT(handle);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    if (WAIT_OBJECT_0 != WaitForSingleObject(handle->d_native, INFINITE)) {
+        return -1;                                                    // RETURN
+    }
+    return CloseHandle(handle->d_native) ? 0 : -1;
+#else
+    return pthread_join(handle->d_native, 0);
+#endif
+}
+
+void BslThreadUtil::yield()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,432 @@
+// bsls_bslthreadutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLS_BSLTHREADUTIL
+#define INCLUDED_BSLS_BSLTHREADUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide platform-independent threads and conditions below 'bslmt'.
+//
+//@CLASSES:
+//  bsls::BslThreadUtil: namespace for creating, joining, and yielding threads
+//  bsls::BslCondition: platform-independent condition variable
+//  bsls::BslThreadLocalPointer: pointer having a separate value per thread
+//
+//@SEE_ALSO: bsls_bsllock, bslmt_threadutil, bslmt_condition
+//
+//@DESCRIPTION: This component provides the threading primitives, other than
+// the mutex provided by 'bsls_bsllock', needed by the few components that run
+// threads of their own below 'bslmt', by wrapping suitable platform-specific
+// mechanisms:
+//
+//: o 'bsls::BslThreadUtil' creates and joins threads running a function, and
+//:   yields the processor running the calling thread.
+//:
+//: o 'bsls::BslCondition' is a condition variable used together with a
+//:   'bsls::BslLock'.
+//:
+//: o 'bsls::BslThreadLocalPointer' is a 'void *' having a separate value,
+//:   initially 0, in each thread.
+//
+// Note that, as for 'bsls::BslLock', these types are *not* intended for direct
+// use by client code; see 'bslmt_threadutil', 'bslmt_condition', and
+// 'bslmt_threadlocalvariable' instead.
+//
+///Thread Handles
+///--------------
+// 'bsls::BslThreadUtil::create' passes the address of the supplied
+// 'bsls::BslThreadUtil::Handle' to the thread that it creates, which reads the
+// function to run from it.  Therefore, a handle must neither be copied nor
+// destroyed between a successful call to 'create' and the call to 'join'
+// (which must be made exactly once for each thread created).  An array of
+// handles, as in the usage example below, is suitable.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Waiting for the Threads of a Parallel Computation
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we start several threads that each add a share of a sum,
+// then wait both for all of them to be done and, using a condition, for the
+// first of them to be done.
+//
+// First, we define the state shared by the threads, protected by a
+// 'bsls::BslLock':
+//..
+//  struct SharedSum {
+//      bsls::BslLock      d_lock;       // protects the fields below
+//      bsls::BslCondition d_condition;  // signaled when a share is added
+//      int                d_sum;        // sum of the shares added
+//      int                d_numDone;    // number of shares added
+//  };
+//..
+// Then, we define the function run by each thread:
+//..
+//  void addShare(void *sharedSum)
+//      // Add a share of 10 to the specified 'sharedSum'.
+//  {
+//      SharedSum *shared = static_cast<SharedSum *>(sharedSum);
+//
+//      bsls::BslLockGuard guard(&shared->d_lock);
+//      shared->d_sum += 10;
+//      ++shared->d_numDone;
+//      shared->d_condition.signal();
+//  }
+//..
+// Next, we create the threads, keeping their handles in an array that is
+// neither moved nor destroyed until the threads are joined:
+//..
+//  enum { k_NUM_THREADS = 4 };
+//
+//  SharedSum shared;
+//  shared.d_sum     = 0;
+//  shared.d_numDone = 0;
+//
+//  bsls::BslThreadUtil::Handle handles[k_NUM_THREADS];
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      int rc = bsls::BslThreadUtil::create(&handles[i], &addShare, &shared);
+//      assert(0 == rc);
+//  }
+//..
+// Then, we wait, using the condition, until at least one share is added:
+//..
+//  shared.d_lock.lock();
+//  while (0 == shared.d_numDone) {
+//      shared.d_condition.wait(&shared.d_lock);
+//  }
+//  assert(10 <= shared.d_sum);
+//  shared.d_lock.unlock();
+//..
+// Finally, we join every thread, after which every share is added:
+//..
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      bsls::BslThreadUtil::join(&handles[i]);
+//  }
+//  assert(10 * k_NUM_THREADS == shared.d_sum);
+//..
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#ifndef INCLUDED_WINDOWS
+#include <windows.h>
+#define INCLUDED_WINDOWS
+#endif
+
+#else
+
+#ifndef INCLUDED_PTHREAD
+#include <pthread.h>
+#define INCLUDED_PTHREAD
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace bsls {
+
+                            // ====================
+                            // struct BslThreadUtil
+                            // ====================
+
+struct BslThreadUtil {
+    // This 'struct' provides a namespace for utility functions that create,
+    // join, and yield threads of the native threading library.  Note that
+    // 'BslThreadUtil' is *not* intended for direct use by client code; it is
+    // meant for internal use only.
+
+    // TYPES
+    typedef void (*ThreadFunction)(void *argument);
+        // 'ThreadFunction' is an alias for the type of a function run by a
+        // thread created by 'create'.
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    typedef HANDLE    NativeHandle;  // Windows thread handle
+#else
+    typedef pthread_t NativeHandle;  // pthreads thread identifier
+#endif
+
+    struct Handle {
+        // This 'struct' holds a thread created by 'create' and the function
+        // that it runs.  Its fields are set by 'create' and must not be
+        // modified by clients.  See "Thread Handles" in the component-level
+        // documentation.
+
+        NativeHandle    d_native;      // platform-specific thread handle
+        ThreadFunction  d_function;    // function run by the thread
+        void           *d_argument_p;  // argument passed to 'd_function'
+    };
+
+    // CLASS METHODS
+    static int create(Handle         *handle,
+                      ThreadFunction  function,
+                      void           *argument);
+        // Create a thread that calls the specified 'function' with the
+        // specified 'argument', and load into the specified 'handle' the
+        // information needed to join it.  Return 0 on success, and a non-zero
+        // value, with no thread created, otherwise.  The behavior is undefined
+        // unless 'handle' is neither copied nor destroyed until it is passed
+        // to 'join' (on success).  Note that exceptions must not escape
+        // 'function'.
+
+    static int join(Handle *handle);
+        // Wait until the thread held by the specified 'handle' returns from
+        // its function, and release its resources.  Return 0 on success, and
+        // a non-zero value otherwise.  The behavior is undefined unless
+        // 'handle' holds a thread created by a successful call to 'create'
+        // that was not joined already.
+
+    static void yield();
+        // Offer the processor running the calling thread to other threads
+        // that are ready to run.
+};
+
+                             // ==================
+                             // class BslCondition
+                             // ==================
+
+class BslCondition {
+    // This 'class' implements a light-weight, portable wrapper of an OS-level
+    // condition variable, used together with a 'bsls::BslLock'.  Note that
+    // 'BslCondition' is *not* intended for direct use by client code; it is
+    // meant for internal use only.
+
+    // DATA
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    CONDITION_VARIABLE d_condition;  // Windows condition variable
+#else
+    pthread_cond_t     d_condition;  // pthreads condition variable
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    BslCondition(const BslCondition&);             // = delete
+    BslCondition& operator=(const BslCondition&);  // = delete
+
+  public:
+    // CREATORS
+    BslCondition();
+        // Create a condition variable.
+
+    ~BslCondition();
+        // Destroy this condition variable.  The behavior is undefined if a
+        // thread is waiting on this object.
+
+    // MANIPULATORS
+    void broadcast();
+        // Wake every thread waiting on this condition variable.
+
+    void signal();
+        // Wake one thread waiting on this condition variable, if any.
+
+    void wait(BslLock *lock);
+        // Release the specified 'lock', wait until this condition variable is
+        // signaled (or, spuriously, for no reason), and acquire 'lock' again.
+        // The behavior is undefined unless the calling thread holds the lock
+        // on 'lock'.  Note that the caller should check the condition that it
+        // waits for in a loop.
+};
+
+                        // ===========================
+                        // class BslThreadLocalPointer
+                        // ===========================
+
+class BslThreadLocalPointer {
+    // This 'class' implements a light-weight, portable wrapper of an OS-level
+    // thread-local storage key, providing a 'void *' having a separate value,
+    // initially 0, in each thread.  Note that 'BslThreadLocalPointer' is *not*
+    // intended for direct use by client code; it is meant for internal use
+    // only.
+
+    // DATA
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    DWORD         d_key;  // Windows thread-local storage index
+#else
+    pthread_key_t d_key;  // pthreads thread-specific data key
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    BslThreadLocalPointer(const BslThreadLocalPointer&);  // = delete
+    BslThreadLocalPointer& operator=(const BslThreadLocalPointer&);
+                                                                  // = delete
+
+  public:
+    // CREATORS
+    BslThreadLocalPointer();
+        // Create a thread-local pointer having the value 0 in every thread.
+
+    ~BslThreadLocalPointer();
+        // Destroy this thread-local pointer.  Note that the values that it
+        // has in the threads are not destroyed.
+
+    // MANIPULATORS
+    void set(void *value);
+        // Set the value of this pointer in the calling thread to the
+        // specified 'value'.
+
+    // ACCESSORS
+    void *get() const;
+        // Return the value of this pointer in the calling thread.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class BslCondition
+                             // ------------------
+
+// CREATORS
+inline
+BslCondition::BslCondition()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    InitializeConditionVariable(&d_condition);
+#else
+    const int status = pthread_cond_init(&d_condition, 0);
+    (void)status;
+    BSLS_ASSERT_SAFE(0 == status);
+#endif
+}
+
+inline
+BslCondition::~BslCondition()
+{
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+    const int status = pthread_cond_destroy(&d_condition);
+    (void)status;
+    BSLS_ASSERT_SAFE(0 == status);
+#endif
+}
+
+// MANIPULATORS
+inline
+void BslCondition::broadcast()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WakeAllConditionVariable(&d_condition);
+#else
+    const int status = pthread_cond_broadcast(&d_condition);
+    (void)status;
+    BSLS_ASSERT_SAFE(0 == status);
+#endif
+}
+
+inline
+void BslCondition::signal()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WakeConditionVariable(&d_condition);
+#else
+    const int status = pthread_cond_signal(&d_condition);
+    (void)status;
+    BSLS_ASSERT_SAFE(0 == status);
+#endif
+}
+
+inline
+void BslCondition::wait(BslLock *lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SleepConditionVariableCS(&d_condition, &lock->nativeLock(), INFINITE);
+#else
+    const int status = pthread_cond_wait(&d_condition, &lock->nativeLock());
+    (void)status;
+    BSLS_ASSERT_SAFE(0 == status);
+#endif
+}
+
+                        // ---------------------------
+                        // class BslThreadLocalPointer
+                        // ---------------------------
+
+// CREATORS
+inline
+BslThreadLocalPointer::BslThreadLocalPointer()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    d_key = TlsAlloc();
+    BSLS_ASSERT_SAFE(TLS_OUT_OF_INDEXES != d_key);
+#else
+    const int status = pthread_key_create(&d_key, 0);
+    (void)status;
+    BSLS_ASSERT_SAFE(0 == status);
+#endif
+}
+
+inline
+BslThreadLocalPointer::~BslThreadLocalPointer()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    TlsFree(d_key);
+#else
+    pthread_key_delete(d_key);
+#endif
+}
+
+// MANIPULATORS
+inline
+void BslThreadLocalPointer::set(void *value)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    TlsSetValue(d_key, value);
+#else
+    pthread_setspecific(d_key, value);
+#endif
+}
+
+// ACCESSORS
+inline
+void *BslThreadLocalPointer::get() const
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return TlsGetValue(d_key);
+#else
+    return pthread_getspecific(d_key);
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
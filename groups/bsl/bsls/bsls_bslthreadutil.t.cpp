@@ -0,0 +1,473 @@
+// bsls_bslthreadutil.t.cpp                                           -*-C++-*-
+#include <bsls_bslthreadutil.h>
+
+#include <bsls_atomic.h>         // for testing only
+#include <bsls_bsllock.h>        // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// We are testing thin wrappers of platform-specific threads, condition
+// variables, and thread-local storage.  Each test creates several threads and
+// verifies, through atomic counters and values handed between the threads,
+// that the operations under test are seen in the expected order.
+// ----------------------------------------------------------------------------
+// 'BslThreadUtil' struct:
+// [ 1] int create(Handle *handle, ThreadFunction function, void *argument);
+// [ 1] int join(Handle *handle);
+// [ 1] void yield();
+//
+// 'BslCondition' class:
+// [ 2] BslCondition();
+// [ 2] ~BslCondition();
+// [ 2] void broadcast();
+// [ 2] void signal();
+// [ 2] void wait(BslLock *lock);
+//
+// 'BslThreadLocalPointer' class:
+// [ 3] BslThreadLocalPointer();
+// [ 3] ~BslThreadLocalPointer();
+// [ 3] void set(void *value);
+// [ 3] void *get() const;
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::BslThreadUtil         Util;
+typedef bsls::BslCondition          Condition;
+typedef bsls::BslThreadLocalPointer LocalPointer;
+
+enum { k_NUM_THREADS = 8 };
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                                // case 1
+
+void incrementCounter(void *counter)
+    // Increment the specified 'counter', yielding before and after.
+{
+    Util::yield();
+    static_cast<bsls::AtomicInt *>(counter)->add(1);
+    Util::yield();
+}
+
+                                // case 2
+
+struct Gate {
+    // This 'struct' holds a gate that threads wait to be opened, and counts
+    // the threads waiting and passed.
+
+    bsls::BslLock d_lock;        // protects the fields below
+    Condition     d_condition;   // signaled when the gate opens
+    Condition     d_arrived;     // signaled when a thread starts waiting
+    int           d_numOpen;     // number of threads allowed to pass
+    int           d_numWaiting;  // number of threads waiting
+    int           d_numPassed;   // number of threads passed
+};
+
+void passGate(void *gate)
+    // Wait until the specified 'gate' lets one more thread pass, then pass.
+{
+    Gate *g = static_cast<Gate *>(gate);
+
+    bsls::BslLockGuard guard(&g->d_lock);
+    ++g->d_numWaiting;
+    g->d_arrived.signal();
+    while (g->d_numPassed == g->d_numOpen) {
+        g->d_condition.wait(&g->d_lock);
+    }
+    --g->d_numWaiting;
+    ++g->d_numPassed;
+}
+
+void waitForWaiters(Gate *gate, int numWaiting)
+    // Wait until the specified 'numWaiting' threads wait on the specified
+    // 'gate'.  The behavior is undefined unless the calling thread holds the
+    // lock of 'gate'.
+{
+    while (gate->d_numWaiting < numWaiting) {
+        gate->d_arrived.wait(&gate->d_lock);
+    }
+}
+
+                                // case 3
+
+struct LocalPointerTest {
+    // This 'struct' holds a thread-local pointer shared by several threads,
+    // and the number of threads that saw an unexpected value.
+
+    LocalPointer    d_pointer;    // pointer under test
+    bsls::AtomicInt d_numErrors;  // number of unexpected values seen
+};
+
+void checkLocalPointer(void *test)
+    // Verify that the thread-local pointer of the specified 'test' is
+    // initially 0 in the calling thread and keeps the values set by it.
+{
+    LocalPointerTest *t = static_cast<LocalPointerTest *>(test);
+    int               local;
+
+    if (0 != t->d_pointer.get()) {
+        t->d_numErrors.add(1);
+    }
+    t->d_pointer.set(&local);
+    for (int i = 0; i < 100; ++i) {
+        Util::yield();
+        if (&local != t->d_pointer.get()) {
+            t->d_numErrors.add(1);
+        }
+    }
+    t->d_pointer.set(0);
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Waiting for the Threads of a Parallel Computation
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we start several threads that each add a share of a sum,
+// then wait both for all of them to be done and, using a condition, for the
+// first of them to be done.
+//
+// First, we define the state shared by the threads, protected by a
+// 'bsls::BslLock':
+//..
+    struct SharedSum {
+        bsls::BslLock      d_lock;       // protects the fields below
+        bsls::BslCondition d_condition;  // signaled when a share is added
+        int                d_sum;        // sum of the shares added
+        int                d_numDone;    // number of shares added
+    };
+//..
+// Then, we define the function run by each thread:
+//..
+    void addShare(void *sharedSum)
+        // Add a share of 10 to the specified 'sharedSum'.
+    {
+        SharedSum *shared = static_cast<SharedSum *>(sharedSum);
+
+        bsls::BslLockGuard guard(&shared->d_lock);
+        shared->d_sum += 10;
+        ++shared->d_numDone;
+        shared->d_condition.signal();
+    }
+//..
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    // int veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Next, we create the threads, keeping their handles in an array that is
+// neither moved nor destroyed until the threads are joined:
+//..
+    enum { k_NUM_THREADS = 4 };
+
+    SharedSum shared;
+    shared.d_sum     = 0;
+    shared.d_numDone = 0;
+
+    bsls::BslThreadUtil::Handle handles[k_NUM_THREADS];
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        int rc = bsls::BslThreadUtil::create(&handles[i], &addShare, &shared);
+        ASSERT(0 == rc);
+    }
+//..
+// Then, we wait, using the condition, until at least one share is added:
+//..
+    shared.d_lock.lock();
+    while (0 == shared.d_numDone) {
+        shared.d_condition.wait(&shared.d_lock);
+    }
+    ASSERT(10 <= shared.d_sum);
+    shared.d_lock.unlock();
+//..
+// Finally, we join every thread, after which every share is added:
+//..
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bsls::BslThreadUtil::join(&handles[i]);
+    }
+    ASSERT(10 * k_NUM_THREADS == shared.d_sum);
+//..
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // THREAD-LOCAL POINTER
+        //   Ensure that 'BslThreadLocalPointer' has a value per thread.
+        //
+        // Concerns:
+        //: 1 A thread-local pointer is 0 in a thread that did not set it.
+        //:
+        //: 2 The value set by a thread is seen by that thread only, even while
+        //:   other threads set other values.
+        //
+        // Plan:
+        //: 1 In the main thread, set a thread-local pointer to a non-zero
+        //:   value.  Then, in several concurrent threads, verify that the
+        //:   pointer is initially 0, set it to the address of a local
+        //:   variable, and verify repeatedly, while yielding, that it keeps
+        //:   that value.  Finally, verify that the value in the main thread
+        //:   is unchanged.  (C-1..2)
+        //
+        // Testing:
+        //   BslThreadLocalPointer();
+        //   ~BslThreadLocalPointer();
+        //   void set(void *value);
+        //   void *get() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTHREAD-LOCAL POINTER"
+                            "\n====================\n");
+
+        LocalPointerTest test;
+        int              mainValue;
+
+        ASSERT(0 == test.d_pointer.get());
+        test.d_pointer.set(&mainValue);
+        ASSERT(&mainValue == test.d_pointer.get());
+
+        Util::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == Util::create(&handles[i],
+                                         &checkLocalPointer,
+                                         &test));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == Util::join(&handles[i]));
+        }
+
+        ASSERTV(test.d_numErrors.load(), 0 == test.d_numErrors.load());
+        ASSERT(&mainValue == test.d_pointer.get());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONDITION VARIABLE
+        //   Ensure that 'BslCondition' wakes the expected number of threads.
+        //
+        // Concerns:
+        //: 1 'wait' releases the lock while waiting, and holds it again on
+        //:   return.
+        //:
+        //: 2 'signal' wakes at least one waiting thread.
+        //:
+        //: 3 'broadcast' wakes every waiting thread.
+        //
+        // Plan:
+        //: 1 Create several threads that wait on a condition until a gate,
+        //:   protected by a lock, lets them pass, and wait until all of them
+        //:   wait (which requires that 'wait' releases the lock).  (C-1)
+        //:
+        //: 2 Open the gate for one thread and 'signal', then wait until it
+        //:   passed.  (C-2)
+        //:
+        //: 3 Open the gate for every thread and 'broadcast', then join every
+        //:   thread and verify that all of them passed.  (C-3)
+        //
+        // Testing:
+        //   BslCondition();
+        //   ~BslCondition();
+        //   void broadcast();
+        //   void signal();
+        //   void wait(BslLock *lock);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONDITION VARIABLE"
+                            "\n==================\n");
+
+        Gate gate;
+        gate.d_numOpen    = 0;
+        gate.d_numWaiting = 0;
+        gate.d_numPassed  = 0;
+
+        Util::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == Util::create(&handles[i], &passGate, &gate));
+        }
+
+        gate.d_lock.lock();
+        waitForWaiters(&gate, k_NUM_THREADS);
+        ASSERT(0 == gate.d_numPassed);
+
+        if (verbose) printf("\tSignal one thread.\n");
+
+        gate.d_numOpen = 1;
+        gate.d_condition.signal();
+        while (1 != gate.d_numPassed) {
+            gate.d_lock.unlock();
+            Util::yield();
+            gate.d_lock.lock();
+        }
+        ASSERTV(gate.d_numWaiting, k_NUM_THREADS - 1 == gate.d_numWaiting);
+
+        if (verbose) printf("\tBroadcast to every thread.\n");
+
+        gate.d_numOpen = k_NUM_THREADS;
+        gate.d_condition.broadcast();
+        gate.d_lock.unlock();
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == Util::join(&handles[i]));
+        }
+        ASSERTV(gate.d_numPassed, k_NUM_THREADS == gate.d_numPassed);
+        ASSERTV(gate.d_numWaiting, 0 == gate.d_numWaiting);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BASIC TEST
+        //   Ensure that threads are created and joined.
+        //
+        // Concerns:
+        //: 1 'create' returns 0 and starts a thread calling the function with
+        //:   the argument supplied.
+        //:
+        //: 2 'join' returns 0 once the function has returned.
+        //:
+        //: 3 'yield' may be called from any thread.
+        //
+        // Plan:
+        //: 1 Create several threads incrementing a shared atomic counter, and
+        //:   yielding, while the main thread yields.  Join every thread and
+        //:   verify that the counter was incremented by each.  (C-1..3)
+        //
+        // Testing:
+        //   int create(Handle *handle, ThreadFunction function, void *arg);
+        //   int join(Handle *handle);
+        //   void yield();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBASIC TEST"
+                            "\n==========\n");
+
+        bsls::AtomicInt counter(0);
+
+        Util::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == Util::create(&handles[i],
+                                         &incrementCounter,
+                                         &counter));
+            Util::yield();
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == Util::join(&handles[i]));
+        }
+
+        ASSERTV(counter.load(), k_NUM_THREADS == counter.load());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
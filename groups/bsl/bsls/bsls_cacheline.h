@@ -0,0 +1,215 @@
+// bsls_cacheline.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLS_CACHELINE
+#define INCLUDED_BSLS_CACHELINE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the cache-line size and a cache-line-padded wrapper.
+//
+//@CLASSES:
+//  bsls::CacheLine: namespace for the cache-line size of the platform
+//  bsls::CacheLinePadded: wrapper keeping an object on its own cache line(s)
+//
+//@SEE_ALSO: bsls_alignmentutil, bsls_atomic, bsls_stripedcounter
+//
+//@DESCRIPTION: This component provides a namespace, 'bsls::CacheLine', that
+// defines the size, in bytes, of a cache line on the target platform, and a
+// class template, 'bsls::CacheLinePadded', that holds an object of its
+// (template parameter) 'TYPE' surrounded by enough padding that no other
+// object shares a cache line with it.
+//
+// When two threads frequently write to distinct objects that happen to occupy
+// the same cache line, each write invalidates the line in the cache of the
+// other processor, and the threads run as if they contended for a single
+// object ("false sharing").  Hot atomic counters, and the indices of
+// concurrent queues, are the usual victims.  Wrapping each such object in a
+// 'bsls::CacheLinePadded' removes the false sharing at the cost of
+// '2 * bsls::CacheLine::BSLS_SIZE' bytes of padding per object.
+//
+///Cache-Line Size
+///---------------
+// 'bsls::CacheLine::BSLS_SIZE' is 128 on POWER and Itanium processors, and 64
+// on all other supported processors.  Note that some x86 processors prefetch
+// cache lines in adjacent pairs, so that objects less than 128 bytes apart
+// may still interfere with one another, albeit much less than objects on the
+// same line.
+//
+///Padding Rather Than Alignment
+///-----------------------------
+// 'bsls::CacheLinePadded' separates its object from its neighbors by padding
+// on both sides rather than by over-aligning it, because memory obtained from
+// 'operator new' and from most allocators is not guaranteed to be aligned to
+// a cache-line boundary.  The object therefore does not necessarily start a
+// cache line, but no other object lies within 'bsls::CacheLine::BSLS_SIZE'
+// bytes of it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Separating Counters Updated by Different Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server keeps a count of the requests it has received, which
+// is incremented by an I/O thread, and a count of the requests it has
+// processed, which is incremented by a worker thread.  Declared side by side,
+// the two counters would likely share a cache line.  Instead, we pad each of
+// them:
+//..
+//  struct ServerStatistics {
+//      bsls::CacheLinePadded<bsls::AtomicInt64> d_numReceived;
+//      bsls::CacheLinePadded<bsls::AtomicInt64> d_numProcessed;
+//  };
+//..
+// Then, each thread updates its own counter through 'object':
+//..
+//  ServerStatistics stats;
+//  stats.d_numReceived.object().addRelaxed(1);
+//  stats.d_numProcessed.object().addRelaxed(1);
+//..
+// Finally, we observe that the two counters are at least a cache line apart:
+//..
+//  const char *received  = reinterpret_cast<const char *>(
+//                                            &stats.d_numReceived.object());
+//  const char *processed = reinterpret_cast<const char *>(
+//                                           &stats.d_numProcessed.object());
+//  assert(processed - received >= bsls::CacheLine::BSLS_SIZE);
+//  assert(1 == stats.d_numReceived.object().loadRelaxed());
+//..
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                              // ================
+                              // struct CacheLine
+                              // ================
+
+struct CacheLine {
+    // This 'struct' provides a namespace for the size of a cache line on the
+    // target platform.
+
+    enum {
+        // Define the size, in bytes, of a cache line.
+
+#if defined(BSLS_PLATFORM_CPU_POWERPC) || defined(BSLS_PLATFORM_CPU_IA64)
+        BSLS_SIZE = 128
+#else
+        BSLS_SIZE = 64
+#endif
+    };
+};
+
+                           // =====================
+                           // class CacheLinePadded
+                           // =====================
+
+template <class TYPE>
+class CacheLinePadded {
+    // This class template holds an object of the (template parameter) 'TYPE'
+    // preceded and followed by 'CacheLine::BSLS_SIZE' bytes of padding, so
+    // that no object outside of this one shares a cache line with the held
+    // object.
+
+    // DATA
+    char d_leadingPad[CacheLine::BSLS_SIZE];   // separates 'd_object' from
+                                               // preceding memory
+
+    TYPE d_object;                             // held object
+
+    char d_trailingPad[CacheLine::BSLS_SIZE];  // separates 'd_object' from
+                                               // following memory
+
+  public:
+    // CREATORS
+    CacheLinePadded();
+        // Create a padded, default-constructed 'TYPE' object.
+
+    template <class ARG>
+    explicit CacheLinePadded(const ARG& argument);
+        // Create a padded 'TYPE' object constructed from the specified
+        // 'argument'.
+
+    // MANIPULATORS
+    TYPE& object();
+        // Return a reference providing modifiable access to the held object.
+
+    // ACCESSORS
+    const TYPE& object() const;
+        // Return a reference providing non-modifiable access to the held
+        // object.
+};
+
+// ===========================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                           // ---------------------
+                           // class CacheLinePadded
+                           // ---------------------
+
+// CREATORS
+template <class TYPE>
+inline
+CacheLinePadded<TYPE>::CacheLinePadded()
+: d_object()
+{
+}
+
+template <class TYPE>
+template <class ARG>
+inline
+CacheLinePadded<TYPE>::CacheLinePadded(const ARG& argument)
+: d_object(argument)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE& CacheLinePadded<TYPE>::object()
+{
+    return d_object;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& CacheLinePadded<TYPE>::object() const
+{
+    return d_object;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,321 @@
+// bsls_cacheline.t.cpp                                               -*-C++-*-
+#include <bsls_cacheline.h>
+
+#include <bsls_atomic.h>        // for testing only
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>              // printf()
+#include <stdlib.h>             // atoi()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test defines a compile-time constant and a simple
+// wrapper template.  The constant is checked against the platform, and the
+// wrapper is checked for the placement of its object relative to its own
+// bounds and to adjacent wrappers, and for correct construction of, and
+// access to, its object.
+//-----------------------------------------------------------------------------
+// [ 1] CacheLine::BSLS_SIZE
+// [ 2] CacheLinePadded();
+// [ 2] CacheLinePadded(const ARG&);
+// [ 2] TYPE& object();
+// [ 2] const TYPE& object() const;
+//-----------------------------------------------------------------------------
+// [ 3] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::Types::IntPtr IntPtr;
+
+//=============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct Point {
+    // This 'struct' is a simple type that records how it was constructed.
+
+    int d_x;
+    int d_y;
+
+    Point() : d_x(-1), d_y(-1) {}
+    explicit Point(int x) : d_x(x), d_y(0) {}
+};
+
+template <class TYPE>
+IntPtr distance(const void *from, const TYPE& to)
+    // Return the number of bytes from the specified 'from' to the address of
+    // the specified 'to'.
+{
+    return reinterpret_cast<const char *>(&to)
+         - static_cast<const char *>(from);
+}
+
+template <class TYPE>
+void testPadding(int line)
+    // Verify that a 'CacheLinePadded<TYPE>' keeps at least a cache line
+    // between its object and any memory outside of it, in isolation and in
+    // an array, reporting failures against the specified 'line'.
+{
+    typedef bsls::CacheLinePadded<TYPE> Obj;
+
+    const IntPtr SIZE = bsls::CacheLine::BSLS_SIZE;
+
+    Obj        mX;
+    const Obj& X = mX;
+
+    const IntPtr BEFORE = distance(&X, X.object());
+    const IntPtr AFTER  = static_cast<IntPtr>(sizeof X)
+                        - BEFORE
+                        - static_cast<IntPtr>(sizeof(TYPE));
+    ASSERTV(line, BEFORE, SIZE <= BEFORE);
+    ASSERTV(line, AFTER,  SIZE <= AFTER);
+
+    Obj array[3];
+    for (int i = 0; i < 2; ++i) {
+        const IntPtr GAP = distance(&array[i].object(), array[i + 1].object())
+                         - static_cast<IntPtr>(sizeof(TYPE));
+        ASSERTV(line, i, GAP, SIZE <= GAP);
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    (void)veryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        //Example 1: Separating Counters Updated by Different Threads
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        struct ServerStatistics {
+            bsls::CacheLinePadded<bsls::AtomicInt64> d_numReceived;
+            bsls::CacheLinePadded<bsls::AtomicInt64> d_numProcessed;
+        };
+
+        ServerStatistics stats;
+        stats.d_numReceived.object().addRelaxed(1);
+        stats.d_numProcessed.object().addRelaxed(1);
+
+        const char *received  = reinterpret_cast<const char *>(
+                                            &stats.d_numReceived.object());
+        const char *processed = reinterpret_cast<const char *>(
+                                           &stats.d_numProcessed.object());
+        ASSERT(processed - received >= bsls::CacheLine::BSLS_SIZE);
+        ASSERT(1 == stats.d_numReceived.object().loadRelaxed());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS 'CacheLinePadded'
+        //
+        // Concerns:
+        //: 1 At least 'CacheLine::BSLS_SIZE' bytes separate the held object
+        //:   from the start and from the end of the wrapper.
+        //:
+        //: 2 In an array of wrappers, the held objects are at least
+        //:   'CacheLine::BSLS_SIZE' bytes apart.
+        //:
+        //: 3 The default constructor value-initializes the held object, and
+        //:   the converting constructor passes its argument to the
+        //:   constructor of the held object.
+        //:
+        //: 4 'object' provides modifiable and non-modifiable access to the
+        //:   held object.
+        //
+        // Plan:
+        //: 1 For held types of various sizes, measure the offsets of the held
+        //:   objects within single wrappers and arrays of wrappers.  (C-1..2)
+        //:
+        //: 2 Create wrappers of a type that records its construction, and of
+        //:   'bsls::AtomicInt64', using both constructors, and verify the
+        //:   state of the held object through both overloads of 'object'.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   CacheLinePadded();
+        //   CacheLinePadded(const ARG&);
+        //   TYPE& object();
+        //   const TYPE& object() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS 'CacheLinePadded'"
+                            "\n=======================\n");
+
+        if (verbose) printf("\tLayout.\n");
+
+        testPadding<char>(L_);
+        testPadding<int>(L_);
+        testPadding<bsls::AtomicInt64>(L_);
+        testPadding<Point>(L_);
+        testPadding<char[100]>(L_);
+        testPadding<char[bsls::CacheLine::BSLS_SIZE]>(L_);
+
+        if (verbose) printf("\tConstruction and access.\n");
+        {
+            bsls::CacheLinePadded<Point> mX;
+            const bsls::CacheLinePadded<Point>& X = mX;
+            ASSERT(-1 == X.object().d_x);
+            ASSERT(-1 == X.object().d_y);
+
+            mX.object().d_x = 5;
+            ASSERT(5 == X.object().d_x);
+            ASSERT(&mX.object() == &X.object());
+
+            const bsls::CacheLinePadded<Point> Y(7);
+            ASSERT(7 == Y.object().d_x);
+            ASSERT(0 == Y.object().d_y);
+        }
+        {
+            bsls::CacheLinePadded<int> mX;
+            ASSERT(0 == mX.object());
+
+            bsls::CacheLinePadded<bsls::AtomicInt64> mY(42);
+            ASSERT(42 == mY.object());
+            mY.object().addRelaxed(1);
+            ASSERT(43 == mY.object().loadRelaxed());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // CONSTANT 'CacheLine::BSLS_SIZE'
+        //
+        // Concerns:
+        //: 1 The cache-line size is a power of two, at least 32.
+        //:
+        //: 2 The cache-line size is 64 on x86 processors.
+        //:
+        //: 3 The constant is usable in constant expressions.
+        //
+        // Plan:
+        //: 1 Check the value, and use it as an array bound.  (C-1..3)
+        //
+        // Testing:
+        //   CacheLine::BSLS_SIZE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTANT 'CacheLine::BSLS_SIZE'"
+                            "\n===============================\n");
+
+        const int SIZE = bsls::CacheLine::BSLS_SIZE;
+        if (verbose) { P(SIZE) }
+
+        ASSERTV(SIZE, 32 <= SIZE);
+        ASSERTV(SIZE, 0 == (SIZE & (SIZE - 1)));
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+        ASSERTV(SIZE, 64 == SIZE);
+#endif
+
+        char buffer[bsls::CacheLine::BSLS_SIZE];
+        ASSERT(SIZE == static_cast<int>(sizeof buffer));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
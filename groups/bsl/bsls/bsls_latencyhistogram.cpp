@@ -0,0 +1,248 @@
+// bsls_latencyhistogram.cpp                                          -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+
+namespace {
+
+const bsls::Types::Int64 k_INT64_MAX = static_cast<bsls::Types::Int64>(
+                                 ~static_cast<bsls::Types::Uint64>(0) >> 1);
+const bsls::Types::Int64 k_INT64_MIN = -k_INT64_MAX - 1;
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// CLASS DATA
+const Types::Int64 LatencyHistogram::BSLS_MAX_TRACKABLE_VALUE;
+
+// PRIVATE MANIPULATORS
+void LatencyHistogram::updateExtrema(Types::Int64 minValue,
+                                     Types::Int64 maxValue)
+{
+    if (d_singleWriterFlag) {
+        if (minValue < d_min.loadRelaxed()) {
+            d_min.storeRelaxed(minValue);
+        }
+        if (maxValue > d_max.loadRelaxed()) {
+            d_max.storeRelaxed(maxValue);
+        }
+        return;                                                       // RETURN
+    }
+
+    Types::Int64 current = d_min.loadRelaxed();
+    while (minValue < current) {
+        const Types::Int64 previous = d_min.testAndSwap(current, minValue);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+
+    current = d_max.loadRelaxed();
+    while (maxValue > current) {
+        const Types::Int64 previous = d_max.testAndSwap(current, maxValue);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+// CREATORS
+LatencyHistogram::LatencyHistogram(Concurrency concurrency)
+: d_sum(0)
+, d_min(k_INT64_MAX)
+, d_max(k_INT64_MIN)
+, d_singleWriterFlag(BSLS_SINGLE_WRITER == concurrency)
+{
+}
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& original)
+: d_sum(0)
+, d_min(k_INT64_MAX)
+, d_max(k_INT64_MIN)
+, d_singleWriterFlag(original.d_singleWriterFlag)
+{
+    add(original);
+}
+
+// MANIPULATORS
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& rhs)
+{
+    if (this != &rhs) {
+        reset();
+        add(rhs);
+    }
+    return *this;
+}
+
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+    for (int i = 0; i < BSLS_NUM_BUCKETS; ++i) {
+        const Types::Int64 n = other.d_buckets[i].loadRelaxed();
+        if (0 != n) {
+            increase(&d_buckets[i], n);
+        }
+    }
+    increase(&d_sum, other.d_sum.loadRelaxed());
+
+    const Types::Int64 minValue = other.d_min.loadRelaxed();
+    const Types::Int64 maxValue = other.d_max.loadRelaxed();
+    if (minValue < d_min.loadRelaxed() || maxValue > d_max.loadRelaxed()) {
+        updateExtrema(minValue, maxValue);
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (int i = 0; i < BSLS_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+    d_sum.storeRelaxed(0);
+    d_min.storeRelaxed(k_INT64_MAX);
+    d_max.storeRelaxed(k_INT64_MIN);
+}
+
+// ACCESSORS
+Types::Int64 LatencyHistogram::count() const
+{
+    Types::Int64 total = 0;
+    for (int i = 0; i < BSLS_NUM_BUCKETS; ++i) {
+        total += d_buckets[i].loadRelaxed();
+    }
+    return total;
+}
+
+Types::Int64 LatencyHistogram::max() const
+{
+    const Types::Int64 value = d_max.loadRelaxed();
+    return k_INT64_MIN == value ? 0 : value;
+}
+
+double LatencyHistogram::mean() const
+{
+    const Types::Int64 n = count();
+    return 0 == n ? 0.0 : static_cast<double>(sum()) / static_cast<double>(n);
+}
+
+Types::Int64 LatencyHistogram::min() const
+{
+    const Types::Int64 value = d_min.loadRelaxed();
+    return k_INT64_MAX == value ? 0 : value;
+}
+
+Types::Int64 LatencyHistogram::percentile(double percent) const
+{
+    // Count the values, then find the bucket holding the value of rank
+    // 'ceil(percent / 100 * total)' (at least 1).  The counts are loaded
+    // again while scanning, so concurrent updates may move the result by at
+    // most the values recorded meanwhile.
+
+    const Types::Int64 total = count();
+    if (0 == total) {
+        return 0;                                                     // RETURN
+    }
+
+    const Types::Int64 minValue = min();
+    const Types::Int64 maxValue = max();
+
+    const double       exact = percent * static_cast<double>(total) / 100.0;
+    Types::Int64       rank  = static_cast<Types::Int64>(exact);
+    if (static_cast<double>(rank) < exact) {
+        ++rank;
+    }
+    if (rank < 1) {
+        return minValue;                                              // RETURN
+    }
+
+    Types::Int64 seen = 0;
+    for (int i = 0; i < BSLS_NUM_BUCKETS; ++i) {
+        seen += d_buckets[i].loadRelaxed();
+        if (seen >= rank) {
+            const Types::Int64 bound = i == BSLS_NUM_BUCKETS - 1
+                                     ? maxValue
+                                     : bucketUpperBound(i);
+            return bound < minValue ? minValue
+                                    : bound > maxValue ? maxValue : bound;
+                                                                      // RETURN
+        }
+    }
+    return maxValue;
+}
+
+void LatencyHistogram::print(FILE *stream) const
+{
+    printSummary(stream);
+
+    const Types::Int64 total = count();
+    if (0 == total) {
+        return;                                                       // RETURN
+    }
+
+    fprintf(stream, "%20s %20s %14s %12s\n",
+            "lower", "upper", "count", "cumulative%");
+
+    Types::Int64 seen = 0;
+    for (int i = 0; i < BSLS_NUM_BUCKETS; ++i) {
+        const Types::Int64 n = d_buckets[i].loadRelaxed();
+        if (0 == n) {
+            continue;
+        }
+        seen += n;
+        fprintf(stream, "%20lld %20lld %14lld %12.4f\n",
+                static_cast<long long>(bucketLowerBound(i)),
+                static_cast<long long>(bucketUpperBound(i)),
+                static_cast<long long>(n),
+                100.0 * static_cast<double>(seen)
+                                                / static_cast<double>(total));
+    }
+}
+
+void LatencyHistogram::printSummary(FILE *stream) const
+{
+    fprintf(stream, "count=%lld min=%lld mean=%.1f max=%lld\n",
+            static_cast<long long>(count()),
+            static_cast<long long>(min()),
+            mean(),
+            static_cast<long long>(max()));
+    fprintf(stream, "p50=%lld p90=%lld p99=%lld p99.9=%lld p99.99=%lld\n",
+            static_cast<long long>(percentile(50.0)),
+            static_cast<long long>(percentile(90.0)),
+            static_cast<long long>(percentile(99.0)),
+            static_cast<long long>(percentile(99.9)),
+            static_cast<long long>(percentile(99.99)));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
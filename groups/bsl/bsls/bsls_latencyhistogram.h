@@ -0,0 +1,554 @@
+// bsls_latencyhistogram.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLS_LATENCYHISTOGRAM
+#define INCLUDED_BSLS_LATENCYHISTOGRAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size log-linear histogram for recording latencies.
+//
+//@CLASSES:
+//  bsls::LatencyHistogram: lock-free log-linear histogram of 64-bit values
+//  bsls::LatencyHistogramGuard: records the duration of a scope
+//
+//@SEE_ALSO: bsls_timeutil, bsls_stopwatch
+//
+//@DESCRIPTION: This component provides a class, 'bsls::LatencyHistogram',
+// that counts non-negative integer values, typically durations in
+// nanoseconds, in a fixed set of buckets, so that millions of values can be
+// recorded cheaply and summarized by their percentiles (e.g., the median and
+// the 99th percentile).  It also provides a guard class,
+// 'bsls::LatencyHistogramGuard', that records in a histogram the wall time
+// spent in a scope, as measured by the cycle counter of 'bsls::TimeUtil'.
+//
+///Bucket Layout
+///-------------
+// The buckets are log-linear, as in an HDR ("high dynamic range") histogram:
+// every value below 'BSLS_SUB_BUCKET_COUNT' (128) has a bucket of its own,
+// and each larger power-of-two range '[2^k, 2^(k+1))' is divided into
+// 'BSLS_SUB_BUCKET_COUNT / 2' (64) buckets of equal width.  The width of the
+// bucket holding a value is therefore at most 1/64 of the value, so every
+// percentile is reported with a relative error below 1.6%, whatever the
+// magnitude of the values.
+//
+// Values up to 'BSLS_MAX_TRACKABLE_VALUE' (2^40 - 1, about 18 minutes in
+// nanoseconds) are tracked with this precision, in 'BSLS_NUM_BUCKETS' (2240)
+// 64-bit counters.  Larger values are counted in the last bucket, and
+// negative values in the first; 'min' and 'max' report the values actually
+// recorded.  A histogram occupies about 18 kilobytes and never allocates
+// memory.
+//
+///Thread Safety
+///-------------
+// The counters of a histogram are atomic integers, and recording a value
+// updates them without locks.  A histogram created with the
+// 'BSLS_MULTIPLE_WRITERS' concurrency (the default) may be updated by any
+// number of threads at once, using atomic read-modify-write instructions.
+// Those instructions cost several nanoseconds each, and much more when
+// several processors update the same cache line, so a histogram of a
+// heavily-used code path is better created per thread with the
+// 'BSLS_SINGLE_WRITER' concurrency: only one thread may then record values in
+// it, using plain loads and stores, while any thread may read it or merge it
+// into another histogram with 'add'.
+//
+// Accessors read the counters one at a time, so a result computed while
+// values are being recorded reflects some, but not necessarily all, of the
+// concurrent updates.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Latency of a Function
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the median and tail latencies of a function
+// that is called many times.  First, we define the function, which records
+// its own duration with a guard:
+//..
+//  bsls::LatencyHistogram processLatency;
+//
+//  int processRequest(int request)
+//  {
+//      bsls::LatencyHistogramGuard guard(&processLatency);
+//
+//      int result = 0;
+//      for (int i = 0; i < request; ++i) {
+//          result += i * request;
+//      }
+//      return result;
+//  }
+//..
+// Then, we call the function many times:
+//..
+//  int sum = 0;
+//  for (int i = 0; i < 10000; ++i) {
+//      sum += processRequest(i % 100);
+//  }
+//..
+// Finally, we query the number of calls and the percentiles of their
+// duration, which are non-decreasing, and write a summary to the standard
+// output:
+//..
+//  assert(10000 == processLatency.count());
+//
+//  const bsls::Types::Int64 p50 = processLatency.percentile(50.0);
+//  const bsls::Types::Int64 p99 = processLatency.percentile(99.0);
+//  assert(p50 <= p99);
+//  assert(p99 <= processLatency.max());
+//
+//  processLatency.printSummary(stdout);
+//..
+//
+///Example 2: Merging Per-Thread Histograms
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that each thread of a server records latencies in a histogram of
+// its own, and that a monitoring thread reports the latencies of the server
+// as a whole.  First, we create the per-thread histograms for a single
+// writer each:
+//..
+//  bsls::LatencyHistogram threadLatency[2] = {
+//      bsls::LatencyHistogram(bsls::LatencyHistogram::BSLS_SINGLE_WRITER),
+//      bsls::LatencyHistogram(bsls::LatencyHistogram::BSLS_SINGLE_WRITER)
+//  };
+//..
+// Then, each thread records values in its own histogram:
+//..
+//  for (int i = 1; i <= 1000; ++i) {
+//      threadLatency[0].record(i);          // performed by thread 0
+//      threadLatency[1].record(1000 + i);   // performed by thread 1
+//  }
+//..
+// Finally, the monitoring thread merges the histograms into a total:
+//..
+//  bsls::LatencyHistogram total;
+//  total.add(threadLatency[0]);
+//  total.add(threadLatency[1]);
+//
+//  assert(2000 == total.count());
+//  assert(   1 == total.min());
+//  assert(2000 == total.max());
+//  assert(1000 <= total.percentile(50.0));
+//  assert(1016 >= total.percentile(50.0));
+//..
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDIO
+#include <stdio.h>
+#define INCLUDED_STDIO
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    #ifndef INCLUDED_INTRIN
+    #include <intrin.h>
+    #define INCLUDED_INTRIN
+    #endif
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // ======================
+                           // class LatencyHistogram
+                           // ======================
+
+class LatencyHistogram {
+    // This class implements a histogram of 64-bit integer values in a fixed
+    // set of log-linear buckets (see 'Bucket Layout' in the component-level
+    // documentation).  Recording values is lock-free, and, for a histogram
+    // created with 'BSLS_MULTIPLE_WRITERS', thread-safe; all accessors are
+    // thread-safe.
+
+  public:
+    // PUBLIC TYPES
+    enum Concurrency {
+        // Enumerates the ways in which a histogram may be updated.
+
+        BSLS_MULTIPLE_WRITERS,  // any number of threads may record values
+                                // concurrently
+
+        BSLS_SINGLE_WRITER      // one thread at a time may record values
+    };
+
+    enum {
+        BSLS_SUB_BUCKET_BITS     = 7,   // number of significant bits kept
+                                        // in each recorded value
+
+        BSLS_MAX_VALUE_BITS      = 40,  // number of bits of the largest
+                                        // value tracked precisely
+
+        BSLS_SUB_BUCKET_COUNT    = 1 << BSLS_SUB_BUCKET_BITS,
+                                        // number of buckets holding a
+                                        // single value each
+
+        BSLS_HALF_COUNT          = BSLS_SUB_BUCKET_COUNT / 2,
+                                        // number of buckets per power of two
+                                        // above 'BSLS_SUB_BUCKET_COUNT'
+
+        BSLS_NUM_BUCKETS         = (BSLS_MAX_VALUE_BITS
+                                    - BSLS_SUB_BUCKET_BITS + 2)
+                                 * BSLS_HALF_COUNT
+                                        // total number of buckets
+    };
+
+    static const Types::Int64 BSLS_MAX_TRACKABLE_VALUE =
+                          (static_cast<Types::Int64>(1) << BSLS_MAX_VALUE_BITS)
+                        - 1;
+        // largest value counted in a bucket of its own magnitude
+
+  private:
+    // DATA
+    AtomicInt64 d_buckets[BSLS_NUM_BUCKETS];  // number of values recorded
+                                              // in each bucket
+
+    AtomicInt64 d_sum;                        // sum of the recorded values
+
+    AtomicInt64 d_min;                        // smallest recorded value, or
+                                              // the largest 'Int64' if none
+
+    AtomicInt64 d_max;                        // largest recorded value, or
+                                              // the smallest 'Int64' if none
+
+    bool        d_singleWriterFlag;           // 'true' if updated by a
+                                              // single thread at a time
+
+    // PRIVATE CLASS METHODS
+    static int highestBit(Types::Uint64 value);
+        // Return the index of the most-significant set bit of the specified
+        // 'value'.  The behavior is undefined unless '0 != value'.
+
+    // PRIVATE MANIPULATORS
+    void increase(AtomicInt64 *counter, Types::Int64 amount);
+        // Add the specified 'amount' to the specified 'counter', atomically
+        // unless this histogram has a single writer.
+
+    void updateExtrema(Types::Int64 minValue, Types::Int64 maxValue);
+        // Lower the smallest recorded value to the specified 'minValue', and
+        // raise the largest recorded value to the specified 'maxValue', if
+        // they are not already beyond them.
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(Types::Int64 value);
+        // Return the index of the bucket that counts the specified 'value'.
+        // Negative values are counted in bucket 0, and values greater than
+        // 'BSLS_MAX_TRACKABLE_VALUE' in bucket 'BSLS_NUM_BUCKETS - 1'.
+
+    static Types::Int64 bucketLowerBound(int index);
+        // Return the smallest value counted in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < BSLS_NUM_BUCKETS'.
+
+    static Types::Int64 bucketUpperBound(int index);
+        // Return the largest value of magnitude at most
+        // 'BSLS_MAX_TRACKABLE_VALUE' counted in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < BSLS_NUM_BUCKETS'.
+
+    // CREATORS
+    explicit
+    LatencyHistogram(Concurrency concurrency = BSLS_MULTIPLE_WRITERS);
+        // Create an empty histogram.  Optionally specify a 'concurrency'
+        // indicating whether several threads may record values at the same
+        // time; if 'concurrency' is not specified, they may.
+
+    LatencyHistogram(const LatencyHistogram& original);
+        // Create a histogram having the same recorded values and concurrency
+        // as the specified 'original'.  If 'original' is updated during this
+        // call, the new histogram includes some subset of the concurrent
+        // updates.
+
+    //! ~LatencyHistogram() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    LatencyHistogram& operator=(const LatencyHistogram& rhs);
+        // Make this histogram hold the recorded values of the specified
+        // 'rhs', keeping the concurrency of this histogram, and return a
+        // reference providing modifiable access to this histogram.  The
+        // behavior is undefined if another thread records a value in this
+        // histogram during this call.
+
+    void add(const LatencyHistogram& other);
+        // Add the values recorded in the specified 'other' histogram to this
+        // histogram.  This method may be called concurrently with updates of
+        // 'other', and, if this histogram was created with
+        // 'BSLS_MULTIPLE_WRITERS', with updates of this histogram.
+
+    void record(Types::Int64 value);
+        // Record the specified 'value' in this histogram.
+
+    void recordMultiple(Types::Int64 value, Types::Int64 count);
+        // Record the specified 'value' the specified 'count' times in this
+        // histogram.  The behavior is undefined unless '0 <= count'.
+
+    void reset();
+        // Remove all recorded values from this histogram.  The behavior is
+        // undefined if another thread records a value in this histogram
+        // during this call.
+
+    // ACCESSORS
+    Types::Int64 bucketCount(int index) const;
+        // Return the number of values recorded in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < BSLS_NUM_BUCKETS'.
+
+    Concurrency concurrency() const;
+        // Return the concurrency with which this histogram was created.
+
+    Types::Int64 count() const;
+        // Return the number of values recorded in this histogram.  Note that
+        // this method visits every bucket.
+
+    Types::Int64 max() const;
+        // Return the largest value recorded in this histogram, or 0 if none
+        // was recorded.
+
+    double mean() const;
+        // Return the mean of the values recorded in this histogram, or 0 if
+        // none was recorded.
+
+    Types::Int64 min() const;
+        // Return the smallest value recorded in this histogram, or 0 if none
+        // was recorded.
+
+    Types::Int64 percentile(double percent) const;
+        // Return an upper bound, within the precision of the buckets, of the
+        // smallest recorded value that is greater than or equal to the
+        // specified 'percent' percentage of the recorded values, or 0 if no
+        // value was recorded.  The result is clamped to '[min(), max()]', so
+        // that 'percentile(0.0)' is 'min()' and 'percentile(100.0)' is
+        // 'max()'.  The behavior is undefined unless
+        // '0.0 <= percent <= 100.0'.
+
+    void print(FILE *stream) const;
+        // Write to the specified 'stream' a summary of this histogram (see
+        // 'printSummary'), followed by one line for each non-empty bucket
+        // giving its bounds, its count, and the cumulative percentage of the
+        // values recorded in it and the buckets below it.
+
+    void printSummary(FILE *stream) const;
+        // Write to the specified 'stream' one line giving the count, the
+        // minimum, the mean, and the maximum of the recorded values, and one
+        // line giving their 50th, 90th, 99th, 99.9th, and 99.99th
+        // percentiles.
+
+    Types::Int64 sum() const;
+        // Return the sum of the values recorded in this histogram.
+};
+
+                        // ===========================
+                        // class LatencyHistogramGuard
+                        // ===========================
+
+class LatencyHistogramGuard {
+    // This class implements a guard that records in a histogram the wall time
+    // elapsed, in nanoseconds, between its construction and its destruction,
+    // as measured by 'TimeUtil::getCycleCounter'.
+
+    // DATA
+    LatencyHistogram *d_histogram_p;  // histogram (held, not owned)
+    Types::Int64      d_startCount;   // cycle counter at construction
+
+    // NOT IMPLEMENTED
+    LatencyHistogramGuard(const LatencyHistogramGuard&);
+    LatencyHistogramGuard& operator=(const LatencyHistogramGuard&);
+
+  public:
+    // CREATORS
+    explicit LatencyHistogramGuard(LatencyHistogram *histogram);
+        // Create a guard that records the duration of its lifetime in the
+        // specified 'histogram'.
+
+    ~LatencyHistogramGuard();
+        // Record in the histogram held by this guard the wall time elapsed
+        // since its construction, in nanoseconds, and destroy this guard.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// PRIVATE CLASS METHODS
+inline
+int LatencyHistogram::highestBit(Types::Uint64 value)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return 63 - __builtin_clzll(value);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    int index = 0;
+    while (value >>= 1) {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// PRIVATE MANIPULATORS
+inline
+void LatencyHistogram::increase(AtomicInt64 *counter, Types::Int64 amount)
+{
+    if (d_singleWriterFlag) {
+        counter->storeRelaxed(counter->loadRelaxed() + amount);
+    }
+    else {
+        counter->addRelaxed(amount);
+    }
+}
+
+// CLASS METHODS
+inline
+int LatencyHistogram::bucketIndex(Types::Int64 value)
+{
+    if (value < BSLS_SUB_BUCKET_COUNT) {
+        return value < 0 ? 0 : static_cast<int>(value);               // RETURN
+    }
+    if (value > BSLS_MAX_TRACKABLE_VALUE) {
+        return BSLS_NUM_BUCKETS - 1;                                  // RETURN
+    }
+
+    // The value has 'highestBit + 1' significant bits; shifting out all but
+    // the top 'BSLS_SUB_BUCKET_BITS' leaves a sub-bucket index in
+    // '[BSLS_HALF_COUNT, BSLS_SUB_BUCKET_COUNT)'.
+
+    const int shift = highestBit(static_cast<Types::Uint64>(value))
+                    - (BSLS_SUB_BUCKET_BITS - 1);
+    return shift * BSLS_HALF_COUNT + static_cast<int>(value >> shift);
+}
+
+inline
+Types::Int64 LatencyHistogram::bucketLowerBound(int index)
+{
+    if (index < BSLS_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+    const int shift = index / BSLS_HALF_COUNT - 1;
+    const int sub   = index - shift * BSLS_HALF_COUNT;
+    return static_cast<Types::Int64>(sub) << shift;
+}
+
+inline
+Types::Int64 LatencyHistogram::bucketUpperBound(int index)
+{
+    if (index < BSLS_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+    const int shift = index / BSLS_HALF_COUNT - 1;
+    const int sub   = index - shift * BSLS_HALF_COUNT;
+    return (static_cast<Types::Int64>(sub + 1) << shift) - 1;
+}
+
+// MANIPULATORS
+inline
+void LatencyHistogram::record(Types::Int64 value)
+{
+    increase(&d_buckets[bucketIndex(value)], 1);
+    increase(&d_sum, value);
+    if (value < d_min.loadRelaxed() || value > d_max.loadRelaxed()) {
+        updateExtrema(value, value);
+    }
+}
+
+inline
+void LatencyHistogram::recordMultiple(Types::Int64 value, Types::Int64 count)
+{
+    if (0 == count) {
+        return;                                                       // RETURN
+    }
+    increase(&d_buckets[bucketIndex(value)], count);
+    increase(&d_sum, value * count);
+    if (value < d_min.loadRelaxed() || value > d_max.loadRelaxed()) {
+        updateExtrema(value, value);
+    }
+}
+
+// ACCESSORS
+inline
+Types::Int64 LatencyHistogram::bucketCount(int index) const
+{
+    return d_buckets[index].loadRelaxed();
+}
+
+inline
+LatencyHistogram::Concurrency LatencyHistogram::concurrency() const
+{
+    return d_singleWriterFlag ? BSLS_SINGLE_WRITER : BSLS_MULTIPLE_WRITERS;
+}
+
+inline
+Types::Int64 LatencyHistogram::sum() const
+{
+    return d_sum.loadRelaxed();
+}
+
+                        // ---------------------------
+                        // class LatencyHistogramGuard
+                        // ---------------------------
+
+// CREATORS
+inline
+LatencyHistogramGuard::LatencyHistogramGuard(LatencyHistogram *histogram)
+: d_histogram_p(histogram)
+, d_startCount(TimeUtil::getCycleCounter())
+{
+}
+
+inline
+LatencyHistogramGuard::~LatencyHistogramGuard()
+{
+    d_histogram_p->record(TimeUtil::convertCycleCount(
+                           TimeUtil::getCycleCounterOrdered() - d_startCount));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1037 @@
+// bsls_latencyhistogram.t.cpp                                        -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>     // for testing only
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>              // printf(), tmpfile()
+#include <stdlib.h>             // atoi(), qsort()
+#include <string.h>             // strstr()
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+#include <sched.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a histogram whose buckets are determined by a
+// pure function of the value, so the bucket layout is tested exhaustively
+// first: every bucket must be contiguous with the next, and narrow enough for
+// the documented precision.  Recording and the accessors are then tested
+// against values whose statistics are known exactly, including percentiles
+// of pseudo-random data compared with the sorted data.  Merging is tested
+// with histograms of each concurrency, and concurrent recording with several
+// threads updating one histogram.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int bucketIndex(Types::Int64);
+// [ 2] static Types::Int64 bucketLowerBound(int);
+// [ 2] static Types::Int64 bucketUpperBound(int);
+//
+// CREATORS
+// [ 3] explicit LatencyHistogram(Concurrency = BSLS_MULTIPLE_WRITERS);
+// [ 5] LatencyHistogram(const LatencyHistogram&);
+// [ 7] explicit LatencyHistogramGuard(LatencyHistogram *);
+// [ 7] ~LatencyHistogramGuard();
+//
+// MANIPULATORS
+// [ 5] LatencyHistogram& operator=(const LatencyHistogram&);
+// [ 5] void add(const LatencyHistogram&);
+// [ 3] void record(Types::Int64);
+// [ 3] void recordMultiple(Types::Int64, Types::Int64);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 3] Types::Int64 bucketCount(int) const;
+// [ 3] Concurrency concurrency() const;
+// [ 3] Types::Int64 count() const;
+// [ 3] Types::Int64 max() const;
+// [ 3] double mean() const;
+// [ 3] Types::Int64 min() const;
+// [ 4] Types::Int64 percentile(double) const;
+// [ 6] void print(FILE *) const;
+// [ 6] void printSummary(FILE *) const;
+// [ 3] Types::Int64 sum() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] CONCURRENT RECORDING
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COST OF RECORDING
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::LatencyHistogram      Obj;
+typedef bsls::LatencyHistogramGuard Guard;
+typedef bsls::Types::Int64          Int64;
+
+const Obj::Concurrency CONCURRENCIES[] = { Obj::BSLS_MULTIPLE_WRITERS,
+                                           Obj::BSLS_SINGLE_WRITER };
+const int NUM_CONCURRENCIES = sizeof CONCURRENCIES / sizeof *CONCURRENCIES;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef void *(*thread_func)(void *arg);
+
+thread_t createThread(thread_func func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+void joinThread(thread_t thr)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+void yieldThread()
+    // Yield the processor to other threads.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+Int64 nextRandom(Int64 *state)
+    // Advance the linear congruential generator having the specified 'state'
+    // and return a pseudo-random value in '[0, 2^31)'.
+{
+    *state = (*state * 6364136223846793005LL + 1442695040888963407LL);
+    return (*state >> 33) & 0x7fffffff;
+}
+
+extern "C" int compareInt64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Int64' at the
+    // specified 'lhs' is less than, equal to, or greater than the 'Int64' at
+    // the specified 'rhs', respectively.
+{
+    const Int64 a = *static_cast<const Int64 *>(lhs);
+    const Int64 b = *static_cast<const Int64 *>(rhs);
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+void spin(Int64 nanoseconds)
+    // Wait for at least the specified 'nanoseconds' without yielding.
+{
+    const Int64 start = bsls::TimeUtil::getTimer();
+    while (bsls::TimeUtil::getTimer() - start < nanoseconds) {
+    }
+}
+
+                            // ===================
+                            // struct RecordParams
+                            // ===================
+
+struct RecordParams {
+    // This 'struct' holds the arguments of 'recordThread'.
+
+    bsls::AtomicInt *d_start_p;      // non-zero once the threads may start
+    Obj             *d_histogram_p;  // histogram to update
+    int              d_numRecords;   // number of values to record
+    Int64            d_offset;       // offset of the recorded values
+};
+
+extern "C" void *recordThread(void *arg)
+    // Record in the histogram of the 'RecordParams' object at the specified
+    // 'arg' the values 'd_offset + i % 1000' for 'i' in '[0, d_numRecords)'.
+{
+    const RecordParams& params = *static_cast<RecordParams *>(arg);
+    while (0 == params.d_start_p->loadAcquire()) {
+        yieldThread();
+    }
+    for (int i = 0; i < params.d_numRecords; ++i) {
+        params.d_histogram_p->record(params.d_offset + i % 1000);
+    }
+    return 0;
+}
+
+double runRecords(Obj *histogram, int numThreads, int numRecords)
+    // Record, in each of the specified 'numThreads' threads at the same time,
+    // the specified 'numRecords' values in the specified 'histogram', thread
+    // 'i' recording values in '[1000 * i, 1000 * i + 1000)', and return the
+    // elapsed time in seconds.  The behavior is undefined unless
+    // '0 < numThreads <= 64' and 'histogram' was created with
+    // 'BSLS_MULTIPLE_WRITERS'.
+{
+    enum { MAX_THREADS = 64 };
+
+    bsls::AtomicInt start(0);
+    RecordParams    params[MAX_THREADS];
+    thread_t        threads[MAX_THREADS];
+
+    for (int i = 0; i < numThreads; ++i) {
+        params[i].d_start_p     = &start;
+        params[i].d_histogram_p = histogram;
+        params[i].d_numRecords  = numRecords;
+        params[i].d_offset      = 1000 * i;
+        threads[i] = createThread(&recordThread, &params[i]);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    start.storeRelease(1);
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(threads[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+bsls::LatencyHistogram processLatency;
+
+int processRequest(int request)
+{
+    bsls::LatencyHistogramGuard guard(&processLatency);
+
+    int result = 0;
+    for (int i = 0; i < request; ++i) {
+        result += i * request;
+    }
+    return result;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   Write the summary only in verbose mode.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        int sum = 0;
+        for (int i = 0; i < 10000; ++i) {
+            sum += processRequest(i % 100);
+        }
+
+        ASSERT(10000 == processLatency.count());
+
+        const bsls::Types::Int64 p50 = processLatency.percentile(50.0);
+        const bsls::Types::Int64 p99 = processLatency.percentile(99.0);
+        ASSERT(p50 <= p99);
+        ASSERT(p99 <= processLatency.max());
+
+        if (verbose) processLatency.printSummary(stdout);
+
+        bsls::LatencyHistogram threadLatency[2] = {
+            bsls::LatencyHistogram(bsls::LatencyHistogram::BSLS_SINGLE_WRITER),
+            bsls::LatencyHistogram(bsls::LatencyHistogram::BSLS_SINGLE_WRITER)
+        };
+
+        for (int i = 1; i <= 1000; ++i) {
+            threadLatency[0].record(i);          // performed by thread 0
+            threadLatency[1].record(1000 + i);   // performed by thread 1
+        }
+
+        bsls::LatencyHistogram total;
+        total.add(threadLatency[0]);
+        total.add(threadLatency[1]);
+
+        ASSERT(2000 == total.count());
+        ASSERT(   1 == total.min());
+        ASSERT(2000 == total.max());
+        ASSERT(1000 <= total.percentile(50.0));
+        ASSERT(1016 >= total.percentile(50.0));
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENT RECORDING
+        //
+        // Concerns:
+        //: 1 No value is lost when several threads record values in the same
+        //:   'BSLS_MULTIPLE_WRITERS' histogram at the same time.
+        //:
+        //: 2 The minimum, maximum, and sum are exact after concurrent
+        //:   recording.
+        //:
+        //: 3 Per-thread 'BSLS_SINGLE_WRITER' histograms merge into the same
+        //:   result.
+        //
+        // Plan:
+        //: 1 Have 4 threads record 100000 values each, thread 'i' recording
+        //:   values in '[1000 * i, 1000 * i + 1000)', in one histogram, and
+        //:   verify the count, sum, extrema, and bucket counts.  (C-1..2)
+        //:
+        //: 2 Repeat with one single-writer histogram per thread, merge them,
+        //:   and verify that the merged histogram matches.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT RECORDING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT RECORDING"
+                            "\n====================\n");
+
+        enum { NUM_THREADS = 4, NUM_RECORDS = 100000 };
+
+        // Each thread records each of its 1000 values 100 times.
+
+        const Int64 EXPECTED_SUM = 100 * (Int64) (NUM_THREADS * 1000)
+                                 * (NUM_THREADS * 1000 - 1) / 2;
+
+        Obj shared;
+        runRecords(&shared, NUM_THREADS, NUM_RECORDS);
+
+        ASSERTV(shared.count(), NUM_THREADS * NUM_RECORDS == shared.count());
+        ASSERTV(shared.sum(), EXPECTED_SUM == shared.sum());
+        ASSERTV(shared.min(), 0 == shared.min());
+        ASSERTV(shared.max(), NUM_THREADS * 1000 - 1 == shared.max());
+
+        Obj expected;
+        for (int v = 0; v < NUM_THREADS * 1000; ++v) {
+            expected.recordMultiple(v, 100);
+        }
+        for (int i = 0; i < Obj::BSLS_NUM_BUCKETS; ++i) {
+            ASSERTV(i, expected.bucketCount(i) == shared.bucketCount(i));
+        }
+
+        if (verbose) printf("\tMerging per-thread histograms.\n");
+
+        Obj merged;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            Obj local(Obj::BSLS_SINGLE_WRITER);
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                local.record(1000 * t + i % 1000);
+            }
+            merged.add(local);
+        }
+        ASSERTV(merged.count(), NUM_THREADS * NUM_RECORDS == merged.count());
+        ASSERTV(merged.sum(), EXPECTED_SUM == merged.sum());
+        for (int i = 0; i < Obj::BSLS_NUM_BUCKETS; ++i) {
+            ASSERTV(i, expected.bucketCount(i) == merged.bucketCount(i));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // GUARD
+        //
+        // Concerns:
+        //: 1 A guard records exactly one value, when it is destroyed.
+        //:
+        //: 2 The recorded value is the duration of the guarded scope in
+        //:   nanoseconds.
+        //
+        // Plan:
+        //: 1 Guard scopes that wait for 1, 2, and 4 milliseconds, verify the
+        //:   count after each scope, and verify that each recorded value is
+        //:   at least the waiting time (less the precision of the cycle
+        //:   counter) and less than a second.  (C-1..2)
+        //
+        // Testing:
+        //   explicit LatencyHistogramGuard(LatencyHistogram *);
+        //   ~LatencyHistogramGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nGUARD"
+                            "\n=====\n");
+
+        bsls::TimeUtil::initialize();
+        bsls::TimeUtil::calibrateCycleCounter();
+
+        for (int i = 0; i < 3; ++i) {
+            const Int64 WAIT = 1000 * 1000 << i;
+
+            Obj mX;  const Obj& X = mX;
+            {
+                Guard guard(&mX);
+                ASSERTV(i, 0 == X.count());
+                spin(WAIT);
+            }
+            ASSERTV(i, 1 == X.count());
+
+            if (veryVerbose) { T_; P_(WAIT); P(X.max()); }
+
+            ASSERTV(i, X.max(), WAIT - WAIT / 100 <= X.max());
+            ASSERTV(i, X.max(), 1000 * 1000 * 1000 > X.max());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // PRINT
+        //
+        // Concerns:
+        //: 1 'printSummary' writes the count, extrema, mean, and percentiles.
+        //:
+        //: 2 'print' writes the summary and one line per non-empty bucket.
+        //:
+        //: 3 'print' of an empty histogram writes only the summary.
+        //
+        // Plan:
+        //: 1 Print histograms to a temporary file, read the file back, and
+        //:   search it for the expected text.  (C-1..3)
+        //
+        // Testing:
+        //   void print(FILE *) const;
+        //   void printSummary(FILE *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRINT"
+                            "\n=====\n");
+
+        Obj mX;  const Obj& X = mX;
+        mX.record(5);
+        mX.record(5);
+        mX.record(1000);
+
+        for (int ti = 0; ti < 3; ++ti) {
+            FILE *file = tmpfile();
+            ASSERTV(ti, 0 != file);
+            if (0 == file) {
+                continue;
+            }
+
+            Obj empty;
+            switch (ti) {
+              case 0: X.printSummary(file); break;
+              case 1: X.print(file);        break;
+              case 2: empty.print(file);    break;
+            }
+
+            char buffer[1024];
+            const size_t length = fread(buffer,
+                                        1,
+                                        sizeof buffer - 1,
+                                        (rewind(file), file));
+            buffer[length] = '\0';
+            fclose(file);
+
+            if (veryVerbose) printf("%s", buffer);
+
+            if (2 == ti) {
+                ASSERTV(ti, 0 != strstr(buffer, "count=0 min=0"));
+                ASSERTV(ti, 0 == strstr(buffer, "cumulative"));
+                continue;
+            }
+
+            ASSERTV(ti, 0 != strstr(buffer,
+                                    "count=3 min=5 mean=336.7 max=1000\n"));
+            ASSERTV(ti, 0 != strstr(buffer, "p50=5 p90=1000 p99=1000"));
+
+            const bool HAS_BUCKETS = 0 != strstr(buffer, "cumulative");
+            ASSERTV(ti, (1 == ti) == HAS_BUCKETS);
+            if (HAS_BUCKETS) {
+                ASSERTV(ti, 0 != strstr(buffer, " 2      66.6667\n"));
+                ASSERTV(ti, 0 != strstr(buffer, " 1     100.0000\n"));
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MERGING, COPYING, AND ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 'add' adds the bucket counts and the sums, and combines the
+        //:   extrema, of histograms of either concurrency.
+        //:
+        //: 2 Adding an empty histogram changes nothing.
+        //:
+        //: 3 The copy constructor copies the values and the concurrency.
+        //:
+        //: 4 Assignment replaces the values and keeps the concurrency, and
+        //:   self-assignment changes nothing.
+        //
+        // Plan:
+        //: 1 Merge histograms of disjoint value sets in every combination of
+        //:   concurrencies, and compare with a histogram recording both sets.
+        //:   (C-1..2)
+        //:
+        //: 2 Copy and assign the histograms, and compare.  (C-3..4)
+        //
+        // Testing:
+        //   LatencyHistogram(const LatencyHistogram&);
+        //   LatencyHistogram& operator=(const LatencyHistogram&);
+        //   void add(const LatencyHistogram&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMERGING, COPYING, AND ASSIGNMENT"
+                            "\n================================\n");
+
+        Obj both;
+        for (Int64 v = 1; v < 100000; v += 37) {
+            both.record(v);
+            both.record(v * 1000);
+        }
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            for (int cj = 0; cj < NUM_CONCURRENCIES; ++cj) {
+                Obj mX(CONCURRENCIES[ci]);  const Obj& X = mX;
+                Obj mY(CONCURRENCIES[cj]);  const Obj& Y = mY;
+                for (Int64 v = 1; v < 100000; v += 37) {
+                    mX.record(v);
+                    mY.record(v * 1000);
+                }
+
+                const Obj EMPTY;
+                mX.add(EMPTY);
+                mX.add(Y);
+
+                ASSERTV(ci, cj, both.count() == X.count());
+                ASSERTV(ci, cj, both.sum()   == X.sum());
+                ASSERTV(ci, cj, both.min()   == X.min());
+                ASSERTV(ci, cj, both.max()   == X.max());
+                ASSERTV(ci, cj, CONCURRENCIES[ci] == X.concurrency());
+                for (int i = 0; i < Obj::BSLS_NUM_BUCKETS; ++i) {
+                    ASSERTV(ci, cj, i, both.bucketCount(i) ==
+                                                            X.bucketCount(i));
+                }
+
+                const Obj C(X);
+                ASSERTV(ci, cj, CONCURRENCIES[ci] == C.concurrency());
+                ASSERTV(ci, cj, X.count() == C.count());
+                ASSERTV(ci, cj, X.sum()   == C.sum());
+                ASSERTV(ci, cj, X.min()   == C.min());
+                ASSERTV(ci, cj, X.max()   == C.max());
+
+                mY = X;
+                ASSERTV(ci, cj, CONCURRENCIES[cj] == Y.concurrency());
+                ASSERTV(ci, cj, X.count() == Y.count());
+                ASSERTV(ci, cj, X.sum()   == Y.sum());
+                ASSERTV(ci, cj, X.min()   == Y.min());
+                ASSERTV(ci, cj, X.max()   == Y.max());
+                for (int i = 0; i < Obj::BSLS_NUM_BUCKETS; ++i) {
+                    ASSERTV(ci, cj, i, X.bucketCount(i) == Y.bucketCount(i));
+                }
+
+                const Obj *const ADDRESS = &(mY = Y);
+                ASSERTV(ci, cj, &Y == ADDRESS);
+                ASSERTV(ci, cj, X.count() == Y.count());
+
+                mY = EMPTY;
+                ASSERTV(ci, cj, 0 == Y.count());
+                ASSERTV(ci, cj, 0 == Y.min());
+                ASSERTV(ci, cj, 0 == Y.max());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // PERCENTILES
+        //
+        // Concerns:
+        //: 1 An empty histogram has all percentiles equal to 0.
+        //:
+        //: 2 'percentile(0.0)' is the minimum and 'percentile(100.0)' the
+        //:   maximum.
+        //:
+        //: 3 Percentiles of values below 'BSLS_SUB_BUCKET_COUNT' are exact.
+        //:
+        //: 4 Every percentile of arbitrary values is at least the exact
+        //:   percentile, and exceeds it by at most 1/64 of it.
+        //:
+        //: 5 Percentiles do not decrease with the percentage.
+        //
+        // Plan:
+        //: 1 Query an empty histogram.  (C-1)
+        //:
+        //: 2 Record 0..99 and query every integral percentage.  (C-2..3)
+        //:
+        //: 3 Record 10000 pseudo-random values spanning several magnitudes,
+        //:   sort them, and compare every percentile from 0 to 100 in steps
+        //:   of 0.5, and 99.9 and 99.99, with the value of the corresponding
+        //:   rank.  (C-2, 4..5)
+        //
+        // Testing:
+        //   Types::Int64 percentile(double) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERCENTILES"
+                            "\n===========\n");
+
+        if (verbose) printf("\tEmpty histogram.\n");
+        {
+            const Obj X;
+            ASSERT(0 == X.percentile(0.0));
+            ASSERT(0 == X.percentile(50.0));
+            ASSERT(0 == X.percentile(100.0));
+        }
+
+        if (verbose) printf("\tSmall values.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            for (int v = 0; v < 100; ++v) {
+                mX.record(v);
+            }
+            ASSERT( 0 == X.percentile(0.0));
+            ASSERT(99 == X.percentile(100.0));
+            for (int p = 1; p <= 100; ++p) {
+                ASSERTV(p, X.percentile(p), p - 1 == X.percentile(p));
+            }
+        }
+
+        if (verbose) printf("\tPseudo-random values.\n");
+        {
+            enum { NUM_VALUES = 10000 };
+            static Int64 values[NUM_VALUES];
+
+            Obj   mX;  const Obj& X = mX;
+            Int64 state = 12345;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                // Exponent in [0, 30), so values span many magnitudes.
+
+                const Int64 r = nextRandom(&state);
+                values[i] = (r % 1024 + 1) << (nextRandom(&state) % 30);
+                mX.record(values[i]);
+            }
+            qsort(values, NUM_VALUES, sizeof *values, &compareInt64);
+
+            ASSERT(values[0]              == X.percentile(0.0));
+            ASSERT(values[NUM_VALUES - 1] == X.percentile(100.0));
+
+            double PERCENTS[203];
+            int    numPercents = 0;
+            for (int i = 0; i < 200; ++i) {
+                PERCENTS[numPercents++] = i * 0.5;
+            }
+            PERCENTS[numPercents++] = 99.9;
+            PERCENTS[numPercents++] = 99.99;
+            PERCENTS[numPercents++] = 100.0;
+
+            Int64 previous = 0;
+            for (int i = 0; i < numPercents; ++i) {
+                const double P    = PERCENTS[i];
+                Int64        rank = (Int64) (P * NUM_VALUES / 100.0);
+                if ((double) rank < P * NUM_VALUES / 100.0) {
+                    ++rank;
+                }
+                const Int64  EXACT  = values[rank < 1 ? 0 : rank - 1];
+                const Int64  RESULT = X.percentile(P);
+
+                if (veryVerbose) { T_; P_(P); P_(EXACT); P(RESULT); }
+
+                ASSERTV(P, EXACT, RESULT, EXACT <= RESULT);
+                ASSERTV(P, EXACT, RESULT, RESULT - EXACT <= EXACT / 64);
+                ASSERTV(P, previous, RESULT, previous <= RESULT);
+                previous = RESULT;
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RECORDING AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A new histogram is empty: its count, sum, mean, minimum, maximum
+        //:   and every bucket count are 0.
+        //:
+        //: 2 'record' increments the count of the bucket of the value, adds
+        //:   the value to the sum, and updates the extrema.
+        //:
+        //: 3 'recordMultiple' is equivalent to repeated 'record', and
+        //:   recording a value 0 times changes nothing.
+        //:
+        //: 4 Negative values and values above 'BSLS_MAX_TRACKABLE_VALUE' are
+        //:   counted in the first and last bucket, and reported exactly by
+        //:   'min' and 'max'.
+        //:
+        //: 5 'reset' returns the histogram to the empty state.
+        //:
+        //: 6 The above hold for both concurrencies, and 'concurrency' reports
+        //:   the concurrency given at construction.
+        //
+        // Plan:
+        //: 1 For each concurrency, record a sequence of values and verify the
+        //:   accessors after each, then reset.  (C-1..6)
+        //
+        // Testing:
+        //   explicit LatencyHistogram(Concurrency = BSLS_MULTIPLE_WRITERS);
+        //   void record(Types::Int64);
+        //   void recordMultiple(Types::Int64, Types::Int64);
+        //   void reset();
+        //   Types::Int64 bucketCount(int) const;
+        //   Concurrency concurrency() const;
+        //   Types::Int64 count() const;
+        //   Types::Int64 max() const;
+        //   double mean() const;
+        //   Types::Int64 min() const;
+        //   Types::Int64 sum() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRECORDING AND BASIC ACCESSORS"
+                            "\n=============================\n");
+
+        {
+            const Obj X;
+            ASSERT(Obj::BSLS_MULTIPLE_WRITERS == X.concurrency());
+        }
+
+        const Int64 BIG = Obj::BSLS_MAX_TRACKABLE_VALUE;
+
+        static const struct {
+            int   d_line;
+            Int64 d_value;
+            Int64 d_times;
+            Int64 d_expMin;
+            Int64 d_expMax;
+        } DATA[] = {
+            //LINE  VALUE      TIMES  MIN    MAX
+            //----  ---------  -----  -----  ---------
+            { L_,   100,       1,     100,   100       },
+            { L_,   50,        2,     50,    100       },
+            { L_,   7,         0,     50,    100       },
+            { L_,   1000000,   3,     50,    1000000   },
+            { L_,   -5,        1,     -5,    1000000   },
+            { L_,   BIG,       1,     -5,    BIG       },
+            { L_,   BIG + 99,  2,     -5,    BIG + 99  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            Obj mX(CONCURRENCIES[ci]);  const Obj& X = mX;
+
+            ASSERTV(ci, CONCURRENCIES[ci] == X.concurrency());
+
+            for (int pass = 0; pass < 2; ++pass) {
+                ASSERTV(ci, pass, 0   == X.count());
+                ASSERTV(ci, pass, 0   == X.sum());
+                ASSERTV(ci, pass, 0.0 == X.mean());
+                ASSERTV(ci, pass, 0   == X.min());
+                ASSERTV(ci, pass, 0   == X.max());
+                for (int i = 0; i < Obj::BSLS_NUM_BUCKETS; ++i) {
+                    ASSERTV(ci, pass, i, 0 == X.bucketCount(i));
+                }
+
+                Int64 expCount = 0;
+                Int64 expSum   = 0;
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int   LINE  = DATA[ti].d_line;
+                    const Int64 VALUE = DATA[ti].d_value;
+                    const Int64 TIMES = DATA[ti].d_times;
+                    const int   INDEX = Obj::bucketIndex(VALUE);
+
+                    const Int64 BEFORE = X.bucketCount(INDEX);
+
+                    if (1 == TIMES && 0 == pass) {
+                        mX.record(VALUE);
+                    }
+                    else {
+                        mX.recordMultiple(VALUE, TIMES);
+                    }
+                    expCount += TIMES;
+                    expSum   += VALUE * TIMES;
+
+                    ASSERTV(ci, LINE, BEFORE + TIMES == X.bucketCount(INDEX));
+                    ASSERTV(ci, LINE, expCount == X.count());
+                    ASSERTV(ci, LINE, expSum   == X.sum());
+                    ASSERTV(ci, LINE, X.min(), DATA[ti].d_expMin == X.min());
+                    ASSERTV(ci, LINE, X.max(), DATA[ti].d_expMax == X.max());
+                    ASSERTV(ci, LINE, (double) expSum / (double) expCount
+                                                                == X.mean());
+                }
+                ASSERTV(ci, 1 == X.bucketCount(0));
+                ASSERTV(ci, 3 == X.bucketCount(Obj::BSLS_NUM_BUCKETS - 1));
+
+                mX.reset();
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 Values below 'BSLS_SUB_BUCKET_COUNT' have buckets of their own.
+        //:
+        //: 2 The buckets are contiguous and cover '[0, MAX]', where 'MAX' is
+        //:   'BSLS_MAX_TRACKABLE_VALUE'.
+        //:
+        //: 3 'bucketIndex' maps both bounds of each bucket to that bucket.
+        //:
+        //: 4 The width of each bucket is at most 1/64 of its lower bound.
+        //:
+        //: 5 Negative values map to bucket 0, and values above 'MAX' to the
+        //:   last bucket.
+        //
+        // Plan:
+        //: 1 Visit every bucket and verify its bounds against those of the
+        //:   previous bucket, and the index of its bounds and midpoint.
+        //:   (C-1..4)
+        //:
+        //: 2 Map extreme values.  (C-5)
+        //
+        // Testing:
+        //   static int bucketIndex(Types::Int64);
+        //   static Types::Int64 bucketLowerBound(int);
+        //   static Types::Int64 bucketUpperBound(int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBUCKET LAYOUT"
+                            "\n=============\n");
+
+        ASSERT(2240 == Obj::BSLS_NUM_BUCKETS);
+
+        Int64 previousUpper = -1;
+        for (int i = 0; i < Obj::BSLS_NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Obj::bucketLowerBound(i);
+            const Int64 UPPER = Obj::bucketUpperBound(i);
+
+            if (veryVerbose && i % 64 == 0) { T_; P_(i); P_(LOWER); P(UPPER); }
+
+            ASSERTV(i, LOWER, previousUpper + 1 == LOWER);
+            ASSERTV(i, LOWER, UPPER, LOWER <= UPPER);
+            if (i < Obj::BSLS_SUB_BUCKET_COUNT) {
+                ASSERTV(i, LOWER, UPPER, i == LOWER && i == UPPER);
+            }
+            else {
+                ASSERTV(i, LOWER, UPPER, (UPPER - LOWER + 1) * 64 <= LOWER);
+            }
+
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+            ASSERTV(i, i == Obj::bucketIndex(UPPER));
+            ASSERTV(i, i == Obj::bucketIndex(LOWER + (UPPER - LOWER) / 2));
+
+            previousUpper = UPPER;
+        }
+        ASSERT(Obj::BSLS_MAX_TRACKABLE_VALUE == previousUpper);
+
+        const Int64 MAX_INT64 = (Int64) (~(bsls::Types::Uint64) 0 >> 1);
+
+        ASSERT(0 == Obj::bucketIndex(-1));
+        ASSERT(0 == Obj::bucketIndex(-MAX_INT64));
+        ASSERT(Obj::BSLS_NUM_BUCKETS - 1 ==
+                         Obj::bucketIndex(Obj::BSLS_MAX_TRACKABLE_VALUE + 1));
+        ASSERT(Obj::BSLS_NUM_BUCKETS - 1 == Obj::bucketIndex(MAX_INT64));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record a few values and query the histogram.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.count());
+
+        mX.record(10);
+        mX.record(20);
+        mX.record(30);
+        ASSERT( 3 == X.count());
+        ASSERT(60 == X.sum());
+        ASSERT(10 == X.min());
+        ASSERT(30 == X.max());
+        ASSERT(20 == X.percentile(50.0));
+        ASSERT(20.0 == X.mean());
+
+        mX.reset();
+        ASSERT(0 == X.count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COST OF RECORDING
+        //
+        // Concerns:
+        //: 1 Report the cost of recording a value for each concurrency, of a
+        //:   guarded scope, and of recording from several threads into one
+        //:   histogram.
+        //
+        // Plan:
+        //: 1 Time a loop recording varied values in a histogram of each
+        //:   concurrency, and a loop of empty guarded scopes, and print the
+        //:   time per iteration.  (C-1)
+        //:
+        //: 2 For 1 to 8 threads, time a fixed total number of records into
+        //:   one 'BSLS_MULTIPLE_WRITERS' histogram.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COST OF RECORDING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: COST OF RECORDING"
+                            "\n===================================\n");
+
+        const int NUM_RECORDS = 1 << 24;
+
+        bsls::TimeUtil::initialize();
+        bsls::TimeUtil::calibrateCycleCounter();
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            Obj mX(CONCURRENCIES[ci]);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.record(i & 0xfffff);
+            }
+            timer.stop();
+
+            ASSERTV(ci, NUM_RECORDS == mX.count());
+            printf("record (%s): %6.2f ns\n",
+                   Obj::BSLS_SINGLE_WRITER == CONCURRENCIES[ci]
+                                                          ? "single writer  "
+                                                          : "multiple writers",
+                   timer.elapsedTime() * 1e9 / NUM_RECORDS);
+        }
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            Obj mX(CONCURRENCIES[ci]);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS / 4; ++i) {
+                Guard guard(&mX);
+            }
+            timer.stop();
+
+            ASSERTV(ci, NUM_RECORDS / 4 == mX.count());
+            printf("guard  (%s): %6.2f ns (p50 of recorded %lld ns)\n",
+                   Obj::BSLS_SINGLE_WRITER == CONCURRENCIES[ci]
+                                                          ? "single writer  "
+                                                          : "multiple writers",
+                   timer.elapsedTime() * 1e9 / (NUM_RECORDS / 4),
+                   (long long) mX.percentile(50.0));
+        }
+
+        printf("\n%8s %14s   (ns/record, one shared histogram)\n",
+               "threads", "record");
+        for (int n = 1; n <= 8; n *= 2) {
+            Obj shared;
+            const double T = runRecords(&shared, n, NUM_RECORDS / n);
+            ASSERTV(n, (NUM_RECORDS / n) * n == shared.count());
+            printf("%8d %14.2f\n", n, T * 1e9 / NUM_RECORDS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
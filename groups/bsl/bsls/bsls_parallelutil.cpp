@@ -0,0 +1,176 @@
+// bsls_parallelutil.cpp                                              -*-C++-*-
+#include <bsls_parallelutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_atomic.h>
+#include <bsls_bslthreadutil.h>
+#include <bsls_platform.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+struct TaskQueue {
+    // This 'struct' holds the tasks of one call to 'bsls::ParallelUtil::run'
+    // that have not yet been taken by a thread.
+
+    bsls::ParallelUtil::TaskFunction  d_function;  // task function
+    void                             *d_context_p; // task context
+    int                               d_numTasks;  // number of tasks
+    bsls::AtomicInt                   d_nextTask;  // lowest task not taken
+};
+
+void runTasks(TaskQueue *queue)
+    // Run the tasks of the specified 'queue' that are not yet taken, until
+    // all of them are taken.
+{
+    for (;;) {
+        const int taskIndex = queue->d_nextTask.add(1) - 1;
+        if (taskIndex >= queue->d_numTasks) {
+            return;                                                   // RETURN
+        }
+        queue->d_function(queue->d_context_p, taskIndex);
+    }
+}
+
+void runHelper(void *queue)
+    // Run the tasks of the specified 'queue', of type 'TaskQueue', that are
+    // not yet taken, until all of them are taken.
+{
+    runTasks(static_cast<TaskQueue *>(queue));
+}
+
+bsls::AtomicInt cachedNumHardwareThreads(0);
+    // number of hardware threads, or 0 if not yet determined
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                            // --------------------
+                            // class ParallelPolicy
+                            // --------------------
+
+// ACCESSORS
+int ParallelPolicy::numChunks(std::size_t numElements) const
+{
+    const std::size_t maxChunksBySize = numElements / d_minChunkSize;
+    if (maxChunksBySize < 2) {
+        return 1;                                                     // RETURN
+    }
+
+    const int threads = numThreads();
+    if (1 == threads) {
+        return 1;                                                     // RETURN
+    }
+
+    const int maxChunks = threads * BSLS_CHUNKS_PER_THREAD;
+    return maxChunksBySize < static_cast<std::size_t>(maxChunks)
+           ? static_cast<int>(maxChunksBySize)
+           : maxChunks;
+}
+
+int ParallelPolicy::numThreads() const
+{
+    const int threads = 0 == d_numThreads
+                        ? ParallelUtil::numHardwareThreads()
+                        : d_numThreads;
+    return threads < BSLS_MAX_THREADS ? threads : BSLS_MAX_THREADS;
+}
+
+                            // -------------------
+                            // struct ParallelUtil
+                            // -------------------
+
+// CLASS METHODS
+int ParallelUtil::numHardwareThreads()
+{
+    int result = cachedNumHardwareThreads.loadRelaxed();
+    if (0 == result) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        result = static_cast<int>(info.dwNumberOfProcessors);
+#else
+        result = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+        result = result < 1 ? 1 : result;
+        cachedNumHardwareThreads.storeRelaxed(result);
+    }
+    return result;
+}
+
+void ParallelUtil::run(TaskFunction  function,
+                       void         *context,
+                       int           numTasks,
+                       int           numThreads)
+{
+    BSLS_ASSERT(function);
+    BSLS_ASSERT(0 <= numTasks);
+    BSLS_ASSERT(0 <  numThreads);
+
+    if (numThreads > numTasks) {
+        numThreads = numTasks;
+    }
+    if (numThreads > ParallelPolicy::BSLS_MAX_THREADS) {
+        numThreads = ParallelPolicy::BSLS_MAX_THREADS;
+    }
+
+    TaskQueue queue;
+    queue.d_function  = function;
+    queue.d_context_p = context;
+    queue.d_numTasks  = numTasks;
+
+    // Create the helper threads, then help them.  A helper that cannot be
+    // created is simply not waited for.
+
+    BslThreadUtil::Handle threads[ParallelPolicy::BSLS_MAX_THREADS];
+    int                   numHelpers = 0;
+    for (int i = 1; i < numThreads; ++i) {
+        if (0 == BslThreadUtil::create(&threads[numHelpers],
+                                       &runHelper,
+                                       &queue)) {
+            ++numHelpers;
+        }
+    }
+
+    runTasks(&queue);
+
+    for (int i = 0; i < numHelpers; ++i) {
+        BslThreadUtil::join(&threads[i]);
+    }
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
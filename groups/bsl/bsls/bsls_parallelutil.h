@@ -0,0 +1,375 @@
+// bsls_parallelutil.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLS_PARALLELUTIL
+#define INCLUDED_BSLS_PARALLELUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a policy and a utility to split work across threads.
+//
+//@CLASSES:
+//  bsls::ParallelPolicy: number of threads and chunk size of a parallel call
+//  bsls::ParallelUtil: run indexed tasks on the calling and helper threads
+//
+//@SEE_ALSO: bslalg_parallelarrayprimitives
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bsls::ParallelUtil', that runs a number of independent, indexed tasks on
+// the calling thread and on helper threads created for the call, and a
+// simply constrained attribute class, 'bsls::ParallelPolicy', that describes
+// how an operation on a range of elements may be split into such tasks.  The
+// two are intended for the few low-level operations whose cost on large
+// ranges is dominated by work that is independent for each element (e.g.,
+// constructing or destroying the elements of a large array); clients opt in
+// to parallel execution by passing a 'bsls::ParallelPolicy' to an overload
+// of such an operation.
+//
+///Parallel Policy
+///---------------
+// A 'bsls::ParallelPolicy' has two attributes:
+//..
+//  Name          Type         Default                      Constraints
+//  ------------  -----------  ---------------------------  ----------------
+//  numThreads    int          0                            0 <= numThreads
+//  minChunkSize  std::size_t  BSLS_DEFAULT_MIN_CHUNK_SIZE  0 < minChunkSize
+//..
+//: o 'numThreads': the maximum number of threads, including the calling
+//:   thread, that may work on one operation; 0 means the number of hardware
+//:   threads, and 1 means that the operation is done serially.
+//:
+//: o 'minChunkSize': the minimum number of elements handled by one task, so
+//:   that ranges too small to benefit from threads are handled serially.
+//
+// 'numChunks' returns the number of tasks into which a range of a given
+// number of elements is split: 1 (i.e., serial execution) if the range has
+// fewer than '2 * minChunkSize' elements or if at most one thread may be
+// used, and otherwise up to 'BSLS_CHUNKS_PER_THREAD' tasks per thread, so
+// that a thread that is descheduled delays the operation less.
+//
+///Threads
+///-------
+// 'bsls::ParallelUtil::run' creates its helper threads when called and joins
+// them before returning; it keeps no threads between calls.  Creating a
+// thread costs in the order of tens of microseconds, which is why the policy
+// leaves ranges of fewer than '2 * minChunkSize' elements to the calling
+// thread.  If a helper thread cannot be created, its tasks are run by the
+// threads that were created, so that 'run' always runs every task.
+//
+// Tasks are assigned to threads dynamically: each thread repeatedly takes the
+// task of lowest index that has not yet been taken.  The tasks must not throw
+// exceptions; see 'bslalg_parallelarrayprimitives' for a way to propagate
+// failures of tasks to the caller.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Summing the Chunks of a Large Array in Parallel
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to compute the sum of each chunk of a large array of
+// integers, using the number of threads and the chunk size described by a
+// 'bsls::ParallelPolicy'.
+//
+// First, we define the context shared by the tasks, and a function that
+// computes the sum of the chunk having a given index:
+//..
+//  struct SumContext {
+//      const int          *d_data_p;        // array to sum
+//      std::size_t         d_numElements;   // size of the array
+//      int                 d_numChunks;     // number of chunks
+//      bsls::Types::Int64  d_sums[bsls::ParallelPolicy::BSLS_MAX_CHUNKS];
+//                                           // sum of each chunk
+//  };
+//
+//  void sumChunk(void *context, int chunkIndex)
+//  {
+//      SumContext& sum = *static_cast<SumContext *>(context);
+//
+//      const std::size_t begin = bsls::ParallelUtil::chunkBegin(
+//                                                         sum.d_numElements,
+//                                                         sum.d_numChunks,
+//                                                         chunkIndex);
+//      const std::size_t end   = bsls::ParallelUtil::chunkBegin(
+//                                                         sum.d_numElements,
+//                                                         sum.d_numChunks,
+//                                                         chunkIndex + 1);
+//
+//      bsls::Types::Int64 total = 0;
+//      for (std::size_t i = begin; i < end; ++i) {
+//          total += sum.d_data_p[i];
+//      }
+//      sum.d_sums[chunkIndex] = total;
+//  }
+//..
+// Then, we create the array, and a policy allowing 4 threads, with chunks of
+// at least 1000 elements:
+//..
+//  enum { k_NUM_ELEMENTS = 20000 };
+//
+//  static int data[k_NUM_ELEMENTS];
+//  for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+//      data[i] = i % 10;
+//  }
+//
+//  const bsls::ParallelPolicy policy(4, 1000);
+//..
+// Next, we split the array into chunks as described by the policy:
+//..
+//  SumContext context;
+//  context.d_data_p      = data;
+//  context.d_numElements = k_NUM_ELEMENTS;
+//  context.d_numChunks   = policy.numChunks(k_NUM_ELEMENTS);
+//
+//  assert(16 == context.d_numChunks);  // 4 threads, 4 chunks per thread
+//..
+// Now, we run the tasks:
+//..
+//  bsls::ParallelUtil::run(&sumChunk,
+//                          &context,
+//                          context.d_numChunks,
+//                          policy.numThreads());
+//..
+// Finally, we add up the sums of the chunks:
+//..
+//  bsls::Types::Int64 total = 0;
+//  for (int i = 0; i < context.d_numChunks; ++i) {
+//      total += context.d_sums[i];
+//  }
+//  assert(90000 == total);
+//..
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                            // ====================
+                            // class ParallelPolicy
+                            // ====================
+
+class ParallelPolicy {
+    // This simply constrained attribute class describes how an operation on
+    // a range of elements may be split into tasks run by several threads.
+    // See {Parallel Policy}.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        BSLS_DEFAULT_MIN_CHUNK_SIZE = 32 * 1024,  // default minimum number of
+                                                  // elements per chunk
+
+        BSLS_CHUNKS_PER_THREAD      = 4,          // maximum number of chunks
+                                                  // per thread
+
+        BSLS_MAX_THREADS            = 64,         // maximum number of
+                                                  // threads per operation
+
+        BSLS_MAX_CHUNKS             = BSLS_CHUNKS_PER_THREAD
+                                    * BSLS_MAX_THREADS
+                                                  // maximum number of chunks
+    };
+
+  private:
+    // DATA
+    int         d_numThreads;    // maximum number of threads, or 0 for the
+                                 // number of hardware threads
+
+    std::size_t d_minChunkSize;  // minimum number of elements per chunk
+
+  public:
+    // CLASS METHODS
+    static ParallelPolicy serial();
+        // Return a policy that uses only the calling thread.
+
+    // CREATORS
+    explicit
+    ParallelPolicy(int         numThreads   = 0,
+                   std::size_t minChunkSize = BSLS_DEFAULT_MIN_CHUNK_SIZE);
+        // Create a policy allowing the optionally specified 'numThreads'
+        // threads, including the calling thread, to work on an operation, in
+        // chunks of at least the optionally specified 'minChunkSize'
+        // elements.  If 'numThreads' is not specified or is 0, the number of
+        // hardware threads is used.  The behavior is undefined unless
+        // '0 <= numThreads' and '0 < minChunkSize'.
+
+    // ParallelPolicy(const ParallelPolicy& original) = default;
+    // ~ParallelPolicy() = default;
+
+    // MANIPULATORS
+    // ParallelPolicy& operator=(const ParallelPolicy& rhs) = default;
+
+    void setMinChunkSize(std::size_t value);
+        // Set the minimum number of elements per chunk of this policy to the
+        // specified 'value'.  The behavior is undefined unless '0 < value'.
+
+    void setNumThreads(int value);
+        // Set the maximum number of threads of this policy to the specified
+        // 'value', or to the number of hardware threads if 'value' is 0.  The
+        // behavior is undefined unless '0 <= value'.
+
+    // ACCESSORS
+    std::size_t minChunkSize() const;
+        // Return the minimum number of elements per chunk of this policy.
+
+    int numChunks(std::size_t numElements) const;
+        // Return the number of chunks, in the range '[1, BSLS_MAX_CHUNKS]',
+        // into which an operation on the specified 'numElements' elements is
+        // split under this policy.  A result of 1 means that the operation is
+        // done serially.  See {Parallel Policy}.
+
+    int numThreads() const;
+        // Return the maximum number of threads, in the range
+        // '[1, BSLS_MAX_THREADS]', including the calling thread, that may work
+        // on an operation under this policy.
+};
+
+                            // ===================
+                            // struct ParallelUtil
+                            // ===================
+
+struct ParallelUtil {
+    // This 'struct' provides a namespace for functions that run indexed
+    // tasks on several threads.
+
+    // TYPES
+    typedef void (*TaskFunction)(void *context, int taskIndex);
+        // 'TaskFunction' is an alias for a function that runs the task of the
+        // specified 'taskIndex' using the specified 'context'.
+
+    // CLASS METHODS
+    static std::size_t chunkBegin(std::size_t numElements,
+                                  int         numChunks,
+                                  int         chunkIndex);
+        // Return the index of the first element of the chunk having the
+        // specified 'chunkIndex' when a range of the specified 'numElements'
+        // elements is split into the specified 'numChunks' chunks whose sizes
+        // differ by at most one, or 'numElements' if
+        // 'chunkIndex == numChunks'.  The behavior is undefined unless
+        // '0 < numChunks' and '0 <= chunkIndex <= numChunks'.
+
+    static int numHardwareThreads();
+        // Return the number of threads that the hardware can run
+        // concurrently, or 1 if it cannot be determined.
+
+    static void run(TaskFunction  function,
+                    void         *context,
+                    int           numTasks,
+                    int           numThreads);
+        // Call the specified 'function' with the specified 'context' and each
+        // task index in the range '[0, numTasks)', using the calling thread
+        // and up to 'numThreads - 1' helper threads, and return when every
+        // call has returned.  The behavior is undefined unless
+        // '0 <= numTasks', '0 < numThreads', and 'function' does not throw.
+        // Note that the calls made by different threads are concurrent, and
+        // that the effects of every call happen before this function returns.
+};
+
+// ===========================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                            // --------------------
+                            // class ParallelPolicy
+                            // --------------------
+
+// CLASS METHODS
+inline
+ParallelPolicy ParallelPolicy::serial()
+{
+    return ParallelPolicy(1);
+}
+
+// CREATORS
+inline
+ParallelPolicy::ParallelPolicy(int numThreads, std::size_t minChunkSize)
+: d_numThreads(numThreads)
+, d_minChunkSize(minChunkSize)
+{
+    BSLS_ASSERT_SAFE(0 <= numThreads);
+    BSLS_ASSERT_SAFE(0 <  minChunkSize);
+}
+
+// MANIPULATORS
+inline
+void ParallelPolicy::setMinChunkSize(std::size_t value)
+{
+    BSLS_ASSERT_SAFE(0 < value);
+
+    d_minChunkSize = value;
+}
+
+inline
+void ParallelPolicy::setNumThreads(int value)
+{
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    d_numThreads = value;
+}
+
+// ACCESSORS
+inline
+std::size_t ParallelPolicy::minChunkSize() const
+{
+    return d_minChunkSize;
+}
+
+                            // -------------------
+                            // struct ParallelUtil
+                            // -------------------
+
+// CLASS METHODS
+inline
+std::size_t ParallelUtil::chunkBegin(std::size_t numElements,
+                                     int         numChunks,
+                                     int         chunkIndex)
+{
+    BSLS_ASSERT_SAFE(0 <  numChunks);
+    BSLS_ASSERT_SAFE(0 <= chunkIndex);
+    BSLS_ASSERT_SAFE(chunkIndex <= numChunks);
+
+    const std::size_t index     = static_cast<std::size_t>(chunkIndex);
+    const std::size_t size      = numElements / numChunks;
+    const std::size_t remainder = numElements % numChunks;
+
+    // The first 'remainder' chunks have one more element than the others.
+
+    return size * index + (index < remainder ? index : remainder);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
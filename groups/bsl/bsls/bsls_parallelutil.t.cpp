@@ -0,0 +1,663 @@
+// bsls_parallelutil.t.cpp                                            -*-C++-*-
+#include <bsls_parallelutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>     // for testing only
+#include <bsls_types.h>
+
+#include <stddef.h>             // size_t
+#include <stdio.h>              // printf()
+#include <stdlib.h>             // atoi()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a simply constrained attribute class,
+// 'bsls::ParallelPolicy', and a utility, 'bsls::ParallelUtil', that runs
+// indexed tasks on several threads.  The policy is tested by checking each
+// attribute after construction and after each manipulator, and the number of
+// chunks against a table.  'chunkBegin' is checked to cover every range
+// exactly once with chunks whose sizes differ by at most one.  'run' is
+// checked to run every task exactly once for various numbers of tasks and
+// threads, and to use more than one thread when asked to, which is observed
+// by tasks that wait for each other.
+//-----------------------------------------------------------------------------
+// class ParallelPolicy
+// [ 2] static ParallelPolicy serial();
+// [ 2] ParallelPolicy(int, size_t);
+// [ 2] void setMinChunkSize(size_t);
+// [ 2] void setNumThreads(int);
+// [ 2] size_t minChunkSize() const;
+// [ 3] int numChunks(size_t) const;
+// [ 2] int numThreads() const;
+//
+// struct ParallelUtil
+// [ 4] size_t chunkBegin(size_t, int, int);
+// [ 2] int numHardwareThreads();
+// [ 5] void run(TaskFunction, void *, int, int);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: THREAD START-UP
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::ParallelPolicy Obj;
+typedef bsls::ParallelUtil   Util;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+enum { k_MAX_TASKS = 1000 };
+
+struct CountContext {
+    // This 'struct' counts the number of times each task is run.
+
+    bsls::AtomicInt d_counts[k_MAX_TASKS];
+};
+
+void countTask(void *context, int taskIndex)
+    // Increment the count of the specified 'taskIndex' in the 'CountContext'
+    // at the specified 'context'.
+{
+    static_cast<CountContext *>(context)->d_counts[taskIndex].add(1);
+}
+
+struct RendezvousContext {
+    // This 'struct' lets two tasks wait for each other, to show that they are
+    // run concurrently.
+
+    bsls::AtomicInt d_numArrived;   // number of tasks that have arrived
+    bsls::AtomicInt d_numMet;       // number of tasks that saw the other
+};
+
+void rendezvousTask(void *context, int)
+    // Signal the arrival of this task in the 'RendezvousContext' at the
+    // specified 'context', and wait a bounded time for the other task.
+{
+    RendezvousContext& rendezvous = *static_cast<RendezvousContext *>(context);
+
+    rendezvous.d_numArrived.add(1);
+
+    bsls::Stopwatch timer;
+    timer.start();
+    while (rendezvous.d_numArrived.load() < 2 && timer.elapsedTime() < 10) {
+    }
+    if (2 == rendezvous.d_numArrived.load()) {
+        rendezvous.d_numMet.add(1);
+    }
+}
+
+void emptyTask(void *, int)
+    // Do nothing.
+{
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+struct SumContext {
+    const int          *d_data_p;        // array to sum
+    std::size_t         d_numElements;   // size of the array
+    int                 d_numChunks;     // number of chunks
+    bsls::Types::Int64  d_sums[bsls::ParallelPolicy::BSLS_MAX_CHUNKS];
+                                         // sum of each chunk
+};
+
+void sumChunk(void *context, int chunkIndex)
+{
+    SumContext& sum = *static_cast<SumContext *>(context);
+
+    const std::size_t begin = bsls::ParallelUtil::chunkBegin(
+                                                       sum.d_numElements,
+                                                       sum.d_numChunks,
+                                                       chunkIndex);
+    const std::size_t end   = bsls::ParallelUtil::chunkBegin(
+                                                       sum.d_numElements,
+                                                       sum.d_numChunks,
+                                                       chunkIndex + 1);
+
+    bsls::Types::Int64 total = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        total += sum.d_data_p[i];
+    }
+    sum.d_sums[chunkIndex] = total;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        enum { k_NUM_ELEMENTS = 20000 };
+
+        static int data[k_NUM_ELEMENTS];
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            data[i] = i % 10;
+        }
+
+        const bsls::ParallelPolicy policy(4, 1000);
+
+        SumContext context;
+        context.d_data_p      = data;
+        context.d_numElements = k_NUM_ELEMENTS;
+        context.d_numChunks   = policy.numChunks(k_NUM_ELEMENTS);
+
+        ASSERT(16 == context.d_numChunks);  // 4 threads, 4 chunks per thread
+
+        bsls::ParallelUtil::run(&sumChunk,
+                                &context,
+                                context.d_numChunks,
+                                policy.numThreads());
+
+        bsls::Types::Int64 total = 0;
+        for (int i = 0; i < context.d_numChunks; ++i) {
+            total += context.d_sums[i];
+        }
+        ASSERT(90000 == total);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'run'
+        //
+        // Concerns:
+        //: 1 Every task is run exactly once, whether there are fewer, as
+        //:   many, or more tasks than threads.
+        //:
+        //: 2 No task is run if there are no tasks.
+        //:
+        //: 3 With more than one thread, tasks are run concurrently.
+        //:
+        //: 4 Numbers of threads above 'BSLS_MAX_THREADS' are accepted.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each combination of numbers of tasks and threads in a table,
+        //:   run tasks counting their runs, and check every count.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Run two tasks on two threads that each wait for the other to
+        //:   start, and check that they met.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void run(TaskFunction, void *, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD 'run'"
+                            "\n==================\n");
+
+        const int TASKS[]     = { 0, 1, 2, 3, 7, 64, 255, k_MAX_TASKS };
+        const int NUM_TASKS   = static_cast<int>(sizeof TASKS / sizeof *TASKS);
+        const int THREADS[]   = { 1, 2, 3, 8, 100 };
+        const int NUM_THREADS = static_cast<int>(sizeof THREADS
+                                                 / sizeof *THREADS);
+
+        for (int ti = 0; ti < NUM_TASKS; ++ti) {
+            for (int tj = 0; tj < NUM_THREADS; ++tj) {
+                const int N = TASKS[ti];
+                const int T = THREADS[tj];
+
+                if (veryVerbose) { T_ P_(N) P(T) }
+
+                static CountContext context;
+                for (int i = 0; i < k_MAX_TASKS; ++i) {
+                    context.d_counts[i] = 0;
+                }
+
+                Util::run(&countTask, &context, N, T);
+
+                for (int i = 0; i < k_MAX_TASKS; ++i) {
+                    const int EXP = i < N ? 1 : 0;
+                    ASSERTV(N, T, i, EXP == context.d_counts[i].load());
+                }
+            }
+        }
+
+        if (verbose) printf("\tConcurrent tasks.\n");
+        {
+            RendezvousContext context;
+            Util::run(&rendezvousTask, &context, 2, 2);
+
+            ASSERTV(context.d_numMet.load(), 2 == context.d_numMet.load());
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            CountContext context;
+
+            BSLS_ASSERTTEST_ASSERT_PASS(Util::run(&countTask, &context, 0, 1));
+            BSLS_ASSERTTEST_ASSERT_FAIL(Util::run(0, &context, 0, 1));
+            BSLS_ASSERTTEST_ASSERT_FAIL(
+                                   Util::run(&countTask, &context, -1, 1));
+            BSLS_ASSERTTEST_ASSERT_FAIL(Util::run(&countTask, &context, 0, 0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'chunkBegin'
+        //
+        // Concerns:
+        //: 1 The chunks cover the range exactly, in order, without overlap.
+        //:
+        //: 2 The sizes of the chunks differ by at most one, and the larger
+        //:   chunks come first.
+        //:
+        //: 3 Ranges smaller than the number of chunks give empty chunks.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every range size up to 100 and every number of chunks up to
+        //:   20, and for a few large ranges, check the first and last chunk
+        //:   boundaries and the size of every chunk.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   size_t chunkBegin(size_t, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD 'chunkBegin'"
+                            "\n=========================\n");
+
+        const size_t SIZES[] = { 0, 1, 2, 3, 5, 17, 99, 100,
+                                 1000003, 4000000000u };
+        const int    NUM_SIZES = static_cast<int>(sizeof SIZES
+                                                  / sizeof *SIZES);
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int numChunks = 1; numChunks <= 20; ++numChunks) {
+                const size_t N = SIZES[si];
+
+                ASSERTV(N, numChunks, 0 == Util::chunkBegin(N, numChunks, 0));
+                ASSERTV(N, numChunks,
+                        N == Util::chunkBegin(N, numChunks, numChunks));
+
+                const size_t SMALL = N / numChunks;
+                for (int i = 0; i < numChunks; ++i) {
+                    const size_t BEGIN = Util::chunkBegin(N, numChunks, i);
+                    const size_t END   = Util::chunkBegin(N, numChunks, i + 1);
+                    const size_t EXP   = static_cast<size_t>(i) < N % numChunks
+                                         ? SMALL + 1
+                                         : SMALL;
+
+                    ASSERTV(N, numChunks, i, BEGIN <= END);
+                    ASSERTV(N, numChunks, i, EXP == END - BEGIN);
+                }
+            }
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(Util::chunkBegin(10, 1, 0));
+            ASSERT_SAFE_PASS(Util::chunkBegin(10, 1, 1));
+            ASSERT_SAFE_FAIL(Util::chunkBegin(10, 0, 0));
+            ASSERT_SAFE_FAIL(Util::chunkBegin(10, 1, -1));
+            ASSERT_SAFE_FAIL(Util::chunkBegin(10, 1, 2));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ACCESSOR 'numChunks'
+        //
+        // Concerns:
+        //: 1 Ranges of fewer than twice the minimum chunk size give 1 chunk.
+        //:
+        //: 2 A policy of one thread gives 1 chunk for any range.
+        //:
+        //: 3 Otherwise the number of chunks is the smaller of the number of
+        //:   whole minimum-size chunks in the range and
+        //:   'BSLS_CHUNKS_PER_THREAD' times the number of threads.
+        //:
+        //: 4 The number of chunks never exceeds 'BSLS_MAX_CHUNKS'.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, check 'numChunks' for
+        //:   policies and range sizes at and around the boundaries.
+        //:   (C-1..3)
+        //:
+        //: 2 Check that a policy with the default number of threads gives at
+        //:   most 'BSLS_MAX_CHUNKS' chunks for a very large range.  (C-4)
+        //
+        // Testing:
+        //   int numChunks(size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nACCESSOR 'numChunks'"
+                            "\n====================\n");
+
+        static const struct {
+            int    d_line;          // source line number
+            int    d_numThreads;    // policy threads
+            size_t d_minChunkSize;  // policy minimum chunk size
+            size_t d_numElements;   // range size
+            int    d_expected;      // expected number of chunks
+        } DATA[] = {
+            //LINE  THREADS  MIN   ELEMENTS    EXP
+            //----  -------  ----  ----------  ---
+            { L_,         4,  100,          0,   1 },
+            { L_,         4,  100,        199,   1 },
+            { L_,         4,  100,        200,   2 },
+            { L_,         4,  100,        299,   2 },
+            { L_,         4,  100,        300,   3 },
+            { L_,         4,  100,       1600,  16 },
+            { L_,         4,  100,    1000000,  16 },
+            { L_,         1,  100,    1000000,   1 },
+            { L_,         2,    1,          2,   2 },
+            { L_,         2,    1,        100,   8 },
+            { L_,        64,    1,    1000000, 256 },
+            { L_,       100,    1,    1000000, 256 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE    = DATA[ti].d_line;
+            const int    THREADS = DATA[ti].d_numThreads;
+            const size_t MIN     = DATA[ti].d_minChunkSize;
+            const size_t N       = DATA[ti].d_numElements;
+            const int    EXP     = DATA[ti].d_expected;
+
+            const Obj X(THREADS, MIN);
+            ASSERTV(LINE, X.numChunks(N), EXP == X.numChunks(N));
+        }
+
+        const Obj X;
+        const int NUM_CHUNKS = X.numChunks(4000000000u);
+        ASSERTV(NUM_CHUNKS, 1 <= NUM_CHUNKS);
+        ASSERTV(NUM_CHUNKS, NUM_CHUNKS <= Obj::BSLS_MAX_CHUNKS);
+        const int EXP_CHUNKS = 1 == X.numThreads()
+                             ? 1
+                             : X.numThreads() * Obj::BSLS_CHUNKS_PER_THREAD;
+        ASSERTV(NUM_CHUNKS, X.numThreads(), EXP_CHUNKS == NUM_CHUNKS);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, MANIPULATORS, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default policy uses the number of hardware threads and the
+        //:   default minimum chunk size.
+        //:
+        //: 2 The value constructor and the manipulators set the attributes.
+        //:
+        //: 3 'numThreads' maps 0 to the number of hardware threads, and caps
+        //:   the number of threads at 'BSLS_MAX_THREADS'.
+        //:
+        //: 4 'serial' returns a policy of one thread.
+        //:
+        //: 5 'numHardwareThreads' returns a positive value, the same on every
+        //:   call.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create policies with the default and value constructors and
+        //:   'serial', change them with each manipulator, and check every
+        //:   attribute after each step.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   static ParallelPolicy serial();
+        //   ParallelPolicy(int, size_t);
+        //   void setMinChunkSize(size_t);
+        //   void setNumThreads(int);
+        //   size_t minChunkSize() const;
+        //   int numThreads() const;
+        //   int numHardwareThreads();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, MANIPULATORS, AND BASIC ACCESSORS"
+                            "\n===========================================\n");
+
+        const int HW = Util::numHardwareThreads();
+        const int HW_CAPPED = HW < Obj::BSLS_MAX_THREADS
+                              ? HW
+                              : static_cast<int>(Obj::BSLS_MAX_THREADS);
+        if (verbose) P(HW);
+
+        ASSERTV(HW, 0 < HW);
+        ASSERTV(HW, HW == Util::numHardwareThreads());
+
+        Obj mX;  const Obj& X = mX;
+        ASSERTV(X.numThreads(), HW_CAPPED == X.numThreads());
+        ASSERT(Obj::BSLS_DEFAULT_MIN_CHUNK_SIZE == X.minChunkSize());
+
+        mX.setNumThreads(3);
+        ASSERT(3 == X.numThreads());
+        ASSERT(Obj::BSLS_DEFAULT_MIN_CHUNK_SIZE == X.minChunkSize());
+
+        mX.setMinChunkSize(10);
+        ASSERT(3 == X.numThreads());
+        ASSERT(10 == X.minChunkSize());
+
+        mX.setNumThreads(1000);
+        ASSERT(Obj::BSLS_MAX_THREADS == X.numThreads());
+
+        mX.setNumThreads(0);
+        ASSERTV(X.numThreads(), HW_CAPPED == X.numThreads());
+
+        const Obj Y(7, 5);
+        ASSERT(7 == Y.numThreads());
+        ASSERT(5 == Y.minChunkSize());
+
+        const Obj Z = Obj::serial();
+        ASSERT(1 == Z.numThreads());
+        ASSERT(Obj::BSLS_DEFAULT_MIN_CHUNK_SIZE == Z.minChunkSize());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(Obj(0, 1));
+            ASSERT_SAFE_FAIL(Obj(-1, 1));
+            ASSERT_SAFE_FAIL(Obj(0, 0));
+
+            ASSERT_SAFE_PASS(mX.setNumThreads(0));
+            ASSERT_SAFE_FAIL(mX.setNumThreads(-1));
+            ASSERT_SAFE_PASS(mX.setMinChunkSize(1));
+            ASSERT_SAFE_FAIL(mX.setMinChunkSize(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Split a range with a policy, and run a task per chunk.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const Obj X(2, 10);
+        const int NUM_CHUNKS = X.numChunks(100);
+        ASSERTV(NUM_CHUNKS, 8 == NUM_CHUNKS);
+
+        static CountContext context;
+        Util::run(&countTask, &context, NUM_CHUNKS, X.numThreads());
+        for (int i = 0; i < NUM_CHUNKS; ++i) {
+            ASSERTV(i, 1 == context.d_counts[i].load());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THREAD START-UP
+        //
+        // Concerns:
+        //: 1 The cost of 'run' for empty tasks, which is the cost of creating
+        //:   and joining its helper threads, is small compared to the minimum
+        //:   chunk size of the default policy.
+        //
+        // Plan:
+        //: 1 Time 'run' of empty tasks for numbers of threads from 1 to the
+        //:   number of hardware threads, and report the time per call.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THREAD START-UP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: THREAD START-UP"
+                            "\n=================================\n");
+
+        const int NUM_CALLS = 1000;
+        const int HW        = Util::numHardwareThreads();
+
+        for (int threads = 1; threads <= HW; threads *= 2) {
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                Util::run(&emptyTask, 0, threads, threads);
+            }
+            timer.stop();
+
+            printf("%3d threads: %8.2f us per call\n",
+                   threads,
+                   timer.elapsedTime() * 1e6 / NUM_CALLS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -23,12 +23,12 @@ void Stopwatch::updateTimes()
 {
     Types::Int64 systemTime;
     Types::Int64 userTime;
-    TimeUtil::OpaqueNativeTime wallTime;
-    accumulatedTimesRaw(&systemTime, &userTime, &wallTime);
+    TimeUtil::getProcessTimers(&systemTime, &userTime);
+    const Types::Int64 wallTime = elapsedWallTime();
 
     d_accumulatedSystemTime += systemTime - d_startSystemTime;
     d_accumulatedUserTime   += userTime   - d_startUserTime;
-    d_accumulatedWallTime   += elapsedWallTime(wallTime);
+    d_accumulatedWallTime   += wallTime;
 }
 
 // ACCESSORS
@@ -39,8 +39,8 @@ void Stopwatch::accumulatedTimes(double *systemTime,
     if (d_isRunning) {
         Types::Int64 rawSystemTime;
         Types::Int64 rawUserTime;
-        TimeUtil::OpaqueNativeTime rawWallTime;
-        accumulatedTimesRaw(&rawSystemTime, &rawUserTime, &rawWallTime);
+        TimeUtil::getProcessTimers(&rawSystemTime, &rawUserTime);
+        const Types::Int64 rawWallTime = elapsedWallTime();
 
         *systemTime = static_cast<double>(
                    d_accumulatedSystemTime + rawSystemTime - d_startSystemTime)
@@ -49,7 +49,7 @@ void Stopwatch::accumulatedTimes(double *systemTime,
                      d_accumulatedUserTime + rawUserTime   - d_startUserTime)
                                                       / s_nanosecondsPerSecond;
         *wallTime   = static_cast<double>(
-                     d_accumulatedWallTime + elapsedWallTime(rawWallTime))
+                     d_accumulatedWallTime + rawWallTime)
                                                       / s_nanosecondsPerSecond;
     }
     else {
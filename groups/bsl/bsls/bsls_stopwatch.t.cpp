@@ -33,6 +33,7 @@ using namespace BloombergLP;
 // behavior.
 //-----------------------------------------------------------------------------
 // [ 2] bsls::Stopwatch();
+// [ 7] explicit bsls::Stopwatch(WallClock wallClock);
 // [ 2] ~bsls::Stopwatch();
 // [ 3] void start();
 // [ 3] void stop();
@@ -46,7 +47,7 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 // [ 1] Breathing Test
 // [ 2] State Transitions
-// [ 7] USAGE Example
+// [ 8] USAGE Example
 // [ 6] Reproduce bug from test case 
 //-----------------------------------------------------------------------------
 
@@ -252,7 +253,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -297,6 +298,107 @@ int main(int argc, char *argv[])
         const double t5s = s.accumulatedSystemTime();  ASSERT(0.0 == t5s);
         const double t5u = s.accumulatedUserTime();    ASSERT(0.0 == t5u);
         const double t5w = s.accumulatedWallTime();    ASSERT(0.0 == t5w);
+
+        bsls::Stopwatch fast(bsls::Stopwatch::BSLS_CYCLE_COUNTER);
+        fast.start();
+        fast.stop();
+        const double t6w = fast.accumulatedWallTime();  ASSERT(0.0 <= t6w);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING CYCLE-COUNTER WALL CLOCK
+        //
+        // Concerns:
+        //: 1 A stopwatch constructed with either 'WallClock' value is in the
+        //:   STOPPED state with all accumulated times equal to 0.0.
+        //:
+        //: 2 A stopwatch using the cycle counter accumulates the same wall
+        //:   time as one using the system timer, in the RUNNING and STOPPED
+        //:   states, and with or without collecting CPU times.
+        //:
+        //: 3 'reset' clears the accumulated wall time.
+        //
+        // Plan:
+        //: 1 Construct stopwatches with each 'WallClock' value, and verify
+        //:   their initial state.  (C-1)
+        //:
+        //: 2 Run a cycle-counter stopwatch and a system-timer stopwatch over
+        //:   the same sequence of delays, starting the former inside the
+        //:   latter, and verify that the accumulated wall times agree to
+        //:   within 1%.  (C-2)
+        //:
+        //: 3 Reset the cycle-counter stopwatch and verify its times.  (C-3)
+        //
+        // Testing:
+        //   explicit bsls::Stopwatch(WallClock wallClock);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CYCLE-COUNTER WALL CLOCK"
+                            "\n================================\n");
+
+        if (verbose) printf("\nInitial state.\n");
+        {
+            const Obj::WallClock CLOCKS[] = { Obj::BSLS_SYSTEM_TIMER,
+                                              Obj::BSLS_CYCLE_COUNTER };
+            for (int ti = 0; ti < 2; ++ti) {
+                Obj x(CLOCKS[ti]);  const Obj& X = x;
+
+                LOOP_ASSERT(ti, false == X.isRunning());
+                LOOP_ASSERT(ti, 0.0   == X.accumulatedSystemTime());
+                LOOP_ASSERT(ti, 0.0   == X.accumulatedUserTime());
+                LOOP_ASSERT(ti, 0.0   == X.accumulatedWallTime());
+            }
+        }
+
+        if (verbose) printf("\nAgreement with the system timer.\n");
+        for (int collect = 0; collect < 2; ++collect) {
+            const double TIME_STEP = 0.05;
+            const int    NUM_STEPS = 4;
+
+            Obj mS;                        const Obj& S = mS;
+            Obj mX(Obj::BSLS_CYCLE_COUNTER);  const Obj& X = mX;
+
+            for (int i = 1; i <= NUM_STEPS; ++i) {
+                mS.start(collect);
+                mX.start(collect);
+                delayWall(TIME_STEP);
+                const double running = X.accumulatedWallTime();
+                mX.stop();
+                mS.stop();
+
+                const double cycleTime  = X.accumulatedWallTime();
+                const double systemTime = S.accumulatedWallTime();
+
+                if (veryVerbose) {
+                    T_; P_(collect); P_(i); P_(cycleTime); P(systemTime);
+                }
+
+                LOOP3_ASSERT(collect, i, running,
+                             (i - 0.01) * TIME_STEP < running);
+                LOOP3_ASSERT(collect, i, running, running <= cycleTime);
+                LOOP3_ASSERT(collect, i, cycleTime,
+                             (i - 0.01) * TIME_STEP < cycleTime);
+                LOOP4_ASSERT(collect, i, cycleTime, systemTime,
+                             cycleTime < systemTime * 1.01);
+                LOOP4_ASSERT(collect, i, cycleTime, systemTime,
+                             cycleTime > systemTime * 0.99);
+
+                if (collect) {
+                    double systemCpu, userCpu, wall;
+                    X.accumulatedTimes(&systemCpu, &userCpu, &wall);
+                    LOOP2_ASSERT(collect, i, 0.0 <= systemCpu);
+                    LOOP2_ASSERT(collect, i, 0.0 <= userCpu);
+                    LOOP2_ASSERT(collect, i, cycleTime == wall);
+                }
+                else {
+                    LOOP2_ASSERT(collect, i, 0.0 == X.accumulatedUserTime());
+                }
+            }
+
+            mX.reset();
+            LOOP_ASSERT(collect, false == X.isRunning());
+            LOOP_ASSERT(collect, 0.0   == X.accumulatedWallTime());
+        }
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -831,6 +933,27 @@ int main(int argc, char *argv[])
                                      "\t  + Net cost per loop iteration is ",
                                      " nsec\n");
         }
+        {
+            if (verbose) printf("\tProfiling use of start()/stop()/"
+                                "elapsedTime() with the cycle counter:\n");
+            bsls::Stopwatch watch;
+            watch.start();
+            bsls::Stopwatch w(bsls::Stopwatch::BSLS_CYCLE_COUNTER);
+            for (int i = 0; i < numTrials; ++i) {
+                w.reset();
+                w.start();
+                busyFunction();
+                w.stop();
+                double d = w.elapsedTime();
+                (void) d;
+            }
+            watch.stop();
+            const double testTime = watch.elapsedTime();
+            if (verbose) bsls::BslTestUtil::callDebugprint(
+                                     (testTime - baselineTime) * toNanoseconds,
+                                     "\t  + Net cost per loop iteration is ",
+                                     " nsec\n");
+        }
         {
             if (verbose) printf(
                 "\tProfiling use of start(true)/stop()/accumulatedTimes():\n");
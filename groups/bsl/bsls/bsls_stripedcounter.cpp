@@ -0,0 +1,106 @@
+// bsls_stripedcounter.cpp                                            -*-C++-*-
+#include <bsls_stripedcounter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define BSLS_STRIPEDCOUNTER_THREAD_LOCAL __declspec(thread)
+#elif defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BSLS_STRIPEDCOUNTER_THREAD_LOCAL __thread
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+#ifdef BSLS_STRIPEDCOUNTER_THREAD_LOCAL
+
+bsls::AtomicOperations::AtomicTypes::Int nextStripe;
+    // number of stripes assigned so far; zero-initialized before any dynamic
+    // initialization, so that it may be used during static initialization
+
+BSLS_STRIPEDCOUNTER_THREAD_LOCAL int threadStripePlusOne = 0;
+    // stripe assigned to the calling thread plus one, or 0 if none
+
+#endif
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                           // --------------------
+                           // class StripedCounter
+                           // --------------------
+
+// CLASS METHODS
+int StripedCounter::threadStripe()
+{
+#ifdef BSLS_STRIPEDCOUNTER_THREAD_LOCAL
+    if (0 == threadStripePlusOne) {
+        const int assigned = AtomicOperations::addIntNvRelaxed(&nextStripe,
+                                                                1);
+        threadStripePlusOne = ((assigned - 1) & (BSLS_NUM_STRIPES - 1)) + 1;
+    }
+    return threadStripePlusOne - 1;
+#else
+    // Thread stacks are at least tens of kilobytes apart, and a thread's
+    // stack depth rarely changes by more than a few kilobytes between
+    // updates, so the address of a local variable, divided by 64K, identifies
+    // the calling thread well enough.
+
+    int                  local;
+    const Types::UintPtr address = reinterpret_cast<Types::UintPtr>(&local);
+    const Types::UintPtr block   = address >> 16;
+    return static_cast<int>((block ^ (block >> 4) ^ (block >> 8))
+                                                   & (BSLS_NUM_STRIPES - 1));
+#endif
+}
+
+// MANIPULATORS
+void StripedCounter::reset(Types::Int64 value)
+{
+    d_stripes[0].d_value.storeRelaxed(value);
+    for (int i = 1; i < BSLS_NUM_STRIPES; ++i) {
+        d_stripes[i].d_value.storeRelaxed(0);
+    }
+}
+
+// ACCESSORS
+Types::Int64 StripedCounter::total() const
+{
+    Types::Int64 sum = 0;
+    for (int i = 0; i < BSLS_NUM_STRIPES; ++i) {
+        sum += d_stripes[i].d_value.loadRelaxed();
+    }
+    return sum;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
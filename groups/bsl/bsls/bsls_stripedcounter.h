@@ -0,0 +1,231 @@
+// bsls_stripedcounter.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLS_STRIPEDCOUNTER
+#define INCLUDED_BSLS_STRIPEDCOUNTER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a counter that scales under concurrent updates.
+//
+//@CLASSES:
+//  bsls::StripedCounter: 64-bit counter striped across cache lines
+//
+//@SEE_ALSO: bsls_atomic, bsls_cacheline
+//
+//@DESCRIPTION: This component provides a class, 'bsls::StripedCounter', that
+// implements a 64-bit integer counter intended for statistics that are
+// updated frequently by many threads and read rarely.  Rather than a single
+// atomic integer, the counter holds 'bsls::StripedCounter::BSLS_NUM_STRIPES'
+// atomic integers ("stripes"), each on its own cache line.  A thread always
+// updates the same stripe, and different threads are spread across the
+// stripes, so that threads updating the counter concurrently rarely write to
+// the same cache line.  Reading the counter sums the stripes.
+//
+// Updates use relaxed memory ordering: they are atomic, but do not order
+// other memory accesses.  'total' returns the sum of the stripes as loaded
+// one after another, which is exact when no updates are in progress, and
+// otherwise includes some subset of the concurrent updates.
+//
+///Stripe Selection
+///----------------
+// Each thread is assigned a stripe the first time it updates any striped
+// counter, in round-robin order, and keeps it for its lifetime; therefore up
+// to 'BSLS_NUM_STRIPES' threads are guaranteed to use distinct stripes.  This
+// relies on thread-local storage, which is used with GCC, Clang, and MSVC.
+// With other compilers, the stripe is derived from the address of the
+// calling thread's stack, which spreads threads across the stripes without
+// guaranteeing that they are distinct.
+//
+///Footprint
+///---------
+// A 'bsls::StripedCounter' occupies
+// '(BSLS_NUM_STRIPES + 1) * bsls::CacheLine::BSLS_SIZE' bytes (about 1
+// kilobyte on most platforms), so it is meant for a modest number of hot
+// counters, not for every counter in a program.  For a counter updated by a
+// single thread, or rarely, use 'bsls::AtomicInt64'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Requests Served by a Thread Pool
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that every thread of a pool increments a counter for each request
+// it serves, and that a monitoring thread periodically reports the count.
+// First, we define the counter:
+//..
+//  bsls::StripedCounter numRequests;
+//..
+// Then, each worker thread counts the requests it serves:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      // ... serve a request ...
+//
+//      numRequests.increment();
+//  }
+//..
+// Finally, the monitoring thread reads the total:
+//..
+//  assert(100 == numRequests.total());
+//..
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CACHELINE
+#include <bsls_cacheline.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // ====================
+                           // class StripedCounter
+                           // ====================
+
+class StripedCounter {
+    // This class implements a 64-bit integer counter whose value is spread
+    // over several cache lines, so that it can be updated concurrently by
+    // many threads with little contention.  All manipulators and accessors
+    // are thread-safe, except 'reset'.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        BSLS_NUM_STRIPES = 16  // number of stripes (a power of two)
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Stripe {
+        // A stripe is an atomic integer padded to the size of a cache line.
+
+        AtomicInt64 d_value;                            // stripe value
+        char        d_pad[CacheLine::BSLS_SIZE - sizeof(AtomicInt64)];
+                                                        // padding
+    };
+
+    // DATA
+    char   d_leadingPad[CacheLine::BSLS_SIZE];  // separates the stripes from
+                                                // preceding memory
+
+    Stripe d_stripes[BSLS_NUM_STRIPES];         // stripes; the padding of
+                                                // the last one separates it
+                                                // from following memory
+
+    // NOT IMPLEMENTED
+    StripedCounter(const StripedCounter&);
+    StripedCounter& operator=(const StripedCounter&);
+
+  public:
+    // CLASS METHODS
+    static int threadStripe();
+        // Return the index, in the range '[0, BSLS_NUM_STRIPES)', of the
+        // stripe updated by the calling thread.  Note that the result is the
+        // same on every call from a given thread.
+
+    // CREATORS
+    StripedCounter();
+        // Create a counter having the value 0.
+
+    explicit StripedCounter(Types::Int64 initialValue);
+        // Create a counter having the specified 'initialValue'.
+
+    // MANIPULATORS
+    void add(Types::Int64 value);
+        // Atomically add the specified 'value' to this counter, with relaxed
+        // memory ordering.
+
+    void decrement();
+        // Atomically subtract 1 from this counter, with relaxed memory
+        // ordering.
+
+    void increment();
+        // Atomically add 1 to this counter, with relaxed memory ordering.
+
+    void reset(Types::Int64 value = 0);
+        // Set the value of this counter to the optionally specified 'value'.
+        // The behavior is undefined if another thread updates this counter
+        // during this call.
+
+    // ACCESSORS
+    Types::Int64 total() const;
+        // Return the value of this counter.  If other threads update this
+        // counter during this call, the result includes the updates that
+        // preceded the call, and some subset of the concurrent ones.
+};
+
+// ===========================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                           // --------------------
+                           // class StripedCounter
+                           // --------------------
+
+// CREATORS
+inline
+StripedCounter::StripedCounter()
+{
+}
+
+inline
+StripedCounter::StripedCounter(Types::Int64 initialValue)
+{
+    d_stripes[0].d_value.storeRelaxed(initialValue);
+}
+
+// MANIPULATORS
+inline
+void StripedCounter::add(Types::Int64 value)
+{
+    d_stripes[threadStripe()].d_value.addRelaxed(value);
+}
+
+inline
+void StripedCounter::decrement()
+{
+    add(-1);
+}
+
+inline
+void StripedCounter::increment()
+{
+    add(1);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,622 @@
+// bsls_stripedcounter.t.cpp                                          -*-C++-*-
+#include <bsls_stripedcounter.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>     // for testing only
+#include <bsls_types.h>
+
+#include <stdio.h>              // printf()
+#include <stdlib.h>             // atoi()
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+#include <sched.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a counter whose value is the sum of several
+// atomic stripes.  Single-threaded tests verify that every manipulator changes
+// the total as expected, whichever stripe the calling thread uses.  A test
+// with several threads verifies that threads are assigned distinct stripes,
+// and a stress test verifies that no update is lost when many threads update
+// the same counter concurrently.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] static int threadStripe();
+//
+// CREATORS
+// [ 2] StripedCounter();
+// [ 2] StripedCounter(Types::Int64);
+//
+// MANIPULATORS
+// [ 2] void add(Types::Int64);
+// [ 2] void decrement();
+// [ 2] void increment();
+// [ 2] void reset(Types::Int64);
+//
+// ACCESSORS
+// [ 2] Types::Int64 total() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT UPDATES
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: CONTENTION
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::StripedCounter Obj;
+typedef bsls::Types::Int64   Int64;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef void *(*thread_func)(void *arg);
+
+thread_t createThread(thread_func func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+void joinThread(thread_t thr)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+void yieldThread()
+    // Yield the processor to other threads.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+                            // ===================
+                            // struct StripeParams
+                            // ===================
+
+struct StripeParams {
+    // This 'struct' holds the arguments of 'stripeThread'.
+
+    bsls::AtomicInt *d_numArrived_p;  // number of threads that have arrived
+    int              d_numThreads;    // number of threads to wait for
+    int              d_stripe;        // stripe of the thread (output)
+    bool             d_isStable;      // 'true' if the stripe did not change
+};
+
+extern "C" void *stripeThread(void *arg)
+    // Record the stripe of the calling thread in the 'StripeParams' object
+    // at the specified 'arg', then wait until 'd_numThreads' threads have
+    // done the same, so that all of them are alive at the same time.
+{
+    StripeParams *params = static_cast<StripeParams *>(arg);
+
+    params->d_stripe   = Obj::threadStripe();
+    params->d_isStable = params->d_stripe == Obj::threadStripe();
+
+    ++*params->d_numArrived_p;
+    while (*params->d_numArrived_p < params->d_numThreads) {
+        yieldThread();
+    }
+    return 0;
+}
+
+                           // ======================
+                           // struct IncrementParams
+                           // ======================
+
+struct IncrementParams {
+    // This 'struct' holds the arguments of the 'increment*Thread' functions.
+
+    bsls::AtomicInt   *d_start_p;       // non-zero once the threads may start
+    Obj               *d_striped_p;     // striped counter to update
+    bsls::AtomicInt64 *d_atomic_p;      // atomic counter to update
+    int                d_numIncrements; // number of increments to apply
+};
+
+void waitForStart(const IncrementParams& params)
+    // Wait until the start flag of the specified 'params' is set.
+{
+    while (0 == params.d_start_p->loadAcquire()) {
+        yieldThread();
+    }
+}
+
+extern "C" void *incrementStripedThread(void *arg)
+    // Increment the striped counter of the 'IncrementParams' object at the
+    // specified 'arg' the specified number of times.
+{
+    const IncrementParams& params = *static_cast<IncrementParams *>(arg);
+    waitForStart(params);
+    for (int i = 0; i < params.d_numIncrements; ++i) {
+        params.d_striped_p->increment();
+    }
+    return 0;
+}
+
+extern "C" void *incrementAtomicThread(void *arg)
+    // Increment the atomic counter of the 'IncrementParams' object at the
+    // specified 'arg' the specified number of times, with sequentially
+    // consistent ordering.
+{
+    const IncrementParams& params = *static_cast<IncrementParams *>(arg);
+    waitForStart(params);
+    for (int i = 0; i < params.d_numIncrements; ++i) {
+        params.d_atomic_p->add(1);
+    }
+    return 0;
+}
+
+extern "C" void *incrementAtomicRelaxedThread(void *arg)
+    // Increment the atomic counter of the 'IncrementParams' object at the
+    // specified 'arg' the specified number of times, with relaxed ordering.
+{
+    const IncrementParams& params = *static_cast<IncrementParams *>(arg);
+    waitForStart(params);
+    for (int i = 0; i < params.d_numIncrements; ++i) {
+        params.d_atomic_p->addRelaxed(1);
+    }
+    return 0;
+}
+
+double runIncrements(thread_func        function,
+                     Obj               *striped,
+                     bsls::AtomicInt64 *atomic,
+                     int                numThreads,
+                     int                numIncrements)
+    // Run the specified 'function' in the specified 'numThreads' threads,
+    // each applying the specified 'numIncrements' increments to the
+    // specified 'striped' or 'atomic' counter, and return the elapsed time,
+    // in seconds, from the start of the increments to the end of the last
+    // thread.  The behavior is undefined unless '0 < numThreads <= 64'.
+{
+    enum { MAX_THREADS = 64 };
+
+    bsls::AtomicInt start(0);
+    IncrementParams params = { &start, striped, atomic, numIncrements };
+    thread_t        threads[MAX_THREADS];
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads[i] = createThread(function, &params);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    start.storeRelease(1);
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(threads[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        //Example 1: Counting Requests Served by a Thread Pool
+        // - - - - - - - - - - - - - - - - - - - - - - - - - -
+        bsls::StripedCounter numRequests;
+
+        for (int i = 0; i < 100; ++i) {
+            // ... serve a request ...
+
+            numRequests.increment();
+        }
+
+        ASSERT(100 == numRequests.total());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 No update is lost when several threads update the same counter
+        //:   concurrently, whether or not they share stripes.
+        //
+        // Plan:
+        //: 1 For thread counts below, equal to, and above the number of
+        //:   stripes, have each thread increment a counter a fixed number of
+        //:   times, and verify the total.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT UPDATES"
+                            "\n==================\n");
+
+        const int THREADS[] = { 1, 2, 7, Obj::BSLS_NUM_STRIPES, 40 };
+        const int NUM_THREADS = static_cast<int>(sizeof THREADS
+                                                 / sizeof *THREADS);
+        const int NUM_INCREMENTS = 20000;
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int N = THREADS[ti];
+
+            Obj mX(-5);
+            runIncrements(&incrementStripedThread, &mX, 0, N, NUM_INCREMENTS);
+
+            const Int64 EXP = static_cast<Int64>(N) * NUM_INCREMENTS - 5;
+            ASSERTV(N, mX.total(), EXP == mX.total());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'threadStripe'
+        //
+        // Concerns:
+        //: 1 'threadStripe' returns a valid stripe index.
+        //:
+        //: 2 A given thread always gets the same stripe.
+        //:
+        //: 3 Where thread-local storage is available, up to 'BSLS_NUM_STRIPES'
+        //:   threads alive at the same time get distinct stripes.
+        //
+        // Plan:
+        //: 1 Start 'BSLS_NUM_STRIPES' threads that each record their stripe
+        //:   twice and wait for one another, then verify the stripes.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   static int threadStripe();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD 'threadStripe'"
+                            "\n===========================\n");
+
+        enum { NUM_STRIPES = Obj::BSLS_NUM_STRIPES };
+
+        bsls::AtomicInt numArrived(0);
+        StripeParams    params[NUM_STRIPES];
+        thread_t        threads[NUM_STRIPES];
+
+        for (int i = 0; i < NUM_STRIPES; ++i) {
+            params[i].d_numArrived_p = &numArrived;
+            params[i].d_numThreads   = NUM_STRIPES;
+            params[i].d_stripe       = -1;
+            params[i].d_isStable     = false;
+            threads[i] = createThread(&stripeThread, &params[i]);
+        }
+        for (int i = 0; i < NUM_STRIPES; ++i) {
+            joinThread(threads[i]);
+        }
+
+        int numUsed[NUM_STRIPES] = { 0 };
+        for (int i = 0; i < NUM_STRIPES; ++i) {
+            const int STRIPE = params[i].d_stripe;
+            if (veryVerbose) { T_ P_(i) P(STRIPE) }
+
+            ASSERTV(i, STRIPE, 0 <= STRIPE && STRIPE < NUM_STRIPES);
+            ASSERTV(i, params[i].d_isStable);
+            if (0 <= STRIPE && STRIPE < NUM_STRIPES) {
+                ++numUsed[STRIPE];
+            }
+        }
+
+#if defined(BSLS_PLATFORM_CMP_GNU)                                            \
+ || defined(BSLS_PLATFORM_CMP_CLANG)                                          \
+ || defined(BSLS_PLATFORM_CMP_MSVC)
+        for (int i = 0; i < NUM_STRIPES; ++i) {
+            ASSERTV(i, numUsed[i], 1 == numUsed[i]);
+        }
+#endif
+
+        const int STRIPE = Obj::threadStripe();
+        ASSERT(0 <= STRIPE && STRIPE < NUM_STRIPES);
+        ASSERT(STRIPE == Obj::threadStripe());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, MANIPULATORS, AND 'total'
+        //
+        // Concerns:
+        //: 1 A default-constructed counter has the value 0, and a counter
+        //:   constructed with a value has that value.
+        //:
+        //: 2 'add', 'increment', and 'decrement' change the total by the
+        //:   expected amount, including for negative and 64-bit amounts.
+        //:
+        //: 3 'reset' sets the total, by default to 0.
+        //:
+        //: 4 A counter occupies at least one cache line per stripe.
+        //
+        // Plan:
+        //: 1 Apply a table-driven sequence of operations to a counter, and
+        //:   compare its total against an 'Int64' oracle after each step.
+        //:   (C-1..3)
+        //:
+        //: 2 Check 'sizeof(Obj)'.  (C-4)
+        //
+        // Testing:
+        //   StripedCounter();
+        //   StripedCounter(Types::Int64);
+        //   void add(Types::Int64);
+        //   void decrement();
+        //   void increment();
+        //   void reset(Types::Int64);
+        //   Types::Int64 total() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, MANIPULATORS, AND 'total'"
+                            "\n===================================\n");
+
+        ASSERT(sizeof(Obj) >= Obj::BSLS_NUM_STRIPES
+                                        * bsls::CacheLine::BSLS_SIZE);
+
+        const Int64 BIG = static_cast<Int64>(1) << 40;
+
+        {
+            const Obj X;
+            ASSERT(0 == X.total());
+
+            const Obj Y(BIG);
+            ASSERT(BIG == Y.total());
+
+            const Obj Z(-7);
+            ASSERT(-7 == Z.total());
+        }
+
+        static const struct {
+            int   d_line;
+            char  d_op;      // 'a'dd, 'i'ncrement, 'd'ecrement, 'r'eset
+            Int64 d_value;   // argument of 'add' and 'reset'
+        } DATA[] = {
+            //LINE  OP  VALUE
+            //----  --  -----
+            { L_,  'i',     0 },
+            { L_,  'i',     0 },
+            { L_,  'd',     0 },
+            { L_,  'a',   100 },
+            { L_,  'a',  -250 },
+            { L_,  'd',     0 },
+            { L_,  'r',    17 },
+            { L_,  'a',     3 },
+            { L_,  'r',     0 },
+            { L_,  'd',     0 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        Obj   mX;  const Obj& X = mX;
+        Int64 oracle = 0;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const char  OP    = DATA[ti].d_op;
+            const Int64 VALUE = DATA[ti].d_value;
+
+            switch (OP) {
+              case 'a': mX.add(VALUE);   oracle += VALUE; break;
+              case 'i': mX.increment();  oracle += 1;     break;
+              case 'd': mX.decrement();  oracle -= 1;     break;
+              case 'r': mX.reset(VALUE); oracle  = VALUE; break;
+              default: ASSERTV(LINE, OP, !"Bad operation code");
+            }
+            ASSERTV(LINE, X.total(), oracle, oracle == X.total());
+        }
+
+        mX.add(BIG);
+        ASSERT(BIG - 1 == X.total());
+        mX.reset();
+        ASSERT(0 == X.total());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a counter, update it, and verify its total.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.total());
+
+        mX.increment();
+        mX.increment();
+        mX.add(10);
+        mX.decrement();
+        ASSERT(11 == X.total());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: CONTENTION
+        //
+        // Concerns:
+        //: 1 Report how the cost of an increment grows with the number of
+        //:   threads updating the same counter, for a striped counter and for
+        //:   a single atomic integer.
+        //
+        // Plan:
+        //: 1 For 1 to 64 threads, time a fixed total number of increments,
+        //:   shared evenly among the threads, of a 'bsls::StripedCounter', and
+        //:   of a 'bsls::AtomicInt64' using 'add' and 'addRelaxed', and print
+        //:   the mean time per increment.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: CONTENTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: CONTENTION"
+                            "\n============================\n");
+
+        const int TOTAL_INCREMENTS = 1 << 24;
+
+        printf("%8s %14s %14s %14s   (ns/increment)\n",
+               "threads", "AtomicInt64", "addRelaxed", "StripedCounter");
+
+        for (int n = 1; n <= 64; n *= 2) {
+            const int PER_THREAD = TOTAL_INCREMENTS / n;
+
+            bsls::AtomicInt64 atomic(0);
+            Obj               striped;
+
+            const double T1 = runIncrements(&incrementAtomicThread,
+                                            0,
+                                            &atomic,
+                                            n,
+                                            PER_THREAD);
+            const double T2 = runIncrements(&incrementAtomicRelaxedThread,
+                                            0,
+                                            &atomic,
+                                            n,
+                                            PER_THREAD);
+            const double T3 = runIncrements(&incrementStripedThread,
+                                            &striped,
+                                            0,
+                                            n,
+                                            PER_THREAD);
+
+            ASSERTV(n, 2 * TOTAL_INCREMENTS == atomic);
+            ASSERTV(n, TOTAL_INCREMENTS == striped.total());
+
+            printf("%8d %14.2f %14.2f %14.2f\n",
+                   n,
+                   T1 * 1e9 / TOTAL_INCREMENTS,
+                   T2 * 1e9 / TOTAL_INCREMENTS,
+                   T3 * 1e9 / TOTAL_INCREMENTS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -449,6 +449,98 @@ bsls::Types::Int64 WindowsTimerUtil::getTimerRaw()
 
 #endif
 
+                        // =======================
+                        // struct CycleCounterUtil
+                        // =======================
+
+struct CycleCounterUtil {
+    // Provide the calibration of the cycle counter of 'bsls::TimeUtil'.
+
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_nanosecondsPerCycle;
+        // nanoseconds per cycle-counter unit, in fixed point with 32
+        // fractional bits, or 0 if the cycle counter has not been calibrated
+
+    enum {
+        k_CALIBRATION_NANOSECONDS = 20 * 1000 * 1000,
+                                            // duration of the calibration
+
+        k_NUM_SAMPLE_TRIES        = 5       // number of clock readings per
+                                            // sample, of which the tightest is
+                                            // kept
+    };
+
+    // CLASS METHODS
+    static bool hasInvariantTsc();
+        // Return 'true' if the processor reports an invariant timestamp
+        // counter, and 'false' otherwise.
+
+    static void sample(bsls::Types::Int64 *nanoseconds,
+                       bsls::Types::Int64 *cycleCount);
+        // Load into the specified 'nanoseconds' and 'cycleCount' a reading of
+        // 'bsls::TimeUtil::getTimer' and 'bsls::TimeUtil::getCycleCounter'
+        // taken at the same instant, to within the time to read the system
+        // timer.
+};
+
+bsls::AtomicOperations::AtomicTypes::Int64
+                                       CycleCounterUtil::s_nanosecondsPerCycle;
+
+bool CycleCounterUtil::hasInvariantTsc()
+{
+#if defined(BSLS_TIMEUTIL_HAS_CYCLE_COUNTER)
+    // The invariant TSC is reported by bit 8 of EDX in the extended CPUID
+    // leaf 0x80000007, which exists if the maximum extended leaf (reported by
+    // leaf 0x80000000) is at least that.
+
+    unsigned int regs[4];  // EAX, EBX, ECX, EDX
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    __cpuid(reinterpret_cast<int *>(regs), 0x80000000);
+    if (regs[0] < 0x80000007) {
+        return false;                                                 // RETURN
+    }
+    __cpuid(reinterpret_cast<int *>(regs), 0x80000007);
+#else
+    __asm__ __volatile__ ("cpuid"
+                          : "=a" (regs[0]), "=b" (regs[1]),
+                            "=c" (regs[2]), "=d" (regs[3])
+                          : "a" (0x80000000u), "c" (0));
+    if (regs[0] < 0x80000007u) {
+        return false;                                                 // RETURN
+    }
+    __asm__ __volatile__ ("cpuid"
+                          : "=a" (regs[0]), "=b" (regs[1]),
+                            "=c" (regs[2]), "=d" (regs[3])
+                          : "a" (0x80000007u), "c" (0));
+#endif
+    return 0 != (regs[3] & (1u << 8));
+#else
+    return false;
+#endif
+}
+
+void CycleCounterUtil::sample(bsls::Types::Int64 *nanoseconds,
+                              bsls::Types::Int64 *cycleCount)
+{
+    // Bracket the cycle counter between two readings of the system timer, and
+    // keep the tightest bracket, which is least likely to include an
+    // interruption.
+
+    bsls::Types::Int64 bestWidth = -1;
+    for (int i = 0; i < k_NUM_SAMPLE_TRIES; ++i) {
+        const bsls::Types::Int64 before = bsls::TimeUtil::getTimer();
+        const bsls::Types::Int64 cycles =
+                                     bsls::TimeUtil::getCycleCounterOrdered();
+        const bsls::Types::Int64 after  = bsls::TimeUtil::getTimer();
+
+        if (bestWidth < 0 || after - before < bestWidth) {
+            bestWidth    = after - before;
+            *nanoseconds = before + bestWidth / 2;
+            *cycleCount  = cycles;
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 namespace bsls {
@@ -457,7 +549,98 @@ namespace bsls {
                             // struct TimeUtil
                             // ---------------
 
+// PRIVATE CLASS DATA
+AtomicOperations::AtomicTypes::Int TimeUtil::s_cycleCounterSource;
+
+// PRIVATE CLASS METHODS
+int TimeUtil::determineCycleCounterSource()
+{
+    const int source = CycleCounterUtil::hasInvariantTsc() ? e_TSC
+                                                           : e_SYSTEM_TIMER;
+    AtomicOperations::setIntRelaxed(&s_cycleCounterSource, source);
+    return source;
+}
+
 // CLASS METHODS
+void TimeUtil::calibrateCycleCounter()
+{
+    const Types::Int64 k_ONE = static_cast<Types::Int64>(1) << 32;
+
+    if (!isCycleCounterInvariant()) {
+        // The cycle counter counts nanoseconds.
+
+        AtomicOperations::setInt64(&CycleCounterUtil::s_nanosecondsPerCycle,
+                                   k_ONE);
+        return;                                                       // RETURN
+    }
+
+    Types::Int64 startNanoseconds;
+    Types::Int64 startCycles;
+    CycleCounterUtil::sample(&startNanoseconds, &startCycles);
+
+    while (getTimer() - startNanoseconds <
+                                 CycleCounterUtil::k_CALIBRATION_NANOSECONDS) {
+    }
+
+    Types::Int64 endNanoseconds;
+    Types::Int64 endCycles;
+    CycleCounterUtil::sample(&endNanoseconds, &endCycles);
+
+    Types::Int64 scale = k_ONE;
+    if (endCycles > startCycles) {
+        scale = ((endNanoseconds - startNanoseconds) << 32)
+                                                   / (endCycles - startCycles);
+    }
+
+    // Concurrent calibrations each store a valid result.
+
+    AtomicOperations::setInt64(&CycleCounterUtil::s_nanosecondsPerCycle,
+                               scale > 0 ? scale : 1);
+}
+
+Types::Int64 TimeUtil::convertCycleCount(Types::Int64 cycleCount)
+{
+    Types::Int64 scale = AtomicOperations::getInt64Acquire(
+                                     &CycleCounterUtil::s_nanosecondsPerCycle);
+    if (0 == scale) {
+        calibrateCycleCounter();
+        scale = AtomicOperations::getInt64Acquire(
+                                     &CycleCounterUtil::s_nanosecondsPerCycle);
+    }
+
+    // Multiply the 64-bit count by the 32.32 fixed-point scale in 32-bit
+    // halves, so that the product does not overflow for any count that
+    // converts to a representable number of nanoseconds.
+
+    const bool          negative  = cycleCount < 0;
+    const Types::Uint64 count     = negative
+                                  ? 0 - static_cast<Types::Uint64>(cycleCount)
+                                  : static_cast<Types::Uint64>(cycleCount);
+    const Types::Uint64 mask      = 0xffffffffu;
+    const Types::Uint64 countHigh = count >> 32;
+    const Types::Uint64 countLow  = count & mask;
+    const Types::Uint64 scaleHigh = static_cast<Types::Uint64>(scale) >> 32;
+    const Types::Uint64 scaleLow  = static_cast<Types::Uint64>(scale) & mask;
+
+    const Types::Uint64 result = countHigh * static_cast<Types::Uint64>(scale)
+                               + countLow * scaleHigh
+                               + ((countLow * scaleLow) >> 32);
+
+    return negative ? -static_cast<Types::Int64>(result)
+                    : static_cast<Types::Int64>(result);
+}
+
+double TimeUtil::getCycleCounterFrequency()
+{
+    const Types::Int64 k_ONE = static_cast<Types::Int64>(1) << 32;
+
+    convertCycleCount(0);  // calibrate if needed
+
+    const Types::Int64 scale = AtomicOperations::getInt64Acquire(
+                                     &CycleCounterUtil::s_nanosecondsPerCycle);
+    return 1.0e9 * static_cast<double>(k_ONE) / static_cast<double>(scale);
+}
+
 void TimeUtil::initialize()
 {
 #if defined BSLS_PLATFORM_OS_UNIX
@@ -90,6 +90,34 @@ BSLS_IDENT("$Id: $")
 // expressed by the 'QueryPerformanceCounter' interface.  Note that the times
 // will still be monotonically non-decreasing. 
 //
+///Cycle Counter
+///-------------
+// Reading the system clock costs tens of nanoseconds even when the operating
+// system serves it without a system call, which is too much to timestamp
+// every message of a high-rate stream.  'bsls::TimeUtil::getCycleCounter'
+// instead reads a free-running hardware counter, the timestamp counter (TSC)
+// of x86-64 processors, with a single instruction ('rdtsc'), and
+// 'getCycleCounterOrdered' reads it only after all preceding instructions
+// have completed ('lfence; rdtsc'), which is appropriate for the end of a
+// measured interval.  The counter values are in unspecified units ("cycles");
+// 'convertCycleCount' converts them, or their differences, to nanoseconds.
+//
+// The rate of the counter is measured by 'calibrateCycleCounter', which
+// compares the counter against the monotonic clock used by 'getTimer' over
+// about 20 milliseconds.  The first conversion calibrates the counter if it
+// has not been calibrated yet; to keep this delay out of a latency-sensitive
+// path, call 'calibrateCycleCounter' at startup.
+//
+// The counter is usable for measuring time only if it runs at a constant rate
+// regardless of processor frequency and sleep states, and is synchronized
+// across processors, which the processor reports as an "invariant TSC";
+// 'isCycleCounterInvariant' returns whether it does.  Without an invariant
+// TSC, or on other platforms, the cycle-counter functions use 'getTimer' and
+// count nanoseconds, so that they remain correct, but not faster.  Note that
+// a virtual machine may report an invariant TSC whose rate or offset changes
+// when the machine migrates, and that the calibrated rate is accurate to
+// about one part in 10^5.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use 'bsls::TimeUtil'
@@ -188,6 +216,10 @@ BSLS_IDENT("$Id: $")
 //  }
 //..
 
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
 #ifndef INCLUDED_BSLS_PLATFORM
 #include <bsls_platform.h>
 #endif
@@ -203,6 +235,20 @@ BSLS_IDENT("$Id: $")
     #endif
 #endif
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) && (defined(BSLS_PLATFORM_CMP_GNU)     \
+                                      || defined(BSLS_PLATFORM_CMP_CLANG)   \
+                                      || defined(BSLS_PLATFORM_CMP_MSVC))
+    #define BSLS_TIMEUTIL_HAS_CYCLE_COUNTER 1
+        // The timestamp counter of the processor can be read inline.
+
+    #if defined(BSLS_PLATFORM_CMP_MSVC)
+        #ifndef INCLUDED_INTRIN
+        #include <intrin.h>
+        #define INCLUDED_INTRIN
+        #endif
+    #endif
+#endif
+
 #if defined(BSLS_PLATFORM_OS_AIX) || defined(BSLS_PLATFORM_OS_FREEBSD) || defined(BSLS_PLATFORM_OS_DARWIN)
     #ifndef INCLUDED_SYS_TIME
     #include <sys/time.h>
@@ -247,6 +293,20 @@ struct TimeUtil {
 #endif
 
     // CLASS METHODS
+    static void calibrateCycleCounter();
+        // Measure the rate of the cycle counter against the monotonic clock
+        // used by 'getTimer', for use by 'convertCycleCount'.  This method
+        // takes about 20 milliseconds if the cycle counter is invariant, and
+        // returns immediately otherwise.  Calling it again measures the rate
+        // anew.  This method is thread-safe.
+
+    static Types::Int64 convertCycleCount(Types::Int64 cycleCount);
+        // Convert the specified 'cycleCount', a value returned by
+        // 'getCycleCounter' or 'getCycleCounterOrdered', or a difference
+        // between such values, to nanoseconds, and return the result.
+        // Calibrate the cycle counter first if it has not been calibrated
+        // yet (see 'calibrateCycleCounter').  This method is thread-safe.
+
     static Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
         // Convert the specified 'rawTime' to a value in nanoseconds,
         // referenced to an arbitrary but fixed origin, and return the result
@@ -273,6 +333,26 @@ struct TimeUtil {
         // an arbitrary but fixed origin.  Note that this method is thread-safe
         // only if 'initialize' has been called before.
 
+    static Types::Int64 getCycleCounter();
+        // Return the current value of the cycle counter, in unspecified units
+        // that 'convertCycleCount' converts to nanoseconds.  Note that this
+        // read may be reordered with the surrounding instructions by the
+        // processor; see 'getCycleCounterOrdered'.  Also note that, if the
+        // processor does not provide an invariant timestamp counter, this
+        // method returns 'getTimer()'.  This method is thread-safe.
+
+    static Types::Int64 getCycleCounterOrdered();
+        // Return the current value of the cycle counter, read after all
+        // preceding instructions have completed, in unspecified units that
+        // 'convertCycleCount' converts to nanoseconds.  Note that, if the
+        // processor does not provide an invariant timestamp counter, this
+        // method returns 'getTimer()'.  This method is thread-safe.
+
+    static double getCycleCounterFrequency();
+        // Return the number of cycle-counter units per second, calibrating
+        // the cycle counter first if it has not been calibrated yet (see
+        // 'calibrateCycleCounter').  This method is thread-safe.
+
     static Types::Int64 getTimer();
         // Return the instantaneous value of a platform-dependent system timer
         // in absolute nanoseconds referenced to an arbitrary but fixed origin.
@@ -292,8 +372,107 @@ struct TimeUtil {
         // Do a platform-dependent initialization for the utilities.  Note that
         // only after a call to this method all the following methods are
         // guaranteed to be thread-safe.
+
+    static bool isCycleCounterInvariant();
+        // Return 'true' if the cycle counter is the timestamp counter of the
+        // processor, and the processor reports that it runs at a constant
+        // rate in all power states (an "invariant TSC"), and 'false' if the
+        // cycle-counter functions fall back to 'getTimer'.  This method is
+        // thread-safe.
+
+  private:
+    // PRIVATE TYPES
+    enum CycleCounterSource {
+        // Enumerates the values of 's_cycleCounterSource'.
+
+        e_UNKNOWN       = 0,  // not determined yet
+        e_TSC           = 1,  // timestamp counter of the processor
+        e_SYSTEM_TIMER  = 2   // 'getTimer'
+    };
+
+    // PRIVATE CLASS DATA
+    static AtomicOperations::AtomicTypes::Int s_cycleCounterSource;
+        // source of the cycle counter, a 'CycleCounterSource' value;
+        // zero-initialized, so that the cycle counter may be used during
+        // static initialization
+
+    // PRIVATE CLASS METHODS
+    static int cycleCounterSource();
+        // Return the source of the cycle counter, as a 'CycleCounterSource'
+        // value other than 'e_UNKNOWN', determining it first if needed.
+
+    static int determineCycleCounterSource();
+        // Query the processor for an invariant timestamp counter, record the
+        // corresponding source of the cycle counter, and return it.
 };
 
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ---------------
+                            // struct TimeUtil
+                            // ---------------
+
+// CLASS METHODS
+inline
+Types::Int64 TimeUtil::getCycleCounter()
+{
+#if defined(BSLS_TIMEUTIL_HAS_CYCLE_COUNTER)
+    if (e_TSC == cycleCounterSource()) {
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+        return static_cast<Types::Int64>(__rdtsc());                  // RETURN
+#else
+        unsigned int low;
+        unsigned int high;
+        __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+        return static_cast<Types::Int64>(
+                         (static_cast<Types::Uint64>(high) << 32) | low);
+                                                                      // RETURN
+#endif
+    }
+#endif
+    return getTimer();
+}
+
+inline
+Types::Int64 TimeUtil::getCycleCounterOrdered()
+{
+#if defined(BSLS_TIMEUTIL_HAS_CYCLE_COUNTER)
+    if (e_TSC == cycleCounterSource()) {
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+        _mm_lfence();
+        return static_cast<Types::Int64>(__rdtsc());                  // RETURN
+#else
+        unsigned int low;
+        unsigned int high;
+        __asm__ __volatile__ ("lfence\n\trdtsc"
+                              : "=a" (low), "=d" (high)
+                              :
+                              : "memory");
+        return static_cast<Types::Int64>(
+                         (static_cast<Types::Uint64>(high) << 32) | low);
+                                                                      // RETURN
+#endif
+    }
+#endif
+    return getTimer();
+}
+
+inline
+bool TimeUtil::isCycleCounterInvariant()
+{
+    return e_TSC == cycleCounterSource();
+}
+
+// PRIVATE CLASS METHODS
+inline
+int TimeUtil::cycleCounterSource()
+{
+    const int source = AtomicOperations::getIntRelaxed(&s_cycleCounterSource);
+    return e_UNKNOWN != source ? source : determineCycleCounterSource();
+}
+
 }  // close package namespace
 
 
@@ -46,12 +46,18 @@ using namespace BloombergLP;
 // address basic concerns to probe both our own code for consistent behavior
 // and the system results for plausible correct behavior.
 //-----------------------------------------------------------------------------
+// [12] void calibrateCycleCounter();
+// [12] bsls::Types::Int64 convertCycleCount(bsls::Types::Int64 cycleCount);
 // [11] bsls::Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
+// [12] bsls::Types::Int64 getCycleCounter();
+// [12] bsls::Types::Int64 getCycleCounterOrdered();
+// [12] double getCycleCounterFrequency();
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
 // [ 1] void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64);
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getTimer();
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
 // [11] OpaqueNativeTime getTimerRaw();
+// [12] bool isCycleCounterInvariant();
 //-----------------------------------------------------------------------------
 // [XX] Breathing Test -- NOT IMPLEMENTED
 // [ 2] USAGE
@@ -63,6 +69,8 @@ using namespace BloombergLP;
 // [ 8] Initialization test: getProcessUserTimer (UNIX only)
 // [ 9] Initialization test: getProcessTimers (UNIX only)
 // [10] Initialization test: getTimer (Windows only)
+// [13] USAGE
+// [-1] Performance Test: cost of one timer call
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -122,6 +130,25 @@ static Int64 callGetProcessTimersRetUser() {
     return uTimer;
 }
 
+static void sampleClocks(Int64 *nanoseconds, Int64 *cycleCount)
+    // Load into the specified 'nanoseconds' and 'cycleCount' a reading of
+    // 'getTimer' and 'getCycleCounterOrdered' taken at the same instant, to
+    // within the time to read the system timer, by keeping the tightest of
+    // several brackets of the cycle counter between two timer readings.
+{
+    Int64 bestWidth = -1;
+    for (int i = 0; i < 10; ++i) {
+        const Int64 before = TU::getTimer();
+        const Int64 cycles = TU::getCycleCounterOrdered();
+        const Int64 after  = TU::getTimer();
+        if (bestWidth < 0 || after - before < bestWidth) {
+            bestWidth    = after - before;
+            *nanoseconds = before + bestWidth / 2;
+            *cycleCount  = cycles;
+        }
+    }
+}
+
 static void osSleep(unsigned seconds) {
 #if defined(BSLS_PLATFORM_OS_UNIX)
     for(;;) {
@@ -497,7 +524,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header must build and
@@ -538,6 +565,153 @@ int main(int argc, char *argv[])
                        dTw, dTu, dTs);
         }
 
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING CYCLE COUNTER
+        //
+        // Concerns:
+        //: 1 'isCycleCounterInvariant' returns the same value on every call,
+        //:   and 'true' on an x86-64 processor reporting an invariant TSC.
+        //:
+        //: 2 Successive values of the cycle counter, ordered or not, never
+        //:   decrease.
+        //:
+        //: 3 The calibrated frequency is that of a processor clock, or exactly
+        //:   one per nanosecond if the cycle counter falls back to 'getTimer'.
+        //:
+        //: 4 'convertCycleCount' maps 0 to 0, is odd and non-decreasing, and
+        //:   does not overflow for counts of hours.
+        //:
+        //: 5 Converted cycle-counter intervals agree with 'getTimer' to
+        //:   within one part in 1000 over half a second (no drift).
+        //
+        // Plan:
+        //: 1 Call 'isCycleCounterInvariant' repeatedly.  (C-1)
+        //:
+        //: 2 Read the cycle counter many times, alternating the two read
+        //:   methods, and verify that no value is less than the previous one.
+        //:   (C-2)
+        //:
+        //: 3 Calibrate, and verify that the frequency is between 100 MHz and
+        //:   100 GHz, or is 1 GHz if the counter is not invariant.  (C-3)
+        //:
+        //: 4 Convert a table of counts and their negations, and the number of
+        //:   cycles in 10 hours.  (C-4)
+        //:
+        //: 5 Take simultaneous readings of 'getTimer' and the cycle counter,
+        //:   spin for half a second, take them again, and compare the
+        //:   intervals.  (C-5)
+        //
+        // Testing:
+        //   void calibrateCycleCounter();
+        //   bsls::Types::Int64 convertCycleCount(bsls::Types::Int64);
+        //   bsls::Types::Int64 getCycleCounter();
+        //   bsls::Types::Int64 getCycleCounterOrdered();
+        //   double getCycleCounterFrequency();
+        //   bool isCycleCounterInvariant();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CYCLE COUNTER"
+                            "\n=====================\n");
+
+        const bool INVARIANT = TU::isCycleCounterInvariant();
+        if (verbose) { P(INVARIANT); }
+
+        if (verbose) printf("\nInvariance is stable.\n");
+        {
+            for (int i = 0; i < 100; ++i) {
+                LOOP_ASSERT(i, INVARIANT == TU::isCycleCounterInvariant());
+            }
+#if defined(BSLS_TIMEUTIL_HAS_CYCLE_COUNTER)
+            if (veryVerbose) printf("	Timestamp counter available.\n");
+#else
+            ASSERT(!INVARIANT);
+#endif
+        }
+
+        if (verbose) printf("\nValues never decrease.\n");
+        {
+            Int64 previous = TU::getCycleCounter();
+            for (int i = 0; i < 100000; ++i) {
+                const Int64 current = i % 2 ? TU::getCycleCounter()
+                                            : TU::getCycleCounterOrdered();
+                LOOP3_ASSERT(i, previous, current, previous <= current);
+                previous = current;
+            }
+        }
+
+        if (verbose) printf("\nCalibrated frequency is plausible.\n");
+        {
+            TU::calibrateCycleCounter();
+            const double FREQUENCY = TU::getCycleCounterFrequency();
+            if (verbose) { P(FREQUENCY); }
+
+            if (INVARIANT) {
+                LOOP_ASSERT(FREQUENCY, 1.0e8 < FREQUENCY);
+                LOOP_ASSERT(FREQUENCY, 1.0e11 > FREQUENCY);
+            }
+            else {
+                LOOP_ASSERT(FREQUENCY, 1.0e9 == FREQUENCY);
+            }
+        }
+
+        if (verbose) printf("\nConversion is odd and non-decreasing.\n");
+        {
+            static const Int64 DATA[] = {
+                0, 1, 2, 3, 1000, 4095, 4096, 1000000,
+                0xffffffffLL, 0x100000000LL, 0x100000001LL,
+                1000000000000LL, 0x7fffffffffffLL
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            ASSERT(0 == TU::convertCycleCount(0));
+
+            Int64 previous = 0;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const Int64 COUNT = DATA[ti];
+                const Int64 NS    = TU::convertCycleCount(COUNT);
+
+                if (veryVerbose) { T_; P_(COUNT); P(NS); }
+
+                LOOP3_ASSERT(ti, previous, NS, previous <= NS);
+                LOOP_ASSERT(ti, -NS == TU::convertCycleCount(-COUNT));
+                previous = NS;
+            }
+
+            const double FREQUENCY = TU::getCycleCounterFrequency();
+            const double TEN_HOURS = 10.0 * 3600.0;
+            const Int64  CYCLES    = static_cast<Int64>(FREQUENCY * TEN_HOURS);
+            const Int64  NS        = TU::convertCycleCount(CYCLES);
+            const double ERROR     = static_cast<double>(NS) / 1.0e9
+                                   - TEN_HOURS;
+            LOOP_ASSERT(NS, -1.0 < ERROR && ERROR < 1.0);
+        }
+
+        if (verbose) printf("\nNo drift against 'getTimer'.\n");
+        {
+            Int64 startNs, startCycles;
+            sampleClocks(&startNs, &startCycles);
+
+            while (TU::getTimer() - startNs < 500 * 1000 * 1000) {
+            }
+
+            Int64 endNs, endCycles;
+            sampleClocks(&endNs, &endCycles);
+
+            const Int64  TIMER_NS   = endNs - startNs;
+            const Int64  COUNTER_NS = TU::convertCycleCount(endCycles
+                                                           - startCycles);
+            const double DRIFT      =
+                                   static_cast<double>(COUNTER_NS - TIMER_NS)
+                                 / static_cast<double>(TIMER_NS);
+
+            if (verbose) { P_(TIMER_NS); P_(COUNTER_NS); P(DRIFT); }
+
+            LOOP2_ASSERT(TIMER_NS, COUNTER_NS, -1.0e-3 < DRIFT);
+            LOOP2_ASSERT(TIMER_NS, COUNTER_NS,  1.0e-3 > DRIFT);
+        }
+
       } break;
       case 11: {
         // --------------------------------------------------------------------
@@ -1816,6 +1990,87 @@ int main(int argc, char *argv[])
             }
         }
 
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COST OF ONE TIMER CALL
+        //
+        // Concerns:
+        //: 1 The cycle counter is much cheaper to read than the system timer.
+        //
+        // Plan:
+        //: 1 For each of 'getTimer', 'getTimerRaw', 'getCycleCounter', and
+        //:   'getCycleCounterOrdered', time a loop of calls with 'getTimer'
+        //:   and report the cost per call.  (C-1)
+        //
+        // Testing:
+        //   Performance Test: cost of one timer call
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: COST OF ONE TIMER CALL"
+                            "\n========================================\n");
+
+        const int NUM_CALLS = 1000000;
+
+        TU::initialize();
+        TU::calibrateCycleCounter();
+
+        printf("invariant cycle counter: %s, frequency: %.0f Hz\n",
+               TU::isCycleCounterInvariant() ? "yes" : "no",
+               TU::getCycleCounterFrequency());
+
+        Int64 sink = 0;  // consumes results so the calls are not elided
+
+        {
+            const Int64 start = TU::getTimer();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                sink += TU::getTimer();
+            }
+            const Int64 elapsed = TU::getTimer() - start;
+            printf("getTimer:               %6.2f ns/call\n",
+                   static_cast<double>(elapsed) / NUM_CALLS);
+        }
+        {
+            const Int64 start = TU::getTimer();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                TU::OpaqueNativeTime raw;
+                TU::getTimerRaw(&raw);
+                sink += *reinterpret_cast<const char *>(&raw);
+            }
+            const Int64 elapsed = TU::getTimer() - start;
+            printf("getTimerRaw:            %6.2f ns/call\n",
+                   static_cast<double>(elapsed) / NUM_CALLS);
+        }
+        {
+            const Int64 start = TU::getTimer();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                sink += TU::getCycleCounter();
+            }
+            const Int64 elapsed = TU::getTimer() - start;
+            printf("getCycleCounter:        %6.2f ns/call\n",
+                   static_cast<double>(elapsed) / NUM_CALLS);
+        }
+        {
+            const Int64 start = TU::getTimer();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                sink += TU::getCycleCounterOrdered();
+            }
+            const Int64 elapsed = TU::getTimer() - start;
+            printf("getCycleCounterOrdered: %6.2f ns/call\n",
+                   static_cast<double>(elapsed) / NUM_CALLS);
+        }
+        {
+            const Int64 start = TU::getTimer();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                sink += TU::convertCycleCount(i);
+            }
+            const Int64 elapsed = TU::getTimer() - start;
+            printf("convertCycleCount:      %6.2f ns/call\n",
+                   static_cast<double>(elapsed) / NUM_CALLS);
+        }
+
+        if (veryVerbose) { P(sink); }
+
       } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
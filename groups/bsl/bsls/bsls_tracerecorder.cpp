@@ -0,0 +1,347 @@
+// bsls_tracerecorder.cpp                                             -*-C++-*-
+#include <bsls_tracerecorder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#include <stdlib.h>  // 'malloc'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define BSLS_TRACERECORDER_THREAD_LOCAL __declspec(thread)
+#elif defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BSLS_TRACERECORDER_THREAD_LOCAL __thread
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+                            // ================
+                            // struct TraceEvent
+                            // ================
+
+struct TraceEvent {
+    // This 'struct' holds one recorded event.
+
+    const char         *d_category_p;      // category
+    const char         *d_name_p;          // name
+    bsls::Types::Int64  d_startCycleCount; // cycle counter at start
+    bsls::Types::Int64  d_endCycleCount;   // cycle counter at end, or -1 for
+                                           // an instantaneous event
+};
+
+                           // ==================
+                           // struct ThreadBuffer
+                           // ==================
+
+struct ThreadBuffer {
+    // This 'struct' holds the ring buffer of events of one thread.  Only the
+    // owning thread writes events; 'd_numRecorded' is stored with release
+    // semantics after each event is written.
+
+    ThreadBuffer                               *d_next_p;
+                                                 // next buffer in the list of
+                                                 // all buffers
+
+    int                                         d_threadId;
+                                                 // 1-based thread number
+
+    int                                         d_capacity;
+                                                 // number of events held (a
+                                                 // power of two)
+
+    bsls::AtomicOperations::AtomicTypes::Int64  d_numRecorded;
+                                                 // number of events recorded
+                                                 // since the last 'clear'
+
+    TraceEvent                                 *d_events_p;
+                                                 // ring of 'd_capacity'
+                                                 // events
+};
+
+bsls::AtomicOperations::AtomicTypes::Pointer s_buffers;
+    // head of the list of all thread buffers; zero-initialized
+
+bsls::AtomicOperations::AtomicTypes::Int     s_capacity;
+    // capacity of buffers created from now on
+
+bsls::AtomicOperations::AtomicTypes::Int     s_numThreads;
+    // number of thread buffers created
+
+#ifdef BSLS_TRACERECORDER_THREAD_LOCAL
+BSLS_TRACERECORDER_THREAD_LOCAL ThreadBuffer *t_buffer = 0;
+    // buffer of the calling thread, or 0 if none
+#endif
+
+ThreadBuffer *firstBuffer()
+    // Return the head of the list of all thread buffers.
+{
+    return static_cast<ThreadBuffer *>(
+                        bsls::AtomicOperations::getPtrAcquire(&s_buffers));
+}
+
+ThreadBuffer *createBuffer()
+    // Allocate a buffer for the calling thread, having the current capacity,
+    // add it to the list of all buffers, and return it, or return 0 if
+    // memory is exhausted.
+{
+    int capacity = bsls::AtomicOperations::getIntRelaxed(&s_capacity);
+    if (capacity <= 0) {
+        capacity = bsls::TraceRecorder::BSLS_DEFAULT_EVENTS_PER_THREAD;
+    }
+
+    ThreadBuffer *buffer = static_cast<ThreadBuffer *>(
+                      malloc(sizeof(ThreadBuffer)
+                                        + capacity * sizeof(TraceEvent)));
+    if (!buffer) {
+        return 0;                                                     // RETURN
+    }
+
+    buffer->d_threadId = bsls::AtomicOperations::addIntNvRelaxed(
+                                                             &s_numThreads, 1);
+    buffer->d_capacity = capacity;
+    buffer->d_events_p = reinterpret_cast<TraceEvent *>(buffer + 1);
+    bsls::AtomicOperations::initInt64(&buffer->d_numRecorded, 0);
+
+    void *head = bsls::AtomicOperations::getPtrRelaxed(&s_buffers);
+    for (;;) {
+        buffer->d_next_p = static_cast<ThreadBuffer *>(head);
+        void *previous = bsls::AtomicOperations::testAndSwapPtrAcqRel(
+                                                                  &s_buffers,
+                                                                  head,
+                                                                  buffer);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    }
+    return buffer;
+}
+
+void record(const char         *category,
+            const char         *name,
+            bsls::Types::Int64  startCycleCount,
+            bsls::Types::Int64  endCycleCount)
+    // Record an event having the specified 'category', 'name',
+    // 'startCycleCount', and 'endCycleCount' in the buffer of the calling
+    // thread, creating the buffer if needed.
+{
+#ifdef BSLS_TRACERECORDER_THREAD_LOCAL
+    ThreadBuffer *buffer = t_buffer;
+    if (!buffer) {
+        buffer = t_buffer = createBuffer();
+        if (!buffer) {
+            return;                                                   // RETURN
+        }
+    }
+
+    const bsls::Types::Int64 n = bsls::AtomicOperations::getInt64Relaxed(
+                                                     &buffer->d_numRecorded);
+    TraceEvent& event = buffer->d_events_p[n & (buffer->d_capacity - 1)];
+    event.d_category_p      = category;
+    event.d_name_p          = name;
+    event.d_startCycleCount = startCycleCount;
+    event.d_endCycleCount   = endCycleCount;
+    bsls::AtomicOperations::setInt64Release(&buffer->d_numRecorded, n + 1);
+#else
+    (void) category;
+    (void) name;
+    (void) startCycleCount;
+    (void) endCycleCount;
+#endif
+}
+
+bsls::Types::Int64 numHeld(const ThreadBuffer& buffer)
+    // Return the number of events held in the specified 'buffer'.
+{
+    const bsls::Types::Int64 n = bsls::AtomicOperations::getInt64Acquire(
+                                                       &buffer.d_numRecorded);
+    return n < buffer.d_capacity ? n : buffer.d_capacity;
+}
+
+void writeJsonString(FILE *stream, const char *string)
+    // Write the specified 'string' to the specified 'stream' as a JSON string
+    // literal.
+{
+    putc('"', stream);
+    for (const char *p = string; *p; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if ('"' == c || '\\' == c) {
+            putc('\\', stream);
+            putc(c, stream);
+        }
+        else if (c < 0x20) {
+            fprintf(stream, "\\u%04x", c);
+        }
+        else {
+            putc(c, stream);
+        }
+    }
+    putc('"', stream);
+}
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                            // -------------------
+                            // struct TraceRecorder
+                            // -------------------
+
+// PRIVATE CLASS DATA
+AtomicOperations::AtomicTypes::Int TraceRecorder::s_enabled;
+
+// CLASS METHODS
+void TraceRecorder::clear()
+{
+    for (ThreadBuffer *buffer = firstBuffer(); buffer;
+                                                 buffer = buffer->d_next_p) {
+        AtomicOperations::setInt64Release(&buffer->d_numRecorded, 0);
+    }
+}
+
+void TraceRecorder::disable()
+{
+    AtomicOperations::setIntRelaxed(&s_enabled, 0);
+}
+
+void TraceRecorder::enable(int eventsPerThread)
+{
+#ifdef BSLS_TRACERECORDER_THREAD_LOCAL
+    int capacity = 1;
+    while (capacity < eventsPerThread) {
+        capacity <<= 1;
+    }
+    AtomicOperations::setIntRelaxed(&s_capacity, capacity);
+
+    // Make sure that converting cycle counts does not calibrate the cycle
+    // counter in the middle of a dump.
+
+    TimeUtil::calibrateCycleCounter();
+
+    AtomicOperations::setIntRelaxed(&s_enabled, 1);
+#else
+    (void) eventsPerThread;
+#endif
+}
+
+Types::Int64 TraceRecorder::numEvents()
+{
+    Types::Int64 total = 0;
+    for (ThreadBuffer *buffer = firstBuffer(); buffer;
+                                                 buffer = buffer->d_next_p) {
+        total += numHeld(*buffer);
+    }
+    return total;
+}
+
+void TraceRecorder::recordComplete(const char   *category,
+                                   const char   *name,
+                                   Types::Int64  startCycleCount,
+                                   Types::Int64  endCycleCount)
+{
+    record(category, name, startCycleCount, endCycleCount);
+}
+
+void TraceRecorder::recordInstant(const char *category, const char *name)
+{
+    if (isEnabled()) {
+        record(category, name, TimeUtil::getCycleCounter(), -1);
+    }
+}
+
+int TraceRecorder::writeChromeTrace(FILE *stream)
+{
+    // Find the earliest event, so that times are written relative to it.
+
+    bool         found = false;
+    Types::Int64 base  = 0;
+    for (ThreadBuffer *buffer = firstBuffer(); buffer;
+                                                 buffer = buffer->d_next_p) {
+        const Types::Int64 n    = AtomicOperations::getInt64Acquire(
+                                                      &buffer->d_numRecorded);
+        const Types::Int64 held = numHeld(*buffer);
+        for (Types::Int64 i = n - held; i < n; ++i) {
+            const TraceEvent& event =
+                          buffer->d_events_p[i & (buffer->d_capacity - 1)];
+            if (!found || event.d_startCycleCount < base) {
+                base  = event.d_startCycleCount;
+                found = true;
+            }
+        }
+    }
+
+    fputs("{\"traceEvents\":[", stream);
+
+    const char *separator = "\n";
+    for (ThreadBuffer *buffer = firstBuffer(); buffer;
+                                                 buffer = buffer->d_next_p) {
+        const Types::Int64 n    = AtomicOperations::getInt64Acquire(
+                                                      &buffer->d_numRecorded);
+        const Types::Int64 held = numHeld(*buffer);
+        for (Types::Int64 i = n - held; i < n; ++i) {
+            const TraceEvent& event =
+                          buffer->d_events_p[i & (buffer->d_capacity - 1)];
+            const double start = static_cast<double>(
+                TimeUtil::convertCycleCount(event.d_startCycleCount - base))
+                                                                      / 1000.0;
+
+            fputs(separator, stream);
+            separator = ",\n";
+
+            fputs("{\"name\":", stream);
+            writeJsonString(stream, event.d_name_p);
+            fputs(",\"cat\":", stream);
+            writeJsonString(stream, event.d_category_p);
+            if (event.d_endCycleCount < 0) {
+                fprintf(stream,
+                        ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f",
+                        start);
+            }
+            else {
+                const double duration = static_cast<double>(
+                                      TimeUtil::convertCycleCount(
+                                          event.d_endCycleCount
+                                                  - event.d_startCycleCount))
+                                                                      / 1000.0;
+                fprintf(stream,
+                        ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f",
+                        start,
+                        duration);
+            }
+            fprintf(stream, ",\"pid\":1,\"tid\":%d}", buffer->d_threadId);
+        }
+    }
+
+    fputs("\n]}\n", stream);
+
+    return ferror(stream) ? -1 : 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
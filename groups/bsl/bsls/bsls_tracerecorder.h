@@ -0,0 +1,359 @@
+// bsls_tracerecorder.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLS_TRACERECORDER
+#define INCLUDED_BSLS_TRACERECORDER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide scoped trace events recorded in per-thread ring buffers.
+//
+//@CLASSES:
+//  bsls::TraceRecorder: utility to record and dump trace events
+//  bsls::TraceRecorderScope: records a trace event spanning a scope
+//
+//@MACROS:
+//  BSLS_TRACERECORDER_SCOPE: record a trace event for the enclosing scope
+//  BSLS_TRACERECORDER_LIBRARY_SCOPE: library trace point, compiled on request
+//
+//@SEE_ALSO: bsls_timeutil, bsls_latencyhistogram
+//
+//@DESCRIPTION: This component provides a low-overhead tracing facility that
+// shows where time is spent inside a process without an external profiler.
+// A 'bsls::TraceRecorderScope' object (usually declared with the
+// 'BSLS_TRACERECORDER_SCOPE' macro) marks a scope; when tracing is enabled,
+// its destruction records a trace event holding the category and name of the
+// scope, the calling thread, and the times at which the scope was entered and
+// left, as read from the cycle counter of 'bsls::TimeUtil'.  Instantaneous
+// events may also be recorded with 'bsls::TraceRecorder::recordInstant'.
+// 'bsls::TraceRecorder::writeChromeTrace' writes the recorded events in the
+// Chrome trace-event JSON format, which can be loaded into
+// 'chrome://tracing' or Perfetto to view a timeline of every thread.
+//
+// Tracing is disabled initially, in which case marking a scope costs one
+// relaxed load of an atomic flag.  'bsls::TraceRecorder::enable' starts
+// recording.
+//
+///Per-Thread Ring Buffers
+///-----------------------
+// Each thread records its events in a ring buffer of its own, which it
+// allocates (with 'malloc') when it first records an event, so that
+// recording an event needs no locks and no atomic read-modify-write
+// operations, and threads never contend.  A buffer holds a fixed number of
+// events, set by 'enable'; once it is full, each new event overwrites the
+// oldest one, so the dump shows the most recent events of each thread.
+// Buffers are never freed, so that the events of threads that have exited are
+// still dumped; a process creating many short-lived threads should not
+// enable tracing for long.
+//
+// Per-thread buffers rely on thread-local storage, which is used with GCC,
+// Clang, and MSVC.  With other compilers, enabling tracing has no effect.
+//
+// 'writeChromeTrace' and 'clear' read and reset the buffers of all threads.
+// Events recorded concurrently with a dump may be reported inconsistently, so
+// tracing should be disabled before dumping, and 'clear' must not be called
+// while other threads record events.
+//
+///Library Trace Points
+///--------------------
+// Some operations of the library that take long, or whose frequency matters,
+// are marked with 'BSLS_TRACERECORDER_LIBRARY_SCOPE': rehashing a
+// 'bslstl::HashTable' (category "bslstl"), replenishing a 'bdlma::Pool',
+// which also replenishes the pools of a 'bdlma::Multipool', and growing the
+// buffer of a 'bdlma::SequentialPool', which backs
+// 'bdlma::SequentialAllocator' (category "bdlma").  These trace points are
+// compiled only when the macro 'BSLS_TRACERECORDER_LIBRARY_TRACING' is
+// defined, so that they cost nothing in ordinary builds.  The macro must be
+// either defined or not defined consistently for the whole program, the
+// library included: the trace point of a template such as
+// 'bslstl::HashTable' is compiled into client code, and translation units
+// that disagree on the macro give the same inline function two different
+// definitions, which violates the one-definition rule.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Tracing the Phases of a Request
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to see how long each phase of handling a request
+// takes.  First, we mark the function handling the request, and a phase
+// within it, with scopes:
+//..
+//  int parseRequest(int request)
+//  {
+//      BSLS_TRACERECORDER_SCOPE("server", "parseRequest");
+//      return request * 2;
+//  }
+//
+//  int handleRequest(int request)
+//  {
+//      BSLS_TRACERECORDER_SCOPE("server", "handleRequest");
+//
+//      const int parsed = parseRequest(request);
+//      if (parsed % 3 == 0) {
+//          bsls::TraceRecorder::recordInstant("server", "multipleOfThree");
+//      }
+//      return parsed + 1;
+//  }
+//..
+// Then, we enable tracing, with room for 1024 events per thread, and handle
+// some requests:
+//..
+//  bsls::TraceRecorder::enable(1024);
+//
+//  int sum = 0;
+//  for (int i = 0; i < 10; ++i) {
+//      sum += handleRequest(i);
+//  }
+//..
+// Next, we disable tracing, and verify the number of recorded events: two
+// scopes for each request, and an instant for 4 of them:
+//..
+//  bsls::TraceRecorder::disable();
+//
+//  assert(24 == bsls::TraceRecorder::numEvents());
+//..
+// Finally, we write the events to a file that can be loaded into a trace
+// viewer:
+//..
+//  FILE *file = tmpfile();
+//  if (file) {
+//      assert(0 == bsls::TraceRecorder::writeChromeTrace(file));
+//      fclose(file);
+//  }
+//..
+// The file contains one JSON object per event, such as:
+//..
+//  {"traceEvents":[
+//  {"name":"parseRequest","cat":"server","ph":"X","ts":0.018,"dur":0.025,
+//   "pid":1,"tid":1},
+//  ...
+//  ]}
+//..
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDIO
+#include <stdio.h>
+#define INCLUDED_STDIO
+#endif
+
+                        // =========================
+                        // BSLS_TRACERECORDER macros
+                        // =========================
+
+#define BSLS_TRACERECORDER_CAT(X, Y) BSLS_TRACERECORDER_CAT_IMP(X, Y)
+#define BSLS_TRACERECORDER_CAT_IMP(X, Y) X##Y
+
+#define BSLS_TRACERECORDER_SCOPE(CATEGORY, NAME)                              \
+    BloombergLP::bsls::TraceRecorderScope                                     \
+           BSLS_TRACERECORDER_CAT(bslsTraceRecorderScope, __LINE__)(CATEGORY, \
+                                                                    NAME)
+    // Record, if tracing is enabled, a trace event having the specified
+    // 'CATEGORY' and 'NAME', which must be string literals or otherwise
+    // outlive the dump of the event, that spans the remainder of the
+    // enclosing scope.
+
+#if defined(BSLS_TRACERECORDER_LIBRARY_TRACING)
+#define BSLS_TRACERECORDER_LIBRARY_SCOPE(CATEGORY, NAME)                      \
+    BSLS_TRACERECORDER_SCOPE(CATEGORY, NAME)
+#else
+#define BSLS_TRACERECORDER_LIBRARY_SCOPE(CATEGORY, NAME)
+#endif
+    // Expand to 'BSLS_TRACERECORDER_SCOPE(CATEGORY, NAME)' if
+    // 'BSLS_TRACERECORDER_LIBRARY_TRACING' is defined, and to nothing
+    // otherwise.
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                            // ===================
+                            // struct TraceRecorder
+                            // ===================
+
+struct TraceRecorder {
+    // This 'struct' provides a namespace for functions that control the
+    // recording of trace events and write them out.  All functions are
+    // thread-safe, except where noted.
+
+  private:
+    // PRIVATE CLASS DATA
+    static AtomicOperations::AtomicTypes::Int s_enabled;
+        // non-zero if tracing is enabled
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        BSLS_DEFAULT_EVENTS_PER_THREAD = 16384  // default ring-buffer size
+    };
+
+    // CLASS METHODS
+    static void clear();
+        // Discard the events recorded so far by all threads.  The behavior is
+        // undefined if another thread records an event during this call.
+
+    static void disable();
+        // Stop recording trace events.  Events recorded so far are kept.
+
+    static void enable(int eventsPerThread = BSLS_DEFAULT_EVENTS_PER_THREAD);
+        // Start recording trace events.  Optionally specify
+        // 'eventsPerThread', the number of most recent events kept by each
+        // thread that records its first event after this call, rounded up to
+        // a power of two; if 'eventsPerThread' is not specified,
+        // 'BSLS_DEFAULT_EVENTS_PER_THREAD' is used.  Threads that have
+        // already recorded an event keep their buffers.  This function has
+        // no effect if the platform lacks thread-local storage (see
+        // 'Per-Thread Ring Buffers').  The behavior is undefined unless
+        // '0 < eventsPerThread <= 2^24'.
+
+    static bool isEnabled();
+        // Return 'true' if trace events are being recorded, and 'false'
+        // otherwise.
+
+    static Types::Int64 numEvents();
+        // Return the number of events held in the buffers of all threads,
+        // that is, the events recorded since the last 'clear', less those
+        // overwritten.
+
+    static void recordComplete(const char   *category,
+                               const char   *name,
+                               Types::Int64  startCycleCount,
+                               Types::Int64  endCycleCount);
+        // Record in the buffer of the calling thread an event having the
+        // specified 'category' and 'name' that started and ended at the
+        // specified 'startCycleCount' and 'endCycleCount', as read from
+        // 'TimeUtil::getCycleCounter'.  The behavior is undefined unless
+        // 'category' and 'name' remain valid until the event is dumped.
+        // Note that the event is recorded even if tracing is disabled.
+
+    static void recordInstant(const char *category, const char *name);
+        // Record, if tracing is enabled, an instantaneous event having the
+        // specified 'category' and 'name' in the buffer of the calling
+        // thread.  The behavior is undefined unless 'category' and 'name'
+        // remain valid until the event is dumped.
+
+    static int writeChromeTrace(FILE *stream);
+        // Write the events recorded by all threads to the specified 'stream'
+        // as a JSON object in the Chrome trace-event format, with times in
+        // microseconds since the earliest event.  Return 0 on success, and a
+        // non-zero value if writing to 'stream' failed.  Note that events
+        // recorded during this call may be written inconsistently.
+};
+
+                         // ========================
+                         // class TraceRecorderScope
+                         // ========================
+
+class TraceRecorderScope {
+    // This class implements a guard that, if tracing is enabled when it is
+    // created, records a trace event spanning its lifetime when it is
+    // destroyed.
+
+    // DATA
+    const char   *d_category_p;     // category of the event, or 0 if none is
+                                    // recorded
+
+    const char   *d_name_p;         // name of the event
+
+    Types::Int64  d_startCycleCount;  // cycle counter at construction
+
+    // NOT IMPLEMENTED
+    TraceRecorderScope(const TraceRecorderScope&);
+    TraceRecorderScope& operator=(const TraceRecorderScope&);
+
+  public:
+    // CREATORS
+    TraceRecorderScope(const char *category, const char *name);
+        // Create a guard that, if tracing is enabled, records at its
+        // destruction an event having the specified 'category' and 'name'
+        // that spans its lifetime.  The behavior is undefined unless
+        // 'category' and 'name' remain valid until the event is dumped.
+
+    ~TraceRecorderScope();
+        // Record the event of this guard, if tracing was enabled at its
+        // construction, and destroy this guard.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct TraceRecorder
+                            // -------------------
+
+// CLASS METHODS
+inline
+bool TraceRecorder::isEnabled()
+{
+    return 0 != AtomicOperations::getIntRelaxed(&s_enabled);
+}
+
+                         // ------------------------
+                         // class TraceRecorderScope
+                         // ------------------------
+
+// CREATORS
+inline
+TraceRecorderScope::TraceRecorderScope(const char *category, const char *name)
+: d_category_p(0)
+, d_name_p(name)
+, d_startCycleCount(0)
+{
+    if (TraceRecorder::isEnabled()) {
+        d_category_p      = category;
+        d_startCycleCount = TimeUtil::getCycleCounter();
+    }
+}
+
+inline
+TraceRecorderScope::~TraceRecorderScope()
+{
+    if (d_category_p) {
+        TraceRecorder::recordComplete(d_category_p,
+                                      d_name_p,
+                                      d_startCycleCount,
+                                      TimeUtil::getCycleCounterOrdered());
+    }
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
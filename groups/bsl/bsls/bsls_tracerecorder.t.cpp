@@ -0,0 +1,770 @@
+// bsls_tracerecorder.t.cpp                                           -*-C++-*-
+#include <bsls_tracerecorder.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>     // for testing only
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>              // printf(), tmpfile()
+#include <stdlib.h>             // atoi(), strtod()
+#include <string.h>             // strstr()
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test records events in global per-thread buffers, so
+// each test case runs in a fresh process and starts with no buffers.  The
+// recorded events are observed through 'numEvents' and through the JSON
+// written by 'writeChromeTrace' to a temporary file, which is searched for the
+// expected fields.  Tests of the ring buffer use a small capacity, and a test
+// with several threads verifies that each thread has a buffer of its own.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 5] static void clear();
+// [ 2] static void disable();
+// [ 2] static void enable(int);
+// [ 2] static bool isEnabled();
+// [ 3] static Types::Int64 numEvents();
+// [ 3] static void recordComplete(const char *, const char *, Int64, Int64);
+// [ 3] static void recordInstant(const char *, const char *);
+// [ 3] static int writeChromeTrace(FILE *);
+//
+// CREATORS
+// [ 3] TraceRecorderScope(const char *, const char *);
+// [ 3] ~TraceRecorderScope();
+//
+// MACROS
+// [ 3] BSLS_TRACERECORDER_SCOPE(CATEGORY, NAME)
+// [ 7] BSLS_TRACERECORDER_LIBRARY_SCOPE(CATEGORY, NAME)
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] RING BUFFER OVERWRITES OLDEST EVENTS
+// [ 6] PER-THREAD BUFFERS
+// [ 8] JSON ESCAPING
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COST OF A SCOPE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::TraceRecorder      Obj;
+typedef bsls::TraceRecorderScope Scope;
+typedef bsls::Types::Int64       Int64;
+
+enum { MAX_TRACE_SIZE = 60000 };
+
+static char traceText[MAX_TRACE_SIZE];
+    // text of the last trace read by 'readTrace'
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef void *(*thread_func)(void *arg);
+
+thread_t createThread(thread_func func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+void joinThread(thread_t thr)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+const char *readTrace()
+    // Write the recorded events with 'writeChromeTrace' to a temporary file,
+    // load its contents into 'traceText', and return 'traceText', or return
+    // 0 if the file cannot be created or the trace is too long.
+{
+    FILE *file = tmpfile();
+    if (!file) {
+        return 0;                                                     // RETURN
+    }
+    ASSERT(0 == Obj::writeChromeTrace(file));
+    rewind(file);
+    const size_t length = fread(traceText, 1, MAX_TRACE_SIZE, file);
+    fclose(file);
+    if (MAX_TRACE_SIZE == length) {
+        return 0;                                                     // RETURN
+    }
+    traceText[length] = '\0';
+    return traceText;
+}
+
+int countOccurrences(const char *text, const char *pattern)
+    // Return the number of non-overlapping occurrences of the specified
+    // 'pattern' in the specified 'text'.
+{
+    int         count = 0;
+    const size_t len  = strlen(pattern);
+    for (const char *p = strstr(text, pattern); p; p = strstr(p + len,
+                                                              pattern)) {
+        ++count;
+    }
+    return count;
+}
+
+double fieldValue(const char *event, const char *field)
+    // Return the numeric value of the specified 'field' (e.g., "\"dur\":")
+    // in the JSON object starting at the specified 'event', or -1.0 if the
+    // field is not found before the end of the object.
+{
+    const char *end = strchr(event, '}');
+    const char *p   = strstr(event, field);
+    if (!p || (end && p > end)) {
+        return -1.0;                                                  // RETURN
+    }
+    return strtod(p + strlen(field), 0);
+}
+
+void spin(Int64 nanoseconds)
+    // Wait for at least the specified 'nanoseconds' without yielding.
+{
+    const Int64 start = bsls::TimeUtil::getTimer();
+    while (bsls::TimeUtil::getTimer() - start < nanoseconds) {
+    }
+}
+
+extern "C" void *recordThread(void *arg)
+    // Record the number of scopes at the specified 'arg', an 'int', each
+    // named "worker".
+{
+    const int numScopes = *static_cast<int *>(arg);
+    for (int i = 0; i < numScopes; ++i) {
+        BSLS_TRACERECORDER_SCOPE("test", "worker");
+    }
+    return 0;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+int parseRequest(int request)
+{
+    BSLS_TRACERECORDER_SCOPE("server", "parseRequest");
+    return request * 2;
+}
+
+int handleRequest(int request)
+{
+    BSLS_TRACERECORDER_SCOPE("server", "handleRequest");
+
+    const int parsed = parseRequest(request);
+    if (parsed % 3 == 0) {
+        bsls::TraceRecorder::recordInstant("server", "multipleOfThree");
+    }
+    return parsed + 1;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bsls::TraceRecorder::enable(1024);
+
+        int sum = 0;
+        for (int i = 0; i < 10; ++i) {
+            sum += handleRequest(i);
+        }
+
+        bsls::TraceRecorder::disable();
+
+        ASSERT(24 == bsls::TraceRecorder::numEvents());
+
+        FILE *file = tmpfile();
+        if (file) {
+            ASSERT(0 == bsls::TraceRecorder::writeChromeTrace(file));
+            fclose(file);
+        }
+
+        if (veryVerbose) bsls::TraceRecorder::writeChromeTrace(stdout);
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // JSON ESCAPING
+        //
+        // Concerns:
+        //: 1 Quotes, backslashes, and control characters in names and
+        //:   categories are escaped in the JSON output.
+        //
+        // Plan:
+        //: 1 Record an instant having such a name and category, and search
+        //:   the output for the escaped forms.  (C-1)
+        //
+        // Testing:
+        //   JSON ESCAPING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nJSON ESCAPING"
+                            "\n=============\n");
+
+        Obj::enable();
+        Obj::recordInstant("a\\b", "say \"hi\"\n");
+        Obj::disable();
+
+        const char *TRACE = readTrace();
+        ASSERT(0 != TRACE);
+        if (TRACE) {
+            if (veryVerbose) printf("%s", TRACE);
+            ASSERT(0 != strstr(TRACE, "\"name\":\"say \\\"hi\\\"\\u000a\""));
+            ASSERT(0 != strstr(TRACE, "\"cat\":\"a\\\\b\""));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // LIBRARY TRACE POINTS
+        //
+        // Concerns:
+        //: 1 'BSLS_TRACERECORDER_LIBRARY_SCOPE' records nothing unless
+        //:   'BSLS_TRACERECORDER_LIBRARY_TRACING' is defined, and is then
+        //:   equivalent to 'BSLS_TRACERECORDER_SCOPE'.
+        //
+        // Plan:
+        //: 1 With tracing enabled, use the macro in a scope and verify the
+        //:   number of events according to the definition of
+        //:   'BSLS_TRACERECORDER_LIBRARY_TRACING' in this build.  (C-1)
+        //
+        // Testing:
+        //   BSLS_TRACERECORDER_LIBRARY_SCOPE(CATEGORY, NAME)
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLIBRARY TRACE POINTS"
+                            "\n====================\n");
+
+        Obj::enable();
+        {
+            BSLS_TRACERECORDER_LIBRARY_SCOPE("test", "library");
+        }
+        Obj::disable();
+
+#if defined(BSLS_TRACERECORDER_LIBRARY_TRACING)
+        ASSERT(1 == Obj::numEvents());
+#else
+        ASSERT(0 == Obj::numEvents());
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // PER-THREAD BUFFERS
+        //
+        // Concerns:
+        //: 1 Events recorded by several threads at the same time are all
+        //:   kept, each thread in a buffer of its own.
+        //:
+        //: 2 Each thread is reported with a distinct thread id.
+        //:
+        //: 3 The events of threads that have exited are kept.
+        //
+        // Plan:
+        //: 1 Run 4 threads recording 100 scopes each, join them, and verify
+        //:   the number of events and the number of events of each thread id
+        //:   in the output.  (C-1..3)
+        //
+        // Testing:
+        //   PER-THREAD BUFFERS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPER-THREAD BUFFERS"
+                            "\n==================\n");
+
+        enum { NUM_THREADS = 4, NUM_SCOPES = 100 };
+
+        Obj::enable(128);
+
+        int      numScopes = NUM_SCOPES;
+        thread_t threads[NUM_THREADS];
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            threads[i] = createThread(&recordThread, &numScopes);
+        }
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            joinThread(threads[i]);
+        }
+
+        Obj::disable();
+
+        ASSERTV(Obj::numEvents(), NUM_THREADS * NUM_SCOPES ==
+                                                            Obj::numEvents());
+
+        const char *TRACE = readTrace();
+        ASSERT(0 != TRACE);
+        if (TRACE) {
+            for (int tid = 1; tid <= NUM_THREADS; ++tid) {
+                char pattern[32];
+                sprintf(pattern, "\"tid\":%d}", tid);
+                ASSERTV(tid, NUM_SCOPES == countOccurrences(TRACE, pattern));
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLEAR
+        //
+        // Concerns:
+        //: 1 'clear' discards the events of all threads, and recording
+        //:   resumes in the same buffers afterwards.
+        //
+        // Plan:
+        //: 1 Record events in the main thread and another thread, clear, and
+        //:   verify that none remain; record again and verify the count.
+        //:   (C-1)
+        //
+        // Testing:
+        //   static void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLEAR"
+                            "\n=====\n");
+
+        Obj::enable();
+
+        int numScopes = 10;
+        joinThread(createThread(&recordThread, &numScopes));
+        Obj::recordInstant("test", "main");
+        ASSERT(11 == Obj::numEvents());
+
+        Obj::clear();
+        ASSERT(0 == Obj::numEvents());
+
+        const char *TRACE = readTrace();
+        ASSERT(TRACE && 0 == strstr(TRACE, "\"name\""));
+
+        Obj::recordInstant("test", "main");
+        Obj::recordInstant("test", "main");
+        ASSERT(2 == Obj::numEvents());
+
+        Obj::disable();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RING BUFFER OVERWRITES OLDEST EVENTS
+        //
+        // Concerns:
+        //: 1 The capacity is rounded up to a power of two.
+        //:
+        //: 2 Once the buffer is full, each event replaces the oldest one.
+        //:
+        //: 3 The events of a thread are written oldest first.
+        //
+        // Plan:
+        //: 1 Enable tracing with room for 5 events (rounded to 8), record 20
+        //:   instants with distinct names, and verify that only the last 8
+        //:   are written, in order.  (C-1..3)
+        //
+        // Testing:
+        //   RING BUFFER OVERWRITES OLDEST EVENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRING BUFFER OVERWRITES OLDEST EVENTS"
+                            "\n====================================\n");
+
+        static const char *const NAMES[] = {
+            "e00", "e01", "e02", "e03", "e04", "e05", "e06", "e07", "e08",
+            "e09", "e10", "e11", "e12", "e13", "e14", "e15", "e16", "e17",
+            "e18", "e19"
+        };
+        const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+        Obj::enable(5);
+        for (int i = 0; i < NUM_NAMES; ++i) {
+            Obj::recordInstant("test", NAMES[i]);
+            const Int64 EXPECTED = i + 1 < 8 ? i + 1 : 8;
+            ASSERTV(i, EXPECTED == Obj::numEvents());
+        }
+        Obj::disable();
+
+        const char *TRACE = readTrace();
+        ASSERT(0 != TRACE);
+        if (TRACE) {
+            if (veryVerbose) printf("%s", TRACE);
+
+            const char *previous = TRACE;
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                char pattern[32];
+                sprintf(pattern, "\"name\":\"%s\"", NAMES[i]);
+                const char *found = strstr(TRACE, pattern);
+                if (i < NUM_NAMES - 8) {
+                    ASSERTV(i, 0 == found);
+                }
+                else {
+                    ASSERTV(i, 0 != found);
+                    ASSERTV(i, previous <= found);
+                    previous = found;
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RECORDING AND WRITING EVENTS
+        //
+        // Concerns:
+        //: 1 A scope records one complete event, having its category and
+        //:   name, at its destruction.
+        //:
+        //: 2 The duration of the event is the time spent in the scope, in
+        //:   microseconds, and nested scopes are contained in their parents.
+        //:
+        //: 3 An instant is recorded as an event of phase "i".
+        //:
+        //: 4 'recordComplete' records an event with the given times, even if
+        //:   tracing is disabled.
+        //:
+        //: 5 The output is a JSON object holding an array of events.
+        //
+        // Plan:
+        //: 1 Record a scope waiting 2 milliseconds, containing a scope waiting
+        //:   1 millisecond and an instant; verify the count after each step.
+        //:   (C-1, 3)
+        //:
+        //: 2 Write the trace and verify the fields and times of each event.
+        //:   (C-2..3, 5)
+        //:
+        //: 3 Disable tracing and record an event with 'recordComplete'.
+        //:   (C-4)
+        //
+        // Testing:
+        //   static Types::Int64 numEvents();
+        //   static void recordComplete(const char *, const char *, Int64,
+        //                              Int64);
+        //   static void recordInstant(const char *, const char *);
+        //   static int writeChromeTrace(FILE *);
+        //   TraceRecorderScope(const char *, const char *);
+        //   ~TraceRecorderScope();
+        //   BSLS_TRACERECORDER_SCOPE(CATEGORY, NAME)
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRECORDING AND WRITING EVENTS"
+                            "\n============================\n");
+
+        Obj::enable();
+        {
+            BSLS_TRACERECORDER_SCOPE("outerCat", "outer");
+            spin(1000 * 1000);
+            {
+                Scope inner("innerCat", "inner");
+                spin(1000 * 1000);
+            }
+            ASSERT(1 == Obj::numEvents());
+            Obj::recordInstant("instantCat", "instant");
+            ASSERT(2 == Obj::numEvents());
+        }
+        ASSERT(3 == Obj::numEvents());
+        Obj::disable();
+
+        const char *TRACE = readTrace();
+        ASSERT(0 != TRACE);
+        if (TRACE) {
+            if (veryVerbose) printf("%s", TRACE);
+
+            ASSERT(TRACE == strstr(TRACE, "{\"traceEvents\":[\n"));
+            ASSERT(0 != strstr(TRACE, "\n]}\n"));
+            ASSERT(3 == countOccurrences(TRACE, "\"pid\":1,\"tid\":1}"));
+
+            const char *INNER   = strstr(TRACE,
+                                  "{\"name\":\"inner\",\"cat\":\"innerCat\"");
+            const char *INSTANT = strstr(TRACE,
+                              "{\"name\":\"instant\",\"cat\":\"instantCat\"");
+            const char *OUTER   = strstr(TRACE,
+                                  "{\"name\":\"outer\",\"cat\":\"outerCat\"");
+            ASSERT(INNER && INSTANT && OUTER);
+
+            if (INNER && INSTANT && OUTER) {
+                ASSERT(0 != strstr(INNER,   "\"ph\":\"X\""));
+                ASSERT(0 != strstr(OUTER,   "\"ph\":\"X\""));
+                ASSERT(0 != strstr(INSTANT, "\"ph\":\"i\",\"s\":\"t\""));
+                ASSERT(-1.0 == fieldValue(INSTANT, "\"dur\":"));
+
+                const double OUTER_TS  = fieldValue(OUTER,   "\"ts\":");
+                const double OUTER_DUR = fieldValue(OUTER,   "\"dur\":");
+                const double INNER_TS  = fieldValue(INNER,   "\"ts\":");
+                const double INNER_DUR = fieldValue(INNER,   "\"dur\":");
+                const double INST_TS   = fieldValue(INSTANT, "\"ts\":");
+
+                if (verbose) {
+                    P_(OUTER_TS); P_(OUTER_DUR); P_(INNER_TS); P(INNER_DUR);
+                }
+
+                ASSERTV(OUTER_TS, 0.0 == OUTER_TS);   // earliest event
+                ASSERTV(OUTER_DUR, 1990.0 <= OUTER_DUR);
+                ASSERTV(INNER_DUR,  990.0 <= INNER_DUR);
+                ASSERTV(INNER_DUR, OUTER_DUR, INNER_DUR < OUTER_DUR);
+                ASSERTV(INNER_TS, 990.0 <= INNER_TS);
+                ASSERTV(INNER_TS, INST_TS, INNER_TS + INNER_DUR <= INST_TS);
+                ASSERTV(INST_TS, OUTER_DUR, INST_TS <= OUTER_DUR);
+            }
+        }
+
+        if (verbose) printf("\tRecording while disabled.\n");
+
+        const Int64 START = bsls::TimeUtil::getCycleCounter();
+        Obj::recordComplete("cat", "explicit", START, START);
+        ASSERT(4 == Obj::numEvents());
+
+        TRACE = readTrace();
+        ASSERT(TRACE && 0 != strstr(TRACE, "\"name\":\"explicit\""));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ENABLING AND DISABLING
+        //
+        // Concerns:
+        //: 1 Tracing is initially disabled, and nothing is recorded.
+        //:
+        //: 2 'enable' and 'disable' switch recording on and off; a scope
+        //:   created while tracing is disabled records nothing even if
+        //:   tracing is enabled before it ends.
+        //
+        // Plan:
+        //: 1 Create scopes and instants in each state, including across a
+        //:   change of state, and verify 'isEnabled' and 'numEvents'.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   static void disable();
+        //   static void enable(int);
+        //   static bool isEnabled();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nENABLING AND DISABLING"
+                            "\n======================\n");
+
+        ASSERT(false == Obj::isEnabled());
+        {
+            BSLS_TRACERECORDER_SCOPE("test", "disabled");
+            Obj::recordInstant("test", "disabled");
+        }
+        ASSERT(0 == Obj::numEvents());
+
+        {
+            BSLS_TRACERECORDER_SCOPE("test", "enabledLater");
+            Obj::enable();
+            ASSERT(true == Obj::isEnabled());
+        }
+        ASSERT(0 == Obj::numEvents());
+
+        {
+            BSLS_TRACERECORDER_SCOPE("test", "disabledLater");
+            Obj::disable();
+            ASSERT(false == Obj::isEnabled());
+        }
+        ASSERT(1 == Obj::numEvents());
+
+        Obj::recordInstant("test", "disabled");
+        ASSERT(1 == Obj::numEvents());
+
+        Obj::enable();
+        Obj::recordInstant("test", "enabled");
+        ASSERT(2 == Obj::numEvents());
+        Obj::disable();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record a scope and write the trace.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj::enable();
+        {
+            BSLS_TRACERECORDER_SCOPE("test", "breathing");
+        }
+        Obj::disable();
+        ASSERT(1 == Obj::numEvents());
+
+        const char *TRACE = readTrace();
+        ASSERT(TRACE && 0 != strstr(TRACE, "\"name\":\"breathing\""));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COST OF A SCOPE
+        //
+        // Concerns:
+        //: 1 Report the cost of a traced scope when tracing is disabled and
+        //:   when it is enabled, and of an instant.
+        //
+        // Plan:
+        //: 1 Time loops of empty scopes and of instants in each state, and
+        //:   print the time per iteration.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COST OF A SCOPE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: COST OF A SCOPE"
+                            "\n=================================\n");
+
+        const int NUM_ITERATIONS = 1 << 22;
+
+        for (int enabled = 0; enabled < 2; ++enabled) {
+            if (enabled) {
+                Obj::enable(1024);
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                BSLS_TRACERECORDER_SCOPE("test", "empty");
+            }
+            timer.stop();
+            printf("scope   (%-8s): %6.2f ns\n",
+                   enabled ? "enabled" : "disabled",
+                   timer.elapsedTime() * 1e9 / NUM_ITERATIONS);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Obj::recordInstant("test", "instant");
+            }
+            timer.stop();
+            printf("instant (%-8s): %6.2f ns\n",
+                   enabled ? "enabled" : "disabled",
+                   timer.elapsedTime() * 1e9 / NUM_ITERATIONS);
+        }
+        Obj::disable();
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
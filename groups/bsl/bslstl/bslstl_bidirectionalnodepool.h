@@ -21,7 +21,11 @@ BSLS_IDENT("$Id: $")
 //
 // A 'BidirectionalNodePool' uses a memory pool provided by the
 // 'bslstl_simplepool' component in its implementation to provide memory for
-// the nodes (see 'bslstl_simplepool').
+// the nodes (see 'bslstl_simplepool').  Each node is a separate allocation, so
+// a node created by one 'BidirectionalNodePool' may be deleted by another one
+// using an equal allocator, which then reuses its memory, or by the
+// 'deleteNode' class method, which returns the memory to the allocator, even
+// after the pool that created the node is destroyed.
 //
 ///Memory Allocation
 ///-----------------
@@ -34,8 +38,8 @@ BSLS_IDENT("$Id: $")
 // If 'ALLOCATOR' is 'bsl::allocator' and the (template parameter) type 'VALUE'
 // defines the 'bslma::UsesBslmaAllocator' trait, then the 'bslma::Allocator'
 // object specified at construction will be supplied to constructors of the
-// (template parameter) type 'VALUE' in the 'cloneNode' method and 'createNode'
-// method overloads.
+// (template parameter) type 'VALUE' in the 'cloneNode' method, the
+// 'createNode' method overloads, and 'emplaceIntoNewNode'.
 //
 ///Usage
 ///-----
@@ -206,6 +210,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_BSLS_NATIVESTD
 #include <bsls_nativestd.h>
 #endif
@@ -251,6 +259,17 @@ class BidirectionalNodePool {
         // Alias for the 'size_type' of the allocator defined by 'SimplePool'.
 
   public:
+    // CLASS METHODS
+    static void deleteNode(AllocatorType             *allocator,
+                           bslalg::BidirectionalLink *linkNode);
+        // Destroy the 'VALUE' attribute of the specified 'linkNode' and return
+        // the memory footprint of 'linkNode' to the specified 'allocator'.
+        // The behavior is undefined unless 'linkNode' refers to a
+        // 'bslalg::BidirectionalNode<VALUE>' that was allocated by a
+        // 'BidirectionalNodePool' of this type using an allocator equal to
+        // '*allocator'.  Note that the pool that allocated 'linkNode' need not
+        // exist anymore.
+
     // CREATORS
     explicit BidirectionalNodePool(const ALLOCATOR& allocator);
         // Create a 'BidirectionalNodePool' object that will use the specified
@@ -259,11 +278,12 @@ class BidirectionalNodePool {
         // 'allocator' shall be convertible to 'bslma::Allocator *'.
 
     // ~BidirectionalNodePool() = default;
-        // Destroy the memory pool maintained by this object, releasing all
-        // memory used by the nodes of the type 'BidirectionalNode<VALUE>' in
-        // the pool.  Any memory allocated for the nodes' 'value' attribute of
-        // the (template parameter) type 'VALUE' will be leaked unless the
-        // nodes are explictly destroyed via the 'destroyNode' method.
+        // Destroy the memory pool maintained by this object, returning to the
+        // allocator the memory of the nodes of the type
+        // 'BidirectionalNode<VALUE>' held by the pool for reuse.  The nodes
+        // that are in use are not affected, and will be leaked unless they
+        // are explictly deleted via the 'deleteNode' method (of this or
+        // another pool using an equal allocator).
 
     // MANIPULATORS
     AllocatorType& allocator();
@@ -301,6 +321,68 @@ class BidirectionalNodePool {
         // Note that the 'next' and 'prev' attributes of the returned node will
         // be uninitialized.
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplaceIntoNewNode(ARGS&&... args);
+        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
+        // construct in-place an object of the (template parameter) type
+        // 'VALUE' from the specified 'args', forwarded to the 'construct'
+        // method of this pool's allocator, at the 'value' attribute of the
+        // node.  Return the address of the node.  Note that the 'next' and
+        // 'prev' attributes of the returned node will be uninitialized.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_bidirectionalnodepool.h
+    bslalg::BidirectionalLink *emplaceIntoNewNode();
+
+    template <class ARGS_1>
+    bslalg::BidirectionalLink *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bslalg::BidirectionalLink *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bslalg::BidirectionalLink *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bslalg::BidirectionalLink *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bslalg::BidirectionalLink *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     bslalg::BidirectionalLink *cloneNode(
                                     const bslalg::BidirectionalLink& original);
         // Allocate a node of the type 'BidirectionalNode<VALUE>', and
@@ -313,14 +395,29 @@ class BidirectionalNodePool {
     void deleteNode(bslalg::BidirectionalLink *linkNode);
         // Destroy the 'VALUE' attribute of the specified 'linkNode' and return
         // the memory footprint of 'linkNode' to this pool for potential reuse.
-        // The behavior is undefined unless 'node' refers to a
-        // 'bslalg::BidirectionalNode<VALUE>' that was allocated by this pool.
+        // The behavior is undefined unless 'linkNode' refers to a
+        // 'bslalg::BidirectionalNode<VALUE>' that was allocated by a
+        // 'BidirectionalNodePool' of this type using an allocator equal to
+        // that of this pool.
+
+    void deallocateNode(bslalg::BidirectionalLink *linkNode);
+        // Return the memory footprint of the specified 'linkNode' to this pool
+        // for potential reuse, *without* destroying its 'VALUE' attribute.
+        // The behavior is undefined unless 'linkNode' refers to a
+        // 'bslalg::BidirectionalNode<VALUE>' that was allocated by a
+        // 'BidirectionalNodePool' of this type using an allocator equal to
+        // that of this pool, and the destructor of 'VALUE' need not be run
+        // (e.g., 'VALUE' is trivially copyable).
 
     void reserveNodes(size_type numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
         // least the specified 'numNodes' before the pool replenishes.  The
         // behavior is undefined unless '0 < numNodes'.
 
+    void release();
+        // Return the memory of the nodes held by this pool for reuse to its
+        // allocator.  Note that the nodes that are in use are not affected.
+
     void swapRetainAllocators(BidirectionalNodePool& other);
         // Efficiently exchange the nodes of this object with those of the
         // specified 'other' object.  This method provides the no-throw
@@ -332,7 +429,6 @@ class BidirectionalNodePool {
         // those of the specified 'other' object.  This method provides the
         // no-throw exception-safety guarantee.
 
-    void release() { d_pool.release(); }
 
     // ACCESSORS
     const AllocatorType& allocator() const;
@@ -374,6 +470,23 @@ struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
 
 namespace bslstl {
 
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::deleteNode(
+                                         AllocatorType             *allocator,
+                                         bslalg::BidirectionalLink *linkNode)
+{
+    BSLS_ASSERT(allocator);
+    BSLS_ASSERT(linkNode);
+
+    bslalg::BidirectionalNode<VALUE> *node =
+                     static_cast<bslalg::BidirectionalNode<VALUE> *>(linkNode);
+    AllocatorTraits::destroy(*allocator,
+                             bsls::Util::addressOf(node->value()));
+    Pool::deallocateBlock(allocator, node);
+}
+
 // CREATORS
 template <class VALUE, class ALLOCATOR>
 inline
@@ -442,6 +555,175 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const FIRST_ARG&  first,
     return node;
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class VALUE, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(ARGS&&... args)
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()),
+                               native_std::forward<ARGS>(args)...);
+    proctor.release();
+    return node;
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_bidirectionalnodepool.h
+template <class VALUE, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode()
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+    proctor.release();
+    return node;
+}
+
+#else
+template <class VALUE, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+    proctor.release();
+    return node;
+}
+// }}} END GENERATED CODE
+#endif
+
 template <class VALUE, class ALLOCATOR>
 inline
 bslalg::BidirectionalLink *
@@ -466,6 +748,17 @@ void BidirectionalNodePool<VALUE, ALLOCATOR>::deleteNode(
     d_pool.deallocate(node);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::deallocateNode(
+                                           bslalg::BidirectionalLink *linkNode)
+{
+    BSLS_ASSERT(linkNode);
+
+    d_pool.deallocate(static_cast<bslalg::BidirectionalNode<VALUE> *>(
+                                                                   linkNode));
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
@@ -475,6 +768,13 @@ void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
     d_pool.reserve(numNodes);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::release()
+{
+    d_pool.release();
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void BidirectionalNodePool<VALUE, ALLOCATOR>::swapRetainAllocators(
@@ -17,6 +17,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_types.h>
 
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_templatetestfacility.h>
@@ -73,6 +74,9 @@ using namespace bslstl;
 //: o No memory is ever allocated from the global allocator.
 //: o Precondition violations are detected in appropriate build modes.
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 5] static void deleteNode(AllocatorType *, BidirectionalLink *);
+//
 // CREATORS
 // [ 2] explicit BidirectionalNodePool(const ALLOCATOR& allocator);
 // [ 2] ~BidirectionalNodePool();
@@ -83,7 +87,9 @@ using namespace bslstl;
 // [ 7] bslalg::BidirectionalLink *createNode(const VALUE& value);
 // [ 8] bslalg::BidirectionalLink *createNode(first, second);
 // [ 9] bslalg::BidirectionalLink *cloneNode(const BidirectionalLink&);
+// [12] bslalg::BidirectionalLink *emplaceIntoNewNode(ARGS&&... args);
 // [ 5] void deleteNode(bslalg::BidirectionalLink *node);
+// [ 5] void deallocateNode(bslalg::BidirectionalLink *node);
 // [ 6] void reserveNodes(std::size_t numNodes);
 // [10] void swapRetainAllocators(other);
 // [10] void swapExchangeAllocators(other);
@@ -95,6 +101,7 @@ using namespace bslstl;
 // [10] void swap(BidirectionalNodePool& a, b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [13] USAGE EXAMPLE
 // [ *] CONCERN: No memory is ever allocated from the global allocator.
 //-----------------------------------------------------------------------------
 //=============================================================================
@@ -181,20 +188,6 @@ static bool veryVeryVeryVerbose;
 typedef bslalg::BidirectionalLink Link;
 typedef bslalg::BidirectionalNode<int> IntNode;
 
-namespace {
-
-bool expectToAllocate(int n)
-    // Return 'true' if the container is expected to allocate memory on the
-    // specified 'n'th element, and 'false' otherwise.
-{
-    if (n > 32) {
-        return (0 == n % 32);                                         // RETURN
-    }
-    return (((n - 1) & n) == 0);  // Allocate when 'n' is a power of 2
-}
-
-}  // close unnamed namespace
-
 //=============================================================================
 //                               TEST FACILITIES
 //-----------------------------------------------------------------------------
@@ -472,6 +465,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase12();
+        // Test 'emplaceIntoNewNode'.
+
     static void testCase11();
         // Test type traits.
 
@@ -541,13 +537,6 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
         usedBlocks->push(ptr);
     }
 
-    // Use up all the free blocks.
-
-    while (!expectToAllocate(usedBlocks->size() + 1)) {
-        Link *ptr = result->createNode();
-        usedBlocks->push(ptr);
-    }
-
     // Free up the necessary number of blocks.
 
     for (int i = 0; i < numBlocks; ++i) {
@@ -556,6 +545,89 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase12()
+{
+    // -----------------------------------------------------------------------
+    // MANIPULATOR 'emplaceIntoNewNode'
+    //
+    // Concerns:
+    //: 1 'emplaceIntoNewNode' forwards its arguments to the constructor of
+    //:   the (template parameter) 'VALUE' type having the same number of
+    //:   parameters.
+    //:
+    //: 2 'VALUE' need not be copy-constructible.
+    //:
+    //: 3 Any memory allocation is from the object allocator.
+    //:
+    //: 4 There is no temporary allocation from any allocator.
+    //:
+    //: 5 Every object releases any allocated memory at destruction.
+    //
+    // Plan:
+    //: 1 Using test types whose copy constructor is not accessible, invoke
+    //:   'emplaceIntoNewNode' with one and with two arguments:  (C-2)
+    //:
+    //:   1 Verify memory is allocated only when expected.  (C-3..4)
+    //:
+    //:   2 Verify the value of the new node was constructed by the expected
+    //:     constructor.  (C-1)
+    //:
+    //: 2 Verify all memory is released on destruction.  (C-5)
+    //
+    // Testing:
+    //   bslalg::BidirectionalLink *emplaceIntoNewNode(ARGS&&... args);
+    // -----------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'emplaceIntoNewNode'"
+                        "\n================================\n");
+
+    const bool TYPE_ALLOC = bslma::UsesBslmaAllocator<VALUE>::value;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    {
+        Obj mX(&oa);
+
+        Stack usedX;
+
+        for (int i = 0; i < 16; ++i) {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const double ARG1 = i;
+            const double ARG2 = i * 2;
+
+            Link *ptr = i % 2 ? mX.emplaceIntoNewNode(ARG1, ARG2)
+                              : mX.emplaceIntoNewNode(ARG1);
+
+            // Both constructors of 'AllocatingTestType' allocate two blocks.
+
+            const int NUM_ALLOCS = 2 * TYPE_ALLOC;
+            ASSERTV(1 + NUM_ALLOCS == oam.numBlocksTotalChange());
+            ASSERTV(1 + NUM_ALLOCS == oam.numBlocksInUseChange());
+
+            usedX.push(ptr);
+
+            ValueNode *node = static_cast<ValueNode *>(ptr);
+            ASSERTV(i, ARG1 == node->value().arg1());
+            if (i % 2) {
+                ASSERTV(i, ARG2 == node->value().arg2());
+                ASSERTV(i, node->value().twoParamsConstructorFlag());
+            }
+            else {
+                ASSERTV(i, node->value().oneParamConstructorFlag());
+            }
+        }
+
+        while(!usedX.empty()) {
+            mX.deleteNode(usedX.back());
+            usedX.pop();
+        }
+    }
+    // Verify all memory is released on object destruction.
+    ASSERTV(oa.numBlocksInUse(),  0 ==  oa.numBlocksInUse());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase11()
 {
@@ -584,7 +656,7 @@ void TestDriver<VALUE>::testCase10()
     //
     // Concerns:
     //: 1 Invoking either of the swap methods or the free function exchange the
-    //:  free list and chunk list of the objects.
+    //:  free lists of the objects.
     //:
     //: 2 The common object allocator address held by both objects is unchanged
     //:   after 'swapRetainAllocators' or the free 'swap' function is invoked.
@@ -701,6 +773,8 @@ void TestDriver<VALUE>::testCase10()
 
                     Stack usedY;
                     Stack freeY;
+
+                    bsls::Types::Int64 numBlocksInUse;
                     {
                         Obj mY(&oa);
                         const Obj& Y = init(&mY, &usedY, &freeY, ALLOCS2,
@@ -739,21 +813,19 @@ void TestDriver<VALUE>::testCase10()
                             mX.deleteNode(usedX.back());
                             usedX.pop();
                         }
+
+                        numBlocksInUse = oa.numBlocksInUse();
                     }
 
-                    // 'Y' is now destroyed, its blocks should be deallocated.
-                    // Verify Blocks in 'X' (which used to be in 'Y' before the
-                    // swap) is not deallocated.
+                    // 'Y' is now destroyed, its free blocks should be
+                    // deallocated.  Verify Blocks in 'X' (which used to be in
+                    // 'Y' before the swap) is not deallocated.
 
-                    char SCRIBBLED_MEMORY[sizeof(VALUE)];
-                    memset(SCRIBBLED_MEMORY, 0xA5, sizeof(VALUE));
-                    while (!usedY.empty()) {
-                        Link *ptr = usedY.back();
-                        ASSERTV(0 != strncmp((char *)ptr,
-                                             SCRIBBLED_MEMORY,
-                                             sizeof(VALUE)));
+                    ASSERTV(LINE1, LINE2,
+                            numBlocksInUse == oa.numBlocksInUse());
 
-                        mX.deleteNode(ptr);
+                    while (!usedY.empty()) {
+                        mX.deleteNode(usedY.back());
                         usedY.pop();
                     }
                 }
@@ -772,6 +844,8 @@ void TestDriver<VALUE>::testCase10()
 
                     Stack usedY;
                     Stack freeY;
+
+                    bsls::Types::Int64 numBlocksInUse;
                     {
                         Obj mY(&oa2);
                         const Obj& Y = init(&mY, &usedY, &freeY, ALLOCS2,
@@ -808,24 +882,22 @@ void TestDriver<VALUE>::testCase10()
                         // Cleanup up memory used by the object in the node.
 
                         while(!usedX.empty()) {
-                            mX.deleteNode(usedX.back());
+                            mY.deleteNode(usedX.back());
                             usedX.pop();
                         }
+
+                        numBlocksInUse = oa2.numBlocksInUse();
                     }
 
-                    // 'Y' is now destroyed, its blocks should be deallocated.
-                    // Verify Blocks in 'X' (which used to be in 'Y' before the
-                    // swap) is not deallocated.
+                    // 'Y' is now destroyed, its free blocks should be
+                    // deallocated.  Verify Blocks in 'X' (which used to be in
+                    // 'Y' before the swap) is not deallocated.
 
-                    char SCRIBBLED_MEMORY[sizeof(VALUE)];
-                    memset(SCRIBBLED_MEMORY, 0xA5, sizeof(VALUE));
-                    while (!usedY.empty()) {
-                        Link *ptr = usedY.back();
-                        ASSERTV(0 != strncmp((char *)ptr,
-                                             SCRIBBLED_MEMORY,
-                                             sizeof(VALUE)));
+                    ASSERTV(LINE1, LINE2,
+                            numBlocksInUse == oa2.numBlocksInUse());
 
-                        mX.deleteNode(ptr);
+                    while (!usedY.empty()) {
+                        mX.deleteNode(usedY.back());
                         usedY.pop();
                     }
                 }
@@ -879,6 +951,8 @@ void TestDriver<VALUE>::testCase10()
 
                 Stack usedY;
                 Stack freeY;
+
+                bsls::Types::Int64 numBlocksInUse;
                 {
                     Obj mY(&oa);
                     const Obj& Y = init(&mY, &usedY, &freeY, ALLOCS2,
@@ -917,21 +991,19 @@ void TestDriver<VALUE>::testCase10()
                         mX.deleteNode(usedX.back());
                         usedX.pop();
                     }
+
+                    numBlocksInUse = oa.numBlocksInUse();
                 }
 
-                // 'Y' is now destroyed, its blocks should be deallocated.
-                // Verify Blocks in 'X' (which used to be in 'Y' before the
-                // swap) is not deallocated.
+                // 'Y' is now destroyed, its free blocks should be
+                // deallocated.  Verify Blocks in 'X' (which used to be in 'Y'
+                // before the swap) is not deallocated.
 
-                char SCRIBBLED_MEMORY[sizeof(VALUE)];
-                memset(SCRIBBLED_MEMORY, 0xA5, sizeof(VALUE));
-                while (!usedY.empty()) {
-                    Link *ptr = usedY.back();
-                    ASSERTV(0 != strncmp((char *)ptr,
-                                         SCRIBBLED_MEMORY,
-                                         sizeof(VALUE)));
+                ASSERTV(LINE1, LINE2,
+                        numBlocksInUse == oa.numBlocksInUse());
 
-                    mX.deleteNode(ptr);
+                while (!usedY.empty()) {
+                    mX.deleteNode(usedY.back());
                     usedY.pop();
                 }
             }
@@ -1022,14 +1094,8 @@ void TestDriver<VALUE>::testCase9()
 
             Link *ptr = mY.cloneNode(*usedX[i]);
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
 
             usedY.push(ptr);
 
@@ -1114,14 +1180,8 @@ void TestDriver<VALUE>::testCase8()
 
             Link *ptr = mX.createNode(arg1, arg2);
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 + 2 * TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(1 + 2 * TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(2 * TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(2 * TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
+            ASSERTV(1 + 2 * TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + 2 * TYPE_ALLOC == oam.numBlocksInUseChange());
 
             usedX.push(ptr);
 
@@ -1205,14 +1265,8 @@ void TestDriver<VALUE>::testCase7()
 
             Link *ptr = mX.createNode(VALUES[i]);
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
             usedX.push(ptr);
 
             ValueNode *node = static_cast<ValueNode *>(ptr);
@@ -1271,6 +1325,7 @@ void TestDriver<NonAllocatingTestType>::testCase7()
     float arg1f = 1.0;
     ptr = mX.createNode(arg1f);
     ASSERT(static_cast<ValueNode*>(ptr)->value().oneParamConstructorFlag());
+    mX.deleteNode(ptr);
 }
 
 
@@ -1390,6 +1445,13 @@ void TestDriver<VALUE>::testCase5()
     //:   caused by the destructor of the value.
     //:
     //: 5 QoI: Asserted precondition violations are detected when enabled.
+    //:
+    //: 6 'deallocateNode' returns a node to the free list without invoking
+    //:   the destructor of its value.
+    //:
+    //: 7 The 'deleteNode' class method invokes the destructor of the value
+    //:   and returns the memory of the node to the allocator, even after the
+    //:   pool that created the node is destroyed.
     //
     // Plan:
     //: 1 Create a list of sequences to allocate and deallocate memory.  For
@@ -1403,14 +1465,24 @@ void TestDriver<VALUE>::testCase5()
     //:   3 Verify no memory was allocated from the heap on 'deleteNode'.
     //:     (C-4)
     //:
-    //:   4 Verify 'createNode' will get memory from the heap only when
-    //:     expected.
+    //:   4 Verify 'createNode' will get memory from the heap only when the
+    //:     free list is empty.
     //:
-    //: 2 Verify that, in appropriate build modes, defensive checks are
+    //: 2 Create a node, destroy its value explicitly, and call
+    //:   'deallocateNode'.  Verify no memory is released, and that the next
+    //:   'createNode' reuses the node without allocating memory.  (C-6)
+    //:
+    //: 3 Create a node from a pool, destroy the pool, and call the
+    //:   'deleteNode' class method with the allocator of another pool.
+    //:   Verify all memory of the node and its value is released.  (C-7)
+    //:
+    //: 4 Verify that, in appropriate build modes, defensive checks are
     //:   triggered (using the 'BSLS_ASSERTTEST_*' macros).  (C-5)
     //
     // Testing:
+    //   static void deleteNode(AllocatorType *, BidirectionalLink *);
     //   void deleteNode(bslalg::BidirectionalLink *node);
+    //   void deallocateNode(bslalg::BidirectionalLink *node);
     // --------------------------------------------------------------------
 
     if (verbose) printf("\nMANIPULATOR 'deleteNode'"
@@ -1463,14 +1535,8 @@ void TestDriver<VALUE>::testCase5()
                     freeBlocks.pop();
                 }
                 else {
-                    if (expectToAllocate(usedBlocks.size())) {
-                        ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                        ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-                    }
-                    else {
-                        ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                        ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-                    }
+                    ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+                    ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
                 }
             }
             else {
@@ -1496,6 +1562,51 @@ void TestDriver<VALUE>::testCase5()
         }
     }
 
+    if (verbose) printf("\nTesting 'deallocateNode'.\n");
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);
+
+        Link *ptr = mX.createNode();
+
+        static_cast<ValueNode *>(ptr)->value().~VALUE();
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        mX.deallocateNode(ptr);
+
+        ASSERTV(oam.isTotalSame());
+        ASSERTV(oam.isInUseSame());
+
+        ASSERTV(ptr == mX.createNode());
+
+        ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
+        ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
+
+        mX.deleteNode(ptr);
+    }
+
+    if (verbose) printf("\nTesting class method 'deleteNode'.\n");
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);
+
+        Link *ptr;
+        {
+            Obj mY(&oa);
+
+            ptr = mY.createNode();
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 1 + TYPE_ALLOC == oa.numBlocksInUse());
+
+        Obj::deleteNode(&mX.allocator(), ptr);
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
     if (verbose) printf("\nNegative Testing.\n");
     {
         bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
@@ -1630,7 +1741,8 @@ void TestDriver<VALUE>::testCase2()
     //:
     //: 5 Every object releases any allocated memory at destruction.
     //:
-    //: 6 Allocation starts at one block, up to a maximum of 32 blocks.
+    //: 6 Every node created while the free list is empty is a separate
+    //:   allocation.
     //:
     //: 7 Constructor allocates no memory.
     //:
@@ -1644,12 +1756,8 @@ void TestDriver<VALUE>::testCase2()
     //:   2 Call 'allocate' 96 times in the presence of exception, for each
     //:     time:
     //:
-    //:     1 Verify memory is only allocated from object allocator and only
-    //:       when expected.  (C-2, 4, 6..7)
-    //:
-    //:     2 If memory is not allocated, the address is the max of
-    //:       'sizeof(VALUE)' and 'sizeof(void *) larger than the previous
-    //:       address.  (C-8)
+    //:     1 Verify memory is only allocated from object allocator, one
+    //:       block for each node.  (C-2, 4, 6, 8)
     //:
     //:   3 Delete the object and verify all memory is deallocated.  (C-5)
     //:
@@ -1721,14 +1829,8 @@ void TestDriver<VALUE>::testCase2()
 
             Link *ptr = mX.createNode();
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
             usedBlocks.push(ptr);
         }
 
@@ -1802,16 +1904,10 @@ void TestDriver<VALUE>::testCase2()
 
             Link *ptr = mX.createNode();
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 == sam.numBlocksTotalChange());
-                ASSERTV(1 == sam.numBlocksInUseChange());
-                ASSERTV(TYPE_ALLOC == dam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == dam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(TYPE_ALLOC == dam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == dam.numBlocksInUseChange());
-            }
+            ASSERTV(1 == sam.numBlocksTotalChange());
+            ASSERTV(1 == sam.numBlocksInUseChange());
+            ASSERTV(TYPE_ALLOC == dam.numBlocksTotalChange());
+            ASSERTV(TYPE_ALLOC == dam.numBlocksInUseChange());
 
             usedBlocks.push(ptr);
         }
@@ -2026,7 +2122,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&ga);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2076,6 +2172,14 @@ int main(int argc, char *argv[])
         ASSERT(NUM_DATA == ti);
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // MANIPULATOR 'emplaceIntoNewNode'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase12,
+                      NonAllocatingTestType, AllocatingTestType);
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TYPE TRAITS
@@ -0,0 +1,311 @@
+// bslstl_charconvutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_CHARCONVUTIL
+#define INCLUDED_BSLSTL_CHARCONVUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide locale-free conversions between numbers and characters.
+//
+//@CLASSES:
+//  bslstl::CharConvUtil: namespace for number/character conversion functions
+//
+//@SEE_ALSO: bslstl_ostringstream, bslstl_istringstream, bslstl_string
+//
+//@DESCRIPTION: This component provides a 'struct', 'bslstl::CharConvUtil',
+// that serves as a namespace for functions converting integers and 'double'
+// values to and from their decimal text representations.  Unlike formatting
+// with 'bsl::ostringstream' or 'snprintf' and parsing with
+// 'bsl::istringstream' or 'strtod', these functions do not consult the
+// current locale, do not allocate memory, and do not require the text to be
+// null-terminated: output is written to a caller-supplied range of characters
+// (or appended to a 'bsl::string'), and input is read from a range of
+// characters, in the manner of the C++17 '<charconv>' functions.
+//
+///Formatting
+///----------
+// 'toChars' writes the decimal representation of a value to the range
+// '[first, last)' and returns the address one past the last character
+// written, or 0 if the range is too small (in which case the contents of the
+// range are unspecified).  No null terminator is written.  The
+// 'BSLSTL_MAX_*_LENGTH' constants give a range length that is sufficient for
+// any value of each type.  'appendChars' appends the representation of a
+// value to a 'bsl::string'.
+//
+// Integers are written as an optional '-' followed by the decimal digits of
+// the value, without leading zeros.  The digits are produced two at a time
+// from a table of digit pairs.
+//
+///Floating-Point Format
+///- - - - - - - - - - -
+// A 'double' is written using the *shortest* sequence of significant digits
+// that converts back (using 'fromChars', or any correctly rounded parser such
+// as 'strtod') to exactly the same value; if several such sequences exist,
+// the one closest to the exact value is chosen.  The digits are computed
+// using the Ryu algorithm (Ulf Adams, "Ryu: Fast Float-to-String Conversion",
+// PLDI 2018), which needs neither big-integer arithmetic nor a retry loop.
+//
+// The digits are presented in fixed notation (e.g., "1234.5", "0.001",
+// "9223372036854776000") or in scientific notation with a signed exponent of
+// at least two digits (e.g., "1e+22", "1e-04", "1.5e-07"), whichever is
+// shorter, preferring fixed notation if both have the same length.  Note
+// that fixed notation pads the shortest digits with zeros, rather than
+// writing the exact integer value of a large 'double'.  Negative values,
+// including negative zero, are preceded by '-'.  Infinities are written as
+// "inf" or "-inf", and NaN values as "nan" or "-nan".
+//
+///Parsing
+///-------
+// 'fromChars' parses a number at the beginning of the range '[first, last)',
+// loads the value into '*result' and the address one past the last character
+// of the number into '*end', and returns 0.  The number must begin at
+// 'first': leading whitespace and a leading '+' are not accepted.  Parsing
+// stops at the first character that cannot extend the number, so the number
+// may be followed by arbitrary characters (e.g., a field separator).  If
+// 'first' does not begin with a number, 'BSLSTL_INVALID_INPUT' is returned
+// and '*end' is set to 'first'.  If the number is valid but its value cannot
+// be represented by the result type, 'BSLSTL_OUT_OF_RANGE' is returned and
+// '*end' is set past the number.  In both cases '*result' is not modified.
+//
+// Integers are parsed as an optional '-' (for signed types only) followed by
+// one or more decimal digits.  A 'double' is parsed as an optional '-',
+// followed by either a decimal significand with an optional exponent (e.g.,
+// "12", "1.5", ".5", "5.", "1e9", "2.5E-3"), or a case-insensitive "inf",
+// "infinity", or "nan".  The result is correctly rounded.  As with
+// 'std::from_chars', values too large to be represented, and nonzero values
+// so small that they round to zero (e.g., "1e-400"), are out of range;
+// values that round to a subnormal value are parsed as that value.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting and Parsing a Record
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we exchange quotes with a peer in a text protocol, as a
+// sequence of comma-separated fields.  First, we format a quote into a
+// 'bsl::string' by appending each field:
+//..
+//  bsl::string record;
+//  bslstl::CharConvUtil::appendChars(&record, 1234567);  // id
+//  record.push_back(',');
+//  bslstl::CharConvUtil::appendChars(&record, 101.25);   // price
+//  record.push_back(',');
+//  bslstl::CharConvUtil::appendChars(&record, -300);     // quantity
+//
+//  assert("1234567,101.25,-300" == record);
+//..
+// Note that the price is written with the fewest digits needed to recover
+// it exactly.  By contrast, 'snprintf' with "%g" writes 0.1 + 0.2 as "0.3",
+// which parses to a different 'double' than the sum:
+//..
+//  char  buffer[bslstl::CharConvUtil::BSLSTL_MAX_DOUBLE_LENGTH];
+//  char *end = bslstl::CharConvUtil::toChars(buffer,
+//                                            buffer + sizeof buffer,
+//                                            0.1 + 0.2);
+//  assert("0.30000000000000004" == bsl::string(buffer, end));
+//..
+// Then, we parse the record back, field by field, checking each separator:
+//..
+//  const char *next = record.data();
+//  const char *last = record.data() + record.size();
+//
+//  int    id;
+//  double price;
+//  int    quantity;
+//
+//  int rc = bslstl::CharConvUtil::fromChars(&id, &next, next, last);
+//  assert(0 == rc);
+//  assert(',' == *next);
+//
+//  rc = bslstl::CharConvUtil::fromChars(&price, &next, next + 1, last);
+//  assert(0 == rc);
+//  assert(',' == *next);
+//
+//  rc = bslstl::CharConvUtil::fromChars(&quantity, &next, next + 1, last);
+//  assert(0 == rc);
+//  assert(last == next);
+//
+//  assert(1234567 == id);
+//  assert(101.25  == price);
+//  assert(-300    == quantity);
+//..
+// Finally, we observe how errors are reported.  A field that does not begin
+// with a number is invalid, and a number that does not fit in the result
+// type is out of range:
+//..
+//  const char *text = "x12";
+//  rc = bslstl::CharConvUtil::fromChars(&id, &next, text, text + 3);
+//  assert(bslstl::CharConvUtil::BSLSTL_INVALID_INPUT == rc);
+//  assert(text == next);
+//
+//  text = "9999999999,";
+//  rc = bslstl::CharConvUtil::fromChars(&id, &next, text, text + 11);
+//  assert(bslstl::CharConvUtil::BSLSTL_OUT_OF_RANGE == rc);
+//  assert(text + 10 == next);
+//  assert(1234567 == id);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRING
+#include <bslstl_string.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                            // ===================
+                            // struct CharConvUtil
+                            // ===================
+
+struct CharConvUtil {
+    // This 'struct' provides a namespace for functions converting integers
+    // and 'double' values to and from decimal text without consulting the
+    // locale and without allocating memory.  See the component documentation
+    // for the formats written and accepted.
+
+    // TYPES
+    enum {
+        BSLSTL_MAX_INT_LENGTH    = 11,  // length of "-2147483648"
+
+        BSLSTL_MAX_INT64_LENGTH  = 20,  // length of "-9223372036854775808"
+                                        // and "18446744073709551615"
+
+        BSLSTL_MAX_DOUBLE_LENGTH = 24   // length of
+                                        // "-2.2250738585072014e-308"
+    };
+
+    enum {
+        BSLSTL_INVALID_INPUT = 1,  // the input does not begin with a number
+
+        BSLSTL_OUT_OF_RANGE  = 2   // the number is not representable by the
+                                   // result type
+    };
+
+    // CLASS METHODS
+    static char *toChars(char *first, char *last, int value);
+    static char *toChars(char *first, char *last, unsigned int value);
+    static char *toChars(char *first, char *last, long value);
+    static char *toChars(char *first, char *last, unsigned long value);
+    static char *toChars(char *first, char *last, bsls::Types::Int64 value);
+    static char *toChars(char *first, char *last, bsls::Types::Uint64 value);
+        // Write the decimal representation of the specified integer 'value'
+        // to the range starting at the specified 'first' and ending before
+        // the specified 'last'.  Return the address one past the last
+        // character written, or 0 if the range is too short to hold the
+        // representation, in which case the contents of the range are
+        // unspecified.  The behavior is undefined unless 'first <= last'.
+        // Note that a range of 'BSLSTL_MAX_INT64_LENGTH' characters is
+        // sufficient for any integer.
+
+    static char *toChars(char *first, char *last, double value);
+        // Write the shortest decimal representation of the specified 'value'
+        // that parses back to 'value' to the range starting at the specified
+        // 'first' and ending before the specified 'last', using fixed or
+        // scientific notation (whichever is shorter) as described in the
+        // component documentation.  Return the address one past the last
+        // character written, or 0 if the range is too short to hold the
+        // representation, in which case the contents of the range are
+        // unspecified.  The behavior is undefined unless 'first <= last'.
+        // Note that a range of 'BSLSTL_MAX_DOUBLE_LENGTH' characters is
+        // sufficient for any 'double'.
+
+    template <class NUMERIC_TYPE>
+    static void appendChars(bsl::string *result, NUMERIC_TYPE value);
+        // Append to the specified 'result' the decimal representation of the
+        // specified 'value', as written by 'toChars'.  'NUMERIC_TYPE' shall be
+        // an integral type or 'double'.
+
+    static int fromChars(int                 *result,
+                         const char         **end,
+                         const char          *first,
+                         const char          *last);
+    static int fromChars(unsigned int        *result,
+                         const char         **end,
+                         const char          *first,
+                         const char          *last);
+    static int fromChars(bsls::Types::Int64  *result,
+                         const char         **end,
+                         const char          *first,
+                         const char          *last);
+    static int fromChars(bsls::Types::Uint64 *result,
+                         const char         **end,
+                         const char          *first,
+                         const char          *last);
+    static int fromChars(double              *result,
+                         const char         **end,
+                         const char          *first,
+                         const char          *last);
+        // Parse the number at the beginning of the range starting at the
+        // specified 'first' and ending before the specified 'last', load its
+        // value into the specified 'result', load into the specified 'end'
+        // the address one past the last character of the number, and return
+        // 0.  Return 'BSLSTL_INVALID_INPUT', and load 'first' into 'end', if
+        // the range does not begin with a number; return
+        // 'BSLSTL_OUT_OF_RANGE', and load into 'end' the address one past the
+        // number, if the value of the number cannot be represented by the
+        // type of 'result'.  'result' is not modified unless 0 is returned.
+        // The behavior is undefined unless 'first <= last'.  See the component
+        // documentation for the accepted formats.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct CharConvUtil
+                            // -------------------
+
+// CLASS METHODS
+template <class NUMERIC_TYPE>
+inline
+void CharConvUtil::appendChars(bsl::string *result, NUMERIC_TYPE value)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    char        buffer[BSLSTL_MAX_DOUBLE_LENGTH];
+    const char *end = toChars(buffer, buffer + sizeof buffer, value);
+
+    result->append(buffer, end - buffer);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1480 @@
+// bslstl_charconvutil.t.cpp                                         -*-C++-*-
+#include <bslstl_charconvutil.h>
+
+#include <bslstl_istringstream.h>
+#include <bslstl_ostringstream.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a utility 'struct' of pure functions.
+// Formatting is verified against explicitly tabulated results for boundary
+// values, and, for 'double', against the C library for large numbers of
+// pseudo-random values: every result must parse back (with 'strtod') to the
+// original value, and must have no more significant digits than the shortest
+// "%.*e" representation that does so.  Parsing is verified against tabulated
+// results, including every error condition, and against 'strtod' for the
+// same pseudo-random values, in both their shortest and their 17-digit
+// representations.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] char *toChars(char *first, char *last, int value);
+// [ 2] char *toChars(char *first, char *last, unsigned int value);
+// [ 2] char *toChars(char *first, char *last, long value);
+// [ 2] char *toChars(char *first, char *last, unsigned long value);
+// [ 2] char *toChars(char *first, char *last, Int64 value);
+// [ 2] char *toChars(char *first, char *last, Uint64 value);
+// [ 3] char *toChars(char *first, char *last, double value);
+// [ 4] void appendChars(bsl::string *result, NUMERIC_TYPE value);
+// [ 5] int fromChars(int *, const char **, const char *, const char *);
+// [ 5] int fromChars(unsigned *, const char **, const char *, const char *);
+// [ 5] int fromChars(Int64 *, const char **, const char *, const char *);
+// [ 5] int fromChars(Uint64 *, const char **, const char *, const char *);
+// [ 6] int fromChars(double *, const char **, const char *, const char *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: FORMATTING
+// [-2] PERFORMANCE TEST: PARSING
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::CharConvUtil Util;
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::Uint64  Uint64;
+
+enum {
+    INVALID      = Util::BSLSTL_INVALID_INPUT,
+    OUT_OF_RANGE = Util::BSLSTL_OUT_OF_RANGE
+};
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next value of a 64-bit pseudo-random sequence having the
+    // specified 'state', and update 'state'.
+{
+    // 'xorshift64*'
+
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+double doubleFromBits(Uint64 bits)
+    // Return the 'double' having the specified representation 'bits'.
+{
+    double result;
+    memcpy(&result, &bits, sizeof result);
+    return result;
+}
+
+Uint64 bitsFromDouble(double value)
+    // Return the representation of the specified 'value'.
+{
+    Uint64 result;
+    memcpy(&result, &value, sizeof result);
+    return result;
+}
+
+template <class TYPE>
+bsl::string format(TYPE value)
+    // Return the result of 'Util::toChars' for the specified 'value', written
+    // to a range of exactly the advertised maximum length.
+{
+    char  buffer[Util::BSLSTL_MAX_DOUBLE_LENGTH];
+    char *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+    return end ? bsl::string(buffer, end) : bsl::string("<null>");
+}
+
+int significantDigits(const char *text)
+    // Return the number of significant digits in the specified
+    // null-terminated finite number 'text', ignoring leading and trailing
+    // zeros.
+{
+    char        digits[32];
+    int         length = 0;
+    const char *p      = text;
+    for (; *p && 'e' != *p; ++p) {
+        if ('0' <= *p && *p <= '9' && (length || '0' != *p)) {
+            digits[length++] = *p;
+        }
+    }
+    while (length && '0' == digits[length - 1]) {
+        --length;
+    }
+    return length;
+}
+
+int shortestPrecision(double value)
+    // Return the smallest number of significant digits with which "%.*e"
+    // formats the specified non-zero finite 'value' such that 'strtod'
+    // parses the result back to 'value'.
+{
+    char buffer[64];
+    for (int precision = 1; precision < 17; ++precision) {
+        snprintf(buffer, sizeof buffer, "%.*e", precision - 1, value);
+        if (strtod(buffer, 0) == value) {
+            return precision;                                         // RETURN
+        }
+    }
+    return 17;
+}
+
+bool sameDouble(double lhs, double rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same
+    // representation, or are both NaN, and 'false' otherwise.
+{
+    return lhs != lhs ? rhs != rhs
+                      : bitsFromDouble(lhs) == bitsFromDouble(rhs);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    setbuf(stdout, NULL);    // Use unbuffered output.
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Example 1: Formatting and Parsing a Record
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we exchange quotes with a peer in a text protocol, as a
+// sequence of comma-separated fields.  First, we format a quote into a
+// 'bsl::string' by appending each field:
+//..
+    bsl::string record;
+    bslstl::CharConvUtil::appendChars(&record, 1234567);  // id
+    record.push_back(',');
+    bslstl::CharConvUtil::appendChars(&record, 101.25);   // price
+    record.push_back(',');
+    bslstl::CharConvUtil::appendChars(&record, -300);     // quantity
+
+    ASSERT("1234567,101.25,-300" == record);
+//..
+// Note that the price is written with the fewest digits needed to recover
+// it exactly.  By contrast, 'snprintf' with "%g" writes 0.1 + 0.2 as "0.3",
+// which parses to a different 'double' than the sum:
+//..
+    char  buffer[bslstl::CharConvUtil::BSLSTL_MAX_DOUBLE_LENGTH];
+    char *end = bslstl::CharConvUtil::toChars(buffer,
+                                              buffer + sizeof buffer,
+                                              0.1 + 0.2);
+    ASSERT("0.30000000000000004" == bsl::string(buffer, end));
+//..
+// Then, we parse the record back, field by field, checking each separator:
+//..
+    const char *next = record.data();
+    const char *last = record.data() + record.size();
+
+    int    id;
+    double price;
+    int    quantity;
+
+    int rc = bslstl::CharConvUtil::fromChars(&id, &next, next, last);
+    ASSERT(0 == rc);
+    ASSERT(',' == *next);
+
+    rc = bslstl::CharConvUtil::fromChars(&price, &next, next + 1, last);
+    ASSERT(0 == rc);
+    ASSERT(',' == *next);
+
+    rc = bslstl::CharConvUtil::fromChars(&quantity, &next, next + 1, last);
+    ASSERT(0 == rc);
+    ASSERT(last == next);
+
+    ASSERT(1234567 == id);
+    ASSERT(101.25  == price);
+    ASSERT(-300    == quantity);
+//..
+// Finally, we observe how errors are reported.  A field that does not begin
+// with a number is invalid, and a number that does not fit in the result
+// type is out of range:
+//..
+    const char *text = "x12";
+    rc = bslstl::CharConvUtil::fromChars(&id, &next, text, text + 3);
+    ASSERT(bslstl::CharConvUtil::BSLSTL_INVALID_INPUT == rc);
+    ASSERT(text == next);
+
+    text = "9999999999,";
+    rc = bslstl::CharConvUtil::fromChars(&id, &next, text, text + 11);
+    ASSERT(bslstl::CharConvUtil::BSLSTL_OUT_OF_RANGE == rc);
+    ASSERT(text + 10 == next);
+    ASSERT(1234567 == id);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // PARSING 'double'
+        //
+        // Concerns:
+        //: 1 Decimal significands with and without a fraction, with and
+        //:   without an exponent, and with leading and trailing zeros are
+        //:   parsed to the correctly rounded value.
+        //:
+        //: 2 An 'e' that is not followed by digits, a second '.', and any
+        //:   other character end the number.
+        //:
+        //: 3 "inf", "infinity", and "nan" are accepted in any case, with an
+        //:   optional '-'.
+        //:
+        //: 4 Input that does not begin with a number is invalid, and leaves
+        //:   the result unchanged.
+        //:
+        //: 5 Values too large for 'double', and nonzero values that round to
+        //:   zero, are out of range; values that round to a subnormal value
+        //:   are parsed as that value, and zero is parsed as zero whatever
+        //:   its exponent.
+        //:
+        //: 6 Values that require more than 19 significant digits, or that
+        //:   are halfway between two 'double' values, are correctly rounded.
+        //:
+        //: 7 The result agrees with 'strtod' for arbitrary values, in both
+        //:   their shortest and their 17-digit representations.
+        //:
+        //: 8 The text need not be null-terminated.
+        //:
+        //: 9 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of inputs that
+        //:   cover each concern, and verify the return code, the value, and
+        //:   the end position.  (C-1..6)
+        //:
+        //: 2 Format pseudo-random bit patterns with 'toChars' and with
+        //:   "%.17g", and verify that parsing each result with 'fromChars'
+        //:   and with 'strtod' gives the same value.  (C-7)
+        //:
+        //: 3 Parse a prefix of a longer string.  (C-8)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-9)
+        //
+        // Testing:
+        //   int fromChars(double *, const char **, const char *, const char*);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPARSING 'double'"
+                            "\n================\n");
+
+        const double INF       = DBL_MAX * 2;
+        const double DENORM    = DBL_MIN / 4503599627370496.0;
+        const double NAN_VALUE = doubleFromBits(0x7FF8000000000000ULL);
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_rc;
+            int         d_length;  // expected number of characters consumed
+            double      d_value;
+        } DATA[] = {
+            //LINE INPUT                       RC            LEN VALUE
+            //---- --------------------------- ------------  --- -----------
+            { L_,  "0",                        0,             1, 0.0        },
+            { L_,  "-0",                       0,             2, -0.0       },
+            { L_,  "1",                        0,             1, 1.0        },
+            { L_,  "-1",                       0,             2, -1.0       },
+            { L_,  "12.5",                     0,             4, 12.5       },
+            { L_,  ".5",                       0,             2, 0.5        },
+            { L_,  "5.",                       0,             2, 5.0        },
+            { L_,  "-.25",                     0,             4, -0.25      },
+            { L_,  "000123.4500",              0,            11, 123.45     },
+            { L_,  "1e9",                      0,             3, 1e9        },
+            { L_,  "1E9",                      0,             3, 1e9        },
+            { L_,  "2.5e-3",                   0,             6, 2.5e-3     },
+            { L_,  "2.5e+3",                   0,             6, 2.5e3      },
+            { L_,  "1e",                       0,             1, 1.0        },
+            { L_,  "1e+",                      0,             1, 1.0        },
+            { L_,  "1e-x",                     0,             1, 1.0        },
+            { L_,  "1.2.3",                    0,             3, 1.2        },
+            { L_,  "7,8",                      0,             1, 7.0        },
+            { L_,  "0.1",                      0,             3, 0.1        },
+            { L_,  "0.30000000000000004",      0,            19, 0.1 + 0.2  },
+            { L_,  "9007199254740993",         0,            16,
+                                                        9007199254740992.0 },
+            { L_,  "9007199254740993.0000001", 0,            24,
+                                                        9007199254740994.0 },
+            { L_,  "123456789012345678901234567890",
+                                               0,            30,
+                                                  1.2345678901234568e+29 },
+            { L_,  "1e22",                     0,             4, 1e22       },
+            { L_,  "1e23",                     0,             4, 1e23       },
+            { L_,  "1.7976931348623157e308",   0,            22, DBL_MAX    },
+            { L_,  "1.7976931348623159e308",   OUT_OF_RANGE, 22, 0.0        },
+            { L_,  "1e309",                    OUT_OF_RANGE,  5, 0.0        },
+            { L_,  "-1e99999999",              OUT_OF_RANGE, 11, 0.0        },
+            { L_,  "2.2250738585072014e-308",  0,            23, DBL_MIN    },
+            { L_,  "4.9406564584124654e-324",  0,            23, DENORM     },
+            { L_,  "5e-324",                   0,             6, DENORM     },
+            { L_,  "2.4703282292062328e-324",  0,            23, DENORM     },
+            { L_,  "2.4703282292062327e-324",  OUT_OF_RANGE, 23, 0.0        },
+            { L_,  "2e-324",                   OUT_OF_RANGE,  6, 0.0        },
+            { L_,  "1e-400",                   OUT_OF_RANGE,  6, 0.0        },
+            { L_,  "-1e-400",                  OUT_OF_RANGE,  7, 0.0        },
+            { L_,  "0.00001e-320",             OUT_OF_RANGE, 12, 0.0        },
+            { L_,  "1e-99999999",              OUT_OF_RANGE, 11, 0.0        },
+            { L_,  "0e99999999",               0,            10, 0.0        },
+            { L_,  "0.000e-400",               0,            10, 0.0        },
+            { L_,  "-0e-400",                  0,             7, -0.0       },
+            { L_,  "inf",                      0,             3, INF        },
+            { L_,  "-Inf",                     0,             4, -INF       },
+            { L_,  "INFINITY",                 0,             8, INF        },
+            { L_,  "infinit",                  0,             3, INF        },
+            { L_,  "NaN",                      0,             3, NAN_VALUE  },
+            { L_,  "",                         INVALID,       0, 0.0        },
+            { L_,  "-",                        INVALID,       0, 0.0        },
+            { L_,  ".",                        INVALID,       0, 0.0        },
+            { L_,  "-.e1",                     INVALID,       0, 0.0        },
+            { L_,  "+1",                       INVALID,       0, 0.0        },
+            { L_,  " 1",                       INVALID,       0, 0.0        },
+            { L_,  "e5",                       INVALID,       0, 0.0        },
+            { L_,  "in",                       INVALID,       0, 0.0        },
+            { L_,  "x",                        INVALID,       0, 0.0        },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int     LINE   = DATA[ti].d_line;
+            const char   *INPUT  = DATA[ti].d_input;
+            const int     RC     = DATA[ti].d_rc;
+            const int     LENGTH = DATA[ti].d_length;
+            const double  VALUE  = DATA[ti].d_value;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            const double  SENTINEL = 42.5;
+            double        result   = SENTINEL;
+            const char   *end      = 0;
+
+            const int rc = Util::fromChars(&result,
+                                           &end,
+                                           INPUT,
+                                           INPUT + strlen(INPUT));
+            ASSERTV(LINE, RC, rc, RC == rc);
+            ASSERTV(LINE, LENGTH, end - INPUT, INPUT + LENGTH == end);
+            if (0 == RC) {
+                ASSERTV(LINE, VALUE, result, sameDouble(VALUE, result));
+            }
+            else {
+                ASSERTV(LINE, result, SENTINEL == result);
+            }
+        }
+
+        if (verbose) printf("\tHalfway cases and long significands.\n");
+        {
+            // '2^53 + 1' is halfway between two 'double' values and rounds
+            // to even; any nonzero digit after it, however far away, rounds
+            // up.
+
+            bsl::string input("9007199254740993.");
+            input.append(800, '0');
+
+            double      result;
+            const char *end;
+            ASSERT(0 == Util::fromChars(&result,
+                                        &end,
+                                        input.data(),
+                                        input.data() + input.size()));
+            ASSERT(9007199254740992.0 == result);
+            ASSERT(input.data() + input.size() == end);
+
+            input.push_back('1');
+            ASSERT(0 == Util::fromChars(&result,
+                                        &end,
+                                        input.data(),
+                                        input.data() + input.size()));
+            ASSERT(9007199254740994.0 == result);
+
+            // The same, with the digits before the decimal point.
+
+            bsl::string integer("9007199254740993");
+            integer.append(800, '0');
+            integer.append("1e-801");
+            ASSERT(0 == Util::fromChars(&result,
+                                        &end,
+                                        integer.data(),
+                                        integer.data() + integer.size()));
+            ASSERT(9007199254740994.0 == result);
+            ASSERT(integer.data() + integer.size() == end);
+
+            // Many leading zeros.
+
+            bsl::string small("0.");
+            small.append(1000, '0');
+            small.append("1e1000");
+            ASSERT(0 == Util::fromChars(&result,
+                                        &end,
+                                        small.data(),
+                                        small.data() + small.size()));
+            ASSERT(0.1 == result);
+        }
+
+        if (verbose) printf("\tThe text need not be null-terminated.\n");
+        {
+            const char   *INPUT = "1.2345e67";
+            double        result;
+            const char   *end;
+            ASSERT(0 == Util::fromChars(&result, &end, INPUT, INPUT + 4));
+            ASSERT(1.23 == result);
+            ASSERT(INPUT + 4 == end);
+
+            ASSERT(0 == Util::fromChars(&result, &end, INPUT, INPUT + 7));
+            ASSERT(1.2345 == result);
+            ASSERT(INPUT + 6 == end);
+        }
+
+        if (verbose) printf("\tComparison with 'strtod'.\n");
+        {
+            Uint64    state     = 0x9E3779B97F4A7C15ULL;
+            const int NUM_TRIALS = 200000;
+            for (int i = 0; i < NUM_TRIALS; ++i) {
+                const double VALUE = doubleFromBits(nextRandom(&state));
+                if (VALUE != VALUE || VALUE - VALUE != 0) {
+                    continue;                                       // CONTINUE
+                }
+
+                char  buffer[64];
+                char *end = Util::toChars(buffer, buffer + sizeof buffer,
+                                          VALUE);
+                *end = '\0';
+
+                double      result;
+                const char *parseEnd;
+                ASSERTV(buffer, 0 == Util::fromChars(&result,
+                                                     &parseEnd,
+                                                     buffer,
+                                                     end));
+                ASSERTV(buffer, sameDouble(VALUE, result));
+                ASSERTV(buffer, sameDouble(strtod(buffer, 0), result));
+
+                const int length = snprintf(buffer, sizeof buffer, "%.17g",
+                                            VALUE);
+                ASSERTV(buffer, 0 == Util::fromChars(&result,
+                                                     &parseEnd,
+                                                     buffer,
+                                                     buffer + length));
+                ASSERTV(buffer, sameDouble(VALUE, result));
+
+                // Perturb the last digits to exercise inexact inputs.
+
+                snprintf(buffer, sizeof buffer, "%.20e", VALUE);
+                buffer[21] = static_cast<char>('0' + i % 10);
+                const double EXPECTED = strtod(buffer, 0);
+                ASSERTV(buffer, 0 == Util::fromChars(&result,
+                                                     &parseEnd,
+                                                     buffer,
+                                                     buffer + strlen(buffer)));
+                ASSERTV(buffer, sameDouble(EXPECTED, result));
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            const char *INPUT = "1.5";
+            double      result;
+            const char *end;
+
+            ASSERT_PASS(Util::fromChars(&result, &end, INPUT, INPUT + 3));
+            ASSERT_FAIL(Util::fromChars((double *)0, &end, INPUT, INPUT + 3));
+            ASSERT_FAIL(Util::fromChars(&result, 0, INPUT, INPUT + 3));
+            ASSERT_FAIL(Util::fromChars(&result, &end, INPUT + 3, INPUT));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PARSING INTEGERS
+        //
+        // Concerns:
+        //: 1 Decimal digits, preceded by '-' for signed types, are parsed to
+        //:   their value, including the minimum and maximum values of each
+        //:   type.
+        //:
+        //: 2 Parsing stops at the first character that is not a digit, and
+        //:   the text need not be null-terminated.
+        //:
+        //: 3 Input not beginning with a digit (or '-' and a digit, for signed
+        //:   types) is invalid, and sets 'end' to 'first'.
+        //:
+        //: 4 A value outside the range of the type is out of range, and sets
+        //:   'end' past all of its digits.
+        //:
+        //: 5 The result is unchanged unless 0 is returned.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of inputs into each
+        //:   of the four result types, and verify the return code, the value,
+        //:   and the end position.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-6)
+        //
+        // Testing:
+        //   int fromChars(int *, const char **, const char *, const char *);
+        //   int fromChars(unsigned *, const char **, const char*, const char*);
+        //   int fromChars(Int64 *, const char **, const char *, const char *);
+        //   int fromChars(Uint64 *, const char **, const char *, const char*);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPARSING INTEGERS"
+                            "\n================\n");
+
+        // In each row, 'RC' and 'LEN' give the expected return code and
+        // number of characters consumed for 'int', 'unsigned', 'Int64', and
+        // 'Uint64', in that order; 'VALUE' is the expected value as an
+        // 'Int64' (or, for the last row, a 'Uint64').
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_rc[4];
+            int         d_length[4];
+            Int64       d_value;
+        } DATA[] = {
+      //LINE INPUT                   RC            LEN            VALUE
+      //---- ----------------------- ------------- -------------- ------------
+      { L_,  "0",                    { 0, 0, 0, 0 }, { 1, 1, 1, 1 }, 0       },
+      { L_,  "7",                    { 0, 0, 0, 0 }, { 1, 1, 1, 1 }, 7       },
+      { L_,  "-7",                   { 0, 1, 0, 1 }, { 2, 0, 2, 0 }, -7      },
+      { L_,  "-0",                   { 0, 1, 0, 1 }, { 2, 0, 2, 0 }, 0       },
+      { L_,  "00042x",               { 0, 0, 0, 0 }, { 5, 5, 5, 5 }, 42      },
+      { L_,  "12,34",                { 0, 0, 0, 0 }, { 2, 2, 2, 2 }, 12      },
+      { L_,  "2147483647",           { 0, 0, 0, 0 }, {10,10,10,10 },
+                                                                  2147483647 },
+      { L_,  "2147483648",           { 2, 0, 0, 0 }, {10,10,10,10 },
+                                                                 2147483648LL},
+      { L_,  "-2147483648",          { 0, 1, 0, 1 }, {11, 0,11, 0 },
+                                                                -2147483648LL},
+      { L_,  "-2147483649",          { 2, 1, 0, 1 }, {11, 0,11, 0 },
+                                                                -2147483649LL},
+      { L_,  "4294967295",           { 2, 0, 0, 0 }, {10,10,10,10 },
+                                                                 4294967295LL},
+      { L_,  "4294967296",           { 2, 2, 0, 0 }, {10,10,10,10 },
+                                                                 4294967296LL},
+      { L_,  "99999999999999999999", { 2, 2, 2, 2 }, {20,20,20,20 }, 0       },
+      { L_,  "9223372036854775807",  { 2, 2, 0, 0 }, {19,19,19,19 },
+                                                       9223372036854775807LL },
+      { L_,  "-9223372036854775808", { 2, 1, 0, 1 }, {20, 0,20, 0 },
+                                               -9223372036854775807LL - 1 },
+      { L_,  "-9223372036854775809", { 2, 1, 2, 1 }, {20, 0,20, 0 }, 0       },
+      { L_,  "",                     { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, 0       },
+      { L_,  "-",                    { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, 0       },
+      { L_,  "+1",                   { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, 0       },
+      { L_,  " 1",                   { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, 0       },
+      { L_,  "x1",                   { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, 0       },
+      { L_,  "--1",                  { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, 0       },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE   = DATA[ti].d_line;
+            const char  *INPUT  = DATA[ti].d_input;
+            const int   *RC     = DATA[ti].d_rc;
+            const int   *LENGTH = DATA[ti].d_length;
+            const Int64  VALUE  = DATA[ti].d_value;
+            const char  *LAST   = INPUT + strlen(INPUT);
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            const char *end;
+            int         rc;
+
+            int iResult = 99;
+            rc = Util::fromChars(&iResult, &end, INPUT, LAST);
+            ASSERTV(LINE, RC[0], rc, RC[0] == rc);
+            ASSERTV(LINE, LENGTH[0] == end - INPUT);
+            ASSERTV(LINE, iResult, (rc ? 99 : VALUE) == iResult);
+
+            unsigned int uResult = 99;
+            rc = Util::fromChars(&uResult, &end, INPUT, LAST);
+            ASSERTV(LINE, RC[1], rc, RC[1] == rc);
+            ASSERTV(LINE, LENGTH[1] == end - INPUT);
+            ASSERTV(LINE, uResult, (rc ? 99 : VALUE) == uResult);
+
+            Int64 i64Result = 99;
+            rc = Util::fromChars(&i64Result, &end, INPUT, LAST);
+            ASSERTV(LINE, RC[2], rc, RC[2] == rc);
+            ASSERTV(LINE, LENGTH[2] == end - INPUT);
+            ASSERTV(LINE, i64Result, (rc ? 99 : VALUE) == i64Result);
+
+            Uint64 u64Result = 99;
+            rc = Util::fromChars(&u64Result, &end, INPUT, LAST);
+            ASSERTV(LINE, RC[3], rc, RC[3] == rc);
+            ASSERTV(LINE, LENGTH[3] == end - INPUT);
+            ASSERTV(LINE, u64Result,
+                    (rc ? 99 : static_cast<Uint64>(VALUE)) == u64Result);
+        }
+
+        if (verbose) printf("\tThe full range of 'Uint64'.\n");
+        {
+            const char  *INPUT = "18446744073709551615";
+            Uint64       result;
+            const char  *end;
+
+            ASSERT(0 == Util::fromChars(&result, &end, INPUT, INPUT + 20));
+            ASSERT(~0ULL == result);
+            ASSERT(INPUT + 20 == end);
+
+            const char *TOO_LARGE = "18446744073709551616";
+            ASSERT(OUT_OF_RANGE == Util::fromChars(&result,
+                                                   &end,
+                                                   TOO_LARGE,
+                                                   TOO_LARGE + 20));
+            ASSERT(~0ULL == result);
+            ASSERT(TOO_LARGE + 20 == end);
+        }
+
+        if (verbose) printf("\tRound trip of pseudo-random values.\n");
+        {
+            Uint64 state = 12345;
+            for (int i = 0; i < 100000; ++i) {
+                const Uint64 BITS   = nextRandom(&state) >> (i % 64);
+                const Int64  SVALUE = static_cast<Int64>(BITS);
+
+                char        buffer[Util::BSLSTL_MAX_INT64_LENGTH];
+                const char *end = Util::toChars(buffer, buffer + 20, BITS);
+
+                Uint64      u64Result;
+                const char *parseEnd;
+                ASSERT(0 == Util::fromChars(&u64Result, &parseEnd, buffer,
+                                            end));
+                ASSERT(BITS == u64Result);
+                ASSERT(end == parseEnd);
+
+                end = Util::toChars(buffer, buffer + 20, SVALUE);
+
+                Int64 i64Result;
+                ASSERT(0 == Util::fromChars(&i64Result, &parseEnd, buffer,
+                                            end));
+                ASSERT(SVALUE == i64Result);
+                ASSERT(end == parseEnd);
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            const char *INPUT = "15";
+            int         result;
+            const char *end;
+
+            ASSERT_PASS(Util::fromChars(&result, &end, INPUT, INPUT + 2));
+            ASSERT_FAIL(Util::fromChars((int *)0, &end, INPUT, INPUT + 2));
+            ASSERT_FAIL(Util::fromChars(&result, 0, INPUT, INPUT + 2));
+            ASSERT_FAIL(Util::fromChars(&result, &end, INPUT + 2, INPUT));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'appendChars'
+        //
+        // Concerns:
+        //: 1 The representation written by 'toChars' is appended, for each
+        //:   supported type.
+        //:
+        //: 2 The existing contents of the string are preserved.
+        //:
+        //: 3 Memory is allocated only from the string's allocator, and not
+        //:   at all if the string has sufficient capacity.
+        //
+        // Plan:
+        //: 1 Append values of each type to a string with a test allocator,
+        //:   having installed a different default allocator, and verify the
+        //:   contents and the allocations.  (C-1..3)
+        //
+        // Testing:
+        //   void appendChars(bsl::string *result, NUMERIC_TYPE value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'appendChars'"
+                            "\n=============\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bsl::string mX("x=", &sa);
+        const bsl::string& X = mX;
+        mX.reserve(200);
+
+        const Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+        Util::appendChars(&mX, 'A');
+        Util::appendChars(&mX, static_cast<short>(-5));
+        Util::appendChars(&mX, INT_MIN);
+        Util::appendChars(&mX, UINT_MAX);
+        Util::appendChars(&mX, -1L);
+        Util::appendChars(&mX, 2UL);
+        Util::appendChars(&mX, -9223372036854775807LL - 1);
+        Util::appendChars(&mX, 18446744073709551615ULL);
+        Util::appendChars(&mX, -2.2250738585072014e-308);
+        Util::appendChars(&mX, 0.5);
+
+        ASSERTV(X.c_str(), "x=65-5-21474836484294967295-12"
+                           "-922337203685477580818446744073709551615"
+                           "-2.2250738585072014e-3080.5" == X);
+
+        ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FORMATTING 'double'
+        //
+        // Concerns:
+        //: 1 Values are written with the shortest significand that parses
+        //:   back to the same value, choosing the closest such significand.
+        //:
+        //: 2 Fixed notation is used unless scientific notation is shorter,
+        //:   and scientific notation has a signed exponent of at least two
+        //:   digits.
+        //:
+        //: 3 Zero, negative zero, infinities, NaN, subnormal values, and the
+        //:   extreme values are written correctly.
+        //:
+        //: 4 A range of 'BSLSTL_MAX_DOUBLE_LENGTH' characters is sufficient
+        //:   for any value, and 0 is returned if the range is too short.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format a set of values and
+        //:   compare the result with the expected text, then repeat with a
+        //:   range that is one character too short.  (C-2..4)
+        //:
+        //: 2 Format pseudo-random bit patterns, and pseudo-random short
+        //:   decimal values, and verify that the result parses back to the
+        //:   value using 'strtod' and has no more significant digits than the
+        //:   shortest "%.*e" representation that does.  (C-1, 4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFORMATTING 'double'"
+                            "\n===================\n");
+
+        const double INF      = DBL_MAX * 2;
+        const double DENORM   = DBL_MIN / 4503599627370496.0;
+
+        static const struct {
+            int         d_line;
+            Uint64      d_bits;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  BITS                     EXPECTED
+            //----  -----------------------  ---------------------------
+            { L_,   0x0000000000000000ULL,   "0"                         },
+            { L_,   0x8000000000000000ULL,   "-0"                        },
+            { L_,   0x7FF0000000000000ULL,   "inf"                       },
+            { L_,   0xFFF0000000000000ULL,   "-inf"                      },
+            { L_,   0x7FF8000000000000ULL,   "nan"                       },
+            { L_,   0xFFF8000000000000ULL,   "-nan"                      },
+            { L_,   0x7FF0000000000001ULL,   "nan"                       },
+            { L_,   0x3FF0000000000000ULL,   "1"                         },
+            { L_,   0xBFF0000000000000ULL,   "-1"                        },
+            { L_,   0x4059000000000000ULL,   "100"                       },
+            { L_,   0x3FB999999999999AULL,   "0.1"                       },
+            { L_,   0x3FD3333333333334ULL,   "0.30000000000000004"       },
+            { L_,   0x3F50624DD2F1A9FCULL,   "0.001"                     },
+            { L_,   0x3EE4F8B588E368F1ULL,   "1e-05"                     },
+            { L_,   0x3F1A36E2EB1C432DULL,   "1e-04"                     },
+            { L_,   0x4415AF1D78B58C40ULL,   "1e+20"                     },
+            { L_,   0x444B1AE4D6E2EF50ULL,   "1e+21"                     },
+            { L_,   0x4480F0CF064DD592ULL,   "1e+22"                     },
+            { L_,   0x44B52D02C7E14AF6ULL,   "1e+23"                     },
+            { L_,   0x4340000000000000ULL,   "9007199254740992"          },
+            { L_,   0x3FF0000000000001ULL,   "1.0000000000000002"        },
+            { L_,   0x4029000000000000ULL,   "12.5"                      },
+            { L_,   0x40934A0000000000ULL,   "1234.5"                    },
+            { L_,   0x3F4A36E2EB1C432DULL,   "8e-04"                     },
+            { L_,   0x3E7AD7F29ABCAF48ULL,   "1e-07"                     },
+            { L_,   0x3E7E7FE82DA96E11ULL,   "1.1362e-07"                },
+            { L_,   0x7FEFFFFFFFFFFFFFULL,   "1.7976931348623157e+308"   },
+            { L_,   0xFFEFFFFFFFFFFFFFULL,   "-1.7976931348623157e+308"  },
+            { L_,   0x0010000000000000ULL,   "2.2250738585072014e-308"   },
+            { L_,   0x8010000000000000ULL,   "-2.2250738585072014e-308"  },
+            { L_,   0x000FFFFFFFFFFFFFULL,   "2.225073858507201e-308"    },
+            { L_,   0x0000000000000001ULL,   "5e-324"                    },
+            { L_,   0x8000000000000001ULL,   "-5e-324"                   },
+            { L_,   0x0000000000000002ULL,   "1e-323"                    },
+            { L_,   0x4330000000000000ULL,   "4503599627370496"          },
+            { L_,   0x43E0000000000000ULL,   "9223372036854776000"       },
+            { L_,   0x4415AF1D78B58C3FULL,   "99999999999999980000"      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        ASSERT(1 == doubleFromBits(0x3FF0000000000000ULL));
+        ASSERT(INF == doubleFromBits(0x7FF0000000000000ULL));
+        ASSERT(DENORM == doubleFromBits(1));
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int     LINE     = DATA[ti].d_line;
+            const double  VALUE    = doubleFromBits(DATA[ti].d_bits);
+            const char   *EXPECTED = DATA[ti].d_expected;
+            const int     LENGTH   = static_cast<int>(strlen(EXPECTED));
+
+            if (veryVerbose) { T_ P_(LINE) P(EXPECTED) }
+
+            ASSERTV(LINE, EXPECTED, format(VALUE).c_str(),
+                    EXPECTED == format(VALUE));
+
+            char  buffer[Util::BSLSTL_MAX_DOUBLE_LENGTH];
+            char *end = Util::toChars(buffer, buffer + LENGTH, VALUE);
+            ASSERTV(LINE, buffer + LENGTH == end);
+            ASSERTV(LINE, 0 == memcmp(buffer, EXPECTED, LENGTH));
+
+            end = Util::toChars(buffer, buffer + LENGTH - 1, VALUE);
+            ASSERTV(LINE, 0 == end);
+        }
+
+        if (verbose) printf("\tShortest representation of random values.\n");
+        {
+            Uint64    state      = 0x2545F4914F6CDD1DULL;
+            const int NUM_TRIALS = 100000;
+            for (int i = 0; i < NUM_TRIALS; ++i) {
+                double value;
+                if (i % 2) {
+                    value = doubleFromBits(nextRandom(&state));
+                }
+                else {
+                    // A short decimal value, such as a price.
+
+                    const Uint64 r        = nextRandom(&state);
+                    const int    exponent = static_cast<int>(r % 41) - 20;
+                    value = static_cast<double>(r >> 44)
+                          * pow(10.0, exponent);
+                }
+                if (value != value || value - value != 0 || 0 == value) {
+                    continue;                                       // CONTINUE
+                }
+
+                char  buffer[Util::BSLSTL_MAX_DOUBLE_LENGTH + 1];
+                char *end = Util::toChars(buffer,
+                                          buffer + sizeof buffer - 1,
+                                          value);
+                ASSERT(0 != end);
+                *end = '\0';
+
+                ASSERTV(buffer, value == strtod(buffer, 0));
+                ASSERTV(buffer,
+                        end - buffer <= Util::BSLSTL_MAX_DOUBLE_LENGTH);
+
+                const int DIGITS   = significantDigits(buffer);
+                const int SHORTEST = shortestPrecision(value);
+                ASSERTV(buffer, DIGITS, SHORTEST, DIGITS <= SHORTEST);
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            char buffer[Util::BSLSTL_MAX_DOUBLE_LENGTH];
+
+            ASSERT_PASS(Util::toChars(buffer, buffer, 1.5));
+            ASSERT_FAIL(Util::toChars(buffer + 1, buffer, 1.5));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FORMATTING INTEGERS
+        //
+        // Concerns:
+        //: 1 Integers are written as an optional '-' followed by their
+        //:   digits, without leading zeros, for each supported type,
+        //:   including the minimum and maximum values of each type.
+        //:
+        //: 2 The result is written only if the range is long enough, and the
+        //:   'BSLSTL_MAX_*_LENGTH' constants are sufficient.
+        //:
+        //: 3 Values of every number of digits are written correctly.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format a set of boundary values
+        //:   using the 'Int64' and 'Uint64' overloads and, where the value
+        //:   fits, the 'int', 'unsigned', 'long', and 'unsigned long'
+        //:   overloads, into a range of exactly the expected length and one
+        //:   character shorter.  (C-1..2)
+        //:
+        //: 2 Format every power of ten, and its neighbors, and compare with
+        //:   'snprintf'.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, int value);
+        //   char *toChars(char *first, char *last, unsigned int value);
+        //   char *toChars(char *first, char *last, long value);
+        //   char *toChars(char *first, char *last, unsigned long value);
+        //   char *toChars(char *first, char *last, Int64 value);
+        //   char *toChars(char *first, char *last, Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFORMATTING INTEGERS"
+                            "\n===================\n");
+
+        const native_std::size_t INT_LENGTH   = Util::BSLSTL_MAX_INT_LENGTH;
+        const native_std::size_t INT64_LENGTH = Util::BSLSTL_MAX_INT64_LENGTH;
+
+        ASSERT(INT_LENGTH   == strlen("-2147483648"));
+        ASSERT(INT64_LENGTH == strlen("-9223372036854775808"));
+        ASSERT(INT64_LENGTH == strlen("18446744073709551615"));
+
+        static const struct {
+            int         d_line;
+            Int64       d_value;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE                         EXPECTED
+            //----  ----------------------------  -----------------------
+            { L_,   0,                            "0"                    },
+            { L_,   1,                            "1"                    },
+            { L_,   -1,                           "-1"                   },
+            { L_,   9,                            "9"                    },
+            { L_,   10,                           "10"                   },
+            { L_,   -10,                          "-10"                  },
+            { L_,   99,                           "99"                   },
+            { L_,   100,                          "100"                  },
+            { L_,   12345,                        "12345"                },
+            { L_,   -123456,                      "-123456"              },
+            { L_,   2147483647,                   "2147483647"           },
+            { L_,   -2147483647 - 1,              "-2147483648"          },
+            { L_,   2147483648LL,                 "2147483648"           },
+            { L_,   4294967295LL,                 "4294967295"           },
+            { L_,   4294967296LL,                 "4294967296"           },
+            { L_,   -4294967296LL,                "-4294967296"          },
+            { L_,   1000000000000000000LL,        "1000000000000000000"  },
+            { L_,   9223372036854775807LL,        "9223372036854775807"  },
+            { L_,   -9223372036854775807LL - 1,   "-9223372036854775808" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE     = DATA[ti].d_line;
+            const Int64  VALUE    = DATA[ti].d_value;
+            const char  *EXPECTED = DATA[ti].d_expected;
+            const int    LENGTH   = static_cast<int>(strlen(EXPECTED));
+
+            if (veryVerbose) { T_ P_(LINE) P(EXPECTED) }
+
+            char  buffer[Util::BSLSTL_MAX_INT64_LENGTH];
+            char *end;
+
+            end = Util::toChars(buffer, buffer + LENGTH, VALUE);
+            ASSERTV(LINE, buffer + LENGTH == end);
+            ASSERTV(LINE, 0 == memcmp(buffer, EXPECTED, LENGTH));
+            ASSERTV(LINE, 0 == Util::toChars(buffer, buffer + LENGTH - 1,
+                                             VALUE));
+
+            if (VALUE == static_cast<long>(VALUE)) {
+                const long LVALUE = static_cast<long>(VALUE);
+
+                end = Util::toChars(buffer, buffer + LENGTH, LVALUE);
+                ASSERTV(LINE, buffer + LENGTH == end);
+                ASSERTV(LINE, 0 == memcmp(buffer, EXPECTED, LENGTH));
+                ASSERTV(LINE, 0 == Util::toChars(buffer, buffer + LENGTH - 1,
+                                                 LVALUE));
+            }
+
+            if (VALUE == static_cast<int>(VALUE)) {
+                const int IVALUE = static_cast<int>(VALUE);
+
+                end = Util::toChars(buffer, buffer + LENGTH, IVALUE);
+                ASSERTV(LINE, buffer + LENGTH == end);
+                ASSERTV(LINE, 0 == memcmp(buffer, EXPECTED, LENGTH));
+                ASSERTV(LINE, 0 == Util::toChars(buffer, buffer + LENGTH - 1,
+                                                 IVALUE));
+            }
+
+            if (VALUE < 0) {
+                continue;                                           // CONTINUE
+            }
+
+            const Uint64 UVALUE = static_cast<Uint64>(VALUE);
+
+            end = Util::toChars(buffer, buffer + LENGTH, UVALUE);
+            ASSERTV(LINE, buffer + LENGTH == end);
+            ASSERTV(LINE, 0 == memcmp(buffer, EXPECTED, LENGTH));
+            ASSERTV(LINE, 0 == Util::toChars(buffer, buffer + LENGTH - 1,
+                                             UVALUE));
+
+            if (UVALUE == static_cast<unsigned long>(UVALUE)) {
+                const unsigned long ULVALUE =
+                                           static_cast<unsigned long>(UVALUE);
+
+                end = Util::toChars(buffer, buffer + LENGTH, ULVALUE);
+                ASSERTV(LINE, buffer + LENGTH == end);
+                ASSERTV(LINE, 0 == memcmp(buffer, EXPECTED, LENGTH));
+            }
+
+            if (UVALUE == static_cast<unsigned int>(UVALUE)) {
+                const unsigned int UIVALUE = static_cast<unsigned int>(UVALUE);
+
+                end = Util::toChars(buffer, buffer + LENGTH, UIVALUE);
+                ASSERTV(LINE, buffer + LENGTH == end);
+                ASSERTV(LINE, 0 == memcmp(buffer, EXPECTED, LENGTH));
+            }
+        }
+
+        if (verbose) printf("\tMaximum unsigned values.\n");
+        {
+            ASSERT("4294967295" == format(UINT_MAX));
+            ASSERT("18446744073709551615" == format(~0ULL));
+            ASSERT("-1" == format(-1L));
+        }
+
+        if (verbose) printf("\tPowers of ten and their neighbors.\n");
+        {
+            Uint64 power = 1;
+            for (int i = 0; i < 20; ++i, power *= 10) {
+                for (int delta = -1; delta <= 1; ++delta) {
+                    const Uint64 VALUE = power + delta;
+
+                    char expected[32];
+                    snprintf(expected, sizeof expected, "%llu", VALUE);
+                    ASSERTV(i, delta, expected == format(VALUE));
+
+                    const Int64 SVALUE = -static_cast<Int64>(VALUE >> 1);
+                    snprintf(expected, sizeof expected, "%lld", SVALUE);
+                    ASSERTV(i, delta, expected == format(SVALUE));
+                }
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            char buffer[Util::BSLSTL_MAX_INT64_LENGTH];
+
+            ASSERT_PASS(Util::toChars(buffer, buffer, 1));
+            ASSERT_FAIL(Util::toChars(buffer + 1, buffer, 1));
+            ASSERT_FAIL(Util::toChars(buffer + 1, buffer, 1u));
+            ASSERT_FAIL(Util::toChars(buffer + 1, buffer, 1LL));
+            ASSERT_FAIL(Util::toChars(buffer + 1, buffer, 1ULL));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format and parse a few values of each type.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT("42"     == format(42));
+        ASSERT("-42"    == format(-42LL));
+        ASSERT("2.5"    == format(2.5));
+        ASSERT("1e+100" == format(1e100));
+
+        const char *TEXT = "-17 3.25e2";
+        const char *end;
+
+        int i;
+        ASSERT(0 == Util::fromChars(&i, &end, TEXT, TEXT + 10));
+        ASSERT(-17 == i);
+        ASSERT(TEXT + 3 == end);
+
+        double d;
+        ASSERT(0 == Util::fromChars(&d, &end, end + 1, TEXT + 10));
+        ASSERT(325 == d);
+        ASSERT(TEXT + 10 == end);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: FORMATTING
+        //
+        // Concerns:
+        //: 1 Report the cost of formatting integers and 'double' values with
+        //:   'appendChars', compared with 'bsl::ostringstream' and 'snprintf'.
+        //
+        // Plan:
+        //: 1 Format the same values, appending each to a reused string, with
+        //:   each approach, and print the time per value.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: FORMATTING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: FORMATTING"
+                            "\n============================\n");
+
+        const int NUM_VALUES = 1000000;
+
+        bsl::vector<Int64>  integers;
+        bsl::vector<double> doubles;
+        integers.reserve(NUM_VALUES);
+        doubles.reserve(NUM_VALUES);
+
+        Uint64 state = 42;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64 r = nextRandom(&state);
+            integers.push_back(static_cast<Int64>(r >> (r % 56)));
+            doubles.push_back(static_cast<double>(r >> 40) / 100.0);
+        }
+
+        bsl::string     out;
+        bsls::Stopwatch timer;
+        Uint64          checksum = 0;
+
+        for (int kind = 0; kind < 2; ++kind) {
+            const bool INTEGERS = 0 == kind;
+
+            printf("%s:\n", INTEGERS ? "Int64" : "double (prices)");
+
+            out.reserve(32);
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                out.clear();
+                if (INTEGERS) {
+                    Util::appendChars(&out, integers[i]);
+                }
+                else {
+                    Util::appendChars(&out, doubles[i]);
+                }
+                checksum += out.size();
+            }
+            timer.stop();
+            printf("  appendChars       : %7.1f ns/value\n",
+                   timer.elapsedTime() * 1e9 / NUM_VALUES);
+
+            char buffer[32];
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                out.clear();
+                const int length = INTEGERS
+                       ? snprintf(buffer, sizeof buffer, "%lld", integers[i])
+                       : snprintf(buffer, sizeof buffer, "%.17g", doubles[i]);
+                out.append(buffer, length);
+                checksum += out.size();
+            }
+            timer.stop();
+            printf("  snprintf          : %7.1f ns/value\n",
+                   timer.elapsedTime() * 1e9 / NUM_VALUES);
+
+            bsl::ostringstream stream;
+            stream.precision(17);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                if (INTEGERS) {
+                    stream << integers[i];
+                }
+                else {
+                    stream << doubles[i];
+                }
+                stream.extract(&out);
+                checksum += out.size();
+            }
+            timer.stop();
+            printf("  bsl::ostringstream: %7.1f ns/value\n",
+                   timer.elapsedTime() * 1e9 / NUM_VALUES);
+        }
+
+        if (veryVerbose) P(checksum);
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: PARSING
+        //
+        // Concerns:
+        //: 1 Report the cost of parsing integers and 'double' values with
+        //:   'fromChars', compared with 'bsl::istringstream' and
+        //:   'strtoll'/'strtod'.
+        //
+        // Plan:
+        //: 1 Parse the same space-separated text with each approach and print
+        //:   the time per value.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: PARSING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: PARSING"
+                            "\n=========================\n");
+
+        const int NUM_VALUES = 1000000;
+
+        bsl::string integerText;
+        bsl::string doubleText;
+
+        Uint64 state = 42;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64 r = nextRandom(&state);
+            Util::appendChars(&integerText, static_cast<Int64>(r >> (r % 56)));
+            integerText.push_back(' ');
+            Util::appendChars(&doubleText,
+                              static_cast<double>(r >> 40) / 100.0);
+            doubleText.push_back(' ');
+        }
+
+        bsls::Stopwatch timer;
+        double          checksum = 0;
+
+        for (int kind = 0; kind < 2; ++kind) {
+            const bool         INTEGERS = 0 == kind;
+            const bsl::string& TEXT     = INTEGERS ? integerText : doubleText;
+
+            printf("%s:\n", INTEGERS ? "Int64" : "double (prices)");
+
+            timer.reset();
+            timer.start();
+            {
+                const char *p    = TEXT.data();
+                const char *last = TEXT.data() + TEXT.size();
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    if (INTEGERS) {
+                        Int64 value = 0;
+                        Util::fromChars(&value, &p, p, last);
+                        checksum += static_cast<double>(value);
+                    }
+                    else {
+                        double value = 0;
+                        Util::fromChars(&value, &p, p, last);
+                        checksum += value;
+                    }
+                    ++p;
+                }
+            }
+            timer.stop();
+            printf("  fromChars         : %7.1f ns/value\n",
+                   timer.elapsedTime() * 1e9 / NUM_VALUES);
+
+            timer.reset();
+            timer.start();
+            {
+                const char *p = TEXT.c_str();
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    char *end;
+                    if (INTEGERS) {
+                        checksum += static_cast<double>(strtoll(p, &end, 10));
+                    }
+                    else {
+                        checksum += strtod(p, &end);
+                    }
+                    p = end + 1;
+                }
+            }
+            timer.stop();
+            printf("  strtoll/strtod    : %7.1f ns/value\n",
+                   timer.elapsedTime() * 1e9 / NUM_VALUES);
+
+            bsl::istringstream stream(TEXT);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                if (INTEGERS) {
+                    Int64 value = 0;
+                    stream >> value;
+                    checksum += static_cast<double>(value);
+                }
+                else {
+                    double value = 0;
+                    stream >> value;
+                    checksum += value;
+                }
+            }
+            timer.stop();
+            printf("  bsl::istringstream: %7.1f ns/value\n",
+                   timer.elapsedTime() * 1e9 / NUM_VALUES);
+        }
+
+        if (veryVerbose) P(checksum);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
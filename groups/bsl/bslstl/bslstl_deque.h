@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslstl_Deque: standard-compliant 'bsl::deque' implementation
+//  bslstl::DequeBlockTraits: customization point for deque block management
 //
 //@SEE_ALSO: bslstl_vector, bsl+stlhdrs
 //
@@ -20,6 +21,35 @@ BSLS_IDENT("$Id: $")
 // 'bslma::Allocator' model and is suitable for use as an implementation of the
 // 'bsl::deque' class template.
 //
+///Block Configuration
+///-------------------
+// A deque stores its elements in fixed-size blocks.  By default, a block
+// holds 200 bytes worth of elements (and never fewer than 16 elements), and a
+// deque keeps one emptied block for reuse rather than returning it to the
+// allocator, so that a deque used as a FIFO queue (e.g., 'push_back' paired
+// with 'pop_front') makes no allocation once it has warmed up.  Both
+// quantities can be changed for a particular element type by specializing
+// 'bslstl::DequeBlockTraits' for that type.  For example, a message queue
+// holding a high volume of small messages may benefit from larger blocks and
+// a few more retained blocks:
+//..
+//  namespace BloombergLP {
+//  namespace bslstl {
+//
+//  template <>
+//  struct DequeBlockTraits<MyMessageHandle> {
+//      enum {
+//          BLOCK_SIZE      = 4096,
+//          MAX_FREE_BLOCKS = 4
+//      };
+//  };
+//
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// Such a specialization must be visible wherever a
+// 'bsl::deque<MyMessageHandle>' is instantiated.
+//
 ///Exceptional Behavior
 ///--------------------
 // Since this component is below the BSL STL, we centralize all the exceptional
@@ -256,6 +286,36 @@ BSL_OVERRIDES_STD mode"
 
 #endif
 
+namespace BloombergLP {
+namespace bslstl {
+
+                          // =======================
+                          // struct DequeBlockTraits
+                          // =======================
+
+template <class VALUE_TYPE>
+struct DequeBlockTraits {
+    // This 'struct' template specifies how a 'bsl::deque' of the
+    // (template parameter) 'VALUE_TYPE' manages its blocks.  It may be
+    // specialized for a particular 'VALUE_TYPE' to tune the deques of that
+    // type, e.g., to use larger blocks for a queue with a high message rate.
+    // A specialization must provide both enumerators and must be visible
+    // before any 'bsl::deque<VALUE_TYPE>' is instantiated.
+
+    // TYPES
+    enum {
+        BLOCK_SIZE      = 200,  // nominal number of bytes per block (a block
+                                // always holds at least 16 elements)
+
+        MAX_FREE_BLOCKS = 1     // maximum number of empty blocks a deque
+                                // retains for reuse rather than returning
+                                // them to its allocator
+    };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 namespace bsl {
 
 template <class VALUE_TYPE, class ALLOCATOR>
@@ -272,15 +332,21 @@ class Deque_Guard;
 template <class VALUE_TYPE>
 struct Deque_BlockLengthCalcUtil {
     // This 'struct' provides a namespace for the calculation of block length
-    // (the number of elements per block within a 'deque').  This ensures that
+    // (the number of elements per block within a 'deque') from the block size
+    // specified by 'bslstl::DequeBlockTraits<VALUE_TYPE>'.  This ensures that
     // each block in the deque can hold at least 16 elements.
 
     // TYPES
     enum {
-        DEFAULT_BLOCK_SIZE = 200,  // number of bytes per block
-        BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= DEFAULT_BLOCK_SIZE)
+        DEFAULT_BLOCK_SIZE = 200,  // default number of bytes per block
+
+        BLOCK_SIZE         = BloombergLP::bslstl::
+                                      DequeBlockTraits<VALUE_TYPE>::BLOCK_SIZE,
+                                   // number of bytes per block
+
+        BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= BLOCK_SIZE)
                              ? 16
-                             : (DEFAULT_BLOCK_SIZE / sizeof(VALUE_TYPE))
+                             : (BLOCK_SIZE / sizeof(VALUE_TYPE))
                                    // number of elements per block
     };
 };
@@ -539,6 +605,17 @@ class deque : public  Deque_Base<VALUE_TYPE>
         // Special type (and value) used to create a "raw" deque, which has 0
         // block length, and null start and finish pointers.
 
+    enum {
+        MAX_FREE_BLOCKS = BloombergLP::bslstl::
+                                 DequeBlockTraits<VALUE_TYPE>::MAX_FREE_BLOCKS
+    };
+
+    // DATA
+    Block       *d_freeBlocks_p;   // singly-linked list of empty blocks kept
+                                   // for reuse (owned)
+
+    std::size_t  d_numFreeBlocks;  // number of blocks in 'd_freeBlocks_p'
+
   public:
     // PUBLIC TYPES
     typedef typename ALLOCATOR::reference           reference;
@@ -579,6 +656,22 @@ class deque : public  Deque_Base<VALUE_TYPE>
         // provide an exception-safe repository for intermediate calculations.
 
     // PRIVATE MANIPULATORS
+    Block *allocateBlock();
+        // Return the address of an uninitialized block, taken from the list
+        // of free blocks of this deque if that list is not empty, and
+        // obtained from the allocator of this deque otherwise.
+
+    void deallocateBlock(Block *block);
+        // Add the specified 'block' to the list of free blocks of this deque
+        // if that list holds fewer than 'MAX_FREE_BLOCKS' blocks, and return
+        // 'block' to the allocator of this deque otherwise.  The behavior is
+        // undefined unless 'block' was obtained from 'allocateBlock' and
+        // holds no live elements.
+
+    void releaseFreeBlocks();
+        // Return every block in the list of free blocks of this deque to the
+        // allocator of this deque.
+
     template <class INPUT_ITER>
     size_type privateAppend(INPUT_ITER                     first,
                             INPUT_ITER                     last,
@@ -1369,11 +1462,56 @@ inline
 deque<VALUE_TYPE,ALLOCATOR>::deque(RawInit, const ALLOCATOR& allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
+, d_freeBlocks_p(0)
+, d_numFreeBlocks(0)
 {
     this->d_blocks = 0;
 }
 
 // PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename deque<VALUE_TYPE,ALLOCATOR>::Block *
+deque<VALUE_TYPE,ALLOCATOR>::allocateBlock()
+{
+    if (d_freeBlocks_p) {
+        Block *block    = d_freeBlocks_p;
+        d_freeBlocks_p  = *reinterpret_cast<Block **>(block);
+        --d_numFreeBlocks;
+        return block;                                                 // RETURN
+    }
+    return this->allocateN((Block *) 0, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void deque<VALUE_TYPE,ALLOCATOR>::deallocateBlock(Block *block)
+{
+    BSLS_ASSERT_SAFE(block);
+
+    if (d_numFreeBlocks < MAX_FREE_BLOCKS) {
+        // A block holds at least 16 elements, hence is large enough, and
+        // suitably aligned, to hold the link to the next free block.
+
+        *reinterpret_cast<Block **>(block) = d_freeBlocks_p;
+        d_freeBlocks_p = block;
+        ++d_numFreeBlocks;
+        return;                                                       // RETURN
+    }
+    this->deallocateN(block, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void deque<VALUE_TYPE,ALLOCATOR>::releaseFreeBlocks()
+{
+    while (d_freeBlocks_p) {
+        Block *block   = d_freeBlocks_p;
+        d_freeBlocks_p = *reinterpret_cast<Block **>(block);
+        this->deallocateN(block, 1);
+    }
+    d_numFreeBlocks = 0;
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITER>
 typename deque<VALUE_TYPE,ALLOCATOR>::size_type
@@ -1499,7 +1637,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateInit(size_type numElements)
     // little room at the front and back of the array for growth.
 
     BlockPtr *firstBlockPtr = &this->d_blocks[Imp::BLOCK_ARRAY_PADDING];
-    *firstBlockPtr = this->allocateN((Block*) 0, 1);
+    *firstBlockPtr = allocateBlock();
 
     // Calculate the offset into the first block such that 'n' elements will
     // leave equal space at the front of the first block and at the end of the
@@ -1674,7 +1812,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateSplit(
 
     // Good time to allocate block for exception safety.
 
-    Block *newBlock = this->allocateN((Block*) 0, 1);
+    Block *newBlock = allocateBlock();
 
     // The following chunk of code will never throw an exception.  Move unsplit
     // blocks from 'this' to 'other', then adjust the iterators.
@@ -1988,6 +2126,8 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE,ALLOCATOR>::deque(const ALLOCATOR& allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
+, d_freeBlocks_p(0)
+, d_numFreeBlocks(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(0);
@@ -1999,6 +2139,8 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(size_type         numElements,
                                    const ALLOCATOR&  allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
+, d_freeBlocks_p(0)
+, d_numFreeBlocks(0)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2017,6 +2159,8 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(size_type         numElements,
                                    const ALLOCATOR&  allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
+, d_freeBlocks_p(0)
+, d_numFreeBlocks(0)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2036,6 +2180,8 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(INPUT_ITER       first,
                                    const ALLOCATOR& allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
+, d_freeBlocks_p(0)
+, d_numFreeBlocks(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(0);
@@ -2047,6 +2193,8 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE,ALLOCATOR>::deque(const deque<VALUE_TYPE,ALLOCATOR>& rhs)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(rhs)
+, d_freeBlocks_p(0)
+, d_numFreeBlocks(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(rhs.size());
@@ -2062,6 +2210,8 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(
                                   const ALLOCATOR&                   allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
+, d_freeBlocks_p(0)
+, d_numFreeBlocks(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(rhs.size());
@@ -2075,8 +2225,10 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE,ALLOCATOR>::~deque()
 {
     if (0 == this->d_blocks) {
-        // Nothing to do when destroying raw deques.
+        // Only free blocks (e.g., left over from a join) need to be released
+        // when destroying raw deques.
 
+        releaseFreeBlocks();
         return;                                                       // RETURN
     }
 
@@ -2090,8 +2242,9 @@ deque<VALUE_TYPE,ALLOCATOR>::~deque()
         this->deallocateN(*this->d_start.blockPtr(), 1);
     }
 
-    // Deallocate the array of block pointers.
+    // Deallocate the free blocks and the array of block pointers.
 
+    releaseFreeBlocks();
     this->deallocateN(this->d_blocks, this->d_blocksLength);
 }
 
@@ -2483,7 +2636,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_front()
                                                      this->d_start.valuePtr());
 
     if (1 == this->d_start.remainingInBlock()) {
-        this->deallocateN(*this->d_start.blockPtr(), 1);
+        deallocateBlock(*this->d_start.blockPtr());
         this->d_start.nextBlock();
         return;                                                       // RETURN
     }
@@ -2500,7 +2653,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_back()
         --this->d_finish;
         BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(
                                                     this->d_finish.valuePtr());
-        this->deallocateN(this->d_finish.blockPtr()[1], 1);
+        deallocateBlock(this->d_finish.blockPtr()[1]);
         return;                                                       // RETURN
     }
 
@@ -2535,11 +2688,11 @@ deque<VALUE_TYPE,ALLOCATOR>::erase(const_iterator first,
 
     for ( ; oldStart.imp().blockPtr() != this->d_start.blockPtr();
                                                   oldStart.imp().nextBlock()) {
-        this->deallocateN(oldStart.imp().blockPtr()[0], 1);
+        deallocateBlock(oldStart.imp().blockPtr()[0]);
     }
     for ( ; oldFinish.imp().blockPtr() != this->d_finish.blockPtr();
                                              oldFinish.imp().previousBlock()) {
-        this->deallocateN(oldFinish.imp().blockPtr()[0], 1);
+        deallocateBlock(oldFinish.imp().blockPtr()[0]);
     }
     return result;
 }
@@ -2595,7 +2748,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::clear()
     BlockPtr *startBlock = this->d_start.blockPtr();
     BlockPtr *finishBlock = this->d_finish.blockPtr();
     for ( ; startBlock != finishBlock; ++startBlock) {
-        this->deallocateN(*startBlock, 1);
+        deallocateBlock(*startBlock);
     }
 
     // Reposition in the middle.
@@ -2739,7 +2892,7 @@ Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::~Deque_BlockCreator()
         for (; delFirst != delLast; ++delFirst) {
             // Deallocate the block that '*d_start' points to.
 
-            d_deque_p->deallocateN(*delFirst, 1);
+            d_deque_p->deallocateBlock(*delFirst);
         }
     }
 }
@@ -2750,7 +2903,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtFront(size_type n)
 {
     d_boundary = reserveBlockSlots(n, true);
     for ( ; n > 0; --n) {
-        d_boundary[-1] = d_deque_p->allocateN((Block*) 0, 1);
+        d_boundary[-1] = d_deque_p->allocateBlock();
         --d_boundary;
     }
 }
@@ -2760,7 +2913,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtBack(size_type n)
 {
     d_boundary = reserveBlockSlots(n, false);
     for ( ; n > 0; --n) {
-        *d_boundary = d_deque_p->allocateN((Block*) 0, 1);
+        *d_boundary = d_deque_p->allocateBlock();
         ++d_boundary;
     }
 }
@@ -10,6 +10,7 @@
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_newdeleteallocator.h>      // for testing only
 #include <bslma_testallocator.h>           // for testing only
 #include <bslma_testallocatorexception.h>  // for testing only
 #include <bslmf_ispointer.h>               // for testing only
@@ -147,6 +148,9 @@ using namespace bsl;
 // [11] ALLOCATOR-RELATED CONCERNS
 // [18] USAGE EXAMPLE
 // [22] CONCERN: 'std::length_error' is used properly
+// [27] CONCERN: block length is configurable via 'DequeBlockTraits'
+// [27] CONCERN: free blocks are recycled and bounded
+// [-2] PERFORMANCE TEST: FIFO THROUGHPUT
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(deque<T,A> *object, const char *spec, int vF = 1);
@@ -1266,6 +1270,118 @@ struct IsBitwiseMoveable<LimitAllocator<ALLOCATOR> >
 
 }  // namespace BloombergLP
 
+                          // ====================
+                          // class BlockConfigInt
+                          // ====================
+
+template <int BLOCK_BYTES, int NUM_FREE_BLOCKS>
+class BlockConfigInt {
+    // This class wraps an 'int' value.  The block configuration of a
+    // 'bsl::deque' of this type is specified by the (template parameter)
+    // 'BLOCK_BYTES' and 'NUM_FREE_BLOCKS' through a specialization of
+    // 'bslstl::DequeBlockTraits' (see below).
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    BlockConfigInt(int value = 0)                                   // IMPLICIT
+    : d_value(value)
+    {
+    }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <int BLOCK_BYTES, int NUM_FREE_BLOCKS>
+struct DequeBlockTraits<BlockConfigInt<BLOCK_BYTES, NUM_FREE_BLOCKS> > {
+    enum {
+        BLOCK_SIZE      = BLOCK_BYTES,
+        MAX_FREE_BLOCKS = NUM_FREE_BLOCKS
+    };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+                          // =======================
+                          // class CountingAllocator
+                          // =======================
+
+class CountingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol by forwarding to
+    // the 'new'/'delete' allocator and counting the number of allocations.
+    // Unlike 'bslma::TestAllocator', it adds no bookkeeping overhead, and is
+    // suitable for timing.
+
+    // DATA
+    Int64 d_numAllocations;  // number of calls to 'allocate'
+
+  public:
+    // CREATORS
+    CountingAllocator() : d_numAllocations(0) { }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        ++d_numAllocations;
+        return bslma::NewDeleteAllocator::singleton().allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        bslma::NewDeleteAllocator::singleton().deallocate(address);
+    }
+
+    // ACCESSORS
+    Int64 numAllocations() const { return d_numAllocations; }
+};
+
+                            // =================
+                            // struct FifoResult
+                            // =================
+
+struct FifoResult {
+    // This 'struct' holds the outcome of a run of 'fifoBenchmark'.
+
+    double d_seconds;      // elapsed time
+    Int64  d_allocations;  // number of allocations made during the run
+};
+
+template <class TYPE>
+FifoResult fifoBenchmark(int queueLength, int numMessages)
+    // Push the specified 'numMessages' values to the back of a deque of the
+    // (template parameter) 'TYPE', while popping from its front so that the
+    // deque holds 'queueLength' values at all times, and return the elapsed
+    // time and the number of allocations made.
+{
+    CountingAllocator ca;
+    bsl::deque<TYPE>  mX(&ca);
+
+    for (int i = 0; i < queueLength; ++i) {
+        mX.push_back(TYPE(i));
+    }
+
+    const Int64 ALLOCS = ca.numAllocations();
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numMessages; ++i) {
+        mX.push_back(TYPE(i));
+        mX.pop_front();
+    }
+    timer.stop();
+
+    FifoResult result;
+    result.d_seconds     = timer.elapsedTime();
+    result.d_allocations = ca.numAllocations() - ALLOCS;
+    return result;
+}
+
 //=============================================================================
 //                       TEST DRIVER TEMPLATE
 //-----------------------------------------------------------------------------
@@ -7916,6 +8032,209 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK CONFIGURATION AND RECYCLING
+        //
+        // Concerns:
+        //: 1 The block length is derived from the block size specified by
+        //:   'bslstl::DequeBlockTraits', and is never less than 16 elements.
+        //:
+        //: 2 In a FIFO pattern ('push_back' followed by 'pop_front'), once
+        //:   warmed up, a deque that retains at least one free block makes no
+        //:   further allocation.
+        //:
+        //: 3 A deque retains no more than 'MAX_FREE_BLOCKS' free blocks, and
+        //:   retains none if 'MAX_FREE_BLOCKS' is 0.
+        //:
+        //: 4 Free blocks are returned to the allocator on destruction,
+        //:   including when blocks have been exchanged between deques by
+        //:   'swap' or by a middle insertion or erasure.
+        //
+        // Plan:
+        //: 1 Verify 'BLOCK_LENGTH' for types whose 'DequeBlockTraits' are
+        //:   specialized with various block sizes.  (C-1)
+        //:
+        //: 2 For several values of 'MAX_FREE_BLOCKS', push and pop a number
+        //:   of values through a deque that holds a fixed number of values,
+        //:   and verify the number of allocations made after warm-up.  (C-2)
+        //:
+        //: 3 Grow a deque to many blocks, 'clear' it, and verify the number
+        //:   of blocks in use with the object allocator.  (C-3)
+        //:
+        //: 4 Perform 'swap', and middle 'insert' and 'erase' on deques that
+        //:   hold free blocks, and verify that the object allocator has no
+        //:   blocks in use once the deques are destroyed.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: block length is configurable via 'DequeBlockTraits'
+        //   CONCERN: free blocks are recycled and bounded
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BLOCK CONFIGURATION AND RECYCLING"
+                            "\n=========================================\n");
+
+        typedef BlockConfigInt<  64, 0> Free0;  // 16 elements per block
+        typedef BlockConfigInt<  64, 1> Free1;
+        typedef BlockConfigInt<  64, 4> Free4;
+        typedef BlockConfigInt<   8, 1> Tiny;
+        typedef BlockConfigInt<4096, 1> Big;
+
+        if (verbose) printf("\tTesting block length.\n");
+        {
+            ASSERT(  16 == Deque_BlockLengthCalcUtil<Free0>::BLOCK_LENGTH);
+            ASSERT(  16 == Deque_BlockLengthCalcUtil<Tiny>::BLOCK_LENGTH);
+            ASSERT(1024 == Deque_BlockLengthCalcUtil<Big>::BLOCK_LENGTH);
+            ASSERT(  50 == Deque_BlockLengthCalcUtil<int>::BLOCK_LENGTH);
+            ASSERT(  64 == Deque_BlockLengthCalcUtil<Free0>::BLOCK_SIZE);
+            ASSERT( 200 == Deque_BlockLengthCalcUtil<Big>::DEFAULT_BLOCK_SIZE);
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::deque<Big> mX(&oa);  const bsl::deque<Big>& X = mX;
+            for (int i = 0; i < 1023; ++i) {
+                mX.push_back(Big(i));
+            }
+            const Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            for (int i = 0; i < 1023; ++i) {
+                mX.push_front(Big(i));
+            }
+            ASSERT(NUM_BLOCKS + 1 == oa.numBlocksInUse());
+            ASSERT(2046 == X.size());
+            ASSERT(1022 == X.front().value());
+            ASSERT(1022 == X.back().value());
+        }
+
+        if (verbose) printf("\tTesting FIFO recycling.\n");
+        {
+            const int LENGTHS[] = { 0, 1, 15, 16, 17, 100 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                bsl::deque<Free0> mX0(&oa);
+                bsl::deque<Free1> mX1(&oa);
+                bsl::deque<Free4> mX4(&oa);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX0.push_back(Free0(i));
+                    mX1.push_back(Free1(i));
+                    mX4.push_back(Free4(i));
+                }
+
+                // Warm up for one block, then count allocations over many.
+
+                for (int i = 0; i < 16; ++i) {
+                    mX1.push_back(Free1(i));  mX1.pop_front();
+                    mX4.push_back(Free4(i));  mX4.pop_front();
+                }
+
+                Int64 allocs = oa.numAllocations();
+                for (int i = 0; i < 1600; ++i) {
+                    mX1.push_back(Free1(i));  mX1.pop_front();
+                    mX4.push_back(Free4(i));  mX4.pop_front();
+                }
+                LOOP_ASSERT(LENGTH, allocs == oa.numAllocations());
+
+                allocs = oa.numAllocations();
+                for (int i = 0; i < 1600; ++i) {
+                    mX0.push_back(Free0(i));  mX0.pop_front();
+                }
+                LOOP_ASSERT(LENGTH, allocs + 100 <= oa.numAllocations());
+
+                LOOP_ASSERT(LENGTH, LENGTH == (int) mX0.size());
+                LOOP_ASSERT(LENGTH, LENGTH == (int) mX1.size());
+                LOOP_ASSERT(LENGTH, LENGTH == (int) mX4.size());
+                for (int i = 0; i < LENGTH; ++i) {
+                    LOOP2_ASSERT(LENGTH, i,
+                                 1600 - LENGTH + i == mX0[i].value());
+                    LOOP2_ASSERT(LENGTH, i,
+                                 1600 - LENGTH + i == mX1[i].value());
+                    LOOP2_ASSERT(LENGTH, i,
+                                 1600 - LENGTH + i == mX4[i].value());
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting bound on free blocks.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                bsl::deque<Free0> mX0(&oa);
+                for (int i = 0; i < 160; ++i) {
+                    mX0.push_back(Free0(i));
+                }
+                const Int64 IN_USE = oa.numBlocksInUse();
+                mX0.clear();
+
+                // The block pointer array and the remaining block.
+
+                ASSERT(2 == oa.numBlocksInUse());
+                ASSERT(IN_USE > oa.numBlocksInUse());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+            {
+                bsl::deque<Free1> mX1(&oa);
+                bsl::deque<Free4> mX4(&oa);
+                for (int i = 0; i < 160; ++i) {
+                    mX1.push_back(Free1(i));
+                }
+                mX1.clear();
+                ASSERT(3 + 2 == oa.numBlocksInUse());
+
+                for (int i = 0; i < 160; ++i) {
+                    mX4.push_back(Free4(i));
+                }
+                mX4.clear();
+                ASSERT(3 + 6 == oa.numBlocksInUse());
+
+                // Free blocks are reused before the allocator is called.
+
+                const Int64 ALLOCS = oa.numAllocations();
+                for (int i = 0; i < 16 * 4; ++i) {
+                    mX4.push_back(Free4(i));
+                }
+                ASSERT(ALLOCS == oa.numAllocations());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting release of free blocks.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                bsl::deque<Free4> mX(&oa);  const bsl::deque<Free4>& X = mX;
+                bsl::deque<Free4> mY(&oa);  const bsl::deque<Free4>& Y = mY;
+
+                for (int i = 0; i < 200; ++i) {
+                    mX.push_back(Free4(i));
+                    mY.push_front(Free4(i));
+                }
+                for (int i = 0; i < 50; ++i) {
+                    mX.pop_front();
+                    mY.pop_back();
+                }
+                mX.swap(mY);
+                ASSERT(150 == X.size());
+                ASSERT(150 == Y.size());
+
+                mX.insert(mX.begin() + 75, 40, Free4(-1));
+                mX.erase(mX.begin() + 20, mX.begin() + 120);
+                mY.erase(mY.begin() + 10, mY.end() - 10);
+                ASSERT( 90 == X.size());
+                ASSERT( 20 == Y.size());
+
+                bsl::deque<Free4> mZ(X, &oa);
+                mZ.assign(Y.begin(), Y.end());
+                ASSERT(Y.size() == mZ.size());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
@@ -9038,6 +9357,64 @@ int main(int argc, char *argv[])
         TestDriver<BCT>::testCaseM1Range(CharArray<BCT>());
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: FIFO THROUGHPUT
+        //
+        // Concerns:
+        //: 1 A deque used as a FIFO queue does not allocate once warmed up,
+        //:   and larger blocks do not slow down the 'push_back'/'pop_front'
+        //:   cycle.
+        //
+        // Plan:
+        //: 1 For queues of several lengths, time a number of 'push_back' and
+        //:   'pop_front' pairs on deques of 'int'-sized values configured
+        //:   with the default block size and with larger blocks, with and
+        //:   without free-block recycling, and report the time per message
+        //:   and the number of allocations per thousand messages.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: FIFO THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: FIFO THROUGHPUT"
+                            "\n=================================\n");
+
+        typedef BlockConfigInt< 200, 0> Default0;
+        typedef BlockConfigInt< 200, 1> Default1;
+        typedef BlockConfigInt<4096, 0> Big0;
+        typedef BlockConfigInt<4096, 1> Big1;
+
+        const int LENGTHS[] = { 1, 100, 10000, 1000000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+        const int NUM_MESSAGES = 20000000;
+
+        printf("%10s  %-22s %10s %14s\n",
+               "length", "configuration", "ns/msg", "allocs/1k msg");
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            const char *NAMES[] = { "200 bytes, no recycle",
+                                    "200 bytes, recycle",
+                                    "4096 bytes, no recycle",
+                                    "4096 bytes, recycle" };
+            FifoResult results[4];
+            results[0] = fifoBenchmark<Default0>(LENGTH, NUM_MESSAGES);
+            results[1] = fifoBenchmark<Default1>(LENGTH, NUM_MESSAGES);
+            results[2] = fifoBenchmark<Big0>(LENGTH, NUM_MESSAGES);
+            results[3] = fifoBenchmark<Big1>(LENGTH, NUM_MESSAGES);
+
+            for (int i = 0; i < 4; ++i) {
+                printf("%10d  %-22s %10.2f %14.3f\n",
+                       LENGTH,
+                       NAMES[i],
+                       results[i].d_seconds * 1e9 / NUM_MESSAGES,
+                       static_cast<double>(results[i].d_allocations)
+                                                      * 1000.0 / NUM_MESSAGES);
+            }
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
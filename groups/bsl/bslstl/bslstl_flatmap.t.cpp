@@ -0,0 +1,807 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_vector.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <functional>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a thin adapter over 'bslstl::FlatTree', which
+// is tested thoroughly in its own test driver.  This driver verifies that
+// each method forwards to the implementation correctly, that the map-specific
+// methods ('operator[]' and 'at') behave as documented, that the free
+// operators and type traits are defined as documented, and measures the
+// performance of the container against 'bsl::map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3] flat_map(const COMPARATOR&, const ALLOCATOR&);
+// [ 3] flat_map(const ALLOCATOR&);
+// [ 3] flat_map(const flat_map&);
+// [ 3] flat_map(const flat_map&, const ALLOCATOR&);
+// [ 3] flat_map(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+//
+// MANIPULATORS
+// [ 3] flat_map& operator=(const flat_map&);
+// [ 2] VALUE& operator[](const key_type&);
+// [ 2] VALUE& at(const key_type&);
+// [ 1] iterator begin();
+// [ 1] iterator end();
+// [ 1] reverse_iterator rbegin();
+// [ 1] reverse_iterator rend();
+// [ 1] pair<iterator, bool> insert(const value_type&);
+// [ 1] iterator insert(const_iterator, const value_type&);
+// [ 1] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 1] iterator erase(const_iterator);
+// [ 1] size_type erase(const key_type&);
+// [ 1] iterator erase(const_iterator, const_iterator);
+// [ 3] void swap(flat_map&);
+// [ 1] void clear();
+// [ 1] void reserve(size_type);
+// [ 1] void shrink_to_fit();
+// [ 1] void build_lookup_index();
+// [ 1] void release_lookup_index();
+// [ 1] iterator find(const key_type&);
+// [ 1] iterator lower_bound(const key_type&);
+// [ 1] iterator upper_bound(const key_type&);
+// [ 1] pair<iterator, iterator> equal_range(const key_type&);
+//
+// ACCESSORS
+// [ 3] allocator_type get_allocator() const;
+// [ 1] const_iterator begin() const;
+// [ 1] const_iterator end() const;
+// [ 1] const_reverse_iterator rbegin() const;
+// [ 1] const_reverse_iterator rend() const;
+// [ 1] const_iterator cbegin() const;
+// [ 1] const_iterator cend() const;
+// [ 1] const_reverse_iterator crbegin() const;
+// [ 1] const_reverse_iterator crend() const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [ 1] size_type max_size() const;
+// [ 1] size_type capacity() const;
+// [ 1] bool has_lookup_index() const;
+// [ 3] key_compare key_comp() const;
+// [ 3] value_compare value_comp() const;
+// [ 2] const VALUE& at(const key_type&) const;
+// [ 1] const_iterator find(const key_type&) const;
+// [ 1] size_type count(const key_type&) const;
+// [ 1] const_iterator lower_bound(const key_type&) const;
+// [ 1] const_iterator upper_bound(const key_type&) const;
+// [ 1] pair<const_iter, const_iter> equal_range(const key_type&) const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const flat_map&, const flat_map&);
+// [ 3] bool operator!=(const flat_map&, const flat_map&);
+// [ 3] bool operator< (const flat_map&, const flat_map&);
+// [ 3] bool operator> (const flat_map&, const flat_map&);
+// [ 3] bool operator<=(const flat_map&, const flat_map&);
+// [ 3] bool operator>=(const flat_map&, const flat_map&);
+// [ 3] void swap(flat_map&, flat_map&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] TYPE TRAITS
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_map<int, int>                          Obj;
+typedef bsl::flat_map<int, int, std::greater<int> >      RObj;
+typedef Obj::value_type                                  Value;
+typedef bsl::map<int, int>                               Oracle;
+
+namespace {
+
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' and return a pseudo-random value derived
+    // from it.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+bool verify(const Obj& object, const Oracle& oracle)
+    // Return 'true' if the specified 'object' holds exactly the key-value
+    // pairs of the specified 'oracle', in order, and 'false' otherwise.
+{
+    if (object.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    Obj::const_iterator it = object.begin();
+    for (Oracle::const_iterator ot = oracle.begin();
+         ot != oracle.end();
+         ++ot, ++it) {
+        if (it->first != ot->first || it->second != ot->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Price Table
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we load a table of prices, keyed by an integer instrument
+// identifier, once at startup, and then look prices up many times.
+//
+// First, we collect the (unsorted) entries of the table:
+//..
+    typedef bsl::pair<int, double> Entry;
+
+    const Entry ENTRIES[] = {
+        Entry(1003, 99.5), Entry(1001, 12.25), Entry(1002, 41.0)
+    };
+    const int NUM_ENTRIES = sizeof ENTRIES / sizeof *ENTRIES;
+//..
+// Then, we build the table in a single step:
+//..
+    bsl::flat_map<int, double> prices(ENTRIES, ENTRIES + NUM_ENTRIES);
+    ASSERT(3    == prices.size());
+    ASSERT(1001 == prices.begin()->first);
+//..
+// Finally, we look up and update prices:
+//..
+    ASSERT(41.0 == prices.at(1002));
+
+    prices[1002] = 41.5;
+    ASSERT(41.5 == prices.find(1002)->second);
+    ASSERT(prices.end() == prices.find(1004));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, SWAP, FREE OPERATORS, AND TRAITS
+        //
+        // Concerns:
+        //: 1 Each constructor creates the documented value and uses the
+        //:   documented comparator and allocator.
+        //:
+        //: 2 Assignment and swap (member and free) exchange values.
+        //:
+        //: 3 The relational operators implement lexicographical comparison of
+        //:   the key-value pairs.
+        //:
+        //: 4 'HasStlIterators' and 'UsesBslmaAllocator' are 'true'.
+        //:
+        //: 5 No memory is leaked, and the default allocator is used only when
+        //:   no allocator is supplied.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor and verify value,
+        //:   comparator, and allocator.  (C-1, 5)
+        //:
+        //: 2 Assign and swap objects and verify their values.  (C-2)
+        //:
+        //: 3 Compare pairs of objects from a table of values.  (C-3)
+        //:
+        //: 4 Check the traits.  (C-4)
+        //
+        // Testing:
+        //   flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_map(const ALLOCATOR&);
+        //   flat_map(const flat_map&);
+        //   flat_map(const flat_map&, const ALLOCATOR&);
+        //   flat_map(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+        //   flat_map& operator=(const flat_map&);
+        //   void swap(flat_map&);
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator< (const flat_map&, const flat_map&);
+        //   bool operator> (const flat_map&, const flat_map&);
+        //   bool operator<=(const flat_map&, const flat_map&);
+        //   bool operator>=(const flat_map&, const flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                    "\nCREATORS, ASSIGNMENT, SWAP, FREE OPERATORS, AND TRAITS"
+                    "\n======================================================"
+                    "\n");
+
+        BSLMF_ASSERT((bslalg::HasStlIterators<Obj>::value));
+        BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const Value DATA[] = {
+            Value(4, 40), Value(2, 20), Value(6, 60), Value(8, 80)
+        };
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            ASSERT(A.empty());
+            ASSERT(&oa == A.get_allocator().mechanism());
+
+            RObj mB(std::greater<int>(), &oa);  const RObj& B = mB;
+            mB.insert(DATA, DATA + 4);
+            ASSERT(4 == B.size());
+            ASSERT(8 == B.begin()->first);
+            ASSERT(B.key_comp()(2, 1));
+            ASSERT(B.value_comp()(Value(2, 0), Value(1, 0)));
+
+            Obj mC(DATA, DATA + 4, std::less<int>(), &oa);
+            const Obj& C = mC;
+            ASSERT(4 == C.size());
+            ASSERT(2 == C.begin()->first);
+            ASSERT(!C.value_comp()(Value(2, 0), Value(1, 0)));
+
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            Obj mD(C);  const Obj& D = mD;
+            ASSERT(C == D);
+            ASSERT(&defaultAllocator == D.get_allocator().mechanism());
+
+            Obj mE(C, &oa);  const Obj& E = mE;
+            ASSERT(C == E);
+            ASSERT(&oa == E.get_allocator().mechanism());
+
+            mA = C;
+            ASSERT(C == A);
+
+            mA.clear();
+            mA.swap(mE);
+            ASSERT(C == A);
+            ASSERT(E.empty());
+
+            swap(mA, mE);
+            ASSERT(C == E);
+            ASSERT(A.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        const struct {
+            int         d_line;
+            const char *d_spec;  // pairs of digits: key, then value
+        } VALUES[] = {
+            { L_, ""     },
+            { L_, "10"   },
+            { L_, "1020" },
+            { L_, "1021" },
+            { L_, "11"   },
+            { L_, "20"   },
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const char *SPEC_I = VALUES[i].d_spec;
+            Obj mX(&oa);  const Obj& X = mX;
+            for (const char *p = SPEC_I; *p; p += 2) {
+                mX.insert(Value(p[0] - '0', p[1] - '0'));
+            }
+            for (int j = 0; j < NUM_VALUES; ++j) {
+                const char *SPEC_J = VALUES[j].d_spec;
+                Obj mY(&oa);  const Obj& Y = mY;
+                for (const char *p = SPEC_J; *p; p += 2) {
+                    mY.insert(Value(p[0] - '0', p[1] - '0'));
+                }
+
+                // The table is sorted by value.
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+                ASSERTV(i, j, (i <  j) == (X <  Y));
+                ASSERTV(i, j, (i >  j) == (X >  Y));
+                ASSERTV(i, j, (i <= j) == (X <= Y));
+                ASSERTV(i, j, (i >= j) == (X >= Y));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'operator[]' AND 'at'
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of an
+        //:   existing key, and otherwise inserts a default-constructed mapped
+        //:   value at the correct position.
+        //:
+        //: 2 'at' returns a reference to the mapped value of an existing key,
+        //:   and otherwise throws 'std::out_of_range' without modifying the
+        //:   map.
+        //:
+        //: 3 Modifying a mapped value through 'operator[]', 'at', or an
+        //:   iterator does not discard the lookup index.
+        //
+        // Plan:
+        //: 1 Apply 'operator[]' and 'at' to pseudo-random keys, comparing
+        //:   with 'bsl::map'.  (C-1..2)
+        //:
+        //: 2 Modify mapped values of a map having a lookup index and verify
+        //:   'has_lookup_index'.  (C-3)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type&);
+        //   VALUE& at(const key_type&);
+        //   const VALUE& at(const key_type&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'operator[]' AND 'at'"
+                            "\n=====================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj    mX(&oa);  const Obj& X = mX;
+            Oracle oracle(&oa);
+
+            unsigned int seed = 5;
+            for (int i = 0; i < 300; ++i) {
+                const int key = nextRandom(&seed) % 50;
+                if (nextRandom(&seed) % 2) {
+                    ASSERTV(i, key, oracle[key] == mX[key]);
+                    mX[key]     += i;
+                    oracle[key] += i;
+                }
+                else {
+                    const bool EXP = oracle.end() != oracle.find(key);
+#ifdef BDE_BUILD_TARGET_EXC
+                    bool threw = false;
+                    try {
+                        ASSERTV(i, key, oracle[key] == X.at(key));
+                        mX.at(key) += 1;
+                        oracle.at(key) += 1;
+                    }
+                    catch (const std::out_of_range&) {
+                        threw = true;
+                    }
+                    ASSERTV(i, key, EXP == !threw);
+                    if (threw) {
+                        oracle.erase(key);
+                    }
+#else
+                    if (EXP) {
+                        ASSERTV(i, key, oracle[key] == X.at(key));
+                        mX.at(key) += 1;
+                        oracle.at(key) += 1;
+                    }
+#endif
+                }
+                ASSERTV(i, key, verify(X, oracle));
+            }
+
+            mX.build_lookup_index();
+            ASSERT(X.has_lookup_index());
+
+            mX[X.begin()->first] = -1;
+            mX.at(X.begin()->first) = -2;
+            mX.begin()->second = -3;
+            ASSERT(X.has_lookup_index());
+            ASSERT(-3 == X.at(X.begin()->first));
+
+            const int NEW_KEY = 1000;
+            mX[NEW_KEY] = 7;
+            ASSERT(!X.has_lookup_index());
+            ASSERT(7 == X.rbegin()->second);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 Each manipulator and accessor forwards to the implementation and
+        //:   produces the same results as 'bsl::map'.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of operations to a 'flat_map' and
+        //:   a 'bsl::map', comparing the results of every accessor after each
+        //:   operation.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj    mX(&oa);  const Obj& X = mX;
+            Oracle oracle(&oa);
+
+            ASSERT(X.empty());
+            ASSERT(0 < X.max_size());
+
+            unsigned int seed = 11;
+            for (int i = 0; i < 400; ++i) {
+                const int   key = nextRandom(&seed) % 64;
+                const Value VALUE(key, i);
+                switch (nextRandom(&seed) % 8) {
+                  case 0: {
+                    ASSERTV(i, oracle.insert(VALUE).second
+                                                 == mX.insert(VALUE).second);
+                  } break;
+                  case 1: {
+                    Obj::iterator it = mX.insert(X.lower_bound(key), VALUE);
+                    ASSERTV(i, key == it->first);
+                    oracle.insert(VALUE);
+                  } break;
+                  case 2: {
+                    Value range[4];
+                    for (int j = 0; j < 4; ++j) {
+                        range[j] = Value(nextRandom(&seed) % 64, i);
+                    }
+                    mX.insert(range, range + 4);
+                    oracle.insert(range, range + 4);
+                  } break;
+                  case 3: {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                  } break;
+                  case 4: {
+                    Obj::iterator it = mX.find(key);
+                    if (it != mX.end()) {
+                        it = mX.erase(it);
+                        ASSERTV(i, it == mX.upper_bound(key));
+                        oracle.erase(key);
+                    }
+                  } break;
+                  case 5: {
+                    Obj::iterator first = mX.lower_bound(key);
+                    Obj::iterator last  = mX.upper_bound(key + 4);
+                    mX.erase(first, last);
+                    oracle.erase(oracle.lower_bound(key),
+                                 oracle.upper_bound(key + 4));
+                  } break;
+                  case 6: {
+                    mX.build_lookup_index();
+                    ASSERTV(i, X.has_lookup_index() == !X.empty());
+                  } break;
+                  default: {
+                    mX.release_lookup_index();
+                    ASSERTV(i, !X.has_lookup_index());
+                  } break;
+                }
+
+                ASSERTV(i, verify(X, oracle));
+                ASSERTV(i, X.empty() == oracle.empty());
+                ASSERTV(i, X.cbegin()  == X.begin());
+                ASSERTV(i, X.cend()    == X.end());
+                ASSERTV(i, X.crbegin() == X.rbegin());
+                ASSERTV(i, X.crend()   == X.rend());
+                ASSERTV(i, mX.end() - mX.begin() == (int)X.size());
+                ASSERTV(i, mX.rend() - mX.rbegin() == (int)X.size());
+                ASSERTV(i, X.rend() - X.rbegin() == (int)X.size());
+
+                for (int k = -1; k <= 65; ++k) {
+                    ASSERTV(i, k, oracle.count(k) == X.count(k));
+                    ASSERTV(i, k, (oracle.find(k) == oracle.end())
+                                                    == (X.find(k) == X.end()));
+                    ASSERTV(i, k, X.find(k) == mX.find(k));
+                    ASSERTV(i, k, std::distance(oracle.begin(),
+                                                oracle.lower_bound(k))
+                                            == X.lower_bound(k) - X.begin());
+                    ASSERTV(i, k, std::distance(oracle.begin(),
+                                                oracle.upper_bound(k))
+                                            == X.upper_bound(k) - X.begin());
+                    ASSERTV(i, k, X.lower_bound(k) == mX.lower_bound(k));
+                    ASSERTV(i, k, X.upper_bound(k) == mX.upper_bound(k));
+
+                    bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                             X.equal_range(k);
+                    ASSERTV(i, k, R.first  == X.lower_bound(k));
+                    ASSERTV(i, k, R.second == X.upper_bound(k));
+
+                    bsl::pair<Obj::iterator, Obj::iterator> MR =
+                                                            mX.equal_range(k);
+                    ASSERTV(i, k, MR.first  == R.first);
+                    ASSERTV(i, k, MR.second == R.second);
+                }
+            }
+
+            mX.reserve(200);
+            ASSERT(200 <= X.capacity());
+            mX.shrink_to_fit();
+            ASSERT(X.size() == X.capacity());
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Building a 'flat_map' in bulk from unsorted elements is faster
+        //:   than building a 'bsl::map' from the same elements.
+        //:
+        //: 2 Searching a 'flat_map' (with and without a lookup index) is
+        //:   faster than searching a 'bsl::map'.
+        //:
+        //: 3 Iterating over a 'flat_map' is faster than iterating over a
+        //:   'bsl::map'.
+        //
+        // Plan:
+        //: 1 For maps of several sizes, time the construction from a range of
+        //:   pseudo-random elements, a fixed number of 'find' calls, and a
+        //:   full iteration, of 'bsl::map', 'flat_map', and 'flat_map' with a
+        //:   lookup index, and report the memory in use by each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int NUM_SEARCHES = 1000000;
+
+        const int SIZES[]   = { 1 << 6, 1 << 10, 1 << 14, 1 << 18, 1 << 21 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%9s | %8s %8s | %7s %7s %7s | %7s %7s | %9s %9s\n",
+               "size", "build map", "flat", "find map", "flat", "index",
+               "iter map", "flat", "bytes map", "flat");
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE = SIZES[si];
+
+            bsl::vector<Value> values;
+            unsigned int       seed = 12345;
+            for (int i = 0; i < SIZE; ++i) {
+                // Multiplying by an odd constant permutes the integers, so
+                // the keys are distinct but in pseudo-random order.
+
+                values.push_back(Value(static_cast<int>(i * 2654435761u), i));
+            }
+            bsl::vector<int> probes;
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                probes.push_back(values[nextRandom(&seed) % SIZE].first);
+            }
+
+            bslma::TestAllocator mapAllocator;
+            bslma::TestAllocator flatAllocator;
+
+            bsls::Stopwatch timer;
+            double          elapsed[7];
+
+            timer.start();
+            Oracle map(values.begin(),
+                       values.end(),
+                       std::less<int>(),
+                       &mapAllocator);
+            timer.stop();
+            elapsed[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            Obj flat(values.begin(), values.end(), std::less<int>(),
+                     &flatAllocator);
+            timer.stop();
+            elapsed[1] = timer.elapsedTime();
+
+            ASSERTV(SIZE, map.size() == flat.size());
+
+            const bsls::Types::Int64 MAP_BYTES  = mapAllocator.numBytesInUse();
+            const bsls::Types::Int64 FLAT_BYTES =
+                                               flatAllocator.numBytesInUse();
+
+            bsls::Types::Int64 sum[5] = { 0, 0, 0, 0, 0 };
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                sum[0] += map.find(probes[i])->second;
+            }
+            timer.stop();
+            elapsed[2] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                sum[1] += flat.find(probes[i])->second;
+            }
+            timer.stop();
+            elapsed[3] = timer.elapsedTime();
+
+            flat.build_lookup_index();
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                sum[2] += flat.find(probes[i])->second;
+            }
+            timer.stop();
+            elapsed[4] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (Oracle::const_iterator it = map.begin();
+                 it != map.end();
+                 ++it) {
+                sum[3] += it->second;
+            }
+            timer.stop();
+            elapsed[5] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (Obj::const_iterator it = flat.begin();
+                 it != flat.end();
+                 ++it) {
+                sum[4] += it->second;
+            }
+            timer.stop();
+            elapsed[6] = timer.elapsedTime();
+
+            ASSERTV(SIZE, sum[0] == sum[1]);
+            ASSERTV(SIZE, sum[0] == sum[2]);
+            ASSERTV(SIZE, sum[3] == sum[4]);
+
+            printf("%9d | %8.4f %8.4f | %7.1f %7.1f %7.1f |"
+                   " %7.2f %7.2f | %9lld %9lld\n",
+                   SIZE,
+                   elapsed[0],
+                   elapsed[1],
+                   elapsed[2] * 1e9 / NUM_SEARCHES,
+                   elapsed[3] * 1e9 / NUM_SEARCHES,
+                   elapsed[4] * 1e9 / NUM_SEARCHES,
+                   elapsed[5] * 1e9 / SIZE,
+                   elapsed[6] * 1e9 / SIZE,
+                   MAP_BYTES,
+                   FLAT_BYTES);
+        }
+        if (verbose) {
+            printf("build times are in seconds, find and iteration times in"
+                   " ns per element\n");
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    (void)veryVerbose;
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
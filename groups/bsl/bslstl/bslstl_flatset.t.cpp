@@ -0,0 +1,644 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_set.h>
+#include <bslstl_vector.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a thin adapter over 'bslstl::FlatTree', which
+// is tested thoroughly in its own test driver.  This driver verifies that
+// each method forwards to the implementation correctly, that the free
+// operators and type traits are defined as documented, and measures the
+// performance of the container against 'bsl::set'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_set(const ALLOCATOR&);
+// [ 2] flat_set(const flat_set&);
+// [ 2] flat_set(const flat_set&, const ALLOCATOR&);
+// [ 2] flat_set(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+//
+// MANIPULATORS
+// [ 2] flat_set& operator=(const flat_set&);
+// [ 1] pair<iterator, bool> insert(const value_type&);
+// [ 1] iterator insert(const_iterator, const value_type&);
+// [ 1] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 1] iterator erase(const_iterator);
+// [ 1] size_type erase(const key_type&);
+// [ 1] iterator erase(const_iterator, const_iterator);
+// [ 2] void swap(flat_set&);
+// [ 1] void clear();
+// [ 1] void reserve(size_type);
+// [ 1] void shrink_to_fit();
+// [ 1] void build_lookup_index();
+// [ 1] void release_lookup_index();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 1] const_iterator begin() const;
+// [ 1] const_iterator end() const;
+// [ 1] const_reverse_iterator rbegin() const;
+// [ 1] const_reverse_iterator rend() const;
+// [ 1] const_iterator cbegin() const;
+// [ 1] const_iterator cend() const;
+// [ 1] const_reverse_iterator crbegin() const;
+// [ 1] const_reverse_iterator crend() const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [ 1] size_type max_size() const;
+// [ 1] size_type capacity() const;
+// [ 1] bool has_lookup_index() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 1] const_iterator find(const key_type&) const;
+// [ 1] size_type count(const key_type&) const;
+// [ 1] const_iterator lower_bound(const key_type&) const;
+// [ 1] const_iterator upper_bound(const key_type&) const;
+// [ 1] pair<const_iter, const_iter> equal_range(const key_type&) const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const flat_set&, const flat_set&);
+// [ 2] bool operator!=(const flat_set&, const flat_set&);
+// [ 2] bool operator< (const flat_set&, const flat_set&);
+// [ 2] bool operator> (const flat_set&, const flat_set&);
+// [ 2] bool operator<=(const flat_set&, const flat_set&);
+// [ 2] bool operator>=(const flat_set&, const flat_set&);
+// [ 2] void swap(flat_set&, flat_set&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] TYPE TRAITS
+// [ 3] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_set<int>                               Obj;
+typedef bsl::flat_set<int, std::greater<int> >           RObj;
+
+namespace {
+
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' and return a pseudo-random value derived
+    // from it.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Building a Set of Identifiers in Bulk
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a batch of (unsorted, possibly repeated) security
+// identifiers, and need to answer many membership queries against the
+// distinct identifiers of the batch.
+//
+// First, we collect the identifiers:
+//..
+    const int IDS[]   = { 42, 7, 19, 42, 3, 7, 100 };
+    const int NUM_IDS = sizeof IDS / sizeof *IDS;
+//..
+// Then, we construct a 'flat_set' from the whole batch, which sorts the
+// identifiers and discards the duplicates in a single pass:
+//..
+    bsl::flat_set<int> ids(IDS, IDS + NUM_IDS);
+    ASSERT(5 == ids.size());
+    ASSERT(3 == *ids.begin());
+//..
+// Finally, we answer queries against the set:
+//..
+    ASSERT(1 == ids.count(19));
+    ASSERT(0 == ids.count(20));
+    ASSERT(ids.end() == ids.find(101));
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, SWAP, FREE OPERATORS, AND TRAITS
+        //
+        // Concerns:
+        //: 1 Each constructor creates the documented value and uses the
+        //:   documented comparator and allocator.
+        //:
+        //: 2 Assignment and swap (member and free) exchange values.
+        //:
+        //: 3 The relational operators implement lexicographical comparison.
+        //:
+        //: 4 'HasStlIterators' and 'UsesBslmaAllocator' are 'true'.
+        //:
+        //: 5 No memory is leaked, and the default allocator is used only when
+        //:   no allocator is supplied.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor and verify value,
+        //:   comparator, and allocator.  (C-1, 5)
+        //:
+        //: 2 Assign and swap objects and verify their values.  (C-2)
+        //:
+        //: 3 Compare pairs of objects from a table of values.  (C-3)
+        //:
+        //: 4 Check the traits.  (C-4)
+        //
+        // Testing:
+        //   flat_set(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_set(const ALLOCATOR&);
+        //   flat_set(const flat_set&);
+        //   flat_set(const flat_set&, const ALLOCATOR&);
+        //   flat_set(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+        //   flat_set& operator=(const flat_set&);
+        //   void swap(flat_set&);
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   bool operator==(const flat_set&, const flat_set&);
+        //   bool operator!=(const flat_set&, const flat_set&);
+        //   bool operator< (const flat_set&, const flat_set&);
+        //   bool operator> (const flat_set&, const flat_set&);
+        //   bool operator<=(const flat_set&, const flat_set&);
+        //   bool operator>=(const flat_set&, const flat_set&);
+        //   void swap(flat_set&, flat_set&);
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                    "\nCREATORS, ASSIGNMENT, SWAP, FREE OPERATORS, AND TRAITS"
+                    "\n======================================================"
+                    "\n");
+
+        BSLMF_ASSERT((bslalg::HasStlIterators<Obj>::value));
+        BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int DATA[] = { 4, 2, 6, 2, 8 };
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            ASSERT(A.empty());
+            ASSERT(&oa == A.get_allocator().mechanism());
+
+            RObj mB(std::greater<int>(), &oa);  const RObj& B = mB;
+            mB.insert(DATA, DATA + 5);
+            ASSERT(4 == B.size());
+            ASSERT(8 == *B.begin());
+            ASSERT(B.key_comp()(2, 1));
+            ASSERT(B.value_comp()(2, 1));
+
+            Obj mC(DATA, DATA + 5, std::less<int>(), &oa);
+            const Obj& C = mC;
+            ASSERT(4 == C.size());
+            ASSERT(2 == *C.begin());
+
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            Obj mD(C);  const Obj& D = mD;
+            ASSERT(C == D);
+            ASSERT(&defaultAllocator == D.get_allocator().mechanism());
+
+            Obj mE(C, &oa);  const Obj& E = mE;
+            ASSERT(C == E);
+            ASSERT(&oa == E.get_allocator().mechanism());
+
+            mA = C;
+            ASSERT(C == A);
+
+            mA.clear();
+            mA.swap(mE);
+            ASSERT(C == A);
+            ASSERT(E.empty());
+
+            swap(mA, mE);
+            ASSERT(C == E);
+            ASSERT(A.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        const struct {
+            int         d_line;
+            const char *d_spec;
+        } VALUES[] = {
+            { L_, ""    },
+            { L_, "1"   },
+            { L_, "12"  },
+            { L_, "123" },
+            { L_, "13"  },
+            { L_, "2"   },
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const char *SPEC_I = VALUES[i].d_spec;
+            Obj mX(&oa);  const Obj& X = mX;
+            for (const char *p = SPEC_I; *p; ++p) {
+                mX.insert(*p - '0');
+            }
+            for (int j = 0; j < NUM_VALUES; ++j) {
+                const char *SPEC_J = VALUES[j].d_spec;
+                Obj mY(&oa);  const Obj& Y = mY;
+                for (const char *p = SPEC_J; *p; ++p) {
+                    mY.insert(*p - '0');
+                }
+
+                // The table is sorted by value.
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+                ASSERTV(i, j, (i <  j) == (X <  Y));
+                ASSERTV(i, j, (i >  j) == (X >  Y));
+                ASSERTV(i, j, (i <= j) == (X <= Y));
+                ASSERTV(i, j, (i >= j) == (X >= Y));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 Each manipulator and accessor forwards to the implementation and
+        //:   produces the same results as 'bsl::set'.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of operations to a 'flat_set' and
+        //:   a 'bsl::set', comparing the results of every accessor after each
+        //:   operation.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj           mX(&oa);  const Obj& X = mX;
+            bsl::set<int> oracle(&oa);
+
+            ASSERT(X.empty());
+            ASSERT(0 < X.max_size());
+
+            unsigned int seed = 11;
+            for (int i = 0; i < 400; ++i) {
+                const int key = nextRandom(&seed) % 64;
+                switch (nextRandom(&seed) % 8) {
+                  case 0: {
+                    ASSERTV(i, oracle.insert(key).second
+                                                   == mX.insert(key).second);
+                  } break;
+                  case 1: {
+                    ASSERTV(i, key == *mX.insert(X.lower_bound(key), key));
+                    oracle.insert(key);
+                  } break;
+                  case 2: {
+                    int range[4];
+                    for (int j = 0; j < 4; ++j) {
+                        range[j] = nextRandom(&seed) % 64;
+                    }
+                    mX.insert(range, range + 4);
+                    oracle.insert(range, range + 4);
+                  } break;
+                  case 3: {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                  } break;
+                  case 4: {
+                    Obj::const_iterator it = X.find(key);
+                    if (it != X.end()) {
+                        it = mX.erase(it);
+                        ASSERTV(i, it == X.upper_bound(key));
+                        oracle.erase(key);
+                    }
+                  } break;
+                  case 5: {
+                    Obj::const_iterator first = X.lower_bound(key);
+                    Obj::const_iterator last  = X.upper_bound(key + 4);
+                    mX.erase(first, last);
+                    oracle.erase(oracle.lower_bound(key),
+                                 oracle.upper_bound(key + 4));
+                  } break;
+                  case 6: {
+                    mX.build_lookup_index();
+                    ASSERTV(i, X.has_lookup_index() == !X.empty());
+                  } break;
+                  default: {
+                    mX.release_lookup_index();
+                    ASSERTV(i, !X.has_lookup_index());
+                  } break;
+                }
+
+                ASSERTV(i, X.size() == oracle.size());
+                ASSERTV(i, X.empty() == oracle.empty());
+                ASSERTV(i, std::equal(oracle.begin(),
+                                      oracle.end(),
+                                      X.begin()));
+                ASSERTV(i, std::equal(oracle.rbegin(),
+                                      oracle.rend(),
+                                      X.rbegin()));
+                ASSERTV(i, X.cbegin()  == X.begin());
+                ASSERTV(i, X.cend()    == X.end());
+                ASSERTV(i, X.crbegin() == X.rbegin());
+                ASSERTV(i, X.crend()   == X.rend());
+                ASSERTV(i, X.end() - X.begin() == (int)X.size());
+                ASSERTV(i, X.rend() - X.rbegin() == (int)X.size());
+
+                for (int k = -1; k <= 65; ++k) {
+                    ASSERTV(i, k, oracle.count(k) == X.count(k));
+                    ASSERTV(i, k, (oracle.find(k) == oracle.end())
+                                                    == (X.find(k) == X.end()));
+                    ASSERTV(i, k, std::distance(oracle.begin(),
+                                                oracle.lower_bound(k))
+                                            == X.lower_bound(k) - X.begin());
+                    ASSERTV(i, k, std::distance(oracle.begin(),
+                                                oracle.upper_bound(k))
+                                            == X.upper_bound(k) - X.begin());
+                    bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                             X.equal_range(k);
+                    ASSERTV(i, k, R.first  == X.lower_bound(k));
+                    ASSERTV(i, k, R.second == X.upper_bound(k));
+                }
+            }
+
+            mX.reserve(200);
+            ASSERT(200 <= X.capacity());
+            mX.shrink_to_fit();
+            ASSERT(X.size() == X.capacity());
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Building a 'flat_set' in bulk from unsorted keys is faster than
+        //:   building a 'bsl::set' from the same keys.
+        //:
+        //: 2 Searching a 'flat_set' (with and without a lookup index) is
+        //:   faster than searching a 'bsl::set'.
+        //:
+        //: 3 A 'flat_set' allocates fewer bytes and blocks than a 'bsl::set'.
+        //
+        // Plan:
+        //: 1 For sets of several sizes, time the construction from a range of
+        //:   pseudo-random keys, and a fixed number of 'find' calls, of
+        //:   'bsl::set', 'flat_set', and 'flat_set' with a lookup index, and
+        //:   report the memory in use by each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int NUM_SEARCHES = 1000000;
+
+        const int SIZES[]   = { 1 << 6, 1 << 10, 1 << 14, 1 << 18, 1 << 21 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%9s | %9s %9s | %8s %8s %8s | %10s %10s\n",
+               "size", "build set", "flat", "find set", "flat", "index",
+               "bytes set", "flat");
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE = SIZES[si];
+
+            bsl::vector<int> keys;
+            unsigned int     seed = 12345;
+            for (int i = 0; i < SIZE; ++i) {
+                keys.push_back(static_cast<int>(nextRandom(&seed)));
+            }
+            bsl::vector<int> probes;
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                probes.push_back(keys[nextRandom(&seed) % SIZE]);
+            }
+
+            bslma::TestAllocator setAllocator;
+            bslma::TestAllocator flatAllocator;
+
+            bsls::Stopwatch timer;
+            double          elapsed[5];
+
+            timer.start();
+            bsl::set<int> set(keys.begin(),
+                              keys.end(),
+                              std::less<int>(),
+                              &setAllocator);
+            timer.stop();
+            elapsed[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            Obj flat(keys.begin(), keys.end(), std::less<int>(),
+                     &flatAllocator);
+            timer.stop();
+            elapsed[1] = timer.elapsedTime();
+
+            ASSERTV(SIZE, set.size() == flat.size());
+
+            const bsls::Types::Int64 SET_BYTES  = setAllocator.numBytesInUse();
+            const bsls::Types::Int64 FLAT_BYTES =
+                                               flatAllocator.numBytesInUse();
+
+            std::size_t found[3] = { 0, 0, 0 };
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                found[0] += set.find(probes[i]) != set.end();
+            }
+            timer.stop();
+            elapsed[2] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                found[1] += flat.find(probes[i]) != flat.end();
+            }
+            timer.stop();
+            elapsed[3] = timer.elapsedTime();
+
+            flat.build_lookup_index();
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_SEARCHES; ++i) {
+                found[2] += flat.find(probes[i]) != flat.end();
+            }
+            timer.stop();
+            elapsed[4] = timer.elapsedTime();
+
+            ASSERTV(SIZE, NUM_SEARCHES == (int)found[0]);
+            ASSERTV(SIZE, found[0] == found[1]);
+            ASSERTV(SIZE, found[0] == found[2]);
+
+            printf("%9d | %9.4f %9.4f | %8.1f %8.1f %8.1f | %10lld %10lld\n",
+                   SIZE,
+                   elapsed[0],
+                   elapsed[1],
+                   elapsed[2] * 1e9 / NUM_SEARCHES,
+                   elapsed[3] * 1e9 / NUM_SEARCHES,
+                   elapsed[4] * 1e9 / NUM_SEARCHES,
+                   SET_BYTES,
+                   FLAT_BYTES);
+        }
+        if (verbose) {
+            printf("build times are in seconds, find times in ns per call\n");
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    (void)veryVerbose;
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
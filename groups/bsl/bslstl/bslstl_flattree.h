@@ -0,0 +1,937 @@
+// bslstl_flattree.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#define INCLUDED_BSLSTL_FLATTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted-vector implementation of unique-key containers.
+//
+//@CLASSES:
+//  bslstl::FlatTree: sorted, contiguous sequence of values with unique keys
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmap, bslalg_searchutil
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::FlatTree',
+// that implements the common behavior of the "flat" associative containers,
+// 'bsl::flat_set' and 'bsl::flat_map'.  A 'FlatTree' stores its values in a
+// single 'bsl::vector', sorted by key and with no two values having
+// equivalent keys.  Compared with a node-based container such as 'bsl::set',
+// a 'FlatTree' performs a single allocation for all of its values, has no
+// per-element overhead, and is searched by a branch-free binary search (see
+// 'bslalg_searchutil') over contiguous memory.  In exchange, inserting or
+// erasing a single value is O[N], and any modification invalidates all
+// iterators and references to elements.  A 'FlatTree' is therefore best
+// suited to tables that are built once (preferably in bulk) and then
+// searched many times.
+//
+// The 'KEY_CONFIG' (template parameter) type is a policy identifying the key
+// of a value, having the same interface as the key configurations used by
+// 'bslstl::HashTable' (see 'bslstl_unorderedsetkeyconfiguration' and
+// 'bslstl_unorderedmapkeyconfiguration'):
+//..
+//  typedef ... ValueType;  // type of the values held by the container
+//  typedef ... KeyType;    // type of the keys of those values
+//
+//  static const KeyType& extractKey(const ValueType& value);
+//      // Return a reference providing non-modifiable access to the key of
+//      // the specified 'value'.
+//..
+//
+///Bulk Insertion
+///--------------
+// Inserting a range of values appends the whole range to the underlying
+// vector, sorts the appended values, discards those whose keys are
+// duplicated (within the range or by a value already present), and merges
+// the result with the previously held values.  Building a 'FlatTree' of 'N'
+// values from unsorted input therefore takes O[N * log(N)] time and a single
+// reallocation (plus one temporary buffer for the merge, if values were
+// previously present), rather than the O[N^2] time of 'N' single-value
+// insertions.  When the keys of the range are equivalent to one another, or
+// to the key of a value already held, the value retained is the one that was
+// already held, or, within the range, an unspecified one.
+//
+// Bulk insertion provides the strong exception-safety guarantee for the
+// values held: if an allocation, a copy of a value, or the comparator throws,
+// the appended values are erased, and the values held before the insertion
+// remain, unmodified and in order.
+//
+///Lookup Index
+///------------
+// For large tables that are searched very frequently, the 'buildLookupIndex'
+// method creates an auxiliary copy of the keys arranged in the Eytzinger
+// (breadth-first) layout, together with the position in the sorted sequence
+// of each copied key.  While the index is present, 'find', 'lowerBound', and
+// the methods built on them search the Eytzinger copy, which is
+// cache-friendlier than the sorted layout for tables much larger than the
+// last-level data cache (see 'bslalg_searchutil').  The index occupies
+// 'sizeof(KeyType) + sizeof(SizeType)' bytes per value and is discarded by
+// any method that modifies the sequence of values; it is never rebuilt
+// implicitly.  Note that the index is a pure optimization: the result of
+// every method is the same whether or not the index is present.  Also note
+// that a search using the index makes two more memory accesses than a search
+// of the sorted values (to map the Eytzinger position back to the sorted
+// position, and to compare the value found), so the index pays for itself
+// only for very large tables, and its benefit should be measured.
+//
+///Memory Allocation
+///-----------------
+// All memory, including that of the lookup index, is supplied by (copies of)
+// the allocator supplied at construction, following the allocator-propagation
+// rules of 'bsl::vector'.
+//
+///Usage
+///-----
+// This component is for use by the 'bslstl' package.  Other clients should
+// use 'bsl::flat_set' or 'bsl::flat_map' (see 'bslstl_flatset' and
+// 'bslstl_flatmap').
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SEARCHUTIL
+#include <bslalg_searchutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                              // ==============
+                              // class FlatTree
+                              // ==============
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class FlatTree {
+    // This class template implements a value-semantic container holding a
+    // sequence of values (of type 'KEY_CONFIG::ValueType'), sorted by their
+    // keys (of type 'KEY_CONFIG::KeyType') according to a comparator (of the
+    // template parameter type 'COMPARATOR'), in which no two values have
+    // equivalent keys.  The values are held contiguously in a 'bsl::vector'
+    // using an allocator of the template parameter type 'ALLOCATOR'.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType                KeyType;
+    typedef typename KEY_CONFIG::ValueType              ValueType;
+    typedef bsl::vector<ValueType, ALLOCATOR>           Container;
+    typedef typename Container::size_type               SizeType;
+    typedef typename Container::iterator                Iterator;
+    typedef typename Container::const_iterator          ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef typename ALLOCATOR::template rebind<KeyType>::other
+                                                        KeyAllocator;
+    typedef typename ALLOCATOR::template rebind<SizeType>::other
+                                                        PositionAllocator;
+    typedef bsl::vector<KeyType, KeyAllocator>          KeyContainer;
+    typedef bsl::vector<SizeType, PositionAllocator>    PositionContainer;
+
+    class ValueComparator {
+        // This class compares two values by their keys.
+
+        // DATA
+        const COMPARATOR& d_comparator;  // key comparator (held, not owned)
+
+      public:
+        // CREATORS
+        explicit ValueComparator(const COMPARATOR& comparator)
+            // Create a comparator that uses the specified 'comparator'.
+        : d_comparator(comparator)
+        {
+        }
+
+        // ACCESSORS
+        bool operator()(const ValueType& lhs, const ValueType& rhs) const
+            // Return 'true' if the key of the specified 'lhs' is ordered
+            // before the key of the specified 'rhs', and 'false' otherwise.
+        {
+            return d_comparator(KEY_CONFIG::extractKey(lhs),
+                                KEY_CONFIG::extractKey(rhs));
+        }
+    };
+
+    class ValueKeyComparator {
+        // This class compares a value with a key, as required by
+        // 'bslalg::SearchUtil::lowerBound'.
+
+        // DATA
+        const COMPARATOR& d_comparator;  // key comparator (held, not owned)
+
+      public:
+        // CREATORS
+        explicit ValueKeyComparator(const COMPARATOR& comparator)
+            // Create a comparator that uses the specified 'comparator'.
+        : d_comparator(comparator)
+        {
+        }
+
+        // ACCESSORS
+        bool operator()(const ValueType& value, const KeyType& key) const
+            // Return 'true' if the key of the specified 'value' is ordered
+            // before the specified 'key', and 'false' otherwise.
+        {
+            return d_comparator(KEY_CONFIG::extractKey(value), key);
+        }
+    };
+
+    class KeyValueComparator {
+        // This class compares a key with a value, as required by
+        // 'bslalg::SearchUtil::upperBound'.
+
+        // DATA
+        const COMPARATOR& d_comparator;  // key comparator (held, not owned)
+
+      public:
+        // CREATORS
+        explicit KeyValueComparator(const COMPARATOR& comparator)
+            // Create a comparator that uses the specified 'comparator'.
+        : d_comparator(comparator)
+        {
+        }
+
+        // ACCESSORS
+        bool operator()(const KeyType& key, const ValueType& value) const
+            // Return 'true' if the specified 'key' is ordered before the key
+            // of the specified 'value', and 'false' otherwise.
+        {
+            return d_comparator(key, KEY_CONFIG::extractKey(value));
+        }
+    };
+
+    class TailProctor {
+        // This class implements a proctor that, unless its 'release' method
+        // is called, erases on destruction the values of a container at and
+        // after a given position, so as to restore the container to the state
+        // it had before values were appended to it.
+
+        // DATA
+        Container *d_container_p;  // guarded container (held, not owned), or
+                                   // 0 if released
+
+        SizeType   d_position;     // position of the first value to erase
+
+      private:
+        // NOT IMPLEMENTED
+        TailProctor(const TailProctor&);
+        TailProctor& operator=(const TailProctor&);
+
+      public:
+        // CREATORS
+        TailProctor(Container *container, SizeType position)
+            // Create a proctor guarding the values of the specified
+            // 'container' at and after the specified 'position'.
+        : d_container_p(container)
+        , d_position(position)
+        {
+        }
+
+        ~TailProctor()
+            // Erase the guarded values, unless this proctor was released.
+        {
+            if (d_container_p) {
+                d_container_p->erase(d_container_p->begin() + d_position,
+                                     d_container_p->end());
+            }
+        }
+
+        // MANIPULATORS
+        void release()
+            // Release from management the values guarded by this proctor.
+        {
+            d_container_p = 0;
+        }
+    };
+
+    // DATA
+    Container         d_values;           // sorted values having unique keys
+
+    KeyContainer      d_lookupKeys;       // keys of 'd_values' in Eytzinger
+                                          // order, or empty if there is no
+                                          // lookup index
+
+    PositionContainer d_lookupPositions;  // position in 'd_values' of each
+                                          // element of 'd_lookupKeys'
+
+    COMPARATOR        d_comparator;       // key comparator
+
+  private:
+    // PRIVATE MANIPULATORS
+    void mergeTail(SizeType numSorted);
+        // Sort the values in 'd_values' at positions '[numSorted, size())',
+        // discard those whose keys are equivalent to that of a preceding
+        // value in the range or to that of a value in '[0, numSorted)', and
+        // merge the remaining values with those in '[0, numSorted)'.  If an
+        // exception is thrown, the values at positions '[0, numSorted)' are
+        // unchanged, and those after them are in a valid but unspecified
+        // state.  The behavior is undefined unless the values at positions
+        // '[0, numSorted)' are sorted and have unique keys.
+
+    // PRIVATE ACCESSORS
+    SizeType lowerBoundPosition(const KeyType& key) const;
+        // Return the position of the first value whose key is not ordered
+        // before the specified 'key', or 'size()' if there is no such value,
+        // using the lookup index if it is present.
+
+  public:
+    // CREATORS
+    FlatTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+        // Create an empty flat tree that orders keys using the specified
+        // 'comparator' and uses the specified 'allocator' to supply memory.
+
+    FlatTree(const FlatTree& original);
+        // Create a flat tree having the same value, comparator, and lookup
+        // index (if any) as the specified 'original'.  Use the allocator
+        // returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.allocator())' to
+        // supply memory.
+
+    FlatTree(const FlatTree& original, const ALLOCATOR& allocator);
+        // Create a flat tree having the same value, comparator, and lookup
+        // index (if any) as the specified 'original' that uses the specified
+        // 'allocator' to supply memory.
+
+    //! ~FlatTree() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this object the value, comparator, and lookup index (if
+        // any) of the specified 'rhs' object, propagating the allocator of
+        // 'rhs' according to the rules of 'bsl::vector', and return a
+        // reference providing modifiable access to this object.
+
+    Iterator begin();
+        // Return an iterator referring to the first value in this tree, or
+        // 'end()' if this tree is empty.
+
+    Iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    bsl::pair<Iterator, bool> insert(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if no value
+        // having an equivalent key is present.  Return a pair whose 'first'
+        // member refers to the value in this tree having the key of 'value',
+        // and whose 'second' member is 'true' if 'value' was inserted and
+        // 'false' otherwise.
+
+    Iterator insert(ConstIterator hint, const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if no value
+        // having an equivalent key is present, and return an iterator
+        // referring to the value in this tree having the key of 'value'.  If
+        // the specified 'hint' is the position at which 'value' would be
+        // inserted, no search is performed.  The behavior is undefined unless
+        // 'hint' is a valid iterator into this tree.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree a copy of each value in the range
+        // '[first, last)' whose key is equivalent neither to the key of a
+        // value already present nor to that of another value in the range
+        // (see {Bulk Insertion}).  If an exception is thrown, this tree is
+        // left unchanged, except that its lookup index may be discarded.
+
+    Iterator erase(ConstIterator position);
+        // Remove the value at the specified 'position' from this tree, and
+        // return an iterator referring to the value that followed it, or
+        // 'end()' if there was none.  The behavior is undefined unless
+        // 'position' refers to a value in this tree.
+
+    SizeType erase(const KeyType& key);
+        // Remove the value having the specified 'key' from this tree, if any,
+        // and return the number of values removed (0 or 1).
+
+    Iterator erase(ConstIterator first, ConstIterator last);
+        // Remove the values in the specified range '[first, last)' from this
+        // tree, and return an iterator referring to the value that followed
+        // the range, or 'end()' if there was none.  The behavior is undefined
+        // unless '[first, last)' is a valid range of this tree.
+
+    void clear();
+        // Remove all values from this tree, retaining allocated memory.
+
+    void reserve(SizeType numValues);
+        // Allocate sufficient memory to hold at least the specified
+        // 'numValues' without reallocation.
+
+    void shrinkToFit();
+        // Release, if possible, unused capacity held by this tree.
+
+    void swap(FlatTree& other);
+        // Exchange the value, comparator, and lookup index of this object
+        // with those of the specified 'other' object, exchanging allocators
+        // according to the rules of 'bsl::vector'.
+
+    void buildLookupIndex();
+        // Create (or recreate) the lookup index of this tree (see
+        // {Lookup Index}).  Note that the index is discarded by any
+        // subsequent modification of this tree.
+
+    void releaseLookupIndex();
+        // Discard the lookup index of this tree, if any, and release the
+        // memory it occupies.
+
+    Iterator find(const KeyType& key);
+        // Return an iterator referring to the value in this tree having the
+        // specified 'key', or 'end()' if there is no such value.
+
+    Iterator lowerBound(const KeyType& key);
+        // Return an iterator referring to the first value in this tree whose
+        // key is not ordered before the specified 'key', or 'end()' if there
+        // is no such value.
+
+    Iterator upperBound(const KeyType& key);
+        // Return an iterator referring to the first value in this tree whose
+        // key is ordered after the specified 'key', or 'end()' if there is no
+        // such value.
+
+    // ACCESSORS
+    ConstIterator begin() const;
+        // Return an iterator referring to the first value in this tree, or
+        // 'end()' if this tree is empty.
+
+    ConstIterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    ConstIterator find(const KeyType& key) const;
+        // Return an iterator referring to the value in this tree having the
+        // specified 'key', or 'end()' if there is no such value.
+
+    ConstIterator lowerBound(const KeyType& key) const;
+        // Return an iterator referring to the first value in this tree whose
+        // key is not ordered before the specified 'key', or 'end()' if there
+        // is no such value.
+
+    ConstIterator upperBound(const KeyType& key) const;
+        // Return an iterator referring to the first value in this tree whose
+        // key is ordered after the specified 'key', or 'end()' if there is no
+        // such value.
+
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator used by this tree.
+
+    SizeType capacity() const;
+        // Return the number of values this tree can hold without
+        // reallocation.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // comparator of this tree.
+
+    bool hasLookupIndex() const;
+        // Return 'true' if this tree currently has a lookup index, and
+        // 'false' otherwise.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of values this tree
+        // can hold.
+
+    SizeType size() const;
+        // Return the number of values in this tree.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // --------------
+                              // class FlatTree
+                              // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeTail(SizeType numSorted)
+{
+    BSLS_ASSERT_SAFE(numSorted <= d_values.size());
+
+    const ValueComparator valueComparator(d_comparator);
+
+    Iterator tail = d_values.begin() + numSorted;
+    native_std::sort(tail, d_values.end(), valueComparator);
+
+    // Remove the duplicates within the tail, keeping the first of each run of
+    // equivalent keys.
+
+    Iterator last = tail;
+    for (Iterator it = tail; it != d_values.end(); ++it) {
+        if (last == tail || valueComparator(*(last - 1), *it)) {
+            if (last != it) {
+                *last = *it;
+            }
+            ++last;
+        }
+    }
+    d_values.erase(last, d_values.end());
+
+    tail = d_values.begin() + numSorted;
+    if (0 == numSorted
+     || tail == d_values.end()
+     || valueComparator(*(tail - 1), *tail)) {
+        // Either there is nothing to merge, or the tail sorts entirely after
+        // the previously held values (the common case of appending sorted
+        // data), so the sequence is already sorted.
+
+        return;                                                       // RETURN
+    }
+
+    Container merged(d_values.get_allocator());
+    merged.reserve(d_values.size());
+
+    ConstIterator head    = d_values.begin();
+    ConstIterator headEnd = d_values.begin() + numSorted;
+    ConstIterator next    = headEnd;
+    while (head != headEnd && next != d_values.end()) {
+        if (valueComparator(*next, *head)) {
+            merged.push_back(*next++);
+        }
+        else {
+            if (!valueComparator(*head, *next)) {
+                ++next;  // equivalent key: keep the previously held value
+            }
+            merged.push_back(*head++);
+        }
+    }
+    merged.insert(merged.end(), head, headEnd);
+    merged.insert(merged.end(), next, ConstIterator(d_values.end()));
+
+    d_values.swap(merged);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBoundPosition(
+                                                     const KeyType& key) const
+{
+    if (!d_lookupPositions.empty()) {
+        const SizeType position = bslalg::SearchUtil::eytzingerLowerBound(
+                                                         d_lookupKeys.begin(),
+                                                         d_lookupKeys.size(),
+                                                         key,
+                                                         d_comparator);
+        return d_lookupKeys.size() == position
+               ? d_values.size()
+               : d_lookupPositions[position];                         // RETURN
+    }
+
+    return bslalg::SearchUtil::lowerBound(d_values.begin(),
+                                          d_values.end(),
+                                          key,
+                                          ValueKeyComparator(d_comparator))
+         - d_values.begin();
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                                  const COMPARATOR& comparator,
+                                                  const ALLOCATOR&  allocator)
+: d_values(allocator)
+, d_lookupKeys(KeyAllocator(allocator))
+, d_lookupPositions(PositionAllocator(allocator))
+, d_comparator(comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                                      const FlatTree& original)
+: d_values(original.d_values)
+, d_lookupKeys(original.d_lookupKeys,
+               KeyAllocator(d_values.get_allocator()))
+, d_lookupPositions(original.d_lookupPositions,
+                    PositionAllocator(d_values.get_allocator()))
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                                   const FlatTree&  original,
+                                                   const ALLOCATOR& allocator)
+: d_values(original.d_values, allocator)
+, d_lookupKeys(original.d_lookupKeys, KeyAllocator(allocator))
+, d_lookupPositions(original.d_lookupPositions, PositionAllocator(allocator))
+, d_comparator(original.d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const FlatTree& rhs)
+{
+    if (this != &rhs) {
+        d_values          = rhs.d_values;
+        d_lookupKeys      = rhs.d_lookupKeys;
+        d_lookupPositions = rhs.d_lookupPositions;
+        d_comparator      = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(const ValueType& value)
+{
+    const KeyType&  key      = KEY_CONFIG::extractKey(value);
+    const SizeType  position = lowerBoundPosition(key);
+
+    if (position != d_values.size()
+     && !d_comparator(key, KEY_CONFIG::extractKey(d_values[position]))) {
+        return bsl::pair<Iterator, bool>(d_values.begin() + position,
+                                         false);                      // RETURN
+    }
+
+    releaseLookupIndex();
+    return bsl::pair<Iterator, bool>(
+                           d_values.insert(d_values.begin() + position, value),
+                           true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(ConstIterator    hint,
+                                                    const ValueType& value)
+{
+    BSLS_ASSERT_SAFE(d_values.begin() <= hint);
+    BSLS_ASSERT_SAFE(hint <= d_values.end());
+
+    const ValueComparator valueComparator(d_comparator);
+
+    if ((hint == d_values.end()   || valueComparator(value, *hint))
+     && (hint == d_values.begin() || valueComparator(*(hint - 1), value))) {
+        releaseLookupIndex();
+        return d_values.insert(d_values.begin() + (hint - d_values.begin()),
+                               value);                                // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    const SizeType numSorted = d_values.size();
+
+    // 'mergeTail' modifies only the appended values until its final,
+    // non-throwing, 'swap', so erasing them if an exception is thrown (by an
+    // allocation, a copy, or the comparator) restores the previous value.
+
+    TailProctor proctor(&d_values, numSorted);
+
+    d_values.insert(d_values.end(), first, last);
+    if (numSorted != d_values.size()) {
+        releaseLookupIndex();
+        mergeTail(numSorted);
+    }
+    proctor.release();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(d_values.begin() <= position);
+    BSLS_ASSERT_SAFE(position < d_values.end());
+
+    releaseLookupIndex();
+    return d_values.erase(d_values.begin() + (position - d_values.begin()));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(const KeyType& key)
+{
+    const Iterator it = find(key);
+    if (it == d_values.end()) {
+        return 0;                                                     // RETURN
+    }
+    erase(it);
+    return 1;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator first,
+                                                   ConstIterator last)
+{
+    BSLS_ASSERT_SAFE(d_values.begin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= d_values.end());
+
+    if (first != last) {
+        releaseLookupIndex();
+    }
+    return d_values.erase(d_values.begin() + (first - d_values.begin()),
+                          d_values.begin() + (last  - d_values.begin()));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::clear()
+{
+    releaseLookupIndex();
+    d_values.clear();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::reserve(SizeType numValues)
+{
+    d_values.reserve(numValues);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::shrinkToFit()
+{
+    d_values.shrink_to_fit();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(FlatTree& other)
+{
+    d_values.swap(other.d_values);
+    d_lookupKeys.swap(other.d_lookupKeys);
+    d_lookupPositions.swap(other.d_lookupPositions);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::buildLookupIndex()
+{
+    const SizeType numValues = d_values.size();
+
+    PositionContainer positions(numValues,
+                                SizeType(),
+                                d_lookupPositions.get_allocator());
+    if (numValues) {
+        bslalg::SearchUtil::buildEytzingerPermutation(&positions[0],
+                                                      numValues);
+    }
+
+    KeyContainer keys(d_lookupKeys.get_allocator());
+    keys.reserve(numValues);
+    for (SizeType i = 0; i < numValues; ++i) {
+        keys.push_back(KEY_CONFIG::extractKey(d_values[positions[i]]));
+    }
+
+    d_lookupKeys.swap(keys);
+    d_lookupPositions.swap(positions);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::releaseLookupIndex()
+{
+    if (!d_lookupPositions.empty()) {
+        KeyContainer(d_lookupKeys.get_allocator()).swap(d_lookupKeys);
+        PositionContainer(d_lookupPositions.get_allocator()).swap(
+                                                            d_lookupPositions);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key)
+{
+    return d_values.begin() + (static_cast<const FlatTree *>(this)->find(key)
+                                                          - d_values.begin());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key)
+{
+    return d_values.begin() + lowerBoundPosition(key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key)
+{
+    return bslalg::SearchUtil::upperBound(d_values.begin(),
+                                          d_values.end(),
+                                          key,
+                                          KeyValueComparator(d_comparator));
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    const SizeType position = lowerBoundPosition(key);
+    return position == d_values.size()
+        || d_comparator(key, KEY_CONFIG::extractKey(d_values[position]))
+           ? d_values.end()
+           : d_values.begin() + position;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                      const KeyType& key) const
+{
+    return d_values.begin() + lowerBoundPosition(key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(
+                                                      const KeyType& key) const
+{
+    return bslalg::SearchUtil::upperBound(d_values.begin(),
+                                          d_values.end(),
+                                          key,
+                                          KeyValueComparator(d_comparator));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_values.get_allocator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_values.capacity();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::hasLookupIndex() const
+{
+    return !d_lookupPositions.empty();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return d_values.max_size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_values.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,934 @@
+// bslstl_flattree.t.cpp                                              -*-C++-*-
+#include <bslstl_flattree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is an in-core, value-semantic container
+// implementation.  Each manipulator is tested by applying it, together with
+// the equivalent operation on a 'std::set' or 'std::map' oracle, to objects
+// built from pseudo-random sequences of keys, and verifying after each step
+// that the object holds exactly the values of the oracle, in order.  The
+// lookup index is verified by repeating every search with and without the
+// index, and memory allocation is monitored using 'bslma::TestAllocator'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] FlatTree(const COMPARATOR&, const ALLOCATOR&);
+// [ 6] FlatTree(const FlatTree&);
+// [ 6] FlatTree(const FlatTree&, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 6] FlatTree& operator=(const FlatTree&);
+// [ 2] pair<Iterator, bool> insert(const ValueType&);
+// [ 2] Iterator insert(ConstIterator, const ValueType&);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 7] void insert(INPUT_ITERATOR, INPUT_ITERATOR); // exception safety
+// [ 4] Iterator erase(ConstIterator);
+// [ 4] SizeType erase(const KeyType&);
+// [ 4] Iterator erase(ConstIterator, ConstIterator);
+// [ 4] void clear();
+// [ 6] void reserve(SizeType);
+// [ 6] void shrinkToFit();
+// [ 6] void swap(FlatTree&);
+// [ 5] void buildLookupIndex();
+// [ 5] void releaseLookupIndex();
+// [ 2] Iterator find(const KeyType&);
+// [ 2] Iterator lowerBound(const KeyType&);
+// [ 2] Iterator upperBound(const KeyType&);
+//
+// ACCESSORS
+// [ 2] ConstIterator find(const KeyType&) const;
+// [ 2] ConstIterator lowerBound(const KeyType&) const;
+// [ 2] ConstIterator upperBound(const KeyType&) const;
+// [ 6] ALLOCATOR allocator() const;
+// [ 6] SizeType capacity() const;
+// [ 1] const COMPARATOR& comparator() const;
+// [ 5] bool hasLookupIndex() const;
+// [ 1] SizeType size() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::UnorderedSetKeyConfiguration<int>      SetConfig;
+typedef bslstl::FlatTree<SetConfig,
+                         std::less<int>,
+                         bsl::allocator<int> >         Obj;
+
+typedef bsl::pair<int, int>                            Pair;
+typedef bslstl::UnorderedMapKeyConfiguration<Pair>     MapConfig;
+typedef bslstl::FlatTree<MapConfig,
+                         std::less<int>,
+                         bsl::allocator<Pair> >        MapObj;
+
+typedef bslstl::UnorderedSetKeyConfiguration<bsl::string>
+                                                       StringConfig;
+typedef bslstl::FlatTree<StringConfig,
+                         std::less<bsl::string>,
+                         bsl::allocator<bsl::string> > StringObj;
+
+namespace {
+
+struct ComparatorException {
+    // This 'struct' is the type of the exception thrown by 'ThrowingLess'.
+};
+
+class ThrowingLess {
+    // This class orders 'int' values as 'std::less<int>' does, but throws a
+    // 'ComparatorException' instead of performing the comparison when a
+    // countdown of comparisons, shared by all copies of the comparator,
+    // reaches 0.
+
+    // DATA
+    int *d_countdown_p;  // number of comparisons left before throwing, or a
+                         // negative number for no limit (held, not owned)
+
+  public:
+    // CREATORS
+    explicit ThrowingLess(int *countdown)
+        // Create a comparator that counts its comparisons down from the value
+        // at the specified 'countdown', if that value is not negative.
+    : d_countdown_p(countdown)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs < rhs' for the specified 'lhs' and 'rhs', or throw a
+        // 'ComparatorException' (and disable the countdown) if the countdown
+        // has reached 0.
+    {
+        if (0 == *d_countdown_p) {
+            *d_countdown_p = -1;
+            throw ComparatorException();
+        }
+        if (0 < *d_countdown_p) {
+            --*d_countdown_p;
+        }
+        return lhs < rhs;
+    }
+};
+
+typedef bslstl::FlatTree<SetConfig,
+                         ThrowingLess,
+                         bsl::allocator<int> >         ThrowingObj;
+
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' and return a pseudo-random value derived
+    // from it.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+template <class OBJECT, class VALUE>
+bool verify(const OBJECT& object, const std::set<VALUE>& oracle)
+    // Return 'true' if the specified 'object' holds exactly the values of the
+    // specified 'oracle', in order, and 'false' otherwise.
+{
+    return object.size() == oracle.size()
+        && std::equal(oracle.begin(), oracle.end(), object.begin());
+}
+
+void verifySearches(const Obj& object, const std::set<int>& oracle, int max)
+    // Verify that every search of the specified 'object' for each key in
+    // '[-1, max]' agrees with the same search of the specified 'oracle'.
+{
+    for (int key = -1; key <= max; ++key) {
+        const std::set<int>::const_iterator EXP_L = oracle.lower_bound(key);
+        const std::set<int>::const_iterator EXP_U = oracle.upper_bound(key);
+        const std::set<int>::const_iterator EXP_F = oracle.find(key);
+
+        const Obj::ConstIterator L = object.lowerBound(key);
+        const Obj::ConstIterator U = object.upperBound(key);
+        const Obj::ConstIterator F = object.find(key);
+
+        ASSERTV(key, std::distance(oracle.begin(), EXP_L)
+                                                     == L - object.begin());
+        ASSERTV(key, std::distance(oracle.begin(), EXP_U)
+                                                     == U - object.begin());
+        ASSERTV(key, (EXP_F == oracle.end()) == (F == object.end()));
+        if (F != object.end()) {
+            ASSERTV(key, *F == key);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF RANGE INSERTION
+        //
+        // Concerns:
+        //: 1 If an allocation or the copy of a value throws during the
+        //:   insertion of a range, the tree keeps the values it held before
+        //:   the insertion, sorted and unique, and no memory is leaked.
+        //:
+        //: 2 If the comparator throws during the insertion of a range, the
+        //:   tree keeps the values it held before the insertion, and every
+        //:   search finds them.
+        //:
+        //: 3 Both concerns hold whether the range sorts after the values
+        //:   held or must be merged with them.
+        //
+        // Plan:
+        //: 1 Insert ranges of strings too long for the short-string buffer,
+        //:   whose copies therefore allocate, into a tree of such strings,
+        //:   under the 'bslma' exception-test macros, verifying at the start
+        //:   of each attempt that the tree is unchanged.  (C-1, 3)
+        //:
+        //: 2 Insert ranges of 'int' values into a tree using a comparator
+        //:   that throws after a given number of comparisons, for every such
+        //:   number until the insertion succeeds, and verify the value and
+        //:   the searches of the tree after each exception.  (C-2..3)
+        //
+        // Testing:
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR); // exception safety
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY OF RANGE INSERTION"
+                            "\n===================================\n");
+
+        const int DATA[]   = { 0, 2, 4, 6, 8 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MERGED[]   = { 9, 7, 5, 3, 1, 2, 4 };
+        const int APPENDED[] = { 12, 10, 11, 10 };
+
+        static const struct {
+            int        d_line;     // source line number
+            const int *d_keys_p;   // keys to insert
+            int        d_length;   // number of keys to insert
+        } RANGES[] = {
+            { L_, MERGED,   sizeof MERGED   / sizeof *MERGED   },
+            { L_, APPENDED, sizeof APPENDED / sizeof *APPENDED },
+        };
+        const int NUM_RANGES = sizeof RANGES / sizeof *RANGES;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\tThrowing allocations and copies.\n");
+
+        for (int ri = 0; ri < NUM_RANGES; ++ri) {
+            const int  LINE   = RANGES[ri].d_line;
+            const int *KEYS   = RANGES[ri].d_keys_p;
+            const int  LENGTH = RANGES[ri].d_length;
+
+            std::vector<bsl::string> initial;
+            std::vector<bsl::string> range;
+            for (int i = 0; i < NUM_DATA + LENGTH; ++i) {
+                char buffer[64];
+                snprintf(buffer,
+                         sizeof buffer,
+                         "%02d: a string too long for the short buffer",
+                         i < NUM_DATA ? DATA[i] : KEYS[i - NUM_DATA]);
+                (i < NUM_DATA ? initial : range).push_back(buffer);
+            }
+            const std::set<bsl::string> EXP_INITIAL(initial.begin(),
+                                                    initial.end());
+            std::set<bsl::string> expected(EXP_INITIAL);
+            expected.insert(range.begin(), range.end());
+
+            {
+                StringObj mX(std::less<bsl::string>(), &oa);
+                const StringObj& X = mX;
+                mX.insert(initial.begin(), initial.end());
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, verify(X, EXP_INITIAL));
+
+                    mX.insert(range.begin(), range.end());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, verify(X, expected));
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tThrowing comparator.\n");
+
+        for (int ri = 0; ri < NUM_RANGES; ++ri) {
+            const int  LINE   = RANGES[ri].d_line;
+            const int *KEYS   = RANGES[ri].d_keys_p;
+            const int  LENGTH = RANGES[ri].d_length;
+
+            const std::set<int> EXP_INITIAL(DATA, DATA + NUM_DATA);
+            std::set<int> expected(EXP_INITIAL);
+            expected.insert(KEYS, KEYS + LENGTH);
+
+            int  numThrows = 0;
+            bool done      = false;
+            for (int limit = 0; !done; ++limit) {
+                int countdown = -1;
+
+                ThrowingObj mX(ThrowingLess(&countdown), &oa);
+                const ThrowingObj& X = mX;
+                mX.insert(DATA, DATA + NUM_DATA);
+
+                countdown = limit;
+                try {
+                    mX.insert(KEYS, KEYS + LENGTH);
+                    done = true;
+                }
+                catch (const ComparatorException&) {
+                    ++numThrows;
+                }
+                countdown = -1;
+
+                ASSERTV(LINE, limit, verify(X, done ? expected : EXP_INITIAL));
+                for (int i = 0; i < NUM_DATA; ++i) {
+                    ASSERTV(LINE, limit, i, X.end() != X.find(DATA[i]));
+                }
+            }
+            ASSERTV(LINE, 0 < numThrows);
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value, comparator, and lookup index as the
+        //:   original, and use the expected allocator.
+        //:
+        //: 2 Assignment and 'swap' exchange value and lookup index.
+        //:
+        //: 3 'reserve' and 'shrinkToFit' adjust only the capacity.
+        //:
+        //: 4 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Build an object with a lookup index, copy it with and without an
+        //:   allocator, assign and swap it, and verify value, index, and
+        //:   allocator after each operation.  (C-1..2, 4)
+        //:
+        //: 2 Reserve, then shrink, and verify capacity and value.  (C-3)
+        //
+        // Testing:
+        //   FlatTree(const FlatTree&);
+        //   FlatTree(const FlatTree&, const ALLOCATOR&);
+        //   FlatTree& operator=(const FlatTree&);
+        //   void reserve(SizeType);
+        //   void shrinkToFit();
+        //   void swap(FlatTree&);
+        //   ALLOCATOR allocator() const;
+        //   SizeType capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND CAPACITY"
+                            "\n====================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const int DATA[] = { 5, 1, 4, 2, 3 };
+        std::set<int> oracle(DATA, DATA + 5);
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            mX.insert(DATA, DATA + 5);
+            mX.buildLookupIndex();
+
+            const bsls::Types::Int64 NUM_DEFAULT =
+                                          defaultAllocator.numBlocksInUse();
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(verify(Y, oracle));
+            ASSERT(Y.hasLookupIndex());
+            ASSERT(&defaultAllocator == Y.allocator().mechanism());
+            ASSERT(NUM_DEFAULT < defaultAllocator.numBlocksInUse());
+
+            Obj mZ(X, &sa);  const Obj& Z = mZ;
+            ASSERT(verify(Z, oracle));
+            ASSERT(Z.hasLookupIndex());
+            ASSERT(&sa == Z.allocator().mechanism());
+            ASSERT(0 < sa.numBlocksInUse());
+            verifySearches(Z, oracle, 6);
+
+            Obj mW(std::less<int>(), &sa);  const Obj& W = mW;
+            mW = X;
+            ASSERT(verify(W, oracle));
+            ASSERT(W.hasLookupIndex());
+            ASSERT(&sa == W.allocator().mechanism());
+
+            Obj mE(std::less<int>(), &sa);  const Obj& E = mE;
+            mE.swap(mZ);
+            ASSERT(verify(E, oracle));
+            ASSERT(E.hasLookupIndex());
+            ASSERT(0 == Z.size());
+            ASSERT(!Z.hasLookupIndex());
+            verifySearches(E, oracle, 6);
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+            ASSERT(verify(X, oracle));
+            mX.shrinkToFit();
+            ASSERT(5 == X.capacity());
+            ASSERT(verify(X, oracle));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // LOOKUP INDEX
+        //
+        // Concerns:
+        //: 1 Every search returns the same result with and without the index.
+        //:
+        //: 2 The index is discarded by every modification, and not otherwise.
+        //:
+        //: 3 'releaseLookupIndex' releases the memory of the index.
+        //
+        // Plan:
+        //: 1 For trees of every size up to a bound, build the index and
+        //:   repeat the searches of every key, comparing against the oracle.
+        //:   (C-1)
+        //:
+        //: 2 Apply each manipulator to a tree with an index and verify
+        //:   'hasLookupIndex'.  (C-2)
+        //:
+        //: 3 Verify the memory in use before and after releasing the index.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void buildLookupIndex();
+        //   void releaseLookupIndex();
+        //   bool hasLookupIndex() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP INDEX"
+                            "\n============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int len = 0; len <= 40; ++len) {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            std::set<int> oracle;
+            for (int i = 0; i < len; ++i) {
+                mX.insert(2 * i);
+                oracle.insert(2 * i);
+            }
+            mX.buildLookupIndex();
+            ASSERTV(len, X.hasLookupIndex() == (0 != len));
+            verifySearches(X, oracle, 2 * len + 1);
+        }
+
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(2 * i);
+            }
+
+            mX.buildLookupIndex();
+            ASSERT(X.hasLookupIndex());
+            ASSERT(!mX.insert(4).second);
+            ASSERT(X.hasLookupIndex());
+            ASSERT(0 == mX.erase(5));
+            ASSERT(X.hasLookupIndex());
+            mX.reserve(1000);
+            ASSERT(X.hasLookupIndex());
+
+            mX.insert(5);
+            ASSERT(!X.hasLookupIndex());
+
+            mX.buildLookupIndex();
+            mX.insert(X.end(), 100);
+            ASSERT(!X.hasLookupIndex());
+
+            mX.buildLookupIndex();
+            mX.erase(5);
+            ASSERT(!X.hasLookupIndex());
+
+            mX.buildLookupIndex();
+            mX.erase(X.begin());
+            ASSERT(!X.hasLookupIndex());
+
+            mX.buildLookupIndex();
+            mX.erase(X.begin(), X.begin() + 2);
+            ASSERT(!X.hasLookupIndex());
+
+            const int MORE[] = { 1, 3 };
+            mX.buildLookupIndex();
+            mX.insert(MORE, MORE + 2);
+            ASSERT(!X.hasLookupIndex());
+
+            mX.buildLookupIndex();
+            const bsls::Types::Int64 NUM_BYTES = oa.numBytesInUse();
+            mX.releaseLookupIndex();
+            ASSERT(!X.hasLookupIndex());
+            ASSERT(NUM_BYTES > oa.numBytesInUse());
+
+            mX.buildLookupIndex();
+            mX.clear();
+            ASSERT(!X.hasLookupIndex());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ERASE AND CLEAR
+        //
+        // Concerns:
+        //: 1 Each 'erase' overload removes exactly the specified values and
+        //:   returns the documented result.
+        //:
+        //: 2 'clear' removes all values and retains capacity.
+        //
+        // Plan:
+        //: 1 Erase pseudo-random keys, positions, and ranges from trees built
+        //:   from pseudo-random keys, verifying against the oracle after each
+        //:   step.  (C-1)
+        //:
+        //: 2 Clear a tree and verify its size and capacity.  (C-2)
+        //
+        // Testing:
+        //   Iterator erase(ConstIterator);
+        //   SizeType erase(const KeyType&);
+        //   Iterator erase(ConstIterator, ConstIterator);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE AND CLEAR"
+                            "\n===============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        unsigned int seed = 7;
+        for (int iteration = 0; iteration < 50; ++iteration) {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            std::set<int> oracle;
+
+            for (int i = 0; i < 60; ++i) {
+                const int key = nextRandom(&seed) % 100;
+                mX.insert(key);
+                oracle.insert(key);
+            }
+
+            for (int i = 0; i < 20 && !oracle.empty(); ++i) {
+                const int key = nextRandom(&seed) % 100;
+                const std::size_t EXP = oracle.erase(key);
+                ASSERTV(iteration, key, EXP == mX.erase(key));
+                ASSERTV(iteration, key, verify(X, oracle));
+
+                const int offset = static_cast<int>(nextRandom(&seed)
+                                                   % oracle.size());
+                std::set<int>::iterator ot = oracle.begin();
+                std::advance(ot, offset);
+                const int next = ++ot == oracle.end() ? -1 : *ot;
+                oracle.erase(--ot);
+
+                Obj::Iterator it = mX.erase(X.begin() + offset);
+                ASSERTV(iteration, offset, verify(X, oracle));
+                ASSERTV(iteration, offset,
+                        -1 == next ? X.end() == it : next == *it);
+            }
+
+            if (oracle.size() >= 2) {
+                const int half  = static_cast<int>(oracle.size() / 2);
+                const int first = nextRandom(&seed) % half;
+                const int last  = first + half;
+                std::set<int>::iterator ofirst = oracle.begin();
+                std::advance(ofirst, first);
+                std::set<int>::iterator olast = ofirst;
+                std::advance(olast, last - first);
+                oracle.erase(ofirst, olast);
+
+                Obj::Iterator it = mX.erase(X.begin() + first,
+                                            X.begin() + last);
+                ASSERTV(iteration, verify(X, oracle));
+                ASSERTV(iteration, X.begin() + first == it);
+            }
+
+            const Obj::SizeType CAPACITY = X.capacity();
+            mX.clear();
+            ASSERTV(iteration, 0        == X.size());
+            ASSERTV(iteration, CAPACITY == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting a range into an empty or non-empty tree yields the
+        //:   union of the keys, sorted and without duplicates, for ranges
+        //:   that are sorted, reverse sorted, or unordered, and that contain
+        //:   duplicates.
+        //:
+        //: 2 When a key in the range is equivalent to that of a value already
+        //:   present, the value already present is retained.
+        //:
+        //: 3 Inserting an empty range has no effect.
+        //:
+        //: 4 Inserting a sorted range after all present values (the append
+        //:   fast path) is handled.
+        //
+        // Plan:
+        //: 1 Insert pseudo-random ranges into pseudo-random trees of both set
+        //:   and map configurations, comparing with the oracle.  For the map
+        //:   configuration, give each inserted value a distinct mapped value
+        //:   and have the oracle retain the first.  (C-1..2)
+        //:
+        //: 2 Insert empty and appended ranges explicitly.  (C-3..4)
+        //
+        // Testing:
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE INSERTION"
+                            "\n===============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        unsigned int seed = 3;
+        for (int iteration = 0; iteration < 200; ++iteration) {
+            const int NUM_INITIAL = nextRandom(&seed) % 20;
+            const int NUM_RANGE   = nextRandom(&seed) % 40;
+            const int MAX_KEY     = 1 + nextRandom(&seed) % 60;
+            const int ORDER       = nextRandom(&seed) % 3;
+
+            Obj    mX(std::less<int>(), &oa);  const Obj&    X = mX;
+            MapObj mM(std::less<int>(), &oa);  const MapObj& M = mM;
+            std::set<int>      oracle;
+            std::map<int, int> mapOracle;
+
+            int mapped = 0;
+            for (int i = 0; i < NUM_INITIAL; ++i) {
+                const int key = nextRandom(&seed) % MAX_KEY;
+                mX.insert(key);
+                oracle.insert(key);
+                mM.insert(Pair(key, ++mapped));
+                mapOracle.insert(std::make_pair(key, mapped));
+            }
+
+            std::vector<int> range;
+            for (int i = 0; i < NUM_RANGE; ++i) {
+                range.push_back(nextRandom(&seed) % MAX_KEY);
+            }
+            if (1 == ORDER) {
+                std::sort(range.begin(), range.end());
+            }
+            else if (2 == ORDER) {
+                std::sort(range.begin(), range.end(), std::greater<int>());
+            }
+
+            std::vector<Pair> pairs;
+            for (std::size_t i = 0; i < range.size(); ++i) {
+                pairs.push_back(Pair(range[i], ++mapped));
+
+                // For keys repeated within the range, which duplicate is
+                // retained is unspecified, so the oracle keeps the value
+                // already present, or, failing that, any one value; compare
+                // mapped values only for keys present before the insertion.
+
+                mapOracle.insert(std::make_pair(range[i], 0));
+            }
+
+            oracle.insert(range.begin(), range.end());
+            mX.insert(range.begin(), range.end());
+            ASSERTV(iteration, verify(X, oracle));
+
+            mM.insert(pairs.begin(), pairs.end());
+            ASSERTV(iteration, mapOracle.size() == M.size());
+            MapObj::ConstIterator it = M.begin();
+            for (std::map<int, int>::const_iterator ot = mapOracle.begin();
+                 ot != mapOracle.end() && it != M.end();
+                 ++ot, ++it) {
+                ASSERTV(iteration, ot->first == it->first);
+                if (0 != ot->second) {
+                    ASSERTV(iteration, ot->first, ot->second == it->second);
+                }
+            }
+        }
+
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            const int DATA[] = { 1, 2, 3 };
+            mX.insert(DATA, DATA);
+            ASSERT(0 == X.size());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.insert(DATA, DATA + 3);
+            const int MORE[] = { 6, 4, 5, 4 };
+            mX.insert(MORE, MORE + 4);
+
+            std::set<int> oracle(DATA, DATA + 3);
+            oracle.insert(MORE, MORE + 4);
+            ASSERT(verify(X, oracle));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SINGLE-VALUE INSERTION AND SEARCH
+        //
+        // Concerns:
+        //: 1 'insert' adds a value only if its key is not present, and
+        //:   returns an iterator to the value having the key.
+        //:
+        //: 2 The hinted 'insert' produces the same result for correct and
+        //:   incorrect hints.
+        //:
+        //: 3 'find', 'lowerBound', and 'upperBound' agree with the oracle,
+        //:   and their 'const' and non-'const' overloads agree.
+        //:
+        //: 4 A value already in the tree can be inserted (aliasing).
+        //
+        // Plan:
+        //: 1 Insert pseudo-random keys, alternating between the overloads and
+        //:   between good and bad hints, verifying against the oracle after
+        //:   each step, and verify all searches at the end.  (C-1..3)
+        //:
+        //: 2 Re-insert each value of a tree by reference.  (C-4)
+        //
+        // Testing:
+        //   pair<Iterator, bool> insert(const ValueType&);
+        //   Iterator insert(ConstIterator, const ValueType&);
+        //   Iterator find(const KeyType&);
+        //   Iterator lowerBound(const KeyType&);
+        //   Iterator upperBound(const KeyType&);
+        //   ConstIterator find(const KeyType&) const;
+        //   ConstIterator lowerBound(const KeyType&) const;
+        //   ConstIterator upperBound(const KeyType&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-VALUE INSERTION AND SEARCH"
+                            "\n=================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        unsigned int seed = 1;
+        for (int iteration = 0; iteration < 20; ++iteration) {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            std::set<int> oracle;
+
+            for (int i = 0; i < 50; ++i) {
+                const int key  = nextRandom(&seed) % 80;
+                const int mode = nextRandom(&seed) % 3;
+
+                const bool EXP = oracle.insert(key).second;
+                if (0 == mode) {
+                    bsl::pair<Obj::Iterator, bool> result = mX.insert(key);
+                    ASSERTV(iteration, key, EXP == result.second);
+                    ASSERTV(iteration, key, key == *result.first);
+                }
+                else {
+                    const Obj::ConstIterator hint = 1 == mode
+                                                    ? X.lowerBound(key)
+                                                    : X.begin()
+                                                    + nextRandom(&seed)
+                                                             % (X.size() + 1);
+                    const Obj::SizeType SIZE = X.size();
+                    Obj::Iterator it = mX.insert(hint, key);
+                    ASSERTV(iteration, key, key == *it);
+                    ASSERTV(iteration, key, EXP == (SIZE + 1 == X.size()));
+                }
+                ASSERTV(iteration, key, verify(X, oracle));
+            }
+
+            verifySearches(X, oracle, 81);
+
+            for (int key = -1; key <= 81; ++key) {
+                ASSERTV(key, mX.find(key)       == X.find(key));
+                ASSERTV(key, mX.lowerBound(key) == X.lowerBound(key));
+                ASSERTV(key, mX.upperBound(key) == X.upperBound(key));
+            }
+
+            for (Obj::SizeType i = 0; i < X.size(); ++i) {
+                const int& value = *(X.begin() + i);
+                ASSERTV(iteration, i, !mX.insert(value).second);
+                ASSERTV(iteration, i, verify(X, oracle));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&oa == X.allocator().mechanism());
+            (void)X.comparator();
+
+            ASSERT( mX.insert(3).second);
+            ASSERT( mX.insert(1).second);
+            ASSERT( mX.insert(2).second);
+            ASSERT(!mX.insert(2).second);
+            ASSERT(3 == X.size());
+            ASSERT(1 == X.begin()[0]);
+            ASSERT(2 == X.begin()[1]);
+            ASSERT(3 == X.begin()[2]);
+
+            ASSERT(X.begin() + 1 == X.find(2));
+            ASSERT(X.end()       == X.find(4));
+
+            const int DATA[] = { 9, 5, 7, 5, 3 };
+            mX.insert(DATA, DATA + 5);
+            ASSERT(6 == X.size());
+
+            mX.buildLookupIndex();
+            ASSERT(X.hasLookupIndex());
+            ASSERT(X.begin() + 4 == X.find(7));
+            ASSERT(X.end()       == X.find(8));
+
+            ASSERT(1 == mX.erase(7));
+            ASSERT(!X.hasLookupIndex());
+            ASSERT(5 == X.size());
+            ASSERT(0 < oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    (void)veryVerbose;
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -124,6 +124,15 @@ BSLS_IDENT("$Id: $")
 // basic exception guarantee.  There are similar concerns for the 'COMPARATOR'
 // predicate.
 //
+///Tracing
+///-------
+// If the macro 'BSLS_TRACERECORDER_LIBRARY_TRACING' is defined, each rehash
+// is recorded as a 'bsls::TraceRecorder' event of category "bslstl".
+// Otherwise, this component does not depend on 'bsls_tracerecorder' at all.
+// As the rehash is a template, the macro must be either defined or not
+// defined consistently in every translation unit of a program; mixing the
+// two violates the one-definition rule.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.  The
@@ -1470,6 +1479,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_bidirectionalnodepool.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
 #include <bslalg_bidirectionallink.h>
 #endif
@@ -1518,6 +1531,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isfunction.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISPOINTER
 #include <bslmf_ispointer.h>
 #endif
@@ -1530,6 +1547,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_bslexceptionutil.h>
 #endif
 
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_BSLS_NATIVESTD
 #include <bsls_nativestd.h>
 #endif
@@ -1542,6 +1563,12 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #endif
 
+#ifdef BSLS_TRACERECORDER_LIBRARY_TRACING
+#ifndef INCLUDED_BSLS_TRACERECORDER
+#include <bsls_tracerecorder.h>
+#endif
+#endif
+
 #ifndef INCLUDED_ALGORITHM
 #include <algorithm>  // for fill_n, max
 #define INCLUDED_ALGORITHM
@@ -2112,6 +2139,13 @@ class HashTable {
         }
     };
 
+  public:
+    typedef NodeHandle<ValueType,
+                       NodeType,
+                       typename ImplParameters::NodeFactory> NodeHandleType;
+        // This 'typedef' is an alias for the type of an object holding a node
+        // extracted from a hash table (see 'extractNode').
+
   private:
     // DATA
     ImplParameters      d_parameters;    // policies governing table behavior
@@ -2140,6 +2174,40 @@ class HashTable {
         // consistent with the class invariants until after this method is
         // called.
 
+    bslalg::BidirectionalLink *insertNode(
+                                          bslalg::BidirectionalLink *newNode);
+        // Insert the specified 'newNode' into this hash table immediately
+        // before the first element having the same key as the value of
+        // 'newNode' (or at the front of its bucket if there is none), and
+        // return 'newNode'.  This hash table takes ownership of 'newNode'
+        // whether or not an exception is thrown, and deletes it in that case.
+        // The behavior is undefined unless 'newNode' was created by the node
+        // factory of this hash table.
+
+    bslalg::BidirectionalLink *insertNode(
+                                          bslalg::BidirectionalLink *newNode,
+                                          bslalg::BidirectionalLink *hint);
+        // Insert the specified 'newNode' into this hash table, immediately
+        // preceding the specified 'hint' if the key of the element at 'hint'
+        // compares equal to that of 'newNode', and as 'insertNode(newNode)'
+        // otherwise (including when 'hint' is 0); return 'newNode'.  This hash
+        // table takes ownership of 'newNode' whether or not an exception is
+        // thrown.  The behavior is undefined unless 'newNode' was created by
+        // the node factory of this hash table and 'hint' is 0 or points to a
+        // node in this hash table.
+
+    bslalg::BidirectionalLink *insertNodeIfMissing(
+                                   bool                      *isInsertedFlag,
+                                   bslalg::BidirectionalLink *newNode);
+        // Return the address of the first element in this hash table having a
+        // key that compares equal to the key of the value of the specified
+        // 'newNode', deleting 'newNode', and load 'false' into the specified
+        // 'isInsertedFlag'; if there is no such element, insert 'newNode',
+        // return its address, and load 'true' into 'isInsertedFlag'.  This
+        // hash table takes ownership of 'newNode' whether or not an exception
+        // is thrown.  The behavior is undefined unless 'newNode' was created
+        // by the node factory of this hash table.
+
     void quickSwapRetainAllocators(HashTable *other);
         // Efficiently exchange the value and functors this object with those
         // of the specified 'other' object.  This method provides the no-throw
@@ -2285,6 +2353,226 @@ class HashTable {
         // requirements might simplify in the future, if the standard is
         // updated.
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplace(ARGS&&... args);
+        // Insert into this hash table a newly created 'ValueType' object,
+        // constructed in place from the specified 'args', and return the
+        // address of the new node.  If this hash table already contains an
+        // element having the same key as the new value (according to this hash
+        // table's 'comparator') then insert the new node immediately before
+        // the first element having the same key.  Additional buckets will be
+        // allocated, as needed, to preserve the invariant 'loadFactor <=
+        // maxLoadFactor'.  If this function tries to allocate a number of
+        // buckets larger than can be represented by this hash table's
+        // 'SizeType', a 'std::length_error' exception will be thrown.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+    bslalg::BidirectionalLink *emplace();
+
+    template <class ARGS_1>
+    bslalg::BidirectionalLink *emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bslalg::BidirectionalLink *emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bslalg::BidirectionalLink *emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bslalg::BidirectionalLink *emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bslalg::BidirectionalLink *emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplaceWithHint(
+                                               bslalg::BidirectionalLink *hint,
+                                               ARGS&&... args);
+        // Insert into this hash table a newly created 'ValueType' object,
+        // constructed in place from the specified 'args', and return the
+        // address of the new node.  If the element stored in the node pointed
+        // to by the specified 'hint' has a key that compares equal to that of
+        // the new value, the new node is inserted immediately preceding
+        // 'hint'.  Additional buckets will be allocated, as needed, to
+        // preserve the invariant 'loadFactor <= maxLoadFactor'.  If this
+        // function tries to allocate a number of buckets larger than can be
+        // represented by this hash table's 'SizeType', a 'std::length_error'
+        // exception will be thrown.  The behavior is undefined unless 'hint'
+        // is 0 (e.g., the node of an 'end' iterator) or points to a node in
+        // this hash table.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+    bslalg::BidirectionalLink *emplaceWithHint(
+                                              bslalg::BidirectionalLink *hint);
+
+    template <class ARGS_1>
+    bslalg::BidirectionalLink *emplaceWithHint(
+                             bslalg::BidirectionalLink *hint,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bslalg::BidirectionalLink *emplaceWithHint(
+                             bslalg::BidirectionalLink *hint,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bslalg::BidirectionalLink *emplaceWithHint(
+                             bslalg::BidirectionalLink *hint,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bslalg::BidirectionalLink *emplaceWithHint(
+                             bslalg::BidirectionalLink *hint,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bslalg::BidirectionalLink *emplaceWithHint(
+                             bslalg::BidirectionalLink *hint,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplaceWithHint(
+                              bslalg::BidirectionalLink *hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplaceIfMissing(bool *isInsertedFlag,
+                                                ARGS&&... args);
+        // Create a 'ValueType' object in a new node, constructed in place from
+        // the specified 'args', and insert that node into this hash table
+        // unless the hash table already contains an element having the same
+        // key (according to this hash table's 'comparator'), in which case the
+        // new node is destroyed.  Return the address of the inserted node, or
+        // of the first element having that key, and load into the specified
+        // 'isInsertedFlag' 'true' if insertion was performed, and 'false'
+        // otherwise.  Additional buckets will be allocated, as needed, to
+        // preserve the invariant 'loadFactor <= maxLoadFactor'.  If this
+        // function tries to allocate a number of buckets larger than can be
+        // represented by this hash table's 'SizeType', a 'std::length_error'
+        // exception will be thrown.  Note that, since the key is not known
+        // until the value is built, a node is always allocated; use
+        // 'tryEmplace' when the key is at hand.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+    bslalg::BidirectionalLink *emplaceIfMissing(bool *isInsertedFlag);
+
+    template <class ARGS_1>
+    bslalg::BidirectionalLink *emplaceIfMissing(
+                             bool *isInsertedFlag,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bslalg::BidirectionalLink *emplaceIfMissing(
+                             bool *isInsertedFlag,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bslalg::BidirectionalLink *emplaceIfMissing(
+                             bool *isInsertedFlag,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bslalg::BidirectionalLink *emplaceIfMissing(
+                             bool *isInsertedFlag,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bslalg::BidirectionalLink *emplaceIfMissing(
+                             bool *isInsertedFlag,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bslalg::BidirectionalLink *emplaceIfMissing(
+                              bool *isInsertedFlag,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     template <class SOURCE_TYPE>
     bslalg::BidirectionalLink *insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this hash-table, and return the
@@ -2350,6 +2638,134 @@ class HashTable {
         // hash table's 'SizeType', a 'std::length_error' exception will be
         // thrown.
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bslalg::BidirectionalLink *tryEmplace(bool           *isInsertedFlag,
+                                          const KeyType&  key,
+                                          ARGS&&... args);
+        // Return the address of a link holding an element whose key has the
+        // same value as the specified 'key' (according to this hash table's
+        // 'comparator'), and, if no such link exists, insert a new link
+        // holding a 'ValueType' whose key is 'key' and whose 'second' member
+        // is constructed from the specified 'args'; load into the specified
+        // 'isInsertedFlag' 'true' if insertion was performed, and 'false'
+        // otherwise.  If no insertion is performed, 'args' are not used and no
+        // memory is allocated.  Additional buckets will be allocated, as
+        // needed, to preserve the invariant 'loadFactor <= maxLoadFactor'.  If
+        // this function tries to allocate a number of buckets larger than can
+        // be represented by this hash table's 'SizeType', a
+        // 'std::length_error' exception will be thrown.  This method requires
+        // that 'ValueType' be a 'bsl::pair'.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+    bslalg::BidirectionalLink *tryEmplace(bool           *isInsertedFlag,
+                                          const KeyType&  key);
+
+    template <class ARGS_1>
+    bslalg::BidirectionalLink *tryEmplace(
+                             bool           *isInsertedFlag,
+                             const KeyType&  key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bslalg::BidirectionalLink *tryEmplace(
+                             bool           *isInsertedFlag,
+                             const KeyType&  key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bslalg::BidirectionalLink *tryEmplace(
+                             bool           *isInsertedFlag,
+                             const KeyType&  key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bslalg::BidirectionalLink *tryEmplace(
+                             bool           *isInsertedFlag,
+                             const KeyType&  key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bslalg::BidirectionalLink *tryEmplace(
+                             bool           *isInsertedFlag,
+                             const KeyType&  key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bslalg::BidirectionalLink *tryEmplace(
+                              bool           *isInsertedFlag,
+                              const KeyType&  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+    void extractNode(NodeHandleType            *result,
+                     bslalg::BidirectionalLink *node);
+        // Unlink the specified 'node' from this hash-table without destroying
+        // the element it holds, and load the node into the specified
+        // 'result', after deleting the node held by 'result', if any.  The
+        // behavior is undefined unless 'node' refers to a node in this
+        // hash-table.
+
+    bslalg::BidirectionalLink *insertNodeIfMissing(
+                                           bool           *isInsertedFlag,
+                                           NodeHandleType *node);
+        // Return the address of the first element in this hash-table having a
+        // key that compares equal to the key of the element held by the
+        // specified 'node', and load 'false' into the specified
+        // 'isInsertedFlag', leaving 'node' unchanged; if there is no such
+        // element, insert the element held by 'node', leave 'node' empty,
+        // return the address of the inserted element, and load 'true' into
+        // 'isInsertedFlag'.  If 'node' is empty, return 0 and load 'false'
+        // into 'isInsertedFlag'.  If the allocator of 'node' compares equal to
+        // that of this hash-table (e.g., 'node' holds a node extracted from
+        // this hash-table, see 'extractNode'), link the node held by 'node'
+        // into this hash-table; otherwise, insert a copy of its element and
+        // delete the node held by 'node'.  Additional buckets will be
+        // allocated, as needed, to preserve the invariant
+        // 'loadFactor <= maxLoadFactor'.  If an exception is thrown, this
+        // method has no effect other than to possibly allocate more buckets.
+
+    void mergeIfMissing(HashTable *source);
+        // Move into this hash-table each element of the specified 'source'
+        // hash-table having a key that does not compare equal to the key of
+        // any element in this hash-table, and leave the other elements in
+        // 'source'.  If 'source' uses an allocator equal to that of this
+        // hash-table, unlink the nodes holding the moved elements from
+        // 'source' and link them into this hash-table without copying the
+        // elements; otherwise, insert copies of the moved elements and remove
+        // them from 'source'.  Additional buckets will be allocated, as
+        // needed, to preserve the invariant 'loadFactor <= maxLoadFactor'.
+        // If an exception is thrown, the elements moved so far remain in this
+        // hash-table, and the others in 'source'; if the allocators compare
+        // equal, the buckets are allocated before any element is moved, so
+        // an exception thrown by the allocator leaves both hash-tables
+        // unchanged.  This method has no effect if 'source' is this
+        // hash-table.
+
     bslalg::BidirectionalLink *remove(bslalg::BidirectionalLink *node);
         // Remove the specified 'node' from this hash-table, and return the
         // address of the node immediately after 'node' this hash-table (prior
@@ -2363,6 +2779,16 @@ class HashTable {
         // retained for future use.  The destructor of each (non-trivial)
         // element that is remove shall be run.
 
+    void removeAllAndReleaseMemory();
+        // Remove all the elements from this hash-table, and release all memory
+        // used for its nodes and buckets back to the allocator, leaving this
+        // hash-table in the state of a default-constructed object having the
+        // same hasher, comparator, and maximum load factor.  If the element
+        // type is trivially copyable, the elements are not destroyed;
+        // otherwise, the destructor of each element is run.  Note that,
+        // unlike 'removeAll', this method also returns the memory of the nodes
+        // kept for reuse to the allocator.
+
     void rehashForNumBuckets(SizeType newNumBuckets);
         // Re-organize this hash-table to have at least the specified
         // 'newNumBuckets', preserving the invariant
@@ -3306,6 +3732,139 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
     arrayProctor.release();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                            bslalg::BidirectionalLink *newNode)
+{
+    BSLS_ASSERT(newNode);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // This node needs wrapping in a proctor, in case either of the user-
+    // supplied functors, or the rehash, throws an exception.
+
+    HashTable_NodeProctor<typename ImplParameters::NodeFactory>
+                             nodeProctor(&d_parameters.nodeFactory(), newNode);
+
+    // Rehash (if appropriate) first as it will reduce load factor and so
+    // potentially improve the 'find' time.
+
+    if (d_size >= d_capacity) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+    }
+
+    // Now we can search for the node in the table, being careful to compute
+    // the hash value only once.
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                     ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    bslalg::BidirectionalLink *position = this->find(
+                                      ImpUtil::extractKey<KEY_CONFIG>(newNode),
+                                      hashCode);
+
+    if (!position) {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+    }
+    else {
+        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+    }
+    nodeProctor.release();
+
+    ++d_size;
+
+    return newNode;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                            bslalg::BidirectionalLink *newNode,
+                                            bslalg::BidirectionalLink *hint)
+{
+    BSLS_ASSERT(newNode);
+
+    if (!hint) {
+        return insertNode(newNode);                                   // RETURN
+    }
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // There is potential for the user-supplied hasher and comparator to throw,
+    // so we need to manage 'newNode' with a proctor.
+
+    HashTable_NodeProctor<typename ImplParameters::NodeFactory>
+                             nodeProctor(&d_parameters.nodeFactory(), newNode);
+
+    // Rehash (if appropriate) first as it will reduce load factor and so
+    // potentially improve the potential 'find' time later.
+
+    if (d_size >= d_capacity) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+    }
+
+    // Insert logic, first test the hint
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                     ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    if (!d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
+                                   ImpUtil::extractKey<KEY_CONFIG>(hint))) {
+        hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
+    }
+
+    if (!hint) {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+    }
+    else {
+        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+    }
+    nodeProctor.release();
+
+    ++d_size;
+
+    return newNode;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNodeIfMissing(
+                                    bool                      *isInsertedFlag,
+                                    bslalg::BidirectionalLink *newNode)
+{
+    BSLS_ASSERT(isInsertedFlag);
+    BSLS_ASSERT(newNode);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // The node is deleted by this proctor if an element with the same key is
+    // found, as well as if a user-supplied functor throws.
+
+    HashTable_NodeProctor<typename ImplParameters::NodeFactory>
+                             nodeProctor(&d_parameters.nodeFactory(), newNode);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                     ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    bslalg::BidirectionalLink *position = this->find(
+                                      ImpUtil::extractKey<KEY_CONFIG>(newNode),
+                                      hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if(!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        nodeProctor.release();
+
+        ++d_size;
+        position = newNode;
+    }
+
+    return position;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
@@ -3342,6 +3901,10 @@ void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
 rehashIntoExactlyNumBuckets(SizeType newNumBuckets, SizeType capacity)
 {
+#ifdef BSLS_TRACERECORDER_LIBRARY_TRACING
+    BSLS_TRACERECORDER_SCOPE("bslstl", "HashTable::rehash");
+#endif
+
     class Proctor {
         // An object of this proctor class guarantees that, if an exception
         // is thrown by a user-supplied hash functor, the container remains in
@@ -3524,106 +4087,485 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
     return *this;
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
-template <class SOURCE_TYPE>
+template <class... ARGS>
+inline
 bslalg::BidirectionalLink *
-HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
-                                                      const SOURCE_TYPE& value)
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(ARGS&&... args)
 {
-    typedef bslalg::HashTableImpUtil ImpUtil;
-
-    // Rehash (if appropriate) first as it will reduce load factor and so
-    // potentially improve the 'find' time.
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                           native_std::forward<ARGS>(args)...);
 
-    if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
-    }
+    return insertNode(newNode);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace()
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode();
 
-    // Create a node having the new 'value' we want to insert into the table.
-    // We can extract the 'key' from this value without accidentally creating
-    // a temporary (using the default allocator for any dynamic memory).
+    return insertNode(newNode);
+}
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
     bslalg::BidirectionalLink *newNode =
-                                  d_parameters.nodeFactory().createNode(value);
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
 
-    // This node needs wrapping in a proctor, in case either of the user-
-    // supplied functors throws an exception.
+    return insertNode(newNode);
+}
 
-    HashTable_NodeProctor<typename ImplParameters::NodeFactory>
-                             nodeProctor(&d_parameters.nodeFactory(), newNode);
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
 
-    // Now we can search for the node in the table, being careful to compute
-    // the hash value only once.
+    return insertNode(newNode);
+}
 
-    size_t hashCode = this->d_parameters.hashCodeForKey(
-                                     ImpUtil::extractKey<KEY_CONFIG>(newNode));
-    bslalg::BidirectionalLink *position = this->find(
-                                      ImpUtil::extractKey<KEY_CONFIG>(newNode),
-                                      hashCode);
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
 
-    if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
-    }
-    nodeProctor.release();
+    return insertNode(newNode);
+}
 
-    ++d_size;
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
 
-    return newNode;
+    return insertNode(newNode);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
-template <class SOURCE_TYPE>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
 bslalg::BidirectionalLink *
-HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
-                                              const SOURCE_TYPE&         value,
-                                              bslalg::BidirectionalLink *hint)
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
 {
-    BSLS_ASSERT(hint);
-
-    typedef bslalg::HashTableImpUtil ImpUtil;
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+
+    return insertNode(newNode);
+}
 
-    // Rehash (if appropriate) first as it will reduce load factor and so
-    // potentially improve the potential 'find' time later.
+#else
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
 
-    if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
-    }
+    return insertNode(newNode);
+}
+// }}} END GENERATED CODE
+#endif
 
-    // Next we must create the node, to avoid making a temporary of 'ValueType'
-    // from the object of template parameter 'SOURCE_TYPE'.
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                                               bslalg::BidirectionalLink *hint,
+                                               ARGS&&... args)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                           native_std::forward<ARGS>(args)...);
 
+    return insertNode(newNode, hint);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                                               bslalg::BidirectionalLink *hint)
+{
     bslalg::BidirectionalLink *newNode =
-                                  d_parameters.nodeFactory().createNode(value);
+            d_parameters.nodeFactory().emplaceIntoNewNode();
 
-    // There is potential for the user-supplied hasher and comparator to throw,
-    // so now we need to manage our 'newNode' with a proctor.
+    return insertNode(newNode, hint);
+}
 
-    HashTable_NodeProctor<typename ImplParameters::NodeFactory>
-                             nodeProctor(&d_parameters.nodeFactory(), newNode);
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                              bslalg::BidirectionalLink *hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
 
-    // Insert logic, first test the hint
+    return insertNode(newNode, hint);
+}
 
-    size_t hashCode = this->d_parameters.hashCodeForKey(
-                                     ImpUtil::extractKey<KEY_CONFIG>(newNode));
-    if (!d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
-                                   ImpUtil::extractKey<KEY_CONFIG>(hint))) {
-        hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
-    }
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                              bslalg::BidirectionalLink *hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
 
-    if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
-    }
-    nodeProctor.release();
+    return insertNode(newNode, hint);
+}
 
-    ++d_size;
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                              bslalg::BidirectionalLink *hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
 
-    return newNode;
+    return insertNode(newNode, hint);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                              bslalg::BidirectionalLink *hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+
+    return insertNode(newNode, hint);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                              bslalg::BidirectionalLink *hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+
+    return insertNode(newNode, hint);
+}
+
+#else
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
+                               bslalg::BidirectionalLink *hint,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+
+    return insertNode(newNode, hint);
+}
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                                                          bool *isInsertedFlag,
+                                                          ARGS&&... args)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                           native_std::forward<ARGS>(args)...);
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                                                          bool *isInsertedFlag)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode();
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                              bool *isInsertedFlag,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                              bool *isInsertedFlag,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                              bool *isInsertedFlag,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                              bool *isInsertedFlag,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                              bool *isInsertedFlag,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+
+#else
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
+                               bool *isInsertedFlag,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    bslalg::BidirectionalLink *newNode =
+            d_parameters.nodeFactory().emplaceIntoNewNode(
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+
+    return insertNodeIfMissing(isInsertedFlag, newNode);
+}
+// }}} END GENERATED CODE
+#endif
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_TYPE>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
+                                                      const SOURCE_TYPE& value)
+{
+    // Create a node having the new 'value' we want to insert into the table.
+    // We can extract the 'key' from this value without accidentally creating
+    // a temporary (using the default allocator for any dynamic memory).
+
+    return insertNode(d_parameters.nodeFactory().createNode(value));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_TYPE>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
+                                              const SOURCE_TYPE&         value,
+                                              bslalg::BidirectionalLink *hint)
+{
+    // Create the node first, to avoid making a temporary of 'ValueType' from
+    // the object of template parameter 'SOURCE_TYPE'.
+
+    return insertNode(d_parameters.nodeFactory().createNode(value), hint);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3659,74 +4601,296 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class SOURCE_TYPE>
+inline
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
                                             bool               *isInsertedFlag,
                                             const SOURCE_TYPE&  value)
+{
+    // Create the node first, to avoid making a temporary of 'ValueType' from
+    // the object of template parameter 'SOURCE_TYPE'.
+
+    return insertNodeIfMissing(isInsertedFlag,
+                               d_parameters.nodeFactory().createNode(value));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                                            const KeyType& key)
+{
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        position = d_parameters.nodeFactory().createNode(
+                                            key,
+                                            typename ValueType::second_type());
+
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
+    }
+    return position;
+}
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                                                bool           *isInsertedFlag,
+                                                const KeyType&  key,
+                                                ARGS&&... args)
 {
     BSLS_ASSERT(isInsertedFlag);
 
-    typedef bslalg::HashTableImpUtil ImpUtil;
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
 
-    // Rehash (if appropriate) first as it will reduce load factor and so
-    // potentially improve the potential 'find' time later.
+    *isInsertedFlag = (!position);
 
-    if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        position = d_parameters.nodeFactory().createNode(
+                  key,
+                  typename ValueType::second_type(
+                                          native_std::forward<ARGS>(args)...));
+
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
     }
+    return position;
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_hashtable.h
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                                                bool           *isInsertedFlag,
+                                                const KeyType&  key)
+{
+    BSLS_ASSERT(isInsertedFlag);
 
-    // Next we must create the node, to avoid making a temporary of 'ValueType'
-    // from the object of template parameter 'SOURCE_TYPE'.
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
 
-    bslalg::BidirectionalLink *newNode =
-                                  d_parameters.nodeFactory().createNode(value);
+    *isInsertedFlag = (!position);
 
-    // There is potential for the user-supplied hasher and comparator to throw,
-    // so now we need to manage our 'newNode' with a proctor.
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
 
-    HashTable_NodeProctor<typename ImplParameters::NodeFactory>
-                             nodeProctor(&d_parameters.nodeFactory(), newNode);
+        position = d_parameters.nodeFactory().createNode(
+                  key,
+                  typename ValueType::second_type());
 
-    // Insert logic, first test the hint
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
+    }
+    return position;
+}
 
-    size_t hashCode = this->d_parameters.hashCodeForKey(
-                                     ImpUtil::extractKey<KEY_CONFIG>(newNode));
-    bslalg::BidirectionalLink *position = this->find(
-                                      ImpUtil::extractKey<KEY_CONFIG>(newNode),
-                                      hashCode);
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                              bool           *isInsertedFlag,
+                              const KeyType&  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
 
     *isInsertedFlag = (!position);
 
-    if(!position) {
+    if (!position) {
         if (d_size >= d_capacity) {
             this->rehashForNumBuckets(numBuckets() * 2);
         }
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-        nodeProctor.release();
+        position = d_parameters.nodeFactory().createNode(
+                  key,
+                  typename ValueType::second_type(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1)));
 
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
         ++d_size;
-        position = newNode;
     }
+    return position;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                              bool           *isInsertedFlag,
+                              const KeyType&  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        position = d_parameters.nodeFactory().createNode(
+                  key,
+                  typename ValueType::second_type(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2)));
 
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
+    }
     return position;
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
 bslalg::BidirectionalLink *
-HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
-                                                            const KeyType& key)
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                              bool           *isInsertedFlag,
+                              const KeyType&  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
 {
+    BSLS_ASSERT(isInsertedFlag);
+
     size_t hashCode = this->d_parameters.hashCodeForKey(key);
     bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
     if (!position) {
         if (d_size >= d_capacity) {
             this->rehashForNumBuckets(numBuckets() * 2);
         }
 
         position = d_parameters.nodeFactory().createNode(
-                                            key,
-                                            typename ValueType::second_type());
+                  key,
+                  typename ValueType::second_type(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3)));
+
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
+    }
+    return position;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                              bool           *isInsertedFlag,
+                              const KeyType&  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        position = d_parameters.nodeFactory().createNode(
+                  key,
+                  typename ValueType::second_type(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4)));
+
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
+    }
+    return position;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                              bool           *isInsertedFlag,
+                              const KeyType&  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        position = d_parameters.nodeFactory().createNode(
+                  key,
+                  typename ValueType::second_type(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5)));
 
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
@@ -3736,6 +4900,42 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     return position;
 }
 
+#else
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                               bool           *isInsertedFlag,
+                               const KeyType&  key,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        position = d_parameters.nodeFactory().createNode(
+                  key,
+                  typename ValueType::second_type(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
+    }
+    return position;
+}
+// }}} END GENERATED CODE
+#endif
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
@@ -3786,6 +4986,145 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::extractNode(
+                                      NodeHandleType            *result,
+                                      bslalg::BidirectionalLink *node)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(node->previousLink()
+                  || d_anchor.listRootAddress() == node);
+
+    bslalg::HashTableImpUtil::remove(&d_anchor,
+                                     node,
+                                     hashCodeForNode(node));
+    --d_size;
+
+    result->reset(static_cast<NodeType *>(node),
+                  d_parameters.nodeFactory().allocator());
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNodeIfMissing(
+                                                bool           *isInsertedFlag,
+                                                NodeHandleType *node)
+{
+    BSLS_ASSERT(isInsertedFlag);
+    BSLS_ASSERT(node);
+
+    *isInsertedFlag = false;
+
+    if (node->empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    const KeyType& key = KEY_CONFIG::extractKey(node->value());
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+    if (position) {
+        return position;                                              // RETURN
+    }
+
+    if (d_size >= d_capacity) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+    }
+
+    bslalg::BidirectionalLink *newNode;
+    if (node->allocator() == d_parameters.nodeFactory().allocator()) {
+        newNode = node->release();
+    }
+    else {
+        newNode = d_parameters.nodeFactory().createNode(node->value());
+        node->reset();
+    }
+
+    bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                    newNode,
+                                                    hashCode);
+    ++d_size;
+    *isInsertedFlag = true;
+
+    return newNode;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::mergeIfMissing(
+                                                             HashTable *source)
+{
+    BSLS_ASSERT(source);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (this == source) {
+        return;                                                       // RETURN
+    }
+
+    const bool relink = this->allocator() == source->allocator();
+
+    if (relink) {
+        // Allocate the buckets up front, so that no exception can be thrown
+        // by the allocator once nodes start being moved.
+
+        SizeType numMissing = 0;
+        for (bslalg::BidirectionalLink *cursor = source->elementListRoot();
+             cursor;
+             cursor = cursor->nextLink()) {
+            const KeyType& key = ImpUtil::extractKey<KEY_CONFIG>(cursor);
+            if (!this->find(key, this->d_parameters.hashCodeForKey(key))) {
+                ++numMissing;
+            }
+        }
+
+        if (d_size + numMissing > d_capacity) {
+            size_t   capacity;
+            SizeType numBuckets = static_cast<SizeType>(
+                              HashTable_ImpDetails::growBucketsForLoadFactor(
+                                       &capacity,
+                                       d_size + numMissing,
+                                       static_cast<size_t>(this->numBuckets()),
+                                       d_maxLoadFactor));
+
+            this->rehashIntoExactlyNumBuckets(numBuckets,
+                                              static_cast<SizeType>(capacity));
+        }
+    }
+
+    bslalg::BidirectionalLink *cursor = source->elementListRoot();
+    while (cursor) {
+        bslalg::BidirectionalLink *node = cursor;
+        cursor = cursor->nextLink();
+
+        const KeyType& key = ImpUtil::extractKey<KEY_CONFIG>(node);
+        size_t hashCode = this->d_parameters.hashCodeForKey(key);
+        if (this->find(key, hashCode)) {
+            continue;                                               // CONTINUE
+        }
+
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        bslalg::BidirectionalLink *newNode;
+        if (relink) {
+            ImpUtil::remove(&source->d_anchor,
+                            node,
+                            source->hashCodeForNode(node));
+            --source->d_size;
+            newNode = node;
+        }
+        else {
+            newNode = d_parameters.nodeFactory().cloneNode(*node);
+            source->remove(node);
+        }
+
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        ++d_size;
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::remove(
@@ -3821,6 +5160,36 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
     d_size = 0;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+removeAllAndReleaseMemory()
+{
+    if (bsl::is_trivially_copyable<ValueType>::value) {
+        bslalg::BidirectionalLink *cursor = d_anchor.listRootAddress();
+        while (cursor) {
+            bslalg::BidirectionalLink *next = cursor->nextLink();
+            d_parameters.nodeFactory().deallocateNode(cursor);
+            cursor = next;
+        }
+    }
+    else {
+        this->removeAllImp();
+    }
+    d_parameters.nodeFactory().release();
+
+    HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
+                                       d_anchor.bucketArraySize(),
+                                       this->allocator());
+
+    d_anchor.setBucketArrayAddressAndSize(
+                                 HashTable_ImpDetails::defaultBucketAddress(),
+                                 1);
+    d_anchor.setListRootAddress(0);
+    d_size     = 0;
+    d_capacity = 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setMaxLoadFactor(
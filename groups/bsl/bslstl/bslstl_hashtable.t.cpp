@@ -5,6 +5,7 @@
 #include <bslstl_hash.h>
 #include <bslstl_hashtableiterator.h>  // usage example
 #include <bslstl_iterator.h>           // 'distance', in usage example
+#include <bslstl_pair.h>
 
 #include <bslalg_bidirectionallink.h>
 #include <bslalg_bidirectionallinklistutil.h>
@@ -29,6 +30,7 @@
 #include <bsls_bsltestutil.h>
 #include <bsls_platform.h>
 
+#include <bsltf_alloctesttype.h>
 #include <bsltf_convertiblevaluewrapper.h>
 #include <bsltf_degeneratefunctor.h>
 #include <bsltf_evilbooleantype.h>
@@ -202,8 +204,13 @@ using bslstl::CallableVariable;
 //*[15] insertIfMissing(bool *isInsertedFlag, const SOURCE_TYPE& obj);
 //*[15] insertIfMissing(bool *isInsertedFlag, const ValueType& obj);
 //*[16] insertIfMissing(const KeyType& key);
+// [16] emplace(ARGS&&... args);
+// [16] emplaceWithHint(bslalg::BidirectionalLink *hint, ARGS&&... args);
+// [16] emplaceIfMissing(bool *isInsertedFlag, ARGS&&... args);
+// [16] tryEmplace(bool *isInsertedFlag, const KeyType& key, ARGS&&...);
 //*[  ] remove(bslalg::BidirectionalLink *node);
 // [ 2] removeAll();
+// [17] removeAllAndReleaseMemory();
 //*[11] rehashForNumBuckets(SizeType newNumBuckets);
 //*[11] reserveForNumElements(SizeType numElements);
 //*[13] setMaxLoadFactor(float loadFactor);
@@ -236,7 +243,8 @@ using bslstl::CallableVariable;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [  ] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
+// [16] CONCERN: 'insertNode' with a null hint inserts as without a hint.
 //
 // Class HashTable_ImpDetails
 //*[  ] size_t nextPrime(size_t n);
@@ -1982,8 +1990,56 @@ bool operator!=(const MostEvilTestType& lhs,
 
 void debugprint(const MostEvilTestType& value);
 
+                      // ==================================
+                      // class template DestructionCounter
+                      // ==================================
+
+template <bool IS_TRIVIALLY_COPYABLE>
+class DestructionCounter {
+    // This class holds an 'int' value and counts the objects of its type
+    // that are destroyed.  Although its destructor is not trivial, the class
+    // claims the 'bsl::is_trivially_copyable' trait if the (template
+    // parameter) 'IS_TRIVIALLY_COPYABLE' is 'true', so that a test can
+    // observe whether a container relying on that trait runs the destructor.
+
+    // DATA
+    int d_data;
+
+  public:
+    // CLASS DATA
+    static int s_numDestroyed;  // number of objects destroyed
+
+    // CREATORS
+    explicit DestructionCounter(int value);
+        // Create an object having the specified 'value'.
+
+    // DestructionCounter(const DestructionCounter& original) = default;
+
+    ~DestructionCounter();
+        // Destroy this object, and increment 's_numDestroyed'.
+
+    // ACCESSORS
+    int data() const;
+        // Return the value of this object.
+};
+
+template <bool IS_TRIVIALLY_COPYABLE>
+bool operator==(const DestructionCounter<IS_TRIVIALLY_COPYABLE>& lhs,
+                const DestructionCounter<IS_TRIVIALLY_COPYABLE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'DestructionCounter' objects have
+    // the same value if their 'data' attributes are the same.
+
 }  // close namespace TestTypes
 
+namespace bsl {
+
+template <>
+struct is_trivially_copyable<TestTypes::DestructionCounter<true> >
+    : bsl::true_type {};
+
+}  // close namespace bsl
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
 namespace BloombergLP {
@@ -3032,6 +3088,37 @@ int MostEvilTestType::data() const
     return d_data.data();
 }
 
+                      // ----------------------------------
+                      // class template DestructionCounter
+                      // ----------------------------------
+
+// CLASS DATA
+template <bool IS_TRIVIALLY_COPYABLE>
+int DestructionCounter<IS_TRIVIALLY_COPYABLE>::s_numDestroyed = 0;
+
+// CREATORS
+template <bool IS_TRIVIALLY_COPYABLE>
+inline
+DestructionCounter<IS_TRIVIALLY_COPYABLE>::DestructionCounter(int value)
+: d_data(value)
+{
+}
+
+template <bool IS_TRIVIALLY_COPYABLE>
+inline
+DestructionCounter<IS_TRIVIALLY_COPYABLE>::~DestructionCounter()
+{
+    ++s_numDestroyed;
+}
+
+// ACCESSORS
+template <bool IS_TRIVIALLY_COPYABLE>
+inline
+int DestructionCounter<IS_TRIVIALLY_COPYABLE>::data() const
+{
+    return d_data;
+}
+
 }  // close namespace TestTypes
 
 inline
@@ -3068,6 +3155,15 @@ bool TestTypes::operator!=(const MostEvilTestType& lhs,
     return !(lhs == rhs);
 }
 
+template <bool IS_TRIVIALLY_COPYABLE>
+inline
+bool TestTypes::operator==(
+                       const DestructionCounter<IS_TRIVIALLY_COPYABLE>& lhs,
+                       const DestructionCounter<IS_TRIVIALLY_COPYABLE>& rhs)
+{
+    return lhs.data() == rhs.data();
+}
+
 inline
 void TestTypes::debugprint(const MostEvilTestType& value)
 {
@@ -4467,6 +4563,21 @@ struct BsltfConfig {
     }
 };
 
+template <class KEY, class MAPPED>
+struct PairKeyConfig {
+    // This class provides a KEY_CONFIG type whose 'ValueType' is a 'bsl::pair'
+    // keyed on its 'first' member.  It might be consistent with use as a
+    // 'map' or a 'multimap' container.
+
+    typedef KEY                          KeyType;
+    typedef bsl::pair<const KEY, MAPPED> ValueType;
+
+    static const KeyType& extractKey(const ValueType& value)
+    {
+        return value.first;
+    }
+};
+
 struct TrickyConfig {
     // This class provides the most primitive possible KEY_CONFIG type that
     // can support a 'HashTable'.  It might be consistent with use as a 'set'
@@ -5195,12 +5306,13 @@ void testVerifyListContents(const COMPARATOR& compare)
     // ------------------------------------------------------------------------
 
     static bool alreadyTested = false;
-    if (alreadyTested++) {
+    if (alreadyTested) {
         // This function may be invoked many times, but each instantiation need
         // only run the first time.
 
         return;                                                       // RETURN
     }
+    alreadyTested = true;
 
     typedef typename KEY_CONFIG::ValueType    ValueType;
     typedef bsltf::TestValuesArray<ValueType> TestValues;
@@ -10895,6 +11007,431 @@ void mainTestCase15()
     TestDriver_AwkwardMaplike::testCase15();
 }
 
+static
+void mainTestCase16()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace' METHODS
+    //
+    // Concerns:
+    //: 1 'emplace' builds a value from its arguments in a new node, using the
+    //:   allocator of the hash table, inserts the node before the first
+    //:   element having the same key, and returns the node.
+    //:
+    //: 2 'emplaceWithHint' inserts the new node immediately before 'hint'
+    //:   if the key of 'hint' is equal to that of the new value, and as
+    //:   'emplace' otherwise.
+    //:
+    //: 3 A null hint, such as the node of an 'end' iterator, is accepted by
+    //:   'insertNode', which then inserts the node as if no hint were given.
+    //:
+    //: 4 'emplaceIfMissing' inserts the new value only if its key is not in
+    //:   the hash table, and otherwise returns the first element having the
+    //:   key, leaving the hash table unchanged.
+    //:
+    //: 5 'tryEmplace' inserts a value whose 'second' member is built from its
+    //:   arguments only if the key is not in the hash table, and otherwise
+    //:   returns the first element having the key without allocating.
+    //:
+    //: 6 Each method loads 'true' into 'isInsertedFlag', where it takes one,
+    //:   exactly when it inserts.
+    //:
+    //: 7 If an allocation fails, the hash table is unchanged and no memory is
+    //:   leaked.
+    //
+    // Plan:
+    //: 1 Using a map-like hash table of 'int' keys and 'bsltf::AllocTestType'
+    //:   values, emplace elements with new and duplicate keys, and verify
+    //:   the size, the position of each new node relative to the other
+    //:   elements with its key, and that each value uses the object
+    //:   allocator.  (C-1)
+    //:
+    //: 2 Emplace values with a hint to an element having the same key, a
+    //:   hint to an element having a different key, and a null hint, and
+    //:   verify the position of the new node in each case.  (C-2..3)
+    //:
+    //: 3 Call 'emplaceIfMissing' and 'tryEmplace' with new and existing
+    //:   keys, and verify the returned node, the flag, the size, and, for an
+    //:   existing key passed to 'tryEmplace', that no memory is allocated.
+    //:   (C-4..6)
+    //:
+    //: 4 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, call each
+    //:   method, and verify that the size is unchanged whenever an exception
+    //:   is thrown.  Verify that no memory is in use once the hash table is
+    //:   destroyed.  (C-7)
+    //
+    // Testing:
+    //   emplace(ARGS&&... args);
+    //   emplaceWithHint(bslalg::BidirectionalLink *hint, ARGS&&... args);
+    //   emplaceIfMissing(bool *isInsertedFlag, ARGS&&... args);
+    //   tryEmplace(bool *isInsertedFlag, const KeyType& key, ARGS&&...);
+    //   CONCERN: 'insertNode' with a null hint inserts as without a hint.
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\nTESTING 'emplace' METHODS"
+                        "\n=========================\n");
+
+    typedef PairKeyConfig<int, bsltf::AllocTestType> KEY_CONFIG;
+    typedef KEY_CONFIG::ValueType                    ValueType;
+
+    typedef bslstl::HashTable<KEY_CONFIG,
+                              ::bsl::hash<int>,
+                              ::bsl::equal_to<int>,
+                              ::bsl::allocator<ValueType> > Obj;
+
+    typedef bslalg::BidirectionalLink Link;
+    typedef bslalg::HashTableImpUtil  ImpUtil;
+
+    const ::bsl::hash<int>     HASHER     = ::bsl::hash<int>();
+    const ::bsl::equal_to<int> COMPARATOR = ::bsl::equal_to<int>();
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    if (verbose) printf("\tTesting 'emplace'.\n");
+    {
+        Obj mX(HASHER, COMPARATOR, 0, 1.0f, &oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 12; ++i) {
+            const int KEY = i % 4;
+
+            Link *const FIRST = X.find(KEY);
+
+            Link *result = mX.emplace(KEY, bsltf::AllocTestType(i));
+
+            const ValueType& VALUE = ImpUtil::extractValue<KEY_CONFIG>(result);
+            ASSERTV(i, KEY == VALUE.first);
+            ASSERTV(i, i   == VALUE.second.data());
+            ASSERTV(i, &oa == VALUE.second.allocator());
+
+            ASSERTV(i, i + 1  == static_cast<int>(X.size()));
+            ASSERTV(i, result == X.find(KEY));
+            ASSERTV(i, !FIRST || FIRST == result->nextLink());
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\tTesting 'emplaceWithHint'.\n");
+    {
+        Obj mX(HASHER, COMPARATOR, 0, 1.0f, &oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 4; ++i) {
+            mX.emplace(i, bsltf::AllocTestType(i));
+            mX.emplace(i, bsltf::AllocTestType(i));
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            const int KEY = i;
+
+            // A hint having the same key, that is not the first element
+            // having that key.
+
+            Link *hint   = X.find(KEY)->nextLink();
+            Link *result = mX.emplaceWithHint(hint,
+                                              KEY,
+                                              bsltf::AllocTestType(10 + i));
+            ASSERTV(i, 10 + i == ImpUtil::extractValue<KEY_CONFIG>(
+                                                       result).second.data());
+            ASSERTV(i, hint   == result->nextLink());
+
+            // A hint having a different key.
+
+            Link *const FIRST = X.find(KEY);
+
+            hint   = X.find((KEY + 1) % 4);
+            result = mX.emplaceWithHint(hint,
+                                        KEY,
+                                        bsltf::AllocTestType(20 + i));
+            ASSERTV(i, result == X.find(KEY));
+            ASSERTV(i, FIRST  == result->nextLink());
+
+            // A null hint.
+
+            Link *const SECOND = X.find(KEY);
+
+            result = mX.emplaceWithHint(0, KEY, bsltf::AllocTestType(30 + i));
+            ASSERTV(i, 30 + i == ImpUtil::extractValue<KEY_CONFIG>(
+                                                       result).second.data());
+            ASSERTV(i, result == X.find(KEY));
+            ASSERTV(i, SECOND == result->nextLink());
+        }
+        ASSERTV(X.size(), 20 == X.size());
+
+        // A null hint with a new key.
+
+        Link *result = mX.emplaceWithHint(0, 4, bsltf::AllocTestType(4));
+        ASSERTV(result == X.find(4));
+        ASSERTV(21     == X.size());
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\tTesting 'emplaceIfMissing'.\n");
+    {
+        Obj mX(HASHER, COMPARATOR, 0, 1.0f, &oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 8; ++i) {
+            const int  KEY       = i % 4;
+            const bool IS_UNIQUE = i < 4;
+
+            Link *const FIRST = X.find(KEY);
+            const size_t SIZE = X.size();
+
+            bool  isInsertedFlag = !IS_UNIQUE;
+            Link *result         = mX.emplaceIfMissing(
+                                                     &isInsertedFlag,
+                                                     KEY,
+                                                     bsltf::AllocTestType(i));
+
+            const ValueType& VALUE = ImpUtil::extractValue<KEY_CONFIG>(result);
+            ASSERTV(i, IS_UNIQUE == isInsertedFlag);
+            ASSERTV(i, KEY       == VALUE.first);
+            ASSERTV(i, KEY       == VALUE.second.data());
+            ASSERTV(i, &oa       == VALUE.second.allocator());
+            ASSERTV(i, result    == X.find(KEY));
+            ASSERTV(i, SIZE + IS_UNIQUE == X.size());
+            if (!IS_UNIQUE) {
+                ASSERTV(i, FIRST == result);
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\tTesting 'tryEmplace'.\n");
+    {
+        Obj mX(HASHER, COMPARATOR, 0, 1.0f, &oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 8; ++i) {
+            const int  KEY       = i % 4;
+            const bool IS_UNIQUE = i < 4;
+
+            Link *const FIRST = X.find(KEY);
+            const size_t SIZE = X.size();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            bool  isInsertedFlag = !IS_UNIQUE;
+            Link *result         = mX.tryEmplace(&isInsertedFlag, KEY, i);
+
+            const ValueType& VALUE = ImpUtil::extractValue<KEY_CONFIG>(result);
+            ASSERTV(i, IS_UNIQUE == isInsertedFlag);
+            ASSERTV(i, KEY       == VALUE.first);
+            ASSERTV(i, KEY       == VALUE.second.data());
+            ASSERTV(i, &oa       == VALUE.second.allocator());
+            ASSERTV(i, result    == X.find(KEY));
+            ASSERTV(i, SIZE + IS_UNIQUE == X.size());
+            if (!IS_UNIQUE) {
+                ASSERTV(i, FIRST == result);
+                ASSERTV(i, oam.isTotalSame());
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+#if defined(BDE_BUILD_TARGET_EXC)
+    if (verbose) printf("\tTesting exception safety.\n");
+    {
+        Obj mX(HASHER, COMPARATOR, 0, 1.0f, &oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 8; ++i) {
+            const int KEY = i % 4;
+
+            const size_t SIZE = X.size();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                // Each attempt starts from the state left by the failed
+                // attempts before it.
+
+                ASSERTV(i, SIZE == X.size());
+
+                bool isInsertedFlag;
+                switch (i % 4) {
+                  case 0: {
+                    mX.emplace(KEY, bsltf::AllocTestType(i));
+                  } break;
+                  case 1: {
+                    mX.emplaceWithHint(X.find(KEY),
+                                       KEY,
+                                       bsltf::AllocTestType(i));
+                  } break;
+                  case 2: {
+                    mX.emplaceIfMissing(&isInsertedFlag,
+                                        KEY,
+                                        bsltf::AllocTestType(i));
+                  } break;
+                  default: {
+                    mX.tryEmplace(&isInsertedFlag, KEY, i);
+                  }
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(i, SIZE <= X.size() && X.size() <= SIZE + 1);
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+#endif
+}
+
+template <bool IS_TRIVIALLY_COPYABLE>
+static
+void testRemoveAllAndReleaseMemory()
+{
+    // Test 'removeAllAndReleaseMemory' on a hash table of values whose type
+    // claims the 'bsl::is_trivially_copyable' trait if the (template
+    // parameter) 'IS_TRIVIALLY_COPYABLE' is 'true'.  See 'mainTestCase17'.
+
+    typedef TestTypes::DestructionCounter<IS_TRIVIALLY_COPYABLE> Counter;
+    typedef PairKeyConfig<int, Counter>                          KEY_CONFIG;
+    typedef typename KEY_CONFIG::ValueType                       ValueType;
+
+    typedef bslstl::HashTable<KEY_CONFIG,
+                              ::bsl::hash<int>,
+                              ::bsl::equal_to<int>,
+                              ::bsl::allocator<ValueType> > Obj;
+
+    ASSERTV(IS_TRIVIALLY_COPYABLE,
+            IS_TRIVIALLY_COPYABLE ==
+                              bsl::is_trivially_copyable<ValueType>::value);
+
+    const ::bsl::hash<int>     HASHER     = ::bsl::hash<int>();
+    const ::bsl::equal_to<int> COMPARATOR = ::bsl::equal_to<int>();
+    const float                MAX_LF     = 2.0f;
+
+    enum { NUM_ELEMENTS = 16, NUM_REMOVED = 4 };
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    const Obj DEFAULT(HASHER, COMPARATOR, 0, MAX_LF, &oa);
+
+    {
+        Obj mX(HASHER, COMPARATOR, 0, MAX_LF, &oa);  const Obj& X = mX;
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX.emplace(i, Counter(i));
+        }
+
+        // Remove some elements, so that the node pool holds free nodes as
+        // well as nodes in use.
+
+        for (int i = 0; i < NUM_REMOVED; ++i) {
+            mX.remove(mX.find(i));
+        }
+        ASSERTV(NUM_ELEMENTS - NUM_REMOVED == X.size());
+        ASSERTV(1 < X.numBuckets());
+        ASSERTV(0 < oa.numBlocksInUse());
+
+        Counter::s_numDestroyed = 0;
+
+        mX.removeAllAndReleaseMemory();
+
+        // The nodes, including the free ones, and the bucket array are
+        // returned to the allocator.
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        // The elements are destroyed unless they are trivially copyable.
+
+        const int EXP_DESTROYED = IS_TRIVIALLY_COPYABLE
+                                ? 0
+                                : NUM_ELEMENTS - NUM_REMOVED;
+        ASSERTV(IS_TRIVIALLY_COPYABLE, Counter::s_numDestroyed,
+                EXP_DESTROYED == Counter::s_numDestroyed);
+
+        // The hash table is in the default state, sharing the default bucket
+        // of a hash table that never allocated, and keeps its functors and
+        // maximum load factor.
+
+        ASSERTV(DEFAULT == X);
+        ASSERTV(0       == X.size());
+        ASSERTV(0       == X.elementListRoot());
+        ASSERTV(1       == X.numBuckets());
+        ASSERTV(0       == X.rehashThreshold());
+        ASSERTV(MAX_LF  == X.maxLoadFactor());
+        ASSERTV(&DEFAULT.bucketAtIndex(0) == &X.bucketAtIndex(0));
+        ASSERTV(0 == X.bucketAtIndex(0).first());
+        ASSERTV(0 == X.bucketAtIndex(0).last());
+
+        // The hash table can be used again.
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX.emplace(i, Counter(i));
+        }
+        ASSERTV(NUM_ELEMENTS == X.size());
+        ASSERTV(0 < oa.numBlocksInUse());
+
+        // Releasing the memory of an empty hash table has no effect.
+
+        mX.removeAll();
+
+        Obj mY(HASHER, COMPARATOR, 0, MAX_LF, &oa);  const Obj& Y = mY;
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        mY.removeAllAndReleaseMemory();
+
+        ASSERTV(oam.isTotalSame());
+        ASSERTV(oam.isInUseSame());
+        ASSERTV(DEFAULT == Y);
+        ASSERTV(&DEFAULT.bucketAtIndex(0) == &Y.bucketAtIndex(0));
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+static
+void mainTestCase17()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'removeAllAndReleaseMemory'
+    //
+    // Concerns:
+    //: 1 All the nodes, including the free nodes kept for reuse, and the
+    //:   bucket array are returned to the allocator.
+    //:
+    //: 2 The hash table is left in the state of a default-constructed object,
+    //:   using the shared default bucket, and keeps its hasher, comparator,
+    //:   and maximum load factor.
+    //:
+    //: 3 The destructors of the elements are run unless the element type is
+    //:   trivially copyable.
+    //:
+    //: 4 The hash table can be used again afterwards.
+    //:
+    //: 5 Calling the method on a hash table that has not allocated has no
+    //:   effect.
+    //
+    // Plan:
+    //: 1 For a value type claiming the 'bsl::is_trivially_copyable' trait,
+    //:   and one that does not, both having a destructor that counts the
+    //:   objects destroyed:
+    //:
+    //:   1 Emplace elements into a hash table, and remove some of them so
+    //:     that the pool holds free nodes.  Call 'removeAllAndReleaseMemory',
+    //:     and verify that the test allocator has no blocks in use.  (C-1)
+    //:
+    //:   2 Verify the attributes of the hash table against those of a hash
+    //:     table that has not allocated, including the address of its only
+    //:     bucket.  (C-2)
+    //:
+    //:   3 Verify the number of elements destroyed.  (C-3)
+    //:
+    //:   4 Emplace elements again, and verify the size.  (C-4)
+    //:
+    //:   5 Call the method on an empty hash table, and verify that no memory
+    //:     is allocated or released.  (C-5)
+    //
+    // Testing:
+    //   removeAllAndReleaseMemory();
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\nTESTING 'removeAllAndReleaseMemory'"
+                        "\n===================================\n");
+
+    if (verbose) printf("\tTesting a trivially copyable value type.\n");
+    testRemoveAllAndReleaseMemory<true>();
+
+    if (verbose) printf("\tTesting a value type that is not trivially "
+                        "copyable.\n");
+    testRemoveAllAndReleaseMemory<false>();
+}
+
 #if 0  // Planned test cases, not yet implemented
 static
 void mainTestCase15()
@@ -11110,9 +11647,9 @@ int main(int argc, char *argv[])
                                                            g_bsltfAllocator_p);
 
     switch (test) { case 0:
-      case 16: mainTestCaseUsageExample(); break;
-//      case 17: mainTestCase17(); break;
-//      case 16: mainTestCase16(); break;
+      case 18: mainTestCaseUsageExample(); break;
+      case 17: mainTestCase17(); break;
+      case 16: mainTestCase16(); break;
       case 15: mainTestCase15(); break;
       case 14: mainTestCase14(); break;
       case 13: mainTestCase13(); break;
@@ -0,0 +1,691 @@
+// bslstl_intrusiveptr.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_INTRUSIVEPTR
+#define INCLUDED_BSLSTL_INTRUSIVEPTR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a smart pointer to objects holding their own ref count.
+//
+//@CLASSES:
+//  bslstl::IntrusivePtr: single-word pointer to an intrusively counted object
+//  bslstl::IntrusiveRefCount: base class holding a count and an allocator
+//
+//@SEE_ALSO: bslstl_sharedptr, bslstl_localsharedptr
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::IntrusivePtr', that manages the lifetime of an object whose
+// reference count is stored in the object itself, and a class template,
+// 'bslstl::IntrusiveRefCount', that can serve as the base class of such
+// objects.
+//
+// A 'bsl::shared_ptr' stores two pointers, one to the object and one to a
+// separate 'bslma::SharedPtrRep' holding the reference counts; even when the
+// object is created in-place, the representation adds a virtual table
+// pointer, two counters, and an allocator pointer to every object.  A
+// 'bslstl::IntrusivePtr' stores a single pointer, and the object carries only
+// what it needs to release itself.  This is worthwhile for large numbers of
+// small objects, such as immutable messages, that do not need weak
+// references, deleters, or aliasing.
+//
+///Customization Point
+///-------------------
+// 'bslstl::IntrusivePtr<TYPE>' acquires and releases references by calling
+// two free functions, found by argument-dependent lookup, that must be
+// declared for 'TYPE':
+//..
+//  void intrusivePtrAddRef(TYPE *object);
+//      // Acquire a reference to the specified 'object'.
+//
+//  void intrusivePtrRelease(TYPE *object);
+//      // Release a reference to the specified 'object', destroying it and
+//      // deallocating its memory if it was the last reference.
+//..
+// Note that the functions may take a pointer to a base class of 'TYPE', or a
+// pointer to 'const'.
+//
+///Class 'bslstl::IntrusiveRefCount'
+///---------------------------------
+// 'bslstl::IntrusiveRefCount<DERIVED>' provides both functions for a class
+// 'DERIVED' that derives from it (the "curiously recurring template
+// pattern").  It holds an atomic reference count and the allocator that
+// supplied the memory of the object, and when the last reference is released
+// it destroys the object as a 'DERIVED' and returns its memory to that
+// allocator, so that no virtual destructor is needed.  A new object has no
+// references, and copying an object does not copy its count.  The reference
+// count is atomic, so that objects can be shared between threads, but the
+// increment uses relaxed memory ordering, and only the decrement that may
+// destroy the object synchronizes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing Immutable Messages
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a system distributes large numbers of small, immutable
+// messages to several consumers.  First, we define a message class that
+// holds its own reference count by deriving from
+// 'bslstl::IntrusiveRefCount':
+//..
+//  class Message : public bslstl::IntrusiveRefCount<Message> {
+//      // This class represents an immutable message.
+//
+//      // DATA
+//      int d_sequenceNumber;
+//      int d_price;
+//
+//    public:
+//      // CREATORS
+//      Message(int sequenceNumber, int price, bslma::Allocator *allocator)
+//      : bslstl::IntrusiveRefCount<Message>(allocator)
+//      , d_sequenceNumber(sequenceNumber)
+//      , d_price(price)
+//      {
+//      }
+//
+//      // ACCESSORS
+//      int sequenceNumber() const { return d_sequenceNumber; }
+//      int price() const { return d_price; }
+//  };
+//..
+// Then, we create a message, from the same allocator that we pass to its
+// constructor, and hand it to a pointer:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bslstl::IntrusivePtr<const Message> message(
+//                                          new (ta) Message(1, 100, &ta));
+//  assert(1 == message->numReferences());
+//  assert(sizeof(message) == sizeof(Message *));
+//..
+// Next, we share the message with two consumers; each copy increments the
+// count held in the message:
+//..
+//  bslstl::IntrusivePtr<const Message> consumer1(message);
+//  bslstl::IntrusivePtr<const Message> consumer2(message);
+//  assert(3 == message->numReferences());
+//  assert(100 == consumer2->price());
+//..
+// Finally, we release every reference, and observe that the message has been
+// returned to its allocator:
+//..
+//  message.reset();
+//  consumer1.reset();
+//  assert(1 == ta.numBlocksInUse());
+//
+//  consumer2.reset();
+//  assert(0 == ta.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UNSPECIFIEDBOOL
+#include <bsls_unspecifiedbool.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                          // =======================
+                          // class IntrusiveRefCount
+                          // =======================
+
+template <class DERIVED>
+class IntrusiveRefCount {
+    // This class template provides an atomic reference count, and the
+    // allocator used to destroy the object when the count drops to zero, to
+    // a class of the (template parameter) type 'DERIVED' that derives from
+    // it, together with the 'intrusivePtrAddRef' and 'intrusivePtrRelease'
+    // functions used by 'IntrusivePtr'.  The behavior is undefined unless
+    // 'DERIVED' derives from this class, and an object managed by
+    // 'IntrusivePtr' was allocated from the allocator supplied at its
+    // construction.
+
+    // DATA
+    mutable bsls::AtomicInt  d_numReferences;  // number of references
+
+    bslma::Allocator        *d_allocator_p;    // allocator that supplied the
+                                               // object (held, not owned)
+
+    // FRIENDS
+    friend void intrusivePtrAddRef(const DERIVED *object)
+        // Acquire a reference to the specified 'object'.
+    {
+        object->acquireRef();
+    }
+
+    friend void intrusivePtrRelease(const DERIVED *object)
+        // Release a reference to the specified 'object', destroying it if
+        // this was the last reference.
+    {
+        object->releaseRef();
+    }
+
+  protected:
+    // PROTECTED CREATORS
+    explicit IntrusiveRefCount(bslma::Allocator *basicAllocator = 0);
+        // Create a base object with no references, that will return the
+        // memory of the derived object to the optionally specified
+        // 'basicAllocator' when the last reference is released.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    IntrusiveRefCount(const IntrusiveRefCount&  original,
+                      bslma::Allocator         *basicAllocator);
+        // Create a base object with no references, that will return the
+        // memory of the derived object to the specified 'basicAllocator'
+        // when the last reference is released.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  Note that the
+        // specified 'original' is ignored: a copy of an object is referred to
+        // by no pointer yet.  Also note that there is no copy constructor
+        // without an allocator, so that a class 'DERIVED' must state which
+        // allocator supplies the memory of each copy.
+
+    ~IntrusiveRefCount();
+        // Destroy this object.  The behavior is undefined unless there is no
+        // reference to this object.
+
+    // PROTECTED MANIPULATORS
+    IntrusiveRefCount& operator=(const IntrusiveRefCount& rhs);
+        // Return a reference to this modifiable object.  Note that neither
+        // the reference count nor the allocator is assigned from the
+        // specified 'rhs'.
+
+  private:
+    // NOT IMPLEMENTED
+    IntrusiveRefCount(const IntrusiveRefCount&);
+
+  public:
+    // ACCESSORS
+    void acquireRef() const;
+        // Atomically acquire a reference to this object.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used to destroy this object when the last
+        // reference is released.
+
+    int numReferences() const;
+        // Return a snapshot of the number of references to this object.
+
+    void releaseRef() const;
+        // Atomically release a reference to this object and, if it was the
+        // last reference, destroy this object as a 'DERIVED' object and
+        // return its memory to 'allocator()'.  The behavior is undefined
+        // unless '0 < numReferences()'.
+};
+
+                            // ==================
+                            // class IntrusivePtr
+                            // ==================
+
+template <class TYPE>
+class IntrusivePtr {
+    // This class template provides a smart pointer, consisting of a single
+    // pointer, to an object of the (template parameter) 'TYPE' whose
+    // reference count is maintained by the 'intrusivePtrAddRef' and
+    // 'intrusivePtrRelease' functions declared for 'TYPE'.  A non-null
+    // 'IntrusivePtr' holds one reference to its object.  Distinct
+    // 'IntrusivePtr' objects may be used concurrently by different threads if
+    // the reference-counting functions of 'TYPE' are thread-safe.
+
+    // PRIVATE TYPES
+    typedef typename bsls::UnspecifiedBool<IntrusivePtr>::BoolType BoolType;
+
+    // DATA
+    TYPE *d_ptr_p;  // object referred to, or 0
+
+    // FRIENDS
+    template <class COMPATIBLE_TYPE> friend class IntrusivePtr;
+
+  public:
+    // TYPES
+    typedef TYPE element_type;
+        // 'element_type' is an alias for the type of the object referred to.
+
+    // CREATORS
+    IntrusivePtr();
+        // Create a null pointer.
+
+    IntrusivePtr(TYPE *ptr, bool acquireReference = true);
+        // Create a pointer to the object at the specified 'ptr', acquiring a
+        // reference to it unless the optionally specified 'acquireReference'
+        // is 'false', in which case this pointer adopts a reference already
+        // held by the caller.  If 'ptr' is 0, create a null pointer.
+
+    IntrusivePtr(const IntrusivePtr& original);
+        // Create a pointer to the same object as the specified 'original',
+        // acquiring a reference to it if it is not null.
+
+    template <class COMPATIBLE_TYPE>
+    IntrusivePtr(const IntrusivePtr<COMPATIBLE_TYPE>& original);
+        // Create a pointer to the same object as the specified 'original',
+        // acquiring a reference to it if it is not null.  This constructor
+        // does not participate in overload resolution unless
+        // 'COMPATIBLE_TYPE *' is convertible to 'TYPE *'.
+
+    ~IntrusivePtr();
+        // Release the reference held by this pointer, if any.
+
+    // MANIPULATORS
+    IntrusivePtr& operator=(const IntrusivePtr& rhs);
+        // Make this pointer refer to the same object as the specified 'rhs',
+        // acquiring a reference to it and releasing the reference previously
+        // held, and return a reference to this modifiable pointer.
+
+    template <class COMPATIBLE_TYPE>
+    IntrusivePtr& operator=(const IntrusivePtr<COMPATIBLE_TYPE>& rhs);
+        // Make this pointer refer to the same object as the specified 'rhs',
+        // acquiring a reference to it and releasing the reference previously
+        // held, and return a reference to this modifiable pointer.
+
+    IntrusivePtr& operator=(TYPE *rhs);
+        // Make this pointer refer to the object at the specified 'rhs',
+        // acquiring a reference to it and releasing the reference previously
+        // held, and return a reference to this modifiable pointer.
+
+    TYPE *release();
+        // Make this pointer null *without* releasing the reference it held,
+        // and return the address of the object it referred to.  Note that
+        // the caller becomes responsible for the reference.
+
+    void reset();
+        // Make this pointer null, releasing the reference previously held.
+
+    void reset(TYPE *ptr, bool acquireReference = true);
+        // Make this pointer refer to the object at the specified 'ptr', as if
+        // by 'IntrusivePtr(ptr, acquireReference).swap(*this)'.
+
+    void swap(IntrusivePtr& other);
+        // Exchange the objects referred to by this pointer and the specified
+        // 'other' pointer.
+
+    // ACCESSORS
+    operator BoolType() const;
+        // Return a value of an "unspecified bool" type that evaluates to
+        // 'false' if this pointer is null, and 'true' otherwise.
+
+    TYPE& operator*() const;
+        // Return a reference providing modifiable access to the object
+        // referred to by this pointer.  The behavior is undefined if this
+        // pointer is null.
+
+    TYPE *operator->() const;
+        // Return the address of the object referred to by this pointer, or 0
+        // if it is null.
+
+    TYPE *get() const;
+        // Return the address of the object referred to by this pointer, or 0
+        // if it is null.
+};
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator==(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs);
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator==(const IntrusivePtr<LHS_TYPE>& lhs, RHS_TYPE *rhs);
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator==(LHS_TYPE *lhs, const IntrusivePtr<RHS_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' refer to the same object
+    // (or are both null), and 'false' otherwise.
+
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator!=(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs);
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator!=(const IntrusivePtr<LHS_TYPE>& lhs, RHS_TYPE *rhs);
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator!=(LHS_TYPE *lhs, const IntrusivePtr<RHS_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' refer to different
+    // objects, and 'false' otherwise.
+
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator<(const IntrusivePtr<LHS_TYPE>& lhs,
+               const IntrusivePtr<RHS_TYPE>& rhs);
+    // Return 'true' if the address of the object referred to by the specified
+    // 'lhs' is less than that referred to by the specified 'rhs', and 'false'
+    // otherwise.
+
+// FREE FUNCTIONS
+template <class TYPE>
+void swap(IntrusivePtr<TYPE>& a, IntrusivePtr<TYPE>& b);
+    // Exchange the objects referred to by the specified 'a' and 'b' pointers.
+
+// ============================================================================
+//                      INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class IntrusiveRefCount
+                          // -----------------------
+
+// PROTECTED CREATORS
+template <class DERIVED>
+inline
+IntrusiveRefCount<DERIVED>::IntrusiveRefCount(
+                                              bslma::Allocator *basicAllocator)
+: d_numReferences(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class DERIVED>
+inline
+IntrusiveRefCount<DERIVED>::IntrusiveRefCount(
+                                     const IntrusiveRefCount&,
+                                     bslma::Allocator         *basicAllocator)
+: d_numReferences(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class DERIVED>
+inline
+IntrusiveRefCount<DERIVED>::~IntrusiveRefCount()
+{
+    BSLS_ASSERT_SAFE(0 == d_numReferences.loadRelaxed());
+}
+
+// PROTECTED MANIPULATORS
+template <class DERIVED>
+inline
+IntrusiveRefCount<DERIVED>&
+IntrusiveRefCount<DERIVED>::operator=(const IntrusiveRefCount&)
+{
+    return *this;
+}
+
+// ACCESSORS
+template <class DERIVED>
+inline
+void IntrusiveRefCount<DERIVED>::acquireRef() const
+{
+    d_numReferences.addRelaxed(1);              // minimum consistency: relaxed
+}
+
+template <class DERIVED>
+inline
+bslma::Allocator *IntrusiveRefCount<DERIVED>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class DERIVED>
+inline
+int IntrusiveRefCount<DERIVED>::numReferences() const
+{
+    return d_numReferences.loadRelaxed();       // minimum consistency: relaxed
+}
+
+template <class DERIVED>
+inline
+void IntrusiveRefCount<DERIVED>::releaseRef() const
+{
+    BSLS_ASSERT_SAFE(0 < numReferences());
+
+    if (0 == d_numReferences.add(-1)) {
+                                        // release consistency: acquire/release
+        d_allocator_p->deleteObject(static_cast<const DERIVED *>(this));
+    }
+}
+
+                            // ------------------
+                            // class IntrusivePtr
+                            // ------------------
+
+// CREATORS
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr()
+: d_ptr_p(0)
+{
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr(TYPE *ptr, bool acquireReference)
+: d_ptr_p(ptr)
+{
+    if (ptr && acquireReference) {
+        intrusivePtrAddRef(ptr);
+    }
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr(const IntrusivePtr& original)
+: d_ptr_p(original.d_ptr_p)
+{
+    if (d_ptr_p) {
+        intrusivePtrAddRef(d_ptr_p);
+    }
+}
+
+template <class TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr(const IntrusivePtr<COMPATIBLE_TYPE>& original)
+: d_ptr_p(original.d_ptr_p)
+{
+    if (d_ptr_p) {
+        intrusivePtrAddRef(d_ptr_p);
+    }
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::~IntrusivePtr()
+{
+    if (d_ptr_p) {
+        intrusivePtrRelease(d_ptr_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>& IntrusivePtr<TYPE>::operator=(const IntrusivePtr& rhs)
+{
+    IntrusivePtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+IntrusivePtr<TYPE>&
+IntrusivePtr<TYPE>::operator=(const IntrusivePtr<COMPATIBLE_TYPE>& rhs)
+{
+    IntrusivePtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>& IntrusivePtr<TYPE>::operator=(TYPE *rhs)
+{
+    IntrusivePtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class TYPE>
+inline
+TYPE *IntrusivePtr<TYPE>::release()
+{
+    TYPE *ptr = d_ptr_p;
+    d_ptr_p = 0;
+    return ptr;
+}
+
+template <class TYPE>
+inline
+void IntrusivePtr<TYPE>::reset()
+{
+    IntrusivePtr().swap(*this);
+}
+
+template <class TYPE>
+inline
+void IntrusivePtr<TYPE>::reset(TYPE *ptr, bool acquireReference)
+{
+    IntrusivePtr(ptr, acquireReference).swap(*this);
+}
+
+template <class TYPE>
+inline
+void IntrusivePtr<TYPE>::swap(IntrusivePtr& other)
+{
+    TYPE *ptr = d_ptr_p;
+    d_ptr_p = other.d_ptr_p;
+    other.d_ptr_p = ptr;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+#if defined(BSLS_PLATFORM_CMP_IBM)
+IntrusivePtr<TYPE>::operator typename IntrusivePtr::BoolType() const
+#else
+IntrusivePtr<TYPE>::operator BoolType() const
+#endif
+{
+    return bsls::UnspecifiedBool<IntrusivePtr>::makeValue(d_ptr_p);
+}
+
+template <class TYPE>
+inline
+TYPE& IntrusivePtr<TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_ptr_p);
+
+    return *d_ptr_p;
+}
+
+template <class TYPE>
+inline
+TYPE *IntrusivePtr<TYPE>::operator->() const
+{
+    return d_ptr_p;
+}
+
+template <class TYPE>
+inline
+TYPE *IntrusivePtr<TYPE>::get() const
+{
+    return d_ptr_p;
+}
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator==(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator==(const IntrusivePtr<LHS_TYPE>& lhs, RHS_TYPE *rhs)
+{
+    return lhs.get() == rhs;
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator==(LHS_TYPE *lhs, const IntrusivePtr<RHS_TYPE>& rhs)
+{
+    return lhs == rhs.get();
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator!=(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator!=(const IntrusivePtr<LHS_TYPE>& lhs, RHS_TYPE *rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator!=(LHS_TYPE *lhs, const IntrusivePtr<RHS_TYPE>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator<(const IntrusivePtr<LHS_TYPE>& lhs,
+               const IntrusivePtr<RHS_TYPE>& rhs)
+{
+    return lhs.get() < rhs.get();
+}
+
+// FREE FUNCTIONS
+template <class TYPE>
+inline
+void swap(IntrusivePtr<TYPE>& a, IntrusivePtr<TYPE>& b)
+{
+    a.swap(b);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
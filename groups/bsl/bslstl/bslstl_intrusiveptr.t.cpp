@@ -0,0 +1,1212 @@
+// bslstl_intrusiveptr.t.cpp                                          -*-C++-*-
+#include <bslstl_intrusiveptr.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a smart pointer that delegates reference
+// counting to two free functions found by argument-dependent lookup, and a
+// base class that implements those functions with a count held in the
+// object.  The base class is tested first, verifying with
+// 'bslma::TestAllocator' that an object is returned to the allocator supplied
+// at its construction exactly when its last reference is released.  The
+// pointer is then tested against a test type whose reference-counting
+// functions record their calls, so that every manipulator can be verified to
+// acquire and release exactly the expected references.
+// ----------------------------------------------------------------------------
+// IntrusiveRefCount
+// [ 2] IntrusiveRefCount(bslma::Allocator *basicAllocator = 0);
+// [ 2] IntrusiveRefCount(const IntrusiveRefCount&, bslma::Allocator *);
+// [ 2] ~IntrusiveRefCount();
+// [ 2] IntrusiveRefCount& operator=(const IntrusiveRefCount&);
+// [ 2] void acquireRef() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] int numReferences() const;
+// [ 2] void releaseRef() const;
+// [ 2] void intrusivePtrAddRef(const DERIVED *);
+// [ 2] void intrusivePtrRelease(const DERIVED *);
+//
+// IntrusivePtr
+// [ 1] IntrusivePtr();
+// [ 3] IntrusivePtr(TYPE *ptr, bool acquireReference = true);
+// [ 4] IntrusivePtr(const IntrusivePtr&);
+// [ 5] IntrusivePtr(const IntrusivePtr<COMPATIBLE_TYPE>&);
+// [ 3] ~IntrusivePtr();
+// [ 4] IntrusivePtr& operator=(const IntrusivePtr&);
+// [ 5] IntrusivePtr& operator=(const IntrusivePtr<COMPATIBLE_TYPE>&);
+// [ 4] IntrusivePtr& operator=(TYPE *);
+// [ 3] TYPE *release();
+// [ 4] void reset();
+// [ 3] void reset(TYPE *ptr, bool acquireReference = true);
+// [ 4] void swap(IntrusivePtr&);
+// [ 4] operator BoolType() const;
+// [ 1] TYPE& operator*() const;
+// [ 1] TYPE *operator->() const;
+// [ 1] TYPE *get() const;
+// [ 4] operator==(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+// [ 4] operator==(const IntrusivePtr<L>&, R *);
+// [ 4] operator==(L *, const IntrusivePtr<R>&);
+// [ 4] operator!=(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+// [ 4] operator!=(const IntrusivePtr<L>&, R *);
+// [ 4] operator!=(L *, const IntrusivePtr<R>&);
+// [ 4] operator<(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+// [ 4] void swap(IntrusivePtr<TYPE>&, IntrusivePtr<TYPE>&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: MEMORY AND COPY COST
+
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+                              // ==============
+                              // class TestNode
+                              // ==============
+
+class TestNode {
+    // This class provides its own reference-counting functions, which count
+    // their calls, and records its destruction in a counter supplied at
+    // construction.
+
+    // DATA
+    int  d_numReferences;   // number of references
+    int  d_numAcquired;     // number of calls to 'intrusivePtrAddRef'
+    int  d_numReleased;     // number of calls to 'intrusivePtrRelease'
+    int *d_numDestroyed_p;  // incremented on destruction (held, not owned)
+    int  d_value;           // value of this object
+
+    // FRIENDS
+    friend void intrusivePtrAddRef(TestNode *node);
+    friend void intrusivePtrRelease(TestNode *node);
+
+  public:
+    // CREATORS
+    explicit TestNode(int *numDestroyed, int value = 0)
+    : d_numReferences(0)
+    , d_numAcquired(0)
+    , d_numReleased(0)
+    , d_numDestroyed_p(numDestroyed)
+    , d_value(value)
+        // Create an object having the specified 'value', and no references,
+        // that increments the specified 'numDestroyed' when destroyed.
+    {
+    }
+
+    virtual ~TestNode()
+        // Increment the counter supplied at construction.
+    {
+        ++*d_numDestroyed_p;
+    }
+
+    // ACCESSORS
+    int numAcquired() const
+        // Return the number of calls to 'intrusivePtrAddRef'.
+    {
+        return d_numAcquired;
+    }
+
+    int numReferences() const
+        // Return the number of references to this object.
+    {
+        return d_numReferences;
+    }
+
+    int numReleased() const
+        // Return the number of calls to 'intrusivePtrRelease'.
+    {
+        return d_numReleased;
+    }
+
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+void intrusivePtrAddRef(TestNode *node)
+    // Acquire a reference to the specified 'node'.
+{
+    ++node->d_numAcquired;
+    ++node->d_numReferences;
+}
+
+void intrusivePtrRelease(TestNode *node)
+    // Release a reference to the specified 'node', deleting it if this was
+    // the last reference.
+{
+    ++node->d_numReleased;
+    if (0 == --node->d_numReferences) {
+        delete node;
+    }
+}
+
+                           // =====================
+                           // class DerivedTestNode
+                           // =====================
+
+class DerivedTestNode : public TestNode {
+    // This class, derived from 'TestNode', uses the reference-counting
+    // functions of its base class.
+
+  public:
+    // CREATORS
+    DerivedTestNode(int *numDestroyed, int value)
+    : TestNode(numDestroyed, value)
+        // Create an object having the specified 'value' that increments the
+        // specified 'numDestroyed' when destroyed.
+    {
+    }
+};
+
+}  // close namespace test
+
+                             // =================
+                             // class CountedNode
+                             // =================
+
+class CountedNode : public bslstl::IntrusiveRefCount<CountedNode> {
+    // This class derives from 'IntrusiveRefCount' and records its destruction
+    // in a counter supplied at construction.
+
+    // DATA
+    int *d_numDestroyed_p;  // incremented on destruction (held, not owned)
+    int  d_value;           // value of this object
+
+  public:
+    // CREATORS
+    CountedNode(int *numDestroyed, int value, bslma::Allocator *allocator)
+    : bslstl::IntrusiveRefCount<CountedNode>(allocator)
+    , d_numDestroyed_p(numDestroyed)
+    , d_value(value)
+        // Create an object having the specified 'value' that increments the
+        // specified 'numDestroyed' when destroyed, and that is returned to
+        // the specified 'allocator' when its last reference is released.
+    {
+    }
+
+    CountedNode(const CountedNode& original, bslma::Allocator *allocator)
+    : bslstl::IntrusiveRefCount<CountedNode>(original, allocator)
+    , d_numDestroyed_p(original.d_numDestroyed_p)
+    , d_value(original.d_value)
+        // Create a copy of the specified 'original' object, that is returned
+        // to the specified 'allocator' when its last reference is released.
+    {
+    }
+
+    ~CountedNode()
+        // Increment the counter supplied at construction.
+    {
+        ++*d_numDestroyed_p;
+    }
+
+    // MANIPULATORS
+    CountedNode& operator=(const CountedNode& rhs)
+        // Assign the value of the specified 'rhs' to this object, and return
+        // a reference to this modifiable object.
+    {
+        bslstl::IntrusiveRefCount<CountedNode>::operator=(rhs);
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+                              // ===============
+                              // struct Quote
+                              // ===============
+
+struct Quote {
+    // This 'struct' is a small value held by 'bsl::shared_ptr' in the
+    // performance test.
+
+    int d_price;  // price
+    int d_size;   // size
+
+    Quote(int price, int size)
+    : d_price(price)
+    , d_size(size)
+        // Create a quote having the specified 'price' and 'size'.
+    {
+    }
+
+    int value() const
+        // Return the size of this quote.
+    {
+        return d_size;
+    }
+};
+
+                           // ====================
+                           // class IntrusiveQuote
+                           // ====================
+
+class IntrusiveQuote : public bslstl::IntrusiveRefCount<IntrusiveQuote> {
+    // This class holds the same data as 'Quote', together with its own
+    // reference count.
+
+    // DATA
+    int d_price;  // price
+    int d_size;   // size
+
+  public:
+    // CREATORS
+    IntrusiveQuote(int price, int size, bslma::Allocator *allocator)
+    : bslstl::IntrusiveRefCount<IntrusiveQuote>(allocator)
+    , d_price(price)
+    , d_size(size)
+        // Create a quote having the specified 'price' and 'size', that is
+        // returned to the specified 'allocator' when its last reference is
+        // released.
+    {
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the size of this quote.
+    {
+        return d_size;
+    }
+};
+
+typedef bslstl::IntrusivePtr<test::TestNode> Obj;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class POINTER>
+double timeCopyToArray(const POINTER& source, int numRounds)
+    // Return the time, in seconds, to copy the specified 'source' into each
+    // element of an array and then reset each element, the specified
+    // 'numRounds' times.
+{
+    enum { NUM_COPIES = 1024 };
+
+    POINTER         copies[NUM_COPIES];
+    bsls::Stopwatch timer;
+
+    timer.start();
+    for (int round = 0; round < numRounds; ++round) {
+        for (int i = 0; i < NUM_COPIES; ++i) {
+            copies[i] = source;
+        }
+        for (int i = 0; i < NUM_COPIES; ++i) {
+            copies[i].reset();
+        }
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+template <class POINTER>
+int useCopy(POINTER copy)
+    // Return the value of the object referred to by the specified 'copy',
+    // which is passed by value.
+{
+    return copy->value();
+}
+
+template <class POINTER>
+double timePassByValue(const POINTER& source, int numCalls, int *sum)
+    // Return the time, in seconds, to pass the specified 'source' by value to
+    // a function the specified 'numCalls' times, and load into the specified
+    // 'sum' the sum of the results of the calls.
+{
+    bsls::Stopwatch timer;
+    int             total = 0;
+
+    timer.start();
+    for (int i = 0; i < numCalls; ++i) {
+        total += useCopy(source);
+    }
+    timer.stop();
+
+    *sum = total;
+    return timer.elapsedTime();
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Example 1: Sharing Immutable Messages
+/// - - - - - - - - - - - - - - - - - - -
+
+class Message : public bslstl::IntrusiveRefCount<Message> {
+    // This class represents an immutable message.
+
+    // DATA
+    int d_sequenceNumber;
+    int d_price;
+
+  public:
+    // CREATORS
+    Message(int sequenceNumber, int price, bslma::Allocator *allocator)
+    : bslstl::IntrusiveRefCount<Message>(allocator)
+    , d_sequenceNumber(sequenceNumber)
+    , d_price(price)
+    {
+    }
+
+    // ACCESSORS
+    int sequenceNumber() const { return d_sequenceNumber; }
+    int price() const { return d_price; }
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        //Example 1: Sharing Immutable Messages
+        // - - - - - - - - - - - - - - - - - - -
+        bslma::TestAllocator ta;
+
+        bslstl::IntrusivePtr<const Message> message(
+                                                new (ta) Message(1, 100, &ta));
+        ASSERT(1 == message->numReferences());
+        ASSERT(sizeof(message) == sizeof(Message *));
+
+        bslstl::IntrusivePtr<const Message> consumer1(message);
+        bslstl::IntrusivePtr<const Message> consumer2(message);
+        ASSERT(3 == message->numReferences());
+        ASSERT(100 == consumer2->price());
+
+        message.reset();
+        consumer1.reset();
+        ASSERT(1 == ta.numBlocksInUse());
+
+        consumer2.reset();
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONVERSIONS
+        //
+        // Concerns:
+        //: 1 A pointer to a derived type converts to a pointer to its base,
+        //:   and a pointer to a modifiable type converts to a pointer to
+        //:   'const', by construction and by assignment.
+        //:
+        //: 2 A conversion acquires one reference, and the converted pointer
+        //:   releases it.
+        //:
+        //: 3 An object referred to through a pointer to its base is destroyed
+        //:   when the last pointer of either type is destroyed.
+        //
+        // Plan:
+        //: 1 Create pointers to a 'test::DerivedTestNode' object, convert
+        //:   them to pointers to 'test::TestNode' and to
+        //:   'const CountedNode', and verify the number of references and the
+        //:   destruction of the objects.  (C-1..3)
+        //
+        // Testing:
+        //   IntrusivePtr(const IntrusivePtr<COMPATIBLE_TYPE>&);
+        //   IntrusivePtr& operator=(const IntrusivePtr<COMPATIBLE_TYPE>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONVERSIONS"
+                            "\n===========\n");
+
+        if (verbose) printf("\tDerived to base.\n");
+        {
+            int numDestroyed = 0;
+
+            test::DerivedTestNode *node =
+                                   new test::DerivedTestNode(&numDestroyed, 5);
+
+            bslstl::IntrusivePtr<test::DerivedTestNode> derived(node);
+            {
+                Obj mX(derived);  const Obj& X = mX;
+                ASSERT(node == X.get());
+                ASSERT(2 == node->numReferences());
+                ASSERT(5 == X->value());
+
+                Obj mY;  const Obj& Y = mY;
+                mY = derived;
+                ASSERT(node == Y.get());
+                ASSERT(3 == node->numReferences());
+                ASSERT(X == derived);
+                ASSERT(derived == Y);
+            }
+            ASSERT(1 == node->numReferences());
+            ASSERT(0 == numDestroyed);
+
+            Obj mX(derived);
+            derived.reset();
+            ASSERT(0 == numDestroyed);
+
+            mX.reset();
+            ASSERT(1 == numDestroyed);
+        }
+
+        if (verbose) printf("\tModifiable to 'const'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            int numDestroyed = 0;
+
+            bslstl::IntrusivePtr<CountedNode> mX(
+                                  new (oa) CountedNode(&numDestroyed, 7, &oa));
+
+            bslstl::IntrusivePtr<const CountedNode> mY(mX);
+            const bslstl::IntrusivePtr<const CountedNode>& Y = mY;
+            ASSERT(2 == Y->numReferences());
+            ASSERT(7 == Y->value());
+
+            mX.reset();
+            ASSERT(1 == Y->numReferences());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mY.reset();
+            ASSERT(1 == numDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 A copy of a pointer refers to the same object, and acquires a
+        //:   reference to it unless it is null.
+        //:
+        //: 2 Assignment acquires a reference to the new object before
+        //:   releasing the reference to the old one, so that assigning a
+        //:   pointer to itself, or assigning the object already referred to,
+        //:   does not destroy the object.
+        //:
+        //: 3 'reset' and 'swap' release and exchange references as expected,
+        //:   and 'swap' neither acquires nor releases any.
+        //:
+        //: 4 The comparison operators compare the addresses of the objects,
+        //:   and a pointer evaluates to 'false' exactly when it is null.
+        //
+        // Plan:
+        //: 1 Using 'test::TestNode', which counts the calls to its
+        //:   reference-counting functions, exercise each manipulator and
+        //:   verify the number of calls and of references.  (C-1..3)
+        //:
+        //: 2 Compare null and non-null pointers to two objects with each
+        //:   operator, and verify the results against the comparison of the
+        //:   addresses.  (C-4)
+        //
+        // Testing:
+        //   IntrusivePtr(const IntrusivePtr&);
+        //   IntrusivePtr& operator=(const IntrusivePtr&);
+        //   IntrusivePtr& operator=(TYPE *);
+        //   void reset();
+        //   void swap(IntrusivePtr&);
+        //   operator BoolType() const;
+        //   operator==(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+        //   operator==(const IntrusivePtr<L>&, R *);
+        //   operator==(L *, const IntrusivePtr<R>&);
+        //   operator!=(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+        //   operator!=(const IntrusivePtr<L>&, R *);
+        //   operator!=(L *, const IntrusivePtr<R>&);
+        //   operator<(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+        //   void swap(IntrusivePtr<TYPE>&, IntrusivePtr<TYPE>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, AND COMPARISON"
+                            "\n================================\n");
+
+        if (verbose) printf("\tCopy construction.\n");
+        {
+            int numDestroyed = 0;
+
+            test::TestNode *node = new test::TestNode(&numDestroyed, 1);
+
+            Obj mX(node);  const Obj& X = mX;
+            {
+                Obj mY(X);  const Obj& Y = mY;
+                ASSERT(node == Y.get());
+                ASSERT(2 == node->numReferences());
+                ASSERT(2 == node->numAcquired());
+            }
+            ASSERT(1 == node->numReferences());
+            ASSERT(1 == node->numReleased());
+
+            const Obj Z;
+            Obj       mW(Z);  const Obj& W = mW;
+            ASSERT(0 == W.get());
+            ASSERT(2 == node->numAcquired());
+        }
+
+        if (verbose) printf("\tAssignment.\n");
+        {
+            int numDestroyed = 0;
+
+            test::TestNode *nodeA = new test::TestNode(&numDestroyed, 1);
+            test::TestNode *nodeB = new test::TestNode(&numDestroyed, 2);
+
+            Obj mX(nodeA);  const Obj& X = mX;
+            Obj mY(nodeB);  const Obj& Y = mY;
+
+            mX = X;
+            ASSERT(nodeA == X.get());
+            ASSERT(1 == nodeA->numReferences());
+            ASSERT(0 == numDestroyed);
+
+            Obj& result = (mX = Y);
+            ASSERT(&mX == &result);
+            ASSERT(nodeB == X.get());
+            ASSERT(2 == nodeB->numReferences());
+            ASSERT(1 == numDestroyed);  // 'nodeA' is gone
+
+            mX = nodeB;
+            ASSERT(nodeB == X.get());
+            ASSERT(2 == nodeB->numReferences());
+
+            mX = static_cast<test::TestNode *>(0);
+            ASSERT(0 == X.get());
+            ASSERT(1 == nodeB->numReferences());
+
+            mX = nodeB;
+            mY = Obj();
+            ASSERT(1 == nodeB->numReferences());
+            ASSERT(1 == numDestroyed);
+
+            mX.reset();
+            ASSERT(!X);
+            ASSERT(2 == numDestroyed);
+
+            mX.reset();
+            ASSERT(!X);
+        }
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            int numDestroyed = 0;
+
+            test::TestNode *nodeA = new test::TestNode(&numDestroyed, 1);
+            test::TestNode *nodeB = new test::TestNode(&numDestroyed, 2);
+
+            Obj mX(nodeA);  const Obj& X = mX;
+            Obj mY(nodeB);  const Obj& Y = mY;
+
+            mX.swap(mY);
+            ASSERT(nodeB == X.get());
+            ASSERT(nodeA == Y.get());
+
+            swap(mX, mY);
+            ASSERT(nodeA == X.get());
+            ASSERT(nodeB == Y.get());
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ.swap(mX);
+            ASSERT(!X);
+            ASSERT(nodeA == Z.get());
+
+            ASSERT(1 == nodeA->numAcquired());
+            ASSERT(0 == nodeA->numReleased());
+            ASSERT(1 == nodeB->numAcquired());
+            ASSERT(0 == nodeB->numReleased());
+        }
+
+        if (verbose) printf("\tComparison.\n");
+        {
+            int numDestroyed = 0;
+
+            test::TestNode *nodeA = new test::TestNode(&numDestroyed, 1);
+            test::TestNode *nodeB = new test::TestNode(&numDestroyed, 2);
+
+            const Obj A(nodeA);
+            const Obj B(nodeB);
+            const Obj A2(A);
+            const Obj N;
+
+            ASSERT(A);
+            ASSERT(!N);
+
+            ASSERT(  A == A2 );
+            ASSERT(!(A != A2));
+            ASSERT(!(A == B ));
+            ASSERT(  A != B  );
+            ASSERT(!(A == N ));
+            ASSERT(  N == Obj());
+
+            ASSERT(  A == nodeA );
+            ASSERT(  nodeA == A );
+            ASSERT(  A != nodeB );
+            ASSERT(  nodeB != A );
+            ASSERT(!(B != nodeB));
+            ASSERT(!(nodeA != A));
+
+            ASSERT((A < B) == (nodeA < nodeB));
+            ASSERT((B < A) == (nodeB < nodeA));
+            ASSERT(!(A < A2));
+            ASSERT(N < A);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CUSTOMIZATION POINT
+        //
+        // Concerns:
+        //: 1 A pointer created from a non-null pointer calls
+        //:   'intrusivePtrAddRef' once, unless told to adopt an existing
+        //:   reference, and calls 'intrusivePtrRelease' once on destruction.
+        //:
+        //: 2 A pointer created from a null pointer calls neither function.
+        //:
+        //: 3 'release' makes the pointer null without releasing its
+        //:   reference, which can be adopted by another pointer.
+        //:
+        //: 4 'reset' with a pointer behaves like the constructor.
+        //:
+        //: 5 The functions are found by argument-dependent lookup in the
+        //:   namespace of the type.
+        //
+        // Plan:
+        //: 1 Using 'test::TestNode', whose reference-counting functions are
+        //:   declared in namespace 'test' and count their calls, create,
+        //:   release, and reset pointers, and verify the number of calls, of
+        //:   references, and of destroyed objects.  (C-1..5)
+        //
+        // Testing:
+        //   IntrusivePtr(TYPE *ptr, bool acquireReference = true);
+        //   ~IntrusivePtr();
+        //   TYPE *release();
+        //   void reset(TYPE *ptr, bool acquireReference = true);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCUSTOMIZATION POINT"
+                            "\n===================\n");
+
+        if (verbose) printf("\tAcquiring a reference.\n");
+        {
+            int numDestroyed = 0;
+
+            test::TestNode *node = new test::TestNode(&numDestroyed, 3);
+            {
+                Obj mX(node);  const Obj& X = mX;
+                ASSERT(node == X.get());
+                ASSERT(1 == node->numAcquired());
+                ASSERT(0 == node->numReleased());
+                ASSERT(1 == node->numReferences());
+            }
+            ASSERT(1 == numDestroyed);
+        }
+
+        if (verbose) printf("\tNull pointer.\n");
+        {
+            Obj mX(0);             const Obj& X = mX;
+            Obj mY(0, false);      const Obj& Y = mY;
+            ASSERT(0 == X.get());
+            ASSERT(0 == Y.get());
+        }
+
+        if (verbose) printf("\tAdopting and releasing a reference.\n");
+        {
+            int numDestroyed = 0;
+
+            test::TestNode *node = new test::TestNode(&numDestroyed, 4);
+
+            Obj mX(node);  const Obj& X = mX;
+
+            test::TestNode *raw = mX.release();
+            ASSERT(node == raw);
+            ASSERT(0 == X.get());
+            ASSERT(1 == node->numReferences());
+            ASSERT(0 == node->numReleased());
+
+            {
+                Obj mY(raw, false);  const Obj& Y = mY;
+                ASSERT(node == Y.get());
+                ASSERT(1 == node->numAcquired());
+                ASSERT(1 == node->numReferences());
+            }
+            ASSERT(1 == numDestroyed);
+        }
+
+        if (verbose) printf("\t'reset' with a pointer.\n");
+        {
+            int numDestroyed = 0;
+
+            test::TestNode *nodeA = new test::TestNode(&numDestroyed, 1);
+            test::TestNode *nodeB = new test::TestNode(&numDestroyed, 2);
+
+            Obj mX(nodeA);  const Obj& X = mX;
+
+            mX.reset(nodeB);
+            ASSERT(nodeB == X.get());
+            ASSERT(1 == nodeB->numAcquired());
+            ASSERT(1 == numDestroyed);
+
+            mX.reset(nodeB);
+            ASSERT(nodeB == X.get());
+            ASSERT(1 == nodeB->numReferences());
+            ASSERT(1 == numDestroyed);
+
+            test::TestNode *raw = mX.release();
+            mX.reset(raw, false);
+            ASSERT(nodeB == X.get());
+            ASSERT(1 == nodeB->numReferences());
+            ASSERT(2 == nodeB->numAcquired());
+
+            mX.reset(0);
+            ASSERT(0 == X.get());
+            ASSERT(2 == numDestroyed);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'IntrusiveRefCount'
+        //
+        // Concerns:
+        //: 1 A new object has no references, and holds the allocator supplied
+        //:   at construction, or the default allocator if none is supplied.
+        //:
+        //: 2 Each reference acquired must be released before the object is
+        //:   destroyed, and releasing the last reference destroys the object
+        //:   as the derived type and returns its memory to its allocator.
+        //:
+        //: 3 A copy of an object has no references, and its own allocator.
+        //:
+        //: 4 Assignment leaves the count and the allocator unchanged.
+        //:
+        //: 5 'intrusivePtrAddRef' and 'intrusivePtrRelease' are found for a
+        //:   pointer to the derived type, modifiable or not.
+        //:
+        //: 6 Releasing a reference to an object having none is detected in
+        //:   appropriate build modes.
+        //
+        // Plan:
+        //: 1 Create 'CountedNode' objects from a test allocator, and verify
+        //:   the count and the allocator.  (C-1)
+        //:
+        //: 2 Acquire and release references, directly and through the free
+        //:   functions, and verify the count, the number of destroyed objects,
+        //:   and the blocks in use by the allocator.  (C-2, 5)
+        //:
+        //: 3 Copy and assign objects having references, and verify the counts
+        //:   and allocators.  (C-3..4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid calls to 'releaseRef', using the
+        //:   'BSLS_ASSERTTEST_*' macros.  (C-6)
+        //
+        // Testing:
+        //   IntrusiveRefCount(bslma::Allocator *basicAllocator = 0);
+        //   IntrusiveRefCount(const IntrusiveRefCount&, bslma::Allocator *);
+        //   ~IntrusiveRefCount();
+        //   IntrusiveRefCount& operator=(const IntrusiveRefCount&);
+        //   void acquireRef() const;
+        //   bslma::Allocator *allocator() const;
+        //   int numReferences() const;
+        //   void releaseRef() const;
+        //   void intrusivePtrAddRef(const DERIVED *);
+        //   void intrusivePtrRelease(const DERIVED *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'IntrusiveRefCount'"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tAllocator.\n");
+        {
+            int numDestroyed = 0;
+
+            CountedNode mX(&numDestroyed, 1, &oa);  const CountedNode& X = mX;
+            ASSERT(0  == X.numReferences());
+            ASSERT(&oa == X.allocator());
+
+            CountedNode mY(&numDestroyed, 2, 0);  const CountedNode& Y = mY;
+            ASSERT(0  == Y.numReferences());
+            ASSERT(&da == Y.allocator());
+        }
+
+        if (verbose) printf("\tAcquiring and releasing references.\n");
+        {
+            int numDestroyed = 0;
+
+            CountedNode *node = new (oa) CountedNode(&numDestroyed, 1, &oa);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            node->acquireRef();
+            ASSERT(1 == node->numReferences());
+
+            intrusivePtrAddRef(node);
+            ASSERT(2 == node->numReferences());
+
+            const CountedNode *constNode = node;
+            intrusivePtrAddRef(constNode);
+            ASSERT(3 == node->numReferences());
+
+            intrusivePtrRelease(constNode);
+            ASSERT(2 == node->numReferences());
+
+            node->releaseRef();
+            ASSERT(1 == node->numReferences());
+            ASSERT(0 == numDestroyed);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            intrusivePtrRelease(node);
+            ASSERT(1 == numDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tCopying and assignment.\n");
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            int numDestroyed = 0;
+
+            CountedNode *node = new (oa) CountedNode(&numDestroyed, 1, &oa);
+            node->acquireRef();
+            node->acquireRef();
+
+            CountedNode *copy = new (sa) CountedNode(*node, &sa);
+            ASSERT(0   == copy->numReferences());
+            ASSERT(&sa == copy->allocator());
+            ASSERT(1   == copy->value());
+            copy->acquireRef();
+
+            CountedNode *other = new (sa) CountedNode(&numDestroyed, 2, &sa);
+            other->acquireRef();
+
+            *copy = *other;
+            ASSERT(2   == copy->value());
+            ASSERT(1   == copy->numReferences());
+            ASSERT(&sa == copy->allocator());
+            ASSERT(2   == node->numReferences());
+
+            copy->releaseRef();
+            other->releaseRef();
+            node->releaseRef();
+            node->releaseRef();
+            ASSERT(3 == numDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            int numDestroyed = 0;
+
+            CountedNode *node = new (oa) CountedNode(&numDestroyed, 1, &oa);
+
+            ASSERT_SAFE_FAIL(node->releaseRef());
+
+            node->acquireRef();
+            ASSERT_SAFE_PASS(node->releaseRef());
+            ASSERT(1 == numDestroyed);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a null pointer, a pointer to an object derived from
+        //:   'IntrusiveRefCount', and copies of it, and verify the number of
+        //:   references and that the object is destroyed and deallocated when
+        //:   the last pointer is reset.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   IntrusivePtr();
+        //   TYPE& operator*() const;
+        //   TYPE *operator->() const;
+        //   TYPE *get() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bslstl::IntrusivePtr<CountedNode> CountedObj;
+
+        ASSERT(sizeof(CountedObj) == sizeof(CountedNode *));
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        int numDestroyed = 0;
+
+        const CountedObj N;
+        ASSERT(0 == N.get());
+        ASSERT(0 == N.operator->());
+
+        CountedNode *node = new (oa) CountedNode(&numDestroyed, 9, &oa);
+
+        CountedObj mX(node);  const CountedObj& X = mX;
+        ASSERT(node == X.get());
+        ASSERT(node == X.operator->());
+        ASSERT(node == &*X);
+        ASSERT(9    == X->value());
+        ASSERT(9    == (*X).value());
+        ASSERT(1    == X->numReferences());
+
+        CountedObj mY(X);  const CountedObj& Y = mY;
+        ASSERT(node == Y.get());
+        ASSERT(2    == X->numReferences());
+
+        mX.reset();
+        ASSERT(0 == X.get());
+        ASSERT(1 == Y->numReferences());
+        ASSERT(1 == oa.numBlocksInUse());
+
+        mY.reset();
+        ASSERT(1 == numDestroyed);
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: MEMORY AND COPY COST
+        //
+        // Concerns:
+        //: 1 Report the memory used per object, and the size of a pointer,
+        //:   for an object managed by 'IntrusivePtr' and one created by
+        //:   'bsl::shared_ptr::createInplace'.
+        //:
+        //: 2 Report the cost of copying and destroying an 'IntrusivePtr',
+        //:   compared with a 'bsl::shared_ptr'.
+        //
+        // Plan:
+        //: 1 Create many objects holding the same data with each type of
+        //:   pointer from a test allocator, and print the number of bytes in
+        //:   use per object, and the size of each pointer.  (C-1)
+        //:
+        //: 2 For each type of pointer, time copying a pointer into each
+        //:   element of an array and then resetting each element, and time
+        //:   passing a pointer by value to a function, and print the mean
+        //:   time per copy.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: MEMORY AND COPY COST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: MEMORY AND COPY COST"
+                            "\n======================================\n");
+
+        typedef bsl::shared_ptr<Quote>              SharedQuotePtr;
+        typedef bslstl::IntrusivePtr<IntrusiveQuote> IntrusiveQuotePtr;
+
+        enum { NUM_OBJECTS = 1024 };
+
+        bslma::TestAllocator sa("shared", veryVeryVeryVerbose);
+        bslma::TestAllocator ia("intrusive", veryVeryVeryVerbose);
+
+        {
+            SharedQuotePtr    sharedPtrs[NUM_OBJECTS];
+            IntrusiveQuotePtr intrusivePtrs[NUM_OBJECTS];
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                sharedPtrs[i].createInplace(&sa, i, 100);
+                intrusivePtrs[i] = new (ia) IntrusiveQuote(i, 100, &ia);
+            }
+
+            printf("%-24s %16s %16s\n",
+                   "", "bsl::shared_ptr", "IntrusivePtr");
+            printf("%-24s %16.1f %16.1f\n",
+                   "bytes per object",
+                   static_cast<double>(sa.numBytesInUse()) / NUM_OBJECTS,
+                   static_cast<double>(ia.numBytesInUse()) / NUM_OBJECTS);
+            printf("%-24s %16d %16d\n",
+                   "bytes per pointer",
+                   static_cast<int>(sizeof(SharedQuotePtr)),
+                   static_cast<int>(sizeof(IntrusiveQuotePtr)));
+            printf("%-24s %16d %16d\n",
+                   "payload bytes",
+                   static_cast<int>(sizeof(Quote)),
+                   static_cast<int>(sizeof(Quote)));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == ia.numBlocksInUse());
+
+        const int NUM_ROUNDS = 20000;
+        const int NUM_COPIES = 1024 * NUM_ROUNDS;  // see 'timeCopyToArray'
+        const int NUM_CALLS  = NUM_COPIES;
+
+        SharedQuotePtr sharedPtr;
+        sharedPtr.createInplace(&sa, 1, 1);
+
+        IntrusiveQuotePtr intrusivePtr(new (ia) IntrusiveQuote(1, 1, &ia));
+
+        int sharedSum    = 0;
+        int intrusiveSum = 0;
+
+        const double SHARED_ARRAY    = timeCopyToArray(sharedPtr, NUM_ROUNDS);
+        const double INTRUSIVE_ARRAY = timeCopyToArray(intrusivePtr,
+                                                       NUM_ROUNDS);
+        const double SHARED_CALL     = timePassByValue(sharedPtr,
+                                                       NUM_CALLS,
+                                                       &sharedSum);
+        const double INTRUSIVE_CALL  = timePassByValue(intrusivePtr,
+                                                       NUM_CALLS,
+                                                       &intrusiveSum);
+
+        ASSERT(NUM_CALLS == sharedSum);
+        ASSERT(NUM_CALLS == intrusiveSum);
+        ASSERT(1 == sharedPtr.use_count());
+        ASSERT(1 == intrusivePtr->numReferences());
+
+        printf("\n%-24s %16s %16s   (ns/copy)\n",
+               "", "bsl::shared_ptr", "IntrusivePtr");
+        printf("%-24s %16.2f %16.2f\n",
+               "copy to array, reset",
+               SHARED_ARRAY * 1e9 / NUM_COPIES,
+               INTRUSIVE_ARRAY * 1e9 / NUM_COPIES);
+        printf("%-24s %16.2f %16.2f\n",
+               "pass by value",
+               SHARED_CALL * 1e9 / NUM_CALLS,
+               INTRUSIVE_CALL * 1e9 / NUM_CALLS);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -547,6 +547,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_compilerfeatures.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 namespace bsl {
 
                         // =====================
@@ -857,6 +861,48 @@ class list
         }
     };
 
+    class SortProctor
+        // This class provides a proctor that, in the event that an exception
+        // is thrown by the comparator during 'sort', rebuilds the forward
+        // links of a list from its backward links.  Because 'sort' does not
+        // modify any backward link until all comparisons have been made, this
+        // restores the list to its original order.
+    {
+        // DATA
+        Node *d_sentinel_p;  // sentinel of the list to repair, or 0
+
+      public:
+        // CREATORS
+        explicit SortProctor(Node *sentinel)
+            // Create a sort proctor for the list having the specified
+            // 'sentinel' node.
+        : d_sentinel_p(sentinel)
+        {
+        }
+
+        ~SortProctor()
+            // Destroy this sort proctor, and rebuild the forward links of the
+            // proctored list from its backward links unless the 'release'
+            // method has been called before.
+        {
+            if (d_sentinel_p) {
+                Node *node = d_sentinel_p;
+                do {
+                    Node *prev = node->d_prev;
+                    prev->d_next = node;
+                    node = prev;
+                } while (node != d_sentinel_p);
+            }
+        }
+
+        // MANIPULATORS
+        void release()
+            // Release the list from management by this proctor.
+        {
+            d_sentinel_p = 0;
+        }
+    };
+
     struct Comp_Elems {
         // Binary function predicate object type for comparing two 'VALUE'
         // objects using 'operator<'.  This operation is usually, but not
@@ -979,15 +1025,18 @@ class list
         // '[node2, finish)' each describe a contiguous sequence of nodes.
 
     template <class COMPARE>
-    NodePtr sort_imp(NodePtr       *pnode1,
-                     size_type      size,
-                     const COMPARE& comp);
-        // Sort the sequence of 'size' nodes starting with '*pnode1'.
-        // Modifies '*pnode1' to refer to the first node of the sorted
-        // sequence.  If an exception is thrown, all nodes remain properly
-        // linked, but their order is unspecified.  The behavior is undefined
-        // unless '*pnode1' begins a sequence of at least 'size' nodes, none
-        // of which are sentinel nodes.
+    static Node *merge_runs(Node     *run1,
+                            Node     *run2,
+                            Node     *end,
+                            COMPARE&  comp);
+        // Merge the specified sorted runs 'run1' and 'run2', each a non-empty
+        // sequence of nodes linked through 'd_next' and terminated by the
+        // specified 'end' node, using the specified 'comp' comparator, and
+        // return the first node of the merged run, which is also terminated
+        // by 'end'.  Nodes of 'run1' precede equivalent nodes of 'run2' in
+        // the merged run.  Only the 'd_next' links are modified.  If an
+        // exception is thrown, the 'd_next' links of the nodes in both runs
+        // are unspecified.
 
   public:
     // CREATORS
@@ -1531,7 +1580,11 @@ class list
     template <class COMPARE>
     void sort(COMPARE comp);
         // Sort this list in non-decreasing order according to the orders
-        // returned by the specified 'comp' comparator.
+        // returned by the specified 'comp' comparator.  The sort is stable
+        // (equivalent elements retain their relative order), allocates no
+        // memory, and relinks the existing nodes so that no element is
+        // copied, moved, or assigned.  If 'comp' throws an exception, this
+        // list is left in its original order.
 
     void reverse();
         // Reverse the order of the elements in this list.
@@ -1966,25 +2019,38 @@ list<VALUE, ALLOCATOR>::merge_imp(NodePtr node1,
 
 template <class VALUE, class ALLOCATOR>
 template <class COMPARE>
-typename list<VALUE, ALLOCATOR>::NodePtr
-list<VALUE, ALLOCATOR>::sort_imp(NodePtr       *pnode1,
-                                 size_type      size,
-                                 const COMPARE& comp)
-{
-    BSLS_ASSERT(size > 0);
-
-    NodePtr node1 = *pnode1;
-    if (size < 2) {
-        return node1->d_next;                                         // RETURN
+typename list<VALUE, ALLOCATOR>::Node *
+list<VALUE, ALLOCATOR>::merge_runs(Node     *run1,
+                                   Node     *run2,
+                                   Node     *end,
+                                   COMPARE&  comp)
+{
+    BSLS_ASSERT(run1 != end);
+    BSLS_ASSERT(run2 != end);
+
+    Node  *head;
+    Node **tail = &head;
+
+    while (true) {
+        if (comp(run2->d_value, run1->d_value)) {
+            *tail = run2;
+            tail  = &run2->d_next;
+            run2  = run2->d_next;
+            if (end == run2) {
+                *tail = run1;
+                return head;                                          // RETURN
+            }
+        }
+        else {
+            *tail = run1;
+            tail  = &run1->d_next;
+            run1  = run1->d_next;
+            if (end == run1) {
+                *tail = run2;
+                return head;                                          // RETURN
+            }
+        }
     }
-
-    size_type half = size / 2;
-
-    NodePtr node2 = sort_imp(&node1, half,        comp);
-    NodePtr next  = sort_imp(&node2, size - half, comp);
-
-    *pnode1 = merge_imp(node1, node2, next, comp);
-    return next;
 }
 
 // PRIVATE ACCESSORS
@@ -3013,8 +3079,66 @@ void list<VALUE, ALLOCATOR>::sort(COMPARE comp)
     if (size_ref() < 2) {
         return;                                                       // RETURN
     }
-    NodePtr node1 = d_sentinel->d_next;
-    sort_imp(&node1, size(), comp);
+
+    // This is a non-recursive, bottom-up merge sort that relinks the existing
+    // nodes.  Input nodes are taken one at a time and carried up through
+    // 'bins', where 'bins[i]' is either 0 or a sorted run of exactly '2^i'
+    // nodes, exactly as a binary counter is incremented.  Runs are singly
+    // linked through 'd_next' and terminated by the sentinel; the 'd_prev'
+    // links are left untouched until every comparison has been made, so that
+    // 'proctor' can restore the original order should 'comp' throw.  A run
+    // in a higher bin always holds elements that appeared earlier in the
+    // list, so passing it as the first run to 'merge_runs' keeps the sort
+    // stable.
+
+    enum { k_MAX_BINS = sizeof(size_type) * 8 };
+
+    Node *sentinel = d_sentinel;
+    Node *bins[k_MAX_BINS];
+    int   numBins = 0;
+
+    SortProctor proctor(sentinel);
+
+    Node *node = sentinel->d_next;
+    while (node != sentinel) {
+        Node *next = node->d_next;
+        BloombergLP::bsls::PerformanceHint::prefetchForReading(next);
+
+        node->d_next = sentinel;
+        Node *carry  = node;
+
+        int i = 0;
+        for (; i < numBins && bins[i]; ++i) {
+            carry   = merge_runs(bins[i], carry, sentinel, comp);
+            bins[i] = 0;
+        }
+        if (i == numBins) {
+            ++numBins;
+        }
+        bins[i] = carry;
+
+        node = next;
+    }
+
+    Node *result = 0;
+    for (int i = 0; i < numBins; ++i) {
+        if (bins[i]) {
+            result = result ? merge_runs(bins[i], result, sentinel, comp)
+                            : bins[i];
+        }
+    }
+
+    proctor.release();
+
+    // Rebuild the backward links and close the circle through the sentinel.
+
+    Node *prev = sentinel;
+    for (node = result; node != sentinel; node = node->d_next) {
+        node->d_prev = prev;
+        prev         = node;
+    }
+    sentinel->d_next = result;
+    sentinel->d_prev = prev;
 }
 
 template <class VALUE, class ALLOCATOR>
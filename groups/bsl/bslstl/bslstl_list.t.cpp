@@ -157,6 +157,8 @@ using namespace bsl;
 // [20] bool operator<=(const list<T,A>&, const list<T,A>&);
 // [20] bool operator>=(const list<T,A>&, const list<T,A>&);
 // [19] void swap(list<T,A>&, list<T,A>&);
+//
+// [-2] PERFORMANCE TEST: SORT
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
@@ -1310,6 +1312,22 @@ bool operator!=(IntWrapper a, IntWrapper b)
 
 enum TestEnum { TWO = 2, NINETYNINE = 99 };
 
+                              // =================
+                              // class ScatterLess
+                              // =================
+
+struct ScatterLess {
+    // Comparator ordering 'int' values by a multiplicative hash of their
+    // value.  Sorting a list with this comparator scatters its nodes so that
+    // list order no longer matches allocation order.
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return static_cast<unsigned>(lhs) * 2654435761u
+             < static_cast<unsigned>(rhs) * 2654435761u;
+    }
+};
+
 //=============================================================================
 //                       USAGE EXAMPLES
 //-----------------------------------------------------------------------------
@@ -2060,7 +2078,7 @@ void TestDriver<TYPE,ALLOC>::testSort()
     //   9. The number of calls to the comparison operation is no larger than
     //      'N*log2(N)', where 'N' is the number of elements.
     //   10. If the comparison function throws an exception, no memory is
-    //       leaked.  (The order of the elements is indeterminate.)
+    //       leaked and the list is restored to its original order.
     //
     // Test plan:
     //   Create a series of list specifications of different lengths, some
@@ -2084,8 +2102,9 @@ void TestDriver<TYPE,ALLOC>::testSort()
     //   the predicate operator is instrumented to throw an exception after a
     //   specific number of iterations.  Using a sample string, set the
     //   comparison operator to throw at different counts and verify, after
-    //   each exception, that no memory is leaked, that the list is valid, and
-    //   that every element in the list is represented by a saved iterator.
+    //   each exception, that no memory is leaked, that the list is valid,
+    //   that every element in the list is represented by a saved iterator,
+    //   and that the saved iterators appear in their original order.
     //
     // Testing:
     //   void sort();
@@ -2387,8 +2406,7 @@ void TestDriver<TYPE,ALLOC>::testSort()
         }
 
         // Verify that all iterators in list were already in the list before
-        // the sort (and before the exception).  The order of elements is
-        // unspecified in the case of an exception, and is thus not tested.
+        // the sort (and before the exception).
         for (xi = X.begin(); xi != X.end(); ++xi) {
             // Find index of iterator in saved iterator array
             const_iterator* p = find(save_iters, save_iters + EH_SPEC_LEN, xi);
@@ -2400,6 +2418,15 @@ void TestDriver<TYPE,ALLOC>::testSort()
                 LOOP_ASSERT(threshold, value_of(*xi) == VAL);
             }
         } // End for (xi)
+
+        if (caught_ex) {
+            // Verify that the list was restored to its original order.
+
+            xi = X.begin();
+            for (int j = 0; j < EH_SPEC_LEN; ++j, ++xi) {
+                LOOP2_ASSERT(threshold, j, save_iters[j] == xi);
+            }
+        }
     } // End for (threshold)
 #endif // BDE_BUILD_TARGET_EXC
 }
@@ -9885,7 +9912,91 @@ int main(int argc, char *argv[])
         list<bsltf::NonAssignableTestType> secondList(firstList);
         list<bsltf::NonAssignableTestType> thirdList(firstList.begin(),
                                                      firstList.end());
-      }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: SORT
+        //
+        // Concerns:
+        //: 1 'sort' scales as O(N*log(N)) on large lists whose nodes are
+        //:   scattered in memory, for both random and nearly-sorted input.
+        //
+        // Plan:
+        //: 1 Build lists of 'int' of increasing length, holding either
+        //:   pseudo-random values or an ascending sequence with one element
+        //:   in a hundred displaced, and time 'sort' on each.  To scatter the
+        //:   nodes, each list is first sorted on a pseudo-random key so that
+        //:   list order no longer matches allocation order.  Report the
+        //:   elapsed time per element.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: SORT
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: SORT"
+                            "\n======================\n");
+
+        static const int SIZES[] = { 1000, 10000, 100000, 1000000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%10s %22s %22s\n",
+               "length", "random ns/elem", "nearly-sorted ns/elem");
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int LENGTH = SIZES[ti];
+            const int REPS   = 4000000 / LENGTH;
+
+            double elapsed[2] = { 0.0, 0.0 };
+            for (int mode = 0; mode < 2; ++mode) {
+                for (int r = 0; r < REPS; ++r) {
+                    list<int> mX;  const list<int>& X = mX;
+
+                    unsigned seed = 12345u + r;
+                    for (int i = 0; i < LENGTH; ++i) {
+                        mX.push_back(i);
+                    }
+                    mX.sort(ScatterLess());
+
+                    // Rewrite the (scattered) nodes with the input sequence.
+
+                    int i = 0;
+                    for (list<int>::iterator it = mX.begin();
+                         it != mX.end();
+                         ++it, ++i) {
+                        seed = seed * 1103515245u + 12345u;
+                        if (0 == mode) {
+                            *it = static_cast<int>(seed >> 8);
+                        }
+                        else {
+                            *it = 0 == (seed >> 8) % 100
+                                  ? static_cast<int>(seed >> 8) % LENGTH
+                                  : i;
+                        }
+                    }
+
+                    bsls::Stopwatch timer;
+                    timer.start();
+                    mX.sort();
+                    timer.stop();
+                    elapsed[mode] += timer.elapsedTime();
+
+                    int prev = *X.begin();
+                    for (list<int>::const_iterator it = X.begin();
+                         it != X.end();
+                         ++it) {
+                        ASSERT(prev <= *it);
+                        prev = *it;
+                    }
+                    ASSERT(LENGTH == static_cast<int>(X.size()));
+                }
+            }
+
+            printf("%10d %22.1f %22.1f\n",
+                   LENGTH,
+                   elapsed[0] * 1e9 / REPS / LENGTH,
+                   elapsed[1] * 1e9 / REPS / LENGTH);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
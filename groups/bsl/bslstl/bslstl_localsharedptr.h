@@ -0,0 +1,2199 @@
+// bslstl_localsharedptr.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_LOCALSHAREDPTR
+#define INCLUDED_BSLSTL_LOCALSHAREDPTR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a shared pointer with non-atomic reference counts.
+//
+//@CLASSES:
+//  bslstl::LocalSharedPtr: shared pointer for objects confined to one thread
+//  bslstl::LocalWeakPtr: weak pointer to an object owned by 'LocalSharedPtr'
+//  bslstl::LocalSharedPtrRep: reference-count protocol of 'LocalSharedPtr'
+//
+//@SEE_ALSO: bslstl_sharedptr, bslma_sharedptrrep
+//
+//@DESCRIPTION: This component provides a pair of class templates,
+// 'bslstl::LocalSharedPtr' and 'bslstl::LocalWeakPtr', that provide the
+// shared-ownership semantics of 'bsl::shared_ptr' and 'bsl::weak_ptr' for
+// objects that are only ever accessed from a single thread, such as objects
+// owned by an event loop.  'bsl::shared_ptr' maintains its reference counts
+// in 'bslma::SharedPtrRep' using atomic read-modify-write operations, so that
+// every copy and every destruction of a shared pointer costs a locked
+// instruction (tens of cycles on current hardware) even when no other thread
+// ever sees the object.  'bslstl::LocalSharedPtr' maintains its counts in a
+// 'bslstl::LocalSharedPtrRep', which uses plain 'int' members, so that
+// copying and destroying a shared pointer costs an ordinary increment or
+// decrement.
+//
+// A 'bslstl::LocalSharedPtr' supports the same core operations as
+// 'bsl::shared_ptr': it can take ownership of an object together with an
+// optional deleter, create the object "in-place" in the same allocation as
+// the representation ('createInplace'), share ownership while pointing to a
+// different object (the "aliasing" constructor), and be observed by a
+// 'bslstl::LocalWeakPtr', whose 'lock' method returns an empty shared pointer
+// once the object has been destroyed.
+//
+///Thread Safety
+///-------------
+// Neither class is thread-safe, even for distinct objects: *all* shared and
+// weak pointers that refer to the same object, and the object itself, must be
+// used by one thread at a time.  In practice, a 'bslstl::LocalSharedPtr'
+// should never be passed to another thread; use 'bsl::shared_ptr' for objects
+// that are shared between threads.  Note that an object owned by
+// 'bslstl::LocalSharedPtr' can be handed over, as a whole, to another thread
+// provided that all shared and weak pointers to it are handed over together,
+// with appropriate synchronization.
+//
+///Deleters
+///--------
+// When a 'bslstl::LocalSharedPtr' takes ownership of an object created
+// elsewhere, it can be given a deleter.  If the deleter is convertible to
+// 'bslma::Allocator *', the object is destroyed by calling 'deleteObject' on
+// that allocator, and the representation is allocated from it unless another
+// allocator is supplied; otherwise, the deleter is a function pointer or a
+// functor that is invoked with the address of the object.  If no deleter is
+// supplied, the object is deleted using the currently installed default
+// allocator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Connection Among Handlers of an Event Loop
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the handlers registered with a single-threaded event loop
+// share ownership of the connection on which they operate, and that a
+// monitor holds a weak reference to the connection.  First, we define the
+// connection:
+//..
+//  struct Connection {
+//      int d_id;
+//      int d_numMessages;
+//
+//      explicit Connection(int id) : d_id(id), d_numMessages(0) {}
+//  };
+//..
+// Then, we create the connection in-place, so that a single allocation holds
+// both the connection and its reference counts:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bslstl::LocalSharedPtr<Connection> connection;
+//  connection.createInplace(&ta, 42);
+//  assert(1 == ta.numBlocksInUse());
+//..
+// Next, we give a copy of the pointer to each handler, and a weak pointer to
+// the monitor.  Each copy merely increments a plain integer:
+//..
+//  bslstl::LocalSharedPtr<Connection> readHandler(connection);
+//  bslstl::LocalSharedPtr<Connection> writeHandler(connection);
+//  bslstl::LocalWeakPtr<Connection>   monitor(connection);
+//  assert(3 == connection.use_count());
+//
+//  ++readHandler->d_numMessages;
+//  ++writeHandler->d_numMessages;
+//  assert(2 == connection->d_numMessages);
+//..
+// Then, we give the handler that needs only the identifier of the connection
+// an aliasing pointer, which shares ownership of the connection:
+//..
+//  bslstl::LocalSharedPtr<int> id(connection, &connection->d_id);
+//  assert(42 == *id);
+//  assert(4 == connection.use_count());
+//..
+// Finally, we release every shared reference, and observe that the monitor
+// sees the connection expire:
+//..
+//  connection.reset();
+//  readHandler.reset();
+//  writeHandler.reset();
+//  assert(!monitor.expired());
+//
+//  id.reset();
+//  assert(monitor.expired());
+//  assert(!monitor.lock());
+//
+//  monitor.reset();
+//  assert(0 == ta.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UNSPECIFIEDBOOL
+#include <bsls_unspecifiedbool.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+template <class ELEMENT_TYPE> class LocalSharedPtr;
+template <class ELEMENT_TYPE> class LocalWeakPtr;
+
+                          // =======================
+                          // class LocalSharedPtrRep
+                          // =======================
+
+class LocalSharedPtrRep {
+    // This class provides a partially implemented representation ("letter")
+    // protocol for 'LocalSharedPtr', analogous to 'bslma::SharedPtrRep', that
+    // holds the number of shared and weak references to a shared object in
+    // non-atomic integers.  Concrete implementations specify, through
+    // 'disposeObject' and 'disposeRep', what happens when the counts reach
+    // zero.  This class is not thread-safe.
+
+    // DATA
+    int d_numSharedReferences;  // number of shared references
+
+    int d_adjustedWeakCount;    // number of weak references, plus 1 if there
+                                // are any shared references
+
+    // NOT IMPLEMENTED
+    LocalSharedPtrRep(const LocalSharedPtrRep&);
+    LocalSharedPtrRep& operator=(const LocalSharedPtrRep&);
+
+  protected:
+    // PROTECTED CREATORS
+    virtual ~LocalSharedPtrRep();
+        // Destroy this representation object.  Note that this destructor is
+        // never called by 'LocalSharedPtr'; 'disposeRep' is called instead.
+
+  public:
+    // CREATORS
+    LocalSharedPtrRep();
+        // Create a 'LocalSharedPtrRep' object having one shared reference and
+        // no weak references.
+
+    // MANIPULATORS
+    void acquireRef();
+        // Acquire a shared reference to the shared object referred to by this
+        // representation.  The behavior is undefined unless
+        // '0 < numReferences()'.
+
+    void acquireWeakRef();
+        // Acquire a weak reference to the shared object referred to by this
+        // representation.  The behavior is undefined unless
+        // '0 < numWeakReferences() || 0 < numReferences()'.
+
+    void releaseRef();
+        // Release a shared reference to the shared object referred to by this
+        // representation, disposing of the shared object if this was the last
+        // shared reference, and disposing of this representation if this was
+        // the last (shared or weak) reference.  The behavior is undefined
+        // unless '0 < numReferences()'.
+
+    void releaseWeakRef();
+        // Release a weak reference to the shared object referred to by this
+        // representation, disposing of this representation if this was the
+        // last (shared or weak) reference.  The behavior is undefined unless
+        // '0 < numWeakReferences()'.
+
+    bool tryAcquireRef();
+        // Acquire a shared reference to the shared object referred to by this
+        // representation if that object has not been disposed of, and do
+        // nothing otherwise.  Return 'true' if a reference was acquired, and
+        // 'false' otherwise.
+
+    virtual void disposeObject() = 0;
+        // Dispose of the shared object referred to by this representation.
+        // This method is invoked by 'releaseRef' when the number of shared
+        // references reaches zero and should not be explicitly invoked
+        // otherwise.
+
+    virtual void disposeRep() = 0;
+        // Dispose of this representation object.  This method is invoked by
+        // 'releaseRef' and 'releaseWeakRef' when the numbers of shared and
+        // weak references both reach zero, after 'disposeObject', and should
+        // not be explicitly invoked otherwise.
+
+    // ACCESSORS
+    virtual void *originalPtr() const = 0;
+        // Return the (untyped) address of the modifiable shared object
+        // referred to by this representation.
+
+    bool hasUniqueOwner() const;
+        // Return 'true' if there is exactly one shared reference and no weak
+        // reference to the shared object referred to by this representation,
+        // and 'false' otherwise.
+
+    int numReferences() const;
+        // Return the number of shared references to the shared object
+        // referred to by this representation.
+
+    int numWeakReferences() const;
+        // Return the number of weak references to the shared object referred
+        // to by this representation.
+};
+
+                      // ===============================
+                      // class LocalSharedPtr_InplaceRep
+                      // ===============================
+
+template <class TYPE>
+class LocalSharedPtr_InplaceRep : public LocalSharedPtrRep {
+    // This component-private class template implements 'LocalSharedPtrRep'
+    // for an object of the (template parameter) 'TYPE' stored in the
+    // representation itself.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator that supplied this object
+                                      // (held, not owned)
+
+    TYPE              d_instance;     // shared object
+
+    // NOT IMPLEMENTED
+    LocalSharedPtr_InplaceRep(const LocalSharedPtr_InplaceRep&);
+    LocalSharedPtr_InplaceRep& operator=(const LocalSharedPtr_InplaceRep&);
+
+    // PRIVATE CREATORS
+    ~LocalSharedPtr_InplaceRep();
+        // Destroy this object.  Note that this destructor is never called;
+        // 'disposeObject' destroys the shared object and 'disposeRep'
+        // deallocates this object.
+
+  public:
+    // CREATORS
+    explicit LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator);
+    template <class A1>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1);
+    template <class A1, class A2>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2);
+    template <class A1, class A2, class A3>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3);
+    template <class A1, class A2, class A3, class A4>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4);
+    template <class A1, class A2, class A3, class A4, class A5>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5);
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7,
+                              const A8&         a8);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7,
+                              const A8&         a8,
+                              const A9&         a9);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7,
+                              const A8&         a8,
+                              const A9&         a9,
+                              const A10&        a10);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7,
+                              const A8&         a8,
+                              const A9&         a9,
+                              const A10&        a10,
+                              const A11&        a11);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7,
+                              const A8&         a8,
+                              const A9&         a9,
+                              const A10&        a10,
+                              const A11&        a11,
+                              const A12&        a12);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12,
+              class A13>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7,
+                              const A8&         a8,
+                              const A9&         a9,
+                              const A10&        a10,
+                              const A11&        a11,
+                              const A12&        a12,
+                              const A13&        a13);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12,
+              class A13, class A14>
+    LocalSharedPtr_InplaceRep(bslma::Allocator *basicAllocator,
+                              const A1&         a1,
+                              const A2&         a2,
+                              const A3&         a3,
+                              const A4&         a4,
+                              const A5&         a5,
+                              const A6&         a6,
+                              const A7&         a7,
+                              const A8&         a8,
+                              const A9&         a9,
+                              const A10&        a10,
+                              const A11&        a11,
+                              const A12&        a12,
+                              const A13&        a13,
+                              const A14&        a14);
+        // Create a representation holding a 'TYPE' object constructed from
+        // the specified arguments 'a1' up to 'a14', if any, that will return
+        // its memory to the specified 'basicAllocator' when disposed of.  The
+        // behavior is undefined unless this object was allocated from
+        // 'basicAllocator'.
+
+    // MANIPULATORS
+    virtual void disposeObject();
+        // Destroy the shared object.
+
+    virtual void disposeRep();
+        // Return the memory of this representation to its allocator.
+
+    TYPE *ptr();
+        // Return the address of the modifiable shared object.
+
+    // ACCESSORS
+    virtual void *originalPtr() const;
+        // Return the (untyped) address of the modifiable shared object.
+};
+
+                     // ==================================
+                     // class LocalSharedPtr_OutofplaceRep
+                     // ==================================
+
+template <class TYPE, class DELETER>
+class LocalSharedPtr_OutofplaceRep : public LocalSharedPtrRep {
+    // This component-private class template implements 'LocalSharedPtrRep'
+    // for an object of the (template parameter) 'TYPE' allocated separately
+    // from the representation and destroyed by a deleter of the (template
+    // parameter) 'DELETER' type, which is either convertible to
+    // 'bslma::Allocator *' or invocable with a 'TYPE *'.
+
+    // DATA
+    TYPE             *d_ptr_p;        // shared object (owned)
+
+    DELETER           d_deleter;      // destroys '*d_ptr_p'
+
+    bslma::Allocator *d_allocator_p;  // allocator that supplied this object
+                                      // (held, not owned)
+
+    // NOT IMPLEMENTED
+    LocalSharedPtr_OutofplaceRep(const LocalSharedPtr_OutofplaceRep&);
+    LocalSharedPtr_OutofplaceRep& operator=(
+                                          const LocalSharedPtr_OutofplaceRep&);
+
+    // PRIVATE CLASS METHODS
+    static bslma::Allocator *deleterAllocator(const DELETER& deleter,
+                                              bsl::true_type);
+        // Return the specified 'deleter' converted to 'bslma::Allocator *'.
+
+    static bslma::Allocator *deleterAllocator(const DELETER& deleter,
+                                              bsl::false_type);
+        // Return the currently installed default allocator.  Note that the
+        // specified 'deleter' is ignored.
+
+    static void deleteObject(TYPE *ptr, DELETER& deleter, bsl::true_type);
+        // Destroy the specified 'ptr' by calling 'deleteObject' on the
+        // specified 'deleter', which is convertible to 'bslma::Allocator *'.
+
+    static void deleteObject(TYPE *ptr, DELETER& deleter, bsl::false_type);
+        // Destroy the specified 'ptr' by invoking the specified 'deleter'.
+
+    // PRIVATE CREATORS
+    LocalSharedPtr_OutofplaceRep(TYPE             *ptr,
+                                 const DELETER&    deleter,
+                                 bslma::Allocator *basicAllocator);
+        // Create a representation that owns the specified 'ptr' and destroys
+        // it with the specified 'deleter', and that will return its memory to
+        // the specified 'basicAllocator' when disposed of.
+
+    ~LocalSharedPtr_OutofplaceRep();
+        // Destroy this object.  Note that this destructor is called only by
+        // 'disposeRep', after 'disposeObject' has destroyed the shared object.
+
+  public:
+    // CLASS METHODS
+    static LocalSharedPtr_OutofplaceRep *create(
+                                            TYPE             *ptr,
+                                            const DELETER&    deleter,
+                                            bslma::Allocator *basicAllocator);
+        // Return the address of a new representation, allocated from the
+        // specified 'basicAllocator' (or, if 'basicAllocator' is 0, from the
+        // allocator designated by 'deleter' if 'DELETER' is convertible to
+        // 'bslma::Allocator *', and the default allocator otherwise), that
+        // owns the specified 'ptr' and destroys it with the specified
+        // 'deleter'.  If an exception is thrown, 'ptr' is destroyed with
+        // 'deleter' before the exception propagates.
+
+    // MANIPULATORS
+    virtual void disposeObject();
+        // Destroy the shared object using the deleter.
+
+    virtual void disposeRep();
+        // Destroy this representation and return its memory to its allocator.
+
+    // ACCESSORS
+    virtual void *originalPtr() const;
+        // Return the (untyped) address of the modifiable shared object.
+};
+
+                           // ====================
+                           // class LocalSharedPtr
+                           // ====================
+
+template <class ELEMENT_TYPE>
+class LocalSharedPtr {
+    // This class template provides a shared pointer to an object of the
+    // (template parameter) 'ELEMENT_TYPE' with the semantics of
+    // 'bsl::shared_ptr', but whose reference counts are not atomic.  All
+    // 'LocalSharedPtr' and 'LocalWeakPtr' objects referring to the same object
+    // must be used by a single thread at a time.
+
+    // PRIVATE TYPES
+    typedef typename bsls::UnspecifiedBool<LocalSharedPtr>::BoolType BoolType;
+
+    // DATA
+    ELEMENT_TYPE      *d_ptr_p;  // object referred to
+    LocalSharedPtrRep *d_rep_p;  // representation of the owned object, or 0
+
+    // FRIENDS
+    template <class COMPATIBLE_TYPE> friend class LocalSharedPtr;
+    template <class COMPATIBLE_TYPE> friend class LocalWeakPtr;
+
+    // PRIVATE MANIPULATORS
+    void adoptRep(ELEMENT_TYPE *ptr, LocalSharedPtrRep *rep);
+        // Make this shared pointer refer to the object at the specified 'ptr'
+        // and adopt a shared reference, already acquired, from the specified
+        // 'rep', releasing the reference previously held.
+
+  public:
+    // TYPES
+    typedef ELEMENT_TYPE element_type;
+        // 'element_type' is an alias for the type of the object referred to.
+
+    // CREATORS
+    LocalSharedPtr();
+        // Create an empty shared pointer.
+
+    template <class COMPATIBLE_TYPE>
+    explicit LocalSharedPtr(COMPATIBLE_TYPE *ptr);
+        // Create a shared pointer that owns the object at the specified 'ptr',
+        // which is deleted using the currently installed default allocator
+        // when the last shared reference is released.  If 'ptr' is 0, create
+        // an empty shared pointer.  The behavior is undefined unless '*ptr'
+        // was allocated by the currently installed default allocator.
+
+    template <class COMPATIBLE_TYPE, class DELETER>
+    LocalSharedPtr(COMPATIBLE_TYPE  *ptr,
+                   const DELETER&    deleter,
+                   bslma::Allocator *basicAllocator = 0);
+        // Create a shared pointer that owns the object at the specified 'ptr',
+        // which is destroyed using the specified 'deleter' when the last
+        // shared reference is released.  Optionally specify a
+        // 'basicAllocator' used to supply memory for the representation.  If
+        // 'basicAllocator' is 0, the representation is allocated from
+        // 'deleter' if 'DELETER' is convertible to 'bslma::Allocator *', and
+        // from the currently installed default allocator otherwise.  If 'ptr'
+        // is 0, create an empty shared pointer.  If an exception is thrown,
+        // '*ptr' is destroyed using 'deleter'.  See {Deleters}.
+
+    LocalSharedPtr(ELEMENT_TYPE *ptr, LocalSharedPtrRep *rep);
+        // Create a shared pointer that refers to the object at the specified
+        // 'ptr' and adopts a shared reference, already acquired, from the
+        // specified 'rep'.  If 'rep' is 0, create a shared pointer that
+        // refers to 'ptr' without owning it.  Note that a pointer to a class
+        // derived from 'LocalSharedPtrRep' must be converted to
+        // 'LocalSharedPtrRep *' explicitly; otherwise, the constructor taking
+        // a deleter is selected.
+
+    template <class COMPATIBLE_TYPE>
+    LocalSharedPtr(const LocalSharedPtr<COMPATIBLE_TYPE>& source,
+                   ELEMENT_TYPE                          *object);
+        // Create a shared pointer that shares ownership with the specified
+        // 'source' but refers to the specified 'object' (the "aliasing"
+        // constructor).  Note that 'object' is typically a member or element
+        // of the object owned by 'source'.
+
+    LocalSharedPtr(const LocalSharedPtr& original);
+        // Create a shared pointer that refers to and shares ownership with
+        // the specified 'original'.
+
+    template <class COMPATIBLE_TYPE>
+    LocalSharedPtr(const LocalSharedPtr<COMPATIBLE_TYPE>& original);
+        // Create a shared pointer that refers to and shares ownership with
+        // the specified 'original'.  This constructor does not participate in
+        // overload resolution unless 'COMPATIBLE_TYPE *' is convertible to
+        // 'ELEMENT_TYPE *'.
+
+    ~LocalSharedPtr();
+        // Release the shared reference held by this object, if any,
+        // destroying the owned object if this was the last shared reference.
+
+    // MANIPULATORS
+    LocalSharedPtr& operator=(const LocalSharedPtr& rhs);
+        // Make this shared pointer refer to and share ownership with the
+        // specified 'rhs', release the reference previously held, and return
+        // a reference to this modifiable object.
+
+    template <class COMPATIBLE_TYPE>
+    LocalSharedPtr& operator=(const LocalSharedPtr<COMPATIBLE_TYPE>& rhs);
+        // Make this shared pointer refer to and share ownership with the
+        // specified 'rhs', release the reference previously held, and return
+        // a reference to this modifiable object.
+
+    void reset();
+        // Make this shared pointer empty, releasing the reference previously
+        // held, if any.
+
+    template <class COMPATIBLE_TYPE>
+    void reset(COMPATIBLE_TYPE *ptr);
+        // Make this shared pointer own the object at the specified 'ptr', as
+        // if by 'LocalSharedPtr(ptr).swap(*this)'.
+
+    template <class COMPATIBLE_TYPE, class DELETER>
+    void reset(COMPATIBLE_TYPE  *ptr,
+               const DELETER&    deleter,
+               bslma::Allocator *basicAllocator = 0);
+        // Make this shared pointer own the object at the specified 'ptr', as
+        // if by 'LocalSharedPtr(ptr, deleter, basicAllocator).swap(*this)'.
+
+    void swap(LocalSharedPtr& other);
+        // Exchange the states of this shared pointer and the specified
+        // 'other' shared pointer.
+
+    void createInplace(bslma::Allocator *basicAllocator = 0);
+    template <class A1>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1);
+    template <class A1, class A2>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2);
+    template <class A1, class A2, class A3>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3);
+    template <class A1, class A2, class A3, class A4>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4);
+    template <class A1, class A2, class A3, class A4, class A5>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5);
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7,
+                       const A8&         a8);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7,
+                       const A8&         a8,
+                       const A9&         a9);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7,
+                       const A8&         a8,
+                       const A9&         a9,
+                       const A10&        a10);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7,
+                       const A8&         a8,
+                       const A9&         a9,
+                       const A10&        a10,
+                       const A11&        a11);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7,
+                       const A8&         a8,
+                       const A9&         a9,
+                       const A10&        a10,
+                       const A11&        a11,
+                       const A12&        a12);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12,
+              class A13>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7,
+                       const A8&         a8,
+                       const A9&         a9,
+                       const A10&        a10,
+                       const A11&        a11,
+                       const A12&        a12,
+                       const A13&        a13);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12,
+              class A13, class A14>
+    void createInplace(bslma::Allocator *basicAllocator,
+                       const A1&         a1,
+                       const A2&         a2,
+                       const A3&         a3,
+                       const A4&         a4,
+                       const A5&         a5,
+                       const A6&         a6,
+                       const A7&         a7,
+                       const A8&         a8,
+                       const A9&         a9,
+                       const A10&        a10,
+                       const A11&        a11,
+                       const A12&        a12,
+                       const A13&        a13,
+                       const A14&        a14);
+        // Create, in a single block of memory allocated from the optionally
+        // specified 'basicAllocator', a representation and an 'ELEMENT_TYPE'
+        // object constructed from the optionally specified arguments 'a1' up
+        // to 'a14', and make this shared pointer own that object, releasing
+        // the reference previously held.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If an exception is
+        // thrown, this shared pointer is unchanged.  Note that
+        // 'basicAllocator' is *not* passed to the constructor of
+        // 'ELEMENT_TYPE'.
+
+    // ACCESSORS
+    operator BoolType() const;
+        // Return a value of an "unspecified bool" type that evaluates to
+        // 'false' if this shared pointer refers to no object, and 'true'
+        // otherwise.
+
+    ELEMENT_TYPE& operator*() const;
+        // Return a reference providing modifiable access to the object
+        // referred to by this shared pointer.  The behavior is undefined
+        // unless this shared pointer refers to an object.
+
+    ELEMENT_TYPE *operator->() const;
+        // Return the address of the object referred to by this shared
+        // pointer, or 0 if it refers to no object.
+
+    ELEMENT_TYPE *get() const;
+        // Return the address of the object referred to by this shared
+        // pointer, or 0 if it refers to no object.
+
+    LocalSharedPtrRep *rep() const;
+        // Return the address of the representation of the object owned by
+        // this shared pointer, or 0 if it owns no object.
+
+    bool unique() const;
+        // Return 'true' if this shared pointer owns an object and is the only
+        // shared pointer that does, and 'false' otherwise.
+
+    int use_count() const;
+        // Return the number of shared pointers that own the object owned by
+        // this shared pointer, or 0 if it owns no object.
+};
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator==(const LocalSharedPtr<LHS_TYPE>& lhs,
+                const LocalSharedPtr<RHS_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' shared pointers refer to
+    // the same object (or both to no object), and 'false' otherwise.
+
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator!=(const LocalSharedPtr<LHS_TYPE>& lhs,
+                const LocalSharedPtr<RHS_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' shared pointers refer to
+    // different objects, and 'false' otherwise.
+
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator<(const LocalSharedPtr<LHS_TYPE>& lhs,
+               const LocalSharedPtr<RHS_TYPE>& rhs);
+    // Return 'true' if the address of the object referred to by the
+    // specified 'lhs' shared pointer is less than that referred to by the
+    // specified 'rhs' shared pointer, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class ELEMENT_TYPE>
+void swap(LocalSharedPtr<ELEMENT_TYPE>& a, LocalSharedPtr<ELEMENT_TYPE>& b);
+    // Exchange the states of the specified 'a' and 'b' shared pointers.
+
+                            // ==================
+                            // class LocalWeakPtr
+                            // ==================
+
+template <class ELEMENT_TYPE>
+class LocalWeakPtr {
+    // This class template provides a weak pointer, with the semantics of
+    // 'bsl::weak_ptr', to an object of the (template parameter)
+    // 'ELEMENT_TYPE' owned by 'LocalSharedPtr' objects.  A weak pointer does
+    // not keep its object alive, but can be converted to a shared pointer by
+    // 'lock' as long as the object exists.
+
+    // DATA
+    ELEMENT_TYPE      *d_ptr_p;  // object referred to
+    LocalSharedPtrRep *d_rep_p;  // representation of the object, or 0
+
+    // FRIENDS
+    template <class COMPATIBLE_TYPE> friend class LocalWeakPtr;
+
+  public:
+    // TYPES
+    typedef ELEMENT_TYPE element_type;
+        // 'element_type' is an alias for the type of the object referred to.
+
+    // CREATORS
+    LocalWeakPtr();
+        // Create an empty weak pointer.
+
+    LocalWeakPtr(const LocalWeakPtr& original);
+        // Create a weak pointer that refers to the same object as the
+        // specified 'original'.
+
+    template <class COMPATIBLE_TYPE>
+    LocalWeakPtr(const LocalWeakPtr<COMPATIBLE_TYPE>& original);
+        // Create a weak pointer that refers to the same object as the
+        // specified 'original'.
+
+    template <class COMPATIBLE_TYPE>
+    LocalWeakPtr(const LocalSharedPtr<COMPATIBLE_TYPE>& source);
+        // Create a weak pointer that refers to the object owned by the
+        // specified 'source'.
+
+    ~LocalWeakPtr();
+        // Release the weak reference held by this object, if any.
+
+    // MANIPULATORS
+    LocalWeakPtr& operator=(const LocalWeakPtr& rhs);
+        // Make this weak pointer refer to the same object as the specified
+        // 'rhs', and return a reference to this modifiable object.
+
+    template <class COMPATIBLE_TYPE>
+    LocalWeakPtr& operator=(const LocalWeakPtr<COMPATIBLE_TYPE>& rhs);
+        // Make this weak pointer refer to the same object as the specified
+        // 'rhs', and return a reference to this modifiable object.
+
+    template <class COMPATIBLE_TYPE>
+    LocalWeakPtr& operator=(const LocalSharedPtr<COMPATIBLE_TYPE>& rhs);
+        // Make this weak pointer refer to the object owned by the specified
+        // 'rhs', and return a reference to this modifiable object.
+
+    void reset();
+        // Make this weak pointer empty, releasing the weak reference
+        // previously held, if any.
+
+    void swap(LocalWeakPtr& other);
+        // Exchange the states of this weak pointer and the specified 'other'
+        // weak pointer.
+
+    // ACCESSORS
+    bool expired() const;
+        // Return 'true' if this weak pointer is empty or the object to which
+        // it refers has been destroyed, and 'false' otherwise.
+
+    LocalSharedPtr<ELEMENT_TYPE> lock() const;
+        // Return a shared pointer that shares ownership of the object to
+        // which this weak pointer refers, or an empty shared pointer if
+        // 'expired()'.
+
+    LocalSharedPtrRep *rep() const;
+        // Return the address of the representation of the object to which
+        // this weak pointer refers, or 0 if it is empty.
+
+    int use_count() const;
+        // Return the number of shared pointers that own the object to which
+        // this weak pointer refers, or 0 if 'expired()'.
+};
+
+// FREE FUNCTIONS
+template <class ELEMENT_TYPE>
+void swap(LocalWeakPtr<ELEMENT_TYPE>& a, LocalWeakPtr<ELEMENT_TYPE>& b);
+    // Exchange the states of the specified 'a' and 'b' weak pointers.
+
+// ============================================================================
+//                      INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class LocalSharedPtrRep
+                          // -----------------------
+
+// PROTECTED CREATORS
+inline
+LocalSharedPtrRep::~LocalSharedPtrRep()
+{
+}
+
+// CREATORS
+inline
+LocalSharedPtrRep::LocalSharedPtrRep()
+: d_numSharedReferences(1)
+, d_adjustedWeakCount(1)
+{
+}
+
+// MANIPULATORS
+inline
+void LocalSharedPtrRep::acquireRef()
+{
+    BSLS_ASSERT_SAFE(0 < d_numSharedReferences);
+
+    ++d_numSharedReferences;
+}
+
+inline
+void LocalSharedPtrRep::acquireWeakRef()
+{
+    BSLS_ASSERT_SAFE(0 < d_adjustedWeakCount);
+
+    ++d_adjustedWeakCount;
+}
+
+inline
+void LocalSharedPtrRep::releaseRef()
+{
+    BSLS_ASSERT_SAFE(0 < d_numSharedReferences);
+
+    if (0 == --d_numSharedReferences) {
+        disposeObject();
+        releaseWeakRef();
+    }
+}
+
+inline
+void LocalSharedPtrRep::releaseWeakRef()
+{
+    BSLS_ASSERT_SAFE(0 < d_adjustedWeakCount);
+
+    if (0 == --d_adjustedWeakCount) {
+        disposeRep();
+    }
+}
+
+inline
+bool LocalSharedPtrRep::tryAcquireRef()
+{
+    if (0 == d_numSharedReferences) {
+        return false;                                                 // RETURN
+    }
+    ++d_numSharedReferences;
+    return true;
+}
+
+// ACCESSORS
+inline
+bool LocalSharedPtrRep::hasUniqueOwner() const
+{
+    return 1 == d_numSharedReferences && 1 == d_adjustedWeakCount;
+}
+
+inline
+int LocalSharedPtrRep::numReferences() const
+{
+    return d_numSharedReferences;
+}
+
+inline
+int LocalSharedPtrRep::numWeakReferences() const
+{
+    return d_adjustedWeakCount - (d_numSharedReferences ? 1 : 0);
+}
+
+                      // -------------------------------
+                      // class LocalSharedPtr_InplaceRep
+                      // -------------------------------
+
+// PRIVATE CREATORS
+template <class TYPE>
+LocalSharedPtr_InplaceRep<TYPE>::~LocalSharedPtr_InplaceRep()
+{
+    BSLS_ASSERT(0);
+}
+
+// CREATORS
+template <class TYPE>
+inline
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(basicAllocator)
+, d_instance()
+{
+}
+
+template <class TYPE>
+template <class A1>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1)
+: d_allocator_p(basicAllocator)
+, d_instance(a1)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7, a8)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7, a8, a9)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11,
+                                              const A12&        a12)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12, class A13>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11,
+                                              const A12&        a12,
+                                              const A13&        a13)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13)
+{
+}
+
+template <class TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12, class A13,
+          class A14>
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11,
+                                              const A12&        a12,
+                                              const A13&        a13,
+                                              const A14&        a14)
+: d_allocator_p(basicAllocator)
+, d_instance(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14)
+{
+}
+// MANIPULATORS
+template <class TYPE>
+inline
+void LocalSharedPtr_InplaceRep<TYPE>::disposeObject()
+{
+    d_instance.~TYPE();
+}
+
+template <class TYPE>
+inline
+void LocalSharedPtr_InplaceRep<TYPE>::disposeRep()
+{
+    d_allocator_p->deallocate(this);
+}
+
+template <class TYPE>
+inline
+TYPE *LocalSharedPtr_InplaceRep<TYPE>::ptr()
+{
+    return &d_instance;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+void *LocalSharedPtr_InplaceRep<TYPE>::originalPtr() const
+{
+    return const_cast<void *>(static_cast<const void *>(&d_instance));
+}
+
+                     // ----------------------------------
+                     // class LocalSharedPtr_OutofplaceRep
+                     // ----------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, class DELETER>
+inline
+bslma::Allocator *
+LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::deleterAllocator(
+                                                        const DELETER& deleter,
+                                                        bsl::true_type)
+{
+    return deleter;
+}
+
+template <class TYPE, class DELETER>
+inline
+bslma::Allocator *
+LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::deleterAllocator(const DELETER&,
+                                                              bsl::false_type)
+{
+    return bslma::Default::defaultAllocator();
+}
+
+template <class TYPE, class DELETER>
+inline
+void LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::deleteObject(
+                                                      TYPE     *ptr,
+                                                      DELETER&  deleter,
+                                                      bsl::true_type)
+{
+    static_cast<bslma::Allocator *>(deleter)->deleteObject(ptr);
+}
+
+template <class TYPE, class DELETER>
+inline
+void LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::deleteObject(
+                                                      TYPE     *ptr,
+                                                      DELETER&  deleter,
+                                                      bsl::false_type)
+{
+    deleter(ptr);
+}
+
+// PRIVATE CREATORS
+template <class TYPE, class DELETER>
+inline
+LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::LocalSharedPtr_OutofplaceRep(
+                                              TYPE             *ptr,
+                                              const DELETER&    deleter,
+                                              bslma::Allocator *basicAllocator)
+: d_ptr_p(ptr)
+, d_deleter(deleter)
+, d_allocator_p(basicAllocator)
+{
+}
+
+template <class TYPE, class DELETER>
+inline
+LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::~LocalSharedPtr_OutofplaceRep()
+{
+}
+
+// CLASS METHODS
+template <class TYPE, class DELETER>
+LocalSharedPtr_OutofplaceRep<TYPE, DELETER> *
+LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::create(
+                                              TYPE             *ptr,
+                                              const DELETER&    deleter,
+                                              bslma::Allocator *basicAllocator)
+{
+    typedef typename bsl::is_convertible<DELETER, bslma::Allocator *>::type
+                                                           IsAllocatorDeleter;
+
+    if (!basicAllocator) {
+        basicAllocator = deleterAllocator(deleter, IsAllocatorDeleter());
+    }
+
+    LocalSharedPtr_OutofplaceRep *rep = 0;
+    BSLS_TRY {
+        rep = new (*basicAllocator) LocalSharedPtr_OutofplaceRep(
+                                                               ptr,
+                                                               deleter,
+                                                               basicAllocator);
+    }
+    BSLS_CATCH(...) {
+        DELETER deleterCopy(deleter);
+        deleteObject(ptr, deleterCopy, IsAllocatorDeleter());
+        BSLS_RETHROW;
+    }
+    return rep;
+}
+
+// MANIPULATORS
+template <class TYPE, class DELETER>
+inline
+void LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::disposeObject()
+{
+    typedef typename bsl::is_convertible<DELETER, bslma::Allocator *>::type
+                                                           IsAllocatorDeleter;
+
+    deleteObject(d_ptr_p, d_deleter, IsAllocatorDeleter());
+    d_ptr_p = 0;
+}
+
+template <class TYPE, class DELETER>
+inline
+void LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::disposeRep()
+{
+    bslma::Allocator *allocator = d_allocator_p;
+    this->~LocalSharedPtr_OutofplaceRep();
+    allocator->deallocate(this);
+}
+
+// ACCESSORS
+template <class TYPE, class DELETER>
+inline
+void *LocalSharedPtr_OutofplaceRep<TYPE, DELETER>::originalPtr() const
+{
+    return const_cast<void *>(static_cast<const void *>(d_ptr_p));
+}
+
+                           // --------------------
+                           // class LocalSharedPtr
+                           // --------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>::LocalSharedPtr()
+: d_ptr_p(0)
+, d_rep_p(0)
+{
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+LocalSharedPtr<ELEMENT_TYPE>::LocalSharedPtr(COMPATIBLE_TYPE *ptr)
+: d_ptr_p(ptr)
+, d_rep_p(0)
+{
+    if (ptr) {
+        bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+        d_rep_p = LocalSharedPtr_OutofplaceRep<COMPATIBLE_TYPE,
+                                               bslma::Allocator *>::create(
+                                                                   ptr,
+                                                                   allocator,
+                                                                   allocator);
+    }
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE, class DELETER>
+LocalSharedPtr<ELEMENT_TYPE>::LocalSharedPtr(COMPATIBLE_TYPE  *ptr,
+                                             const DELETER&    deleter,
+                                             bslma::Allocator *basicAllocator)
+: d_ptr_p(ptr)
+, d_rep_p(0)
+{
+    if (ptr) {
+        d_rep_p = LocalSharedPtr_OutofplaceRep<COMPATIBLE_TYPE,
+                                               DELETER>::create(
+                                                              ptr,
+                                                              deleter,
+                                                              basicAllocator);
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>::LocalSharedPtr(ELEMENT_TYPE      *ptr,
+                                             LocalSharedPtrRep *rep)
+: d_ptr_p(ptr)
+, d_rep_p(rep)
+{
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>::LocalSharedPtr(
+                             const LocalSharedPtr<COMPATIBLE_TYPE>& source,
+                             ELEMENT_TYPE                          *object)
+: d_ptr_p(object)
+, d_rep_p(source.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>::LocalSharedPtr(const LocalSharedPtr& original)
+: d_ptr_p(original.d_ptr_p)
+, d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>::LocalSharedPtr(
+                               const LocalSharedPtr<COMPATIBLE_TYPE>& original)
+: d_ptr_p(original.d_ptr_p)
+, d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>::~LocalSharedPtr()
+{
+    if (d_rep_p) {
+        d_rep_p->releaseRef();
+    }
+}
+
+// PRIVATE MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+void LocalSharedPtr<ELEMENT_TYPE>::adoptRep(ELEMENT_TYPE      *ptr,
+                                            LocalSharedPtrRep *rep)
+{
+    LocalSharedPtr(ptr, rep).swap(*this);
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>&
+LocalSharedPtr<ELEMENT_TYPE>::operator=(const LocalSharedPtr& rhs)
+{
+    LocalSharedPtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE>&
+LocalSharedPtr<ELEMENT_TYPE>::operator=(
+                                    const LocalSharedPtr<COMPATIBLE_TYPE>& rhs)
+{
+    LocalSharedPtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+inline
+void LocalSharedPtr<ELEMENT_TYPE>::reset()
+{
+    LocalSharedPtr().swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+void LocalSharedPtr<ELEMENT_TYPE>::reset(COMPATIBLE_TYPE *ptr)
+{
+    LocalSharedPtr(ptr).swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE, class DELETER>
+inline
+void LocalSharedPtr<ELEMENT_TYPE>::reset(COMPATIBLE_TYPE  *ptr,
+                                         const DELETER&    deleter,
+                                         bslma::Allocator *basicAllocator)
+{
+    LocalSharedPtr(ptr, deleter, basicAllocator).swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+inline
+void LocalSharedPtr<ELEMENT_TYPE>::swap(LocalSharedPtr& other)
+{
+    ELEMENT_TYPE *ptr = d_ptr_p;
+    d_ptr_p = other.d_ptr_p;
+    other.d_ptr_p = ptr;
+
+    LocalSharedPtrRep *rep = d_rep_p;
+    d_rep_p = other.d_rep_p;
+    other.d_rep_p = rep;
+}
+
+template <class ELEMENT_TYPE>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7, a8);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7, a8, a9);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7, a8, a9, a10);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7, a8, a9, a10, a11);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11,
+                                              const A12&        a12)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7, a8, a9, a10, a11, a12);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12, class A13>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11,
+                                              const A12&        a12,
+                                              const A13&        a13)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7, a8, a9, a10, a11, a12, a13);
+    adoptRep(rep->ptr(), rep);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12, class A13,
+          class A14>
+void LocalSharedPtr<ELEMENT_TYPE>::createInplace(
+                                              bslma::Allocator *basicAllocator,
+                                              const A1&         a1,
+                                              const A2&         a2,
+                                              const A3&         a3,
+                                              const A4&         a4,
+                                              const A5&         a5,
+                                              const A6&         a6,
+                                              const A7&         a7,
+                                              const A8&         a8,
+                                              const A9&         a9,
+                                              const A10&        a10,
+                                              const A11&        a11,
+                                              const A12&        a12,
+                                              const A13&        a13,
+                                              const A14&        a14)
+{
+    typedef LocalSharedPtr_InplaceRep<ELEMENT_TYPE> Rep;
+
+    basicAllocator = bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5,
+                                         a6, a7, a8, a9, a10, a11, a12, a13,
+                                         a14);
+    adoptRep(rep->ptr(), rep);
+}
+// ACCESSORS
+template <class ELEMENT_TYPE>
+inline
+#if defined(BSLS_PLATFORM_CMP_IBM)
+LocalSharedPtr<ELEMENT_TYPE>::operator typename LocalSharedPtr::BoolType()
+                                                                          const
+#else
+LocalSharedPtr<ELEMENT_TYPE>::operator BoolType() const
+#endif
+{
+    return bsls::UnspecifiedBool<LocalSharedPtr>::makeValue(d_ptr_p);
+}
+
+template <class ELEMENT_TYPE>
+inline
+ELEMENT_TYPE& LocalSharedPtr<ELEMENT_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_ptr_p);
+
+    return *d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+ELEMENT_TYPE *LocalSharedPtr<ELEMENT_TYPE>::operator->() const
+{
+    return d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+ELEMENT_TYPE *LocalSharedPtr<ELEMENT_TYPE>::get() const
+{
+    return d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtrRep *LocalSharedPtr<ELEMENT_TYPE>::rep() const
+{
+    return d_rep_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+bool LocalSharedPtr<ELEMENT_TYPE>::unique() const
+{
+    return 1 == use_count();
+}
+
+template <class ELEMENT_TYPE>
+inline
+int LocalSharedPtr<ELEMENT_TYPE>::use_count() const
+{
+    return d_rep_p ? d_rep_p->numReferences() : 0;
+}
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator==(const LocalSharedPtr<LHS_TYPE>& lhs,
+                const LocalSharedPtr<RHS_TYPE>& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator!=(const LocalSharedPtr<LHS_TYPE>& lhs,
+                const LocalSharedPtr<RHS_TYPE>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator<(const LocalSharedPtr<LHS_TYPE>& lhs,
+               const LocalSharedPtr<RHS_TYPE>& rhs)
+{
+    return lhs.get() < rhs.get();
+}
+
+// FREE FUNCTIONS
+template <class ELEMENT_TYPE>
+inline
+void swap(LocalSharedPtr<ELEMENT_TYPE>& a, LocalSharedPtr<ELEMENT_TYPE>& b)
+{
+    a.swap(b);
+}
+
+                            // ------------------
+                            // class LocalWeakPtr
+                            // ------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>::LocalWeakPtr()
+: d_ptr_p(0)
+, d_rep_p(0)
+{
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>::LocalWeakPtr(const LocalWeakPtr& original)
+: d_ptr_p(original.d_ptr_p)
+, d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireWeakRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>::LocalWeakPtr(
+                                 const LocalWeakPtr<COMPATIBLE_TYPE>& original)
+: d_ptr_p(original.d_ptr_p)
+, d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireWeakRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>::LocalWeakPtr(
+                                 const LocalSharedPtr<COMPATIBLE_TYPE>& source)
+: d_ptr_p(source.d_ptr_p)
+, d_rep_p(source.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireWeakRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>::~LocalWeakPtr()
+{
+    if (d_rep_p) {
+        d_rep_p->releaseWeakRef();
+    }
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>&
+LocalWeakPtr<ELEMENT_TYPE>::operator=(const LocalWeakPtr& rhs)
+{
+    LocalWeakPtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>&
+LocalWeakPtr<ELEMENT_TYPE>::operator=(const LocalWeakPtr<COMPATIBLE_TYPE>& rhs)
+{
+    LocalWeakPtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+LocalWeakPtr<ELEMENT_TYPE>&
+LocalWeakPtr<ELEMENT_TYPE>::operator=(
+                                    const LocalSharedPtr<COMPATIBLE_TYPE>& rhs)
+{
+    LocalWeakPtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+inline
+void LocalWeakPtr<ELEMENT_TYPE>::reset()
+{
+    LocalWeakPtr().swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+inline
+void LocalWeakPtr<ELEMENT_TYPE>::swap(LocalWeakPtr& other)
+{
+    ELEMENT_TYPE *ptr = d_ptr_p;
+    d_ptr_p = other.d_ptr_p;
+    other.d_ptr_p = ptr;
+
+    LocalSharedPtrRep *rep = d_rep_p;
+    d_rep_p = other.d_rep_p;
+    other.d_rep_p = rep;
+}
+
+// ACCESSORS
+template <class ELEMENT_TYPE>
+inline
+bool LocalWeakPtr<ELEMENT_TYPE>::expired() const
+{
+    return 0 == use_count();
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtr<ELEMENT_TYPE> LocalWeakPtr<ELEMENT_TYPE>::lock() const
+{
+    if (d_rep_p && d_rep_p->tryAcquireRef()) {
+        return LocalSharedPtr<ELEMENT_TYPE>(d_ptr_p, d_rep_p);        // RETURN
+    }
+    return LocalSharedPtr<ELEMENT_TYPE>();
+}
+
+template <class ELEMENT_TYPE>
+inline
+LocalSharedPtrRep *LocalWeakPtr<ELEMENT_TYPE>::rep() const
+{
+    return d_rep_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+int LocalWeakPtr<ELEMENT_TYPE>::use_count() const
+{
+    return d_rep_p ? d_rep_p->numReferences() : 0;
+}
+
+// FREE FUNCTIONS
+template <class ELEMENT_TYPE>
+inline
+void swap(LocalWeakPtr<ELEMENT_TYPE>& a, LocalWeakPtr<ELEMENT_TYPE>& b)
+{
+    a.swap(b);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1363 @@
+// bslstl_localsharedptr.t.cpp                                        -*-C++-*-
+#include <bslstl_localsharedptr.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a shared pointer and a weak pointer whose
+// reference counts are plain integers held in a 'LocalSharedPtrRep'.  The
+// counting protocol of the representation is tested first, using a
+// representation that records the calls to 'disposeObject' and 'disposeRep'.
+// The pointers are then tested for every way of creating an owned object
+// (adopting a pointer with or without a deleter, and 'createInplace'),
+// verifying with 'bslma::TestAllocator' and counting objects that each object
+// and each representation is destroyed exactly once, at the right time, also
+// when an exception is thrown.  Finally, copying, conversion, aliasing,
+// assignment, and the weak pointer are tested against the expected reference
+// counts.
+// ----------------------------------------------------------------------------
+// LocalSharedPtrRep
+// [ 2] LocalSharedPtrRep();
+// [ 2] void acquireRef();
+// [ 2] void acquireWeakRef();
+// [ 2] void releaseRef();
+// [ 2] void releaseWeakRef();
+// [ 2] bool tryAcquireRef();
+// [ 2] bool hasUniqueOwner() const;
+// [ 2] int numReferences() const;
+// [ 2] int numWeakReferences() const;
+//
+// LocalSharedPtr
+// [ 1] LocalSharedPtr();
+// [ 3] LocalSharedPtr(COMPATIBLE_TYPE *);
+// [ 3] LocalSharedPtr(COMPATIBLE_TYPE *, const DELETER&, Allocator *);
+// [ 5] LocalSharedPtr(ELEMENT_TYPE *, LocalSharedPtrRep *);
+// [ 5] LocalSharedPtr(const LocalSharedPtr<COMPATIBLE>&, ELEMENT_TYPE *);
+// [ 5] LocalSharedPtr(const LocalSharedPtr&);
+// [ 5] LocalSharedPtr(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+// [ 3] ~LocalSharedPtr();
+// [ 5] LocalSharedPtr& operator=(const LocalSharedPtr&);
+// [ 5] LocalSharedPtr& operator=(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+// [ 5] void reset();
+// [ 3] void reset(COMPATIBLE_TYPE *);
+// [ 3] void reset(COMPATIBLE_TYPE *, const DELETER&, Allocator *);
+// [ 5] void swap(LocalSharedPtr&);
+// [ 4] void createInplace(Allocator *, const A1&, ..., const A14&);
+// [ 5] operator BoolType() const;
+// [ 1] ELEMENT_TYPE& operator*() const;
+// [ 1] ELEMENT_TYPE *operator->() const;
+// [ 1] ELEMENT_TYPE *get() const;
+// [ 5] LocalSharedPtrRep *rep() const;
+// [ 5] bool unique() const;
+// [ 1] int use_count() const;
+// [ 5] bool operator==(const LocalSharedPtr<L>&, const LocalSharedPtr<R>&);
+// [ 5] bool operator!=(const LocalSharedPtr<L>&, const LocalSharedPtr<R>&);
+// [ 5] bool operator<(const LocalSharedPtr<L>&, const LocalSharedPtr<R>&);
+// [ 5] void swap(LocalSharedPtr<E>&, LocalSharedPtr<E>&);
+//
+// LocalWeakPtr
+// [ 6] LocalWeakPtr();
+// [ 6] LocalWeakPtr(const LocalWeakPtr&);
+// [ 6] LocalWeakPtr(const LocalWeakPtr<COMPATIBLE_TYPE>&);
+// [ 6] LocalWeakPtr(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+// [ 6] ~LocalWeakPtr();
+// [ 6] LocalWeakPtr& operator=(const LocalWeakPtr&);
+// [ 6] LocalWeakPtr& operator=(const LocalWeakPtr<COMPATIBLE_TYPE>&);
+// [ 6] LocalWeakPtr& operator=(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+// [ 6] void reset();
+// [ 6] void swap(LocalWeakPtr&);
+// [ 6] bool expired() const;
+// [ 6] LocalSharedPtr<ELEMENT_TYPE> lock() const;
+// [ 6] LocalSharedPtrRep *rep() const;
+// [ 6] int use_count() const;
+// [ 6] void swap(LocalWeakPtr<E>&, LocalWeakPtr<E>&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COPY AND DESTROY
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                            // ===================
+                            // class CountedObject
+                            // ===================
+
+class CountedObject {
+    // This class records its destruction by incrementing a counter supplied
+    // at construction.
+
+    // DATA
+    int *d_numDestroyed_p;  // incremented on destruction (held, not owned)
+    int  d_value;           // value of this object
+
+  public:
+    // CREATORS
+    explicit CountedObject(int *numDestroyed, int value = 0)
+    : d_numDestroyed_p(numDestroyed)
+    , d_value(value)
+        // Create an object having the specified 'value' that increments the
+        // specified 'numDestroyed' when destroyed.
+    {
+    }
+
+    ~CountedObject()
+        // Increment the counter supplied at construction.
+    {
+        ++*d_numDestroyed_p;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+                            // ===================
+                            // class DerivedObject
+                            // ===================
+
+class DerivedObject : public CountedObject {
+    // This class, derived from 'CountedObject', records its own destruction
+    // separately, so that tests can verify that an object owned through a
+    // pointer to its base is destroyed as a 'DerivedObject'.
+
+    // DATA
+    int *d_numDerivedDestroyed_p;  // incremented on destruction (held, not
+                                   // owned)
+
+  public:
+    // CREATORS
+    DerivedObject(int *numDestroyed, int *numDerivedDestroyed, int value)
+    : CountedObject(numDestroyed, value)
+    , d_numDerivedDestroyed_p(numDerivedDestroyed)
+        // Create an object having the specified 'value' that increments the
+        // specified 'numDestroyed' and 'numDerivedDestroyed' when destroyed.
+    {
+    }
+
+    ~DerivedObject()
+        // Increment the derived-class counter supplied at construction.
+    {
+        ++*d_numDerivedDestroyed_p;
+    }
+};
+
+                           // =====================
+                           // class CountingDeleter
+                           // =====================
+
+class CountingDeleter {
+    // This functor deletes an object allocated by the global 'operator new'
+    // and counts its invocations.
+
+    // DATA
+    int *d_numCalls_p;  // number of invocations (held, not owned)
+
+  public:
+    // CREATORS
+    explicit CountingDeleter(int *numCalls)
+    : d_numCalls_p(numCalls)
+        // Create a deleter that increments the specified 'numCalls' when
+        // invoked.
+    {
+    }
+
+    // ACCESSORS
+    template <class TYPE>
+    void operator()(TYPE *object) const
+        // Delete the specified 'object'.
+    {
+        ++*d_numCalls_p;
+        delete object;
+    }
+};
+
+void deleteCountedObject(CountedObject *object)
+    // Delete the specified 'object'.
+{
+    delete object;
+}
+
+                              // ==============
+                              // struct SumOf14
+                              // ==============
+
+struct SumOf14 {
+    // This 'struct' has a constructor taking 14 arguments.
+
+    int d_sum;  // sum of the constructor arguments
+
+    SumOf14(int a1, int a2, int a3, int a4, int a5, int a6, int a7,
+            int a8, int a9, int a10, int a11, int a12, int a13, int a14)
+    : d_sum(a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 + a12
+            + a13 + a14)
+        // Create an object holding the sum of the specified 'a1' up to 'a14'.
+    {
+    }
+};
+
+                           // ====================
+                           // struct ThrowingObject
+                           // ====================
+
+struct ThrowingObject {
+    // This 'struct' has a constructor that throws an exception when given a
+    // negative argument.
+
+    int d_value;  // value of this object
+
+    explicit ThrowingObject(int value)
+    : d_value(value)
+        // Create an object having the specified 'value', or throw 'value' if
+        // it is negative.
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (value < 0) {
+            throw value;
+        }
+#endif
+    }
+};
+
+                               // =============
+                               // class TestRep
+                               // =============
+
+class TestRep : public bslstl::LocalSharedPtrRep {
+    // This class implements 'LocalSharedPtrRep' by counting the calls to
+    // 'disposeObject' and 'disposeRep'.
+
+    // DATA
+    int d_numDisposeObject;  // number of calls to 'disposeObject'
+    int d_numDisposeRep;     // number of calls to 'disposeRep'
+
+  public:
+    // CREATORS
+    TestRep()
+    : d_numDisposeObject(0)
+    , d_numDisposeRep(0)
+        // Create a representation with one shared reference.
+    {
+    }
+
+    // MANIPULATORS
+    virtual void disposeObject()
+        // Record the call.
+    {
+        ASSERT(0 == d_numDisposeRep);
+        ++d_numDisposeObject;
+    }
+
+    virtual void disposeRep()
+        // Record the call.
+    {
+        ++d_numDisposeRep;
+    }
+
+    // ACCESSORS
+    virtual void *originalPtr() const
+        // Return 0.
+    {
+        return 0;
+    }
+
+    int numDisposeObject() const
+        // Return the number of calls to 'disposeObject'.
+    {
+        return d_numDisposeObject;
+    }
+
+    int numDisposeRep() const
+        // Return the number of calls to 'disposeRep'.
+    {
+        return d_numDisposeRep;
+    }
+};
+
+typedef bslstl::LocalSharedPtr<CountedObject> Obj;
+typedef bslstl::LocalWeakPtr<CountedObject>   WeakObj;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class POINTER>
+double timeCopyToArray(const POINTER& source, int numRounds)
+    // Return the time, in seconds, to copy the specified 'source' into each
+    // element of an array and then reset each element, the specified
+    // 'numRounds' times.
+{
+    enum { NUM_COPIES = 1024 };
+
+    POINTER         copies[NUM_COPIES];
+    bsls::Stopwatch timer;
+
+    timer.start();
+    for (int round = 0; round < numRounds; ++round) {
+        for (int i = 0; i < NUM_COPIES; ++i) {
+            copies[i] = source;
+        }
+        for (int i = 0; i < NUM_COPIES; ++i) {
+            copies[i].reset();
+        }
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+template <class POINTER>
+int useCopy(POINTER copy)
+    // Return the value of the object referred to by the specified 'copy',
+    // which is passed by value.
+{
+    return copy->value();
+}
+
+template <class POINTER>
+double timePassByValue(const POINTER& source, int numCalls, int *sum)
+    // Return the time, in seconds, to pass the specified 'source' by value to
+    // a function the specified 'numCalls' times, and load into the specified
+    // 'sum' the sum of the results of the calls.
+{
+    bsls::Stopwatch timer;
+    int             total = 0;
+
+    timer.start();
+    for (int i = 0; i < numCalls; ++i) {
+        total += useCopy(source);
+    }
+    timer.stop();
+
+    *sum = total;
+    return timer.elapsedTime();
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Example 1: Sharing a Connection Among Handlers of an Event Loop
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+struct Connection {
+    int d_id;
+    int d_numMessages;
+
+    explicit Connection(int id) : d_id(id), d_numMessages(0) {}
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        //Example 1: Sharing a Connection Among Handlers of an Event Loop
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        bslma::TestAllocator ta;
+
+        bslstl::LocalSharedPtr<Connection> connection;
+        connection.createInplace(&ta, 42);
+        ASSERT(1 == ta.numBlocksInUse());
+
+        bslstl::LocalSharedPtr<Connection> readHandler(connection);
+        bslstl::LocalSharedPtr<Connection> writeHandler(connection);
+        bslstl::LocalWeakPtr<Connection>   monitor(connection);
+        ASSERT(3 == connection.use_count());
+
+        ++readHandler->d_numMessages;
+        ++writeHandler->d_numMessages;
+        ASSERT(2 == connection->d_numMessages);
+
+        bslstl::LocalSharedPtr<int> id(connection, &connection->d_id);
+        ASSERT(42 == *id);
+        ASSERT(4 == connection.use_count());
+
+        connection.reset();
+        readHandler.reset();
+        writeHandler.reset();
+        ASSERT(!monitor.expired());
+
+        id.reset();
+        ASSERT(monitor.expired());
+        ASSERT(!monitor.lock());
+
+        monitor.reset();
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'LocalWeakPtr'
+        //
+        // Concerns:
+        //: 1 A weak pointer does not affect the number of shared references.
+        //:
+        //: 2 'lock' returns a shared pointer to the object while it exists,
+        //:   and an empty shared pointer afterwards; 'expired' and
+        //:   'use_count' agree.
+        //:
+        //: 3 The object is destroyed when the last shared reference is
+        //:   released, even if weak references remain, and the
+        //:   representation is freed when the last weak reference is
+        //:   released.
+        //:
+        //: 4 Copying, conversion, assignment, 'reset', and 'swap' maintain
+        //:   the weak reference count.
+        //
+        // Plan:
+        //: 1 Create an object in-place, observe it with weak pointers created
+        //:   and manipulated in every supported way, and check the reference
+        //:   counts, the destruction counter, and the allocator after each
+        //:   step.  (C-1..4)
+        //
+        // Testing:
+        //   LocalWeakPtr();
+        //   LocalWeakPtr(const LocalWeakPtr&);
+        //   LocalWeakPtr(const LocalWeakPtr<COMPATIBLE_TYPE>&);
+        //   LocalWeakPtr(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+        //   ~LocalWeakPtr();
+        //   LocalWeakPtr& operator=(const LocalWeakPtr&);
+        //   LocalWeakPtr& operator=(const LocalWeakPtr<COMPATIBLE_TYPE>&);
+        //   LocalWeakPtr& operator=(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+        //   void reset();
+        //   void swap(LocalWeakPtr&);
+        //   bool expired() const;
+        //   LocalSharedPtr<ELEMENT_TYPE> lock() const;
+        //   LocalSharedPtrRep *rep() const;
+        //   int use_count() const;
+        //   void swap(LocalWeakPtr<E>&, LocalWeakPtr<E>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'LocalWeakPtr'"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            const WeakObj W;
+            ASSERT(W.expired());
+            ASSERT(0 == W.use_count());
+            ASSERT(0 == W.rep());
+            ASSERT(!W.lock());
+        }
+
+        int numDestroyed = 0;
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.createInplace(&oa, &numDestroyed, 7);
+            bslstl::LocalSharedPtrRep *rep = X.rep();
+
+            WeakObj mW(X);  const WeakObj& W = mW;
+            ASSERT(!W.expired());
+            ASSERT(1 == W.use_count());
+            ASSERT(rep == W.rep());
+            ASSERT(1 == rep->numReferences());
+            ASSERT(1 == rep->numWeakReferences());
+            ASSERT(X.unique());
+
+            {
+                Obj mY = W.lock();  const Obj& Y = mY;
+                ASSERT(Y == X);
+                ASSERT(2 == X.use_count());
+                ASSERT(7 == Y->value());
+            }
+            ASSERT(1 == X.use_count());
+
+            WeakObj mV(W);  const WeakObj& V = mV;
+            ASSERT(2 == rep->numWeakReferences());
+
+            bslstl::LocalWeakPtr<const CountedObject> mC(V);
+            ASSERT(3 == rep->numWeakReferences());
+            ASSERT(7 == mC.lock()->value());
+
+            WeakObj mU;  const WeakObj& U = mU;
+            mU = W;
+            ASSERT(4 == rep->numWeakReferences());
+            mC = U;
+            ASSERT(4 == rep->numWeakReferences());
+            mU.reset();
+            ASSERT(3 == rep->numWeakReferences());
+            ASSERT(U.expired());
+            mU = X;
+            ASSERT(4 == rep->numWeakReferences());
+            ASSERT(rep == U.rep());
+
+            WeakObj mT;  const WeakObj& T = mT;
+            mT.swap(mU);
+            ASSERT(rep == T.rep());
+            ASSERT(0   == U.rep());
+            swap(mT, mU);
+            ASSERT(0   == T.rep());
+            ASSERT(rep == U.rep());
+
+            ASSERT(0 == numDestroyed);
+            mX.reset();
+            ASSERT(1 == numDestroyed);
+            ASSERT(W.expired());
+            ASSERT(V.expired());
+            ASSERT(0 == W.use_count());
+            ASSERT(!W.lock());
+            ASSERT(0 == W.lock().rep());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(4 == rep->numWeakReferences());
+
+            mV.reset();
+            mU.reset();
+            mC.reset();
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(1 == numDestroyed);
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, CONVERSION, ALIASING, AND ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 Copying a shared pointer, or converting it to a pointer to a
+        //:   base or 'const' type, shares ownership and increments the count.
+        //:
+        //: 2 An aliasing pointer shares ownership but refers to a different
+        //:   object, and keeps the owned object alive.
+        //:
+        //: 3 Assignment, including self-assignment, 'reset', and 'swap'
+        //:   release and acquire exactly the expected references.
+        //:
+        //: 4 The comparison operators compare the addresses of the referred
+        //:   objects, and the conversion to bool is 'false' only for a null
+        //:   pointer.
+        //:
+        //: 5 A pointer created from a raw pointer and a null representation
+        //:   refers to the object without owning it.
+        //
+        // Plan:
+        //: 1 Manipulate shared pointers to two objects in every supported way
+        //:   and check the reference counts, the destruction counters, and
+        //:   the results of the accessors and operators after each step.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   LocalSharedPtr(ELEMENT_TYPE *, LocalSharedPtrRep *);
+        //   LocalSharedPtr(const LocalSharedPtr<COMPATIBLE>&, ELEMENT_TYPE *);
+        //   LocalSharedPtr(const LocalSharedPtr&);
+        //   LocalSharedPtr(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+        //   LocalSharedPtr& operator=(const LocalSharedPtr&);
+        //   LocalSharedPtr& operator=(const LocalSharedPtr<COMPATIBLE_TYPE>&);
+        //   void reset();
+        //   void swap(LocalSharedPtr&);
+        //   operator BoolType() const;
+        //   LocalSharedPtrRep *rep() const;
+        //   bool unique() const;
+        //   operator==(const LocalSharedPtr<L>&, const LocalSharedPtr<R>&);
+        //   operator!=(const LocalSharedPtr<L>&, const LocalSharedPtr<R>&);
+        //   operator<(const LocalSharedPtr<L>&, const LocalSharedPtr<R>&);
+        //   void swap(LocalSharedPtr<E>&, LocalSharedPtr<E>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, CONVERSION, ALIASING, AND ASSIGNMENT"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        int numDestroyedA = 0;
+        int numDestroyedB = 0;
+        int numDerivedDestroyed = 0;
+        {
+            Obj mA;  const Obj& A = mA;
+            mA.createInplace(&oa, &numDestroyedA, 1);
+
+            bslstl::LocalSharedPtr<DerivedObject> mB;
+            mB.createInplace(&oa, &numDestroyedB, &numDerivedDestroyed, 2);
+            ASSERT(2 == oa.numBlocksInUse());
+
+            if (verbose) printf("\tCopy and conversion.\n");
+
+            Obj mC(A);  const Obj& C = mC;
+            ASSERT(C == A);
+            ASSERT(C.rep() == A.rep());
+            ASSERT(2 == A.use_count());
+            ASSERT(!A.unique());
+
+            bslstl::LocalSharedPtr<const CountedObject> mD(mB);
+            ASSERT(2 == mB.use_count());
+            ASSERT(2 == mD->value());
+            ASSERT(mD == mB);
+
+            if (verbose) printf("\tAliasing.\n");
+
+            static int aliased = 42;
+            {
+                bslstl::LocalSharedPtr<int> mE(mB, &aliased);
+                ASSERT(&aliased == mE.get());
+                ASSERT(mB.rep() == mE.rep());
+                ASSERT(3 == mB.use_count());
+
+                mB.reset();
+                mD.reset();
+                ASSERT(0 == numDestroyedB);
+                ASSERT(1 == mE.use_count());
+                ASSERT(42 == *mE);
+            }
+            ASSERT(1 == numDestroyedB);
+            ASSERT(1 == numDerivedDestroyed);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            if (verbose) printf("\tNon-owning pointer.\n");
+            {
+                int                          value = 5;
+                bslstl::LocalSharedPtrRep   *noRep = 0;
+                bslstl::LocalSharedPtr<int>  mF(&value, noRep);
+                ASSERT(&value == mF.get());
+                ASSERT(0 == mF.rep());
+                ASSERT(0 == mF.use_count());
+                ASSERT(mF);
+
+                bslstl::LocalSharedPtr<int> mG(mF);
+                ASSERT(&value == mG.get());
+                ASSERT(0 == mG.rep());
+            }
+
+            if (verbose) printf("\tAssignment, 'reset', and 'swap'.\n");
+
+            Obj mG;  const Obj& G = mG;
+            ASSERT(!G);
+            ASSERT(G != A);
+            ASSERT(0 == G.get());
+
+            mG = A;
+            ASSERT(G == A);
+            ASSERT(3 == A.use_count());
+
+            mG = G;
+            ASSERT(3 == A.use_count());
+
+            mG = Obj();
+            ASSERT(!G);
+            ASSERT(2 == A.use_count());
+
+            bslstl::LocalSharedPtr<const CountedObject> mH;
+            mH = A;
+            ASSERT(3 == A.use_count());
+            ASSERT(mH == A);
+
+            mC.reset();
+            ASSERT(!C);
+            ASSERT(0 == C.rep());
+            ASSERT(2 == A.use_count());
+
+            mG.swap(mC);
+            ASSERT(!G);
+            mC.swap(mA);
+            ASSERT(!A);
+            ASSERT(C);
+            swap(mA, mC);
+            ASSERT(A);
+            ASSERT(!C);
+            ASSERT(2 == A.use_count());
+
+            if (verbose) printf("\tComparison.\n");
+
+            Obj mI;  const Obj& I = mI;
+            mI.createInplace(&oa, &numDestroyedA, 3);
+            ASSERT(I != A);
+            ASSERT((A < I) == (A.get() < I.get()));
+            ASSERT((I < A) == (I.get() < A.get()));
+            ASSERT(!(A < A));
+            ASSERT(A == mH);
+            ASSERT(!(A != mH));
+
+            ASSERT(0 == numDestroyedA);
+        }
+        ASSERT(2 == numDestroyedA);
+        ASSERT(1 == numDestroyedB);
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'createInplace'
+        //
+        // Concerns:
+        //: 1 'createInplace' allocates a single block, from the specified
+        //:   allocator or, if it is 0, from the default allocator, and
+        //:   forwards every argument to the constructor of the object.
+        //:
+        //: 2 The object is destroyed when the last shared reference is
+        //:   released, and the block is freed at the same time if there are
+        //:   no weak references.
+        //:
+        //: 3 If the allocation or the constructor of the object throws, no
+        //:   memory is leaked and the shared pointer is unchanged.
+        //:
+        //: 4 'createInplace' releases the reference previously held.
+        //
+        // Plan:
+        //: 1 Create objects in-place with 0 to 3 and 14 arguments, and check
+        //:   the allocators, the values, and the destruction counter.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, and an
+        //:   object whose constructor throws, verify that no memory is leaked
+        //:   and the shared pointer is unchanged.  (C-3)
+        //
+        // Testing:
+        //   void createInplace(Allocator *, const A1&, ..., const A14&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'createInplace'"
+                            "\n===============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tArguments and allocators.\n");
+        {
+            bslstl::LocalSharedPtr<int> mX;
+            mX.createInplace();
+            ASSERT(0 == *mX);
+            ASSERT(1 == da.numBlocksInUse());
+
+            mX.createInplace(&oa, 17);
+            ASSERT(17 == *mX);
+            ASSERT(0 == da.numBlocksInUse());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.createInplace(0, 18);
+            ASSERT(18 == *mX);
+            ASSERT(1 == da.numBlocksInUse());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            int numDestroyed = 0;
+            {
+                Obj mX;
+                mX.createInplace(&oa, &numDestroyed);
+                ASSERT(0 == mX->value());
+                ASSERT(1 == mX.use_count());
+                ASSERT(mX.get() == mX.rep()->originalPtr());
+
+                mX.createInplace(&oa, &numDestroyed, 9);
+                ASSERT(1 == numDestroyed);
+                ASSERT(9 == mX->value());
+                ASSERT(1 == oa.numBlocksInUse());
+            }
+            ASSERT(2 == numDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+
+            int numDerivedDestroyed = 0;
+            {
+                bslstl::LocalSharedPtr<DerivedObject> mX;
+                mX.createInplace(&oa, &numDestroyed, &numDerivedDestroyed, 5);
+                ASSERT(5 == mX->value());
+            }
+            ASSERT(3 == numDestroyed);
+            ASSERT(1 == numDerivedDestroyed);
+
+            bslstl::LocalSharedPtr<SumOf14> mY;
+            mY.createInplace(&oa, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                             14);
+            ASSERT(105 == mY->d_sum);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tException neutrality.\n");
+        {
+            int numDestroyed = 0;
+            Obj mX;  const Obj& X = mX;
+            mX.createInplace(&oa, &numDestroyed, 1);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(1 == X->value());
+                ASSERT(1 == oa.numBlocksInUse());
+
+                Obj mY;
+                mY.createInplace(&oa, &numDestroyed, 2);
+                ASSERT(2 == mY->value());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(1 == X->value());
+            ASSERT(1 == X.use_count());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        {
+            bslstl::LocalSharedPtr<ThrowingObject> mX;
+            mX.createInplace(&oa, 1);
+
+            bool caught = false;
+            try {
+                mX.createInplace(&oa, -1);
+            }
+            catch (int value) {
+                ASSERT(-1 == value);
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(1 == mX->d_value);
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ADOPTING AN OBJECT
+        //
+        // Concerns:
+        //: 1 A shared pointer created from a raw pointer alone deletes the
+        //:   object using the default allocator, from which it also
+        //:   allocates its representation.
+        //:
+        //: 2 A deleter convertible to 'bslma::Allocator *' is used to delete
+        //:   the object and, unless another allocator is supplied, to
+        //:   allocate the representation.
+        //:
+        //: 3 A functor or function-pointer deleter is invoked exactly once,
+        //:   when the last shared reference is released, and the
+        //:   representation is allocated from the supplied allocator, or
+        //:   from the default allocator.
+        //:
+        //: 4 An object adopted through a pointer to a derived class is
+        //:   destroyed as an object of the derived class.
+        //:
+        //: 5 Adopting a null pointer creates an empty shared pointer and
+        //:   allocates nothing.
+        //:
+        //: 6 If the allocation of the representation throws, the object is
+        //:   destroyed using the deleter.
+        //:
+        //: 7 'reset' with a pointer releases the previous object and adopts
+        //:   the new one.
+        //
+        // Plan:
+        //: 1 Adopt objects in each supported way, and check the allocators
+        //:   and counters before and after the last reference is released.
+        //:   (C-1..5, 7)
+        //:
+        //: 2 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, adopt
+        //:   objects while the allocator of the representation throws, and
+        //:   verify that each object is destroyed exactly once.  (C-6)
+        //
+        // Testing:
+        //   LocalSharedPtr(COMPATIBLE_TYPE *);
+        //   LocalSharedPtr(COMPATIBLE_TYPE *, const DELETER&, Allocator *);
+        //   ~LocalSharedPtr();
+        //   void reset(COMPATIBLE_TYPE *);
+        //   void reset(COMPATIBLE_TYPE *, const DELETER&, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nADOPTING AN OBJECT"
+                            "\n==================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        int numDestroyed = 0;
+
+        if (verbose) printf("\tDefault allocator.\n");
+        {
+            Obj mX(new (da) CountedObject(&numDestroyed, 1));
+            ASSERT(2 == da.numBlocksInUse());
+            ASSERT(1 == mX->value());
+            ASSERT(1 == mX.use_count());
+            ASSERT(mX.get() == mX.rep()->originalPtr());
+        }
+        ASSERT(1 == numDestroyed);
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tAllocator deleter.\n");
+        {
+            Obj mX(new (oa) CountedObject(&numDestroyed, 2), &oa);
+            ASSERT(2 == oa.numBlocksInUse());
+            ASSERT(0 == da.numBlocksInUse());
+
+            Obj mY(new (oa) CountedObject(&numDestroyed, 3), &oa, &sa);
+            ASSERT(3 == oa.numBlocksInUse());
+            ASSERT(1 == sa.numBlocksInUse());
+
+            bslma::Allocator *base = &oa;
+            mX.reset(new (oa) CountedObject(&numDestroyed, 4), base);
+            ASSERT(2 == numDestroyed);
+            ASSERT(4 == mX->value());
+            ASSERT(3 == oa.numBlocksInUse());
+        }
+        ASSERT(4 == numDestroyed);
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tFunctor and function deleters.\n");
+        {
+            int numCalls = 0;
+            {
+                Obj mX(new CountedObject(&numDestroyed, 5),
+                       CountingDeleter(&numCalls),
+                       &oa);
+                ASSERT(1 == oa.numBlocksInUse());
+                ASSERT(0 == da.numBlocksInUse());
+
+                Obj mY(mX);
+                mX.reset();
+                ASSERT(0 == numCalls);
+            }
+            ASSERT(1 == numCalls);
+            ASSERT(5 == numDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+
+            {
+                Obj mX(new CountedObject(&numDestroyed, 6),
+                       &deleteCountedObject);
+                ASSERT(1 == da.numBlocksInUse());
+
+                mX.reset(new CountedObject(&numDestroyed, 7),
+                         CountingDeleter(&numCalls));
+                ASSERT(6 == numDestroyed);
+                ASSERT(1 == da.numBlocksInUse());
+            }
+            ASSERT(2 == numCalls);
+            ASSERT(7 == numDestroyed);
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tDerived class.\n");
+        {
+            int numDerivedDestroyed = 0;
+            {
+                Obj mX(new (oa) DerivedObject(&numDestroyed,
+                                              &numDerivedDestroyed,
+                                              8),
+                       &oa);
+                ASSERT(8 == mX->value());
+            }
+            ASSERT(8 == numDestroyed);
+            ASSERT(1 == numDerivedDestroyed);
+
+            {
+                Obj mX;
+                mX.reset(new DerivedObject(&numDestroyed,
+                                           &numDerivedDestroyed,
+                                           9),
+                         CountingDeleter(&numDestroyed));
+            }
+            ASSERT(2 == numDerivedDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tNull pointer.\n");
+        {
+            CountedObject *null = 0;
+            Obj mX(null);
+            ASSERT(!mX);
+            ASSERT(0 == mX.rep());
+
+            Obj mY(null, &oa);
+            ASSERT(0 == mY.rep());
+
+            mY.reset(null);
+            ASSERT(0 == mY.rep());
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tException neutrality.\n");
+        {
+            numDestroyed = 0;
+            int numAttempts = 0;
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ++numAttempts;
+                Obj mX(new (oa) CountedObject(&numDestroyed, 10), &oa, &sa);
+                ASSERT(10 == mX->value());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(numAttempts, numDestroyed, numAttempts == numDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == sa.numBlocksInUse());
+
+            int numCalls = 0;
+            numAttempts  = 0;
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ++numAttempts;
+                Obj mX(new CountedObject(&numDestroyed, 11),
+                       CountingDeleter(&numCalls),
+                       &sa);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(numAttempts, numCalls, numAttempts == numCalls);
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'LocalSharedPtrRep'
+        //
+        // Concerns:
+        //: 1 A new representation has one shared and no weak reference.
+        //:
+        //: 2 'disposeObject' is called exactly once, when the last shared
+        //:   reference is released, and 'disposeRep' is called exactly once,
+        //:   after 'disposeObject', when the last reference of either kind is
+        //:   released.
+        //:
+        //: 3 'tryAcquireRef' succeeds only before 'disposeObject' is called.
+        //:
+        //: 4 'hasUniqueOwner' is 'true' only with a single shared reference
+        //:   and no weak reference.
+        //
+        // Plan:
+        //: 1 Using a representation that counts the calls to 'disposeObject'
+        //:   and 'disposeRep', release the references in different orders,
+        //:   and check the counts and the calls after each step.  (C-1..4)
+        //
+        // Testing:
+        //   LocalSharedPtrRep();
+        //   void acquireRef();
+        //   void acquireWeakRef();
+        //   void releaseRef();
+        //   void releaseWeakRef();
+        //   bool tryAcquireRef();
+        //   bool hasUniqueOwner() const;
+        //   int numReferences() const;
+        //   int numWeakReferences() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'LocalSharedPtrRep'"
+                            "\n===================\n");
+
+        if (verbose) printf("\tShared references only.\n");
+        {
+            TestRep mX;  const TestRep& X = mX;
+            ASSERT(1 == X.numReferences());
+            ASSERT(0 == X.numWeakReferences());
+            ASSERT(X.hasUniqueOwner());
+
+            mX.acquireRef();
+            ASSERT(2 == X.numReferences());
+            ASSERT(!X.hasUniqueOwner());
+
+            ASSERT(mX.tryAcquireRef());
+            ASSERT(3 == X.numReferences());
+
+            mX.releaseRef();
+            mX.releaseRef();
+            ASSERT(1 == X.numReferences());
+            ASSERT(X.hasUniqueOwner());
+            ASSERT(0 == X.numDisposeObject());
+
+            mX.releaseRef();
+            ASSERT(0 == X.numReferences());
+            ASSERT(0 == X.numWeakReferences());
+            ASSERT(1 == X.numDisposeObject());
+            ASSERT(1 == X.numDisposeRep());
+        }
+
+        if (verbose) printf("\tWeak reference outlives the object.\n");
+        {
+            TestRep mX;  const TestRep& X = mX;
+            mX.acquireWeakRef();
+            ASSERT(1 == X.numReferences());
+            ASSERT(1 == X.numWeakReferences());
+            ASSERT(!X.hasUniqueOwner());
+
+            mX.acquireWeakRef();
+            ASSERT(2 == X.numWeakReferences());
+
+            mX.releaseRef();
+            ASSERT(0 == X.numReferences());
+            ASSERT(2 == X.numWeakReferences());
+            ASSERT(1 == X.numDisposeObject());
+            ASSERT(0 == X.numDisposeRep());
+
+            ASSERT(!mX.tryAcquireRef());
+            ASSERT(0 == X.numReferences());
+
+            mX.releaseWeakRef();
+            ASSERT(0 == X.numDisposeRep());
+            mX.releaseWeakRef();
+            ASSERT(0 == X.numWeakReferences());
+            ASSERT(1 == X.numDisposeObject());
+            ASSERT(1 == X.numDisposeRep());
+        }
+
+        if (verbose) printf("\tObject outlives the weak reference.\n");
+        {
+            TestRep mX;  const TestRep& X = mX;
+            mX.acquireWeakRef();
+            mX.releaseWeakRef();
+            ASSERT(0 == X.numWeakReferences());
+            ASSERT(0 == X.numDisposeRep());
+            ASSERT(X.hasUniqueOwner());
+
+            mX.releaseRef();
+            ASSERT(1 == X.numDisposeObject());
+            ASSERT(1 == X.numDisposeRep());
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            TestRep mX;
+            mX.acquireWeakRef();
+            mX.releaseRef();
+            ASSERT_SAFE_FAIL(mX.acquireRef());
+            ASSERT_SAFE_FAIL(mX.releaseRef());
+            ASSERT_SAFE_PASS(mX.releaseWeakRef());
+            ASSERT_SAFE_FAIL(mX.releaseWeakRef());
+            ASSERT_SAFE_FAIL(mX.acquireWeakRef());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create, copy, and release shared and weak pointers, and verify
+        //:   the reference counts and the lifetime of the object.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   LocalSharedPtr();
+        //   ELEMENT_TYPE& operator*() const;
+        //   ELEMENT_TYPE *operator->() const;
+        //   ELEMENT_TYPE *get() const;
+        //   int use_count() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        int numDestroyed = 0;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == X.get());
+            ASSERT(0 == X.use_count());
+
+            mX.createInplace(&oa, &numDestroyed, 3);
+            ASSERT(3 == X->value());
+            ASSERT(3 == (*X).value());
+            ASSERT(1 == X.use_count());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            {
+                Obj mY(X);
+                ASSERT(2 == X.use_count());
+                ASSERT(X.get() == mY.get());
+            }
+            ASSERT(1 == X.use_count());
+
+            WeakObj mW(X);
+            ASSERT(1 == X.use_count());
+
+            mX.reset();
+            ASSERT(1 == numDestroyed);
+            ASSERT(mW.expired());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COPY AND DESTROY
+        //
+        // Concerns:
+        //: 1 Report the cost of copying and destroying a 'LocalSharedPtr',
+        //:   compared with a 'bsl::shared_ptr'.
+        //
+        // Plan:
+        //: 1 For each type of shared pointer, time copying a pointer into each
+        //:   element of an array and then resetting each element, and time
+        //:   passing a pointer by value to a function, and print the mean
+        //:   time per copy.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COPY AND DESTROY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: COPY AND DESTROY"
+                            "\n==================================\n");
+
+        const int NUM_ROUNDS = 20000;
+        const int NUM_COPIES = 1024 * NUM_ROUNDS;  // see 'timeCopyToArray'
+        const int NUM_CALLS  = NUM_COPIES;
+
+        int numDestroyed = 0;
+
+        bsl::shared_ptr<CountedObject> atomicPtr;
+        atomicPtr.createInplace(0, &numDestroyed, 1);
+
+        Obj localPtr;
+        localPtr.createInplace(0, &numDestroyed, 1);
+
+        int atomicSum = 0;
+        int localSum  = 0;
+
+        const double ATOMIC_ARRAY = timeCopyToArray(atomicPtr, NUM_ROUNDS);
+        const double LOCAL_ARRAY  = timeCopyToArray(localPtr, NUM_ROUNDS);
+        const double ATOMIC_CALL  = timePassByValue(atomicPtr,
+                                                    NUM_CALLS,
+                                                    &atomicSum);
+        const double LOCAL_CALL   = timePassByValue(localPtr,
+                                                    NUM_CALLS,
+                                                    &localSum);
+
+        ASSERT(NUM_CALLS == atomicSum);
+        ASSERT(NUM_CALLS == localSum);
+        ASSERT(1 == atomicPtr.use_count());
+        ASSERT(1 == localPtr.use_count());
+
+        printf("%-24s %16s %16s   (ns/copy)\n",
+               "", "bsl::shared_ptr", "LocalSharedPtr");
+        printf("%-24s %16.2f %16.2f\n",
+               "copy to array, reset",
+               ATOMIC_ARRAY * 1e9 / NUM_COPIES,
+               LOCAL_ARRAY * 1e9 / NUM_COPIES);
+        printf("%-24s %16.2f %16.2f\n",
+               "pass by value",
+               ATOMIC_CALL * 1e9 / NUM_CALLS,
+               LOCAL_CALL * 1e9 / NUM_CALLS);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
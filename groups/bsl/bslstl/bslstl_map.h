@@ -33,10 +33,24 @@ BSLS_IDENT("$Id: $")
 // A map meets the requirements of an associative container with bidirectional
 // iterators in the C++ standard [23.2.4].  The 'map' implemented here adheres
 // to the C++11 standard, except that it does not have interfaces that take
-// rvalue references, 'initializer_lists', 'emplace', or operations taking a
-// variadic number of template parameters.  Note that excluded C++11 features
+// rvalue references or 'initializer_lists'.  Note that excluded C++11 features
 // are those that require (or are greatly simplified by) C++11 compiler
-// support.
+// support.  The 'emplace', 'emplace_hint', and 'try_emplace' methods construct
+// elements in place from a variadic list of arguments, which is limited to
+// five arguments on compilers that do not support variadic templates.
+//
+// The 'extract' methods unlink an element from a map and pass the node holding
+// it to a 'node_type' object (see 'bslstl_nodehandle'), the 'insert' method
+// taking a 'node_type' object links such a node into a map again, and the
+// 'merge' method moves into a map the elements of another map having keys
+// not yet present.  An element extracted from a map and inserted into the
+// same map again is neither copied nor destroyed, and no memory is allocated
+// for it.  The same holds when the node is inserted into a *different* map
+// using an equal allocator, since a node does not depend on the map that
+// created it (see 'bslstl_nodehandle'), and for the elements moved by 'merge'
+// between maps using equal allocators.  Inserting a 'node_type' object into a
+// map using a different allocator copies the element into a newly created
+// node and deletes the extracted node.
 //
 ///Requirements on 'KEY' and 'VALUE'
 ///---------------------------------
@@ -89,6 +103,17 @@ BSLS_IDENT("$Id: $")
 // (template parameter) type 'KEY' and 'VALUE', if respectively, the types
 // define the 'bslma::UsesBslmaAllocator' trait.
 //
+///Node Memory
+/// - - - - - -
+// A 'map' allocates each of its nodes from the allocator, and keeps the nodes
+// of erased elements in a pool for reuse, so no memory is returned to the
+// allocator when an element is erased.  As extensions to the standard,
+// 'reserve' pre-allocates the nodes for a number of elements, and
+// 'clearAndReleaseMemory' removes all the elements and returns the memory of
+// all the nodes, including those kept for reuse, to the allocator; if
+// 'value_type' is trivially copyable (see 'bslmf_istriviallycopyable'), the
+// elements are not destroyed.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -107,6 +132,7 @@ BSLS_IDENT("$Id: $")
 //  'k'             - an object of type 'K'
 //  'v'             - an object of type 'V'
 //  'p1', 'p2'      - two iterators belonging to 'a'
+//  'h'             - an object of type 'map<K, V>::node_type'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //
 //  +----------------------------------------------------+--------------------+
@@ -180,8 +206,20 @@ BSLS_IDENT("$Id: $")
 //  | a.erase(p1, p2)                                    | O[log(n) +         |
 //  |                                                    | distance(p1, p2)]  |
 //  +----------------------------------------------------+--------------------+
+//  | a.extract(&h, p1)                                  | amortized constant |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(&h, k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(h)                                        | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.merge(b)                                         | O[m * log(n + m)]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.clearAndReleaseMemory()                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(N)                                       | O[N]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.key_comp()                                       | O[1]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.value_comp()                                     | O[1]               |
@@ -417,6 +455,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_mapcomparator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
 #include <bslstl_stdexceptutil.h>
 #endif
@@ -457,6 +499,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -509,6 +559,27 @@ class map {
         // This typedef is an alias for the allocator traits type associated
         // with this container.
 
+    class NodeDeallocator {
+        // This class provides the 'deleteNode' method required of a 'FACTORY'
+        // by 'bslalg::RbTreeUtil::deleteTree', returning each node to a node
+        // factory *without* destroying its value.
+
+        // DATA
+        NodeFactory *d_factory_p;  // factory receiving the nodes (held, not
+                                   // owned)
+
+      public:
+        // CREATORS
+        explicit NodeDeallocator(NodeFactory *factory);
+            // Create a 'NodeDeallocator' object returning nodes to the
+            // specified 'factory'.
+
+        // MANIPULATORS
+        void deleteNode(BloombergLP::bslalg::RbTreeNode *node);
+            // Return the specified 'node' to the factory of this object
+            // without destroying its value.
+    };
+
     struct DataWrapper : public Comparator {
         // This struct is wrapper around the comparator and allocator data
         // members.  It takes advantage of the empty-base optimization (EBO) so
@@ -555,6 +626,8 @@ class map {
                        const value_type, Node, difference_type> const_iterator;
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+    typedef BloombergLP::bslstl::NodeHandle<value_type, Node, NodeFactory>
+                                                                     node_type;
 
     class value_compare {
         // This nested class defines a mechanism for comparing two objects of
@@ -616,6 +689,27 @@ class map {
         // Return a reference providing modifiable access to the
         // node allocator for this map.
 
+    bsl::pair<iterator, bool> insertNode(
+                                        BloombergLP::bslalg::RbTreeNode *node);
+        // Insert the specified 'node' into this map unless an element having
+        // the same key as the value of 'node' is already present, in which
+        // case delete 'node'.  Return a pair whose 'first' member refers to
+        // the element in this map having that key, and whose 'second' member
+        // is 'true' if 'node' was inserted.  This map takes ownership of
+        // 'node' whether or not an exception is thrown.  The behavior is
+        // undefined unless 'node' was created by 'nodeFactory()'.
+
+    iterator insertNode(const_iterator                   hint,
+                        BloombergLP::bslalg::RbTreeNode *node);
+        // Insert the specified 'node' into this map (in amortized constant
+        // time if the specified 'hint' is a valid immediate successor to the
+        // key of the value of 'node') unless an element having the same key is
+        // already present, in which case delete 'node'.  Return an iterator
+        // referring to the element in this map having that key.  This map
+        // takes ownership of 'node' whether or not an exception is thrown.
+        // The behavior is undefined unless 'node' was created by
+        // 'nodeFactory()' and 'hint' is a valid iterator into this map.
+
     Comparator& comparator();
         // Return a reference providing modifiable access to the
         // comparator for this map.
@@ -813,6 +907,279 @@ class map {
         // (template parameter) types 'KEY' and 'VALUE' both be
         // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(ARGS&&... args);
+        // Insert into this map a newly created 'value_type' object,
+        // constructed in place from the specified 'args', if no element having
+        // the same key as the new object is already present; otherwise destroy
+        // the new object and leave this map unchanged.  Return a pair whose
+        // 'first' member is an iterator referring to the (possibly newly
+        // inserted) element whose key is the same as that of the new object,
+        // and whose 'second' member is 'true' if a new value was inserted, and
+        // 'false' otherwise.  Note that the object is built directly in its
+        // node, so no temporary 'value_type' is copied.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+    bsl::pair<iterator, bool> emplace();
+
+    template <class ARGS_1>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          ARGS&&... args);
+        // Insert into this map a newly created 'value_type' object,
+        // constructed in place from the specified 'args' (in amortized
+        // constant time if the specified 'hint' is a valid immediate successor
+        // to its key), if no element having the same key is already present;
+        // otherwise destroy the new object.  Return an iterator referring to
+        // the (possibly newly inserted) element whose key is the same as that
+        // of the new object.  The behavior is undefined unless 'hint' is a
+        // valid iterator into this map.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+    iterator emplace_hint(const_iterator hint);
+
+    template <class ARGS_1>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bsl::pair<iterator, bool> try_emplace(const key_type& key,
+                                          ARGS&&... args);
+        // If a key equivalent to the specified 'key' already exists in this
+        // map, return a pair whose 'first' member is an iterator referring to
+        // that element and whose 'second' member is 'false', without using the
+        // specified 'args' or allocating memory.  Otherwise, insert a
+        // 'value_type' object whose key is 'key' and whose mapped value is
+        // constructed from 'args', and return a pair whose 'first' member
+        // refers to the new element and whose 'second' member is 'true'.  Note
+        // that, unlike 'emplace', the arguments are not consumed when the key
+        // is already present.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+    bsl::pair<iterator, bool> try_emplace(const key_type& key);
+
+    template <class ARGS_1>
+    bsl::pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bsl::pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bsl::pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bsl::pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bsl::pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bsl::pair<iterator, bool> try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         ARGS&&... args);
+        // Behave as 'try_emplace' without a hint, for the specified 'key' and
+        // 'args', but begin the search at the specified 'hint' (taking
+        // amortized constant time if 'hint' is a valid immediate successor to
+        // 'key'), and return only the iterator referring to the element whose
+        // key is 'key'.  The behavior is undefined unless 'hint' is a valid
+        // iterator into this map.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key);
+
+    template <class ARGS_1>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     iterator erase(const_iterator position);
         // Remove from this map the 'value_type' object at the specified
         // 'position', and return an iterator referring to the element
@@ -836,6 +1203,46 @@ class map {
         // 'end' iterator, and the 'first' position is at or before the 'last'
         // position in the ordered sequence provided by this container.
 
+    void extract(node_type *result, const_iterator position);
+        // Unlink from this map the element at the specified 'position', and
+        // load into the specified 'result' the node holding that element,
+        // after deleting the node held by 'result', if any.  The element is
+        // neither copied nor destroyed, and iterators referring to other
+        // elements of this map remain valid.  The behavior is undefined
+        // unless 'position' refers to an element in this map.
+
+    void extract(node_type *result, const key_type& key);
+        // Unlink from this map the element having the specified 'key', if
+        // such an element exists, and load into the specified 'result' the
+        // node holding that element, after deleting the node held by
+        // 'result', if any; otherwise, leave 'result' empty.
+
+    bsl::pair<iterator, bool> insert(node_type& node);
+        // Insert into this map the element held by the specified 'node' and
+        // leave 'node' empty, if 'node' is not empty and this map does not
+        // already contain an element having the same key; otherwise, leave
+        // 'node' unchanged.  Return a pair whose 'first' member is an iterator
+        // referring to the element in this map having that key (or to the
+        // past-the-end position if 'node' is empty), and whose 'second'
+        // member is 'true' if the element was inserted and 'false'
+        // otherwise.  If the allocator of 'node' compares equal to that of
+        // this map (e.g., 'node' holds a node extracted from this map), link
+        // the node held by 'node' into this map without copying its value;
+        // otherwise, insert a copy of the value and delete the node held by
+        // 'node'.  If an exception is thrown, this method has no effect.
+
+    void merge(map& source);
+        // Move into this map each element of the specified 'source' map
+        // having a key not already present in this map, and leave the other
+        // elements in 'source'.  If 'source' uses an allocator equal to that
+        // of this map, unlink the nodes holding the moved elements from
+        // 'source' and link them into this map, without copying, destroying,
+        // or allocating anything; otherwise, insert copies of the moved
+        // elements and erase them from 'source'.  Iterators referring to the
+        // moved elements are invalidated.  If an exception is thrown, the
+        // elements moved so far remain in this map, and the others in
+        // 'source'.  This method has no effect if 'source' is this map.
+
     void swap(map& other);
         // Exchange the value of this object as well as its comparator with
         // those of the specified 'other' object.  Additionally if
@@ -851,6 +1258,20 @@ class map {
         // Remove all entries from this map.  Note that the map is empty after
         // this call, but allocated memory may be retained for future use.
 
+    void clearAndReleaseMemory();
+        // Remove all entries from this map, and return the memory of all its
+        // nodes, including those kept for reuse, to the allocator.  The
+        // elements are not destroyed if 'value_type' is trivially copyable.
+        // Note that this method is an extension to the standard (see {Node
+        // Memory}).
+
+    void reserve(size_type numElements);
+        // Allocate the nodes for 'numElements - size()' additional elements if
+        // 'size() < numElements', so that inserting that many elements
+        // allocates no memory.  Note that this method is an extension to the
+        // standard (see {Node Memory}), and that nodes recycled from erased
+        // elements are not taken into account.
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the 'value_type'
         // object in this map having the specified 'key', if such an entry
@@ -1026,11 +1447,6 @@ class map {
 
     // T& operator[](key_type&& x);
 
-    // template <class... Args> pair<iterator, bool> emplace(Args&&... args);
-
-    // template <class... Args> iterator emplace_hint(const_iterator position,
-    //                                                Args&&... args);
-
     // template <class P> pair<iterator, bool> insert(P&& value);
 
     // template <class P>
@@ -1145,6 +1561,28 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::DataWrapper::DataWrapper(
 {
 }
 
+                           // ---------------------
+                           // class NodeDeallocator
+                           // ---------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::NodeDeallocator::NodeDeallocator(
+                                                          NodeFactory *factory)
+: d_factory_p(factory)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::NodeDeallocator::deleteNode(
+                                         BloombergLP::bslalg::RbTreeNode *node)
+{
+    d_factory_p->deallocateNode(node);
+}
+
                              // ---------
                              // class map
                              // ---------
@@ -1177,6 +1615,67 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::nodeFactory()
     return d_compAndAlloc.d_pool;
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insertNode(
+                                         BloombergLP::bslalg::RbTreeNode *node)
+{
+    BloombergLP::bslstl::TreeNodePoolProctor<NodeFactory> proctor(
+                                                                &nodeFactory(),
+                                                                node);
+    const key_type& key = toNode(node)->value().first;
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    proctor.release();
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insertNode(
+                                         const_iterator                  hint,
+                                         BloombergLP::bslalg::RbTreeNode *node)
+{
+    BloombergLP::bslstl::TreeNodePoolProctor<NodeFactory> proctor(
+                                                                &nodeFactory(),
+                                                                node);
+    const key_type& key = toNode(node)->value().first;
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    proctor.release();
+    return iterator(node);
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::Comparator&
@@ -1339,12 +1838,26 @@ template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 VALUE& map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
 {
-    BloombergLP::bslalg::RbTreeNode *node =
-        BloombergLP::bslalg::RbTreeUtil::find(d_tree, this->comparator(), key);
-    if (d_tree.sentinel() == node) {
-        return insert(iterator(node), value_type(key, VALUE()))->second;
-                                                                      // RETURN
+    // Search for the insertion point once, and build the new element in its
+    // node from 'key' and a default-constructed 'VALUE', rather than
+    // searching again to insert a copy of a temporary 'value_type'.
+
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return toNode(insertLocation)->value().second;                // RETURN
     }
+    BloombergLP::bslalg::RbTreeNode *node =
+                                        nodeFactory().createNodeWithKey(key);
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
     return toNode(node)->value().second;
 }
 
@@ -1456,94 +1969,1017 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    position,
     return iterator(node);
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
 inline
-typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
-map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(ARGS&&... args)
 {
-    BSLS_ASSERT_SAFE(position != end());
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                                          native_std::forward<ARGS>(args)...));
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace()
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode());
+}
 
-    BloombergLP::bslalg::RbTreeNode *node =
-                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
-    BloombergLP::bslalg::RbTreeNode *result =
-                                   BloombergLP::bslalg::RbTreeUtil::next(node);
-    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
-    nodeFactory().deleteNode(node);
-    return iterator(result);
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1)));
 }
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
 inline
-typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
-map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
 {
-    const_iterator it = find(key);
-    if (it == end()) {
-        return 0;                                                     // RETURN
-    }
-    erase(it);
-    return 1;
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2)));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3)));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4)));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5)));
 }
 
+#else
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+}
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
-map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
-                                              const_iterator last)
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                           const_iterator hint,
+                                                           ARGS&&... args)
 {
-    while (first != last) {
-        first = erase(first);
-    }
-    return iterator(last.node());
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                                          native_std::forward<ARGS>(args)...));
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(const_iterator hint)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode());
 }
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
 inline
-void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(map& other)
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
 {
-    if (AllocatorTraits::propagate_on_container_swap::value) {
-        BloombergLP::bslalg::SwapUtil::swap(&nodeFactory().allocator(),
-                                           &other.nodeFactory().allocator());
-        quickSwap(other);
-    }
-    else {
-        // C++11 behavior: undefined for unequal allocators
-        // BSLS_ASSERT(allocator() == other.allocator());
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1)));
+}
 
-        // backward compatible behavior: swap with copies
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
-               nodeFactory().allocator() == other.nodeFactory().allocator())) {
-            quickSwap(other);
-        }
-        else {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            map thisCopy(*this, other.nodeFactory().allocator());
-            map otherCopy(other, nodeFactory().allocator());
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2)));
+}
 
-            quickSwap(otherCopy);
-            other.quickSwap(thisCopy);
-        }
-    }
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3)));
 }
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
 inline
-void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
 {
-    BSLS_ASSERT_SAFE(d_tree.firstNode());
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4)));
+}
 
-    if (d_tree.rootNode()) {
-        BSLS_ASSERT_SAFE(0 < d_tree.numNodes());
-        BSLS_ASSERT_SAFE(d_tree.firstNode() != d_tree.sentinel());
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5)));
+}
 
-        BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree, &nodeFactory());
-    }
-#if defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
-    else {
-        BSLS_ASSERT_SAFE(0 == d_tree.numNodes());
-        BSLS_ASSERT_SAFE(d_tree.firstNode() == d_tree.sentinel());
-    }
+#else
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                               const_iterator hint,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+}
+// }}} END GENERATED CODE
 #endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                                           const key_type& key,
+                                                           ARGS&&... args)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(native_std::forward<ARGS>(args)...));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(const key_type& key)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE());
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+#else
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                               const key_type& key,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                                          const_iterator  hint,
+                                                          const key_type& key,
+                                                          ARGS&&... args)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(native_std::forward<ARGS>(args)...));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_map.h
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                                          const_iterator  hint,
+                                                          const key_type& key)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE());
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const_iterator  hint,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const_iterator  hint,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const_iterator  hint,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const_iterator  hint,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                              const_iterator  hint,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+              BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5)));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+
+#else
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                               const_iterator  hint,
+                               const key_type& key,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                          // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
+        key,
+        VALUE(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    return iterator(node);
+}
+// }}} END GENERATED CODE
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+    BloombergLP::bslalg::RbTreeNode *result =
+                                   BloombergLP::bslalg::RbTreeUtil::next(node);
+    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    nodeFactory().deleteNode(node);
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    erase(it);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                              const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(last.node());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(node_type      *result,
+                                                     const_iterator  position)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(position != end());
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    result->reset(toNode(node), nodeFactory().allocator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(node_type       *result,
+                                                     const key_type&  key)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    const_iterator position = find(key);
+    if (position == end()) {
+        result->reset();
+        return;                                                       // RETURN
+    }
+    extract(result, position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(node_type& node)
+{
+    if (node.empty()) {
+        return bsl::pair<iterator, bool>(end(), false);               // RETURN
+    }
+
+    const key_type& key = node.value().first;
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+
+    BloombergLP::bslalg::RbTreeNode *newNode;
+    if (node.allocator() == nodeFactory().allocator()) {
+        newNode = node.release();
+    }
+    else {
+        newNode = nodeFactory().createNode(node.value());
+        node.reset();
+    }
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              newNode);
+    return bsl::pair<iterator, bool>(iterator(newNode), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(map& source)
+{
+    if (this == &source) {
+        return;                                                       // RETURN
+    }
+
+    const bool relink =
+                 nodeFactory().allocator() == source.nodeFactory().allocator();
+
+    const_iterator it = source.begin();
+    while (it != source.end()) {
+        BloombergLP::bslalg::RbTreeNode *node =
+                      const_cast<BloombergLP::bslalg::RbTreeNode *>(it.node());
+        ++it;
+
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                  &comparisonResult,
+                                                  &d_tree,
+                                                  this->comparator(),
+                                                  toNode(node)->value().first);
+        if (!comparisonResult) {
+            continue;                                               // CONTINUE
+        }
+
+        BloombergLP::bslalg::RbTreeNode *newNode;
+        if (relink) {
+            BloombergLP::bslalg::RbTreeUtil::remove(&source.d_tree, node);
+            newNode = node;
+        }
+        else {
+            newNode = nodeFactory().createNode(*node);
+            source.erase(const_iterator(node));
+        }
+        BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                  insertLocation,
+                                                  comparisonResult < 0,
+                                                  newNode);
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(map& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value) {
+        BloombergLP::bslalg::SwapUtil::swap(&nodeFactory().allocator(),
+                                           &other.nodeFactory().allocator());
+        quickSwap(other);
+    }
+    else {
+        // C++11 behavior: undefined for unequal allocators
+        // BSLS_ASSERT(allocator() == other.allocator());
+
+        // backward compatible behavior: swap with copies
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               nodeFactory().allocator() == other.nodeFactory().allocator())) {
+            quickSwap(other);
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            map thisCopy(*this, other.nodeFactory().allocator());
+            map otherCopy(other, nodeFactory().allocator());
+
+            quickSwap(otherCopy);
+            other.quickSwap(thisCopy);
+        }
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    BSLS_ASSERT_SAFE(d_tree.firstNode());
+
+    if (d_tree.rootNode()) {
+        BSLS_ASSERT_SAFE(0 < d_tree.numNodes());
+        BSLS_ASSERT_SAFE(d_tree.firstNode() != d_tree.sentinel());
+
+        BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree, &nodeFactory());
+    }
+#if defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
+    else {
+        BSLS_ASSERT_SAFE(0 == d_tree.numNodes());
+        BSLS_ASSERT_SAFE(d_tree.firstNode() == d_tree.sentinel());
+    }
+#endif
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clearAndReleaseMemory()
+{
+    if (bsl::is_trivially_copyable<value_type>::value) {
+        if (d_tree.rootNode()) {
+            NodeDeallocator deallocator(&nodeFactory());
+            BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree, &deallocator);
+        }
+    }
+    else {
+        clear();
+    }
+    nodeFactory().release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(size_type numElements)
+{
+    if (size() < numElements) {
+        nodeFactory().reserveNodes(numElements - size());
+    }
 }
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
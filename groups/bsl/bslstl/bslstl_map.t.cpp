@@ -131,12 +131,22 @@ using namespace bsl;
 // [15] bsl::pair<iterator, bool> insert(const value_type& value);
 // [16] iterator insert(const_iterator position, const value_type& value);
 // [17] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [27] bsl::pair<iterator, bool> emplace(ARGS&&... args);
+// [27] iterator emplace_hint(const_iterator hint, ARGS&&... args);
+// [27] bsl::pair<iterator, bool> try_emplace(const key_type&, ARGS&&...);
+// [27] iterator try_emplace(const_iterator, const key_type&, ARGS&&...);
+// [28] void extract(node_type *result, const_iterator position);
+// [28] void extract(node_type *result, const key_type& key);
+// [28] bsl::pair<iterator, bool> insert(node_type& node);
+// [28] void merge(map& source);
+// [29] void reserve(size_type numElements);
 //
 // [18] iterator erase(const_iterator position);
 // [18] size_type erase(const key_type& key);
 // [18] iterator erase(const_iterator first, const_iterator last);
 // [ 8] void swap(map& other);
 // [ 2] void clear();
+// [29] void clearAndReleaseMemory();
 //
 // observers:
 // [21] key_compare key_comp() const;
@@ -165,7 +175,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(map<T,A> *object, const char *spec, int verbose = 1);
@@ -345,16 +355,6 @@ void debugprint(const bsl::map<KEY, VALUE, COMP, ALLOC>& s)
 
 }  // close namespace bsl
 
-bool expectToAllocate(int n)
-    // Return 'true' if the container is expected to allocate memory on the
-    // specified 'n'th element, and 'false' otherwise.
-{
-    if (n > 32) {
-        return (0 == n % 32);                                         // RETURN
-    }
-    return (((n - 1) & n) == 0);  // Allocate when 'n' is a power of 2
-}
-
 template<class CONTAINER, class VALUES>
 int verifyContainer(const CONTAINER&  container,
                     const VALUES&     expectedValues,
@@ -930,6 +930,15 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase29();
+        // Test 'reserve' and 'clearAndReleaseMemory'.
+
+    static void testCase28();
+        // Test 'extract', 'insert(node_type&)', and 'merge'.
+
+    static void testCase27();
+        // Test 'emplace', 'emplace_hint', and 'try_emplace'.
+
     static void testCase26();
         // Test standard interface coverage.
 
@@ -1078,6 +1087,645 @@ bsl::map<KEY, VALUE, COMP, ALLOC> TestDriver<KEY, VALUE, COMP, ALLOC>::g(
     return gg(&object, spec);
 }
 
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase29()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'reserve' AND 'clearAndReleaseMemory'
+    //
+    // Concerns:
+    //: 1 'reserve' allocates the nodes for the requested number of elements
+    //:   in a single block, so that inserting that many elements allocates no
+    //:   further memory for nodes.
+    //:
+    //: 2 'reserve' has no effect if the map already holds at least the
+    //:   requested number of elements.
+    //:
+    //: 3 'clearAndReleaseMemory' leaves the map empty, and returns all the
+    //:   memory allocated by the map (and by its elements) to the allocator.
+    //:
+    //: 4 The map remains usable after 'clearAndReleaseMemory'.
+    //
+    // Plan:
+    //: 1 For each of a set of specifications, create two objects, reserving
+    //:   room for the elements of the specification in the second, populate
+    //:   both, and verify that 'reserve' allocates one block for each node,
+    //:   and that the second object has allocated, in total, as many blocks
+    //:   as the first.  Call 'reserve' again, and verify that no memory is
+    //:   allocated.  (C-1..2)
+    //:
+    //: 2 Call 'clearAndReleaseMemory', and verify that the object is empty
+    //:   and that no memory remains in use.  Populate the object again, and
+    //:   verify its value.  (C-3..4)
+    //
+    // Testing:
+    //   void clearAndReleaseMemory();
+    //   void reserve(size_type numElements);
+    // ------------------------------------------------------------------------
+
+    static const struct {
+        int         d_line;  // source line number
+        const char *d_spec;  // specification string
+    } DATA[] = {
+        //line  spec
+        //----  ----
+
+        { L_,   ""           },
+        { L_,   "A"          },
+        { L_,   "AB"         },
+        { L_,   "ABC"        },
+        { L_,   "ABCDE"      },
+        { L_,   "ABCDEFGH"   }
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE   = DATA[ti].d_line;
+        const char *const SPEC   = DATA[ti].d_spec;
+        const size_t      LENGTH = strlen(SPEC);
+
+        const TestValues VALUES(SPEC);
+
+        if (veryVerbose) { P_(LINE) P(SPEC); }
+
+        bslma::TestAllocator xa("plain",    veryVeryVeryVerbose);
+        bslma::TestAllocator oa("reserved", veryVeryVeryVerbose);
+
+        Obj mX(&xa);  const Obj& X = gg(&mX, SPEC);
+
+        Obj mY(&oa);  const Obj& Y = mY;
+
+        mY.reserve(LENGTH);
+
+        ASSERTV(LINE, static_cast<bsls::Types::Int64>(LENGTH)
+                                                      == oa.numBlocksTotal());
+
+        gg(&mY, SPEC);
+
+        ASSERTV(LINE, 0 == verifyContainer(Y, VALUES, LENGTH));
+        ASSERTV(LINE, xa.numBlocksTotal() == oa.numBlocksTotal());
+
+        const bsls::Types::Int64 B = oa.numBlocksTotal();
+
+        mY.reserve(LENGTH);
+        mY.reserve(0);
+
+        ASSERTV(LINE, B == oa.numBlocksTotal());
+
+        mX.clear();
+
+        ASSERTV(LINE, X.empty());
+        if (LENGTH) {
+            ASSERTV(LINE, 0 < xa.numBlocksInUse());
+        }
+
+        mX.clearAndReleaseMemory();
+        mY.clearAndReleaseMemory();
+
+        ASSERTV(LINE, X.empty());
+        ASSERTV(LINE, Y.empty());
+        ASSERTV(LINE, Y.begin() == Y.end());
+        ASSERTV(LINE, 0 == xa.numBlocksInUse());
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+        gg(&mY, SPEC);
+
+        ASSERTV(LINE, 0 == verifyContainer(Y, VALUES, LENGTH));
+    }
+}
+
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase28()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+    //
+    // Concerns:
+    //: 1 'extract' unlinks the element at the supplied position, or having
+    //:   the supplied key, and passes the node holding it to the supplied
+    //:   'node_type' object without copying the element or releasing memory.
+    //:
+    //: 2 'extract' leaves the 'node_type' object empty if no element has the
+    //:   supplied key.
+    //:
+    //: 3 'insert' links a node extracted from the same container without
+    //:   copying the element or allocating memory, and leaves the
+    //:   'node_type' object empty.
+    //:
+    //: 4 'insert' has no effect, and leaves the 'node_type' object unchanged,
+    //:   if the object is empty or an element having the same key exists.
+    //:
+    //: 5 'insert' copies the element held by a node extracted from a
+    //:   container using another allocator, and is exception neutral.
+    //:
+    //: 6 'merge' moves into the container each element of the source having
+    //:   a key not present, and leaves the other elements in the source.
+    //:
+    //: 7 'merge' neither copies nor destroys the moved elements if both
+    //:   containers use the same allocator, and the moved elements remain
+    //:   valid after the source is destroyed.
+    //:
+    //: 8 'merge' provides the strong exception-safety guarantee w.r.t. memory
+    //:   allocation if both containers use the same allocator.
+    //
+    // Plan:
+    //: 1 For each element of a set of objects, extract the element by
+    //:   position and by key, and verify the address of the element, the
+    //:   value of the object, and the memory in use.  Extract the same key
+    //:   again, and verify that the 'node_type' object is empty.  (C-1..2)
+    //:
+    //: 2 Insert the extracted node, and verify the address of the element,
+    //:   the value of the object, and the memory in use.  Insert the empty
+    //:   'node_type' object, and a node holding a duplicate key, and verify
+    //:   that neither has an effect.  (C-3..4)
+    //:
+    //: 3 Insert the node holding a duplicate key into an object using a
+    //:   different allocator under the presence of exceptions, and verify
+    //:   the value of both the object and the 'node_type' object.  (C-5)
+    //:
+    //: 4 Using a table of pairs of specifications, merge the second object
+    //:   into the first, both when they use the same and different
+    //:   allocators, and verify the values of both objects and (when the
+    //:   allocators are the same) the addresses of the moved elements after
+    //:   the source object is destroyed.  Repeat the merge under the presence
+    //:   of exceptions when the allocators are the same.  (C-6..8)
+    //
+    // Testing:
+    //   void extract(node_type *result, const_iterator position);
+    //   void extract(node_type *result, const key_type& key);
+    //   bsl::pair<iterator, bool> insert(node_type& node);
+    //   void merge(map& source);
+    // ------------------------------------------------------------------------
+
+    typedef typename Obj::node_type  NodeType;
+    typedef typename Obj::value_type ValueType;
+
+    const int TYPE_ALLOC = (bslma::UsesBslmaAllocator<KEY>::value +
+                            bslma::UsesBslmaAllocator<VALUE>::value);
+
+    if (verbose)
+        printf("\nTesting parameters: TYPE_ALLOC = %d.\n", TYPE_ALLOC);
+
+    if (verbose) printf("\nTesting 'extract' and 'insert(node_type&)'.\n");
+    {
+        static const struct {
+            int         d_line;  // source line number
+            const char *d_spec;  // specification string (ordered)
+        } DATA[] = {
+            //line  spec
+            //----  ----
+
+            { L_,   "A"          },
+            { L_,   "AB"         },
+            { L_,   "ABC"        },
+            { L_,   "ABCDE"      },
+            { L_,   "ABCDEFGH"   }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const size_t      LENGTH = strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            if (veryVerbose) { P_(LINE) P(SPEC); }
+
+            for (size_t tj = 0; tj < LENGTH; ++tj) {
+            for (int byKey = 0; byKey < 2; ++byKey) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC);
+
+                const KEY&       K       = VALUES[tj].first;
+                const ValueType *ADDRESS = &*X.find(K);
+
+                const bsls::Types::Int64 B = oa.numBlocksInUse();
+
+                NodeType node;
+                if (byKey) {
+                    mX.extract(&node, K);
+                }
+                else {
+                    mX.extract(&node, X.find(K));
+                }
+
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == node.value().first);
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+                ASSERTV(LINE, tj, byKey, X.end()     == X.find(K));
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+
+                NodeType missing;
+                mX.extract(&missing, K);
+
+                ASSERTV(LINE, tj, byKey, missing.empty());
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+
+                bsl::pair<Iter, bool> R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &*R.first);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey,
+                        0 == verifyContainer(X, VALUES, LENGTH));
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, X.end()     == R.first);
+                ASSERTV(LINE, tj, byKey, LENGTH      == X.size());
+
+                // Insert a node holding a key that is already present.
+
+                mX.extract(&node, K);
+                mX.insert(VALUES[tj]);
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == R.first->first);
+                ASSERTV(LINE, tj, byKey,
+                        0 == verifyContainer(X, VALUES, LENGTH));
+
+                // Insert the node into an object using another allocator.
+
+                bslma::TestAllocator za("other", veryVeryVeryVerbose);
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                    ASSERTV(LINE, tj, byKey, !node.empty());
+                    ASSERTV(LINE, tj, byKey, 0 == Z.size());
+
+                    R = mZ.insert(node);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, 1 == Z.size());
+                ASSERTV(LINE, tj, byKey, K == Z.begin()->first);
+                ASSERTV(LINE, tj, byKey, VALUES[tj].second == R.first->second);
+
+                // The copy of the element inserted into 'X' above may have
+                // required a new block for the node pool of 'X'.
+
+                ASSERTV(LINE, tj, byKey, B     <= oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey, B + 1 >= oa.numBlocksInUse());
+            }
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting 'merge'.\n");
+    {
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_specX;    // specification of the target
+            const char *d_specY;    // specification of the source
+            const char *d_resultX;  // expected value of the target
+            const char *d_resultY;  // expected value of the source
+        } DATA[] = {
+            //line  specX     specY       resultX     resultY
+            //----  -----     -----       -------     -------
+
+            { L_,   "",       "",         "",         ""     },
+            { L_,   "",       "ABC",      "ABC",      ""     },
+            { L_,   "ABC",    "",         "ABC",      ""     },
+            { L_,   "ABC",    "ABC",      "ABC",      "ABC"  },
+            { L_,   "ACE",    "BCD",      "ABCDE",    "C"    },
+            { L_,   "AB",     "CDEFGH",   "ABCDEFGH", ""     },
+            { L_,   "BDFH",   "ABCDEFGH", "ABCDEFGH", "BDFH" },
+            { L_,   "ABCDEFG", "H",       "ABCDEFGH", ""     }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MAX_LENGTH = 10;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const SPEC_X   = DATA[ti].d_specX;
+            const char *const SPEC_Y   = DATA[ti].d_specY;
+            const char *const RESULT_X = DATA[ti].d_resultX;
+            const char *const RESULT_Y = DATA[ti].d_resultY;
+
+            const TestValues EXP_X(RESULT_X);
+            const TestValues EXP_Y(RESULT_Y);
+
+            if (veryVerbose) { P_(LINE) P_(SPEC_X) P(SPEC_Y); }
+
+            for (int sameAlloc = 0; sameAlloc < 2; ++sameAlloc) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+
+                const ValueType *ADDRESSES[MAX_LENGTH];
+                int numMoved = 0;
+                {
+                    Obj mY(sameAlloc ? &oa : &za);
+                    const Obj& Y = gg(&mY, SPEC_Y);
+
+                    for (CIter it = Y.begin(); it != Y.end(); ++it) {
+                        if (X.end() == X.find(it->first)) {
+                            ADDRESSES[numMoved++] = &*it;
+                        }
+                    }
+
+                    mX.merge(mY);
+
+                    ASSERTV(LINE, sameAlloc,
+                            0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+                    ASSERTV(LINE, sameAlloc,
+                            0 == verifyContainer(Y, EXP_Y, strlen(RESULT_Y)));
+
+                    mX.merge(mX);
+
+                    ASSERTV(LINE, sameAlloc,
+                            0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+                }
+
+                ASSERTV(LINE, sameAlloc,
+                        0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+
+                if (sameAlloc) {
+                    for (int k = 0; k < numMoved; ++k) {
+                        ASSERTV(LINE, k,
+                                ADDRESSES[k] == &*X.find(ADDRESSES[k]->first));
+                    }
+                }
+
+                mX.clear();
+
+                ASSERTV(LINE, sameAlloc, 0 == za.numBlocksInUse());
+            }
+
+            {
+                const TestValues VALUES_X(SPEC_X);
+                const TestValues VALUES_Y(SPEC_Y);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+                Obj mY(&oa);  const Obj& Y = gg(&mY, SPEC_Y);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE,
+                            0 == verifyContainer(X,
+                                                 VALUES_X,
+                                                 strlen(SPEC_X)));
+                    ASSERTV(LINE,
+                            0 == verifyContainer(Y,
+                                                 VALUES_Y,
+                                                 strlen(SPEC_Y)));
+
+                    mX.merge(mY);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE,
+                        0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+                ASSERTV(LINE,
+                        0 == verifyContainer(Y, EXP_Y, strlen(RESULT_Y)));
+            }
+        }
+    }
+}
+
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase27()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace', 'emplace_hint', AND 'try_emplace'
+    //
+    // Concerns:
+    //: 1 Each method inserts a new element, constructed from the supplied
+    //:   arguments, if and only if no element having the same key exists, and
+    //:   the order of the container remains correct.
+    //:
+    //: 2 The iterator returned refers to the newly inserted element if it did
+    //:   not already exist, and to the existing element if it did, and the
+    //:   'bool' returned (if any) is 'true' if and only if a new element was
+    //:   inserted.
+    //:
+    //: 3 Any memory allocated by the container, or by the newly inserted
+    //:   element, is drawn from the object allocator, and only memory retained
+    //:   by the node pool remains in use when an element with a duplicate key
+    //:   is not inserted.
+    //:
+    //: 4 'try_emplace' allocates no memory when the key already exists.
+    //:
+    //: 5 Each method is exception neutral w.r.t. memory allocation.
+    //
+    // Plan:
+    //: 1 For each method, and for a sequence of values having both unique
+    //:   and duplicate keys, insert each value (passing its key and mapped
+    //:   value as separate arguments) into an initially empty object.
+    //:
+    //:   1 Verify the return value and the resulting value of the object.
+    //:     (C-1..2)
+    //:
+    //:   2 Compute the number of allocations from the object allocator and
+    //:     verify it is as expected.  (C-3..4)
+    //:
+    //: 2 Repeat P-1 under the presence of exceptions.  (C-5)
+    //
+    // Testing:
+    //   bsl::pair<iterator, bool> emplace(ARGS&&... args);
+    //   iterator emplace_hint(const_iterator hint, ARGS&&... args);
+    //   bsl::pair<iterator, bool> try_emplace(const key_type&, ARGS&&...);
+    //   iterator try_emplace(const_iterator, const key_type&, ARGS&&...);
+    // ------------------------------------------------------------------------
+
+    const int TYPE_ALLOC = (bslma::UsesBslmaAllocator<KEY>::value +
+                            bslma::UsesBslmaAllocator<VALUE>::value);
+
+    if (verbose)
+        printf("\nTesting parameters: TYPE_ALLOC = %d.\n", TYPE_ALLOC);
+
+    static const struct {
+        int         d_line;    // source line number
+        const char *d_spec;    // specification string
+        const char *d_unique;  // expected element values
+    } DATA[] = {
+        //line  spec           isUnique
+        //----  ----           --------
+
+        { L_,   "A",           "Y"           },
+        { L_,   "AAA",         "YNN"         },
+        { L_,   "ABCDEFGH",    "YYYYYYYY"    },
+        { L_,   "ABCDEABCDEF", "YYYYYNNNNNY" },
+        { L_,   "EEDDCCBBAA",  "YNYNYNYNYN"  }
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    const int MAX_LENGTH = 10;
+
+    enum { e_EMPLACE, e_EMPLACE_HINT, e_TRY_EMPLACE, e_TRY_EMPLACE_HINT,
+           e_NUM_METHODS };
+
+    if (verbose) printf("\nTesting without exceptions.\n");
+    for (int method = 0; method < e_NUM_METHODS; ++method) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            if (veryVerbose) { P_(method) P_(LINE) P_(SPEC) P(UNIQUE); }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                if (IS_UNIQ) {
+                    EXPECTED[SIZE] = SPEC[tj];
+                    std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                    EXPECTED[SIZE + 1] = '\0';
+                }
+
+                const KEY&   K = VALUES[tj].first;
+                const VALUE& V = VALUES[tj].second;
+
+                const bsls::Types::Int64 BB = oa.numBlocksTotal();
+                const bsls::Types::Int64 B  = oa.numBlocksInUse();
+
+                bsl::pair<Iter, bool> RESULT(mX.end(), IS_UNIQ);
+                switch (method) {
+                  case e_EMPLACE: {
+                    RESULT = mX.emplace(K, V);
+                  } break;
+                  case e_EMPLACE_HINT: {
+                    RESULT.first = mX.emplace_hint(X.end(), K, V);
+                  } break;
+                  case e_TRY_EMPLACE: {
+                    RESULT = mX.try_emplace(K, V);
+                  } break;
+                  case e_TRY_EMPLACE_HINT: {
+                    RESULT.first = mX.try_emplace(X.end(), K, V);
+                  } break;
+                }
+
+                ASSERTV(method, LINE, tj, IS_UNIQ    == RESULT.second);
+                ASSERTV(method, LINE, tj, K          == RESULT.first->first);
+
+                const bsls::Types::Int64 AA = oa.numBlocksTotal();
+                const bsls::Types::Int64 A  = oa.numBlocksInUse();
+
+                const bool IS_TRY = e_TRY_EMPLACE      == method
+                                 || e_TRY_EMPLACE_HINT == method;
+
+                if (IS_UNIQ) {
+                    ASSERTV(method, LINE, tj, V == RESULT.first->second);
+
+                    if (!IS_TRY) {
+                        // A node created for a duplicate key is returned to
+                        // the pool's free list, so this insertion may reuse
+                        // it rather than allocate a new block.
+
+                        ASSERTV(method, LINE, tj, A, B,
+                                B + TYPE_ALLOC     <= A);
+                        ASSERTV(method, LINE, tj, A, B,
+                                B + 1 + TYPE_ALLOC >= A);
+                    }
+                    else {
+                        ASSERTV(method, LINE, tj, AA, BB,
+                                BB + 1 + TYPE_ALLOC == AA);
+                        ASSERTV(method, LINE, tj, A, B,
+                                B + 1 + TYPE_ALLOC == A);
+                    }
+                    ASSERTV(method, LINE, tj, SIZE + 1 == X.size());
+
+                    TestValues exp(EXPECTED);
+                    ASSERTV(method, LINE, tj,
+                            0 == verifyContainer(X, exp, SIZE + 1));
+                }
+                else {
+                    if (IS_TRY) {
+                        ASSERTV(method, LINE, tj, AA, BB, BB == AA);
+                        ASSERTV(method, LINE, tj, A,  B,  B  == A);
+                    }
+                    else {
+                        ASSERTV(method, LINE, tj, A,  B,  B + 1 >= A);
+                    }
+                    ASSERTV(method, LINE, tj, SIZE == X.size());
+
+                    TestValues exp(EXPECTED);
+                    ASSERTV(method, LINE, tj,
+                            0 == verifyContainer(X, exp, SIZE));
+                }
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting with injected exceptions.\n");
+    for (int method = 0; method < e_NUM_METHODS; ++method) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                if (IS_UNIQ) {
+                    EXPECTED[SIZE] = SPEC[tj];
+                    std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                    EXPECTED[SIZE + 1] = '\0';
+                }
+
+                const KEY&   K = VALUES[tj].first;
+                const VALUE& V = VALUES[tj].second;
+
+                bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ExceptionGuard<Obj> guard(&X, L_, &scratch);
+
+                    switch (method) {
+                      case e_EMPLACE: {
+                        mX.emplace(K, V);
+                      } break;
+                      case e_EMPLACE_HINT: {
+                        mX.emplace_hint(X.end(), K, V);
+                      } break;
+                      case e_TRY_EMPLACE: {
+                        mX.try_emplace(K, V);
+                      } break;
+                      case e_TRY_EMPLACE_HINT: {
+                        mX.try_emplace(X.end(), K, V);
+                      } break;
+                    }
+
+                    guard.release();
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                TestValues exp(EXPECTED);
+                ASSERTV(method, LINE, tj,
+                        0 == verifyContainer(X, exp, SIZE + IS_UNIQ));
+            }
+        }
+    }
+}
+
 template <class KEY, class VALUE, class COMP, class ALLOC>
 void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase26()
 {
@@ -1509,7 +2157,8 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase24()
     //:
     //:   7 Verify that a default 'VALUE' is created.
     //:
-    //:   8 Verify memory usage is as expected.
+    //:   8 Verify memory usage is as expected, and that no memory is
+    //:     allocated from the default allocator.
     //
     // Testing:
     //   VALUE& operator[](const key_type& key);
@@ -1606,6 +2255,7 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase24()
                 const size_t SIZE = X.size();
 
                 const bsls::Types::Int64 B  = oa.numBlocksInUse();
+                const bsls::Types::Int64 BD = da.numBlocksTotal();
 
                 bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
 
@@ -1617,15 +2267,12 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase24()
                 } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
 
                 const bsls::Types::Int64 A  = oa.numBlocksInUse();
+                const bsls::Types::Int64 AD = da.numBlocksTotal();
 
                 ASSERTV(LINE, D == X.find(ZK)->second);
 
-                if(expectToAllocate(SIZE + 1)) {
-                    ASSERTV(LINE, A, B, B + 1 + TYPE_ALLOC == A);
-                }
-                else {
-                    ASSERTV(LINE, A, B, B + 0 + TYPE_ALLOC == A);
-                }
+                ASSERTV(LINE, A, B, B + 1 + TYPE_ALLOC == A);
+                ASSERTV(LINE, AD, BD, BD == AD);
                 ASSERTV(LINE, SIZE, SIZE + 1 == X.size());
             }
 #endif
@@ -2766,13 +3413,7 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase16()
                     }
 
                     if (IS_UNIQ) {
-                        if(expectToAllocate(SIZE + 1)) {
-                            ASSERTV(LINE, tj, A, B,
-                                    B + 1 + TYPE_ALLOC == A);
-                        }
-                        else {
-                            ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                        }
+                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                         ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                         TestValues exp(EXPECTED);
@@ -2882,14 +3523,8 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase16()
                             VALUES[tj] == *RESULT);
 
                     if (IS_UNIQ) {
-                        if(expectToAllocate(SIZE + 1)) {
-                            ASSERTV(LINE, tj, AA, BB,
-                                    BB + 1 + TYPE_ALLOC == AA);
-                            ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                        }
-                        else {
-                            ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                        }
+                        ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                         ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                         TestValues exp(EXPECTED);
@@ -3025,14 +3660,8 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase15()
                 const bsls::Types::Int64 A  = oa.numBlocksInUse();
 
                 if (IS_UNIQ) {
-                    if(((SIZE + 1) & SIZE) == 0) {
-                        ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                    }
-                    else {
-                        ASSERTV(LINE, tj, AA, BB, BB + 0 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                    }
+                    ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                     ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                     TestValues exp(EXPECTED);
@@ -4953,9 +5582,10 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase7()
                     ASSERTV(SPEC,  B + 0 ==  A);
                 }
                 else {
-                    const int TYPE_ALLOCS = TYPE_ALLOC * X.size();
-                    ASSERTV(SPEC, BB + 1 + TYPE_ALLOCS == AA);
-                    ASSERTV(SPEC,  B + 1 + TYPE_ALLOCS ==  A);
+                    const int NUM_NODES   = static_cast<int>(X.size());
+                    const int TYPE_ALLOCS = TYPE_ALLOC * NUM_NODES;
+                    ASSERTV(SPEC, BB + NUM_NODES + TYPE_ALLOCS == AA);
+                    ASSERTV(SPEC,  B + NUM_NODES + TYPE_ALLOCS ==  A);
                 }
 
                 const bsls::Types::Int64 CC = oa.numBlocksTotal();
@@ -5730,14 +6360,8 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase2()
                     bsl::pair<Iter, bool> RESULT =
                                                  mX.insert(VALUES[LENGTH - 1]);
 
-                    if (0 < TYPE_ALLOC || expectToAllocate(LENGTH)) {
-                        ASSERTV(CONFIG, tam.isTotalUp());
-                        ASSERTV(CONFIG, tam.isInUseUp());
-                    }
-                    else {
-                        ASSERTV(CONFIG, tam.isTotalSame());
-                        ASSERTV(CONFIG, tam.isInUseSame());
-                    }
+                    ASSERTV(CONFIG, tam.isTotalUp());
+                    ASSERTV(CONFIG, tam.isInUseUp());
 
                     ASSERTV(LENGTH, CONFIG, true == RESULT.second);
                     ASSERTV(LENGTH, CONFIG,
@@ -6578,7 +7202,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 27: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6621,6 +7245,31 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING 'reserve' AND 'clearAndReleaseMemory'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase29,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase28,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'emplace', 'emplace_hint', AND 'try_emplace'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase27,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+        TestDriver<TestKeyType, TestValueType>::testCase27();
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
@@ -0,0 +1,742 @@
+// bslstl_mpmcringbuffer.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_MPMCRINGBUFFER
+#define INCLUDED_BSLSTL_MPMCRINGBUFFER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a bounded lock-free multi-producer/multi-consumer queue.
+//
+//@CLASSES:
+//  bslstl::MpmcRingBuffer: bounded lock-free MPMC ring-buffer queue
+//
+//@SEE_ALSO: bslstl_spscringbuffer, bslstl_deque
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::MpmcRingBuffer', implementing a bounded, first-in first-out queue
+// of values of the (template parameter) 'TYPE' that any number of threads may
+// push to and pop from concurrently, without locking.  The queue stores its
+// elements in a fixed array of slots, obtained at construction from the
+// 'bslma::Allocator' supplied to the queue, and never allocates again.
+//
+// 'tryPushBack' and 'tryPopFront' return immediately, with a non-zero status
+// if the queue was full or empty, respectively.  Batch variants claim a run
+// of consecutive slots with a single atomic operation.  When there is only
+// one producer and one consumer, 'bslstl::SpscRingBuffer' is cheaper.
+//
+///Ordering
+///--------
+// Values pushed by one thread are popped in the order in which that thread
+// pushed them.  There is no ordering between values pushed by different
+// threads other than that implied by the synchronization of those threads.
+//
+///Exception Safety
+///----------------
+// A slot is claimed before the value is copied into or out of it.  If copying
+// a value into a claimed slot throws, the slot is marked as empty and will be
+// skipped by consumers; the exception propagates and the value is not
+// pushed.  If assigning a value out of a claimed slot throws, the value is
+// destroyed and removed from the queue, and the exception propagates.
+//
+///Implementation Notes
+///--------------------
+// This is the bounded queue described by Dmitry Vyukov.  Each slot carries an
+// atomic sequence number in addition to its storage.  A slot with sequence
+// number 'n' is free for the producer that claims push position 'n', and a
+// slot with sequence number 'n + 1' is full for the consumer that claims pop
+// position 'n'; after popping, the consumer sets the sequence number to
+// 'n + capacity()', freeing the slot for the next lap.  A thread claims a
+// position by advancing the shared push (or pop) index with a
+// compare-and-swap, then accesses the slot without further contention.  The
+// push index, the pop index, and the read-only members are each kept on their
+// own cache line.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Shared Work Queue
+/// - - - - - - - - - - - - - - -
+// Suppose that several threads produce tasks, identified by 'int' values, for
+// a pool of worker threads.  First, we create a queue shared by all threads:
+//..
+//  bslma::TestAllocator        allocator;
+//  bslstl::MpmcRingBuffer<int> queue(256, &allocator);
+//  assert(256 == queue.capacity());
+//..
+// Then, each producer pushes its tasks, retrying while the queue is full,
+// optionally in batches:
+//..
+//  const int tasks[] = { 1, 2, 3, 4 };
+//  assert(1 == queue.tryPushBack(tasks, 1));
+//  assert(3 == queue.tryPushBack(tasks + 1, 3));
+//..
+// Finally, each worker pops tasks until the queue is empty:
+//..
+//  int task;
+//  int sum = 0;
+//  while (0 == queue.tryPopFront(&task)) {
+//      sum += task;
+//  }
+//  assert(10 == sum);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CACHELINE
+#include <bsls_cacheline.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>
+#define INCLUDED_NEW
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <class TYPE> class MpmcRingBuffer_PushProctor;
+template <class TYPE> class MpmcRingBuffer_PopProctor;
+
+                            // ====================
+                            // class MpmcRingBuffer
+                            // ====================
+
+template <class TYPE>
+class MpmcRingBuffer {
+    // This class template implements a bounded, lock-free, first-in first-out
+    // queue of 'TYPE' values that may be used concurrently by any number of
+    // producer and consumer threads.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    struct Slot {
+        // A slot holds storage for one value, and the sequence number that
+        // indicates whether the slot is free or full for a given position.
+
+        bsls::AtomicInt64      d_sequence;  // see the implementation notes
+
+        bool                   d_skip;      // 'true' if the producer failed
+                                            // to construct the value
+
+        bsls::AlignedBuffer<sizeof(TYPE),
+                            bsls::AlignmentFromType<TYPE>::VALUE>
+                               d_buffer;    // storage for the value
+    };
+
+    // DATA
+    char              d_pushPad[bsls::CacheLine::BSLS_SIZE];
+                                       // separates the push index from
+                                       // preceding memory
+
+    bsls::AtomicInt64 d_pushIndex;     // next position to push
+
+    char              d_popPad[bsls::CacheLine::BSLS_SIZE];
+                                       // separates the push and pop indices
+
+    bsls::AtomicInt64 d_popIndex;      // next position to pop
+
+    char              d_sharedPad[bsls::CacheLine::BSLS_SIZE];
+                                       // separates the pop index from the
+                                       // read-only data
+
+    Slot             *d_slots_p;       // array of 'd_mask + 1' slots (owned)
+
+    Int64             d_mask;          // capacity minus one
+
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    // FRIENDS
+    friend class MpmcRingBuffer_PushProctor<TYPE>;
+    friend class MpmcRingBuffer_PopProctor<TYPE>;
+
+    // NOT IMPLEMENTED
+    MpmcRingBuffer(const MpmcRingBuffer&);
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&);
+
+    // PRIVATE MANIPULATORS
+    Int64 claim(bsls::AtomicInt64 *index,
+                Int64              readyOffset,
+                Int64              maxCount,
+                Int64             *count);
+        // Claim up to the specified 'maxCount' consecutive positions from the
+        // specified 'index', each of whose slot has a sequence number equal
+        // to the position plus the specified 'readyOffset', load into the
+        // specified 'count' the number of positions claimed, and return the
+        // first position claimed.  Return with '*count' set to 0 if the slot
+        // for the position at 'index' is not ready.  The behavior is
+        // undefined unless '0 < maxCount'.
+
+    // PRIVATE ACCESSORS
+    Slot& slot(Int64 position) const;
+        // Return a reference to the slot for the specified 'position'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MpmcRingBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    MpmcRingBuffer(std::size_t capacity, bslma::Allocator *basicAllocator = 0);
+        // Create an empty queue able to hold at least the specified
+        // 'capacity' values.  Optionally specify a 'basicAllocator' used to
+        // supply memory for the slot array and for the values held by this
+        // queue.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < capacity'.  Note that the capacity is rounded up to a power
+        // of two, and is at least 2.
+
+    ~MpmcRingBuffer();
+        // Destroy this queue and the values it holds.  The behavior is
+        // undefined unless no other thread is accessing this queue.
+
+    // MANIPULATORS
+    int tryPushBack(const TYPE& value);
+        // Append a copy of the specified 'value' to the back of this queue if
+        // it is not full.  Return 0 on success, and a non-zero value, with no
+        // effect, if this queue is full.
+
+    std::size_t tryPushBack(const TYPE *values, std::size_t numValues);
+        // Append copies of as many of the specified 'numValues' leading
+        // elements of the specified 'values' array to the back of this queue
+        // as there are consecutive free slots, in order, and return the number
+        // of values appended.  The slots are claimed with a single atomic
+        // operation, so that values pushed by a batch are not interleaved with
+        // values pushed by other threads.
+
+    int tryPopFront(TYPE *value);
+        // Assign the value at the front of this queue to the specified
+        // 'value' and remove it from this queue, if this queue is not empty.
+        // Return 0 on success, and a non-zero value, with no effect, if this
+        // queue is empty.
+
+    std::size_t tryPopFront(TYPE *values, std::size_t maxValues);
+        // Assign up to the specified 'maxValues' values from the front of
+        // this queue, in order, to the leading elements of the specified
+        // 'values' array, remove them from this queue, and return the number
+        // of values removed.  The values are claimed with a single atomic
+        // operation.
+
+    // ACCESSORS
+    std::size_t capacity() const;
+        // Return the maximum number of values this queue can hold.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue holds no values, and 'false' otherwise.
+        // Note that the result may be out of date by the time it is returned
+        // if other threads are using this queue.
+
+    bool isFull() const;
+        // Return 'true' if every slot of this queue is in use, and 'false'
+        // otherwise.  Note that the result may be out of date by the time it
+        // is returned if other threads are using this queue.
+
+    std::size_t numElements() const;
+        // Return a snapshot of the number of slots of this queue in use,
+        // including those being pushed to or popped from by other threads,
+        // and those left empty by a push that threw an exception and not yet
+        // reached by a pop.  Note that the result may be out of date by the
+        // time it is returned if other threads are using this queue.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this queue to supply memory.
+};
+
+                      // ================================
+                      // class MpmcRingBuffer_PushProctor
+                      // ================================
+
+template <class TYPE>
+class MpmcRingBuffer_PushProctor {
+    // PRIVATE CLASS.  For use only by 'MpmcRingBuffer'.  This class provides
+    // a proctor for a range of claimed push positions: upon destruction, each
+    // position not yet published is marked to be skipped and published, so
+    // that an exception thrown while copying a value does not stall the
+    // consumers.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    // DATA
+    MpmcRingBuffer<TYPE> *d_queue_p;   // proctored queue
+    Int64                 d_position;  // first position not yet published
+    Int64                 d_end;       // one past the last claimed position
+
+  private:
+    // NOT IMPLEMENTED
+    MpmcRingBuffer_PushProctor(const MpmcRingBuffer_PushProctor&);
+    MpmcRingBuffer_PushProctor& operator=(const MpmcRingBuffer_PushProctor&);
+
+  public:
+    // CREATORS
+    MpmcRingBuffer_PushProctor(MpmcRingBuffer<TYPE> *queue,
+                               Int64                 position,
+                               Int64                 count);
+        // Create a proctor for the specified 'count' claimed positions of the
+        // specified 'queue', starting at the specified 'position'.
+
+    ~MpmcRingBuffer_PushProctor();
+        // Mark each claimed position not yet published as skipped, publish
+        // it, and destroy this proctor.
+
+    // MANIPULATORS
+    void publish();
+        // Publish the next claimed position, whose value has been
+        // constructed.
+};
+
+                      // ===============================
+                      // class MpmcRingBuffer_PopProctor
+                      // ===============================
+
+template <class TYPE>
+class MpmcRingBuffer_PopProctor {
+    // PRIVATE CLASS.  For use only by 'MpmcRingBuffer'.  This class provides
+    // a proctor for a range of claimed pop positions: upon destruction, the
+    // value at each position not yet released is destroyed (unless skipped)
+    // and its slot is released, so that an exception thrown while assigning a
+    // value does not leak the slot.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    // DATA
+    MpmcRingBuffer<TYPE> *d_queue_p;   // proctored queue
+    Int64                 d_position;  // first position not yet released
+    Int64                 d_end;       // one past the last claimed position
+
+  private:
+    // NOT IMPLEMENTED
+    MpmcRingBuffer_PopProctor(const MpmcRingBuffer_PopProctor&);
+    MpmcRingBuffer_PopProctor& operator=(const MpmcRingBuffer_PopProctor&);
+
+  public:
+    // CREATORS
+    MpmcRingBuffer_PopProctor(MpmcRingBuffer<TYPE> *queue,
+                              Int64                 position,
+                              Int64                 count);
+        // Create a proctor for the specified 'count' claimed positions of the
+        // specified 'queue', starting at the specified 'position'.
+
+    ~MpmcRingBuffer_PopProctor();
+        // Release each claimed position not yet released, and destroy this
+        // proctor.
+
+    // MANIPULATORS
+    void release();
+        // Destroy the value at the next claimed position (unless it is
+        // skipped) and release its slot.
+
+    // ACCESSORS
+    bool isSkipped() const;
+        // Return 'true' if the next claimed position holds no value, and
+        // 'false' otherwise.
+
+    TYPE& value() const;
+        // Return a reference to the value at the next claimed position.  The
+        // behavior is undefined if 'isSkipped()'.
+};
+
+// ============================================================================
+//                      TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class MpmcRingBuffer
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+typename MpmcRingBuffer<TYPE>::Int64
+MpmcRingBuffer<TYPE>::claim(bsls::AtomicInt64 *index,
+                            Int64              readyOffset,
+                            Int64              maxCount,
+                            Int64             *count)
+{
+    BSLS_ASSERT(0 < maxCount);
+
+    Int64 position = index->loadRelaxed();
+    while (true) {
+        const Int64 diff = slot(position).d_sequence.loadAcquire()
+                         - (position + readyOffset);
+        if (0 == diff) {
+            // The first slot is ready; extend the claim over the following
+            // ready slots.  A slot observed to be ready stays ready until its
+            // position is claimed, so a successful compare-and-swap from
+            // 'position' claims all of them.
+
+            Int64 n = 1;
+            while (n < maxCount
+                && slot(position + n).d_sequence.loadAcquire()
+                                             == position + n + readyOffset) {
+                ++n;
+            }
+            const Int64 previous = index->testAndSwapAcqRel(position,
+                                                            position + n);
+            if (previous == position) {
+                *count = n;
+                return position;                                      // RETURN
+            }
+            position = previous;
+        }
+        else if (diff < 0) {
+            // The slot has not been released (or filled) for this lap.
+
+            *count = 0;
+            return position;                                          // RETURN
+        }
+        else {
+            // Another thread claimed 'position'.
+
+            position = index->loadRelaxed();
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+typename MpmcRingBuffer<TYPE>::Slot&
+MpmcRingBuffer<TYPE>::slot(Int64 position) const
+{
+    return d_slots_p[position & d_mask];
+}
+
+// CREATORS
+template <class TYPE>
+MpmcRingBuffer<TYPE>::MpmcRingBuffer(std::size_t       capacity,
+                                     bslma::Allocator *basicAllocator)
+: d_pushIndex(0)
+, d_popIndex(0)
+, d_slots_p(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+
+    Int64 numSlots = 2;
+    while (numSlots < static_cast<Int64>(capacity)) {
+        numSlots *= 2;
+    }
+    d_mask    = numSlots - 1;
+    d_slots_p = static_cast<Slot *>(d_allocator_p->allocate(
+                                  static_cast<std::size_t>(numSlots) *
+                                                                sizeof(Slot)));
+    for (Int64 i = 0; i < numSlots; ++i) {
+        Slot *s = new (d_slots_p + i) Slot;
+        s->d_sequence.storeRelaxed(i);
+        s->d_skip = false;
+    }
+}
+
+template <class TYPE>
+MpmcRingBuffer<TYPE>::~MpmcRingBuffer()
+{
+    const Int64 pushIndex = d_pushIndex.loadAcquire();
+    for (Int64 i = d_popIndex.loadAcquire(); i != pushIndex; ++i) {
+        Slot& s = slot(i);
+        if (!s.d_skip) {
+            bslalg::ScalarDestructionPrimitives::destroy(
+                               reinterpret_cast<TYPE *>(s.d_buffer.buffer()));
+        }
+    }
+    for (Int64 i = 0; i <= d_mask; ++i) {
+        d_slots_p[i].~Slot();
+    }
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+int MpmcRingBuffer<TYPE>::tryPushBack(const TYPE& value)
+{
+    return 1 == tryPushBack(&value, 1) ? 0 : -1;
+}
+
+template <class TYPE>
+std::size_t MpmcRingBuffer<TYPE>::tryPushBack(const TYPE  *values,
+                                              std::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    if (0 == numValues) {
+        return 0;                                                     // RETURN
+    }
+
+    Int64       count;
+    const Int64 position = claim(&d_pushIndex,
+                                 0,
+                                 static_cast<Int64>(numValues),
+                                 &count);
+
+    MpmcRingBuffer_PushProctor<TYPE> proctor(this, position, count);
+    for (Int64 i = 0; i < count; ++i) {
+        TYPE *address = reinterpret_cast<TYPE *>(
+                                       slot(position + i).d_buffer.buffer());
+        bslalg::ScalarPrimitives::copyConstruct(address,
+                                                values[i],
+                                                d_allocator_p);
+        proctor.publish();
+    }
+    return static_cast<std::size_t>(count);
+}
+
+template <class TYPE>
+int MpmcRingBuffer<TYPE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    while (true) {
+        Int64       count;
+        const Int64 position = claim(&d_popIndex, 1, 1, &count);
+        if (0 == count) {
+            return -1;                                                // RETURN
+        }
+
+        MpmcRingBuffer_PopProctor<TYPE> proctor(this, position, 1);
+        if (!proctor.isSkipped()) {
+            *value = proctor.value();
+            proctor.release();
+            return 0;                                                 // RETURN
+        }
+    }
+}
+
+template <class TYPE>
+std::size_t MpmcRingBuffer<TYPE>::tryPopFront(TYPE        *values,
+                                              std::size_t  maxValues)
+{
+    BSLS_ASSERT(values || 0 == maxValues);
+
+    if (0 == maxValues) {
+        return 0;                                                     // RETURN
+    }
+
+    Int64       count;
+    const Int64 position = claim(&d_popIndex,
+                                 1,
+                                 static_cast<Int64>(maxValues),
+                                 &count);
+
+    std::size_t numPopped = 0;
+
+    MpmcRingBuffer_PopProctor<TYPE> proctor(this, position, count);
+    for (Int64 i = 0; i < count; ++i) {
+        if (!proctor.isSkipped()) {
+            values[numPopped] = proctor.value();
+            ++numPopped;
+        }
+        proctor.release();
+    }
+    return numPopped;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+std::size_t MpmcRingBuffer<TYPE>::capacity() const
+{
+    return static_cast<std::size_t>(d_mask + 1);
+}
+
+template <class TYPE>
+inline
+bool MpmcRingBuffer<TYPE>::isEmpty() const
+{
+    return 0 == numElements();
+}
+
+template <class TYPE>
+inline
+bool MpmcRingBuffer<TYPE>::isFull() const
+{
+    return capacity() <= numElements();
+}
+
+template <class TYPE>
+inline
+std::size_t MpmcRingBuffer<TYPE>::numElements() const
+{
+    // Load the pop index first: it never exceeds the push index loaded after
+    // it.
+
+    const Int64 popIndex  = d_popIndex.loadAcquire();
+    const Int64 pushIndex = d_pushIndex.loadAcquire();
+    return static_cast<std::size_t>(pushIndex - popIndex);
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *MpmcRingBuffer<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+                      // --------------------------------
+                      // class MpmcRingBuffer_PushProctor
+                      // --------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+MpmcRingBuffer_PushProctor<TYPE>::MpmcRingBuffer_PushProctor(
+                                                MpmcRingBuffer<TYPE> *queue,
+                                                Int64                 position,
+                                                Int64                 count)
+: d_queue_p(queue)
+, d_position(position)
+, d_end(position + count)
+{
+}
+
+template <class TYPE>
+inline
+MpmcRingBuffer_PushProctor<TYPE>::~MpmcRingBuffer_PushProctor()
+{
+    for (; d_position != d_end; ++d_position) {
+        typename MpmcRingBuffer<TYPE>::Slot& s = d_queue_p->slot(d_position);
+        s.d_skip = true;
+        s.d_sequence.storeRelease(d_position + 1);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void MpmcRingBuffer_PushProctor<TYPE>::publish()
+{
+    BSLS_ASSERT_SAFE(d_position != d_end);
+
+    d_queue_p->slot(d_position).d_sequence.storeRelease(d_position + 1);
+    ++d_position;
+}
+
+                      // -------------------------------
+                      // class MpmcRingBuffer_PopProctor
+                      // -------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+MpmcRingBuffer_PopProctor<TYPE>::MpmcRingBuffer_PopProctor(
+                                                MpmcRingBuffer<TYPE> *queue,
+                                                Int64                 position,
+                                                Int64                 count)
+: d_queue_p(queue)
+, d_position(position)
+, d_end(position + count)
+{
+}
+
+template <class TYPE>
+inline
+MpmcRingBuffer_PopProctor<TYPE>::~MpmcRingBuffer_PopProctor()
+{
+    while (d_position != d_end) {
+        release();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void MpmcRingBuffer_PopProctor<TYPE>::release()
+{
+    BSLS_ASSERT_SAFE(d_position != d_end);
+
+    typename MpmcRingBuffer<TYPE>::Slot& s = d_queue_p->slot(d_position);
+    if (s.d_skip) {
+        s.d_skip = false;
+    }
+    else {
+        bslalg::ScalarDestructionPrimitives::destroy(
+                               reinterpret_cast<TYPE *>(s.d_buffer.buffer()));
+    }
+    s.d_sequence.storeRelease(d_position + d_queue_p->d_mask + 1);
+    ++d_position;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bool MpmcRingBuffer_PopProctor<TYPE>::isSkipped() const
+{
+    BSLS_ASSERT_SAFE(d_position != d_end);
+
+    return d_queue_p->slot(d_position).d_skip;
+}
+
+template <class TYPE>
+inline
+TYPE& MpmcRingBuffer_PopProctor<TYPE>::value() const
+{
+    BSLS_ASSERT_SAFE(d_position != d_end);
+
+    return *reinterpret_cast<TYPE *>(
+                               d_queue_p->slot(d_position).d_buffer.buffer());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
@@ -0,0 +1,1051 @@
+// bslstl_mpmcringbuffer.t.cpp                                        -*-C++-*-
+#include <bslstl_mpmcringbuffer.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+#include <sched.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a bounded, lock-free queue for any number of
+// producer and consumer threads.  The single-threaded behavior (capacity,
+// ordering, full and empty detection, wrap-around, and batch operations) is
+// verified against the expected sequence of values.  Memory allocation and
+// element lifetime are monitored using 'bslma::TestAllocator' and
+// 'bsltf::AllocTestType', and exception neutrality is verified using the
+// 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros.  Finally, groups of producer
+// and consumer threads exchange tagged values, and the consumers verify that
+// every value arrives exactly once, and that the values of each producer
+// arrive in order.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] MpmcRingBuffer(std::size_t, bslma::Allocator *);
+// [ 4] ~MpmcRingBuffer();
+//
+// MANIPULATORS
+// [ 2] int tryPushBack(const TYPE&);
+// [ 3] std::size_t tryPushBack(const TYPE *, std::size_t);
+// [ 2] int tryPopFront(TYPE *);
+// [ 3] std::size_t tryPopFront(TYPE *, std::size_t);
+//
+// ACCESSORS
+// [ 2] std::size_t capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] bool isFull() const;
+// [ 2] std::size_t numElements() const;
+// [ 4] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] EXCEPTION NEUTRALITY
+// [ 6] CONCURRENT PRODUCERS AND CONSUMERS
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: THROUGHPUT
+// [-2] PERFORMANCE TEST: LATENCY
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslstl::MpmcRingBuffer<int>                  Obj;
+typedef bslstl::MpmcRingBuffer<bsltf::AllocTestType> AllocObj;
+typedef bsls::Types::Int64                           Int64;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef void *(*thread_func)(void *arg);
+
+thread_t createThread(thread_func func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+void joinThread(thread_t thr)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+void yieldThread()
+    // Yield the processor to other threads.  Spinning threads yield so that
+    // the tests make progress on machines with fewer processors than threads.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+enum {
+    MAX_PRODUCERS = 8,        // maximum number of producer threads
+    VALUE_LIMIT   = 1 << 24   // values of a producer are in '[0, LIMIT)'
+};
+
+                            // ===================
+                            // struct StressParams
+                            // ===================
+
+struct StressParams {
+    // This 'struct' holds the arguments of 'producerThread' and
+    // 'consumerThread'.  A producer with identifier 'id' pushes the values
+    // 'id * VALUE_LIMIT + i', for 'i' in '[0, d_numValues)', in order.  The
+    // consumers pop until 'd_numTotal' values have been consumed, and each
+    // consumer verifies that the values of each producer arrive in order.
+
+    // DATA
+    Obj             *d_queue_p;        // queue under test
+    int              d_id;             // producer identifier
+    int              d_numValues;      // number of values per producer
+    int              d_batchSize;      // values per operation (1 for single)
+    int              d_numTotal;       // number of values of all producers
+    bsls::AtomicInt *d_numConsumed_p;  // number of values popped so far
+    Int64            d_sum;            // sum of values popped by a consumer
+    int              d_numErrors;      // out-of-order values popped
+};
+
+extern "C" void *producerThread(void *arg)
+    // Push the values of the producer described by the specified 'arg',
+    // which must be the address of a 'StressParams', retrying while the queue
+    // is full.
+{
+    StressParams *params = static_cast<StressParams *>(arg);
+
+    enum { MAX_BATCH = 64 };
+    int batch[MAX_BATCH];
+
+    const int BASE = params->d_id * VALUE_LIMIT;
+
+    int next = 0;
+    while (next < params->d_numValues) {
+        if (1 == params->d_batchSize) {
+            if (0 == params->d_queue_p->tryPushBack(BASE + next)) {
+                ++next;
+                continue;
+            }
+        }
+        else {
+            int n = params->d_numValues - next;
+            if (n > params->d_batchSize) {
+                n = params->d_batchSize;
+            }
+            for (int i = 0; i < n; ++i) {
+                batch[i] = BASE + next + i;
+            }
+            const std::size_t pushed = params->d_queue_p->tryPushBack(
+                                                 batch,
+                                                 static_cast<std::size_t>(n));
+            if (0 != pushed) {
+                next += static_cast<int>(pushed);
+                continue;
+            }
+        }
+        yieldThread();
+    }
+    return 0;
+}
+
+extern "C" void *consumerThread(void *arg)
+    // Pop values from the queue described by the specified 'arg', which must
+    // be the address of a 'StressParams', until the values of all producers
+    // have been consumed, accumulating their sum and the number of values
+    // that arrived out of order.
+{
+    StressParams *params = static_cast<StressParams *>(arg);
+
+    enum { MAX_BATCH = 64 };
+    int batch[MAX_BATCH];
+
+    int last[MAX_PRODUCERS];
+    for (int i = 0; i < MAX_PRODUCERS; ++i) {
+        last[i] = -1;
+    }
+
+    while (*params->d_numConsumed_p < params->d_numTotal) {
+        std::size_t popped;
+        if (1 == params->d_batchSize) {
+            popped = 0 == params->d_queue_p->tryPopFront(batch) ? 1 : 0;
+        }
+        else {
+            popped = params->d_queue_p->tryPopFront(
+                               batch,
+                               static_cast<std::size_t>(params->d_batchSize));
+        }
+        if (0 == popped) {
+            yieldThread();
+            continue;
+        }
+        for (std::size_t i = 0; i < popped; ++i) {
+            const int id       = batch[i] / VALUE_LIMIT;
+            const int sequence = batch[i] % VALUE_LIMIT;
+            if (id < 0 || id >= MAX_PRODUCERS || sequence <= last[id]) {
+                ++params->d_numErrors;
+            }
+            else {
+                last[id] = sequence;
+            }
+            params->d_sum += batch[i];
+        }
+        params->d_numConsumed_p->add(static_cast<int>(popped));
+    }
+    return 0;
+}
+
+                            // ===================
+                            // struct StressResult
+                            // ===================
+
+struct StressResult {
+    // This 'struct' holds the outcome of a run of 'runStress'.
+
+    // DATA
+    double d_seconds;    // elapsed time
+    int    d_numErrors;  // out-of-order, missing, or extra values
+};
+
+StressResult runStress(Obj *queue,
+                       int  numProducers,
+                       int  numConsumers,
+                       int  numValues,
+                       int  batchSize)
+    // Run the specified 'numProducers' producer threads, each pushing the
+    // specified 'numValues' values to the specified 'queue', and the
+    // specified 'numConsumers' consumer threads popping them, using
+    // operations on at most the specified 'batchSize' values, and return the
+    // elapsed time and the number of errors detected.  The behavior is
+    // undefined unless '0 < numProducers <= MAX_PRODUCERS',
+    // '0 < numConsumers <= MAX_PRODUCERS', '0 < numValues < VALUE_LIMIT', and
+    // '0 < batchSize <= 64'.
+{
+    bsls::AtomicInt numConsumed(0);
+
+    StressParams producers[MAX_PRODUCERS];
+    StressParams consumers[MAX_PRODUCERS];
+    thread_t     threads[2 * MAX_PRODUCERS];
+
+    Int64 expectedSum = 0;
+    for (int i = 0; i < numProducers; ++i) {
+        const StressParams params = { queue,
+                                      i,
+                                      numValues,
+                                      batchSize,
+                                      numProducers * numValues,
+                                      &numConsumed,
+                                      0,
+                                      0 };
+        producers[i] = params;
+        for (int j = 0; j < numValues; ++j) {
+            expectedSum += i * VALUE_LIMIT + j;
+        }
+    }
+    for (int i = 0; i < numConsumers; ++i) {
+        consumers[i] = producers[0];
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numConsumers; ++i) {
+        threads[i] = createThread(&consumerThread, &consumers[i]);
+    }
+    for (int i = 0; i < numProducers; ++i) {
+        threads[numConsumers + i] = createThread(&producerThread,
+                                                 &producers[i]);
+    }
+    for (int i = 0; i < numConsumers + numProducers; ++i) {
+        joinThread(threads[i]);
+    }
+    timer.stop();
+
+    StressResult result;
+    result.d_seconds   = timer.elapsedTime();
+    result.d_numErrors = 0;
+
+    Int64 sum = 0;
+    for (int i = 0; i < numConsumers; ++i) {
+        result.d_numErrors += consumers[i].d_numErrors;
+        sum                += consumers[i].d_sum;
+    }
+    if (sum != expectedSum || numConsumed != numProducers * numValues) {
+        ++result.d_numErrors;
+    }
+    if (!queue->isEmpty()) {
+        ++result.d_numErrors;
+    }
+    return result;
+}
+
+                             // =================
+                             // struct EchoParams
+                             // =================
+
+struct EchoParams {
+    // This 'struct' holds the arguments of 'echoThread'.
+
+    Obj *d_ping_p;       // queue to pop from
+    Obj *d_pong_p;       // queue to push to
+    int  d_numValues;    // number of values to echo
+};
+
+extern "C" void *echoThread(void *arg)
+    // Pop 'd_numValues' values from 'd_ping_p' and push each of them back
+    // onto 'd_pong_p', spinning while the queues are empty or full, where
+    // 'd_ping_p', 'd_pong_p', and 'd_numValues' are the members of the
+    // 'EchoParams' object at the specified 'arg'.
+{
+    EchoParams *params = static_cast<EchoParams *>(arg);
+
+    for (int i = 0; i < params->d_numValues; ++i) {
+        int value;
+        while (0 != params->d_ping_p->tryPopFront(&value)) {
+            yieldThread();
+        }
+        while (0 != params->d_pong_p->tryPushBack(value)) {
+            yieldThread();
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        //Example 1: A Shared Work Queue
+        // - - - - - - - - - - - - - - -
+        bslma::TestAllocator        allocator;
+        bslstl::MpmcRingBuffer<int> queue(256, &allocator);
+        ASSERT(256 == queue.capacity());
+
+        const int tasks[] = { 1, 2, 3, 4 };
+        ASSERT(1 == queue.tryPushBack(tasks, 1));
+        ASSERT(3 == queue.tryPushBack(tasks + 1, 3));
+
+        int task;
+        int sum = 0;
+        while (0 == queue.tryPopFront(&task)) {
+            sum += task;
+        }
+        ASSERT(10 == sum);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PRODUCERS AND CONSUMERS
+        //
+        // Concerns:
+        //: 1 Every value pushed by a producer thread is popped by exactly one
+        //:   consumer thread.
+        //:
+        //: 2 Each consumer pops the values of a given producer in the order
+        //:   in which they were pushed.
+        //:
+        //: 3 Single and batch operations are safe under contention, including
+        //:   when the queue is frequently full or empty.
+        //:
+        //: 4 The queue is empty once every value has been consumed.
+        //
+        // Plan:
+        //: 1 For several combinations of capacity, number of producer and
+        //:   consumer threads, and batch size, run the threads to completion
+        //:   and verify the number, the sum, and the per-producer order of
+        //:   the values popped.  (C-1..4)
+        //
+        // Testing:
+        //   CONCURRENT PRODUCERS AND CONSUMERS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT PRODUCERS AND CONSUMERS"
+                            "\n==================================\n");
+
+        static const struct {
+            int d_line;
+            int d_capacity;
+            int d_numProducers;
+            int d_numConsumers;
+            int d_batchSize;
+        } DATA[] = {
+            //LINE  CAP  PROD  CONS  BATCH
+            //----  ---  ----  ----  -----
+            { L_,     2,    1,    1,     1 },
+            { L_,     2,    2,    2,     1 },
+            { L_,     2,    3,    1,     2 },
+            { L_,    16,    1,    4,     1 },
+            { L_,    16,    4,    1,     5 },
+            { L_,    16,    4,    4,     7 },
+            { L_,   256,    8,    8,     1 },
+            { L_,   256,    8,    8,    64 },
+            { L_,  1024,    3,    5,    13 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const int NUM_VALUES = 50000;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE  = DATA[ti].d_line;
+            const int CAP   = DATA[ti].d_capacity;
+            const int PROD  = DATA[ti].d_numProducers;
+            const int CONS  = DATA[ti].d_numConsumers;
+            const int BATCH = DATA[ti].d_batchSize;
+
+            if (veryVerbose) { T_ P_(LINE) P_(CAP) P_(PROD) P_(CONS) P(BATCH) }
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            Obj                  mX(CAP, &oa);
+
+            const StressResult R = runStress(&mX,
+                                             PROD,
+                                             CONS,
+                                             NUM_VALUES,
+                                             BATCH);
+
+            ASSERTV(LINE, R.d_numErrors, 0 == R.d_numErrors);
+            ASSERTV(LINE, mX.isEmpty());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 If copying a value into the queue throws, the exception
+        //:   propagates and the value is not pushed.
+        //:
+        //: 2 If copying the 'k'th value of a batch throws, the preceding
+        //:   values of the batch remain pushed.
+        //:
+        //: 3 The slots claimed by a push that threw are skipped by subsequent
+        //:   pops, and reused by subsequent pushes.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, push
+        //:   single values and batches of 'bsltf::AllocTestType', whose copy
+        //:   constructor allocates, and verify after each attempt that pops
+        //:   return exactly the values whose copy succeeded.  (C-1..4)
+        //
+        // Testing:
+        //   EXCEPTION NEUTRALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION NEUTRALITY"
+                            "\n====================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+        bsltf::AllocTestType VALUES[8] = {
+            bsltf::AllocTestType(0, &sa), bsltf::AllocTestType(1, &sa),
+            bsltf::AllocTestType(2, &sa), bsltf::AllocTestType(3, &sa),
+            bsltf::AllocTestType(4, &sa), bsltf::AllocTestType(5, &sa),
+            bsltf::AllocTestType(6, &sa), bsltf::AllocTestType(7, &sa),
+        };
+
+        if (verbose) printf("\tSingle push.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            AllocObj             mX(2, &oa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                // A slot left empty by a failed push is skipped.
+
+                bsltf::AllocTestType value(&sa);
+                ASSERT(0 != mX.tryPopFront(&value));
+                ASSERT(mX.isEmpty());
+                ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+                ASSERT(0 == mX.tryPushBack(VALUES[1]));
+                ASSERT(1 == mX.numElements());
+
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(VALUES[1] == value);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(mX.isEmpty());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tBatch push.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            AllocObj             mX(8, &oa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                // Empty the queue, keeping the values that were pushed before
+                // the exception, if any, and verify them.
+
+                bsltf::AllocTestType values[8];
+                const std::size_t N = mX.tryPopFront(values, 8);
+                for (std::size_t i = 0; i < N; ++i) {
+                    ASSERTV(i, VALUES[i] == values[i]);
+                }
+                ASSERT(mX.isEmpty());
+                ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+                ASSERT(8 == mX.tryPushBack(VALUES, 8));
+                ASSERT(8 == mX.tryPopFront(values, 8));
+                for (std::size_t i = 0; i < 8; ++i) {
+                    ASSERTV(i, VALUES[i] == values[i]);
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(mX.isEmpty());
+        }
+#else
+        if (verbose) printf("\tExceptions disabled; skipping.\n");
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ALLOCATOR AND ELEMENT LIFETIME
+        //
+        // Concerns:
+        //: 1 The slot array is allocated once, at construction, from the
+        //:   supplied allocator (or the default allocator), and released at
+        //:   destruction.
+        //:
+        //: 2 Values held by the queue use the queue's allocator.
+        //:
+        //: 3 Popping a value destroys the copy held by the queue.
+        //:
+        //: 4 Destroying a non-empty queue destroys the values it holds.
+        //:
+        //: 5 'allocator' returns the allocator used by the queue.
+        //
+        // Plan:
+        //: 1 Create queues of 'bsltf::AllocTestType' with and without an
+        //:   allocator, push and pop values, and monitor the number of blocks
+        //:   in use in the object and default allocators.  (C-1..5)
+        //
+        // Testing:
+        //   ~MpmcRingBuffer();
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATOR AND ELEMENT LIFETIME"
+                            "\n==============================\n");
+
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        {
+            Obj mX(8);
+            ASSERT(&defaultAllocator == mX.allocator());
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            AllocObj mX(4, &oa);
+            ASSERT(&oa == mX.allocator());
+            ASSERT(1 == oa.numBlocksInUse());
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            const bsltf::AllocTestType V0(0, &sa), V1(1, &sa), V2(2, &sa);
+
+            ASSERT(0 == mX.tryPushBack(V0));
+            ASSERT(0 == mX.tryPushBack(V1));
+            ASSERT(3 == oa.numBlocksInUse());
+
+            bsltf::AllocTestType value(&sa);
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(V0 == value);
+            ASSERT(2 == oa.numBlocksInUse());
+
+            ASSERT(0 == mX.tryPushBack(V2));
+            ASSERT(3 == oa.numBlocksInUse());
+            ASSERT(NUM_ALLOCATIONS + 3 == oa.numAllocations());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 A batch push appends as many leading values as fit, in order,
+        //:   and returns their number.
+        //:
+        //: 2 A batch pop removes up to the requested number of values, in
+        //:   order, and returns their number.
+        //:
+        //: 3 Batches that wrap around the end of the slot array are handled.
+        //:
+        //: 4 Empty batches have no effect.
+        //
+        // Plan:
+        //: 1 For every capacity in a small range and every starting offset,
+        //:   push and pop batches of varying sizes, and compare the values and
+        //:   counts against those expected.  (C-1..4)
+        //
+        // Testing:
+        //   std::size_t tryPushBack(const TYPE *, std::size_t);
+        //   std::size_t tryPopFront(TYPE *, std::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBATCH OPERATIONS"
+                            "\n================\n");
+
+        int values[40];
+        for (int i = 0; i < 40; ++i) {
+            values[i] = i + 100;
+        }
+
+        for (std::size_t cap = 2; cap <= 16; cap *= 2) {
+            for (std::size_t offset = 0; offset < cap; ++offset) {
+                for (std::size_t n = 0; n <= cap + 2; ++n) {
+                    Obj mX(cap);  const Obj& X = mX;
+
+                    // Move the indices 'offset' positions into the array.
+
+                    for (std::size_t i = 0; i < offset; ++i) {
+                        int value;
+                        ASSERT(0 == mX.tryPushBack(0));
+                        ASSERT(0 == mX.tryPopFront(&value));
+                    }
+
+                    const std::size_t EXP = n < cap ? n : cap;
+
+                    ASSERTV(cap, offset, n, EXP == mX.tryPushBack(values, n));
+                    ASSERTV(cap, offset, n, EXP == X.numElements());
+                    ASSERT(0 == mX.tryPushBack(values, 0));
+
+                    int result[40];
+                    ASSERT(0 == mX.tryPopFront(result, 0));
+
+                    // Pop in two halves.
+
+                    const std::size_t HALF = EXP / 2;
+                    ASSERTV(cap, offset, n,
+                            HALF == mX.tryPopFront(result, HALF));
+                    ASSERTV(cap, offset, n,
+                            EXP - HALF == mX.tryPopFront(result + HALF, 40));
+                    for (std::size_t i = 0; i < EXP; ++i) {
+                        ASSERTV(cap, offset, n, i, values[i] == result[i]);
+                    }
+                    ASSERTV(cap, offset, n, X.isEmpty());
+                    ASSERT(0 == mX.tryPopFront(result, 40));
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two, and is at least 2.
+        //:
+        //: 2 Values are popped in the order in which they were pushed.
+        //:
+        //: 3 Pushing to a full queue and popping from an empty queue fail and
+        //:   have no effect.
+        //:
+        //: 4 'isEmpty', 'isFull', and 'numElements' reflect the state of the
+        //:   queue.
+        //:
+        //: 5 The queue operates correctly over many laps of the slot array.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create queues of various capacities and verify 'capacity'.
+        //:   (C-1)
+        //:
+        //: 2 Repeatedly fill and drain queues, over several laps, verifying
+        //:   values, return codes, and accessors at each step.  (C-2..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   MpmcRingBuffer(std::size_t, bslma::Allocator *);
+        //   int tryPushBack(const TYPE&);
+        //   int tryPopFront(TYPE *);
+        //   std::size_t capacity() const;
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   std::size_t numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        if (verbose) printf("\tCapacity.\n");
+        {
+            static const struct {
+                int         d_line;
+                std::size_t d_requested;
+                std::size_t d_expected;
+            } DATA[] = {
+                //LINE  REQUESTED  EXPECTED
+                //----  ---------  --------
+                { L_,           1,        2 },
+                { L_,           2,        2 },
+                { L_,           3,        4 },
+                { L_,           4,        4 },
+                { L_,           5,        8 },
+                { L_,         100,      128 },
+                { L_,        1024,     1024 },
+                { L_,        1025,     2048 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const std::size_t EXP  = DATA[ti].d_expected;
+
+                const Obj X(DATA[ti].d_requested);
+                ASSERTV(LINE, EXP == X.capacity());
+                ASSERTV(LINE, X.isEmpty());
+                ASSERTV(LINE, !X.isFull());
+                ASSERTV(LINE, 0 == X.numElements());
+            }
+        }
+
+        if (verbose) printf("\tFill and drain.\n");
+        for (std::size_t cap = 2; cap <= 32; cap *= 2) {
+            Obj mX(cap);  const Obj& X = mX;
+
+            int pushed = 0;
+            int popped = 0;
+            for (int lap = 0; lap < 5; ++lap) {
+                // Fill to a varying level, then drain.
+
+                const std::size_t LEVEL = lap % 2 ? cap : (cap + 1) / 2;
+
+                for (std::size_t i = 0; i < LEVEL; ++i) {
+                    ASSERTV(cap, lap, i, i == X.numElements());
+                    ASSERTV(cap, lap, i, 0 == mX.tryPushBack(pushed));
+                    ++pushed;
+                }
+                ASSERTV(cap, lap, (LEVEL == cap) == X.isFull());
+                if (LEVEL == cap) {
+                    ASSERTV(cap, lap, 0 != mX.tryPushBack(-1));
+                    ASSERTV(cap, lap, cap == X.numElements());
+                }
+                for (std::size_t i = 0; i < LEVEL; ++i) {
+                    int value = -1;
+                    ASSERTV(cap, lap, i, 0 == mX.tryPopFront(&value));
+                    ASSERTV(cap, lap, i, popped == value);
+                    ++popped;
+                }
+                ASSERTV(cap, lap, X.isEmpty());
+
+                int value = -1;
+                ASSERTV(cap, lap, 0 != mX.tryPopFront(&value));
+                ASSERTV(cap, lap, -1 == value);
+            }
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj(0));
+            ASSERT_PASS(Obj(1));
+
+            Obj mX(4);
+            ASSERT_FAIL(mX.tryPopFront(0));
+            ASSERT_FAIL(mX.tryPushBack(0, 1));
+            ASSERT_PASS(mX.tryPushBack(0, 0));
+            ASSERT_FAIL(mX.tryPopFront(0, 1));
+            ASSERT_PASS(mX.tryPopFront(0, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a queue, push and pop a few values, and verify the
+        //:   results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(3, &oa);  const Obj& X = mX;
+        ASSERT(4 == X.capacity());
+        ASSERT(X.isEmpty());
+
+        ASSERT(0 == mX.tryPushBack(1));
+        ASSERT(0 == mX.tryPushBack(2));
+        ASSERT(2 == X.numElements());
+
+        int value;
+        ASSERT(0 == mX.tryPopFront(&value));
+        ASSERT(1 == value);
+        ASSERT(0 == mX.tryPopFront(&value));
+        ASSERT(2 == value);
+        ASSERT(0 != mX.tryPopFront(&value));
+        ASSERT(X.isEmpty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the rate at which values pass through the queue as the
+        //:   number of producer and consumer threads grows, with single and
+        //:   batch operations.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 producers, each paired with as many
+        //:   consumers, and for several batch sizes, time the transfer of a
+        //:   fixed number of values through a queue of capacity 1024, and
+        //:   print the time per value.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: THROUGHPUT"
+                            "\n============================\n");
+
+        const int NUM_VALUES  = 4000000;
+        const int THREADS[]   = { 1, 2, 4, 8 };
+        const int NUM_THREADS = static_cast<int>(sizeof THREADS
+                                                 / sizeof *THREADS);
+        const int BATCHES[]   = { 1, 16 };
+        const int NUM_BATCHES = static_cast<int>(sizeof BATCHES
+                                                 / sizeof *BATCHES);
+
+        printf("%8s %8s %12s %12s\n", "threads", "batch", "ns/value",
+                                                                "Mvalues/s");
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int N = THREADS[ti];
+            for (int bi = 0; bi < NUM_BATCHES; ++bi) {
+                Obj mX(1024);
+
+                const StressResult R = runStress(&mX,
+                                                 N,
+                                                 N,
+                                                 NUM_VALUES / N,
+                                                 BATCHES[bi]);
+                ASSERTV(N, R.d_numErrors, 0 == R.d_numErrors);
+
+                char name[16];
+                sprintf(name, "%dP%dC", N, N);
+                printf("%8s %8d %12.2f %12.2f\n",
+                       name,
+                       BATCHES[bi],
+                       R.d_seconds * 1e9 / NUM_VALUES,
+                       NUM_VALUES / R.d_seconds / 1e6);
+            }
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: LATENCY
+        //
+        // Concerns:
+        //: 1 Report the time for a value to pass from one thread to another.
+        //
+        // Plan:
+        //: 1 Bounce a value back and forth between the main thread and an
+        //:   echo thread through a pair of queues, and print half of the mean
+        //:   round-trip time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: LATENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: LATENCY"
+                            "\n=========================\n");
+
+        const int NUM_ROUND_TRIPS = 200000;
+
+        Obj ping(64);
+        Obj pong(64);
+
+        EchoParams params = { &ping, &pong, NUM_ROUND_TRIPS };
+        thread_t   echo   = createThread(&echoThread, &params);
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < NUM_ROUND_TRIPS; ++i) {
+            while (0 != ping.tryPushBack(i)) {
+                yieldThread();
+            }
+            int value;
+            while (0 != pong.tryPopFront(&value)) {
+                yieldThread();
+            }
+            ASSERTV(i, value, i == value);
+        }
+        timer.stop();
+        joinThread(echo);
+
+        printf("one-way latency: %.1f ns\n",
+               timer.elapsedTime() * 1e9 / NUM_ROUND_TRIPS / 2);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
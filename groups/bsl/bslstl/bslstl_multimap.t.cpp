@@ -123,6 +123,8 @@ using namespace bsl;
 // [15] bsl::pair<iterator, bool> insert(const value_type& value);
 // [16] iterator insert(const_iterator position, const value_type& value);
 // [17] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [26] iterator emplace(ARGS&&... args);
+// [26] iterator emplace_hint(const_iterator hint, ARGS&&... args);
 //
 // [18] iterator erase(const_iterator position);
 // [18] size_type erase(const key_type& key);
@@ -157,7 +159,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [25] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multimap<T,A> *object, const char *spec, int verbose = 1);
@@ -340,16 +342,6 @@ void debugprint(const bsl::multimap<KEY, VALUE, COMP, ALLOC>& s)
 
 namespace {
 
-bool expectToAllocate(int n)
-    // Return 'true' if the container is expected to allocate memory on the
-    // specified 'n'th element, and 'false' otherwise.
-{
-    if (n > 32) {
-        return (0 == n % 32);                                         // RETURN
-    }
-    return (((n - 1) & n) == 0);  // Allocate when 'n' is a power of 2
-}
-
 template<class CONTAINER, class VALUES>
 int verifyContainer(const CONTAINER&  container,
                     const VALUES&     expectedValues,
@@ -926,6 +918,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase26();
+        // Test 'emplace' and 'emplace_hint'.
+
     static void testCase25();
         // Test standard interface coverage.
 
@@ -1072,6 +1067,168 @@ bsl::multimap<KEY, VALUE, COMP, ALLOC> TestDriver<KEY, VALUE, COMP, ALLOC>::g(
 }
 
 
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase26()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace' AND 'emplace_hint'
+    //
+    // Concerns:
+    //: 1 Each method inserts a new element, constructed from the supplied
+    //:   arguments, after any existing elements having the same key, and the
+    //:   order of the container remains correct.
+    //:
+    //: 2 The iterator returned refers to the newly inserted element.
+    //:
+    //: 3 Any memory allocated by the container, or by the newly inserted
+    //:   element, is drawn from the object allocator.
+    //:
+    //: 4 Each method is exception neutral w.r.t. memory allocation.
+    //
+    // Plan:
+    //: 1 For each method, and for a sequence of values having both unique
+    //:   and duplicate keys, insert each value into an initially empty object
+    //:   by passing its key and mapped value as separate arguments.
+    //:
+    //:   1 Verify the return value and the resulting value of the object.
+    //:     (C-1..2)
+    //:
+    //:   2 Compute the number of allocations from the object allocator and
+    //:     verify it is as expected.  (C-3)
+    //:
+    //: 2 Repeat P-1 under the presence of exceptions.  (C-4)
+    //
+    // Testing:
+    //   iterator emplace(ARGS&&... args);
+    //   iterator emplace_hint(const_iterator hint, ARGS&&... args);
+    // ------------------------------------------------------------------------
+
+    const int TYPE_ALLOC = (bslma::UsesBslmaAllocator<KEY>::value +
+                            bslma::UsesBslmaAllocator<VALUE>::value);
+
+    if (verbose)
+        printf("\nTesting parameters: TYPE_ALLOC = %d.\n", TYPE_ALLOC);
+
+    static const struct {
+        int         d_line;    // source line number
+        const char *d_spec;    // specification string
+        const char *d_unique;  // expected element values
+    } DATA[] = {
+        //line  spec           isUnique
+        //----  ----           --------
+
+        { L_,   "A",           "Y"           },
+        { L_,   "AAA",         "YNN"         },
+        { L_,   "ABCDEFGH",    "YYYYYYYY"    },
+        { L_,   "ABCDEABCDEF", "YYYYYNNNNNY" },
+        { L_,   "EEDDCCBBAA",  "YNYNYNYNYN"  }
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    const int MAX_LENGTH = 20;
+
+    if (verbose) printf("\nTesting without exceptions.\n");
+    for (int useHint = 0; useHint < 2; ++useHint) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            if (veryVerbose) { P_(useHint) P_(LINE) P_(SPEC) P(UNIQUE); }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                EXPECTED[SIZE] = SPEC[tj];
+                std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                EXPECTED[SIZE + 1] = '\0';
+
+                const KEY&   K = VALUES[tj].first;
+                const VALUE& V = VALUES[tj].second;
+
+                const bsls::Types::Int64 BB = oa.numBlocksTotal();
+                const bsls::Types::Int64 B  = oa.numBlocksInUse();
+
+                Iter RESULT = useHint ? mX.emplace_hint(X.end(), K, V)
+                                      : mX.emplace(K, V);
+
+                ASSERTV(useHint, LINE, tj, VALUES[tj] == *RESULT);
+
+                Iter AFTER = RESULT;  ++AFTER;
+                ASSERTV(useHint, LINE, tj, AFTER == X.upper_bound(K));
+
+                const bsls::Types::Int64 AA = oa.numBlocksTotal();
+                const bsls::Types::Int64 A  = oa.numBlocksInUse();
+
+                ASSERTV(useHint, LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                ASSERTV(useHint, LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
+                ASSERTV(useHint, LINE, tj, SIZE + 1 == X.size());
+
+                TestValues exp(EXPECTED);
+                ASSERTV(useHint, LINE, tj,
+                        0 == verifyContainer(X, exp, SIZE + 1));
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting with injected exceptions.\n");
+    for (int useHint = 0; useHint < 2; ++useHint) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                EXPECTED[SIZE] = SPEC[tj];
+                std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                EXPECTED[SIZE + 1] = '\0';
+
+                const KEY&   K = VALUES[tj].first;
+                const VALUE& V = VALUES[tj].second;
+
+                bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ExceptionGuard<Obj> guard(&X, L_, &scratch);
+
+                    if (useHint) {
+                        mX.emplace_hint(X.end(), K, V);
+                    }
+                    else {
+                        mX.emplace(K, V);
+                    }
+
+                    guard.release();
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                TestValues exp(EXPECTED);
+                ASSERTV(useHint, LINE, tj,
+                        0 == verifyContainer(X, exp, SIZE + 1));
+            }
+        }
+    }
+}
+
 template <class KEY, class VALUE, class COMP, class ALLOC>
 void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase25()
 {
@@ -2564,17 +2721,8 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase16()
                     }
 
 
-                    if(expectToAllocate(SIZE + 1)) {
-                        ASSERTV(LINE, tj, AA, BB,
-                                BB + 1 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B,
-                                B + 1 + TYPE_ALLOC == A);
-                    }
-                    else {
-                        ASSERTV(LINE, tj, AA, BB,
-                                BB + 0 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                    }
+                    ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                     ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                     TestValues exp(EXPECTED);
@@ -2665,14 +2813,8 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase16()
                     ASSERTV(LINE, CONFIG, tj, SIZE,
                             VALUES[tj] == *RESULT);
 
-                    if(expectToAllocate(SIZE + 1)) {
-                        ASSERTV(LINE, tj, AA, BB,
-                                BB + 1 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                    }
-                    else {
-                        ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                    }
+                    ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                     ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                     TestValues exp(EXPECTED);
@@ -2806,12 +2948,7 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase15()
 
                 const bsls::Types::Int64 A  = oa.numBlocksInUse();
 
-                if(expectToAllocate(SIZE + 1)) {
-                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                }
-                else {
-                    ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                }
+                ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                 ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                 TestValues exp(EXPECTED);
@@ -4729,9 +4866,10 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase7()
                     ASSERTV(SPEC,  B + 0 ==  A);
                 }
                 else {
-                    const int TYPE_ALLOCS = TYPE_ALLOC * X.size();
-                    ASSERTV(SPEC, BB + 1 + TYPE_ALLOCS == AA);
-                    ASSERTV(SPEC,  B + 1 + TYPE_ALLOCS ==  A);
+                    const int NUM_NODES   = static_cast<int>(X.size());
+                    const int TYPE_ALLOCS = TYPE_ALLOC * NUM_NODES;
+                    ASSERTV(SPEC, BB + NUM_NODES + TYPE_ALLOCS == AA);
+                    ASSERTV(SPEC,  B + NUM_NODES + TYPE_ALLOCS ==  A);
                 }
 
                 const bsls::Types::Int64 CC = oa.numBlocksTotal();
@@ -5505,14 +5643,8 @@ void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase2()
                     bslma::TestAllocatorMonitor tam(&oa);
                     Iter RESULT = mX.insert(VALUES[LENGTH - 1]);
 
-                    if (0 < TYPE_ALLOC || expectToAllocate(LENGTH)) {
-                        ASSERTV(CONFIG, tam.isTotalUp());
-                        ASSERTV(CONFIG, tam.isInUseUp());
-                    }
-                    else {
-                        ASSERTV(CONFIG, tam.isTotalSame());
-                        ASSERTV(CONFIG, tam.isInUseSame());
-                    }
+                    ASSERTV(CONFIG, tam.isTotalUp());
+                    ASSERTV(CONFIG, tam.isInUseUp());
 
                     ASSERTV(LENGTH, CONFIG, VALUES[LENGTH - 1] == *RESULT);
 
@@ -6513,7 +6645,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6587,6 +6719,15 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
 
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'emplace' AND 'emplace_hint'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase26,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+
       } break;
       case 25: {
         // --------------------------------------------------------------------
@@ -31,10 +31,12 @@ BSLS_IDENT("$Id: $")
 // A multiset meets the requirements of an associative container with
 // bidirectional iterators in the C++ standard [23.2.4].  The 'multiset'
 // implemented here adheres to the C++11 standard, except that it does not have
-// interfaces that take rvalue references, 'initializer_lists', 'emplace', or
-// operations taking a variadic number of template parameters.  Note that
+// interfaces that take rvalue references or 'initializer_lists'.  Note that
 // excluded C++11 features are those that require (or are greatly simplified
-// by) C++11 compiler support.
+// by) C++11 compiler support.  The 'emplace' and 'emplace_hint' methods
+// construct elements in place from a variadic list of arguments, which is
+// limited to five arguments on compilers that do not support variadic
+// templates.
 //
 ///Requirements on 'KEY'
 ///---------------------
@@ -463,6 +465,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -566,6 +572,25 @@ class multiset {
         // Return a reference providing modifiable access to the
         // node-allocator for this tree.
 
+    BloombergLP::bslalg::RbTreeNode *insertNode(
+                                        BloombergLP::bslalg::RbTreeNode *node);
+        // Insert the specified 'node' into this multiset after the last
+        // element (if any) having the same key as the value of 'node', and
+        // return 'node'.  This multiset takes ownership of 'node' whether or
+        // not an exception is thrown.  The behavior is undefined unless 'node'
+        // was created by 'nodeFactory()'.
+
+    BloombergLP::bslalg::RbTreeNode *insertNode(
+                                  const BloombergLP::bslalg::RbTreeNode *hint,
+                                  BloombergLP::bslalg::RbTreeNode       *node);
+        // Insert the specified 'node' into this multiset (in amortized
+        // constant time if the specified 'hint' is a valid immediate successor
+        // to the key of the value of 'node'), and return 'node'.  This
+        // multiset takes ownership of 'node' whether or not an exception is
+        // thrown.  The behavior is undefined unless 'node' was created by
+        // 'nodeFactory()' and 'hint' refers to a node in this multiset or is
+        // its end node.
+
     Comparator& comparator();
         // Return a reference providing modifiable access to the
         // comparator for this tree.
@@ -736,6 +761,124 @@ class multiset {
         // requires that the (template parameter) type 'KEY' be
         // "copy-constructible" (see {Requirements on 'KEY'}).
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    iterator emplace(ARGS&&... args);
+        // Insert into this multiset a newly created 'value_type' object,
+        // constructed in place from the specified 'args', after the last
+        // element (if any) having the same key, and return an iterator
+        // referring to the new element.  Note that the object is built
+        // directly in its node, so no temporary 'value_type' is copied.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_multiset.h
+    iterator emplace();
+
+    template <class ARGS_1>
+    iterator emplace(BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    iterator emplace(BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    iterator emplace(BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    iterator emplace(BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    iterator emplace(BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    iterator emplace(BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          ARGS&&... args);
+        // Insert into this multiset a newly created 'value_type' object,
+        // constructed in place from the specified 'args' (in amortized
+        // constant time if the specified 'hint' is a valid immediate successor
+        // to its key), and return an iterator referring to the new element.
+        // The behavior is undefined unless 'hint' is a valid iterator into
+        // this multiset.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_multiset.h
+    iterator emplace_hint(const_iterator hint);
+
+    template <class ARGS_1>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     iterator erase(const_iterator position);
         // Remove from this set the 'value_type' object at the specified
         // 'position', and return an iterator referring to the element
@@ -942,10 +1085,6 @@ class multiset {
 
     // multiset& operator=(initializer_list<value_type>);
 
-    // template <class... Args> iterator emplace(Args&&... args);
-    // template <class... Args> iterator emplace_hint(const_iterator position,
-    //                                                Args&&... args);
-
     // iterator insert(value_type&& value);
 
     // iterator insert(const_iterator position, value_type&& value);
@@ -1064,6 +1203,58 @@ multiset<KEY, COMPARATOR, ALLOCATOR>::nodeFactory()
     return d_compAndAlloc.d_pool;
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+BloombergLP::bslalg::RbTreeNode *
+multiset<KEY, COMPARATOR, ALLOCATOR>::insertNode(
+                                         BloombergLP::bslalg::RbTreeNode *node)
+{
+    BloombergLP::bslstl::TreeNodePoolProctor<NodeFactory> proctor(
+                                                                &nodeFactory(),
+                                                                node);
+    const key_type& key = static_cast<const Node *>(node)->value();
+    bool leftChild;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findInsertLocation(&leftChild,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              leftChild,
+                                              node);
+    proctor.release();
+    return node;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+BloombergLP::bslalg::RbTreeNode *
+multiset<KEY, COMPARATOR, ALLOCATOR>::insertNode(
+                                   const BloombergLP::bslalg::RbTreeNode *hint,
+                                   BloombergLP::bslalg::RbTreeNode       *node)
+{
+    BloombergLP::bslstl::TreeNodePoolProctor<NodeFactory> proctor(
+                                                                &nodeFactory(),
+                                                                node);
+    const key_type& key = static_cast<const Node *>(node)->value();
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                          const_cast<BloombergLP::bslalg::RbTreeNode *>(hint);
+    bool leftChild;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findInsertLocation(&leftChild,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              leftChild,
+                                              node);
+    proctor.release();
+    return node;
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename multiset<KEY, COMPARATOR, ALLOCATOR>::Comparator&
@@ -1309,6 +1500,257 @@ void multiset<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
     }
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(ARGS&&... args)
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode(
+                                         native_std::forward<ARGS>(args)...)));
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_multiset.h
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace()
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode()));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5))));
+}
+
+#else
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    return iterator(insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...)));
+}
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                           const_iterator hint,
+                                                           ARGS&&... args)
+{
+    return iterator(insertNode(hint.node(), nodeFactory().emplaceIntoNewNode(
+                                         native_std::forward<ARGS>(args)...)));
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_multiset.h
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(const_iterator hint)
+{
+    return iterator(insertNode(hint.node(),
+                               nodeFactory().emplaceIntoNewNode()));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    return iterator(insertNode(hint.node(), nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    return iterator(insertNode(hint.node(), nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    return iterator(insertNode(hint.node(), nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    return iterator(insertNode(hint.node(), nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4))));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    return iterator(insertNode(hint.node(), nodeFactory().emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5))));
+}
+
+#else
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                               const_iterator hint,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    return iterator(insertNode(hint.node(), nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...)));
+}
+// }}} END GENERATED CODE
+#endif
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
@@ -116,6 +116,8 @@ using namespace bsl;
 // [15] bsl::pair<iterator, bool> insert(const value_type& value);
 // [15] iterator insert(const_iterator position, const value_type& value);
 // [15] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [26] iterator emplace(ARGS&&... args);
+// [26] iterator emplace_hint(const_iterator hint, ARGS&&... args);
 //
 // [16] iterator erase(const_iterator position);
 // [16] size_type erase(const key_type& key);
@@ -150,7 +152,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [21] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multiset<T,A> *object, const char *spec, int verbose = 1);
@@ -329,16 +331,6 @@ void debugprint(const bsl::multiset<KEY, COMP, ALLOC>& s)
 
 namespace {
 
-bool expectToAllocate(int n)
-    // Return 'true' if the container is expected to allocate memory on the
-    // specified 'n'th element, and 'false' otherwise.
-{
-    if (n > 32) {
-        return (0 == n % 32);                                         // RETURN
-    }
-    return (((n - 1) & n) == 0);  // Allocate when 'n' is a power of 2
-}
-
 template<class CONTAINER, class VALUES>
 int verifyContainer(const CONTAINER&  container,
                     const VALUES&     expectedValues,
@@ -861,6 +853,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase26();
+        // Test 'emplace' and 'emplace_hint'.
+
     static void testCase25();
         // Test standard interface coverage.
 
@@ -1004,6 +999,165 @@ bsl::multiset<KEY, COMP, ALLOC> TestDriver<KEY, COMP, ALLOC>::g(
     return gg(&object, spec);
 }
 
+template <class KEY, class COMP, class ALLOC>
+void TestDriver<KEY, COMP, ALLOC>::testCase26()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace' AND 'emplace_hint'
+    //
+    // Concerns:
+    //: 1 Each method inserts a new element, constructed from the supplied
+    //:   arguments, after any existing elements having the same key, and the
+    //:   order of the container remains correct.
+    //:
+    //: 2 The iterator returned refers to the newly inserted element.
+    //:
+    //: 3 Any memory allocated by the container, or by the newly inserted
+    //:   element, is drawn from the object allocator.
+    //:
+    //: 4 Each method is exception neutral w.r.t. memory allocation.
+    //
+    // Plan:
+    //: 1 For each method, and for a sequence of values having both unique
+    //:   and duplicate keys, insert each value into an initially empty object
+    //:   by passing the value as the single argument.
+    //:
+    //:   1 Verify the return value and the resulting value of the object.
+    //:     (C-1..2)
+    //:
+    //:   2 Compute the number of allocations from the object allocator and
+    //:     verify it is as expected.  (C-3)
+    //:
+    //: 2 Repeat P-1 under the presence of exceptions.  (C-4)
+    //
+    // Testing:
+    //   iterator emplace(ARGS&&... args);
+    //   iterator emplace_hint(const_iterator hint, ARGS&&... args);
+    // ------------------------------------------------------------------------
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<KEY>::value;
+
+    if (verbose)
+        printf("\nTesting parameters: TYPE_ALLOC = %d.\n", TYPE_ALLOC);
+
+    static const struct {
+        int         d_line;    // source line number
+        const char *d_spec;    // specification string
+        const char *d_unique;  // expected element values
+    } DATA[] = {
+        //line  spec           isUnique
+        //----  ----           --------
+
+        { L_,   "A",           "Y"           },
+        { L_,   "AAA",         "YNN"         },
+        { L_,   "ABCDEFGH",    "YYYYYYYY"    },
+        { L_,   "ABCDEABCDEF", "YYYYYNNNNNY" },
+        { L_,   "EEDDCCBBAA",  "YNYNYNYNYN"  }
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    const int MAX_LENGTH = 20;
+
+    if (verbose) printf("\nTesting without exceptions.\n");
+    for (int useHint = 0; useHint < 2; ++useHint) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            if (veryVerbose) { P_(useHint) P_(LINE) P_(SPEC) P(UNIQUE); }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                EXPECTED[SIZE] = SPEC[tj];
+                std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                EXPECTED[SIZE + 1] = '\0';
+
+                const KEY& K = VALUES[tj];
+
+                const bsls::Types::Int64 BB = oa.numBlocksTotal();
+                const bsls::Types::Int64 B  = oa.numBlocksInUse();
+
+                Iter RESULT = useHint ? mX.emplace_hint(X.end(), K)
+                                      : mX.emplace(K);
+
+                ASSERTV(useHint, LINE, tj, VALUES[tj] == *RESULT);
+
+                Iter AFTER = RESULT;  ++AFTER;
+                ASSERTV(useHint, LINE, tj, AFTER == X.upper_bound(K));
+
+                const bsls::Types::Int64 AA = oa.numBlocksTotal();
+                const bsls::Types::Int64 A  = oa.numBlocksInUse();
+
+                ASSERTV(useHint, LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                ASSERTV(useHint, LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
+                ASSERTV(useHint, LINE, tj, SIZE + 1 == X.size());
+
+                TestValues exp(EXPECTED);
+                ASSERTV(useHint, LINE, tj,
+                        0 == verifyContainer(X, exp, SIZE + 1));
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting with injected exceptions.\n");
+    for (int useHint = 0; useHint < 2; ++useHint) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                EXPECTED[SIZE] = SPEC[tj];
+                std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                EXPECTED[SIZE + 1] = '\0';
+
+                const KEY& K = VALUES[tj];
+
+                bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ExceptionGuard<Obj> guard(&X, L_, &scratch);
+
+                    if (useHint) {
+                        mX.emplace_hint(X.end(), K);
+                    }
+                    else {
+                        mX.emplace(K);
+                    }
+
+                    guard.release();
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                TestValues exp(EXPECTED);
+                ASSERTV(useHint, LINE, tj,
+                        0 == verifyContainer(X, exp, SIZE + 1));
+            }
+        }
+    }
+}
+
 template <class KEY, class COMP, class ALLOC>
 void TestDriver<KEY, COMP, ALLOC>::testCase25()
 {
@@ -2481,17 +2635,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase16()
                     }
 
 
-                    if(expectToAllocate(SIZE + 1)) {
-                        ASSERTV(LINE, tj, AA, BB,
-                                BB + 1 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B,
-                                B + 1 + TYPE_ALLOC == A);
-                    }
-                    else {
-                        ASSERTV(LINE, tj, AA, BB,
-                                BB + 0 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                    }
+                    ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                     ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                     TestValues exp(EXPECTED);
@@ -2582,16 +2727,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase16()
                     ASSERTV(LINE, CONFIG, tj, SIZE,
                             VALUES[tj] == *RESULT);
 
-                    if(expectToAllocate(SIZE + 1)) {
-                        ASSERTV(LINE, tj, AA, BB,
-                                BB + 1 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                    }
-                    else {
-                        ASSERTV(LINE, tj, AA, BB,
-                                BB + 0 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                    }
+                    ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                     ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                     TestValues exp(EXPECTED);
@@ -2725,14 +2862,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase15()
                 const bsls::Types::Int64 AA = oa.numBlocksTotal();
                 const bsls::Types::Int64 A  = oa.numBlocksInUse();
 
-                if(expectToAllocate(SIZE + 1)) {
-                    ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
-                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                }
-                else {
-                    ASSERTV(LINE, tj, AA, BB, BB + 0 + TYPE_ALLOC == AA);
-                    ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                }
+                ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                 ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                 TestValues exp(EXPECTED);
@@ -4662,9 +4793,10 @@ void TestDriver<KEY, COMP, ALLOC>::testCase7()
                     ASSERTV(SPEC,  B + 0 ==  A);
                 }
                 else {
-                    const int TYPE_ALLOCS = TYPE_ALLOC * X.size();
-                    ASSERTV(SPEC, BB + 1 + TYPE_ALLOCS == AA);
-                    ASSERTV(SPEC,  B + 1 + TYPE_ALLOCS ==  A);
+                    const int NUM_NODES   = static_cast<int>(X.size());
+                    const int TYPE_ALLOCS = TYPE_ALLOC * NUM_NODES;
+                    ASSERTV(SPEC, BB + NUM_NODES + TYPE_ALLOCS == AA);
+                    ASSERTV(SPEC,  B + NUM_NODES + TYPE_ALLOCS ==  A);
                 }
 
                 const bsls::Types::Int64 CC = oa.numBlocksTotal();
@@ -4721,9 +4853,13 @@ void TestDriver<KEY, COMP, ALLOC>::testCase7()
                     ASSERTV(SPEC,  B + 0 ==  A);
                 }
                 else {
-                    const int TYPE_ALLOCS = TYPE_ALLOC *
-                        (LENGTH + LENGTH * (1 + LENGTH) / 2);
-                    ASSERTV(SPEC, BB, AA, BB + 1 + TYPE_ALLOCS == AA);
+                    // Each attempt allocates one more block than the last: one
+                    // per node, plus one per element that uses an allocator.
+
+                    const int NUM_ALLOCS = (1 + TYPE_ALLOC)
+                                         * static_cast<int>(X.size());
+                    ASSERTV(SPEC, BB, AA,
+                            BB + NUM_ALLOCS * (1 + NUM_ALLOCS) / 2 == AA);
                     ASSERTV(SPEC, B + 0 == A);
                 }
             }
@@ -5442,14 +5578,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase2()
                     bslma::TestAllocatorMonitor tam(&oa);
                     Iter RESULT = mX.insert(VALUES[LENGTH - 1]);
 
-                    if (0 < TYPE_ALLOC || expectToAllocate(LENGTH)) {
-                        ASSERTV(CONFIG, tam.isTotalUp());
-                        ASSERTV(CONFIG, tam.isInUseUp());
-                    }
-                    else {
-                        ASSERTV(CONFIG, tam.isTotalSame());
-                        ASSERTV(CONFIG, tam.isInUseSame());
-                    }
+                    ASSERTV(CONFIG, tam.isTotalUp());
+                    ASSERTV(CONFIG, tam.isInUseUp());
 
                     // Verify no temporary memory is allocated from the object
                     // allocator.
@@ -6404,7 +6534,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6451,6 +6581,15 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
 
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'emplace' AND 'emplace_hint'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase26,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+
       } break;
       case 25: {
         // --------------------------------------------------------------------
@@ -0,0 +1,388 @@
+// bslstl_nodehandle.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#define INCLUDED_BSLSTL_NODEHANDLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a handle owning a node extracted from a container.
+//
+//@CLASSES:
+//   bslstl::NodeHandle: owner of a container node and of its value
+//
+//@SEE_ALSO: bslstl_map, bslstl_set, bslstl_unorderedmap, bslstl_unorderedset
+//
+//@DESCRIPTION: This component provides a class template, 'NodeHandle', that
+// owns a single node of a node-based container (e.g., a 'bslstl::TreeNode' of
+// a 'bsl::map', or a 'bslalg::BidirectionalNode' of a 'bsl::unordered_map'),
+// together with the value held in that node, outside of any container.  The
+// node-based containers provide an 'extract' method that unlinks a node from
+// the container and passes its ownership to a 'NodeHandle', and an 'insert'
+// method taking a 'NodeHandle' that links the node into the container again.
+// Taking an element out of a container and inserting it into the same
+// container again in this way neither copies the value nor allocates or
+// deallocates memory, and allows the key of an element of a set to be
+// modified in place:
+//..
+//  bsl::set<int> set;
+//  set.insert(1);
+//
+//  bsl::set<int>::node_type node;
+//  set.extract(&node, 1);
+//  node.value() = 2;
+//  set.insert(node);
+//..
+// A node handle holds, along with its node, a copy of the allocator that
+// supplied the memory of the node, and deletes the node on destruction
+// (unless the node has been released first) by returning that memory to that
+// allocator.  A node handle therefore does not depend on the container from
+// which its node was extracted, and may outlive it.  A container links the
+// node of a handle into itself if the allocator of the handle compares equal
+// to that of the container, in particular when inserting the handle into a
+// container other than the one from which its node was extracted; otherwise,
+// it inserts a copy of the value, and deletes the node of the handle.
+//
+// The 'NodeHandle' class template is parameterized by the type of the value
+// held in a node ('VALUE'), the type of the node ('NODE'), which must provide
+// a 'value' method returning a reference to that value, and the type of the
+// node factory ('NODE_FACTORY') that creates the nodes, which must provide an
+// 'AllocatorType' type and a 'deleteNode' class method accepting the address
+// of an 'AllocatorType' object and the address of a 'NODE' (see, e.g.,
+// 'bslstl_treenodepool').  'NodeHandle' objects cannot be copied, and
+// ownership of a node passes between them by 'swap'.
+//
+///Usage
+///-----
+// In this section we show intended usage of this component.
+//
+///Example 1: Holding a Node Outside of a Container
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we implement a node-based container of 'int' values using a
+// 'bslstl::TreeNodePool' to create its nodes, and want to let its clients
+// take a node out of the container and later insert it again.  We represent
+// such a node by a 'NodeHandle'.
+//
+// First, we define the types of the node factory and of the handle:
+//..
+//  typedef bslstl::TreeNodePool<int, bsl::allocator<int> > NodeFactory;
+//  typedef bslstl::NodeHandle<int, bslstl::TreeNode<int>, NodeFactory>
+//                                                                   Handle;
+//..
+// Then, we create a node factory, a node, and an empty handle:
+//..
+//  bslma::TestAllocator oa;
+//  NodeFactory          factory(&oa);
+//
+//  bslstl::TreeNode<int> *node =
+//                static_cast<bslstl::TreeNode<int> *>(factory.createNode(1));
+//
+//  Handle handle;
+//  assert(handle.empty());
+//..
+// Next, we pass the ownership of the node to the handle, as the 'extract'
+// method of a container does after unlinking the node, and modify the value
+// held in the node:
+//..
+//  handle.reset(node, factory.allocator());
+//  assert(!handle.empty());
+//  assert(factory.allocator() == handle.allocator());
+//
+//  handle.value() = 2;
+//  assert(2 == node->value());
+//..
+// Then, we take the node back, as the 'insert' method of a container does
+// before linking the node:
+//..
+//  assert(node == handle.release());
+//  assert(handle.empty());
+//..
+// Finally, we delete that node by the factory, and give a node created by
+// another factory to a handle that outlives that factory.  The handle deletes
+// the node when it goes out of scope:
+//..
+//  factory.deleteNode(node);
+//
+//  Handle other;
+//  {
+//      NodeFactory otherFactory(&oa);
+//
+//      other.reset(static_cast<bslstl::TreeNode<int> *>(
+//                                             otherFactory.createNode(3)),
+//                  otherFactory.allocator());
+//  }
+//  assert(3 == other.value());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>
+#define INCLUDED_NEW
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ================
+                        // class NodeHandle
+                        // ================
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+class NodeHandle {
+    // This class owns a node, holding a value of the (template parameter) type
+    // 'VALUE', that is not linked into a container, along with a copy of the
+    // allocator that supplied the memory of the node, and deletes the node on
+    // destruction by the 'deleteNode' class method of the (template
+    // parameter) type 'NODE_FACTORY'.  A 'NodeHandle' is either empty, or
+    // holds exactly one node.  This class is not copyable.
+
+  public:
+    // TYPES
+    typedef typename NODE_FACTORY::AllocatorType AllocatorType;
+        // Alias for the type of the allocator of a node.
+
+  private:
+    // DATA
+    NODE                              *d_node_p;     // held node (owned), or
+                                                     // 0 if empty
+
+    bsls::ObjectBuffer<AllocatorType>  d_allocator;  // allocator of
+                                                     // 'd_node_p', constructed
+                                                     // only if not empty
+
+  private:
+    // NOT IMPLEMENTED
+    NodeHandle(const NodeHandle&);
+    NodeHandle& operator=(const NodeHandle&);
+
+  public:
+    // CREATORS
+    NodeHandle();
+        // Create an empty node handle.
+
+    ~NodeHandle();
+        // Destroy this object, deleting the node it holds, if any.
+
+    // MANIPULATORS
+    NODE *release();
+        // Return the address of the node held by this object, and leave this
+        // object empty without deleting the node.  The caller is responsible
+        // for deleting the node.  The behavior is undefined if this object is
+        // empty.
+
+    void reset();
+        // Delete the node held by this object, if any, and leave this object
+        // empty.
+
+    void reset(NODE *node, const AllocatorType& allocator);
+        // Delete the node held by this object, if any, and take ownership of
+        // the specified 'node', whose memory was supplied by the specified
+        // 'allocator'.  The behavior is undefined unless 'node' is not 0, was
+        // created by a 'NODE_FACTORY' object using an allocator equal to
+        // 'allocator', and is not linked into a container.
+
+    void swap(NodeHandle& other);
+        // Exchange the node held by this object, if any, and its allocator
+        // with those held by the specified 'other' object, if any.  This
+        // method provides the no-throw exception-safety guarantee.
+
+    VALUE& value();
+        // Return a reference providing modifiable access to the value held in
+        // the node of this object.  The behavior is undefined if this object
+        // is empty.
+
+    // ACCESSORS
+    const AllocatorType& allocator() const;
+        // Return a reference providing non-modifiable access to the allocator
+        // that supplied the memory of the node held by this object.  The
+        // behavior is undefined if this object is empty.
+
+    bool empty() const;
+        // Return 'true' if this object does not hold a node, and 'false'
+        // otherwise.
+
+    const VALUE& value() const;
+        // Return a reference providing non-modifiable access to the value held
+        // in the node of this object.  The behavior is undefined if this
+        // object is empty.
+};
+
+// FREE FUNCTIONS
+template <class VALUE, class NODE, class NODE_FACTORY>
+void swap(NodeHandle<VALUE, NODE, NODE_FACTORY>& a,
+          NodeHandle<VALUE, NODE, NODE_FACTORY>& b);
+    // Exchange the nodes held by the specified 'a' and 'b' objects.  This
+    // function provides the no-throw exception-safety guarantee.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------
+                        // class NodeHandle
+                        // ----------------
+
+// CREATORS
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+NodeHandle<VALUE, NODE, NODE_FACTORY>::NodeHandle()
+: d_node_p(0)
+{
+}
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+NodeHandle<VALUE, NODE, NODE_FACTORY>::~NodeHandle()
+{
+    reset();
+}
+
+// MANIPULATORS
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+NODE *NodeHandle<VALUE, NODE, NODE_FACTORY>::release()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    NODE *node = d_node_p;
+    d_node_p = 0;
+    d_allocator.object().~AllocatorType();
+    return node;
+}
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+void NodeHandle<VALUE, NODE, NODE_FACTORY>::reset()
+{
+    if (d_node_p) {
+        NODE_FACTORY::deleteNode(&d_allocator.object(), d_node_p);
+        d_node_p = 0;
+        d_allocator.object().~AllocatorType();
+    }
+}
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+void NodeHandle<VALUE, NODE, NODE_FACTORY>::reset(
+                                              NODE                 *node,
+                                              const AllocatorType&  allocator)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(node != d_node_p);
+
+    reset();
+    ::new (d_allocator.buffer()) AllocatorType(allocator);
+    d_node_p = node;
+}
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+void NodeHandle<VALUE, NODE, NODE_FACTORY>::swap(NodeHandle& other)
+{
+    if (d_node_p && other.d_node_p) {
+        bslalg::SwapUtil::swap(&d_allocator.object(),
+                               &other.d_allocator.object());
+    }
+    else if (d_node_p) {
+        ::new (other.d_allocator.buffer()) AllocatorType(
+                                                        d_allocator.object());
+        d_allocator.object().~AllocatorType();
+    }
+    else if (other.d_node_p) {
+        ::new (d_allocator.buffer()) AllocatorType(
+                                                  other.d_allocator.object());
+        other.d_allocator.object().~AllocatorType();
+    }
+
+    NODE *node     = d_node_p;
+    d_node_p       = other.d_node_p;
+    other.d_node_p = node;
+}
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+VALUE& NodeHandle<VALUE, NODE, NODE_FACTORY>::value()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->value();
+}
+
+// ACCESSORS
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+const typename NodeHandle<VALUE, NODE, NODE_FACTORY>::AllocatorType&
+NodeHandle<VALUE, NODE, NODE_FACTORY>::allocator() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_allocator.object();
+}
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+bool NodeHandle<VALUE, NODE, NODE_FACTORY>::empty() const
+{
+    return 0 == d_node_p;
+}
+
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+const VALUE& NodeHandle<VALUE, NODE, NODE_FACTORY>::value() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->value();
+}
+
+}  // close package namespace
+
+// FREE FUNCTIONS
+template <class VALUE, class NODE, class NODE_FACTORY>
+inline
+void bslstl::swap(bslstl::NodeHandle<VALUE, NODE, NODE_FACTORY>& a,
+                  bslstl::NodeHandle<VALUE, NODE, NODE_FACTORY>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
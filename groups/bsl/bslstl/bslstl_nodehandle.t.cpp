@@ -0,0 +1,545 @@
+// bslstl_nodehandle.t.cpp                                            -*-C++-*-
+#include <bslstl_nodehandle.h>
+
+#include <bslstl_allocator.h>                    // for testing only
+#include <bslstl_treenode.h>                     // for testing only
+#include <bslstl_treenodepool.h>                 // for testing only
+
+#include <bslma_default.h>                       // for testing only
+#include <bslma_defaultallocatorguard.h>         // for testing only
+#include <bslma_testallocator.h>                 // for testing only
+#include <bsls_bsltestutil.h>                    // for testing only
+#include <bsls_types.h>                          // for testing only
+#include <bsltf_alloctesttype.h>                 // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>    // atoi()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a non-copyable owner of a node created by a
+// node factory.  The concerns are that a node handle deletes the node it
+// holds, returning its memory to the allocator of the node, exactly when it
+// is destroyed or reset, and never after the node has been released, that it
+// does so even after the factory that created the node is destroyed, and that
+// 'swap' exchanges the nodes and the allocators of two handles.
+//
+// Each test creates nodes holding 'bsltf::AllocTestType' values from a
+// 'bslstl::TreeNodePool', so that the deletion of a node shows up as the
+// release of the memory allocated by its value.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] NodeHandle();
+// [ 2] ~NodeHandle();
+//
+// MANIPULATORS
+// [ 3] NODE *release();
+// [ 3] void reset();
+// [ 2] void reset(NODE *node, const AllocatorType& allocator);
+// [ 4] void swap(NodeHandle& other);
+// [ 2] VALUE& value();
+//
+// ACCESSORS
+// [ 2] const AllocatorType& allocator() const;
+// [ 2] bool empty() const;
+// [ 2] const VALUE& value() const;
+//
+// FREE FUNCTIONS
+// [ 4] void swap(NodeHandle& a, NodeHandle& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS/TYPES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsltf::AllocTestType                                  Value;
+typedef bslstl::TreeNode<Value>                               Node;
+typedef bslstl::TreeNodePool<Value, bsl::allocator<Value> >   Factory;
+typedef bslstl::NodeHandle<Value, Node, Factory>              Obj;
+
+static bool verbose;
+static bool veryVerbose;
+
+static Node *createNode(Factory *factory, int value)
+    // Return the address of a new node holding the specified 'value', created
+    // by the specified 'factory'.
+{
+    return static_cast<Node *>(factory->createNode(Value(value)));
+}
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended usage of this component.
+//
+///Example 1: Holding a Node Outside of a Container
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we implement a node-based container of 'int' values using a
+// 'bslstl::TreeNodePool' to create its nodes, and want to let its clients
+// take a node out of the container and later insert it again.  We represent
+// such a node by a 'NodeHandle'.
+//
+// First, we define the types of the node factory and of the handle:
+//..
+    typedef bslstl::TreeNodePool<int, bsl::allocator<int> > NodeFactory;
+    typedef bslstl::NodeHandle<int, bslstl::TreeNode<int>, NodeFactory>
+                                                                     Handle;
+//..
+// Then, we create a node factory, a node, and an empty handle:
+//..
+    bslma::TestAllocator oa;
+    NodeFactory          factory(&oa);
+
+    bslstl::TreeNode<int> *node =
+                  static_cast<bslstl::TreeNode<int> *>(factory.createNode(1));
+
+    Handle handle;
+    ASSERT(handle.empty());
+//..
+// Next, we pass the ownership of the node to the handle, as the 'extract'
+// method of a container does after unlinking the node, and modify the value
+// held in the node:
+//..
+    handle.reset(node, factory.allocator());
+    ASSERT(!handle.empty());
+    ASSERT(factory.allocator() == handle.allocator());
+
+    handle.value() = 2;
+    ASSERT(2 == node->value());
+//..
+// Then, we take the node back, as the 'insert' method of a container does
+// before linking the node:
+//..
+    ASSERT(node == handle.release());
+    ASSERT(handle.empty());
+//..
+// Finally, we delete that node by the factory, and give a node created by
+// another factory to a handle that outlives that factory.  The handle deletes
+// the node when it goes out of scope:
+//..
+    factory.deleteNode(node);
+
+    Handle other;
+    {
+        NodeFactory otherFactory(&oa);
+
+        other.reset(static_cast<bslstl::TreeNode<int> *>(
+                                               otherFactory.createNode(3)),
+                    otherFactory.allocator());
+    }
+    ASSERT(3 == other.value());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'swap'
+        //
+        // Concerns:
+        //: 1 'swap' exchanges the nodes and the allocators of two handles,
+        //:   whether either, both, or neither of them is empty.
+        //:
+        //: 2 'swap' neither deletes nor creates a node.
+        //:
+        //: 3 The free function 'swap' has the same effect as the member.
+        //
+        // Plan:
+        //: 1 For each combination of empty and non-empty handles holding nodes
+        //:   of two factories using different allocators, exchange the
+        //:   handles by the member and by the free 'swap', and verify the
+        //:   nodes, the allocators, and the memory in use after each
+        //:   exchange.  (C-1..3)
+        //
+        // Testing:
+        //   void swap(NodeHandle& other);
+        //   void swap(NodeHandle& a, NodeHandle& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'swap'"
+                            "\n==============\n");
+
+        for (int cfg = 0; cfg < 4; ++cfg) {
+            const bool HAS_X = cfg & 1;
+            const bool HAS_Y = cfg & 2;
+
+            bslma::TestAllocator oa("object", veryVerbose);
+            bslma::TestAllocator za("other",  veryVerbose);
+
+            Factory fx(&oa);
+            Factory fy(&za);
+
+            Node *nodeX = HAS_X ? createNode(&fx, 1) : 0;
+            Node *nodeY = HAS_Y ? createNode(&fy, 2) : 0;
+
+            {
+                Obj mX;  const Obj& X = mX;
+                Obj mY;  const Obj& Y = mY;
+
+                if (HAS_X) {
+                    mX.reset(nodeX, fx.allocator());
+                }
+                if (HAS_Y) {
+                    mY.reset(nodeY, fy.allocator());
+                }
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+                const bsls::Types::Int64 NUM_OTHER  = za.numBlocksInUse();
+
+                mX.swap(mY);
+
+                ASSERTV(cfg, HAS_Y == !X.empty());
+                ASSERTV(cfg, HAS_X == !Y.empty());
+                ASSERTV(cfg, !HAS_Y || fy.allocator() == X.allocator());
+                ASSERTV(cfg, !HAS_X || fx.allocator() == Y.allocator());
+                ASSERTV(cfg, !HAS_Y || 2 == X.value().data());
+                ASSERTV(cfg, !HAS_X || 1 == Y.value().data());
+                ASSERTV(cfg, NUM_BLOCKS == oa.numBlocksInUse());
+                ASSERTV(cfg, NUM_OTHER  == za.numBlocksInUse());
+
+                swap(mX, mY);
+
+                ASSERTV(cfg, HAS_X == !X.empty());
+                ASSERTV(cfg, HAS_Y == !Y.empty());
+                ASSERTV(cfg, !HAS_X || fx.allocator() == X.allocator());
+                ASSERTV(cfg, !HAS_Y || fy.allocator() == Y.allocator());
+                ASSERTV(cfg, !HAS_X || 1 == X.value().data());
+                ASSERTV(cfg, !HAS_Y || 2 == Y.value().data());
+                ASSERTV(cfg, NUM_BLOCKS == oa.numBlocksInUse());
+                ASSERTV(cfg, NUM_OTHER  == za.numBlocksInUse());
+            }
+
+            ASSERTV(cfg, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(cfg, za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'release' AND 'reset()'
+        //
+        // Concerns:
+        //: 1 'release' returns the node held, leaves the handle empty, and
+        //:   does not delete the node.
+        //:
+        //: 2 'reset()' deletes the node held, if any, returning its memory to
+        //:   the allocator, and leaves the handle empty.
+        //
+        // Plan:
+        //: 1 Give a node to a handle, release it, and verify the returned
+        //:   node, that the handle is empty, and that its value is still
+        //:   alive; then delete the node by its factory.  (C-1)
+        //:
+        //: 2 Call 'reset()' on an empty and on a non-empty handle, and verify
+        //:   that the handle is empty, and that both the value and the node
+        //:   are deallocated.  (C-2)
+        //
+        // Testing:
+        //   NODE *release();
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'release' AND 'reset()'"
+                            "\n===============================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Factory factory(&oa);
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Node *node = createNode(&factory, 3);
+            mX.reset(node, factory.allocator());
+
+            ASSERTV(NUM_BLOCKS + 2 == oa.numBlocksInUse());
+
+            ASSERT(node == mX.release());
+            ASSERT(X.empty());
+            ASSERTV(NUM_BLOCKS + 2 == oa.numBlocksInUse());
+            ASSERTV(3 == node->value().data());
+
+            factory.deleteNode(node);
+
+            ASSERTV(NUM_BLOCKS + 1 == oa.numBlocksInUse());
+        }
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.reset();
+
+            ASSERT(X.empty());
+
+            mX.reset(createNode(&factory, 4), factory.allocator());
+
+            ASSERTV(NUM_BLOCKS + 2 == oa.numBlocksInUse());
+
+            mX.reset();
+
+            ASSERT(X.empty());
+            ASSERTV(NUM_BLOCKS == oa.numBlocksInUse());
+        }
+
+        ASSERTV(NUM_BLOCKS == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed handle is empty.
+        //:
+        //: 2 'reset(node, allocator)' takes ownership of 'node', and deletes
+        //:   the node previously held, if any, returning its memory to the
+        //:   allocator of that node.
+        //:
+        //: 3 'value' refers to the value held in the node, and the value is
+        //:   modifiable through the non-'const' overload.
+        //:
+        //: 4 The destructor deletes the node held, if any.
+        //:
+        //: 5 A handle does not depend on the factory that created its node.
+        //
+        // Plan:
+        //: 1 Default-construct a handle and verify that it is empty.  (C-1)
+        //:
+        //: 2 Give nodes of two factories to the handle in turn, and verify the
+        //:   accessors and the memory in use after each call.  (C-2..3)
+        //:
+        //: 3 Let the handle go out of scope, and verify that both the value
+        //:   and the node are deallocated.  (C-4)
+        //:
+        //: 4 Give a node to a handle, destroy the factory that created the
+        //:   node, and verify that the value is still accessible and that the
+        //:   handle deallocates the node on destruction.  (C-5)
+        //
+        // Testing:
+        //   NodeHandle();
+        //   ~NodeHandle();
+        //   void reset(NODE *node, const AllocatorType& allocator);
+        //   VALUE& value();
+        //   const AllocatorType& allocator() const;
+        //   bool empty() const;
+        //   const VALUE& value() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Factory fa(&oa);
+        Factory fb(&oa);
+
+        Node *nodeA = createNode(&fa, 1);
+        Node *nodeB = createNode(&fb, 2);
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(X.empty());
+
+            mX.reset(nodeA, fa.allocator());
+
+            ASSERT(!X.empty());
+            ASSERT(fa.allocator() == X.allocator());
+            ASSERT(1 == X.value().data());
+            ASSERT(&nodeA->value() == &X.value());
+            ASSERTV(NUM_BLOCKS == oa.numBlocksInUse());
+
+            mX.value().setData(5);
+
+            ASSERT(5 == nodeA->value().data());
+
+            mX.reset(nodeB, fb.allocator());
+
+            ASSERT(!X.empty());
+            ASSERT(fb.allocator() == X.allocator());
+            ASSERT(2 == X.value().data());
+            ASSERTV(NUM_BLOCKS - 2 == oa.numBlocksInUse());
+        }
+
+        ASSERTV(NUM_BLOCKS - 4 == oa.numBlocksInUse());
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            {
+                Factory fc(&oa);
+
+                mX.reset(createNode(&fc, 3), fc.allocator());
+            }
+
+            ASSERT(3 == X.value().data());
+            ASSERTV(NUM_BLOCKS - 2 == oa.numBlocksInUse());
+        }
+
+        ASSERTV(NUM_BLOCKS - 4 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Give a node to a handle, modify its value, move it to a second
+        //:   handle, and let both handles go out of scope.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Factory factory(&oa);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            mX.reset(createNode(&factory, 1), factory.allocator());
+            mX.value().setData(2);
+
+            mX.swap(mY);
+
+            ASSERT(X.empty());
+            ASSERT(!Y.empty());
+            ASSERT(2 == Y.value().data());
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -89,6 +89,54 @@ BSLS_IDENT("$Id: $")
 //
 //  assert(toString("abc") == "abc");
 //..
+//
+///Example 2: Formatting Messages Without Copying
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we format a sequence of messages with a 'bsl::ostringstream' and
+// pass each of them on to a transport.  Retrieving each message with 'str'
+// would copy it into a newly allocated string.  Instead, we inspect the
+// formatted characters in place with 'view', and move them out of the stream
+// with 'extract', which hands the stream the memory of the string being
+// extracted into, so that neither object allocates once the loop has warmed
+// up.
+//
+// First, we define a function standing in for the transport, which appends
+// a message to a "wire" buffer:
+//..
+//  void sendMessage(bsl::string *wire, const bsl::string& message)
+//      // Append the specified 'message', followed by a newline, to the
+//      // specified 'wire'.
+//  {
+//      wire->append(message);
+//      wire->push_back('\n');
+//  }
+//..
+// Then, we create the stream, and reserve room for a typical message so that
+// formatting the first message does not grow the buffer repeatedly:
+//..
+//  bsl::string        wire;
+//  bsl::string        message;
+//  bsl::ostringstream out;
+//  out.reserve(64);
+//..
+// Next, we format and send each message, verifying the formatted characters
+// with 'view', which does not copy them:
+//..
+//  for (int i = 0; i < 3; ++i) {
+//      out << "id=" << i << " px=" << 100 + i;
+//
+//      assert(11 == out.view().length());
+//
+//      out.extract(&message);
+//      sendMessage(&wire, message);
+//
+//      assert(out.view().isEmpty());
+//  }
+//..
+// Finally, we verify the messages that were sent:
+//..
+//  assert("id=0 px=100\nid=1 px=101\nid=2 px=102\n" == wire);
+//..
 
 // Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
 // mode.  Doing so is unsupported, and is likely to cause compilation errors.
@@ -147,6 +195,7 @@ class basic_ostringstream
     typedef StringBufContainer<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>
                                                                  BaseType;
     typedef bsl::basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> StringType;
+    typedef BloombergLP::bslstl::StringRefImp<CHAR_TYPE>         StringRefType;
     typedef native_std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>    BaseStream;
     typedef native_std::ios_base                                 ios_base;
 
@@ -201,6 +250,21 @@ class basic_ostringstream
         // Reset the internally buffered sequence of characters maintained by
         // this stream object to the specified 'value'.
 
+    void extract(StringType *result);
+        // Load into the specified 'result' the sequence of characters
+        // buffered by this stream object, and reset the buffered sequence to
+        // be empty, as if by 'str(StringType())'.  The memory held by
+        // 'result' on entry is reused as the internal buffer of this object
+        // if 'result' uses the same allocator as this object.  Note that,
+        // unlike 'str()', this method does not copy the buffered characters
+        // if 'result' uses the same allocator as this object.
+
+    void reserve(native_std::size_t numCharacters);
+        // Ensure that the internal buffer of this stream object can hold at
+        // least the specified 'numCharacters' characters without
+        // reallocating.  The buffered sequence of characters and the stream
+        // positions are not changed.
+
     // ACCESSORS
     StringType str() const;
         // Return the sequence of characters that have been written to this
@@ -210,6 +274,12 @@ class basic_ostringstream
         // Return an address providing modifiable access to the
         // 'basic_stringbuf' object that is internally used by this string
         // stream to buffer unformatted characters.
+
+    StringRefType view() const;
+        // Return a reference to the sequence of characters buffered by this
+        // stream object.  The returned reference remains valid until the next
+        // operation that modifies this object.  Note that, unlike 'str', this
+        // method does not copy the buffered characters.
 };
 
 // STANDARD TYPEDEFS
@@ -293,6 +363,22 @@ void basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::str(
     this->rdbuf()->str(value);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+void basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::extract(
+                                                            StringType *result)
+{
+    this->rdbuf()->extract(result);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+void basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::reserve(
+                                              native_std::size_t numCharacters)
+{
+    this->rdbuf()->reserve(numCharacters);
+}
+
 // ACCESSORS
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 inline
@@ -311,6 +397,14 @@ basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::rdbuf() const
     return this->BaseType::rdbuf();
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+typename basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringRefType
+basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::view() const
+{
+    return this->rdbuf()->view();
+}
+
 }  // close namespace bsl
 
 #endif
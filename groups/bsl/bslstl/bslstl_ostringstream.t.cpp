@@ -14,6 +14,7 @@
 
 #include <bsls_bsltestutil.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 
 #include <bsltf_stdtestallocator.h>
 
@@ -49,15 +50,19 @@
 //
 // MANIPULATORS
 // [ 3] void str(const StringType& value);
+// [ 8] void extract(StringType *result);
+// [ 8] void reserve(size_t numCharacters);
 //
 // ACCESSORS
 // [ 3] StringType str() const;
 // [ 2] StreamBufType *rdbuf() const;
+// [ 8] StringRefType view() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 7] CONCERN: Standard allocator can be used
 // [ *] CONCERN: In no case does memory come from the global allocator.
+// [-1] PERFORMANCE TEST: FORMAT AND SEND
 
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -1118,6 +1123,28 @@ namespace {
         return out.str();
     }
 //..
+//
+///Example 2: Formatting Messages Without Copying
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we format a sequence of messages with a 'bsl::ostringstream' and
+// pass each of them on to a transport.  Retrieving each message with 'str'
+// would copy it into a newly allocated string.  Instead, we inspect the
+// formatted characters in place with 'view', and move them out of the stream
+// with 'extract', which hands the stream the memory of the string being
+// extracted into, so that neither object allocates once the loop has warmed
+// up.
+//
+// First, we define a function standing in for the transport, which appends
+// a message to a "wire" buffer:
+//..
+    void sendMessage(bsl::string *wire, const bsl::string& message)
+        // Append the specified 'message', followed by a newline, to the
+        // specified 'wire'.
+    {
+        wire->append(message);
+        wire->push_back('\n');
+    }
+//..
 
 }  // close unnamed namespace
 
@@ -1145,7 +1172,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1175,8 +1202,130 @@ int main(int argc, char *argv[])
 //
     ASSERT(toString("abc") == "abc");
 //..
+//
+// Then, we create the stream, and reserve room for a typical message so that
+// formatting the first message does not grow the buffer repeatedly:
+//..
+    bsl::string        wire;
+    bsl::string        message;
+    bsl::ostringstream out;
+    out.reserve(64);
+//..
+// Next, we format and send each message, verifying the formatted characters
+// with 'view', which does not copy them:
+//..
+    for (int i = 0; i < 3; ++i) {
+        out << "id=" << i << " px=" << 100 + i;
+//
+        ASSERT(11 == out.view().length());
+//
+        out.extract(&message);
+        sendMessage(&wire, message);
+//
+        ASSERT(out.view().isEmpty());
+    }
+//..
+// Finally, we verify the messages that were sent:
+//..
+    ASSERT("id=0 px=100\nid=1 px=101\nid=2 px=102\n" == wire);
+//..
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'view', 'reserve', AND 'extract'
+        //
+        // Concerns:
+        //: 1 The methods forward to the same-named methods of 'rdbuf'.
+        //:
+        //: 2 'view' reflects the characters written to the stream without
+        //:   allocating.
+        //:
+        //: 3 'extract' leaves the stream empty and usable, and, once warmed
+        //:   up, a loop of formatting and extracting does not allocate.
+        //:
+        //: 4 'reserve' lets the stream hold the reserved number of characters
+        //:   without allocating.
+        //
+        // Plan:
+        //: 1 Using a test allocator, write values to an 'ostringstream' and
+        //:   a 'wostringstream', and verify 'view', 'extract', and 'reserve'
+        //:   against 'str' and the allocator's counters.  (C-1..4)
+        //
+        // Testing:
+        //   void extract(StringType *result);
+        //   void reserve(size_t numCharacters);
+        //   StringRefType view() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'view', 'reserve', AND 'extract'"
+                            "\n========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting 'ostringstream'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(X.view().isEmpty());
+
+            mX.reserve(LENGTH_OF_SUFFICIENTLY_LONG_STRING + 20);
+
+            bsl::string longString;
+            loadString(&longString, LENGTH_OF_SUFFICIENTLY_LONG_STRING);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX << "value=" << 12345;
+            ASSERT("value=12345" == X.view());
+            ASSERT(X.rdbuf()->view() == X.view());
+
+            mX << longString;
+            ASSERT("value=12345" + longString == X.view());
+            ASSERT(oam.isTotalSame());
+
+            bsl::string result(&oa);
+            mX.extract(&result);
+            ASSERT("value=12345" + longString == result);
+            ASSERT(X.view().isEmpty());
+            ASSERT(X.str().empty());
+
+            mX << "again";
+            ASSERT("again" == X.view());
+            mX.extract(&result);
+            ASSERT("again" == result);
+
+            // Once both 'mX' and 'result' hold sufficiently large buffers,
+            // formatting and extracting does not allocate.
+
+            for (int i = 0; i < 2; ++i) {
+                mX << longString << i;
+                mX.extract(&result);
+            }
+
+            oam.reset(&oa);
+            for (int i = 0; i < 10; ++i) {
+                mX << longString << i;
+                mX.extract(&result);
+                LOOP_ASSERT(i, longString.size() + 1 == result.size());
+            }
+            ASSERT(oam.isTotalSame());
+        }
+
+        if (verbose) printf("\tTesting 'wostringstream'.\n");
+        {
+            WObj mX(&oa);  const WObj& X = mX;
+
+            mX.reserve(100);
+            mX << L"value=" << 12345;
+            ASSERT(L"value=12345" == X.view());
+
+            bsl::wstring result(&oa);
+            mX.extract(&result);
+            ASSERT(L"value=12345" == result);
+            ASSERT(X.view().isEmpty());
+        }
+      } break;
       case 7: {
         testCase7<char>();
         testCase7<wchar_t>();
@@ -1257,6 +1406,88 @@ int main(int argc, char *argv[])
         ASSERT(X.str()   == "t");
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: FORMAT AND SEND
+        //
+        // Concerns:
+        //: 1 Report the cost of formatting a message into a stream and
+        //:   copying it to an outgoing buffer, using a new stream and 'str'
+        //:   for each message, reusing a stream with 'view', and reusing a
+        //:   stream with 'extract'.
+        //
+        // Plan:
+        //: 1 Format the same messages using each approach with the default
+        //:   allocator, and print the time per message.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: FORMAT AND SEND
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: FORMAT AND SEND"
+                            "\n=================================\n");
+
+        const int NUM_MESSAGES = 200000;
+
+        const bsl::string SYMBOL("IBM US Equity");
+        const bsl::string BODY(400, 'b');
+
+        bsl::string wire;
+        wire.reserve(512);
+
+        bsls::Stopwatch timer;
+
+        // 1. A new stream for each message, retrieved by 'str'.
+
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            Obj out;
+            out << "id=" << i << " sym=" << SYMBOL << " body=" << BODY;
+
+            wire.assign(out.str());
+        }
+        timer.stop();
+        const double STR_TIME = timer.elapsedTime();
+
+        // 2. One stream, read in place by 'view' and then emptied.
+
+        Obj         out;
+        bsl::string scratch;
+        out.reserve(512);
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            out << "id=" << i << " sym=" << SYMBOL << " body=" << BODY;
+
+            wire.assign(out.view().begin(), out.view().end());
+            out.extract(&scratch);
+        }
+        timer.stop();
+        const double VIEW_TIME = timer.elapsedTime();
+
+        // 3. One stream, moved out by 'extract'.
+
+        bsl::string message;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            out << "id=" << i << " sym=" << SYMBOL << " body=" << BODY;
+
+            out.extract(&message);
+            wire.swap(message);
+        }
+        timer.stop();
+        const double EXTRACT_TIME = timer.elapsedTime();
+
+        printf("new stream + str(): %7.1f ns/message\n",
+               STR_TIME * 1e9 / NUM_MESSAGES);
+        printf("reused + view()   : %7.1f ns/message\n",
+               VIEW_TIME * 1e9 / NUM_MESSAGES);
+        printf("reused + extract(): %7.1f ns/message\n",
+               EXTRACT_TIME * 1e9 / NUM_MESSAGES);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
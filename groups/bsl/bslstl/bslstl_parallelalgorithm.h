@@ -0,0 +1,1478 @@
+// bslstl_parallelalgorithm.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLSTL_PARALLELALGORITHM
+#define INCLUDED_BSLSTL_PARALLELALGORITHM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide standard algorithms that split large ranges across threads.
+//
+//@CLASSES:
+//  bslstl::ParallelAlgorithmUtil: namespace for parallel algorithms
+//
+//@SEE_ALSO: bsls_parallelutil, bslalg_parallelarrayprimitives
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'bslstl::ParallelAlgorithmUtil', for versions of the standard algorithms
+// 'for_each', 'transform', 'reduce', 'inclusive_scan', 'sort', and
+// 'stable_sort' that take a 'bsls::ParallelPolicy' as their first argument.
+// Each algorithm operates on random-access ranges (e.g., of 'bsl::vector' or
+// 'bsl::deque'), which the policy splits into chunks processed by several
+// threads (see 'bsls_parallelutil').
+//
+// A range too small for the policy to split (i.e., of fewer than
+// '2 * policy.minChunkSize()' elements), or any range under a policy allowing
+// a single thread, is processed on the calling thread by the corresponding
+// serial algorithm of the platform library ('std::for_each', 'std::transform',
+// 'std::accumulate', 'std::sort', and 'std::stable_sort', respectively), or,
+// for 'inclusive_scan', by a single serial pass.  This fallback is
+// deterministic: it depends only on the size of the range and on the policy.
+//
+///Results
+///-------
+// 'for_each', 'transform', 'inclusive_scan', 'sort', and 'stable_sort' produce
+// the same result as their serial counterparts; in particular, 'stable_sort'
+// keeps equivalent elements in their original order.  'reduce' and
+// 'inclusive_scan' group the applications of their binary operation by chunk,
+// so that the operation must be associative for the result to be the same as
+// that of the serial algorithm ('reduce', unlike 'std::accumulate', also
+// applies the operation to two elements of the range).  In particular, the
+// result of a floating-point 'reduce' may differ from that of
+// 'std::accumulate', and may depend on the number of chunks, i.e., on the
+// policy and (if the policy does not specify the number of threads) on the
+// number of hardware threads.
+//
+///Scheduling
+///----------
+// The threads working on one algorithm take chunks dynamically, so that a
+// thread that finishes its chunk early (or a chunk that is cheaper than the
+// others) does not leave the other threads with more work.  'sort' and
+// 'stable_sort' first sort each chunk, and then merge pairs of sorted runs in
+// rounds; each merge is itself split into as many pieces as there are chunks
+// in the merged runs, by binary search for the element at which each piece
+// starts, so that every round, including the last, keeps all threads busy.
+// 'inclusive_scan' makes two passes over its range: one computing the total
+// of each chunk, and one scanning each chunk starting from the combined
+// totals of the preceding chunks.
+//
+///Scratch Memory
+///--------------
+// 'sort' and 'stable_sort' use a scratch buffer holding a copy of each element
+// of the range, and 'reduce' and 'inclusive_scan' use a buffer holding one
+// value per chunk.  These buffers are obtained from the allocator optionally
+// supplied to these algorithms, or from the currently installed default
+// allocator otherwise; no memory is allocated when a range is processed
+// serially.  Note that the elements of the scratch buffer of a sort are
+// assigned to concurrently, so that the allocator used by these elements (if
+// any) must be thread-safe.
+//
+///Thread Safety
+///-------------
+// When a range is split, the functions and function objects supplied to an
+// algorithm (including comparators and binary operations), and the element
+// operations they use, are called concurrently from several threads, on
+// distinct elements of the range.  Each thread uses its own copy of the
+// function object supplied to 'for_each', and may use its own copy of the
+// other function objects.
+//
+///Exceptions
+///----------
+// An exception cannot leave the thread on which it was thrown.  If a function
+// called by an algorithm throws while the range is split, 'std::terminate' is
+// called, as is done by the standard parallel algorithms.  Exceptions thrown
+// before the range is split (e.g., when allocating the scratch buffer), or
+// while a range is processed serially, propagate to the caller.
+//
+///'BSL_OVERRIDES_STD' Mode
+///-------------------------
+// This component has no standard counterpart, so no 'bsl+bslhdrs' header
+// includes it, and it is included directly in every mode.  In
+// 'BSL_OVERRIDES_STD' mode, '<vector>' must be included before this header,
+// so that the 'bslstl' containers that it uses are reached through their
+// standard headers.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Sorting and Summing a Large Vector
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have many 'int' values to sort and to sum, and want to use
+// several threads to do so.
+//
+// First, we fill a vector with pseudo-random values:
+//..
+//  enum { k_NUM_VALUES = 100000 };
+//
+//  bsl::vector<int> values(k_NUM_VALUES);
+//  unsigned int     state = 1;
+//  for (int i = 0; i < k_NUM_VALUES; ++i) {
+//      state     = state * 1103515245 + 12345;
+//      values[i] = static_cast<int>(state >> 16) % 1000;
+//  }
+//..
+// Then, we create a policy that uses up to four threads, and chunks of at
+// least 10000 elements:
+//..
+//  const bsls::ParallelPolicy policy(4, 10000);
+//..
+// Next, we sort the vector:
+//..
+//  bslstl::ParallelAlgorithmUtil::sort(policy, values.begin(), values.end());
+//
+//  for (int i = 1; i < k_NUM_VALUES; ++i) {
+//      assert(values[i - 1] <= values[i]);
+//  }
+//..
+// Now, we compute the sum of the values:
+//..
+//  const long long sum = bslstl::ParallelAlgorithmUtil::reduce(policy,
+//                                                              values.begin(),
+//                                                              values.end(),
+//                                                              0LL);
+//..
+// Finally, we check the sum against the serial algorithm:
+//..
+//  assert(std::accumulate(values.begin(), values.end(), 0LL) == sum);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECV
+#include <bslmf_removecv.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PARALLELUTIL
+#include <bsls_parallelutil.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // size_t
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_EXCEPTION
+#include <exception>  // 'terminate'
+#define INCLUDED_EXCEPTION
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>  // 'less', 'plus'
+#define INCLUDED_FUNCTIONAL
+#endif
+
+#ifndef INCLUDED_NUMERIC
+#include <numeric>  // 'accumulate'
+#define INCLUDED_NUMERIC
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ============================
+                        // struct ParallelAlgorithmUtil
+                        // ============================
+
+struct ParallelAlgorithmUtil {
+    // This 'struct' provides a namespace for standard algorithms on
+    // random-access ranges that split large ranges across threads as allowed
+    // by a 'bsls::ParallelPolicy'.  Each function has the contract of the
+    // corresponding standard algorithm, with the additional requirements
+    // described in the "Thread Safety" section of the component-level
+    // documentation.  The behavior of every function is undefined unless each
+    // iterator type is a random-access iterator type.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class OPERATION>
+    static void run(const OPERATION&            operation,
+                    int                         numChunks,
+                    const bsls::ParallelPolicy& policy);
+        // Apply the specified 'operation' to each chunk index in the range
+        // '[0, numChunks)' using the threads allowed by the specified
+        // 'policy'.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sortImp(const bsls::ParallelPolicy&  policy,
+                        RANDOM_ITER                  first,
+                        RANDOM_ITER                  last,
+                        const COMPARATOR&            comparator,
+                        bslma::Allocator            *basicAllocator,
+                        bool                         stable);
+        // Sort the range '[first, last)' using the specified 'comparator',
+        // the specified 'policy', and the specified 'basicAllocator' for the
+        // scratch buffer, sorting each chunk with 'std::stable_sort' if the
+        // specified 'stable' is 'true', and with 'std::sort' otherwise.
+
+  public:
+    // CLASS METHODS
+    template <class RANDOM_ITER, class FUNCTION>
+    static void for_each(const bsls::ParallelPolicy& policy,
+                         RANDOM_ITER                 first,
+                         RANDOM_ITER                 last,
+                         const FUNCTION&             function);
+        // Call a copy of the specified 'function' on each element of the
+        // range '[first, last)', splitting the range as allowed by the
+        // specified 'policy'.  Note that the order of the calls is
+        // unspecified.
+
+    template <class RANDOM_ITER, class OUTPUT_ITER, class OPERATION>
+    static OUTPUT_ITER transform(const bsls::ParallelPolicy& policy,
+                                 RANDOM_ITER                 first,
+                                 RANDOM_ITER                 last,
+                                 OUTPUT_ITER                 result,
+                                 const OPERATION&            operation);
+        // Assign the result of applying the specified unary 'operation' to
+        // each element of the range '[first, last)' to the corresponding
+        // element of the range starting at the specified 'result', splitting
+        // the range as allowed by the specified 'policy', and return the end
+        // of the output range.  The behavior is undefined unless the output
+        // range either is '[first, last)' or does not overlap it.
+
+    template <class RANDOM_ITER1,
+              class RANDOM_ITER2,
+              class OUTPUT_ITER,
+              class OPERATION>
+    static OUTPUT_ITER transform(const bsls::ParallelPolicy& policy,
+                                 RANDOM_ITER1                first1,
+                                 RANDOM_ITER1                last1,
+                                 RANDOM_ITER2                first2,
+                                 OUTPUT_ITER                 result,
+                                 const OPERATION&            operation);
+        // Assign the result of applying the specified binary 'operation' to
+        // each element of the range '[first1, last1)' and the corresponding
+        // element of the range starting at the specified 'first2' to the
+        // corresponding element of the range starting at the specified
+        // 'result', splitting the ranges as allowed by the specified
+        // 'policy', and return the end of the output range.  The behavior is
+        // undefined unless the output range either is one of the input ranges
+        // or does not overlap them.
+
+    template <class RANDOM_ITER, class TYPE>
+    static TYPE reduce(const bsls::ParallelPolicy& policy,
+                       RANDOM_ITER                 first,
+                       RANDOM_ITER                 last,
+                       const TYPE&                 init);
+    template <class RANDOM_ITER, class TYPE, class BINARY_OPERATION>
+    static TYPE reduce(const bsls::ParallelPolicy&  policy,
+                       RANDOM_ITER                  first,
+                       RANDOM_ITER                  last,
+                       const TYPE&                  init,
+                       const BINARY_OPERATION&      operation,
+                       bslma::Allocator            *basicAllocator = 0);
+        // Return the result of combining the specified 'init' with the
+        // elements of the range '[first, last)' using the optionally
+        // specified 'operation', or 'operator+' if 'operation' is not
+        // specified, splitting the range as allowed by the specified
+        // 'policy'.  Optionally specify a 'basicAllocator' used to supply
+        // scratch memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The result is that of
+        // 'std::accumulate(first, last, init, operation)' if the range is not
+        // split, and otherwise that of combining, in order, 'init' and the
+        // combined elements of each chunk.  The behavior is undefined unless
+        // 'operation' is associative.  See {Results}.
+
+    template <class RANDOM_ITER, class OUTPUT_ITER>
+    static OUTPUT_ITER inclusive_scan(const bsls::ParallelPolicy& policy,
+                                      RANDOM_ITER                 first,
+                                      RANDOM_ITER                 last,
+                                      OUTPUT_ITER                 result);
+    template <class RANDOM_ITER, class OUTPUT_ITER, class BINARY_OPERATION>
+    static OUTPUT_ITER inclusive_scan(
+                              const bsls::ParallelPolicy&  policy,
+                              RANDOM_ITER                  first,
+                              RANDOM_ITER                  last,
+                              OUTPUT_ITER                  result,
+                              const BINARY_OPERATION&      operation,
+                              bslma::Allocator            *basicAllocator = 0);
+        // Assign to each element of the range starting at the specified
+        // 'result' the combination of the elements of the range
+        // '[first, last)' up to and including the corresponding element,
+        // using the optionally specified 'operation', or 'operator+' if
+        // 'operation' is not specified, splitting the range as allowed by the
+        // specified 'policy', and return the end of the output range.
+        // Optionally specify a 'basicAllocator' used to supply scratch
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'operation' is
+        // associative, and the output range either is '[first, last)' or
+        // does not overlap it.  See {Results}.
+
+    template <class RANDOM_ITER>
+    static void sort(const bsls::ParallelPolicy& policy,
+                     RANDOM_ITER                 first,
+                     RANDOM_ITER                 last);
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sort(const bsls::ParallelPolicy&  policy,
+                     RANDOM_ITER                  first,
+                     RANDOM_ITER                  last,
+                     const COMPARATOR&            comparator,
+                     bslma::Allocator            *basicAllocator = 0);
+        // Sort the elements of the range '[first, last)' in non-descending
+        // order according to the optionally specified 'comparator', or
+        // 'operator<' if 'comparator' is not specified, splitting the range
+        // as allowed by the specified 'policy'.  Optionally specify a
+        // 'basicAllocator' used to supply scratch memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The order of equivalent elements is unspecified.  The
+        // behavior is undefined unless 'comparator' induces a strict weak
+        // ordering on the elements.
+
+    template <class RANDOM_ITER>
+    static void stable_sort(const bsls::ParallelPolicy& policy,
+                            RANDOM_ITER                 first,
+                            RANDOM_ITER                 last);
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void stable_sort(const bsls::ParallelPolicy&  policy,
+                            RANDOM_ITER                  first,
+                            RANDOM_ITER                  last,
+                            const COMPARATOR&            comparator,
+                            bslma::Allocator            *basicAllocator = 0);
+        // Sort the elements of the range '[first, last)' in non-descending
+        // order according to the optionally specified 'comparator', or
+        // 'operator<' if 'comparator' is not specified, splitting the range
+        // as allowed by the specified 'policy', and keeping equivalent
+        // elements in their original order.  Optionally specify a
+        // 'basicAllocator' used to supply scratch memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'comparator' induces a
+        // strict weak ordering on the elements.
+};
+
+                      // ===================================
+                      // class ParallelAlgorithmUtil_Chunks
+                      // ===================================
+
+class ParallelAlgorithmUtil_Chunks {
+    // This component-private class describes the split of a range into
+    // chunks whose sizes differ by at most one.
+
+    // DATA
+    std::size_t d_numElements;  // number of elements in the range
+    int         d_numChunks;    // number of chunks
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Chunks(std::size_t numElements, int numChunks);
+        // Create a split of a range of the specified 'numElements' elements
+        // into the specified 'numChunks' chunks.
+
+    // ACCESSORS
+    std::size_t begin(int chunkIndex) const;
+        // Return the index of the first element of the chunk having the
+        // specified 'chunkIndex', or the number of elements if 'chunkIndex'
+        // is the number of chunks.
+
+    int numChunks() const;
+        // Return the number of chunks.
+};
+
+                      // ====================================
+                      // struct ParallelAlgorithmUtil_Task<OP>
+                      // ====================================
+
+template <class OPERATION>
+struct ParallelAlgorithmUtil_Task {
+    // This component-private 'struct' provides the task function applying an
+    // operation to a chunk.
+
+    // CLASS METHODS
+    static void run(void *operation, int chunkIndex);
+        // Apply the operation at the specified 'operation' address to the
+        // specified 'chunkIndex', and call 'std::terminate' if it throws.
+};
+
+                // ==================================================
+                // class ParallelAlgorithmUtil_ForEach<ITER, FUNCTION>
+                // ==================================================
+
+template <class RANDOM_ITER, class FUNCTION>
+class ParallelAlgorithmUtil_ForEach {
+    // This component-private class calls a function on each element of a
+    // chunk of a range.
+
+    // DATA
+    RANDOM_ITER                  d_first;       // start of the range
+    ParallelAlgorithmUtil_Chunks d_chunks;      // split of the range
+    const FUNCTION              *d_function_p;  // function to call
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_ForEach(RANDOM_ITER                         first,
+                                  const ParallelAlgorithmUtil_Chunks& chunks,
+                                  const FUNCTION&                     func);
+        // Create an operation calling a copy of the specified 'func' on each
+        // element of the chunks, described by the specified 'chunks', of the
+        // range starting at the specified 'first'.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Call the function on each element of the chunk having the specified
+        // 'chunkIndex'.
+};
+
+             // =========================================================
+             // class ParallelAlgorithmUtil_Transform<ITER, OUTPUT, OP>
+             // =========================================================
+
+template <class RANDOM_ITER, class OUTPUT_ITER, class OPERATION>
+class ParallelAlgorithmUtil_Transform {
+    // This component-private class applies a unary operation to the elements
+    // of a chunk of a range.
+
+    // DATA
+    RANDOM_ITER                   d_first;        // start of the input
+    OUTPUT_ITER                   d_result;       // start of the output
+    ParallelAlgorithmUtil_Chunks  d_chunks;       // split of the range
+    const OPERATION              *d_operation_p;  // operation to apply
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Transform(
+                                 RANDOM_ITER                         first,
+                                 OUTPUT_ITER                         result,
+                                 const ParallelAlgorithmUtil_Chunks& chunks,
+                                 const OPERATION&                    op);
+        // Create an operation assigning the result of the specified 'op'
+        // applied to each element of the chunks, described by the specified
+        // 'chunks', of the range starting at the specified 'first' to the
+        // range starting at the specified 'result'.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Transform the chunk having the specified 'chunkIndex'.
+};
+
+       // ====================================================================
+       // class ParallelAlgorithmUtil_Transform2<ITER1, ITER2, OUTPUT, OP>
+       // ====================================================================
+
+template <class RANDOM_ITER1,
+          class RANDOM_ITER2,
+          class OUTPUT_ITER,
+          class OPERATION>
+class ParallelAlgorithmUtil_Transform2 {
+    // This component-private class applies a binary operation to the
+    // elements of a chunk of two ranges.
+
+    // DATA
+    RANDOM_ITER1                  d_first1;       // start of the first input
+    RANDOM_ITER2                  d_first2;       // start of the second input
+    OUTPUT_ITER                   d_result;       // start of the output
+    ParallelAlgorithmUtil_Chunks  d_chunks;       // split of the ranges
+    const OPERATION              *d_operation_p;  // operation to apply
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Transform2(
+                                 RANDOM_ITER1                        first1,
+                                 RANDOM_ITER2                        first2,
+                                 OUTPUT_ITER                         result,
+                                 const ParallelAlgorithmUtil_Chunks& chunks,
+                                 const OPERATION&                    op);
+        // Create an operation assigning the result of the specified 'op'
+        // applied to the corresponding elements of the chunks, described by
+        // the specified 'chunks', of the ranges starting at the specified
+        // 'first1' and 'first2' to the range starting at the specified
+        // 'result'.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Transform the chunk having the specified 'chunkIndex'.
+};
+
+              // ======================================================
+              // class ParallelAlgorithmUtil_Reduce<ITER, TYPE, OP>
+              // ======================================================
+
+template <class RANDOM_ITER, class TYPE, class BINARY_OPERATION>
+class ParallelAlgorithmUtil_Reduce {
+    // This component-private class combines the elements of a chunk of a
+    // range.
+
+    // DATA
+    RANDOM_ITER                   d_first;        // start of the range
+    TYPE                         *d_totals_p;     // result of each chunk
+    ParallelAlgorithmUtil_Chunks  d_chunks;       // split of the range
+    const BINARY_OPERATION       *d_operation_p;  // combining operation
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Reduce(RANDOM_ITER                         first,
+                                 TYPE                               *totals,
+                                 const ParallelAlgorithmUtil_Chunks& chunks,
+                                 const BINARY_OPERATION&             op);
+        // Create an operation assigning the combination, by the specified
+        // 'op', of the elements of each chunk, described by the specified
+        // 'chunks', of the range starting at the specified 'first' to the
+        // corresponding element of the array at the specified 'totals'.  The
+        // behavior is undefined unless no chunk is empty.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Combine the elements of the chunk having the specified
+        // 'chunkIndex'.
+};
+
+          // ==============================================================
+          // class ParallelAlgorithmUtil_Scan<ITER, OUTPUT, TYPE, OP>
+          // ==============================================================
+
+template <class RANDOM_ITER,
+          class OUTPUT_ITER,
+          class TYPE,
+          class BINARY_OPERATION>
+class ParallelAlgorithmUtil_Scan {
+    // This component-private class computes the inclusive scan of a chunk of
+    // a range, starting from the combined elements of the preceding chunks.
+
+    // DATA
+    RANDOM_ITER                   d_first;        // start of the input
+    OUTPUT_ITER                   d_result;       // start of the output
+    const TYPE                   *d_prefixes_p;   // combination of the
+                                                  // chunks up to each chunk
+    ParallelAlgorithmUtil_Chunks  d_chunks;       // split of the range
+    const BINARY_OPERATION       *d_operation_p;  // combining operation
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Scan(RANDOM_ITER                         first,
+                               OUTPUT_ITER                         result,
+                               const TYPE                         *prefixes,
+                               const ParallelAlgorithmUtil_Chunks& chunks,
+                               const BINARY_OPERATION&             op);
+        // Create an operation scanning, with the specified 'op', each chunk,
+        // described by the specified 'chunks', of the range starting at the
+        // specified 'first' into the range starting at the specified
+        // 'result', starting each chunk but the first from the element of the
+        // array at the specified 'prefixes' corresponding to the preceding
+        // chunk.  The behavior is undefined unless no chunk is empty.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Scan the chunk having the specified 'chunkIndex'.
+};
+
+                // ===============================================
+                // class ParallelAlgorithmUtil_Sort<ITER, COMPARE>
+                // ===============================================
+
+template <class RANDOM_ITER, class COMPARATOR>
+class ParallelAlgorithmUtil_Sort {
+    // This component-private class sorts a chunk of a range.
+
+    // DATA
+    RANDOM_ITER                   d_first;         // start of the range
+    ParallelAlgorithmUtil_Chunks  d_chunks;        // split of the range
+    const COMPARATOR             *d_comparator_p;  // ordering
+    bool                          d_stable;        // whether to keep the
+                                                   // order of equivalent
+                                                   // elements
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Sort(RANDOM_ITER                         first,
+                               const ParallelAlgorithmUtil_Chunks& chunks,
+                               const COMPARATOR&                   comparator,
+                               bool                                stable);
+        // Create an operation sorting, according to the specified
+        // 'comparator', each chunk, described by the specified 'chunks', of
+        // the range starting at the specified 'first', with
+        // 'std::stable_sort' if the specified 'stable' is 'true', and with
+        // 'std::sort' otherwise.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Sort the chunk having the specified 'chunkIndex'.
+};
+
+        // ===============================================================
+        // class ParallelAlgorithmUtil_Merge<SOURCE, TARGET, COMPARE>
+        // ===============================================================
+
+template <class SOURCE_ITER, class TARGET_ITER, class COMPARATOR>
+class ParallelAlgorithmUtil_Merge {
+    // This component-private class performs one round of merges of a range
+    // made of sorted runs of 'width' chunks each: each pair of adjacent runs
+    // is merged into the corresponding part of a target range, and each
+    // chunk of the target range is produced independently, starting at the
+    // position in each run found by binary search.
+
+    // DATA
+    SOURCE_ITER                   d_source;        // start of the source
+    TARGET_ITER                   d_target;        // start of the target
+    ParallelAlgorithmUtil_Chunks  d_chunks;        // split of the ranges
+    int                           d_width;         // chunks per sorted run
+    const COMPARATOR             *d_comparator_p;  // ordering
+
+    // PRIVATE ACCESSORS
+    std::size_t split(SOURCE_ITER lhs,
+                      std::size_t lhsLength,
+                      SOURCE_ITER rhs,
+                      std::size_t rhsLength,
+                      std::size_t numMerged) const;
+        // Return the number of elements of the sorted range of the specified
+        // 'lhsLength' elements starting at the specified 'lhs' that are among
+        // the first 'numMerged' elements of the stable merge of that range
+        // with the sorted range of the specified 'rhsLength' elements
+        // starting at the specified 'rhs'.  The behavior is undefined unless
+        // 'numMerged <= lhsLength + rhsLength'.
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Merge(SOURCE_ITER                         source,
+                                TARGET_ITER                         target,
+                                const ParallelAlgorithmUtil_Chunks& chunks,
+                                int                                 width,
+                                const COMPARATOR&                   compare);
+        // Create an operation merging, according to the specified 'compare',
+        // each pair of adjacent sorted runs of the specified 'width' chunks,
+        // described by the specified 'chunks', of the range starting at the
+        // specified 'source' into the range starting at the specified
+        // 'target'.  The behavior is undefined unless '0 < width'.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Produce the chunk of the target range having the specified
+        // 'chunkIndex'.
+};
+
+                // ===============================================
+                // class ParallelAlgorithmUtil_Copy<SOURCE, TARGET>
+                // ===============================================
+
+template <class SOURCE_ITER, class TARGET_ITER>
+class ParallelAlgorithmUtil_Copy {
+    // This component-private class copies a chunk of a range.
+
+    // DATA
+    SOURCE_ITER                  d_source;  // start of the source
+    TARGET_ITER                  d_target;  // start of the target
+    ParallelAlgorithmUtil_Chunks d_chunks;  // split of the ranges
+
+  public:
+    // CREATORS
+    ParallelAlgorithmUtil_Copy(SOURCE_ITER                         source,
+                               TARGET_ITER                         target,
+                               const ParallelAlgorithmUtil_Chunks& chunks);
+        // Create an operation assigning each chunk, described by the
+        // specified 'chunks', of the range starting at the specified 'source'
+        // to the range starting at the specified 'target'.
+
+    // ACCESSORS
+    void operator()(int chunkIndex) const;
+        // Copy the chunk having the specified 'chunkIndex'.
+};
+
+// ============================================================================
+//                      TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // -----------------------------------
+                      // class ParallelAlgorithmUtil_Chunks
+                      // -----------------------------------
+
+// CREATORS
+inline
+ParallelAlgorithmUtil_Chunks::ParallelAlgorithmUtil_Chunks(
+                                                       std::size_t numElements,
+                                                       int         numChunks)
+: d_numElements(numElements)
+, d_numChunks(numChunks)
+{
+}
+
+// ACCESSORS
+inline
+std::size_t ParallelAlgorithmUtil_Chunks::begin(int chunkIndex) const
+{
+    return bsls::ParallelUtil::chunkBegin(d_numElements,
+                                          d_numChunks,
+                                          chunkIndex);
+}
+
+inline
+int ParallelAlgorithmUtil_Chunks::numChunks() const
+{
+    return d_numChunks;
+}
+
+                      // ------------------------------------
+                      // struct ParallelAlgorithmUtil_Task<OP>
+                      // ------------------------------------
+
+// CLASS METHODS
+template <class OPERATION>
+void ParallelAlgorithmUtil_Task<OPERATION>::run(void *operation,
+                                                int   chunkIndex)
+{
+    BSLS_TRY {
+        (*static_cast<const OPERATION *>(operation))(chunkIndex);
+    }
+    BSLS_CATCH(...) {
+        native_std::terminate();
+    }
+}
+
+                // --------------------------------------------------
+                // class ParallelAlgorithmUtil_ForEach<ITER, FUNCTION>
+                // --------------------------------------------------
+
+// CREATORS
+template <class RANDOM_ITER, class FUNCTION>
+inline
+ParallelAlgorithmUtil_ForEach<RANDOM_ITER, FUNCTION>::
+ParallelAlgorithmUtil_ForEach(RANDOM_ITER                         first,
+                              const ParallelAlgorithmUtil_Chunks& chunks,
+                              const FUNCTION&                     func)
+: d_first(first)
+, d_chunks(chunks)
+, d_function_p(&func)
+{
+}
+
+// ACCESSORS
+template <class RANDOM_ITER, class FUNCTION>
+void ParallelAlgorithmUtil_ForEach<RANDOM_ITER, FUNCTION>::operator()(
+                                                          int chunkIndex) const
+{
+    native_std::for_each(d_first + d_chunks.begin(chunkIndex),
+                         d_first + d_chunks.begin(chunkIndex + 1),
+                         *d_function_p);
+}
+
+             // ---------------------------------------------------------
+             // class ParallelAlgorithmUtil_Transform<ITER, OUTPUT, OP>
+             // ---------------------------------------------------------
+
+// CREATORS
+template <class RANDOM_ITER, class OUTPUT_ITER, class OPERATION>
+inline
+ParallelAlgorithmUtil_Transform<RANDOM_ITER, OUTPUT_ITER, OPERATION>::
+ParallelAlgorithmUtil_Transform(RANDOM_ITER                         first,
+                                OUTPUT_ITER                         result,
+                                const ParallelAlgorithmUtil_Chunks& chunks,
+                                const OPERATION&                    op)
+: d_first(first)
+, d_result(result)
+, d_chunks(chunks)
+, d_operation_p(&op)
+{
+}
+
+// ACCESSORS
+template <class RANDOM_ITER, class OUTPUT_ITER, class OPERATION>
+void
+ParallelAlgorithmUtil_Transform<RANDOM_ITER, OUTPUT_ITER, OPERATION>::
+                                               operator()(int chunkIndex) const
+{
+    const std::size_t begin = d_chunks.begin(chunkIndex);
+
+    native_std::transform(d_first + begin,
+                          d_first + d_chunks.begin(chunkIndex + 1),
+                          d_result + begin,
+                          *d_operation_p);
+}
+
+       // --------------------------------------------------------------------
+       // class ParallelAlgorithmUtil_Transform2<ITER1, ITER2, OUTPUT, OP>
+       // --------------------------------------------------------------------
+
+// CREATORS
+template <class RANDOM_ITER1,
+          class RANDOM_ITER2,
+          class OUTPUT_ITER,
+          class OPERATION>
+inline
+ParallelAlgorithmUtil_Transform2<RANDOM_ITER1,
+                                 RANDOM_ITER2,
+                                 OUTPUT_ITER,
+                                 OPERATION>::
+ParallelAlgorithmUtil_Transform2(RANDOM_ITER1                        first1,
+                                 RANDOM_ITER2                        first2,
+                                 OUTPUT_ITER                         result,
+                                 const ParallelAlgorithmUtil_Chunks& chunks,
+                                 const OPERATION&                    op)
+: d_first1(first1)
+, d_first2(first2)
+, d_result(result)
+, d_chunks(chunks)
+, d_operation_p(&op)
+{
+}
+
+// ACCESSORS
+template <class RANDOM_ITER1,
+          class RANDOM_ITER2,
+          class OUTPUT_ITER,
+          class OPERATION>
+void ParallelAlgorithmUtil_Transform2<RANDOM_ITER1,
+                                      RANDOM_ITER2,
+                                      OUTPUT_ITER,
+                                      OPERATION>::
+                                               operator()(int chunkIndex) const
+{
+    const std::size_t begin = d_chunks.begin(chunkIndex);
+
+    native_std::transform(d_first1 + begin,
+                          d_first1 + d_chunks.begin(chunkIndex + 1),
+                          d_first2 + begin,
+                          d_result + begin,
+                          *d_operation_p);
+}
+
+              // ------------------------------------------------------
+              // class ParallelAlgorithmUtil_Reduce<ITER, TYPE, OP>
+              // ------------------------------------------------------
+
+// CREATORS
+template <class RANDOM_ITER, class TYPE, class BINARY_OPERATION>
+inline
+ParallelAlgorithmUtil_Reduce<RANDOM_ITER, TYPE, BINARY_OPERATION>::
+ParallelAlgorithmUtil_Reduce(RANDOM_ITER                         first,
+                             TYPE                               *totals,
+                             const ParallelAlgorithmUtil_Chunks& chunks,
+                             const BINARY_OPERATION&             op)
+: d_first(first)
+, d_totals_p(totals)
+, d_chunks(chunks)
+, d_operation_p(&op)
+{
+}
+
+// ACCESSORS
+template <class RANDOM_ITER, class TYPE, class BINARY_OPERATION>
+void ParallelAlgorithmUtil_Reduce<RANDOM_ITER, TYPE, BINARY_OPERATION>::
+                                               operator()(int chunkIndex) const
+{
+    RANDOM_ITER       it   = d_first + d_chunks.begin(chunkIndex);
+    const RANDOM_ITER last = d_first + d_chunks.begin(chunkIndex + 1);
+
+    TYPE total(*it);
+    for (++it; it != last; ++it) {
+        total = (*d_operation_p)(total, *it);
+    }
+    d_totals_p[chunkIndex] = total;
+}
+
+          // --------------------------------------------------------------
+          // class ParallelAlgorithmUtil_Scan<ITER, OUTPUT, TYPE, OP>
+          // --------------------------------------------------------------
+
+// CREATORS
+template <class RANDOM_ITER,
+          class OUTPUT_ITER,
+          class TYPE,
+          class BINARY_OPERATION>
+inline
+ParallelAlgorithmUtil_Scan<RANDOM_ITER, OUTPUT_ITER, TYPE, BINARY_OPERATION>::
+ParallelAlgorithmUtil_Scan(RANDOM_ITER                         first,
+                           OUTPUT_ITER                         result,
+                           const TYPE                         *prefixes,
+                           const ParallelAlgorithmUtil_Chunks& chunks,
+                           const BINARY_OPERATION&             op)
+: d_first(first)
+, d_result(result)
+, d_prefixes_p(prefixes)
+, d_chunks(chunks)
+, d_operation_p(&op)
+{
+}
+
+// ACCESSORS
+template <class RANDOM_ITER,
+          class OUTPUT_ITER,
+          class TYPE,
+          class BINARY_OPERATION>
+void
+ParallelAlgorithmUtil_Scan<RANDOM_ITER, OUTPUT_ITER, TYPE, BINARY_OPERATION>::
+                                               operator()(int chunkIndex) const
+{
+    const std::size_t begin = d_chunks.begin(chunkIndex);
+
+    RANDOM_ITER       it     = d_first + begin;
+    const RANDOM_ITER last   = d_first + d_chunks.begin(chunkIndex + 1);
+    OUTPUT_ITER       output = d_result + begin;
+
+    TYPE total(0 == chunkIndex
+               ? TYPE(*it)
+               : TYPE((*d_operation_p)(d_prefixes_p[chunkIndex - 1], *it)));
+    *output = total;
+    for (++it, ++output; it != last; ++it, ++output) {
+        total   = (*d_operation_p)(total, *it);
+        *output = total;
+    }
+}
+
+                // -----------------------------------------------
+                // class ParallelAlgorithmUtil_Sort<ITER, COMPARE>
+                // -----------------------------------------------
+
+// CREATORS
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+ParallelAlgorithmUtil_Sort<RANDOM_ITER, COMPARATOR>::
+ParallelAlgorithmUtil_Sort(RANDOM_ITER                         first,
+                           const ParallelAlgorithmUtil_Chunks& chunks,
+                           const COMPARATOR&                   comparator,
+                           bool                                stable)
+: d_first(first)
+, d_chunks(chunks)
+, d_comparator_p(&comparator)
+, d_stable(stable)
+{
+}
+
+// ACCESSORS
+template <class RANDOM_ITER, class COMPARATOR>
+void ParallelAlgorithmUtil_Sort<RANDOM_ITER, COMPARATOR>::operator()(
+                                                          int chunkIndex) const
+{
+    const RANDOM_ITER first = d_first + d_chunks.begin(chunkIndex);
+    const RANDOM_ITER last  = d_first + d_chunks.begin(chunkIndex + 1);
+
+    if (d_stable) {
+        native_std::stable_sort(first, last, *d_comparator_p);
+    }
+    else {
+        native_std::sort(first, last, *d_comparator_p);
+    }
+}
+
+        // ---------------------------------------------------------------
+        // class ParallelAlgorithmUtil_Merge<SOURCE, TARGET, COMPARE>
+        // ---------------------------------------------------------------
+
+// PRIVATE ACCESSORS
+template <class SOURCE_ITER, class TARGET_ITER, class COMPARATOR>
+std::size_t
+ParallelAlgorithmUtil_Merge<SOURCE_ITER, TARGET_ITER, COMPARATOR>::split(
+                                               SOURCE_ITER lhs,
+                                               std::size_t lhsLength,
+                                               SOURCE_ITER rhs,
+                                               std::size_t rhsLength,
+                                               std::size_t numMerged) const
+{
+    // Find the smallest 'i' such that the first 'i' elements of 'lhs' and
+    // the first 'numMerged - i' elements of 'rhs' are the first 'numMerged'
+    // elements of the merge.  The merge takes 'lhs[i]' before an equivalent
+    // 'rhs[j]', so 'i' is the first index at which 'rhs[numMerged - i - 1]'
+    // is less than 'lhs[i]', a predicate that is monotonic in 'i'.
+
+    std::size_t low  = numMerged > rhsLength ? numMerged - rhsLength : 0;
+    std::size_t high = numMerged < lhsLength ? numMerged : lhsLength;
+
+    while (low < high) {
+        const std::size_t middle = low + (high - low) / 2;
+        if ((*d_comparator_p)(rhs[numMerged - middle - 1], lhs[middle])) {
+            high = middle;
+        }
+        else {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
+// CREATORS
+template <class SOURCE_ITER, class TARGET_ITER, class COMPARATOR>
+inline
+ParallelAlgorithmUtil_Merge<SOURCE_ITER, TARGET_ITER, COMPARATOR>::
+ParallelAlgorithmUtil_Merge(SOURCE_ITER                         source,
+                            TARGET_ITER                         target,
+                            const ParallelAlgorithmUtil_Chunks& chunks,
+                            int                                 width,
+                            const COMPARATOR&                   compare)
+: d_source(source)
+, d_target(target)
+, d_chunks(chunks)
+, d_width(width)
+, d_comparator_p(&compare)
+{
+}
+
+// ACCESSORS
+template <class SOURCE_ITER, class TARGET_ITER, class COMPARATOR>
+void ParallelAlgorithmUtil_Merge<SOURCE_ITER, TARGET_ITER, COMPARATOR>::
+                                               operator()(int chunkIndex) const
+{
+    const int numChunks  = d_chunks.numChunks();
+    const int pairFirst  = chunkIndex / (2 * d_width) * (2 * d_width);
+    const int pairMiddle = native_std::min(pairFirst + d_width, numChunks);
+    const int pairLast   = native_std::min(pairFirst + 2 * d_width,
+                                           numChunks);
+
+    const std::size_t lhsBegin = d_chunks.begin(pairFirst);
+    const std::size_t rhsBegin = d_chunks.begin(pairMiddle);
+    const std::size_t rhsEnd   = d_chunks.begin(pairLast);
+
+    const SOURCE_ITER lhs       = d_source + lhsBegin;
+    const SOURCE_ITER rhs       = d_source + rhsBegin;
+    const std::size_t lhsLength = rhsBegin - lhsBegin;
+    const std::size_t rhsLength = rhsEnd - rhsBegin;
+
+    const std::size_t begin = d_chunks.begin(chunkIndex) - lhsBegin;
+    const std::size_t end   = d_chunks.begin(chunkIndex + 1) - lhsBegin;
+
+    const std::size_t lhsFirst = split(lhs, lhsLength, rhs, rhsLength, begin);
+    const std::size_t lhsLast  = split(lhs, lhsLength, rhs, rhsLength, end);
+
+    native_std::merge(lhs + lhsFirst,
+                      lhs + lhsLast,
+                      rhs + (begin - lhsFirst),
+                      rhs + (end - lhsLast),
+                      d_target + (lhsBegin + begin),
+                      *d_comparator_p);
+}
+
+                // -----------------------------------------------
+                // class ParallelAlgorithmUtil_Copy<SOURCE, TARGET>
+                // -----------------------------------------------
+
+// CREATORS
+template <class SOURCE_ITER, class TARGET_ITER>
+inline
+ParallelAlgorithmUtil_Copy<SOURCE_ITER, TARGET_ITER>::
+ParallelAlgorithmUtil_Copy(SOURCE_ITER                         source,
+                           TARGET_ITER                         target,
+                           const ParallelAlgorithmUtil_Chunks& chunks)
+: d_source(source)
+, d_target(target)
+, d_chunks(chunks)
+{
+}
+
+// ACCESSORS
+template <class SOURCE_ITER, class TARGET_ITER>
+void ParallelAlgorithmUtil_Copy<SOURCE_ITER, TARGET_ITER>::operator()(
+                                                          int chunkIndex) const
+{
+    const std::size_t begin = d_chunks.begin(chunkIndex);
+
+    native_std::copy(d_source + begin,
+                     d_source + d_chunks.begin(chunkIndex + 1),
+                     d_target + begin);
+}
+
+                        // ----------------------------
+                        // struct ParallelAlgorithmUtil
+                        // ----------------------------
+
+// PRIVATE CLASS METHODS
+template <class OPERATION>
+inline
+void ParallelAlgorithmUtil::run(const OPERATION&            operation,
+                                int                         numChunks,
+                                const bsls::ParallelPolicy& policy)
+{
+    bsls::ParallelUtil::run(&ParallelAlgorithmUtil_Task<OPERATION>::run,
+                            const_cast<OPERATION *>(&operation),
+                            numChunks,
+                            policy.numThreads());
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void ParallelAlgorithmUtil::sortImp(
+                                   const bsls::ParallelPolicy&  policy,
+                                   RANDOM_ITER                  first,
+                                   RANDOM_ITER                  last,
+                                   const COMPARATOR&            comparator,
+                                   bslma::Allocator            *basicAllocator,
+                                   bool                         stable)
+{
+    typedef typename bsl::remove_cv<
+            typename bsl::iterator_traits<RANDOM_ITER>::value_type>::type
+                                                                     ValueType;
+
+    const std::size_t numElements = last - first;
+    const int         numChunks   = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        if (stable) {
+            native_std::stable_sort(first, last, comparator);
+        }
+        else {
+            native_std::sort(first, last, comparator);
+        }
+        return;                                                       // RETURN
+    }
+
+    // The merges need a buffer of assignable elements; fill it with copies of
+    // the first element, as the vector does, in parallel.
+
+    bsl::vector<ValueType> scratch(numElements,
+                                   *first,
+                                   policy,
+                                   bsl::allocator<ValueType>(basicAllocator));
+    ValueType *buffer = scratch.data();
+
+    const ParallelAlgorithmUtil_Chunks chunks(numElements, numChunks);
+
+    run(ParallelAlgorithmUtil_Sort<RANDOM_ITER, COMPARATOR>(first,
+                                                            chunks,
+                                                            comparator,
+                                                            stable),
+        numChunks,
+        policy);
+
+    // Merge runs of 'width' chunks pairwise, alternating between the range
+    // and the buffer.
+
+    bool inBuffer = false;
+    for (int width = 1; width < numChunks; width *= 2) {
+        if (inBuffer) {
+            run(ParallelAlgorithmUtil_Merge<ValueType *,
+                                            RANDOM_ITER,
+                                            COMPARATOR>(buffer,
+                                                        first,
+                                                        chunks,
+                                                        width,
+                                                        comparator),
+                numChunks,
+                policy);
+        }
+        else {
+            run(ParallelAlgorithmUtil_Merge<RANDOM_ITER,
+                                            ValueType *,
+                                            COMPARATOR>(first,
+                                                        buffer,
+                                                        chunks,
+                                                        width,
+                                                        comparator),
+                numChunks,
+                policy);
+        }
+        inBuffer = !inBuffer;
+    }
+
+    if (inBuffer) {
+        run(ParallelAlgorithmUtil_Copy<ValueType *, RANDOM_ITER>(buffer,
+                                                                 first,
+                                                                 chunks),
+            numChunks,
+            policy);
+    }
+}
+
+// CLASS METHODS
+template <class RANDOM_ITER, class FUNCTION>
+void ParallelAlgorithmUtil::for_each(const bsls::ParallelPolicy& policy,
+                                     RANDOM_ITER                 first,
+                                     RANDOM_ITER                 last,
+                                     const FUNCTION&             function)
+{
+    const std::size_t numElements = last - first;
+    const int         numChunks   = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        native_std::for_each(first, last, function);
+        return;                                                       // RETURN
+    }
+
+    run(ParallelAlgorithmUtil_ForEach<RANDOM_ITER, FUNCTION>(
+                       first,
+                       ParallelAlgorithmUtil_Chunks(numElements, numChunks),
+                       function),
+        numChunks,
+        policy);
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER, class OPERATION>
+OUTPUT_ITER ParallelAlgorithmUtil::transform(
+                                         const bsls::ParallelPolicy& policy,
+                                         RANDOM_ITER                 first,
+                                         RANDOM_ITER                 last,
+                                         OUTPUT_ITER                 result,
+                                         const OPERATION&            operation)
+{
+    const std::size_t numElements = last - first;
+    const int         numChunks   = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        return native_std::transform(first, last, result, operation);
+                                                                      // RETURN
+    }
+
+    run(ParallelAlgorithmUtil_Transform<RANDOM_ITER, OUTPUT_ITER, OPERATION>(
+                       first,
+                       result,
+                       ParallelAlgorithmUtil_Chunks(numElements, numChunks),
+                       operation),
+        numChunks,
+        policy);
+    return result + numElements;
+}
+
+template <class RANDOM_ITER1,
+          class RANDOM_ITER2,
+          class OUTPUT_ITER,
+          class OPERATION>
+OUTPUT_ITER ParallelAlgorithmUtil::transform(
+                                         const bsls::ParallelPolicy& policy,
+                                         RANDOM_ITER1                first1,
+                                         RANDOM_ITER1                last1,
+                                         RANDOM_ITER2                first2,
+                                         OUTPUT_ITER                 result,
+                                         const OPERATION&            operation)
+{
+    const std::size_t numElements = last1 - first1;
+    const int         numChunks   = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        return native_std::transform(first1,
+                                     last1,
+                                     first2,
+                                     result,
+                                     operation);                      // RETURN
+    }
+
+    run(ParallelAlgorithmUtil_Transform2<RANDOM_ITER1,
+                                         RANDOM_ITER2,
+                                         OUTPUT_ITER,
+                                         OPERATION>(
+                       first1,
+                       first2,
+                       result,
+                       ParallelAlgorithmUtil_Chunks(numElements, numChunks),
+                       operation),
+        numChunks,
+        policy);
+    return result + numElements;
+}
+
+template <class RANDOM_ITER, class TYPE>
+inline
+TYPE ParallelAlgorithmUtil::reduce(const bsls::ParallelPolicy& policy,
+                                   RANDOM_ITER                 first,
+                                   RANDOM_ITER                 last,
+                                   const TYPE&                 init)
+{
+    return reduce(policy, first, last, init, native_std::plus<TYPE>());
+}
+
+template <class RANDOM_ITER, class TYPE, class BINARY_OPERATION>
+TYPE ParallelAlgorithmUtil::reduce(const bsls::ParallelPolicy&  policy,
+                                   RANDOM_ITER                  first,
+                                   RANDOM_ITER                  last,
+                                   const TYPE&                  init,
+                                   const BINARY_OPERATION&      operation,
+                                   bslma::Allocator            *basicAllocator)
+{
+    const std::size_t numElements = last - first;
+    const int         numChunks   = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        return native_std::accumulate(first, last, init, operation);
+                                                                      // RETURN
+    }
+
+    bsl::vector<TYPE> totals(numChunks,
+                             init,
+                             bsl::allocator<TYPE>(basicAllocator));
+
+    run(ParallelAlgorithmUtil_Reduce<RANDOM_ITER, TYPE, BINARY_OPERATION>(
+                       first,
+                       totals.data(),
+                       ParallelAlgorithmUtil_Chunks(numElements, numChunks),
+                       operation),
+        numChunks,
+        policy);
+
+    return native_std::accumulate(totals.begin(),
+                                  totals.end(),
+                                  init,
+                                  operation);
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER>
+inline
+OUTPUT_ITER ParallelAlgorithmUtil::inclusive_scan(
+                                            const bsls::ParallelPolicy& policy,
+                                            RANDOM_ITER                 first,
+                                            RANDOM_ITER                 last,
+                                            OUTPUT_ITER                 result)
+{
+    typedef typename bsl::remove_cv<
+            typename bsl::iterator_traits<RANDOM_ITER>::value_type>::type
+                                                                     ValueType;
+
+    return inclusive_scan(policy,
+                          first,
+                          last,
+                          result,
+                          native_std::plus<ValueType>());
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER, class BINARY_OPERATION>
+OUTPUT_ITER ParallelAlgorithmUtil::inclusive_scan(
+                                  const bsls::ParallelPolicy&  policy,
+                                  RANDOM_ITER                  first,
+                                  RANDOM_ITER                  last,
+                                  OUTPUT_ITER                  result,
+                                  const BINARY_OPERATION&      operation,
+                                  bslma::Allocator            *basicAllocator)
+{
+    typedef typename bsl::remove_cv<
+            typename bsl::iterator_traits<RANDOM_ITER>::value_type>::type
+                                                                     ValueType;
+
+    const std::size_t numElements = last - first;
+    const int         numChunks   = policy.numChunks(numElements);
+
+    if (1 == numChunks) {
+        if (0 < numElements) {
+            const ParallelAlgorithmUtil_Chunks whole(numElements, 1);
+            const ParallelAlgorithmUtil_Scan<RANDOM_ITER,
+                                             OUTPUT_ITER,
+                                             ValueType,
+                                             BINARY_OPERATION>
+                                      scan(first, result, 0, whole, operation);
+            scan(0);
+        }
+        return result + numElements;                                  // RETURN
+    }
+
+    const ParallelAlgorithmUtil_Chunks chunks(numElements, numChunks);
+
+    // Compute the total of each chunk, then turn the totals into the
+    // combination of all the chunks up to each chunk, and finally scan each
+    // chunk starting from the combination of the preceding chunks.  The
+    // total of the last chunk is never used.
+
+    bsl::vector<ValueType> prefixes(numChunks,
+                                    *first,
+                                    bsl::allocator<ValueType>(basicAllocator));
+
+    run(ParallelAlgorithmUtil_Reduce<RANDOM_ITER,
+                                     ValueType,
+                                     BINARY_OPERATION>(first,
+                                                       prefixes.data(),
+                                                       chunks,
+                                                       operation),
+        numChunks - 1,
+        policy);
+
+    for (int i = 1; i < numChunks - 1; ++i) {
+        prefixes[i] = operation(prefixes[i - 1], prefixes[i]);
+    }
+
+    run(ParallelAlgorithmUtil_Scan<RANDOM_ITER,
+                                   OUTPUT_ITER,
+                                   ValueType,
+                                   BINARY_OPERATION>(first,
+                                                     result,
+                                                     prefixes.data(),
+                                                     chunks,
+                                                     operation),
+        numChunks,
+        policy);
+    return result + numElements;
+}
+
+template <class RANDOM_ITER>
+inline
+void ParallelAlgorithmUtil::sort(const bsls::ParallelPolicy& policy,
+                                 RANDOM_ITER                 first,
+                                 RANDOM_ITER                 last)
+{
+    typedef typename bsl::remove_cv<
+            typename bsl::iterator_traits<RANDOM_ITER>::value_type>::type
+                                                                     ValueType;
+
+    sortImp(policy, first, last, native_std::less<ValueType>(), 0, false);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void ParallelAlgorithmUtil::sort(const bsls::ParallelPolicy&  policy,
+                                 RANDOM_ITER                  first,
+                                 RANDOM_ITER                  last,
+                                 const COMPARATOR&            comparator,
+                                 bslma::Allocator            *basicAllocator)
+{
+    sortImp(policy, first, last, comparator, basicAllocator, false);
+}
+
+template <class RANDOM_ITER>
+inline
+void ParallelAlgorithmUtil::stable_sort(const bsls::ParallelPolicy& policy,
+                                        RANDOM_ITER                 first,
+                                        RANDOM_ITER                 last)
+{
+    typedef typename bsl::remove_cv<
+            typename bsl::iterator_traits<RANDOM_ITER>::value_type>::type
+                                                                     ValueType;
+
+    sortImp(policy, first, last, native_std::less<ValueType>(), 0, true);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void ParallelAlgorithmUtil::stable_sort(
+                                  const bsls::ParallelPolicy&  policy,
+                                  RANDOM_ITER                  first,
+                                  RANDOM_ITER                  last,
+                                  const COMPARATOR&            comparator,
+                                  bslma::Allocator            *basicAllocator)
+{
+    sortImp(policy, first, last, comparator, basicAllocator, true);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
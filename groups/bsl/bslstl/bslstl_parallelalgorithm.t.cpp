@@ -0,0 +1,986 @@
+// bslstl_parallelalgorithm.t.cpp                                     -*-C++-*-
+#include <bslstl_parallelalgorithm.h>
+
+#include <bslstl_deque.h>                        // for testing only
+#include <bslstl_string.h>                       // for testing only
+#include <bslstl_vector.h>                       // for testing only
+
+#include <bslma_default.h>                       // for testing only
+#include <bslma_defaultallocatorguard.h>         // for testing only
+#include <bslma_newdeleteallocator.h>            // for testing only
+#include <bslma_testallocator.h>                 // for testing only
+#include <bsls_atomic.h>                         // for testing only
+#include <bsls_bsltestutil.h>                    // for testing only
+#include <bsls_parallelutil.h>                   // for testing only
+#include <bsls_stopwatch.h>                      // for testing only
+
+#include <algorithm>
+#include <numeric>
+
+#include <stdio.h>
+#include <stdlib.h>    // atoi()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides parallel versions of standard algorithms
+// that delegate to the serial algorithms of the platform library, on the whole
+// range when it is too small to split, and on each chunk otherwise.  The
+// concerns are therefore that each element is processed exactly once whatever
+// the policy and the size of the range, that the results are those of the
+// serial algorithms (including the order of operands for associative but
+// non-commutative operations, and the order of equivalent elements for
+// 'stable_sort'), that the algorithms work on both contiguous and
+// non-contiguous random-access ranges, and that scratch memory comes from the
+// supplied allocator and only when a range is split.
+//
+// Each function is tested on 'bsl::vector' and 'bsl::deque', for a table of
+// range sizes and policies, including policies that run every range serially,
+// and compared against the corresponding serial algorithm.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void for_each(const Policy& p, RIT f, RIT l, const FUNC& fn);
+// [ 3] OIT transform(const Policy& p, RIT f, RIT l, OIT r, const OP& op);
+// [ 3] OIT transform(const Policy& p, RIT1 f1, RIT1 l1, RIT2 f2, r, op);
+// [ 4] TYPE reduce(const Policy& p, RIT f, RIT l, const TYPE& init);
+// [ 4] TYPE reduce(const Policy& p, RIT f, RIT l, const TYPE& i, op, ba);
+// [ 5] OIT inclusive_scan(const Policy& p, RIT f, RIT l, OIT r);
+// [ 5] OIT inclusive_scan(const Policy& p, RIT f, RIT l, OIT r, op, *ba);
+// [ 6] void sort(const Policy& p, RIT f, RIT l);
+// [ 6] void sort(const Policy& p, RIT f, RIT l, const COMP& c, *ba);
+// [ 6] void stable_sort(const Policy& p, RIT f, RIT l);
+// [ 6] void stable_sort(const Policy& p, RIT f, RIT l, const COMP& c, ba);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS/TYPES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::ParallelAlgorithmUtil Obj;
+typedef bsls::ParallelPolicy          Policy;
+
+static bool verbose;
+static bool veryVerbose;
+
+static const int SIZES[] = { 0, 1, 2, 3, 7, 16, 31, 64, 100, 257, 1000 };
+enum { NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+static const Policy POLICIES[] = {
+    Policy::serial(),
+    Policy(),
+    Policy(2, 1),
+    Policy(3, 5),
+    Policy(4, 1),
+    Policy(8, 16),
+    Policy(64, 1),
+};
+enum { NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES };
+
+static int randomValue(unsigned int *state, int range)
+    // Return a pseudo-random value in the range '[0, range)' computed from,
+    // and advancing, the specified 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return static_cast<int>((*state >> 16) % static_cast<unsigned>(range));
+}
+
+                               // ==============
+                               // struct Counter
+                               // ==============
+
+struct Counter {
+    // This function object increments each element it is called on, and
+    // counts the number of calls made on all of its copies.
+
+    // DATA
+    bsls::AtomicInt *d_numCalls_p;  // number of calls (held, not owned)
+
+    // ACCESSORS
+    void operator()(int& value) const
+        // Increment the specified 'value' and count the call.
+    {
+        ++value;
+        d_numCalls_p->add(1);
+    }
+};
+
+                               // =============
+                               // struct Negate
+                               // =============
+
+struct Negate {
+    // This function object returns the negation of its argument.
+
+    int operator()(int value) const
+        // Return '-value' for the specified 'value'.
+    {
+        return -value;
+    }
+};
+
+struct Weigh {
+    // This function object returns a weighted sum of its arguments.
+
+    int operator()(int lhs, int rhs) const
+        // Return '3 * lhs + rhs' for the specified 'lhs' and 'rhs'.
+    {
+        return 3 * lhs + rhs;
+    }
+};
+
+                               // =============
+                               // struct Concat
+                               // =============
+
+struct Concat {
+    // This function object concatenates two strings, an associative but not
+    // commutative operation.
+
+    bsl::string operator()(const bsl::string& lhs,
+                           const bsl::string& rhs) const
+        // Return the concatenation of the specified 'lhs' and 'rhs'.
+    {
+        return lhs + rhs;
+    }
+};
+
+                               // ============
+                               // struct Keyed
+                               // ============
+
+struct Keyed {
+    // This 'struct' holds a key, by which objects are ordered, and the
+    // original position of the object, by which stability is verified.
+
+    int d_key;       // sort key
+    int d_position;  // position before sorting
+};
+
+struct KeyLess {
+    // This function object orders 'Keyed' objects by key only.
+
+    bool operator()(const Keyed& lhs, const Keyed& rhs) const
+        // Return 'true' if the specified 'lhs' has a smaller key than the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_key < rhs.d_key;
+    }
+};
+
+struct Max {
+    // This function object returns the greater of its arguments.
+
+    int operator()(int lhs, int rhs) const
+        // Return the greater of the specified 'lhs' and 'rhs'.
+    {
+        return lhs < rhs ? rhs : lhs;
+    }
+};
+
+struct Greater {
+    // This function object orders 'int' values in descending order.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+//=============================================================================
+//                      TEST CASES IMPLEMENTATION
+//-----------------------------------------------------------------------------
+
+template <class CONTAINER>
+void testForEach()
+    // Test 'for_each' on ranges of the (template parameter) 'CONTAINER'.
+{
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N = SIZES[si];
+
+            CONTAINER mX;
+            for (int i = 0; i < N; ++i) {
+                mX.push_back(i);
+            }
+
+            bsls::AtomicInt numCalls(0);
+            const Counter   COUNTER = { &numCalls };
+
+            Obj::for_each(POLICY, mX.begin(), mX.end(), COUNTER);
+
+            LOOP2_ASSERT(pi, N, N == numCalls);
+            for (int i = 0; i < N; ++i) {
+                LOOP3_ASSERT(pi, N, i, i + 1 == mX[i]);
+            }
+        }
+    }
+}
+
+template <class CONTAINER>
+void testTransform()
+    // Test both overloads of 'transform' on ranges of the (template
+    // parameter) 'CONTAINER'.
+{
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N = SIZES[si];
+
+            unsigned int state = N + 1;
+            CONTAINER    mX;
+            CONTAINER    mY;
+            for (int i = 0; i < N; ++i) {
+                mX.push_back(randomValue(&state, 1000));
+                mY.push_back(randomValue(&state, 1000));
+            }
+            const CONTAINER& X = mX;
+            const CONTAINER& Y = mY;
+
+            CONTAINER mZ(N, -1);  const CONTAINER& Z = mZ;
+
+            typename CONTAINER::iterator end =
+                      Obj::transform(POLICY, X.begin(), X.end(), mZ.begin(),
+                                     Negate());
+            LOOP2_ASSERT(pi, N, mZ.end() == end);
+            for (int i = 0; i < N; ++i) {
+                LOOP3_ASSERT(pi, N, i, -X[i] == Z[i]);
+            }
+
+            end = Obj::transform(POLICY,
+                                 X.begin(),
+                                 X.end(),
+                                 Y.begin(),
+                                 mZ.begin(),
+                                 Weigh());
+            LOOP2_ASSERT(pi, N, mZ.end() == end);
+            for (int i = 0; i < N; ++i) {
+                LOOP3_ASSERT(pi, N, i, 3 * X[i] + Y[i] == Z[i]);
+            }
+
+            // In place.
+
+            CONTAINER mW(X);  const CONTAINER& W = mW;
+            end = Obj::transform(POLICY,
+                                 mW.begin(),
+                                 mW.end(),
+                                 Y.begin(),
+                                 mW.begin(),
+                                 Weigh());
+            LOOP2_ASSERT(pi, N, mW.end() == end);
+            LOOP2_ASSERT(pi, N, Z == W);
+        }
+    }
+}
+
+template <class CONTAINER>
+void testReduce()
+    // Test both overloads of 'reduce' on ranges of the (template parameter)
+    // 'CONTAINER' holding 'int', and on vectors of strings.
+{
+    bslma::TestAllocator ta("scratch", veryVerbose);
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N = SIZES[si];
+
+            unsigned int state = N + 1;
+            CONTAINER    mX;
+            for (int i = 0; i < N; ++i) {
+                mX.push_back(randomValue(&state, 1000) - 500);
+            }
+            const CONTAINER& X = mX;
+
+            const long long EXP = native_std::accumulate(X.begin(),
+                                                         X.end(),
+                                                         17LL);
+            LOOP2_ASSERT(pi, N,
+                         EXP == Obj::reduce(POLICY, X.begin(), X.end(), 17LL));
+
+            const int NUM_CHUNKS = POLICY.numChunks(N);
+
+            const bsls::Types::Int64 BLOCKS = ta.numBlocksTotal();
+
+            int expMax = 17;
+            for (int i = 0; i < N; ++i) {
+                expMax = native_std::max(expMax, X[i]);
+            }
+            LOOP2_ASSERT(pi, N, expMax == Obj::reduce(POLICY,
+                                                      X.begin(),
+                                                      X.end(),
+                                                      17,
+                                                      Max(),
+                                                      &ta));
+            LOOP2_ASSERT(pi, N, (1 < NUM_CHUNKS) ==
+                                           (BLOCKS < ta.numBlocksTotal()));
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+void testReduceStrings()
+    // Test 'reduce' with a non-commutative operation.
+{
+    bslma::TestAllocator ta("scratch", veryVerbose);
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N = SIZES[si];
+
+            bsl::vector<bsl::string> mX;
+            for (int i = 0; i < N; ++i) {
+                mX.push_back(bsl::string(1, static_cast<char>('a' + i % 26)));
+            }
+            const bsl::vector<bsl::string>& X = mX;
+
+            const bsl::string INIT("<");
+            const bsl::string EXP = native_std::accumulate(X.begin(),
+                                                           X.end(),
+                                                           INIT);
+
+            LOOP2_ASSERT(pi, N, EXP == Obj::reduce(POLICY,
+                                                   X.begin(),
+                                                   X.end(),
+                                                   INIT,
+                                                   Concat(),
+                                                   &ta));
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+template <class CONTAINER>
+void testInclusiveScan()
+    // Test both overloads of 'inclusive_scan' on ranges of the (template
+    // parameter) 'CONTAINER'.
+{
+    bslma::TestAllocator ta("scratch", veryVerbose);
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N = SIZES[si];
+
+            unsigned int state = N + 1;
+            CONTAINER    mX;
+            for (int i = 0; i < N; ++i) {
+                mX.push_back(randomValue(&state, 1000) - 500);
+            }
+            const CONTAINER& X = mX;
+
+            CONTAINER mEXP(X);  const CONTAINER& EXP = mEXP;
+            for (int i = 1; i < N; ++i) {
+                mEXP[i] += mEXP[i - 1];
+            }
+
+            CONTAINER mY(N, 0);  const CONTAINER& Y = mY;
+            typename CONTAINER::iterator end =
+                 Obj::inclusive_scan(POLICY, X.begin(), X.end(), mY.begin());
+            LOOP2_ASSERT(pi, N, mY.end() == end);
+            LOOP2_ASSERT(pi, N, EXP == Y);
+
+            // In place, with an operation and an allocator.
+
+            const int NUM_CHUNKS = POLICY.numChunks(N);
+
+            const bsls::Types::Int64 BLOCKS = ta.numBlocksTotal();
+
+            CONTAINER mZ(X);  const CONTAINER& Z = mZ;
+            end = Obj::inclusive_scan(POLICY,
+                                      mZ.begin(),
+                                      mZ.end(),
+                                      mZ.begin(),
+                                      Max(),
+                                      &ta);
+            LOOP2_ASSERT(pi, N, mZ.end() == end);
+            for (int i = 0; i < N; ++i) {
+                const int EXP_MAX =
+                        *native_std::max_element(X.begin(), X.begin() + i + 1);
+                LOOP3_ASSERT(pi, N, i, EXP_MAX == Z[i]);
+            }
+            LOOP2_ASSERT(pi, N, (1 < NUM_CHUNKS) ==
+                                           (BLOCKS < ta.numBlocksTotal()));
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+
+    if (verbose) printf("\tWith a non-commutative operation.\n");
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N = SIZES[si];
+
+            bsl::vector<bsl::string> mX;
+            for (int i = 0; i < N; ++i) {
+                mX.push_back(bsl::string(1, static_cast<char>('a' + i % 26)));
+            }
+            const bsl::vector<bsl::string>& X = mX;
+
+            bsl::vector<bsl::string> mEXP(N);
+            native_std::partial_sum(X.begin(),
+                                    X.end(),
+                                    mEXP.begin(),
+                                    Concat());
+
+            bsl::vector<bsl::string> mY(N);
+            Obj::inclusive_scan(POLICY,
+                                X.begin(),
+                                X.end(),
+                                mY.begin(),
+                                Concat(),
+                                &ta);
+            LOOP2_ASSERT(pi, N, mEXP == mY);
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+template <class CONTAINER>
+void testSort()
+    // Test the overloads of 'sort' and 'stable_sort' on ranges of the
+    // (template parameter) 'CONTAINER'.
+{
+    bslma::TestAllocator ta("scratch", veryVerbose);
+
+    static const int RANGES[] = { 1, 3, 1000, 1 << 30 };
+    enum { NUM_RANGES = sizeof RANGES / sizeof *RANGES };
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N          = SIZES[si];
+            const int NUM_CHUNKS = POLICY.numChunks(N);
+
+            for (int ri = 0; ri < NUM_RANGES; ++ri) {
+                const int RANGE = RANGES[ri];
+
+                unsigned int state = N + RANGE;
+                CONTAINER    mX;
+                for (int i = 0; i < N; ++i) {
+                    mX.push_back(randomValue(&state, RANGE));
+                }
+                const CONTAINER& X = mX;
+
+                CONTAINER mEXP(X);  const CONTAINER& EXP = mEXP;
+                native_std::sort(mEXP.begin(), mEXP.end());
+
+                CONTAINER mY(X);  const CONTAINER& Y = mY;
+                Obj::sort(POLICY, mY.begin(), mY.end());
+                LOOP3_ASSERT(pi, N, RANGE, EXP == Y);
+
+                mY = X;
+                Obj::stable_sort(POLICY, mY.begin(), mY.end());
+                LOOP3_ASSERT(pi, N, RANGE, EXP == Y);
+
+                // Descending, with an allocator.
+
+                native_std::reverse(mEXP.begin(), mEXP.end());
+
+                const bsls::Types::Int64 BLOCKS = ta.numBlocksTotal();
+
+                mY = X;
+                Obj::sort(POLICY, mY.begin(), mY.end(), Greater(), &ta);
+                LOOP3_ASSERT(pi, N, RANGE, EXP == Y);
+
+                mY = X;
+                Obj::stable_sort(POLICY,
+                                 mY.begin(),
+                                 mY.end(),
+                                 Greater(),
+                                 &ta);
+                LOOP3_ASSERT(pi, N, RANGE, EXP == Y);
+
+                LOOP3_ASSERT(pi, N, RANGE, (1 < NUM_CHUNKS) ==
+                                           (BLOCKS < ta.numBlocksTotal()));
+
+                // Already sorted input.
+
+                Obj::sort(POLICY, mY.begin(), mY.end(), Greater(), &ta);
+                LOOP3_ASSERT(pi, N, RANGE, EXP == Y);
+            }
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+void testStableSort()
+    // Test that 'stable_sort' keeps equivalent elements in order.
+{
+    bslma::TestAllocator ta("scratch", veryVerbose);
+
+    static const int RANGES[] = { 1, 3, 1000 };
+    enum { NUM_RANGES = sizeof RANGES / sizeof *RANGES };
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& POLICY = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int N = SIZES[si];
+
+            for (int ri = 0; ri < NUM_RANGES; ++ri) {
+                const int RANGE = RANGES[ri];
+
+                unsigned int state = N + RANGE;
+                bsl::deque<Keyed> mX;
+                for (int i = 0; i < N; ++i) {
+                    const Keyed ELEMENT = { randomValue(&state, RANGE), i };
+                    mX.push_back(ELEMENT);
+                }
+
+                Obj::stable_sort(POLICY, mX.begin(), mX.end(), KeyLess(), &ta);
+
+                for (int i = 1; i < N; ++i) {
+                    const Keyed& PREV = mX[i - 1];
+                    const Keyed& CURR = mX[i];
+                    LOOP4_ASSERT(pi, N, RANGE, i, PREV.d_key <= CURR.d_key);
+                    LOOP4_ASSERT(pi, N, RANGE, i,
+                                 PREV.d_key < CURR.d_key
+                                 || PREV.d_position < CURR.d_position);
+                }
+            }
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        enum { k_NUM_VALUES = 100000 };
+
+        bsl::vector<int> values(k_NUM_VALUES);
+        unsigned int     state = 1;
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            state     = state * 1103515245 + 12345;
+            values[i] = static_cast<int>(state >> 16) % 1000;
+        }
+
+        const bsls::ParallelPolicy policy(4, 10000);
+
+        bslstl::ParallelAlgorithmUtil::sort(policy,
+                                            values.begin(),
+                                            values.end());
+
+        for (int i = 1; i < k_NUM_VALUES; ++i) {
+            ASSERT(values[i - 1] <= values[i]);
+        }
+
+        const long long sum = bslstl::ParallelAlgorithmUtil::reduce(
+                                                                policy,
+                                                                values.begin(),
+                                                                values.end(),
+                                                                0LL);
+
+        ASSERT(native_std::accumulate(values.begin(), values.end(), 0LL)
+                                                                       == sum);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'sort' AND 'stable_sort'
+        //
+        // Concerns:
+        //: 1 The range is sorted according to the comparator, whatever the
+        //:   policy, the size of the range, and the number of distinct
+        //:   values (including all equal, and already sorted, inputs).
+        //:
+        //: 2 'stable_sort' keeps equivalent elements in their original
+        //:   order, also across chunks.
+        //:
+        //: 3 The scratch buffer is obtained from the supplied allocator, only
+        //:   if the range is split, and is released.
+        //:
+        //: 4 Contiguous and non-contiguous ranges are supported.
+        //
+        // Plan:
+        //: 1 For a table of policies, sizes, and ranges of pseudo-random
+        //:   values, sort copies of vectors and deques with each overload and
+        //:   compare them with the result of 'std::sort'.  (C-1, 3..4)
+        //:
+        //: 2 Sort a deque of objects holding a key, with few distinct
+        //:   values, and their original positions by key, and verify that
+        //:   the positions of equal keys are increasing.  (C-2)
+        //
+        // Testing:
+        //   void sort(const Policy& p, RIT f, RIT l);
+        //   void sort(const Policy& p, RIT f, RIT l, const COMP& c, *ba);
+        //   void stable_sort(const Policy& p, RIT f, RIT l);
+        //   void stable_sort(const Policy& p, RIT f, RIT l, const COMP& c, *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'sort' AND 'stable_sort'"
+                            "\n================================\n");
+
+        testSort<bsl::vector<int> >();
+        testSort<bsl::deque<int> >();
+        testStableSort();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'inclusive_scan'
+        //
+        // Concerns:
+        //: 1 Each output element is the combination of the input elements up
+        //:   to and including the corresponding element, in order.
+        //:
+        //: 2 The scan can be done in place.
+        //:
+        //: 3 The end of the output range is returned.
+        //:
+        //: 4 The scratch buffer is obtained from the supplied allocator, only
+        //:   if the range is split, and is released.
+        //
+        // Plan:
+        //: 1 For a table of policies and sizes, compare the results with
+        //:   those of a serial loop, or of 'std::partial_sum', using
+        //:   'operator+', a maximum operation in place, and string
+        //:   concatenation.  (C-1..4)
+        //
+        // Testing:
+        //   OIT inclusive_scan(const Policy& p, RIT f, RIT l, OIT r);
+        //   OIT inclusive_scan(const Policy& p, RIT f, RIT l, OIT r, op, *ba);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'inclusive_scan'"
+                            "\n========================\n");
+
+        testInclusiveScan<bsl::vector<int> >();
+        testInclusiveScan<bsl::deque<int> >();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'reduce'
+        //
+        // Concerns:
+        //: 1 The result is the combination of the initial value and all the
+        //:   elements, in order.
+        //:
+        //: 2 The scratch buffer is obtained from the supplied allocator, only
+        //:   if the range is split, and is released.
+        //
+        // Plan:
+        //: 1 For a table of policies and sizes, compare the results with
+        //:   those of 'std::accumulate', using 'operator+', a maximum
+        //:   operation, and string concatenation.  (C-1..2)
+        //
+        // Testing:
+        //   TYPE reduce(const Policy& p, RIT f, RIT l, const TYPE& init);
+        //   TYPE reduce(const Policy& p, RIT f, RIT l, const TYPE& i, op, ba);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'reduce'"
+                            "\n================\n");
+
+        testReduce<bsl::vector<int> >();
+        testReduce<bsl::deque<int> >();
+        testReduceStrings();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'transform'
+        //
+        // Concerns:
+        //: 1 Each output element is the result of the operation on the
+        //:   corresponding input elements.
+        //:
+        //: 2 The transform can be done in place.
+        //:
+        //: 3 The end of the output range is returned.
+        //
+        // Plan:
+        //: 1 For a table of policies and sizes, transform vectors and deques
+        //:   of pseudo-random values with both overloads, into another
+        //:   container and in place, and verify each element.  (C-1..3)
+        //
+        // Testing:
+        //   OIT transform(const Policy& p, RIT f, RIT l, OIT r, const OP& op);
+        //   OIT transform(const Policy& p, RIT1 f1, RIT1 l1, RIT2 f2, r, op);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'transform'"
+                            "\n===================\n");
+
+        testTransform<bsl::vector<int> >();
+        testTransform<bsl::deque<int> >();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'for_each'
+        //
+        // Concerns:
+        //: 1 The function is called exactly once on each element, whatever
+        //:   the policy and the size of the range.
+        //
+        // Plan:
+        //: 1 For a table of policies and sizes, increment the elements of
+        //:   vectors and deques with a function object counting its calls
+        //:   atomically, and verify the count and each element.  (C-1)
+        //
+        // Testing:
+        //   void for_each(const Policy& p, RIT f, RIT l, const FUNC& fn);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'for_each'"
+                            "\n==================\n");
+
+        testForEach<bsl::vector<int> >();
+        testForEach<bsl::deque<int> >();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Sort, sum, and scan a vector under a serial and a parallel
+        //:   policy.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const Policy PARALLEL(4, 8);
+
+        bsl::vector<int> mX;
+        for (int i = 0; i < 100; ++i) {
+            mX.push_back(99 - i);
+        }
+
+        Obj::sort(Policy::serial(), mX.begin(), mX.begin() + 50);
+        ASSERT(50 == mX[0]);
+        ASSERT(99 == mX[49]);
+
+        Obj::sort(PARALLEL, mX.begin(), mX.end());
+        for (int i = 0; i < 100; ++i) {
+            LOOP_ASSERT(i, i == mX[i]);
+        }
+
+        ASSERT(4950 == Obj::reduce(PARALLEL, mX.begin(), mX.end(), 0));
+
+        Obj::inclusive_scan(PARALLEL, mX.begin(), mX.end(), mX.begin());
+        ASSERT(0    == mX[0]);
+        ASSERT(4950 == mX[99]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Splitting large ranges reduces the elapsed time of the
+        //:   algorithms on machines with several hardware threads.
+        //
+        // Plan:
+        //: 1 Time 'sort', 'stable_sort', 'reduce', and 'inclusive_scan' on a
+        //:   large vector of pseudo-random values for 1, 2, 4, ... up to the
+        //:   number of hardware threads, and print the times.  Note that
+        //:   'bslbench.m' has the corresponding benchmarks.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        enum { k_N = 4 * 1000 * 1000 };
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        bsl::vector<int> input(allocator);
+        unsigned int     state = 1;
+        for (int i = 0; i < k_N; ++i) {
+            input.push_back(randomValue(&state, 1 << 30));
+        }
+
+        const int numHardwareThreads =
+                                   bsls::ParallelUtil::numHardwareThreads();
+
+        for (int threads = 1; ; threads *= 2) {
+            if (threads > numHardwareThreads) {
+                threads = numHardwareThreads;
+            }
+            const Policy POLICY(threads);
+
+            bsl::vector<int> values(input, allocator);
+
+            bsls::Stopwatch sortTimer;
+            sortTimer.start();
+            Obj::sort(POLICY, values.begin(), values.end(), Greater(),
+                      allocator);
+            sortTimer.stop();
+
+            values = input;
+
+            bsls::Stopwatch stableSortTimer;
+            stableSortTimer.start();
+            Obj::stable_sort(POLICY, values.begin(), values.end(), Greater(),
+                             allocator);
+            stableSortTimer.stop();
+
+            bsls::Stopwatch reduceTimer;
+            reduceTimer.start();
+            const long long sum = Obj::reduce(POLICY,
+                                              values.begin(),
+                                              values.end(),
+                                              0LL);
+            reduceTimer.stop();
+
+            bsls::Stopwatch scanTimer;
+            scanTimer.start();
+            Obj::inclusive_scan(POLICY,
+                                values.begin(),
+                                values.end(),
+                                values.begin(),
+                                Max(),
+                                allocator);
+            scanTimer.stop();
+
+            printf("%d threads: sort %.3f s, stable_sort %.3f s,"
+                   " reduce %.3f s (%lld), inclusive_scan %.3f s\n",
+                   threads,
+                   sortTimer.elapsedTime(),
+                   stableSortTimer.elapsedTime(),
+                   reduceTimer.elapsedTime(),
+                   sum,
+                   scanTimer.elapsedTime());
+
+            if (threads == numHardwareThreads) {
+                break;
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
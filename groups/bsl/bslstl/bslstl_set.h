@@ -30,10 +30,26 @@ BSLS_IDENT("$Id: $")
 // A set meets the requirements of an associative container with bidirectional
 // iterators in the C++ standard [23.2.4].  The 'set' implemented here adheres
 // to the C++11 standard, except that it does not have interfaces that take
-// rvalue references, 'initializer_lists', 'emplace', or operations taking a
-// variadic number of template parameters.  Note that excluded C++11 features
+// rvalue references or 'initializer_lists'.  Note that excluded C++11 features
 // are those that require (or are greatly simplified by) C++11 compiler
-// support.
+// support.  The 'emplace' and 'emplace_hint' methods construct elements in
+// place from a variadic list of arguments, which is limited to five arguments
+// on compilers that do not support variadic templates.
+//
+// The 'extract' methods unlink an element from a set and pass the node holding
+// it to a 'node_type' object (see 'bslstl_nodehandle'), the 'insert' method
+// taking a 'node_type' object links such a node into a set again, and the
+// 'merge' method moves into a set the elements of another set having keys not
+// yet present.  An element extracted from a set and inserted into the same set
+// again is neither copied nor destroyed, and no memory is allocated for it.
+// The same holds when the node is inserted into a *different* set using an
+// equal allocator, since a node does not depend on the set that created it
+// (see 'bslstl_nodehandle'), and for the elements moved by 'merge' between
+// sets using equal allocators.  Inserting a 'node_type' object into a set
+// using a different allocator copies the element into a newly created node and
+// deletes the extracted node.  Note that the key of an element of a set may be
+// modified without copying the element by extracting the element, modifying
+// the value held by the 'node_type' object, and inserting that object again.
 //
 ///Requirements on 'KEY'
 ///---------------------
@@ -100,6 +116,7 @@ BSLS_IDENT("$Id: $")
 //  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
 //  'k'             - an object of type 'K'
 //  'p1', 'p2'      - two iterators belonging to 'a'
+//  'h'             - an object of type 'set<K>::node_type'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //
 //  +----------------------------------------------------+--------------------+
@@ -169,6 +186,14 @@ BSLS_IDENT("$Id: $")
 //  | a.erase(p1, p2)                                    | O[log(n) +         |
 //  |                                                    | distance(p1, p2)]  |
 //  +----------------------------------------------------+--------------------+
+//  | a.extract(&h, p1)                                  | amortized constant |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(&h, k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(h)                                        | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.merge(b)                                         | O[m * log(n + m)]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.key_comp()                                       | O[1]               |
@@ -473,6 +498,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_pair.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_SETCOMPARATOR
 #include <bslstl_setcomparator.h>
 #endif
@@ -517,6 +546,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -612,6 +645,8 @@ class set {
                                               difference_type> const_iterator;
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+    typedef BloombergLP::bslstl::NodeHandle<value_type, Node, NodeFactory>
+                                                                     node_type;
 
   private:
     // PRIVATE MANIPULATORS
@@ -619,6 +654,27 @@ class set {
         // Return a reference providing modifiable access to the
         // node-allocator for this tree.
 
+    bsl::pair<iterator, bool> insertNode(
+                                        BloombergLP::bslalg::RbTreeNode *node);
+        // Insert the specified 'node' into this set unless an element having
+        // the same key as the value of 'node' is already present, in which
+        // case delete 'node'.  Return a pair whose 'first' member refers to
+        // the element in this set having that key, and whose 'second' member
+        // is 'true' if 'node' was inserted.  This set takes ownership of
+        // 'node' whether or not an exception is thrown.  The behavior is
+        // undefined unless 'node' was created by 'nodeFactory()'.
+
+    iterator insertNode(const_iterator                   hint,
+                        BloombergLP::bslalg::RbTreeNode *node);
+        // Insert the specified 'node' into this set (in amortized constant
+        // time if the specified 'hint' is a valid immediate successor to the
+        // key of the value of 'node') unless an element having the same key is
+        // already present, in which case delete 'node'.  Return an iterator
+        // referring to the element in this set having that key.  This set
+        // takes ownership of 'node' whether or not an exception is thrown.
+        // The behavior is undefined unless 'node' was created by
+        // 'nodeFactory()' and 'hint' is a valid iterator into this set.
+
     Comparator& comparator();
         // Return a reference providing modifiable access to the
         // comparator for this tree.
@@ -797,6 +853,136 @@ class set {
         // (template parameter) type 'KEY' be "copy-constructible" (see
         // {Requirements on 'KEY'}).
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(ARGS&&... args);
+        // Insert into this set a newly created 'value_type' object,
+        // constructed in place from the specified 'args', if no element having
+        // the same key as the new object is already present; otherwise destroy
+        // the new object and leave this set unchanged.  Return a pair whose
+        // 'first' member is an iterator referring to the (possibly newly
+        // inserted) element whose key is the same as that of the new object,
+        // and whose 'second' member is 'true' if a new value was inserted, and
+        // 'false' otherwise.  Note that the object is built directly in its
+        // node, so no temporary 'value_type' is copied.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_set.h
+    bsl::pair<iterator, bool> emplace();
+
+    template <class ARGS_1>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bsl::pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          ARGS&&... args);
+        // Insert into this set a newly created 'value_type' object,
+        // constructed in place from the specified 'args' (in amortized
+        // constant time if the specified 'hint' is a valid immediate successor
+        // to its key), if no element having the same key is already present;
+        // otherwise destroy the new object.  Return an iterator referring to
+        // the (possibly newly inserted) element whose key is the same as that
+        // of the new object.  The behavior is undefined unless 'hint' is a
+        // valid iterator into this set.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_set.h
+    iterator emplace_hint(const_iterator hint);
+
+    template <class ARGS_1>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     iterator erase(const_iterator position);
         // Remove from this set the 'value_type' object at the specified
         // 'position', and return an iterator referring to the element
@@ -818,6 +1004,46 @@ class set {
         // 'end' iterator, and the 'first' position is at or before the 'last'
         // position in the ordered sequence provided by this container.
 
+    void extract(node_type *result, const_iterator position);
+        // Unlink from this set the element at the specified 'position', and
+        // load into the specified 'result' the node holding that element,
+        // after deleting the node held by 'result', if any.  The element is
+        // neither copied nor destroyed, and iterators referring to other
+        // elements of this set remain valid.  The behavior is undefined
+        // unless 'position' refers to an element in this set.
+
+    void extract(node_type *result, const key_type& key);
+        // Unlink from this set the element having the specified 'key', if
+        // such an element exists, and load into the specified 'result' the
+        // node holding that element, after deleting the node held by
+        // 'result', if any; otherwise, leave 'result' empty.
+
+    bsl::pair<iterator, bool> insert(node_type& node);
+        // Insert into this set the element held by the specified 'node' and
+        // leave 'node' empty, if 'node' is not empty and this set does not
+        // already contain an element having the same key; otherwise, leave
+        // 'node' unchanged.  Return a pair whose 'first' member is an iterator
+        // referring to the element in this set having that key (or to the
+        // past-the-end position if 'node' is empty), and whose 'second'
+        // member is 'true' if the element was inserted and 'false'
+        // otherwise.  If the allocator of 'node' compares equal to that of
+        // this set (e.g., 'node' holds a node extracted from this set), link
+        // the node held by 'node' into this set without copying its value;
+        // otherwise, insert a copy of the value and delete the node held by
+        // 'node'.  If an exception is thrown, this method has no effect.
+
+    void merge(set& source);
+        // Move into this set each element of the specified 'source' set
+        // having a key not already present in this set, and leave the other
+        // elements in 'source'.  If 'source' uses an allocator equal to that
+        // of this set, unlink the nodes holding the moved elements from
+        // 'source' and link them into this set, without copying, destroying,
+        // or allocating anything; otherwise, insert copies of the moved
+        // elements and erase them from 'source'.  Iterators referring to the
+        // moved elements are invalidated.  If an exception is thrown, the
+        // elements moved so far remain in this set, and the others in
+        // 'source'.  This method has no effect if 'source' is this set.
+
     void swap(set& other);
         // Exchange the value of this object as well as its comparator with
         // those of the specified 'other' object.  Additionally if
@@ -998,11 +1224,6 @@ class set {
 
 //    set& operator=(initializer_list<value_type>);
 
-//    template <class... Args> pair<iterator, bool> emplace(Args&&... args);
-
-//    template <class... Args> iterator emplace_hint(const_iterator position,
-//                                                   Args&&... args);
-
 //     pair<iterator, bool> insert(value_type&& value);
 
 //     iterator insert(const_iterator position, value_type&& value);
@@ -1122,6 +1343,67 @@ set<KEY, COMPARATOR, ALLOCATOR>::nodeFactory()
     return d_compAndAlloc.d_pool;
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::insertNode(
+                                         BloombergLP::bslalg::RbTreeNode *node)
+{
+    BloombergLP::bslstl::TreeNodePoolProctor<NodeFactory> proctor(
+                                                                &nodeFactory(),
+                                                                node);
+    const key_type& key = static_cast<const Node *>(node)->value();
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    proctor.release();
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::insertNode(
+                                         const_iterator                  hint,
+                                         BloombergLP::bslalg::RbTreeNode *node)
+{
+    BloombergLP::bslstl::TreeNodePoolProctor<NodeFactory> proctor(
+                                                                &nodeFactory(),
+                                                                node);
+    const key_type& key = static_cast<const Node *>(node)->value();
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              node);
+    proctor.release();
+    return iterator(node);
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename set<KEY, COMPARATOR, ALLOCATOR>::Comparator&
@@ -1377,6 +1659,256 @@ void set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
     }
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace(ARGS&&... args)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                                          native_std::forward<ARGS>(args)...));
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_set.h
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace()
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5)));
+}
+
+#else
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::emplace(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    return insertNode(nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+}
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                           const_iterator hint,
+                                                           ARGS&&... args)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                                          native_std::forward<ARGS>(args)...));
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_set.h
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(const_iterator hint)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                              const_iterator hint,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5)));
+}
+
+#else
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                               const_iterator hint,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    return insertNode(hint, nodeFactory().emplaceIntoNewNode(
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+}
+// }}} END GENERATED CODE
+#endif
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
@@ -1418,6 +1950,114 @@ set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
     return iterator(last.node());
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::extract(node_type      *result,
+                                              const_iterator  position)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(position != end());
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    result->reset(static_cast<Node *>(node), nodeFactory().allocator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::extract(node_type       *result,
+                                              const key_type&  key)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    const_iterator position = find(key);
+    if (position == end()) {
+        result->reset();
+        return;                                                       // RETURN
+    }
+    extract(result, position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::insert(node_type& node)
+{
+    if (node.empty()) {
+        return bsl::pair<iterator, bool>(end(), false);               // RETURN
+    }
+
+    const key_type& key = node.value();
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+
+    BloombergLP::bslalg::RbTreeNode *newNode;
+    if (node.allocator() == nodeFactory().allocator()) {
+        newNode = node.release();
+    }
+    else {
+        newNode = nodeFactory().createNode(node.value());
+        node.reset();
+    }
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              newNode);
+    return bsl::pair<iterator, bool>(iterator(newNode), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::merge(set& source)
+{
+    if (this == &source) {
+        return;                                                       // RETURN
+    }
+
+    const bool relink =
+                 nodeFactory().allocator() == source.nodeFactory().allocator();
+
+    const_iterator it = source.begin();
+    while (it != source.end()) {
+        BloombergLP::bslalg::RbTreeNode *node =
+                      const_cast<BloombergLP::bslalg::RbTreeNode *>(it.node());
+        ++it;
+
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                       &comparisonResult,
+                                       &d_tree,
+                                       this->comparator(),
+                                       static_cast<Node *>(node)->value());
+        if (!comparisonResult) {
+            continue;                                               // CONTINUE
+        }
+
+        BloombergLP::bslalg::RbTreeNode *newNode;
+        if (relink) {
+            BloombergLP::bslalg::RbTreeUtil::remove(&source.d_tree, node);
+            newNode = node;
+        }
+        else {
+            newNode = nodeFactory().createNode(*node);
+            source.erase(const_iterator(node));
+        }
+        BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                  insertLocation,
+                                                  comparisonResult < 0,
+                                                  newNode);
+    }
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 void set<KEY, COMPARATOR, ALLOCATOR>::swap(set& other)
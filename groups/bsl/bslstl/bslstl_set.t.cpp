@@ -116,6 +116,12 @@ using namespace bsl;
 // [15] bsl::pair<iterator, bool> insert(const value_type& value);
 // [15] iterator insert(const_iterator position, const value_type& value);
 // [15] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [26] bsl::pair<iterator, bool> emplace(ARGS&&... args);
+// [26] iterator emplace_hint(const_iterator hint, ARGS&&... args);
+// [27] void extract(node_type *result, const_iterator position);
+// [27] void extract(node_type *result, const key_type& key);
+// [27] bsl::pair<iterator, bool> insert(node_type& node);
+// [27] void merge(set& source);
 //
 // [16] iterator erase(const_iterator position);
 // [16] size_type erase(const key_type& key);
@@ -150,7 +156,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [25] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(set<T,A> *object, const char *spec, int verbose = 1);
@@ -318,16 +324,6 @@ void debugprint(const bsl::set<KEY, COMP, ALLOC>& s)
 
 namespace {
 
-bool expectToAllocate(int n)
-    // Return 'true' if the container is expected to allocate memory on the
-    // specified 'n'th element, and 'false' otherwise.
-{
-    if (n > 32) {
-        return (0 == n % 32);                                         // RETURN
-    }
-    return (((n - 1) & n) == 0);  // Allocate when 'n' is a power of 2
-}
-
 template<class CONTAINER, class VALUES>
 int verifyContainer(const CONTAINER&  container,
                     const VALUES&     expectedValues,
@@ -850,6 +846,12 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase27();
+        // Test 'extract', 'insert(node_type&)', and 'merge'.
+
+    static void testCase26();
+        // Test 'emplace' and 'emplace_hint'.
+
     static void testCase25();
         // Test standard interface coverage.
 
@@ -992,6 +994,484 @@ bsl::set<KEY, COMP, ALLOC> TestDriver<KEY, COMP, ALLOC>::g(const char *spec)
     return gg(&object, spec);
 }
 
+template <class KEY, class COMP, class ALLOC>
+void TestDriver<KEY, COMP, ALLOC>::testCase27()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+    //
+    // Concerns:
+    //: 1 'extract' unlinks the element at the supplied position, or having
+    //:   the supplied key, and passes the node holding it to the supplied
+    //:   'node_type' object without copying the element or releasing memory.
+    //:
+    //: 2 'extract' leaves the 'node_type' object empty if no element has the
+    //:   supplied key.
+    //:
+    //: 3 'insert' links a node extracted from the same container without
+    //:   copying the element or allocating memory, and leaves the
+    //:   'node_type' object empty.
+    //:
+    //: 4 'insert' has no effect, and leaves the 'node_type' object unchanged,
+    //:   if the object is empty or an element having the same key exists.
+    //:
+    //: 5 'insert' copies the element held by a node extracted from a
+    //:   container using another allocator, and is exception neutral.
+    //:
+    //: 6 'merge' moves into the container each element of the source having
+    //:   a key not present, and leaves the other elements in the source.
+    //:
+    //: 7 'merge' neither copies nor destroys the moved elements if both
+    //:   containers use the same allocator, and the moved elements remain
+    //:   valid after the source is destroyed.
+    //:
+    //: 8 'merge' provides the strong exception-safety guarantee w.r.t. memory
+    //:   allocation if both containers use the same allocator.
+    //
+    // Plan:
+    //: 1 For each element of a set of objects, extract the element by
+    //:   position and by key, and verify the address of the element, the
+    //:   value of the object, and the memory in use.  Extract the same key
+    //:   again, and verify that the 'node_type' object is empty.  (C-1..2)
+    //:
+    //: 2 Insert the extracted node, and verify the address of the element,
+    //:   the value of the object, and the memory in use.  Insert the empty
+    //:   'node_type' object, and a node holding a duplicate key, and verify
+    //:   that neither has an effect.  (C-3..4)
+    //:
+    //: 3 Insert the node holding a duplicate key into an object using a
+    //:   different allocator under the presence of exceptions, and verify
+    //:   the value of both the object and the 'node_type' object.  (C-5)
+    //:
+    //: 4 Using a table of pairs of specifications, merge the second object
+    //:   into the first, both when they use the same and different
+    //:   allocators, and verify the values of both objects and (when the
+    //:   allocators are the same) the addresses of the moved elements after
+    //:   the source object is destroyed.  Repeat the merge under the presence
+    //:   of exceptions when the allocators are the same.  (C-6..8)
+    //
+    // Testing:
+    //   void extract(node_type *result, const_iterator position);
+    //   void extract(node_type *result, const key_type& key);
+    //   bsl::pair<iterator, bool> insert(node_type& node);
+    //   void merge(set& source);
+    // ------------------------------------------------------------------------
+
+    typedef typename Obj::node_type NodeType;
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<KEY>::value;
+
+    if (verbose)
+        printf("\nTesting parameters: TYPE_ALLOC = %d.\n", TYPE_ALLOC);
+
+    if (verbose) printf("\nTesting 'extract' and 'insert(node_type&)'.\n");
+    {
+        static const struct {
+            int         d_line;  // source line number
+            const char *d_spec;  // specification string (ordered)
+        } DATA[] = {
+            //line  spec
+            //----  ----
+
+            { L_,   "A"          },
+            { L_,   "AB"         },
+            { L_,   "ABC"        },
+            { L_,   "ABCDE"      },
+            { L_,   "ABCDEFGH"   }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const size_t      LENGTH = strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            if (veryVerbose) { P_(LINE) P(SPEC); }
+
+            for (size_t tj = 0; tj < LENGTH; ++tj) {
+            for (int byKey = 0; byKey < 2; ++byKey) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC);
+
+                const KEY&  K       = VALUES[tj];
+                const KEY  *ADDRESS = &*X.find(K);
+
+                const bsls::Types::Int64 B = oa.numBlocksInUse();
+
+                NodeType node;
+                if (byKey) {
+                    mX.extract(&node, K);
+                }
+                else {
+                    mX.extract(&node, X.find(K));
+                }
+
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == node.value());
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+                ASSERTV(LINE, tj, byKey, X.end()     == X.find(K));
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+
+                NodeType missing;
+                mX.extract(&missing, K);
+
+                ASSERTV(LINE, tj, byKey, missing.empty());
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+
+                bsl::pair<Iter, bool> R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &*R.first);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey,
+                        0 == verifyContainer(X, VALUES, LENGTH));
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, X.end()     == R.first);
+                ASSERTV(LINE, tj, byKey, LENGTH      == X.size());
+
+                // Insert a node holding a key that is already present.
+
+                mX.extract(&node, K);
+                mX.insert(VALUES[tj]);
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == *R.first);
+                ASSERTV(LINE, tj, byKey,
+                        0 == verifyContainer(X, VALUES, LENGTH));
+
+                // Insert the node into an object using another allocator.
+
+                bslma::TestAllocator za("other", veryVeryVeryVerbose);
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                    ASSERTV(LINE, tj, byKey, !node.empty());
+                    ASSERTV(LINE, tj, byKey, 0 == Z.size());
+
+                    R = mZ.insert(node);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, 1 == Z.size());
+                ASSERTV(LINE, tj, byKey, K == *Z.begin());
+
+                // The copy of the element inserted into 'X' above may have
+                // required a new block for the node pool of 'X'.
+
+                ASSERTV(LINE, tj, byKey, B     <= oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey, B + 1 >= oa.numBlocksInUse());
+            }
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting 'merge'.\n");
+    {
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_specX;    // specification of the target
+            const char *d_specY;    // specification of the source
+            const char *d_resultX;  // expected value of the target
+            const char *d_resultY;  // expected value of the source
+        } DATA[] = {
+            //line  specX     specY       resultX     resultY
+            //----  -----     -----       -------     -------
+
+            { L_,   "",       "",         "",         ""     },
+            { L_,   "",       "ABC",      "ABC",      ""     },
+            { L_,   "ABC",    "",         "ABC",      ""     },
+            { L_,   "ABC",    "ABC",      "ABC",      "ABC"  },
+            { L_,   "ACE",    "BCD",      "ABCDE",    "C"    },
+            { L_,   "AB",     "CDEFGH",   "ABCDEFGH", ""     },
+            { L_,   "BDFH",   "ABCDEFGH", "ABCDEFGH", "BDFH" },
+            { L_,   "ABCDEFG", "H",       "ABCDEFGH", ""     }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MAX_LENGTH = 10;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const SPEC_X   = DATA[ti].d_specX;
+            const char *const SPEC_Y   = DATA[ti].d_specY;
+            const char *const RESULT_X = DATA[ti].d_resultX;
+            const char *const RESULT_Y = DATA[ti].d_resultY;
+
+            const TestValues EXP_X(RESULT_X);
+            const TestValues EXP_Y(RESULT_Y);
+
+            if (veryVerbose) { P_(LINE) P_(SPEC_X) P(SPEC_Y); }
+
+            for (int sameAlloc = 0; sameAlloc < 2; ++sameAlloc) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+
+                const KEY *ADDRESSES[MAX_LENGTH];
+                int numMoved = 0;
+                {
+                    Obj mY(sameAlloc ? &oa : &za);
+                    const Obj& Y = gg(&mY, SPEC_Y);
+
+                    for (CIter it = Y.begin(); it != Y.end(); ++it) {
+                        if (X.end() == X.find(*it)) {
+                            ADDRESSES[numMoved++] = &*it;
+                        }
+                    }
+
+                    mX.merge(mY);
+
+                    ASSERTV(LINE, sameAlloc,
+                            0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+                    ASSERTV(LINE, sameAlloc,
+                            0 == verifyContainer(Y, EXP_Y, strlen(RESULT_Y)));
+
+                    mX.merge(mX);
+
+                    ASSERTV(LINE, sameAlloc,
+                            0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+                }
+
+                ASSERTV(LINE, sameAlloc,
+                        0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+
+                if (sameAlloc) {
+                    for (int k = 0; k < numMoved; ++k) {
+                        ASSERTV(LINE, k,
+                                ADDRESSES[k] == &*X.find(*ADDRESSES[k]));
+                    }
+                }
+
+                mX.clear();
+
+                ASSERTV(LINE, sameAlloc, 0 == za.numBlocksInUse());
+            }
+
+            {
+                const TestValues VALUES_X(SPEC_X);
+                const TestValues VALUES_Y(SPEC_Y);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+                Obj mY(&oa);  const Obj& Y = gg(&mY, SPEC_Y);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE,
+                            0 == verifyContainer(X,
+                                                 VALUES_X,
+                                                 strlen(SPEC_X)));
+                    ASSERTV(LINE,
+                            0 == verifyContainer(Y,
+                                                 VALUES_Y,
+                                                 strlen(SPEC_Y)));
+
+                    mX.merge(mY);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE,
+                        0 == verifyContainer(X, EXP_X, strlen(RESULT_X)));
+                ASSERTV(LINE,
+                        0 == verifyContainer(Y, EXP_Y, strlen(RESULT_Y)));
+            }
+        }
+    }
+}
+
+template <class KEY, class COMP, class ALLOC>
+void TestDriver<KEY, COMP, ALLOC>::testCase26()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace' AND 'emplace_hint'
+    //
+    // Concerns:
+    //: 1 Each method inserts a new element, constructed from the supplied
+    //:   arguments, if and only if no element having the same key exists, and
+    //:   the order of the container remains correct.
+    //:
+    //: 2 The iterator returned refers to the newly inserted element if it did
+    //:   not already exist, and to the existing element if it did, and the
+    //:   'bool' returned by 'emplace' is 'true' if and only if a new element
+    //:   was inserted.
+    //:
+    //: 3 Any memory allocated by the container, or by the newly inserted
+    //:   element, is drawn from the object allocator, and only memory retained
+    //:   by the node pool remains in use when an element with a duplicate key
+    //:   is not inserted.
+    //:
+    //: 4 Each method is exception neutral w.r.t. memory allocation.
+    //
+    // Plan:
+    //: 1 For each method, and for a sequence of values having both unique
+    //:   and duplicate keys, insert each value into an initially empty object
+    //:   by passing the value as the single argument.
+    //:
+    //:   1 Verify the return value and the resulting value of the object.
+    //:     (C-1..2)
+    //:
+    //:   2 Compute the number of allocations from the object allocator and
+    //:     verify it is as expected.  (C-3)
+    //:
+    //: 2 Repeat P-1 under the presence of exceptions.  (C-4)
+    //
+    // Testing:
+    //   bsl::pair<iterator, bool> emplace(ARGS&&... args);
+    //   iterator emplace_hint(const_iterator hint, ARGS&&... args);
+    // ------------------------------------------------------------------------
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<KEY>::value;
+
+    if (verbose)
+        printf("\nTesting parameters: TYPE_ALLOC = %d.\n", TYPE_ALLOC);
+
+    static const struct {
+        int         d_line;    // source line number
+        const char *d_spec;    // specification string
+        const char *d_unique;  // expected element values
+    } DATA[] = {
+        //line  spec           isUnique
+        //----  ----           --------
+
+        { L_,   "A",           "Y"           },
+        { L_,   "AAA",         "YNN"         },
+        { L_,   "ABCDEFGH",    "YYYYYYYY"    },
+        { L_,   "ABCDEABCDEF", "YYYYYNNNNNY" },
+        { L_,   "EEDDCCBBAA",  "YNYNYNYNYN"  }
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    const int MAX_LENGTH = 20;
+
+    if (verbose) printf("\nTesting without exceptions.\n");
+    for (int useHint = 0; useHint < 2; ++useHint) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            if (veryVerbose) { P_(useHint) P_(LINE) P_(SPEC) P(UNIQUE); }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                if (IS_UNIQ) {
+                    EXPECTED[SIZE] = SPEC[tj];
+                    std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                    EXPECTED[SIZE + 1] = '\0';
+                }
+
+                const KEY& K = VALUES[tj];
+
+                const bsls::Types::Int64 BB = oa.numBlocksTotal();
+                const bsls::Types::Int64 B  = oa.numBlocksInUse();
+
+                bsl::pair<Iter, bool> RESULT(mX.end(), IS_UNIQ);
+                if (useHint) {
+                    RESULT.first = mX.emplace_hint(X.end(), K);
+                }
+                else {
+                    RESULT = mX.emplace(K);
+                }
+
+                ASSERTV(useHint, LINE, tj, IS_UNIQ == RESULT.second);
+                ASSERTV(useHint, LINE, tj, K == *RESULT.first);
+
+                const bsls::Types::Int64 AA = oa.numBlocksTotal();
+                const bsls::Types::Int64 A  = oa.numBlocksInUse();
+
+                if (IS_UNIQ) {
+                    // A node created for a duplicate key is returned to the
+                    // pool, so a new pool block may already be available.
+
+                    ASSERTV(useHint, LINE, tj, A, B, B + TYPE_ALLOC     <= A);
+                    ASSERTV(useHint, LINE, tj, A, B, B + 1 + TYPE_ALLOC >= A);
+                    ASSERTV(useHint, LINE, tj, SIZE + 1 == X.size());
+                }
+                else {
+                    ASSERTV(useHint, LINE, tj, A, B, B + 1 >= A);
+                    ASSERTV(useHint, LINE, tj, SIZE == X.size());
+                }
+                ASSERTV(useHint, LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC >= AA);
+
+                TestValues exp(EXPECTED);
+                ASSERTV(useHint, LINE, tj,
+                        0 == verifyContainer(X, exp, X.size()));
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting with injected exceptions.\n");
+    for (int useHint = 0; useHint < 2; ++useHint) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const char *const UNIQUE = DATA[ti].d_unique;
+            const int         LENGTH = (int)strlen(SPEC);
+
+            const TestValues VALUES(SPEC);
+
+            char EXPECTED[MAX_LENGTH];
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj mX(&oa);  const Obj &X = mX;
+
+            for (int tj = 0; tj < LENGTH; ++tj) {
+                const bool   IS_UNIQ = UNIQUE[tj] == 'Y';
+                const size_t SIZE    = X.size();
+
+                if (IS_UNIQ) {
+                    EXPECTED[SIZE] = SPEC[tj];
+                    std::sort(EXPECTED, EXPECTED + SIZE + 1);
+                    EXPECTED[SIZE + 1] = '\0';
+                }
+
+                const KEY& K = VALUES[tj];
+
+                bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ExceptionGuard<Obj> guard(&X, L_, &scratch);
+
+                    if (useHint) {
+                        mX.emplace_hint(X.end(), K);
+                    }
+                    else {
+                        mX.emplace(K);
+                    }
+
+                    guard.release();
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                TestValues exp(EXPECTED);
+                ASSERTV(useHint, LINE, tj,
+                        0 == verifyContainer(X, exp, SIZE + IS_UNIQ));
+            }
+        }
+    }
+}
+
 template <class KEY, class COMP, class ALLOC>
 void TestDriver<KEY, COMP, ALLOC>::testCase25()
 {
@@ -2457,17 +2937,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase16()
                     }
 
                     if (IS_UNIQ) {
-                        if(expectToAllocate(SIZE + 1)) {
-                            ASSERTV(LINE, tj, AA, BB,
-                                    BB + 1 + TYPE_ALLOC == AA);
-                            ASSERTV(LINE, tj, A, B,
-                                    B + 1 + TYPE_ALLOC == A);
-                        }
-                        else {
-                            ASSERTV(LINE, tj, AA, BB,
-                                    BB + 0 + TYPE_ALLOC == AA);
-                            ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                        }
+                        ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                         ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
 
                         TestValues exp(EXPECTED);
@@ -2577,16 +3048,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase16()
                             VALUES[tj] == *RESULT);
 
                     if (IS_UNIQ) {
-                        if(expectToAllocate(SIZE + 1)) {
-                            ASSERTV(LINE, tj, AA, BB,
-                                    BB + 1 + TYPE_ALLOC == AA);
-                            ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                        }
-                        else {
-                            ASSERTV(LINE, tj, AA, BB,
-                                    BB + 0 + TYPE_ALLOC == AA);
-                            ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                        }
+                        ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                         ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
                         TestValues exp(EXPECTED);
                         ASSERTV(LINE, tj,
@@ -2719,14 +3182,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase15()
                 const bsls::Types::Int64 A  = oa.numBlocksInUse();
 
                 if (IS_UNIQ) {
-                    if(((SIZE + 1) & SIZE) == 0) {
-                        ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
-                    }
-                    else {
-                        ASSERTV(LINE, tj, AA, BB, BB + 0 + TYPE_ALLOC == AA);
-                        ASSERTV(LINE, tj, A, B, B + 0 + TYPE_ALLOC == A);
-                    }
+                    ASSERTV(LINE, tj, AA, BB, BB + 1 + TYPE_ALLOC == AA);
+                    ASSERTV(LINE, tj, A, B, B + 1 + TYPE_ALLOC == A);
                     ASSERTV(LINE, tj, SIZE, SIZE + 1 == X.size());
                     TestValues exp(EXPECTED);
                     ASSERTV(LINE, tj,
@@ -4655,9 +5112,10 @@ void TestDriver<KEY, COMP, ALLOC>::testCase7()
                     ASSERTV(SPEC,  B + 0 ==  A);
                 }
                 else {
-                    const int TYPE_ALLOCS = TYPE_ALLOC * X.size();
-                    ASSERTV(SPEC, BB + 1 + TYPE_ALLOCS == AA);
-                    ASSERTV(SPEC,  B + 1 + TYPE_ALLOCS ==  A);
+                    const int NUM_NODES   = static_cast<int>(X.size());
+                    const int TYPE_ALLOCS = TYPE_ALLOC * NUM_NODES;
+                    ASSERTV(SPEC, BB + NUM_NODES + TYPE_ALLOCS == AA);
+                    ASSERTV(SPEC,  B + NUM_NODES + TYPE_ALLOCS ==  A);
                 }
 
                 const bsls::Types::Int64 CC = oa.numBlocksTotal();
@@ -4715,9 +5173,13 @@ void TestDriver<KEY, COMP, ALLOC>::testCase7()
                     ASSERTV(SPEC,  B + 0 ==  A);
                 }
                 else {
-                    const int TYPE_ALLOCS = TYPE_ALLOC *
-                        (LENGTH + LENGTH * (1 + LENGTH) / 2);
-                    ASSERTV(SPEC, BB, AA, BB + 1 + TYPE_ALLOCS == AA);
+                    // Each attempt allocates one more block than the last: one
+                    // per node, plus one per element that uses an allocator.
+
+                    const int NUM_ALLOCS = (1 + TYPE_ALLOC)
+                                         * static_cast<int>(X.size());
+                    ASSERTV(SPEC, BB, AA,
+                            BB + NUM_ALLOCS * (1 + NUM_ALLOCS) / 2 == AA);
                     ASSERTV(SPEC, B + 0 == A);
                 }
             }
@@ -5432,14 +5894,8 @@ void TestDriver<KEY, COMP, ALLOC>::testCase2()
                     bsl::pair<Iter, bool> RESULT =
                                                  mX.insert(VALUES[LENGTH - 1]);
 
-                    if (0 < TYPE_ALLOC || expectToAllocate(LENGTH)) {
-                        ASSERTV(CONFIG, tam.isTotalUp());
-                        ASSERTV(CONFIG, tam.isInUseUp());
-                    }
-                    else {
-                        ASSERTV(CONFIG, tam.isTotalSame());
-                        ASSERTV(CONFIG, tam.isInUseSame());
-                    }
+                    ASSERTV(CONFIG, tam.isTotalUp());
+                    ASSERTV(CONFIG, tam.isInUseUp());
 
                     // Verify no temporary memory is allocated from the object
                     // allocator.
@@ -6339,7 +6795,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6389,6 +6845,23 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
 
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase27,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'emplace' AND 'emplace_hint'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase26,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+
       } break;
       case 25: {
         // --------------------------------------------------------------------
@@ -0,0 +1,807 @@
+// bslstl_sharedptrpool.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SHAREDPTRPOOL
+#define INCLUDED_BSLSTL_SHAREDPTRPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a factory of shared pointers with pooled representations.
+//
+//@CLASSES:
+//  bslstl::SharedPtrPool: factory of in-place shared pointers to one type
+//
+//@SEE_ALSO: bslstl_sharedptr, bslma_sharedptrinplacerep, bslstl_simplepool
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::SharedPtrPool', that creates 'bsl::shared_ptr' objects whose
+// object and reference counts share a single 'bslma::SharedPtrInplaceRep'
+// (as with 'bsl::shared_ptr::createInplace'), and that recycles the memory of
+// these representations in a pool.  Creating a shared pointer takes a
+// representation from the pool, and releasing the last reference to it
+// returns the representation to the pool, so that, once the pool has grown to
+// the number of objects alive at a time, neither operation calls the
+// allocator supplied at construction.
+//
+// The memory of the pool is obtained one block at a time from the allocator
+// supplied at construction, and is returned to it only when the pool is
+// destroyed.  The pool supplies blocks of exactly the size of a
+// 'bslma::SharedPtrInplaceRep<ELEMENT_TYPE>', and therefore serves a single
+// type.  Note that an object created by the pool that itself allocates
+// memory, such as a 'bsl::string', does so from its own allocator, not from
+// the pool.
+//
+///Thread Safety
+///-------------
+// By default, 'bslstl::SharedPtrPool' is *thread-safe*: shared pointers may
+// be created by several threads concurrently, and the last reference to a
+// shared pointer may be released by any thread.  The free list of the pool is
+// then protected by a 'bsls::BslLock', which is held only to unlink or link
+// one block.
+//
+// A pool constructed with 'SINGLE_THREADED' does not lock.  It may be used
+// only if every shared pointer created by the pool is created, and has its
+// last reference released, by one thread at a time, such as the thread of an
+// event loop.  Locking and unlocking an uncontended mutex, once to create and
+// once to release a shared pointer, costs about as much as the general-purpose
+// allocator saves, so the single-threaded mode is where the pool pays off
+// most.
+//
+// The pool keeps no per-thread caches of blocks.  Shared pointers are
+// commonly created by one thread and released by another, so the cache of
+// the releasing thread would only fill while that of the creating thread
+// would only empty, and moving blocks between them would take the lock
+// again.  Moreover, 'bsls' offers no hook run at thread exit, so the blocks
+// cached by a thread that exits could not be returned to the pool.
+//
+///Lifetime
+///--------
+// A representation returns its memory to the pool when the last shared *and*
+// weak reference to it is released, so the behavior is undefined if a
+// 'bsl::shared_ptr' or 'bsl::weak_ptr' created from a pool outlives the pool.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Events
+/// - - - - - - - - - - - - - -
+// Suppose that a feed handler creates a shared event for every update it
+// receives, hands the event to any number of subscribers, and forgets it;
+// events are created and destroyed at a high rate, but only a few are alive
+// at any time.  First, we define the event:
+//..
+//  struct Event {
+//      int    d_sequenceNumber;
+//      double d_price;
+//
+//      Event(int sequenceNumber, double price)
+//      : d_sequenceNumber(sequenceNumber)
+//      , d_price(price)
+//      {
+//      }
+//  };
+//..
+// Then, we create a pool for events, which obtains its memory from a test
+// allocator:
+//..
+//  bslma::TestAllocator         ta;
+//  bslstl::SharedPtrPool<Event> pool(&ta);
+//..
+// Next, we create and drop an event, as the feed handler would for every
+// update:
+//..
+//  bsl::shared_ptr<Event> event = pool.createInplace(1, 100.5);
+//  assert(1     == event->d_sequenceNumber);
+//  assert(100.5 == event->d_price);
+//
+//  event.reset();
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//..
+// Finally, we observe that further events reuse the memory of the first one
+// without allocating:
+//..
+//  for (int i = 2; i < 100; ++i) {
+//      bsl::shared_ptr<Event> next = pool.createInplace(i, 100.5);
+//      assert(i == next->d_sequenceNumber);
+//  }
+//  assert(numAllocations == ta.numAllocations());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SHAREDPTR
+#include <bslstl_sharedptr.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SIMPLEPOOL
+#include <bslstl_simplepool.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_SHAREDPTRINPLACEREP
+#include <bslma_sharedptrinplacerep.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                      // ================================
+                      // class SharedPtrPool_RepAllocator
+                      // ================================
+
+template <class ELEMENT_TYPE>
+class SharedPtrPool_RepAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to supply, from
+    // a thread-safe pool, blocks of memory of the size of a
+    // 'bslma::SharedPtrInplaceRep<ELEMENT_TYPE>'.  For use only by
+    // 'SharedPtrPool'.
+
+    // PRIVATE TYPES
+    typedef bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    typedef SimplePool<Rep, bsl::allocator<Rep> >    Pool;
+
+    // DATA
+    bsls::BslLock d_lock;        // protects 'd_pool' if 'd_threadSafe'
+    Pool          d_pool;        // pool of representations
+    bool          d_threadSafe;  // 'true' if 'd_lock' must be held
+
+    // NOT IMPLEMENTED
+    SharedPtrPool_RepAllocator(const SharedPtrPool_RepAllocator&);
+    SharedPtrPool_RepAllocator& operator=(const SharedPtrPool_RepAllocator&);
+
+  public:
+    // CREATORS
+    SharedPtrPool_RepAllocator(bool              threadSafe,
+                               bslma::Allocator *basicAllocator);
+        // Create an allocator of representations whose pool obtains memory
+        // from the specified 'basicAllocator', and that locks its pool if the
+        // specified 'threadSafe' is 'true'.
+
+    virtual ~SharedPtrPool_RepAllocator();
+        // Destroy this object, returning all the memory of its pool to the
+        // allocator supplied at construction.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a block of memory of the size of a
+        // representation, or 0 if the specified 'size' is 0.  The behavior is
+        // undefined unless 'size <= sizeof(Rep)'.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the pool.  If
+        // 'address' is 0, this function has no effect.  The behavior is
+        // undefined unless 'address' was supplied by this allocator and has
+        // not already been deallocated.
+
+    void reserve(int numReps);
+        // Add to the pool at least the specified 'numReps' blocks.
+};
+
+                           // ===================
+                           // class SharedPtrPool
+                           // ===================
+
+template <class ELEMENT_TYPE>
+class SharedPtrPool {
+    // This class template creates shared pointers to objects of the
+    // (template parameter) 'ELEMENT_TYPE' held in-place in their
+    // representations, and pools the memory of the representations.  All
+    // methods are thread-safe unless the pool is created 'SINGLE_THREADED'.
+
+    // DATA
+    SharedPtrPool_RepAllocator<ELEMENT_TYPE> d_repAllocator;
+                                               // supplies the representations
+
+    // NOT IMPLEMENTED
+    SharedPtrPool(const SharedPtrPool&);
+    SharedPtrPool& operator=(const SharedPtrPool&);
+
+  public:
+    // TYPES
+    enum Concurrency {
+        // Enumerate the ways in which threads may use a pool.
+
+        THREAD_SAFE,     // shared pointers may be created and released by
+                         // any thread
+
+        SINGLE_THREADED  // shared pointers are created and released by one
+                         // thread at a time
+    };
+
+    // CREATORS
+    explicit SharedPtrPool(bslma::Allocator *basicAllocator = 0);
+    explicit SharedPtrPool(Concurrency       concurrency,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create a pool of shared pointers to 'ELEMENT_TYPE' objects.
+        // Optionally specify a 'concurrency' mode; if 'concurrency' is not
+        // specified, the pool is 'THREAD_SAFE'.  Optionally specify a
+        // 'basicAllocator' used to supply the memory of the pool.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~SharedPtrPool();
+        // Destroy this pool, returning all its memory to the allocator
+        // supplied at construction.  The behavior is undefined unless every
+        // 'bsl::shared_ptr' and 'bsl::weak_ptr' created from this pool has
+        // been released.
+
+    // MANIPULATORS
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace();
+    template <class A1>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1);
+    template <class A1, class A2>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2);
+    template <class A1, class A2, class A3>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2,
+                                                const A3& a3);
+    template <class A1, class A2, class A3, class A4>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2,
+                                                const A3& a3,
+                                                const A4& a4);
+    template <class A1, class A2, class A3, class A4, class A5>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2,
+                                                const A3& a3,
+                                                const A4& a4,
+                                                const A5& a5);
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2,
+                                                const A3& a3,
+                                                const A4& a4,
+                                                const A5& a5,
+                                                const A6& a6);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2,
+                                                const A3& a3,
+                                                const A4& a4,
+                                                const A5& a5,
+                                                const A6& a6,
+                                                const A7& a7);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2,
+                                                const A3& a3,
+                                                const A4& a4,
+                                                const A5& a5,
+                                                const A6& a6,
+                                                const A7& a7,
+                                                const A8& a8);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1& a1,
+                                                const A2& a2,
+                                                const A3& a3,
+                                                const A4& a4,
+                                                const A5& a5,
+                                                const A6& a6,
+                                                const A7& a7,
+                                                const A8& a8,
+                                                const A9& a9);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1&  a1,
+                                                const A2&  a2,
+                                                const A3&  a3,
+                                                const A4&  a4,
+                                                const A5&  a5,
+                                                const A6&  a6,
+                                                const A7&  a7,
+                                                const A8&  a8,
+                                                const A9&  a9,
+                                                const A10& a10);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1&  a1,
+                                                const A2&  a2,
+                                                const A3&  a3,
+                                                const A4&  a4,
+                                                const A5&  a5,
+                                                const A6&  a6,
+                                                const A7&  a7,
+                                                const A8&  a8,
+                                                const A9&  a9,
+                                                const A10& a10,
+                                                const A11& a11);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1&  a1,
+                                                const A2&  a2,
+                                                const A3&  a3,
+                                                const A4&  a4,
+                                                const A5&  a5,
+                                                const A6&  a6,
+                                                const A7&  a7,
+                                                const A8&  a8,
+                                                const A9&  a9,
+                                                const A10& a10,
+                                                const A11& a11,
+                                                const A12& a12);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12,
+              class A13>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1&  a1,
+                                                const A2&  a2,
+                                                const A3&  a3,
+                                                const A4&  a4,
+                                                const A5&  a5,
+                                                const A6&  a6,
+                                                const A7&  a7,
+                                                const A8&  a8,
+                                                const A9&  a9,
+                                                const A10& a10,
+                                                const A11& a11,
+                                                const A12& a12,
+                                                const A13& a13);
+    template <class A1, class A2, class A3, class A4, class A5, class A6,
+              class A7, class A8, class A9, class A10, class A11, class A12,
+              class A13, class A14>
+    bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1&  a1,
+                                                const A2&  a2,
+                                                const A3&  a3,
+                                                const A4&  a4,
+                                                const A5&  a5,
+                                                const A6&  a6,
+                                                const A7&  a7,
+                                                const A8&  a8,
+                                                const A9&  a9,
+                                                const A10& a10,
+                                                const A11& a11,
+                                                const A12& a12,
+                                                const A13& a13,
+                                                const A14& a14);
+        // Return a shared pointer to a new 'ELEMENT_TYPE' object, constructed
+        // from the specified arguments 'a1' up to 'aN', where 'N' (at most
+        // 14) is the number of arguments passed to this method, and held in
+        // a representation taken from this pool.  If this pool is empty, it
+        // first grows by allocating from the allocator supplied at
+        // construction.  If an exception is thrown by the constructor of
+        // 'ELEMENT_TYPE', the representation is returned to the pool.
+
+    void reserve(int numObjects);
+        // Grow this pool, if needed, so that at least the specified
+        // 'numObjects' shared pointers can be created without allocating
+        // memory.  Note that the shared pointers already alive are not
+        // counted.
+
+};
+
+// ============================================================================
+//                      INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class SharedPtrPool_RepAllocator
+                      // --------------------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+SharedPtrPool_RepAllocator<ELEMENT_TYPE>::SharedPtrPool_RepAllocator(
+                                             bool              threadSafe,
+                                             bslma::Allocator *basicAllocator)
+: d_lock()
+, d_pool(bsl::allocator<Rep>(basicAllocator))
+, d_threadSafe(threadSafe)
+{
+}
+
+template <class ELEMENT_TYPE>
+SharedPtrPool_RepAllocator<ELEMENT_TYPE>::~SharedPtrPool_RepAllocator()
+{
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+void *SharedPtrPool_RepAllocator<ELEMENT_TYPE>::allocate(size_type size)
+{
+    BSLS_ASSERT_SAFE(size <= sizeof(Rep));
+
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    if (!d_threadSafe) {
+        return d_pool.allocate();                                     // RETURN
+    }
+
+    bsls::BslLockGuard guard(&d_lock);
+    return d_pool.allocate();
+}
+
+template <class ELEMENT_TYPE>
+void SharedPtrPool_RepAllocator<ELEMENT_TYPE>::deallocate(void *address)
+{
+    if (!address) {
+        return;                                                       // RETURN
+    }
+
+    if (!d_threadSafe) {
+        d_pool.deallocate(address);
+        return;                                                       // RETURN
+    }
+
+    bsls::BslLockGuard guard(&d_lock);
+    d_pool.deallocate(address);
+}
+
+template <class ELEMENT_TYPE>
+inline
+void SharedPtrPool_RepAllocator<ELEMENT_TYPE>::reserve(int numReps)
+{
+    BSLS_ASSERT_SAFE(0 <= numReps);
+
+    if (0 == numReps) {
+        return;                                                       // RETURN
+    }
+
+    if (!d_threadSafe) {
+        d_pool.reserve(numReps);
+        return;                                                       // RETURN
+    }
+
+    bsls::BslLockGuard guard(&d_lock);
+    d_pool.reserve(numReps);
+}
+
+                           // -------------------
+                           // class SharedPtrPool
+                           // -------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+SharedPtrPool<ELEMENT_TYPE>::SharedPtrPool(bslma::Allocator *basicAllocator)
+: d_repAllocator(true, bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class ELEMENT_TYPE>
+inline
+SharedPtrPool<ELEMENT_TYPE>::SharedPtrPool(Concurrency       concurrency,
+                                           bslma::Allocator *basicAllocator)
+: d_repAllocator(THREAD_SAFE == concurrency,
+                 bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class ELEMENT_TYPE>
+inline
+SharedPtrPool<ELEMENT_TYPE>::~SharedPtrPool()
+{
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace()
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2,
+                                           const A3& a3)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2,
+                                           const A3& a3,
+                                           const A4& a4)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2,
+                                           const A3& a3,
+                                           const A4& a4,
+                                           const A5& a5)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2,
+                                           const A3& a3,
+                                           const A4& a4,
+                                           const A5& a5,
+                                           const A6& a6)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2,
+                                           const A3& a3,
+                                           const A4& a4,
+                                           const A5& a5,
+                                           const A6& a6,
+                                           const A7& a7)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2,
+                                           const A3& a3,
+                                           const A4& a4,
+                                           const A5& a5,
+                                           const A6& a6,
+                                           const A7& a7,
+                                           const A8& a8)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7, a8);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1& a1,
+                                           const A2& a2,
+                                           const A3& a3,
+                                           const A4& a4,
+                                           const A5& a5,
+                                           const A6& a6,
+                                           const A7& a7,
+                                           const A8& a8,
+                                           const A9& a9)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1&  a1,
+                                           const A2&  a2,
+                                           const A3&  a3,
+                                           const A4&  a4,
+                                           const A5&  a5,
+                                           const A6&  a6,
+                                           const A7&  a7,
+                                           const A8&  a8,
+                                           const A9&  a9,
+                                           const A10& a10)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7, a8, a9,
+                         a10);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1&  a1,
+                                           const A2&  a2,
+                                           const A3&  a3,
+                                           const A4&  a4,
+                                           const A5&  a5,
+                                           const A6&  a6,
+                                           const A7&  a7,
+                                           const A8&  a8,
+                                           const A9&  a9,
+                                           const A10& a10,
+                                           const A11& a11)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7, a8, a9,
+                         a10, a11);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1&  a1,
+                                           const A2&  a2,
+                                           const A3&  a3,
+                                           const A4&  a4,
+                                           const A5&  a5,
+                                           const A6&  a6,
+                                           const A7&  a7,
+                                           const A8&  a8,
+                                           const A9&  a9,
+                                           const A10& a10,
+                                           const A11& a11,
+                                           const A12& a12)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7, a8, a9,
+                         a10, a11, a12);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12, class A13>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1&  a1,
+                                           const A2&  a2,
+                                           const A3&  a3,
+                                           const A4&  a4,
+                                           const A5&  a5,
+                                           const A6&  a6,
+                                           const A7&  a7,
+                                           const A8&  a8,
+                                           const A9&  a9,
+                                           const A10& a10,
+                                           const A11& a11,
+                                           const A12& a12,
+                                           const A13& a13)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7, a8, a9,
+                         a10, a11, a12, a13);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+          class A8, class A9, class A10, class A11, class A12, class A13,
+          class A14>
+inline
+bsl::shared_ptr<ELEMENT_TYPE>
+SharedPtrPool<ELEMENT_TYPE>::createInplace(const A1&  a1,
+                                           const A2&  a2,
+                                           const A3&  a3,
+                                           const A4&  a4,
+                                           const A5&  a5,
+                                           const A6&  a6,
+                                           const A7&  a7,
+                                           const A8&  a8,
+                                           const A9&  a9,
+                                           const A10& a10,
+                                           const A11& a11,
+                                           const A12& a12,
+                                           const A13& a13,
+                                           const A14& a14)
+{
+    bsl::shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(&d_repAllocator, a1, a2, a3, a4, a5, a6, a7, a8, a9,
+                         a10, a11, a12, a13, a14);
+    return result;
+}
+template <class ELEMENT_TYPE>
+inline
+void SharedPtrPool<ELEMENT_TYPE>::reserve(int numObjects)
+{
+    BSLS_ASSERT_SAFE(0 <= numObjects);
+
+    d_repAllocator.reserve(numObjects);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
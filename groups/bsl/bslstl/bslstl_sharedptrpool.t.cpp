@@ -0,0 +1,1076 @@
+// bslstl_sharedptrpool.t.cpp                                         -*-C++-*-
+#include <bslstl_sharedptrpool.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a factory of 'bsl::shared_ptr' objects
+// whose in-place representations are allocated from a pool, through an
+// implementation of the 'bslma::Allocator' protocol.  The allocator is tested
+// first, directly.  The factory is then tested for every number of
+// constructor arguments, verifying with 'bslma::TestAllocator' that memory is
+// allocated only when the pool grows, that a representation is returned to
+// the pool when its last shared and weak reference is released, also when
+// the constructor of the object throws, and that the pool returns all its
+// memory when destroyed.  Finally, several threads create and release shared
+// pointers concurrently.
+// ----------------------------------------------------------------------------
+// SharedPtrPool_RepAllocator
+// [ 2] SharedPtrPool_RepAllocator(bool, bslma::Allocator *);
+// [ 2] ~SharedPtrPool_RepAllocator();
+// [ 2] void *allocate(size_type size);
+// [ 2] void deallocate(void *address);
+// [ 2] void reserve(int numReps);
+//
+// SharedPtrPool
+// [ 1] SharedPtrPool(bslma::Allocator *basicAllocator = 0);
+// [ 1] SharedPtrPool(Concurrency, bslma::Allocator *basicAllocator = 0);
+// [ 1] ~SharedPtrPool();
+// [ 3] bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1&, ...);
+// [ 5] void reserve(int numObjects);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] EXCEPTION SAFETY
+// [ 6] CONCURRENT CREATION AND RELEASE
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: CREATE AND RELEASE
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64 Int64;
+
+                            // ===================
+                            // class CountedObject
+                            // ===================
+
+class CountedObject {
+    // This class records its destruction by incrementing a counter supplied
+    // at construction.
+
+    // DATA
+    int *d_numDestroyed_p;  // incremented on destruction (held, not owned)
+    int  d_value;           // value of this object
+
+  public:
+    // CREATORS
+    explicit CountedObject(int *numDestroyed, int value = 0)
+    : d_numDestroyed_p(numDestroyed)
+    , d_value(value)
+        // Create an object having the specified 'value' that increments the
+        // specified 'numDestroyed' when destroyed.
+    {
+    }
+
+    ~CountedObject()
+        // Increment the counter supplied at construction.
+    {
+        ++*d_numDestroyed_p;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+                              // ==============
+                              // struct SumOf14
+                              // ==============
+
+struct SumOf14 {
+    // This 'struct' has a constructor taking up to 14 arguments.
+
+    int d_sum;  // sum of the constructor arguments
+
+    explicit
+    SumOf14(int a1 = 0, int a2 = 0, int a3 = 0, int a4 = 0, int a5 = 0,
+            int a6 = 0, int a7 = 0, int a8 = 0, int a9 = 0, int a10 = 0,
+            int a11 = 0, int a12 = 0, int a13 = 0, int a14 = 0)
+    : d_sum(a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 + a12
+            + a13 + a14)
+        // Create an object holding the sum of the optionally specified 'a1'
+        // up to 'a14'.
+    {
+    }
+};
+
+                           // ====================
+                           // struct ThrowingObject
+                           // ====================
+
+struct ThrowingObject {
+    // This 'struct' has a constructor that throws an exception when given a
+    // negative argument.
+
+    int d_value;  // value of this object
+
+    explicit ThrowingObject(int value)
+    : d_value(value)
+        // Create an object having the specified 'value', or throw 'value' if
+        // it is negative.
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (value < 0) {
+            throw value;
+        }
+#endif
+    }
+};
+
+                                // ==========
+                                // struct Tick
+                                // ==========
+
+struct Tick {
+    // This 'struct' is a small market-data event used by the performance
+    // test.
+
+    Int64  d_instrument;      // instrument identifier
+    Int64  d_sequenceNumber;  // sequence number
+    double d_price;           // price
+    int    d_size;            // size
+
+    Tick(Int64 instrument, Int64 sequenceNumber, double price, int size)
+    : d_instrument(instrument)
+    , d_sequenceNumber(sequenceNumber)
+    , d_price(price)
+    , d_size(size)
+        // Create a tick having the specified 'instrument', 'sequenceNumber',
+        // 'price', and 'size'.
+    {
+    }
+};
+
+typedef bslstl::SharedPtrPool<CountedObject>              Obj;
+typedef bslstl::SharedPtrPool_RepAllocator<CountedObject> RepAllocator;
+typedef bslma::SharedPtrInplaceRep<CountedObject>         Rep;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef void *(*thread_func)(void *arg);
+
+thread_t createThread(thread_func func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+void joinThread(thread_t thr)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+enum {
+    NUM_THREADS       = 4,    // threads in the concurrency test
+    NUM_HELD          = 32,   // objects held at a time by each thread
+    NUM_ITERATIONS    = 500   // rounds of creation by each thread
+};
+
+struct ThreadArgs {
+    // This 'struct' holds the arguments of 'createAndReleaseThread'.
+
+    Obj               *d_pool_p;        // pool shared by all threads
+    bsls::AtomicInt   *d_numDestroyed;  // objects destroyed by all threads
+    int                d_threadId;      // identifies the thread
+    bool               d_valuesOk;      // set by the thread
+};
+
+extern "C" void *createAndReleaseThread(void *arg)
+    // Repeatedly create 'NUM_HELD' objects from the pool of the specified
+    // 'arg', a 'ThreadArgs' object, verify their values, and release them.
+{
+    ThreadArgs& args = *static_cast<ThreadArgs *>(arg);
+
+    int numDestroyed = 0;
+
+    args.d_valuesOk = true;
+    for (int i = 0; i < NUM_ITERATIONS; ++i) {
+        bsl::shared_ptr<CountedObject> held[NUM_HELD];
+        for (int j = 0; j < NUM_HELD; ++j) {
+            held[j] = args.d_pool_p->createInplace(&numDestroyed,
+                                                   args.d_threadId * j);
+        }
+        for (int j = 0; j < NUM_HELD; ++j) {
+            if (held[j]->value() != args.d_threadId * j) {
+                args.d_valuesOk = false;
+            }
+        }
+    }
+    args.d_numDestroyed->add(numDestroyed);
+    return 0;
+}
+
+template <class FACTORY>
+double timeCreateAndRelease(FACTORY *factory, int numObjects)
+    // Return the time, in seconds, to create and immediately release the
+    // specified 'numObjects' shared pointers from the specified 'factory'.
+{
+    bsls::Stopwatch timer;
+    Int64           sum = 0;
+
+    timer.start();
+    for (int i = 0; i < numObjects; ++i) {
+        bsl::shared_ptr<Tick> tick = factory->create(i);
+        sum += tick->d_sequenceNumber;
+    }
+    timer.stop();
+
+    ASSERT(static_cast<Int64>(numObjects) * (numObjects - 1) / 2 == sum);
+    return timer.elapsedTime();
+}
+
+template <class FACTORY>
+double timeCreateBatches(FACTORY *factory, int numBatches)
+    // Return the time, in seconds, to create a batch of 1024 shared pointers
+    // from the specified 'factory' and then release them all, the specified
+    // 'numBatches' times.
+{
+    enum { BATCH_SIZE = 1024 };
+
+    bsl::shared_ptr<Tick> batch[BATCH_SIZE];
+    bsls::Stopwatch       timer;
+
+    timer.start();
+    for (int round = 0; round < numBatches; ++round) {
+        for (int i = 0; i < BATCH_SIZE; ++i) {
+            batch[i] = factory->create(i);
+        }
+        for (int i = 0; i < BATCH_SIZE; ++i) {
+            batch[i].reset();
+        }
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+struct AllocatorFactory {
+    // This 'struct' creates shared pointers to 'Tick' objects with
+    // 'bsl::shared_ptr::createInplace' and an allocator.
+
+    bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+
+    bsl::shared_ptr<Tick> create(int sequenceNumber)
+        // Return a shared pointer to a new 'Tick' having the specified
+        // 'sequenceNumber'.
+    {
+        bsl::shared_ptr<Tick> result;
+        result.createInplace(d_allocator_p, 7, sequenceNumber, 100.5, 10);
+        return result;
+    }
+};
+
+struct PoolFactory {
+    // This 'struct' creates shared pointers to 'Tick' objects with a
+    // 'bslstl::SharedPtrPool'.
+
+    bslstl::SharedPtrPool<Tick> *d_pool_p;  // pool (held, not owned)
+
+    bsl::shared_ptr<Tick> create(int sequenceNumber)
+        // Return a shared pointer to a new 'Tick' having the specified
+        // 'sequenceNumber'.
+    {
+        return d_pool_p->createInplace(7, sequenceNumber, 100.5, 10);
+    }
+};
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Example 1: Publishing Events
+/// - - - - - - - - - - - - - -
+
+struct Event {
+    int    d_sequenceNumber;
+    double d_price;
+
+    Event(int sequenceNumber, double price)
+    : d_sequenceNumber(sequenceNumber)
+    , d_price(price)
+    {
+    }
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        //Example 1: Publishing Events
+        // - - - - - - - - - - - - - -
+        bslma::TestAllocator         ta;
+        bslstl::SharedPtrPool<Event> pool(&ta);
+
+        bsl::shared_ptr<Event> event = pool.createInplace(1, 100.5);
+        ASSERT(1     == event->d_sequenceNumber);
+        ASSERT(100.5 == event->d_price);
+
+        event.reset();
+        const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+        for (int i = 2; i < 100; ++i) {
+            bsl::shared_ptr<Event> next = pool.createInplace(i, 100.5);
+            ASSERT(i == next->d_sequenceNumber);
+        }
+        ASSERT(numAllocations == ta.numAllocations());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT CREATION AND RELEASE
+        //
+        // Concerns:
+        //: 1 Several threads can create and release shared pointers from the
+        //:   same pool concurrently, and every object is constructed with its
+        //:   own arguments and destroyed once.
+        //:
+        //: 2 The pool does not grow beyond the number of objects alive at a
+        //:   time.
+        //
+        // Plan:
+        //: 1 Run 'NUM_THREADS' threads, each repeatedly creating and then
+        //:   releasing 'NUM_HELD' objects from a shared pool, and verify the
+        //:   values and the number of destroyed objects.  (C-1)
+        //:
+        //: 2 Verify that the memory used by the pool is at most that needed
+        //:   for twice the maximum number of objects alive.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT CREATION AND RELEASE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT CREATION AND RELEASE"
+                            "\n===============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bsls::AtomicInt      numDestroyed(0);
+
+        {
+            Obj mX(&oa);
+
+            ThreadArgs args[NUM_THREADS];
+            thread_t   threads[NUM_THREADS];
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                args[i].d_pool_p       = &mX;
+                args[i].d_numDestroyed = &numDestroyed;
+                args[i].d_threadId     = i + 1;
+                args[i].d_valuesOk     = false;
+                threads[i] = createThread(&createAndReleaseThread, &args[i]);
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+                LOOP_ASSERT(i, args[i].d_valuesOk);
+            }
+
+            if (veryVerbose) {
+                P_(oa.numBytesInUse()) P(oa.numAllocations())
+            }
+            ASSERT(oa.numBytesInUse() <= static_cast<Int64>(
+                                   2 * NUM_THREADS * NUM_HELD * sizeof(Rep)
+                                   + 64 * sizeof(void *)));
+        }
+        ASSERT(NUM_THREADS * NUM_ITERATIONS * NUM_HELD == numDestroyed);
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'reserve' AND REUSE
+        //
+        // Concerns:
+        //: 1 After 'reserve(n)', 'n' shared pointers can be created without
+        //:   allocating memory.
+        //:
+        //: 2 A representation released to the pool is reused by the next
+        //:   shared pointer created, without allocating memory.
+        //:
+        //: 3 A representation returns to the pool only when its last weak
+        //:   reference is released.
+        //
+        // Plan:
+        //: 1 Reserve objects, then create as many and verify that the number
+        //:   of allocations is unchanged.  (C-1)
+        //:
+        //: 2 Create and release a shared pointer, create another, and verify
+        //:   that it reuses the representation of the first.  (C-2)
+        //:
+        //: 3 Keep a weak pointer to an object, release its shared pointer, and
+        //:   verify that the object is destroyed but its representation is
+        //:   not reused until the weak pointer is released.  (C-3)
+        //
+        // Testing:
+        //   void reserve(int numObjects);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'reserve' AND REUSE"
+                            "\n==================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\t'reserve'.\n");
+        {
+            enum { NUM_OBJECTS = 100 };
+
+            int numDestroyed = 0;
+
+            Obj mX(&oa);
+
+            mX.reserve(NUM_OBJECTS);
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+            ASSERT(0 < NUM_ALLOCATIONS);
+
+            bsl::shared_ptr<CountedObject> held[NUM_OBJECTS];
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                held[i] = mX.createInplace(&numDestroyed, i);
+            }
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            mX.reserve(0);
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                held[i].reset();
+            }
+            ASSERT(NUM_OBJECTS == numDestroyed);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tReuse.\n");
+        {
+            int numDestroyed = 0;
+
+            Obj mX(&oa);
+
+            bsl::shared_ptr<CountedObject> sp = mX.createInplace(&numDestroyed,
+                                                                 1);
+            const void *const REP = sp.rep();
+            sp.reset();
+
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            sp = mX.createInplace(&numDestroyed, 2);
+            ASSERT(REP             == sp.rep());
+            ASSERT(2               == sp->value());
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tWeak references.\n");
+        {
+            int numDestroyed = 0;
+
+            Obj mX(&oa);
+
+            bsl::shared_ptr<CountedObject> sp = mX.createInplace(&numDestroyed,
+                                                                 1);
+            const void *const REP = sp.rep();
+
+            bsl::weak_ptr<CountedObject> wp(sp);
+            sp.reset();
+            ASSERT(1 == numDestroyed);
+            ASSERT(wp.expired());
+
+            sp = mX.createInplace(&numDestroyed, 2);
+            ASSERT(REP != sp.rep());
+
+            wp.reset();
+            sp.reset();
+
+            bsl::shared_ptr<CountedObject> sp2 =
+                                            mX.createInplace(&numDestroyed, 3);
+            ASSERT(0 != sp2.rep());
+            ASSERT(2 == numDestroyed);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If the constructor of the object throws, the representation is
+        //:   returned to the pool, and no memory is leaked.
+        //:
+        //: 2 If the allocator of the pool throws while the pool grows, the
+        //:   pool is left unchanged and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Create objects whose constructor throws, and verify that a
+        //:   subsequent creation reuses the representation without
+        //:   allocating.  (C-1)
+        //:
+        //: 2 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, create
+        //:   objects from a pool whose allocator throws, and verify that the
+        //:   pool releases all its memory when destroyed.  (C-2)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tThrowing constructor.\n");
+        {
+            bslstl::SharedPtrPool<ThrowingObject> mX(&oa);
+
+            bsl::shared_ptr<ThrowingObject> sp = mX.createInplace(1);
+            sp.reset();
+
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            for (int i = 0; i < 10; ++i) {
+                bool caught = false;
+                try {
+                    sp = mX.createInplace(-1);
+                }
+                catch (int value) {
+                    ASSERT(-1 == value);
+                    caught = true;
+                }
+                ASSERT(caught);
+                ASSERT(!sp);
+            }
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            sp = mX.createInplace(2);
+            ASSERT(2 == sp->d_value);
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tThrowing allocator.\n");
+        {
+            enum { NUM_OBJECTS = 20 };
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                int numDestroyed = 0;
+                {
+                    Obj mX(&oa);
+
+                    bsl::shared_ptr<CountedObject> held[NUM_OBJECTS];
+                    for (int i = 0; i < NUM_OBJECTS; ++i) {
+                        held[i] = mX.createInplace(&numDestroyed, i);
+                    }
+                    for (int i = 0; i < NUM_OBJECTS; ++i) {
+                        LOOP_ASSERT(i, i == held[i]->value());
+                    }
+                }
+                ASSERT(0 == oa.numBlocksInUse());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'createInplace'
+        //
+        // Concerns:
+        //: 1 'createInplace' forwards each of 0 to 14 arguments to the
+        //:   constructor of the object.
+        //:
+        //: 2 The shared pointer refers to the object held in its
+        //:   representation, and has a single reference.
+        //:
+        //: 3 Memory is obtained from the allocator of the pool only when the
+        //:   pool grows, and never from the default allocator.
+        //
+        // Plan:
+        //: 1 For each number of arguments, create a 'SumOf14' object and
+        //:   verify the sum of its arguments.  (C-1)
+        //:
+        //: 2 Create 'CountedObject' objects, verify their values and
+        //:   reference counts, release them, and create them again, verifying
+        //:   that no memory is allocated the second time.  (C-2..3)
+        //
+        // Testing:
+        //   bsl::shared_ptr<ELEMENT_TYPE> createInplace(const A1&, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'createInplace'"
+                            "\n===============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tForwarding 0 to 14 arguments.\n");
+        {
+            bslstl::SharedPtrPool<SumOf14> mX(&oa);
+
+            ASSERT(0 == mX.createInplace()->d_sum);
+            ASSERT(1 == mX.createInplace(1)->d_sum);
+            ASSERT(3 == mX.createInplace(1, 2)->d_sum);
+            ASSERT(6 == mX.createInplace(1, 2, 3)->d_sum);
+            ASSERT(10 == mX.createInplace(1, 2, 3, 4)->d_sum);
+            ASSERT(15 == mX.createInplace(1, 2, 3, 4, 5)->d_sum);
+            ASSERT(21 == mX.createInplace(1, 2, 3, 4, 5, 6)->d_sum);
+            ASSERT(28 == mX.createInplace(1, 2, 3, 4, 5, 6, 7)->d_sum);
+            ASSERT(36 == mX.createInplace(1, 2, 3, 4, 5, 6, 7, 8)->d_sum);
+            ASSERT(45 == mX.createInplace(1, 2, 3, 4, 5, 6, 7, 8, 9)->d_sum);
+            ASSERT(55 == mX.createInplace(1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                          10)->d_sum);
+            ASSERT(66 == mX.createInplace(1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                          10, 11)->d_sum);
+            ASSERT(78 == mX.createInplace(1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                          10, 11, 12)->d_sum);
+            ASSERT(91 == mX.createInplace(1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                          10, 11, 12, 13)->d_sum);
+            ASSERT(105 == mX.createInplace(1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                           10, 11, 12, 13, 14)->d_sum);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tReusing representations.\n");
+        for (int mode = 0; mode < 2; ++mode) {
+            const Obj::Concurrency CONCURRENCY = mode ? Obj::SINGLE_THREADED
+                                                      : Obj::THREAD_SAFE;
+            if (veryVerbose) { T_ P(CONCURRENCY) }
+
+            enum { NUM_OBJECTS = 16 };
+
+            int numDestroyed = 0;
+
+            Obj mX(CONCURRENCY, &oa);
+
+            bsl::shared_ptr<CountedObject> held[NUM_OBJECTS];
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                held[i] = mX.createInplace(&numDestroyed, i);
+                LOOP_ASSERT(i, i == held[i]->value());
+                LOOP_ASSERT(i, 1 == held[i].use_count());
+                LOOP_ASSERT(i, held[i].get() == held[i].rep()->originalPtr());
+            }
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                held[i].reset();
+            }
+            ASSERT(NUM_OBJECTS == numDestroyed);
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                held[i] = mX.createInplace(&numDestroyed, -i);
+                LOOP_ASSERT(i, -i == held[i]->value());
+            }
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'SharedPtrPool_RepAllocator'
+        //
+        // Concerns:
+        //: 1 'allocate' returns distinct blocks large enough for a
+        //:   representation, and 0 for a request of 0 bytes.
+        //:
+        //: 2 'deallocate' returns a block for reuse, and ignores 0.
+        //:
+        //: 3 'reserve' grows the pool so that as many blocks can be allocated
+        //:   without allocating memory.
+        //:
+        //: 4 The destructor returns the free blocks of the pool, so that no
+        //:   memory remains in use once every block has been deallocated.
+        //:
+        //: 5 Requests larger than a representation are detected in
+        //:   appropriate build modes.
+        //
+        // Plan:
+        //: 1 Allocate blocks, verify that they do not overlap, deallocate and
+        //:   reallocate them, and verify with a test allocator that memory is
+        //:   obtained only when the pool grows.  (C-1..3)
+        //:
+        //: 2 Deallocate every block, destroy the allocator, and verify that
+        //:   the test allocator has no blocks in use.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid sizes, using the 'BSLS_ASSERTTEST_*'
+        //:   macros.  (C-5)
+        //
+        // Testing:
+        //   SharedPtrPool_RepAllocator(bool, bslma::Allocator *);
+        //   ~SharedPtrPool_RepAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   void reserve(int numReps);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'SharedPtrPool_RepAllocator'"
+                            "\n============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int threadSafe = 0; threadSafe < 2; ++threadSafe) {
+            if (veryVerbose) { T_ P(threadSafe) }
+
+            enum { NUM_BLOCKS = 10 };
+
+            const Int64 NUM_PRIOR = oa.numAllocations();
+
+            RepAllocator mX(threadSafe, &oa);
+            ASSERT(NUM_PRIOR == oa.numAllocations());
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(NUM_PRIOR == oa.numAllocations());
+
+            mX.deallocate(0);
+
+            char *blocks[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = static_cast<char *>(mX.allocate(sizeof(Rep)));
+                for (int j = 0; j < i; ++j) {
+                    LOOP2_ASSERT(i, j, blocks[i] + sizeof(Rep) <= blocks[j]
+                                    || blocks[j] + sizeof(Rep) <= blocks[i]);
+                }
+            }
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            char *reused[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                reused[i] = static_cast<char *>(mX.allocate(1));
+                bool found = false;
+                for (int j = 0; j < NUM_BLOCKS; ++j) {
+                    found = found || blocks[j] == reused[i];
+                }
+                LOOP_ASSERT(i, found);
+            }
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            mX.reserve(NUM_BLOCKS);
+            const Int64 NUM_RESERVED = oa.numAllocations();
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = static_cast<char *>(mX.allocate(sizeof(Rep)));
+            }
+            ASSERT(NUM_RESERVED == oa.numAllocations());
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+                mX.deallocate(reused[i]);
+            }
+
+            if (verbose) printf("\tNegative testing.\n");
+            {
+                bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+                ASSERT_SAFE_FAIL(mX.allocate(sizeof(Rep) + 1));
+                ASSERT_SAFE_FAIL(mX.reserve(-1));
+                ASSERT_SAFE_PASS(mX.reserve(0));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, create and release shared pointers, and verify the
+        //:   objects and the memory used.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   SharedPtrPool(bslma::Allocator *basicAllocator = 0);
+        //   SharedPtrPool(Concurrency, bslma::Allocator *basicAllocator = 0);
+        //   ~SharedPtrPool();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        int numDestroyed = 0;
+        {
+            Obj mX(&oa);
+
+            bsl::shared_ptr<CountedObject> sp1 =
+                                            mX.createInplace(&numDestroyed, 1);
+            ASSERT(1 == sp1->value());
+            ASSERT(1 == sp1.use_count());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            bsl::shared_ptr<CountedObject> sp2 = sp1;
+            ASSERT(2 == sp1.use_count());
+
+            sp1.reset();
+            ASSERT(0 == numDestroyed);
+
+            sp2.reset();
+            ASSERT(1 == numDestroyed);
+
+            sp1 = mX.createInplace(&numDestroyed, 2);
+            ASSERT(2 == sp1->value());
+            ASSERT(1 == oa.numAllocations());
+        }
+        ASSERT(2 == numDestroyed);
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tDefault allocator.\n");
+        {
+            Obj mX;
+
+            bsl::shared_ptr<CountedObject> sp = mX.createInplace(&numDestroyed,
+                                                                 3);
+            ASSERT(1 == da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tSingle-threaded pool.\n");
+        {
+            Obj mX(Obj::SINGLE_THREADED, &oa);
+
+            bsl::shared_ptr<CountedObject> sp =
+                                            mX.createInplace(&numDestroyed, 4);
+            ASSERT(4 == sp->value());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(4 == numDestroyed);
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: CREATE AND RELEASE
+        //
+        // Concerns:
+        //: 1 Report the cost of creating and releasing a shared pointer with
+        //:   a thread-safe and a single-threaded pool, compared with
+        //:   'bsl::shared_ptr::createInplace' using the 'new'/'delete'
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 For each factory, time creating and immediately releasing shared
+        //:   pointers one at a time, and in batches of 1024, and print the
+        //:   mean time per shared pointer and the rate.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: CREATE AND RELEASE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: CREATE AND RELEASE"
+                            "\n====================================\n");
+
+        const int NUM_BATCHES = 5000;
+        const int NUM_OBJECTS = 1024 * NUM_BATCHES;  // see 'timeCreateBatches'
+
+        bslma::Allocator *newDelete = &bslma::NewDeleteAllocator::singleton();
+
+        typedef bslstl::SharedPtrPool<Tick> TickPool;
+
+        TickPool safePool(TickPool::THREAD_SAFE, newDelete);
+        TickPool singlePool(TickPool::SINGLE_THREADED, newDelete);
+
+        AllocatorFactory allocatorFactory = { newDelete };
+        PoolFactory      safeFactory      = { &safePool };
+        PoolFactory      singleFactory    = { &singlePool };
+
+        const double ALLOCATOR_ONE   = timeCreateAndRelease(&allocatorFactory,
+                                                            NUM_OBJECTS);
+        const double SAFE_ONE        = timeCreateAndRelease(&safeFactory,
+                                                            NUM_OBJECTS);
+        const double SINGLE_ONE      = timeCreateAndRelease(&singleFactory,
+                                                            NUM_OBJECTS);
+        const double ALLOCATOR_BATCH = timeCreateBatches(&allocatorFactory,
+                                                         NUM_BATCHES);
+        const double SAFE_BATCH      = timeCreateBatches(&safeFactory,
+                                                         NUM_BATCHES);
+        const double SINGLE_BATCH    = timeCreateBatches(&singleFactory,
+                                                         NUM_BATCHES);
+
+        printf("%-18s %14s %14s %14s\n",
+               "(ns/object)", "createInplace", "THREAD_SAFE",
+               "SINGLE_THREADED");
+        printf("%-18s %14.2f %14.2f %14.2f\n",
+               "one at a time",
+               ALLOCATOR_ONE * 1e9 / NUM_OBJECTS,
+               SAFE_ONE * 1e9 / NUM_OBJECTS,
+               SINGLE_ONE * 1e9 / NUM_OBJECTS);
+        printf("%-18s %14.2f %14.2f %14.2f\n",
+               "batches of 1024",
+               ALLOCATOR_BATCH * 1e9 / NUM_OBJECTS,
+               SAFE_BATCH * 1e9 / NUM_OBJECTS,
+               SINGLE_BATCH * 1e9 / NUM_OBJECTS);
+        printf("%-18s %14.2f %14.2f %14.2f\n",
+               "millions/s (one)",
+               NUM_OBJECTS / ALLOCATOR_ONE / 1e6,
+               NUM_OBJECTS / SAFE_ONE / 1e6,
+               NUM_OBJECTS / SINGLE_ONE / 1e6);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
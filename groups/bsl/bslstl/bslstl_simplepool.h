@@ -22,25 +22,18 @@ BSLS_IDENT("$Id: $")
 // list for potential reuse.
 //
 // Whenever the linked list of free memory blocks is depleted,
-// 'bslstl::SimplePool' replenishes the list by first allocating a large,
-// contiguous "chunk" of memory, then splitting the chunk into multiple memory
-// blocks each having the 'sizeof' the simple pool's parameterized type.  A
-// chunk and its constituent memory blocks can be depicted visually:
-//..
-//     +-----+--- memory blocks of uniform size for parameterized type
-//     |     |
-//   ----- ----- ------------
-//  |     |     |     ...    |
-//   =====^=====^============
-//
-//   \___________ __________/
-//               V
-//           a "chunk"
-//..
+// 'bslstl::SimplePool' allocates a new memory block, having the 'sizeof' the
+// simple pool's parameterized type, from its allocator.  Each block is a
+// separate allocation, so a block does not depend on the pool that allocated
+// it: a block allocated by one pool may be deallocated to another pool using
+// an equal allocator, which then reuses it, or returned directly to such an
+// allocator by the 'deallocateBlock' class method.  This lets a node-based
+// container pass a node to another container using an equal allocator without
+// copying it.  'release', as well as the destructor, returns only the free
+// blocks of a pool to the allocator; the blocks still in use are not affected.
+//
 // This pool implementation is simple because its allocation strategy is not
-// configurable.  The size of a chunk starts from 1 memory block, and doubles
-// each time a chunk is allocated up to an implementation defined maximum
-// number of blocks.
+// configurable.
 //
 ///Comparison with 'bdema_Pool'
 ///----------------------------
@@ -101,6 +94,9 @@ BSLS_IDENT("$Id: $")
 //          // 'basicAllocator' used to supply memory.  If 'basicAllocator' is
 //          // 0, the currently installed default allocator is used.
 //
+//      ~my_Stack();
+//          // Destroy this object.
+//
 //      // MANIPULATORS
 //      void push(int value);
 //          // Insert an element with the specified value to the top of this
@@ -121,7 +117,8 @@ BSLS_IDENT("$Id: $")
 //..
 // Now, we define the implementation of the stack.  Notice how
 // 'bslstl::SimplePool' is used to allocate memory in 'push' and deallocate
-// memory in 'pop':
+// memory in 'pop'.  Also notice that the destructor pops the remaining
+// elements, since the pool returns to the allocator only its free blocks:
 //..
 //  // CREATORS
 //  template <class ALLOCATOR>
@@ -132,6 +129,14 @@ BSLS_IDENT("$Id: $")
 //  {
 //  }
 //
+//  template <class ALLOCATOR>
+//  my_Stack<ALLOCATOR>::~my_Stack()
+//  {
+//      while (d_head_p) {
+//          pop();
+//      }
+//  }
+//
 //  // MANIPULATORS
 //  template <class ALLOCATOR>
 //  void my_Stack<ALLOCATOR>::push(int value)
@@ -286,16 +291,13 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
                                             // ensure proper alignment
     };
 
-    union Chunk {
-        // This 'union' prepends to the beginning of each managed block of
-        // allocated memory, implementing a singly-linked list of managed
-        // chunks, and thereby enabling constant-time additions to the list of
-        // chunks.
-
-        Chunk *d_next_p;  // pointer to next Chunk
+    enum {
+        // Number of 'bsls::AlignmentUtil::MaxAlignedType' objects allocated
+        // for each block.
 
-        typename bsls::AlignmentFromType<Block>::Type d_alignment;
-                          // ensure each block is correctly aligned
+        k_BLOCK_SIZE = (sizeof(Block)
+                        + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                     / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
     };
 
   public:
@@ -315,11 +317,7 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
   private:
     // DATA
-    Chunk *d_chunkList_p;     // linked list of "chunks" of memory
-
-    Block *d_freeList_p;      // linked list of free memory blocks
-
-    int    d_blocksPerChunk;  // current chunk size (in blocks-per-chunk)
+    Block *d_freeList_p;  // linked list of free memory blocks
 
   private:
     // NOT IMPLEMENTED
@@ -328,28 +326,28 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
   private:
     // PRIVATE MANIPULATORS
-    Block *allocateChunk(size_type size);
-        // Allocate a chunk of memory with at least the specified 'size' number
-        // of usable bytes and add the chunk to the chunk list.  Return the
-        // address of the usable portion of the memory.
-
-    void replenish();
-        // Dynamically allocate a new chunk using the pool's underlying growth
-        // strategy, and use the chunk to replenish the free memory list of
-        // this pool.
+    Block *allocateBlock();
+        // Allocate a memory block from the allocator of this pool, and return
+        // its address.
 
   public:
+    // CLASS METHODS
+    static void deallocateBlock(AllocatorType *allocator, void *address);
+        // Return the memory block at the specified 'address' to the specified
+        // 'allocator'.  The behavior is undefined unless 'address' was
+        // allocated by a 'SimplePool' of the same type using an allocator
+        // equal to '*allocator', and is not in the free list of a pool.
+
     // CREATORS
     explicit SimplePool(const ALLOCATOR& allocator);
         // Create a memory pool that returns blocks of contiguous memory of the
         // size of the parameterized 'VALUE' using the specified 'allocator' to
-        // supply memory.  The chunk size grows starting with at least
-        // 'sizeof(VALUE)', doubling in size up to an implementation defined
-        // maximum number of blocks per chunk.
+        // supply memory.
 
     ~SimplePool();
-        // Destroy this pool, releasing all associated memory back to the
-        // underlying allocator.
+        // Destroy this pool, returning the free memory blocks of this pool to
+        // its allocator.  Note that the blocks that are still in use are not
+        // affected.
 
     // MANIPULATORS
     AllocatorType& allocator();
@@ -364,17 +362,18 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     void deallocate(void *address);
         // Relinquish the memory block at the specified 'address' back to this
         // pool object for reuse.  The behavior is undefined unless 'address'
-        // is non-zero, was allocated by this pool, and has not already been
+        // is non-zero, was allocated by a 'SimplePool' of the same type using
+        // an allocator equal to that of this pool, and has not already been
         // deallocated.
 
     void reserve(size_type numBlocks);
-        // Dynamically allocate a new chunk containing the specified
-        // 'numBlocks' number of blocks, and use the chunk to replenish the
-        // free memory list of this pool.  The behavior is undefined unless
-        // '0 < numBlocks'.
+        // Allocate the specified 'numBlocks' number of memory blocks, and add
+        // them to the free memory list of this pool.  The behavior is
+        // undefined unless '0 < numBlocks'.
 
     void release();
-        // Relinquish all memory currently allocated via this pool object.
+        // Return the free memory blocks of this pool to its allocator.  Note
+        // that the blocks that are still in use are not affected.
 
     void swap(SimplePool& other);
         // Efficiently exchange the memory blocks of this object with those of
@@ -408,40 +407,28 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
 // PRIVATE MANIPULATORS
 template <class VALUE, class ALLOCATOR>
+inline
 typename SimplePool<VALUE, ALLOCATOR>::Block *
-SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
+SimplePool<VALUE, ALLOCATOR>::allocateBlock()
 {
-    // Determine the number of bytes we want to allocate and compute the number
-    // of 'MaxAlignedType' needed to contain those bytes.
-
-    size_type numBytes = static_cast<size_type>(sizeof(Chunk)) + size;
-    size_type numMaxAlignedType =
-                       (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
-                     / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
-
-    Chunk *chunkPtr = reinterpret_cast<Chunk *>(
-                    AllocatorTraits::allocate(allocator(), numMaxAlignedType));
-
-    BSLS_ASSERT_SAFE(0 ==
-             reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
-
-    chunkPtr->d_next_p = d_chunkList_p;
-    d_chunkList_p      = chunkPtr;
-
-    return reinterpret_cast<Block *>(chunkPtr + 1);
+    return reinterpret_cast<Block *>(
+                         AllocatorTraits::allocate(allocator(), k_BLOCK_SIZE));
 }
 
+// CLASS METHODS
 template <class VALUE, class ALLOCATOR>
 inline
-void SimplePool<VALUE, ALLOCATOR>::replenish()
+void SimplePool<VALUE, ALLOCATOR>::deallocateBlock(AllocatorType *allocator,
+                                                   void          *address)
 {
-    reserve(d_blocksPerChunk);
-
-    enum { MAX_BLOCKS_PER_CHUNK = 32 };
+    BSLS_ASSERT_SAFE(allocator);
+    BSLS_ASSERT_SAFE(address);
 
-    if (d_blocksPerChunk < MAX_BLOCKS_PER_CHUNK) {
-        d_blocksPerChunk *= 2;
-    }
+    AllocatorTraits::deallocate(
+                       *allocator,
+                       static_cast<typename AllocatorTraits::value_type *>(
+                                                                     address),
+                       k_BLOCK_SIZE);
 }
 
 // CREATORS
@@ -449,9 +436,7 @@ template <class VALUE, class ALLOCATOR>
 inline
 SimplePool<VALUE, ALLOCATOR>::SimplePool(const ALLOCATOR& allocator)
 : AllocatorType(allocator)
-, d_chunkList_p(0)
 , d_freeList_p(0)
-, d_blocksPerChunk(1)
 {
 }
 
@@ -476,7 +461,7 @@ inline
 VALUE *SimplePool<VALUE, ALLOCATOR>::allocate()
 {
     if (!d_freeList_p) {
-        replenish();
+        return reinterpret_cast<VALUE *>(allocateBlock());            // RETURN
     }
     VALUE *block = reinterpret_cast<VALUE *>(d_freeList_p);
     d_freeList_p = d_freeList_p->d_next_p;
@@ -499,9 +484,7 @@ void SimplePool<VALUE, ALLOCATOR>::swap(SimplePool<VALUE, ALLOCATOR>& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
 
-    std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
     std::swap(d_freeList_p, other.d_freeList_p);
-    std::swap(d_chunkList_p, other.d_chunkList_p);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -518,9 +501,7 @@ void SimplePool<VALUE, ALLOCATOR>::quickSwapExchangeAllocators(
                                            SimplePool<VALUE, ALLOCATOR>& other)
 {
     bslalg::SwapUtil::swap(&this->allocator(), &other.allocator());
-    std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
     std::swap(d_freeList_p, other.d_freeList_p);
-    std::swap(d_chunkList_p, other.d_chunkList_p);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -528,15 +509,21 @@ void SimplePool<VALUE, ALLOCATOR>::reserve(size_type numBlocks)
 {
     BSLS_ASSERT(0 < numBlocks);
 
-    Block *begin = allocateChunk(
-                            numBlocks * static_cast<size_type>(sizeof(Block)));
-    Block *end   = begin + numBlocks - 1;
+    for (size_type i = 0; i < numBlocks; ++i) {
+        Block *block = allocateBlock();
+        block->d_next_p = d_freeList_p;
+        d_freeList_p    = block;
+    }
+}
 
-    for (Block *p = begin; p < end; ++p) {
-        p->d_next_p = p + 1;
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::release()
+{
+    while (d_freeList_p) {
+        Block *block = d_freeList_p;
+        d_freeList_p = d_freeList_p->d_next_p;
+        deallocateBlock(&allocator(), block);
     }
-    end->d_next_p = d_freeList_p;
-    d_freeList_p  = begin;
 }
 
 // ACCESSORS
@@ -548,19 +535,6 @@ SimplePool<VALUE, ALLOCATOR>::allocator() const
     return *this;
 }
 
-template <class VALUE, class ALLOCATOR>
-void SimplePool<VALUE, ALLOCATOR>::release()
-{
-    while (d_chunkList_p) {
-        typename AllocatorTraits::value_type *lastChunk =
-                      reinterpret_cast<typename AllocatorTraits::value_type *>(
-                                                                d_chunkList_p);
-        d_chunkList_p   = d_chunkList_p->d_next_p;
-        AllocatorTraits::deallocate(allocator(), lastChunk, 1);
-    }
-    d_freeList_p = 0;
-}
-
 }  // close namespace bslstl
 }  // close enterprise namespace
 
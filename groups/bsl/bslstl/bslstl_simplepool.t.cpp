@@ -13,6 +13,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_types.h>
 
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_stdtestallocator.h>
@@ -50,12 +51,16 @@ using namespace bslstl;
 // [ 7] void release();
 // [ 8] void swap(SimplePool<VALUE, ALLOCATOR>& other);
 //
+// CLASS METHODS
+// [10] static void deallocateBlock(AllocatorType *, void *);
+//
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 // [ 9] CONCERN: Standard allocator can be used
+// [10] CONCERN: Blocks can be deallocated to another pool
 // [ 3] TEST APPARATUS
 
 //=============================================================================
@@ -154,17 +159,6 @@ struct TestType3 {
 
 namespace {
 
-bool expectToAllocate(int n)
-    // Return 'true' if the container is expected to allocate memory on the
-    // specified 'n'th element, and 'false' otherwise.
-{
-    if (n > 32) {
-        return (0 == n % 32);                                         // RETURN
-    }
-    return (((n - 1) & n) == 0);  // Allocate when 'n' is a power of 2
-}
-
-
 class Stack {
     // A fixed sized stack for storing pointers allocated/deallocated by the
     // pool.
@@ -256,11 +250,18 @@ class TestDriver {
         // that it will be left with the specified 'numBlocks' number of free
         // blocks.
 
+    static void deallocateAll(Obj *result, Stack *blocks);
+        // Deallocate to the specified 'result' each memory block in the
+        // specified 'blocks', leaving 'blocks' empty.
+
   public:
     // TEST CASES
-    static void testCase10();
+    static void testCase11();
         // Test usage example.
 
+    static void testCase10();
+        // Test 'deallocateBlock' and deallocation to another pool.
+
     static void testCase9();
         // Test alignment concern.
 
@@ -328,13 +329,6 @@ void TestDriver<VALUE>::createFreeBlocks(Obj *result, int numBlocks)
         blocks.push(ptr);
     }
 
-    // Use up all the free blocks.
-
-    while (!expectToAllocate(blocks.size() + 1)) {
-        VALUE *ptr = result->allocate();
-        blocks.push(ptr);
-    }
-
     // Free up the necessary number of blocks.
 
     for (int i = 0; i < numBlocks; ++i) {
@@ -343,6 +337,149 @@ void TestDriver<VALUE>::createFreeBlocks(Obj *result, int numBlocks)
     }
 }
 
+template <class VALUE>
+void TestDriver<VALUE>::deallocateAll(Obj *result, Stack *blocks)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(blocks);
+
+    while (!blocks->empty()) {
+        result->deallocate(blocks->top());
+        blocks->pop();
+    }
+}
+
+template<class VALUE>
+void TestDriver<VALUE>::testCase10()
+{
+    // ------------------------------------------------------------------------
+    // CLASS METHOD 'deallocateBlock'
+    //
+    // Concerns:
+    //: 1 A block allocated from one pool can be deallocated to another pool
+    //:   using the same allocator, which then reuses it without allocating
+    //:   memory.
+    //:
+    //: 2 A block remains valid after the pool that allocated it is
+    //:   destroyed.
+    //:
+    //: 3 'deallocateBlock' returns a block directly to the allocator without
+    //:   going through a pool.
+    //:
+    //: 4 No memory is allocated from the default allocator.
+    //
+    // Plan:
+    //: 1 Using a table-based approach, create two pools using the same
+    //:   allocator, and invoke 'allocate' and 'deallocate' on each various
+    //:   number of times.
+    //:
+    //:   1 Destroy the second pool, and verify that only its free blocks are
+    //:     deallocated.  (C-2)
+    //:
+    //:   2 Deallocate the blocks used from the second pool to the first pool,
+    //:     then allocate as many blocks from the first pool, and verify that
+    //:     no memory is allocated and that the blocks are reused.  (C-1)
+    //:
+    //:   3 Return every block in use with 'deallocateBlock', and verify that
+    //:     each call deallocates one block from the allocator.  (C-3)
+    //:
+    //: 2 Verify no memory is allocated from the default allocator.  (C-4)
+    //
+    // Testing:
+    //   static void deallocateBlock(AllocatorType *, void *);
+    //   CONCERN: Blocks can be deallocated to another pool
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAllocX;
+        int d_numDeallocX;
+        int d_numAllocY;
+        int d_numDeallocY;
+    } DATA[] = {
+
+    //LINE  ALLOC X  DEALLOC X  ALLOC Y  DEALLOC Y
+    //----  -------  ---------  -------  ---------
+
+    { L_,         0,         0,       0,         0 },
+    { L_,         0,         0,       1,         0 },
+    { L_,         0,         0,       1,         1 },
+    { L_,         1,         0,       0,         0 },
+    { L_,         1,         1,       0,         0 },
+    { L_,         1,         0,       1,         0 },
+    { L_,         2,         1,       3,         1 },
+    { L_,         3,         3,       4,         2 },
+    { L_,         4,         2,       2,         2 },
+    { L_,        17,         5,      40,        20 },
+    { L_,        40,        40,      17,         0 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE      = DATA[ti].d_line;
+        const int ALLOCS_X  = DATA[ti].d_numAllocX;
+        const int DEALLOC_X = DATA[ti].d_numDeallocX;
+        const int ALLOCS_Y  = DATA[ti].d_numAllocY;
+        const int DEALLOC_Y = DATA[ti].d_numDeallocY;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Stack usedX;
+        Stack freeX;
+        Stack usedY;
+        Stack freeY;
+
+        Obj mX(&oa);
+        init(&mX, &usedX, &freeX, ALLOCS_X, DEALLOC_X);
+
+        {
+            Obj mY(&oa);
+            init(&mY, &usedY, &freeY, ALLOCS_Y, DEALLOC_Y);
+        }
+
+        ASSERTV(LINE, oa.numBlocksInUse(),
+                ALLOCS_X + ALLOCS_Y - DEALLOC_Y == oa.numBlocksInUse());
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        Stack reused;
+        while (!usedY.empty()) {
+            mX.deallocate(usedY.top());
+            reused.push(usedY.top());
+            usedY.pop();
+        }
+        while (!reused.empty()) {
+            VALUE *ptr = mX.allocate();
+            ASSERTV(LINE, reused.top() == ptr);
+            usedX.push(ptr);
+            reused.pop();
+        }
+
+        ASSERTV(LINE, oam.isTotalSame());
+        ASSERTV(LINE, oam.isInUseSame());
+
+        while (!usedX.empty()) {
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            Obj::deallocateBlock(&mX.allocator(), usedX.top());
+            usedX.pop();
+
+            ASSERTV(LINE, NUM_BLOCKS - 1 == oa.numBlocksInUse());
+        }
+
+        ASSERTV(LINE, oa.numBlocksInUse(),
+                DEALLOC_X == oa.numBlocksInUse());
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase9()
 {
@@ -370,14 +507,21 @@ void TestDriver<VALUE>::testCase9()
 
     ASSERTV(StlAlloc() == StlAlloc(mX.allocator()));
 
+    Stack blocks;
     for (int ti = 0; ti < 32; ++ti) {
         VALUE *ptr = mX.allocate();
+        blocks.push(ptr);
 
         memset(ptr, 0xFF, sizeof(VALUE));
         std::size_t address = reinterpret_cast<std::size_t>(ptr);
         ASSERTV(ti, 0 == address % bsls::AlignmentFromType<VALUE>::VALUE);
         ASSERTV(ti, 0 == address % bsls::AlignmentFromType<void *>::VALUE);
     }
+
+    while (!blocks.empty()) {
+        mX.deallocate(blocks.top());
+        blocks.pop();
+    }
 }
 
 template<class VALUE>
@@ -387,7 +531,7 @@ void TestDriver<VALUE>::testCase8()
     // MANIPULATOR 'swap'
     //
     // Concerns:
-    //: 1 'swap' exchange the free list and chunk list of the objects.
+    //: 1 'swap' exchange the free lists of the objects.
     //:
     //: 2 The common object allocator address held by both objects is
     //:   unchanged.
@@ -397,7 +541,8 @@ void TestDriver<VALUE>::testCase8()
     //: 4 Swapping an object with itself does not affect the value of the
     //:   object (alias-safety).
     //:
-    //: 5 Memory is deallocated on the destruction of the object.
+    //: 5 The free blocks are deallocated on the destruction of the object,
+    //:   and the blocks in use are not.
     //:
     //: 6 QoI: Asserted precondition violations are detected when enabled.
     //
@@ -415,7 +560,9 @@ void TestDriver<VALUE>::testCase8()
     //:     'allocate and checking the address of the allocated memory blocks.
     //:
     //:   5 Delete one of the objects and verify the memory of the other have
-    //:     not been deallocated.  (C-1, 5)
+    //:     not been deallocated, then deallocate every block in use to the
+    //:     remaining object and verify that all memory is deallocated on its
+    //:     destruction.  (C-1, 5)
     //:
     //:   6 Swap an object with itself and verify the object is unchanged.
     //:     (C-4)
@@ -472,7 +619,8 @@ void TestDriver<VALUE>::testCase8()
 
             Stack usedX;
             Stack freeX;
-            Obj mX(&oa);
+            Obj *pX = new (oa) Obj(&oa);
+            Obj& mX = *pX;
             const Obj& X = init(&mX, &usedX, &freeX, ALLOCS1, DEALLOCS1);
 
             Stack usedY;
@@ -507,19 +655,43 @@ void TestDriver<VALUE>::testCase8()
                     freeY.pop();
                     usedY.push(ptr);
                 }
+
+                Stack blocks(usedY);
+                while (!blocks.empty()) {
+                    memset(blocks.top(), 0, sizeof(VALUE));
+                    blocks.pop();
+                }
             }
 
-            // 'Y' is now destroyed, its blocks should be deallocated.  Verify
-            // Blocks in 'X' (which used to be in 'Y' before the swap) is not
-            // deallocated.
+            // 'Y' is now destroyed, its free blocks should be deallocated.
+            // Verify Blocks in 'X' (which used to be in 'Y' before the swap)
+            // is not deallocated.
 
             char SCRIBBLED_MEMORY[sizeof(VALUE)];
             memset(SCRIBBLED_MEMORY, 0xA5, sizeof(VALUE));
-            while (!usedY.empty()) {
-                char *ptr = (char *)usedY.top();
-                ASSERTV(0 != strncmp(ptr, SCRIBBLED_MEMORY, sizeof(VALUE)));
-                usedY.pop();
+            {
+                Stack blocks(usedY);
+                while (!blocks.empty()) {
+                    char *ptr = (char *)blocks.top();
+                    ASSERTV(0 != memcmp(ptr,
+                                        SCRIBBLED_MEMORY,
+                                        sizeof(VALUE)));
+                    blocks.pop();
+                }
             }
+
+            // The blocks allocated from 'Y' can be deallocated to 'X'.
+
+            ASSERTV(LINE1, LINE2,
+                    usedX.size() + usedY.size() == oa.numBlocksInUse() - 1);
+
+            deallocateAll(&mX, &usedX);
+            deallocateAll(&mX, &usedY);
+
+            oa.deleteObject(pX);
+
+            ASSERTV(LINE1, LINE2, oa.numBlocksInUse(),
+                    0 == oa.numBlocksInUse());
         }
 
         if (veryVerbose) printf("Test alias safety");
@@ -550,6 +722,8 @@ void TestDriver<VALUE>::testCase8()
                 freeX.pop();
                 usedX.push(ptr);
             }
+
+            deallocateAll(&mX, &usedX);
         }
     }
 
@@ -582,8 +756,8 @@ void TestDriver<VALUE>::testCase7()
     // MANIPULATOR 'release'
     //
     // Concerns:
-    //: 1 'release' deallocate all memory whether it was in the free list or
-    //:   used list.
+    //: 1 'release' deallocate all memory in the free list, and does not
+    //:   deallocate the blocks in use.
     //:
     //: 2 No temporary memory is allocated.
     //:
@@ -593,10 +767,14 @@ void TestDriver<VALUE>::testCase7()
     // Plan:
     //: 1 Invoke 'allocate' and 'deallocate' various number of time.
     //:
-    //:   1 Call 'release' and verify all memory is deallocated.  (C-1..2)
+    //:   1 Call 'release' and verify that only the blocks in use remain
+    //:     allocated.  (C-1..2)
     //:
     //:   2 Call 'allocate' and verify memory is allocated from the heap.
     //:     (C-3)
+    //:
+    //:   3 Deallocate every block in use, call 'release' again, and verify
+    //:     all memory is deallocated.  (C-1)
     //
     // Testing:
     //   void release();
@@ -651,13 +829,23 @@ void TestDriver<VALUE>::testCase7()
         mX.release();
 
         ASSERTV(LINE, oam.isTotalSame());
-        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        ASSERTV(LINE, oa.numBlocksInUse(),
+                ALLOCS - DEALLOCS == oa.numBlocksInUse());
 
-        mX.allocate();
+        usedX.push(mX.allocate());
 
         ASSERTV(LINE, oam.isTotalUp());
-        ASSERTV(LINE, 1 == oa.numBlocksInUse());
+        ASSERTV(LINE, oa.numBlocksInUse(),
+                ALLOCS - DEALLOCS + 1 == oa.numBlocksInUse());
+
+        deallocateAll(&mX, &usedX);
+
+        ASSERTV(LINE, oa.numBlocksInUse(),
+                ALLOCS - DEALLOCS + 1 == oa.numBlocksInUse());
 
+        mX.release();
+
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
     }
 
     // Verify no memory is allocated from the default allocator.
@@ -673,7 +861,8 @@ void TestDriver<VALUE>::testCase6()
     //
     // Concerns:
     //: 1 'reserve' allocate exactly the specified number of blocks such that
-    //:   subsequent 'allocate' does not get memory from the heap.
+    //:   subsequent 'allocate' does not get memory from the heap, using one
+    //:   allocation for each block.
     //:
     //: 2 Free blocks that was allocated before 'reserve' is not destroyed.
     //:
@@ -688,7 +877,8 @@ void TestDriver<VALUE>::testCase6()
     //:
     //:     1 Create 'j' memory blocks in the free list.
     //:
-    //:     2 Call 'reserve' for 'i' blocks.
+    //:     2 Call 'reserve' for 'i' blocks, and verify 'i' blocks are
+    //:       allocated.
     //:
     //:     3 Invoke 'allocate' 'i + j' times, and verify no memory is
     //:       allocated.
@@ -696,7 +886,8 @@ void TestDriver<VALUE>::testCase6()
     //:     4 Invoke 'allocate' again and verify memory is allocated from the
     //:       heap.  (C-1..3)
     //:
-    //: 2 Verify all memory is deallocated on destruction.  (C-4)
+    //: 2 Deallocate the blocks in use, and verify all memory is deallocated
+    //:   on destruction.  (C-4)
     //
     // ------------------------------------------------------------------------
 
@@ -720,20 +911,24 @@ void TestDriver<VALUE>::testCase6()
                     bslma::TestAllocatorMonitor oam(&oa);
                     mX.reserve(ti);
                     ASSERTV(oam.numBlocksInUseChange(),
-                            1 == oam.numBlocksInUseChange());
+                            ti == oam.numBlocksInUseChange());
                 }
 
+                Stack blocks;
+
                 if (veryVerbose) printf("Use up free blocks.\n");
                 {
                     bslma::TestAllocatorMonitor oam(&oa);
                     for (int tk = 0; tk < ti + tj; ++tk) {
-                        mX.allocate();
+                        blocks.push(mX.allocate());
                         ASSERTV(ti, tj, tk, oam.isTotalSame());
                         ASSERTV(ti, tj, tk, oam.isInUseSame());
                     }
-                    mX.allocate();
+                    blocks.push(mX.allocate());
                     ASSERTV(ti, tj, oam.isInUseUp());
                 }
+
+                deallocateAll(&mX, &blocks);
             }
 
             ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
@@ -772,8 +967,8 @@ void TestDriver<VALUE>::testCase5()
     //:
     //: 3 'allocate' retrieve the last block that was deallocated.
     //:
-    //: 4 'allocate' will retrieve memory from the heap if the free list is
-    //:   empty.
+    //: 4 'allocate' will retrieve memory from the heap if, and only if, the
+    //:   free list is empty.
     //:
     //: 5 'deallocate' does not allocate or release any memory.
     //:
@@ -791,7 +986,8 @@ void TestDriver<VALUE>::testCase5()
     //:   3 Verify no memory was allocated from the heap on 'deallocate'.
     //:     (C-5)
     //:
-    //:   4 Verify 'allocate' will get memory from the heap only when expected.
+    //:   4 Verify 'allocate' will get memory from the heap only when the free
+    //:     list is empty.  (C-4)
     //:
     //: 2 Verify that, in appropriate build modes, defensive checks are
     //:   triggered (using the 'BSLS_ASSERTTEST_*' macros).  (C-6)
@@ -845,14 +1041,8 @@ void TestDriver<VALUE>::testCase5()
                     freeBlocks.pop();
                 }
                 else {
-                    if (expectToAllocate(usedBlocks.size())) {
-                        ASSERTV(LINE, tj, oam.isTotalUp());
-                        ASSERTV(LINE, tj, oam.isInUseUp());
-                    }
-                    else {
-                        ASSERTV(LINE, tj, oam.isTotalSame());
-                        ASSERTV(LINE, tj, oam.isInUseSame());
-                    }
+                    ASSERTV(LINE, tj, oam.isTotalUp());
+                    ASSERTV(LINE, tj, oam.isInUseUp());
                 }
             }
             else {
@@ -867,6 +1057,8 @@ void TestDriver<VALUE>::testCase5()
                 ASSERTV(LINE, tj, oam.isInUseSame());
             }
         }
+        deallocateAll(&mX, &usedBlocks);
+
         ASSERTV(LINE, 0 == da.numBlocksTotal());
     }
 
@@ -999,13 +1191,14 @@ void TestDriver<VALUE>::testCase2()
     //:
     //: 3 There is no temporary allocation from any allocator.
     //:
-    //: 4 Every object releases any allocated memory at destruction.
+    //: 4 Every object releases its free memory at destruction.
     //:
     //: 5 Pointer returned by 'allocate' is aligned correctly.
     //:
-    //: 6 Allocation starts at one block, up to a maximum of 32 blocks.
+    //: 6 Every 'allocate' with an empty free list allocates one block from
+    //:   the allocator.
     //:
-    //: 7 Every allocation allocate contiguous blocks.
+    //: 7 Every block is a separate allocation.
     //:
     //: 8 Constructor allocates no memory.
     //:
@@ -1019,16 +1212,13 @@ void TestDriver<VALUE>::testCase2()
     //:   2 Call 'allocate' 96 times in the presence of exception, for each
     //:     time:
     //:
-    //:     1 Verify memory is only allocated from object allocator and only
-    //:       when expected.  (C-2..3, 6, 9)
+    //:     1 Verify memory is only allocated from object allocator, and
+    //:       that one block is allocated each time.  (C-2..3, 6..7, 9)
     //:
     //:     2 Verify address returned is aligned.  (C-5)
     //:
-    //:     3 If memory is not allocated, the address is the max of
-    //:       'sizeof(VALUE)' and 'sizeof(void *) larger than the previous
-    //:       address.  (C-7)
-    //:
-    //:   3 Delete the object and verify all memory is deallocated.  (C-4)
+    //:   3 Deallocate every block, delete the object, and verify all memory
+    //:     is deallocated.  (C-4)
     //
     // Testing:
     //   explicit SimplePool(const ALLOCATOR& allocator);
@@ -1085,7 +1275,7 @@ void TestDriver<VALUE>::testCase2()
         ASSERTV(CONFIG,  oa.numBlocksTotal(), 0 ==  oa.numBlocksTotal());
         ASSERTV(CONFIG, noa.numBlocksTotal(), 0 == noa.numBlocksTotal());
 
-        VALUE *prevPtr = 0;
+        Stack blocks;
         for (int ti = 0; ti < 96; ++ti) {
             bslma::TestAllocatorMonitor oam(&oa);
 
@@ -1094,24 +1284,16 @@ void TestDriver<VALUE>::testCase2()
                 ptr = mX.allocate();
             } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
 
-            if (expectToAllocate(ti + 1)) {
-                ASSERTV(oam.isInUseUp());
-            }
-            else {
-                ptrdiff_t offset = sizeof(VALUE);
-                offset += bsls::AlignmentUtil::calculateAlignmentOffset(
-                                       (void *) offset,
-                                       bsls::AlignmentFromType<void *>::VALUE);
-                ASSERTV(oam.isTotalSame());
-                ASSERTV(prevPtr, ptr, (char *)prevPtr + offset == (char*)ptr);
-            }
+            ASSERTV(ti, oam.isInUseUp());
+            ASSERTV(ti, oa.numBlocksInUse(), ti + 1 == oa.numBlocksInUse());
+
             memset(ptr, 0xff, sizeof(VALUE));
 
             std::size_t address = reinterpret_cast<std::size_t>(ptr);
             ASSERTV(ti, 0 == address % bsls::AlignmentFromType<VALUE>::VALUE);
             ASSERTV(ti, 0 == address % bsls::AlignmentFromType<void *>::VALUE);
 
-            prevPtr = ptr;
+            blocks.push(ptr);
         }
 
         // Verify no temporary memory is allocated from the object
@@ -1120,6 +1302,11 @@ void TestDriver<VALUE>::testCase2()
         ASSERTV(CONFIG, oa.numBlocksTotal(), oa.numBlocksInUse(),
                 oa.numBlocksTotal() == oa.numBlocksInUse());
 
+        while (!blocks.empty()) {
+            mX.deallocate(blocks.top());
+            blocks.pop();
+        }
+
         // Reclaim dynamically allocated object under test.
 
         fa.deleteObject(objPtr);
@@ -1179,6 +1366,9 @@ void TestDriver<VALUE>::testCase2()
             // Create an empty 'my_Stack' object.  Optionally specify a
             // 'basicAllocator' used to supply memory.  If 'basicAllocator' is
             // 0, the currently installed default allocator is used.
+//
+        ~my_Stack();
+            // Destroy this object.
 //
         // MANIPULATORS
         void push(int value);
@@ -1200,7 +1390,8 @@ void TestDriver<VALUE>::testCase2()
 //..
 // Now, we define the implementation of the stack.  Notice how
 // 'bslstl::SimplePool' is used to allocate memory in 'push' and deallocate
-// memory in 'pop':
+// memory in 'pop'.  Also notice that the destructor pops the remaining
+// elements, since the pool returns to the allocator only its free blocks:
 //..
     // CREATORS
     template <class ALLOCATOR>
@@ -1210,6 +1401,14 @@ void TestDriver<VALUE>::testCase2()
     , d_pool(allocator)
     {
     }
+//
+    template <class ALLOCATOR>
+    my_Stack<ALLOCATOR>::~my_Stack()
+    {
+        while (d_head_p) {
+            pop();
+        }
+    }
 //
     // MANIPULATORS
     template <class ALLOCATOR>
@@ -1266,7 +1465,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1312,6 +1511,13 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'deallocateBlock'
+        // --------------------------------------------------------------------
+
+          RUN_EACH_TYPE(TestDriver, testCase10, TEST_TYPES);
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // ALIGNMENT TEST
@@ -1377,19 +1583,25 @@ int main(int argc, char *argv[])
             ASSERTV(0 == da.numBlocksInUse());
             ASSERTV(1 == ta.numBlocksInUse());
 
-            value = (int *)x.allocate();
-            ASSERTV(0 != value);
+            int *values[4];
+            values[0] = (int *)x.allocate();
+            ASSERTV(0 != values[0]);
             ASSERTV(0 == da.numBlocksInUse());
             ASSERTV(1 == ta.numBlocksInUse());
-            value = (int *)x.allocate();
-            ASSERTV(0 == da.numBlocksInUse());
-            ASSERTV(2 == ta.numBlocksInUse());
-            value = (int *)x.allocate();
+            values[1] = (int *)x.allocate();
             ASSERTV(0 == da.numBlocksInUse());
             ASSERTV(2 == ta.numBlocksInUse());
-            value = (int *)x.allocate();
+            values[2] = (int *)x.allocate();
             ASSERTV(0 == da.numBlocksInUse());
             ASSERTV(3 == ta.numBlocksInUse());
+            values[3] = (int *)x.allocate();
+            ASSERTV(0 == da.numBlocksInUse());
+            ASSERTV(4 == ta.numBlocksInUse());
+
+            for (int i = 0; i < 4; ++i) {
+                x.deallocate(values[i]);
+            }
+            ASSERTV(4 == ta.numBlocksInUse());
         }
        } break;
       default: {
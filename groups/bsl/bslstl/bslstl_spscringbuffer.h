@@ -0,0 +1,560 @@
+// bslstl_spscringbuffer.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SPSCRINGBUFFER
+#define INCLUDED_BSLSTL_SPSCRINGBUFFER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a bounded lock-free single-producer/single-consumer queue.
+//
+//@CLASSES:
+//  bslstl::SpscRingBuffer: bounded lock-free SPSC ring-buffer queue
+//
+//@SEE_ALSO: bslstl_mpmcringbuffer, bslstl_deque
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::SpscRingBuffer', implementing a bounded, first-in first-out queue
+// that hands values of the (template parameter) 'TYPE' from exactly one
+// producer thread to exactly one consumer thread without locking.  The queue
+// stores its elements in a fixed array of slots, obtained at construction
+// from the 'bslma::Allocator' supplied to the queue, and never allocates
+// again.
+//
+// The producer calls 'tryPushBack' and the consumer calls 'tryPopFront'; both
+// return immediately, with a non-zero status if the queue was full or empty,
+// respectively.  Batch variants of both operations transfer several values
+// while publishing the updated index only once, which reduces the number of
+// cache-line transfers between the two threads.  The behavior is undefined if
+// more than one thread pushes, or more than one thread pops, at a time.  For
+// multiple producers or consumers, see 'bslstl_mpmcringbuffer'.
+//
+///Implementation Notes
+///--------------------
+// The queue maintains two monotonically increasing 64-bit indices: the push
+// index, written only by the producer, and the pop index, written only by the
+// consumer.  A value is published by constructing it in its slot and then
+// storing the incremented push index with release semantics; the consumer
+// loads the push index with acquire semantics before reading the slot, and
+// symmetrically for the pop index.  Each side also keeps a private copy of
+// the other side's index, and reloads the shared index only when its copy
+// indicates that the queue is full (or empty).  Each index, together with the
+// copy of the other index owned by the same thread, is kept on its own cache
+// line, so that the producer and the consumer do not contend for the same
+// cache line except to exchange index values.
+//
+// The capacity is rounded up to a power of two so that a slot is selected by
+// masking the index.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handing Off Work Items Between Two Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a reader thread parses requests and hands them to a single
+// worker thread.  First, we create a queue with room for 1024 requests:
+//..
+//  bslma::TestAllocator        allocator;
+//  bslstl::SpscRingBuffer<int> queue(1024, &allocator);
+//  assert(1024 == queue.capacity());
+//  assert(   1 == allocator.numBlocksInUse());
+//..
+// Then, the reader thread pushes requests, retrying while the queue is full:
+//..
+//  for (int request = 0; request < 3; ++request) {
+//      while (0 != queue.tryPushBack(request)) {
+//          // The queue is full; back off (e.g., yield) and retry.
+//      }
+//  }
+//..
+// Finally, the worker thread pops the requests in order:
+//..
+//  int request;
+//  for (int expected = 0; expected < 3; ++expected) {
+//      while (0 != queue.tryPopFront(&request)) {
+//          // The queue is empty; back off and retry.
+//      }
+//      assert(expected == request);
+//  }
+//  assert(0 != queue.tryPopFront(&request));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CACHELINE
+#include <bsls_cacheline.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                            // ====================
+                            // class SpscRingBuffer
+                            // ====================
+
+template <class TYPE>
+class SpscRingBuffer {
+    // This class template implements a bounded, lock-free, first-in first-out
+    // queue of 'TYPE' values for use by exactly one producer thread and
+    // exactly one consumer thread.  Manipulators documented as "producer" may
+    // be called only by the producer thread, and those documented as
+    // "consumer" only by the consumer thread; accessors may be called by any
+    // thread.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64                                     Int64;
+    typedef bsls::AlignedBuffer<sizeof(TYPE),
+                                bsls::AlignmentFromType<TYPE>::VALUE> Slot;
+
+    // DATA
+    char              d_producerPad[bsls::CacheLine::BSLS_SIZE];
+                                          // separates the producer's data
+                                          // from preceding memory
+
+    bsls::AtomicInt64 d_pushIndex;        // number of values ever pushed
+
+    Int64             d_cachedPopIndex;   // producer's copy of 'd_popIndex'
+
+    char              d_consumerPad[bsls::CacheLine::BSLS_SIZE];
+                                          // separates the producer's data
+                                          // from the consumer's
+
+    bsls::AtomicInt64 d_popIndex;         // number of values ever popped
+
+    Int64             d_cachedPushIndex;  // consumer's copy of 'd_pushIndex'
+
+    char              d_sharedPad[bsls::CacheLine::BSLS_SIZE];
+                                          // separates the consumer's data
+                                          // from the read-only data
+
+    Slot             *d_slots_p;          // array of 'd_mask + 1' slots
+                                          // (owned)
+
+    Int64             d_mask;             // capacity minus one
+
+    bslma::Allocator *d_allocator_p;      // memory allocator (held, not
+                                          // owned)
+
+    // NOT IMPLEMENTED
+    SpscRingBuffer(const SpscRingBuffer&);
+    SpscRingBuffer& operator=(const SpscRingBuffer&);
+
+    // PRIVATE ACCESSORS
+    TYPE *slotAddress(Int64 index) const;
+        // Return the address of the slot holding the value at the specified
+        // 'index'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SpscRingBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    SpscRingBuffer(std::size_t capacity, bslma::Allocator *basicAllocator = 0);
+        // Create an empty queue able to hold at least the specified
+        // 'capacity' values.  Optionally specify a 'basicAllocator' used to
+        // supply memory for the slot array and for the values held by this
+        // queue.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < capacity'.  Note that the capacity is rounded up to a power
+        // of two.
+
+    ~SpscRingBuffer();
+        // Destroy this queue and the values it holds.  The behavior is
+        // undefined unless no other thread is accessing this queue.
+
+    // MANIPULATORS
+    int tryPushBack(const TYPE& value);
+        // Append a copy of the specified 'value' to the back of this queue if
+        // it is not full.  Return 0 on success, and a non-zero value, with no
+        // effect, if this queue is full.  Producer only.  If an exception is
+        // thrown, this queue is unchanged.
+
+    std::size_t tryPushBack(const TYPE *values, std::size_t numValues);
+        // Append copies of as many of the specified 'numValues' leading
+        // elements of the specified 'values' array to the back of this queue
+        // as it has room for, in order, and return the number of values
+        // appended.  Producer only.  The appended values become visible to
+        // the consumer at once.  If an exception is thrown, the values copied
+        // before the exception are appended.
+
+    int tryPopFront(TYPE *value);
+        // Assign the value at the front of this queue to the specified
+        // 'value' and remove it from this queue, if this queue is not empty.
+        // Return 0 on success, and a non-zero value, with no effect, if this
+        // queue is empty.  Consumer only.  If an exception is thrown by the
+        // assignment, this queue is unchanged.
+
+    std::size_t tryPopFront(TYPE *values, std::size_t maxValues);
+        // Assign up to the specified 'maxValues' values from the front of
+        // this queue, in order, to the leading elements of the specified
+        // 'values' array, remove them from this queue, and return the number
+        // of values removed.  Consumer only.  If an exception is thrown, the
+        // values assigned before the exception are removed.
+
+    // ACCESSORS
+    std::size_t capacity() const;
+        // Return the maximum number of values this queue can hold.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue held no values at some point during
+        // this call, and 'false' otherwise.
+
+    bool isFull() const;
+        // Return 'true' if this queue held 'capacity()' values at some point
+        // during this call, and 'false' otherwise.
+
+    std::size_t numElements() const;
+        // Return a snapshot of the number of values held by this queue.  Note
+        // that the result may be out of date by the time it is returned if
+        // other threads are using this queue.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this queue to supply memory.
+};
+
+                   // ===================================
+                   // class SpscRingBuffer_PublishProctor
+                   // ===================================
+
+class SpscRingBuffer_PublishProctor {
+    // PRIVATE CLASS.  For use only by 'SpscRingBuffer'.  This class provides
+    // a proctor that, upon destruction, stores a running index into an
+    // atomic index with release semantics, so that a batch operation
+    // publishes the elements it processed even if an exception is thrown.
+
+    // DATA
+    bsls::AtomicInt64  *d_index_p;  // index to publish to
+    bsls::Types::Int64  d_value;    // running index value
+
+  private:
+    // NOT IMPLEMENTED
+    SpscRingBuffer_PublishProctor(const SpscRingBuffer_PublishProctor&);
+    SpscRingBuffer_PublishProctor& operator=(
+                                         const SpscRingBuffer_PublishProctor&);
+
+  public:
+    // CREATORS
+    SpscRingBuffer_PublishProctor(bsls::AtomicInt64  *index,
+                                  bsls::Types::Int64  value);
+        // Create a proctor that will store into the specified 'index' the
+        // running value, initially the specified 'value'.
+
+    ~SpscRingBuffer_PublishProctor();
+        // Store the running value into the index supplied at construction
+        // with release semantics, and destroy this proctor.
+
+    // MANIPULATORS
+    void increment();
+        // Increment the running value.
+
+    // ACCESSORS
+    bsls::Types::Int64 value() const;
+        // Return the running value.
+};
+
+// ============================================================================
+//                      TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class SpscRingBuffer
+                            // --------------------
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+TYPE *SpscRingBuffer<TYPE>::slotAddress(Int64 index) const
+{
+    return reinterpret_cast<TYPE *>(d_slots_p[index & d_mask].buffer());
+}
+
+// CREATORS
+template <class TYPE>
+SpscRingBuffer<TYPE>::SpscRingBuffer(std::size_t       capacity,
+                                     bslma::Allocator *basicAllocator)
+: d_pushIndex(0)
+, d_cachedPopIndex(0)
+, d_popIndex(0)
+, d_cachedPushIndex(0)
+, d_slots_p(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+
+    Int64 numSlots = 1;
+    while (numSlots < static_cast<Int64>(capacity)) {
+        numSlots *= 2;
+    }
+    d_mask    = numSlots - 1;
+    d_slots_p = static_cast<Slot *>(d_allocator_p->allocate(
+                                  static_cast<std::size_t>(numSlots) *
+                                                                sizeof(Slot)));
+}
+
+template <class TYPE>
+SpscRingBuffer<TYPE>::~SpscRingBuffer()
+{
+    const Int64 pushIndex = d_pushIndex.loadAcquire();
+    for (Int64 i = d_popIndex.loadRelaxed(); i != pushIndex; ++i) {
+        bslalg::ScalarDestructionPrimitives::destroy(slotAddress(i));
+    }
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+int SpscRingBuffer<TYPE>::tryPushBack(const TYPE& value)
+{
+    const Int64 pushIndex = d_pushIndex.loadRelaxed();
+
+    if (pushIndex - d_cachedPopIndex > d_mask) {
+        d_cachedPopIndex = d_popIndex.loadAcquire();
+        if (pushIndex - d_cachedPopIndex > d_mask) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    bslalg::ScalarPrimitives::copyConstruct(slotAddress(pushIndex),
+                                            value,
+                                            d_allocator_p);
+    d_pushIndex.storeRelease(pushIndex + 1);
+    return 0;
+}
+
+template <class TYPE>
+std::size_t SpscRingBuffer<TYPE>::tryPushBack(const TYPE  *values,
+                                              std::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    const Int64 pushIndex = d_pushIndex.loadRelaxed();
+    const Int64 capacity  = d_mask + 1;
+
+    Int64 room = capacity - (pushIndex - d_cachedPopIndex);
+    if (room < static_cast<Int64>(numValues)) {
+        d_cachedPopIndex = d_popIndex.loadAcquire();
+        room = capacity - (pushIndex - d_cachedPopIndex);
+    }
+    const Int64 count = room < static_cast<Int64>(numValues)
+                      ? room
+                      : static_cast<Int64>(numValues);
+
+    SpscRingBuffer_PublishProctor proctor(&d_pushIndex, pushIndex);
+    for (Int64 i = 0; i < count; ++i) {
+        bslalg::ScalarPrimitives::copyConstruct(slotAddress(pushIndex + i),
+                                                values[i],
+                                                d_allocator_p);
+        proctor.increment();
+    }
+    return static_cast<std::size_t>(count);
+}
+
+template <class TYPE>
+int SpscRingBuffer<TYPE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    const Int64 popIndex = d_popIndex.loadRelaxed();
+
+    if (popIndex == d_cachedPushIndex) {
+        d_cachedPushIndex = d_pushIndex.loadAcquire();
+        if (popIndex == d_cachedPushIndex) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    TYPE *slot = slotAddress(popIndex);
+    *value = *slot;
+    bslalg::ScalarDestructionPrimitives::destroy(slot);
+    d_popIndex.storeRelease(popIndex + 1);
+    return 0;
+}
+
+template <class TYPE>
+std::size_t SpscRingBuffer<TYPE>::tryPopFront(TYPE        *values,
+                                              std::size_t  maxValues)
+{
+    BSLS_ASSERT(values || 0 == maxValues);
+
+    const Int64 popIndex = d_popIndex.loadRelaxed();
+
+    Int64 available = d_cachedPushIndex - popIndex;
+    if (available < static_cast<Int64>(maxValues)) {
+        d_cachedPushIndex = d_pushIndex.loadAcquire();
+        available = d_cachedPushIndex - popIndex;
+    }
+    const Int64 count = available < static_cast<Int64>(maxValues)
+                      ? available
+                      : static_cast<Int64>(maxValues);
+
+    SpscRingBuffer_PublishProctor proctor(&d_popIndex, popIndex);
+    for (Int64 i = 0; i < count; ++i) {
+        TYPE *slot = slotAddress(popIndex + i);
+        values[i] = *slot;
+        bslalg::ScalarDestructionPrimitives::destroy(slot);
+        proctor.increment();
+    }
+    return static_cast<std::size_t>(count);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+std::size_t SpscRingBuffer<TYPE>::capacity() const
+{
+    return static_cast<std::size_t>(d_mask + 1);
+}
+
+template <class TYPE>
+inline
+bool SpscRingBuffer<TYPE>::isEmpty() const
+{
+    return 0 == numElements();
+}
+
+template <class TYPE>
+inline
+bool SpscRingBuffer<TYPE>::isFull() const
+{
+    return capacity() == numElements();
+}
+
+template <class TYPE>
+inline
+std::size_t SpscRingBuffer<TYPE>::numElements() const
+{
+    // Load the pop index first: it never exceeds the push index loaded after
+    // it.
+
+    const Int64 popIndex  = d_popIndex.loadAcquire();
+    const Int64 pushIndex = d_pushIndex.loadAcquire();
+    return static_cast<std::size_t>(pushIndex - popIndex);
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *SpscRingBuffer<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+                   // -----------------------------------
+                   // class SpscRingBuffer_PublishProctor
+                   // -----------------------------------
+
+// CREATORS
+inline
+SpscRingBuffer_PublishProctor::SpscRingBuffer_PublishProctor(
+                                              bsls::AtomicInt64  *index,
+                                              bsls::Types::Int64  value)
+: d_index_p(index)
+, d_value(value)
+{
+}
+
+inline
+SpscRingBuffer_PublishProctor::~SpscRingBuffer_PublishProctor()
+{
+    d_index_p->storeRelease(d_value);
+}
+
+// MANIPULATORS
+inline
+void SpscRingBuffer_PublishProctor::increment()
+{
+    ++d_value;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 SpscRingBuffer_PublishProctor::value() const
+{
+    return d_value;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
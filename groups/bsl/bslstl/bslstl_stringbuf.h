@@ -77,6 +77,28 @@ BSLS_IDENT("$Id: $")
 // default allocator installed at the time of the stream buffer's construction
 // (see 'bslma_default').
 //
+///Accessing the Buffer Without Copying
+///------------------------------------
+// The standard 'str' accessor returns the buffered sequence of characters by
+// value, so each call copies the sequence into a newly allocated string.  In
+// addition to the standard interface, 'bsl::basic_stringbuf' provides three
+// methods for clients that format output into a buffer and then pass it on:
+//
+//: 'view': returns a 'bslstl::StringRefImp' referring to the buffered
+//:   sequence of characters in place.  The reference remains valid until the
+//:   next operation that modifies this buffer.
+//:
+//: 'reserve': ensures that the internal buffer can hold a specified number of
+//:   characters, so that writing a sequence of known (or typical) length
+//:   does not grow the buffer repeatedly.
+//:
+//: 'extract': moves the buffered sequence of characters into a string
+//:   supplied by the caller, leaving this buffer empty and ready for reuse.
+//:   The memory previously held by the supplied string becomes the new
+//:   internal buffer, so a string that is extracted into, consumed, and
+//:   extracted into again lets both objects reuse their memory (provided
+//:   that they use the same allocator).
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -159,6 +181,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_string.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_TYPETRAITS
 #include <bslalg_typetraits.h>
 #endif
@@ -220,6 +246,7 @@ class basic_stringbuf
     // PRIVATE TYPES
     typedef native_std::basic_streambuf<CHAR_TYPE, CHAR_TRAITS>  BaseType;
     typedef bsl::basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> StringType;
+    typedef BloombergLP::bslstl::StringRefImp<CHAR_TYPE>         StringRefType;
 
   public:
     // TYPES
@@ -464,9 +491,32 @@ class basic_stringbuf
         // the updated buffer, and update the current output position to be the
         // end of the updated buffer.
 
+    void extract(StringType *result);
+        // Load into the specified 'result' the currently buffered sequence of
+        // characters, and reset this buffer to the empty sequence, as if by
+        // 'str(StringType())'.  The memory held by 'result' on entry becomes
+        // the internal buffer of this object if 'result' uses the same
+        // allocator as this object.  Note that, unlike 'str()', this method
+        // does not copy the buffered characters if 'result' uses the same
+        // allocator as this object.
+
+    void reserve(native_std::size_t numCharacters);
+        // Ensure that the internal buffer can hold at least the specified
+        // 'numCharacters' characters without reallocating.  The buffered
+        // sequence of characters and the current input and output positions
+        // are not changed.  Note that this method has no effect if the buffer
+        // can already hold 'numCharacters' characters.
+
     // ACCESSORS
     StringType str() const;
         // Return the currently buffered sequence of characters.
+
+    StringRefType view() const;
+        // Return a reference to the currently buffered sequence of characters.
+        // The returned reference remains valid until the next operation that
+        // modifies this object (including writing to a stream using this
+        // buffer).  Note that, unlike 'str', this method does not copy the
+        // buffered characters.
 };
 
 // STANDARD TYPEDEFS
@@ -1026,6 +1076,45 @@ void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::str(
     updateStreamPositions(0, d_mode & ios_base::ate ? d_lastWrittenChar : 0);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::extract(
+                                                            StringType *result)
+{
+    BSLS_ASSERT(result);
+
+    // Truncate the buffer to the written characters and exchange it with
+    // 'result', whose (cleared) storage then backs this buffer.  The output
+    // pointers refer to the previous storage, so they are reset before
+    // 'updateStreamPositions' computes the size of the (empty) sequence.
+
+    d_str.resize(streamSize());
+    d_str.swap(*result);
+    d_str.clear();
+    d_lastWrittenChar = 0;
+    this->setp(0, 0);
+    updateStreamPositions();
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::reserve(
+                                              native_std::size_t numCharacters)
+{
+    if (numCharacters <= d_str.capacity()) {
+        return;                                                       // RETURN
+    }
+
+    // Record the positions as offsets, since the pointers are invalidated
+    // when the string reallocates.
+
+    const off_type inputOffset  = this->gptr() - this->eback();
+    const off_type outputOffset = this->pptr() - this->pbase();
+
+    d_lastWrittenChar = streamSize();
+    this->setp(0, 0);
+    d_str.reserve(numCharacters);
+    updateStreamPositions(inputOffset, outputOffset);
+}
+
 // ACCESSORS
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 inline
@@ -1035,6 +1124,15 @@ typename basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringType
     return StringType(d_str.begin(), d_str.begin() + streamSize());
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+typename basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringRefType
+    basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::view() const
+{
+    const CHAR_TYPE *begin = d_str.data();
+    return StringRefType(begin, begin + streamSize());
+}
+
 }  // close namespace bsl
 
 // ============================================================================
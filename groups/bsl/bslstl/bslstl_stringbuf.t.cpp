@@ -6,6 +6,7 @@
 #include <bslma_default.h>
 #include <bslma_testallocator.h>
 #include <bslma_defaultallocatorguard.h>
+#include <bsls_asserttest.h>
 
 #include <iostream>
 #include <istream>
@@ -43,10 +44,13 @@
 // [ 8] pbackfail(int)
 // [ 9] xsputn(const char *, streamsize)
 // [10] overflow(int)
+// [13] void extract(StringType *result)
+// [13] void reserve(size_t numCharacters)
+// [13] StringRefType view() const
 //-----------------------------------------------------------------------------
 // [11] OUTPUT TO STRINGBUF VIA PUBLIC INTERFACE
 // [12] INPUT FROM STRINGBUF VIA PUBLIC INTERFACE
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 1] BREATHING TEST
 
 //==========================================================================
@@ -735,7 +739,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -760,6 +764,233 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'view', 'reserve', AND 'extract'
+        //
+        // Concerns:
+        //: 1 'view' refers to exactly the buffered sequence of characters,
+        //:   including characters overwritten after repositioning the output,
+        //:   and does not allocate.
+        //:
+        //: 2 'reserve' leaves the buffered sequence and the input and output
+        //:   positions unchanged, and writing up to the reserved number of
+        //:   characters afterwards does not allocate.
+        //:
+        //: 3 'reserve' has no effect if the buffer is already large enough.
+        //:
+        //: 4 'extract' loads the buffered sequence into the result, replacing
+        //:   its previous value, and leaves the buffer empty with the input
+        //:   and output positions at its beginning.
+        //:
+        //: 5 'extract' does not allocate if the result uses the same
+        //:   allocator, and the memory of the result is reused by the buffer.
+        //:
+        //: 6 'extract' produces the correct result if the result uses a
+        //:   different allocator.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write to a 'stringbuf' and compare 'view' to 'str' after each
+        //:   write, including after seeking back and overwriting.  (C-1)
+        //:
+        //: 2 Reserve space in 'stringbuf' objects opened in each mode, and
+        //:   verify the content, the positions, and the number of subsequent
+        //:   allocations.  (C-2..3)
+        //:
+        //: 3 Extract from a 'stringbuf' into strings using the same and a
+        //:   different allocator, and verify the results, the state of the
+        //:   buffer, and the number of allocations.  (C-4..6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null result address.  (C-7)
+        //
+        // Testing:
+        //   void extract(StringType *result)
+        //   void reserve(size_t numCharacters)
+        //   StringRefType view() const
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'view', 'reserve', AND 'extract'"
+                            "\n========================================\n");
+
+        typedef bsl::stringbuf Obj;
+
+        const bsl::string LONG(200, 'x');
+
+        if (verbose) printf("\tTesting 'view'.\n");
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            ASSERT(X.view().isEmpty());
+
+            mX.sputn("hello world", 11);
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                             objectAllocator.numBlocksTotal();
+
+            ASSERT(X.str()  == X.view());
+            ASSERT("hello world" == X.view());
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksTotal());
+
+            mX.pubseekpos(6, std::ios_base::out);
+            mX.sputn("W", 1);
+            ASSERT("hello World" == X.view());
+
+            mX.pubseekpos(0, std::ios_base::out);
+            mX.sputn("J", 1);
+            ASSERT("Jello World" == X.view());
+            ASSERT(X.str() == X.view());
+
+            mX.pubseekoff(0, std::ios_base::end, std::ios_base::out);
+            mX.sputn(LONG.data(), LONG.size());
+            ASSERT("Jello World" + LONG == X.view());
+
+            Obj mY(bsl::string("input"), std::ios_base::in,
+                   &objectAllocator);
+            ASSERT("input" == mY.view());
+        }
+
+        if (verbose) printf("\tTesting 'reserve'.\n");
+        {
+            static const std::ios_base::openmode MODES[] = {
+                std::ios_base::out,
+                std::ios_base::in,
+                std::ios_base::in | std::ios_base::out
+            };
+            const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+            for (int i = 0; i < NUM_MODES; ++i) {
+                const std::ios_base::openmode MODE = MODES[i];
+                const bool IN  = 0 != (MODE & std::ios_base::in);
+                const bool OUT = 0 != (MODE & std::ios_base::out);
+
+                Obj mX(bsl::string("abcdef"), MODE, &objectAllocator);
+                const Obj& X = mX;
+
+                if (IN) {
+                    ASSERT('a' == mX.sbumpc());
+                    ASSERT('b' == mX.sbumpc());
+                }
+                if (OUT) {
+                    mX.pubseekpos(3, std::ios_base::out);
+                }
+
+                mX.reserve(1000);
+
+                LOOP_ASSERT(i, "abcdef" == X.view());
+                if (IN) {
+                    LOOP_ASSERT(i, 'c' == mX.sgetc());
+                    LOOP_ASSERT(i, 4   == mX.in_avail());
+                }
+
+                if (OUT) {
+                    const bsls::Types::Int64 NUM_BLOCKS =
+                                             objectAllocator.numBlocksTotal();
+
+                    mX.sputn("DE", 2);
+                    LOOP_ASSERT(i, "abcDEf" == X.view());
+
+                    for (int j = 0; j < 900; ++j) {
+                        mX.sputc('y');
+                    }
+                    LOOP_ASSERT(i, 905 == X.view().length());
+                    LOOP_ASSERT(i, NUM_BLOCKS ==
+                                             objectAllocator.numBlocksTotal());
+                }
+
+                // Reserving less than the current capacity has no effect.
+
+                const bsls::Types::Int64 NUM_BLOCKS =
+                                             objectAllocator.numBlocksTotal();
+                const bsl::string VALUE = X.str();
+
+                mX.reserve(10);
+                mX.reserve(0);
+
+                LOOP_ASSERT(i, VALUE == X.view());
+                LOOP_ASSERT(i, NUM_BLOCKS ==
+                                             objectAllocator.numBlocksTotal());
+            }
+        }
+
+        if (verbose) printf("\tTesting 'extract'.\n");
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            bsl::string result("previous value", &objectAllocator);
+
+            mX.sputn(LONG.data(), LONG.size());
+            mX.extract(&result);
+
+            ASSERT(LONG == result);
+            ASSERT(X.view().isEmpty());
+            ASSERT(X.str().empty());
+            ASSERT(0 == mX.in_avail());
+
+            // The buffer is usable after 'extract'.
+
+            mX.sputn("abc", 3);
+            ASSERT("abc" == X.view());
+            ASSERT('a' == mX.sbumpc());
+
+            mX.extract(&result);
+            ASSERT("abc" == result);
+            ASSERT(X.view().isEmpty());
+
+            // Once both 'mX' and 'result' hold sufficiently large buffers,
+            // writing and extracting does not allocate.
+
+            for (int i = 0; i < 2; ++i) {
+                mX.sputn(LONG.data(), LONG.size());
+                mX.sputc('x');
+                mX.extract(&result);
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                             objectAllocator.numBlocksTotal();
+
+            for (int i = 0; i < 10; ++i) {
+                mX.sputn(LONG.data(), LONG.size());
+                mX.sputc(char('0' + i));
+                mX.extract(&result);
+
+                LOOP_ASSERT(i, LONG.size() + 1 == result.size());
+                LOOP_ASSERT(i, '0' + i == result[LONG.size()]);
+            }
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksTotal());
+
+            // A result having a different allocator.
+
+            bslma::TestAllocator otherAllocator("other", veryVeryVeryVerbose);
+            {
+                bsl::string other(LONG, &otherAllocator);
+
+                mX.sputn("different allocator", 19);
+                mX.extract(&other);
+
+                ASSERT("different allocator" == other);
+                ASSERT(&otherAllocator == other.get_allocator().mechanism());
+                ASSERT(X.view().isEmpty());
+
+                mX.sputn("abc", 3);
+                ASSERT("abc" == X.view());
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj         mX(&objectAllocator);
+            bsl::string result(&objectAllocator);
+
+            ASSERT_PASS(mX.extract(&result));
+            ASSERT_FAIL(mX.extract(0));
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING INPUT FROM STRINGBUF VIA PUBLIC INTERFACE
@@ -156,6 +156,7 @@ class basic_stringstream
     typedef StringBufContainer<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>
                                                                  BaseType;
     typedef bsl::basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> StringType;
+    typedef BloombergLP::bslstl::StringRefImp<CHAR_TYPE>         StringRefType;
     typedef native_std::basic_iostream<CHAR_TYPE, CHAR_TRAITS>   BaseStream;
     typedef native_std::ios_base                                 ios_base;
 
@@ -210,6 +211,21 @@ class basic_stringstream
         // Reset the internally buffered sequence of characters maintained by
         // this stream object to the specified 'value'.
 
+    void extract(StringType *result);
+        // Load into the specified 'result' the sequence of characters
+        // buffered by this stream object, and reset the buffered sequence to
+        // be empty, as if by 'str(StringType())'.  The memory held by
+        // 'result' on entry is reused as the internal buffer of this object
+        // if 'result' uses the same allocator as this object.  Note that,
+        // unlike 'str()', this method does not copy the buffered characters
+        // if 'result' uses the same allocator as this object.
+
+    void reserve(native_std::size_t numCharacters);
+        // Ensure that the internal buffer of this stream object can hold at
+        // least the specified 'numCharacters' characters without
+        // reallocating.  The buffered sequence of characters and the stream
+        // positions are not changed.
+
     // ACCESSORS
     StringType str() const;
         // Return the sequence of characters referred to by this stream object.
@@ -218,6 +234,12 @@ class basic_stringstream
         // Return an address providing modifiable access to the
         // 'basic_stringbuf' object that is internally used by this stream
         // object to buffer unformatted characters.
+
+    StringRefType view() const;
+        // Return a reference to the sequence of characters buffered by this
+        // stream object.  The returned reference remains valid until the next
+        // operation that modifies this object.  Note that, unlike 'str', this
+        // method does not copy the buffered characters.
 };
 
 // STANDARD TYPEDEFS
@@ -301,6 +323,22 @@ void basic_stringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::str(
     this->rdbuf()->str(value);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+void basic_stringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::extract(
+                                                            StringType *result)
+{
+    this->rdbuf()->extract(result);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+void basic_stringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::reserve(
+                                              native_std::size_t numCharacters)
+{
+    this->rdbuf()->reserve(numCharacters);
+}
+
 // ACCESSORS
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 inline
@@ -318,6 +356,14 @@ basic_stringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::rdbuf() const
     return this->BaseType::rdbuf();
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+typename basic_stringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringRefType
+basic_stringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::view() const
+{
+    return this->rdbuf()->view();
+}
+
 }  // close namespace bsl
 
 #endif
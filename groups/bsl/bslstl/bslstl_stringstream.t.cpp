@@ -49,10 +49,13 @@
 //
 // MANIPULATORS
 // [ 3] void str(const StringType& value);
+// [10] void extract(StringType *result);
+// [10] void reserve(size_t numCharacters);
 //
 // ACCESSORS
 // [ 3] StringType str() const;
 // [ 2] StreamBufType *rdbuf() const;
+// [10] StringRefType view() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] USAGE EXAMPLE
@@ -1208,6 +1211,81 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'view', 'reserve', AND 'extract'
+        //
+        // Concerns:
+        //: 1 The methods forward to the same-named methods of 'rdbuf'.
+        //:
+        //: 2 'reserve' preserves both the input and the output positions.
+        //:
+        //: 3 'extract' moves out the whole sequence regardless of the input
+        //:   position, and resets both positions.
+        //
+        // Plan:
+        //: 1 Write to a 'stringstream', read part of the sequence, reserve
+        //:   space, and verify that reading and writing continue from the
+        //:   previous positions.  Then extract the sequence and verify the
+        //:   result and the state of the stream.  (C-1..3)
+        //
+        // Testing:
+        //   void extract(StringType *result);
+        //   void reserve(size_t numCharacters);
+        //   StringRefType view() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'view', 'reserve', AND 'extract'"
+                            "\n========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        mX << "abc def";
+        ASSERT("abc def" == X.view());
+        ASSERT(X.rdbuf()->view() == X.view());
+
+        bsl::string word;
+        mX >> word;
+        ASSERT("abc" == word);
+
+        mX.reserve(500);
+
+        bsl::string longString;
+        loadString(&longString, LENGTH_OF_SUFFICIENTLY_LONG_STRING);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        mX << ' ' << longString;
+        ASSERT(oam.isTotalSame());
+        ASSERT("abc def " + longString == X.view());
+
+        mX >> word;
+        ASSERT("def" == word);
+        ASSERT(mX.tellg() == std::streampos(7));
+
+        bsl::string result(&oa);
+        mX.extract(&result);
+        ASSERT("abc def " + longString == result);
+        ASSERT(X.view().isEmpty());
+        ASSERT(mX.tellp() == std::streampos(0));
+
+        mX.clear();
+        mX << "xyz";
+        mX >> word;
+        ASSERT("xyz" == word);
+
+        WObj mY(&oa);  const WObj& Y = mY;
+
+        mY.reserve(100);
+        mY << L"wide";
+        ASSERT(L"wide" == Y.view());
+
+        bsl::wstring wideResult(&oa);
+        mY.extract(&wideResult);
+        ASSERT(L"wide" == wideResult);
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING READ/WRITE/SEEK COMBINATIONS
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //   bslstl::TreeNodePool: memory manager to allocate tree nodes
+//   bslstl::TreeNodePoolProctor: proctor for a node created by a pool
 //
 //@SEE_ALSO: bslstl_simplepool
 //
@@ -20,11 +21,18 @@ BSLS_IDENT("$Id: $")
 //
 // A 'bslstl::TreeNodePool' contains a memory pool provided by the
 // 'bslstl_simplepool' component to provide memory for the nodes (see
-// 'bslstl_simplepool').  When the pool is empty, a number of memory blocks is
-// allocated and added to the pool, where each block is large enough to contain
-// a 'bslstl::TreeNode'.  The first allocation contains one memory block.
-// Subsequent allocations double the number of memory blocks of the previous
-// allocation up to an implementation defined maximum number of blocks.
+// 'bslstl_simplepool').  When the pool is empty, a memory block large enough
+// to contain a 'bslstl::TreeNode' is allocated from the allocator.  Since each
+// node is a separate allocation, a node created by one 'TreeNodePool' may be
+// deleted by another one using an equal allocator, which then reuses its
+// memory, or by the 'deleteNode' class method, which returns the memory to
+// the allocator, even after the pool that created the node is destroyed.
+//
+// A 'bslstl::TreeNodePoolProctor' manages a single node created by a
+// 'TreeNodePool', and deletes it on destruction unless released.  Containers
+// use it to guard a node whose value is built (e.g., by 'emplaceIntoNewNode')
+// before its position in the tree is known, since locating that position
+// invokes the user-supplied comparator, which may throw.
 //
 ///Usage
 ///-----
@@ -90,7 +98,7 @@ BSLS_IDENT("$Id: $")
 //          // supply memory.  If 'allocator' is not specified, a default
 //          // constructed 'ALLOCATOR' object is used.
 //
-//      //! ~IntSet() = 0;
+//      ~IntSet();
 //          // Destroy this object.
 //
 //      // MANIPULATORS
@@ -120,6 +128,18 @@ BSLS_IDENT("$Id: $")
 //  , d_nodePool(allocator)
 //  {
 //  }
+//..
+// Notice that the pool returns to the allocator only the memory of the nodes
+// that it holds for reuse, so the destructor deletes the nodes of the set:
+//..
+//  template <class ALLOCATOR>
+//  inline
+//  IntSet<ALLOCATOR>::~IntSet()
+//  {
+//      if (d_tree.rootNode()) {
+//          bslalg::RbTreeUtil::deleteTree(&d_tree, &d_nodePool);
+//      }
+//  }
 //
 //  // MANIPULATORS
 //  template <class ALLOCATOR>
@@ -238,6 +258,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_deallocatorproctor.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_DESTRUCTORPROCTOR
+#include <bslma_destructorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECONST
+#include <bslmf_removeconst.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_BSLS_UTIL
 #include <bsls_util.h>
 #endif
@@ -281,6 +313,15 @@ class TreeNodePool {
         // Alias for the 'size_type' of the allocator defined by 'SimplePool'.
 
   public:
+    // CLASS METHODS
+    static void deleteNode(AllocatorType *allocator, bslalg::RbTreeNode *node);
+        // Destroy the 'VALUE' value of the specified 'node' and return the
+        // memory footprint of 'node' to the specified 'allocator'.  The
+        // behavior is undefined unless 'node' refers to a 'TreeNode<VALUE>'
+        // created by a 'TreeNodePool' of this type using an allocator equal
+        // to '*allocator'.  Note that the pool that created 'node' need not
+        // exist anymore.
+
     // CREATORS
     explicit TreeNodePool(const ALLOCATOR& allocator);
         // Create a node-allocator that will use the specified 'allocator' to
@@ -304,16 +345,106 @@ class TreeNodePool {
         // Allocate a node object having the specified 'value'.  This operation
         // will copy-construct 'value' into the value of the returned node.
 
+    template <class FIRST_ARG, class SECOND_ARG>
+    bslalg::RbTreeNode *createNode(const FIRST_ARG&  first,
+                                   const SECOND_ARG& second);
+        // Allocate a node object having a 'VALUE' constructed in place by its
+        // two-argument constructor from the specified 'first' and 'second'.
+        // Note that, for a 'VALUE' that is a pair, this builds the pair
+        // directly in the node, without a temporary pair to copy from.
+
+    template <class KEY>
+    bslalg::RbTreeNode *createNodeWithKey(const KEY& key);
+        // Allocate a node object having a 'VALUE', which must be a pair,
+        // whose 'first' member is copy-constructed from the specified 'key'
+        // and whose 'second' member is default-constructed, each using the
+        // allocator of this pool.  Note that no temporary of either member
+        // type is created.
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    bslalg::RbTreeNode *emplaceIntoNewNode(ARGS&&... args);
+        // Allocate a node object having a 'VALUE' constructed in place from
+        // the specified 'args', forwarded to the 'construct' method of this
+        // pool's allocator.  Note that, unlike 'createNode(const VALUE&)', no
+        // temporary 'VALUE' is created and copied into the node.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_treenodepool.h
+    bslalg::RbTreeNode *emplaceIntoNewNode();
+
+    template <class ARGS_1>
+    bslalg::RbTreeNode *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    bslalg::RbTreeNode *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    bslalg::RbTreeNode *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    bslalg::RbTreeNode *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    bslalg::RbTreeNode *emplaceIntoNewNode(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    bslalg::RbTreeNode *emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     void deleteNode(bslalg::RbTreeNode *node);
         // Destroy the 'VALUE' value of the specified 'node' and return the
         // memory footprint of 'node' to this pool for potential reuse.  The
-        // behavior is undefined unless 'node' refers to a 'TreeNode<VALUE>'.
+        // behavior is undefined unless 'node' refers to a 'TreeNode<VALUE>'
+        // created by a 'TreeNodePool' of this type using an allocator equal
+        // to that of this pool.
+
+    void deallocateNode(bslalg::RbTreeNode *node);
+        // Return the memory footprint of the specified 'node' to this pool
+        // for potential reuse, *without* destroying its 'VALUE' value.  The
+        // behavior is undefined unless 'node' refers to a 'TreeNode<VALUE>'
+        // created by a 'TreeNodePool' of this type using an allocator equal
+        // to that of this pool, and the destructor of 'VALUE' need not be
+        // run (e.g., 'VALUE' is trivially copyable).
 
     void reserveNodes(size_type numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
         // least the specified 'numNodes' before the pool replenishes.  The
         // behavior is undefined unless '0 < numNodes'.
 
+    void release();
+        // Return the memory of the nodes held by this pool for reuse to its
+        // allocator.  Note that the nodes that are in use are not affected.
+
     void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
         // Efficiently exchange the management of nodes of this object and
         // the specified 'other' object.  The behavior is undefined unless the
@@ -327,10 +458,69 @@ class TreeNodePool {
 
 };
 
+                       // =========================
+                       // class TreeNodePoolProctor
+                       // =========================
+
+template <class FACTORY>
+class TreeNodePoolProctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // previously been invoked, automatically deletes a managed node upon
+    // destruction by invoking the 'deleteNode' method of a supplied factory.
+    // The (template parameter) type 'FACTORY' shall provide a member function
+    // that can be called as if it had the following signature:
+    //..
+    //  void deleteNode(bslalg::RbTreeNode *node);
+    //..
+
+    // DATA
+    FACTORY            *d_factory_p;  // factory that created 'd_node_p'
+    bslalg::RbTreeNode *d_node_p;     // managed node, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    TreeNodePoolProctor(const TreeNodePoolProctor&);
+    TreeNodePoolProctor& operator=(const TreeNodePoolProctor&);
+
+  public:
+    // CREATORS
+    TreeNodePoolProctor(FACTORY *factory, bslalg::RbTreeNode *node);
+        // Create a proctor that conditionally manages the specified 'node'
+        // (if non-zero), and that uses the specified 'factory' to delete the
+        // node (unless released) upon its destruction.  The behavior is
+        // undefined unless 'node' was created by 'factory'.
+
+    ~TreeNodePoolProctor();
+        // Destroy this proctor, and delete the node that it manages (if any)
+        // by invoking the 'deleteNode' method of the factory supplied at
+        // construction.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the node currently managed by this
+        // proctor.  If no node is currently being managed, this method has
+        // no effect.
+};
+
 // ===========================================================================
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ===========================================================================
 
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::deleteNode(AllocatorType      *allocator,
+                                                bslalg::RbTreeNode *node)
+{
+    BSLS_ASSERT(allocator);
+    BSLS_ASSERT(node);
+
+    TreeNode<VALUE> *treeNode = static_cast<TreeNode<VALUE> *>(node);
+    AllocatorTraits::destroy(*allocator,
+                             BSLS_UTIL_ADDRESSOF(treeNode->value()));
+    Pool::deallocateBlock(allocator, treeNode);
+}
+
 // CREATORS
 template <class VALUE, class ALLOCATOR>
 inline
@@ -377,6 +567,217 @@ bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
     return node;
 }
 
+template <class VALUE, class ALLOCATOR>
+template <class FIRST_ARG, class SECOND_ARG>
+inline
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
+                                                    const FIRST_ARG&  first,
+                                                    const SECOND_ARG& second)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               first,
+                               second);
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class KEY>
+inline
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNodeWithKey(
+                                                                const KEY& key)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *first = const_cast<FirstType *>(
+                                  BSLS_UTIL_ADDRESSOF(node->value().first));
+    AllocatorTraits::construct(allocator(), first, key);
+    bslma::DestructorProctor<FirstType> firstProctor(first);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value().second));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class VALUE, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(ARGS&&... args)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               native_std::forward<ARGS>(args)...);
+    proctor.release();
+    return node;
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_treenodepool.h
+template <class VALUE, class ALLOCATOR>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode()
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+    proctor.release();
+    return node;
+}
+
+#else
+template <class VALUE, class ALLOCATOR>
+template <class... ARGS>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR>::emplaceIntoNewNode(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    TreeNode<VALUE> *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value()),
+                               BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+    proctor.release();
+    return node;
+}
+// }}} END GENERATED CODE
+#endif
+
 template <class VALUE, class ALLOCATOR>
 inline
 bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
@@ -397,6 +798,15 @@ void TreeNodePool<VALUE, ALLOCATOR>::deleteNode(bslalg::RbTreeNode *node)
     d_pool.deallocate(treeNode);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::deallocateNode(bslalg::RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+
+    d_pool.deallocate(static_cast<TreeNode<VALUE> *>(node));
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void TreeNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
@@ -406,6 +816,13 @@ void TreeNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
     d_pool.reserve(numNodes);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::release()
+{
+    d_pool.release();
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void TreeNodePool<VALUE, ALLOCATOR>::swap(
@@ -425,6 +842,38 @@ TreeNodePool<VALUE, ALLOCATOR>::allocator() const
     return d_pool.allocator();
 }
 
+                       // -------------------------
+                       // class TreeNodePoolProctor
+                       // -------------------------
+
+// CREATORS
+template <class FACTORY>
+inline
+TreeNodePoolProctor<FACTORY>::TreeNodePoolProctor(FACTORY            *factory,
+                                                  bslalg::RbTreeNode *node)
+: d_factory_p(factory)
+, d_node_p(node)
+{
+    BSLS_ASSERT_SAFE(factory);
+}
+
+template <class FACTORY>
+inline
+TreeNodePoolProctor<FACTORY>::~TreeNodePoolProctor()
+{
+    if (d_node_p) {
+        d_factory_p->deleteNode(d_node_p);
+    }
+}
+
+// MANIPULATORS
+template <class FACTORY>
+inline
+void TreeNodePoolProctor<FACTORY>::release()
+{
+    d_node_p = 0;
+}
+
 }  // close namespace bslstl
 }  // close enterprise namespace
 
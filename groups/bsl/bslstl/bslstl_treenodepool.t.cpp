@@ -2,6 +2,7 @@
 #include <bslstl_treenodepool.h>
 
 #include <bslstl_allocator.h>
+#include <bslstl_pair.h>
 
 #include <bslalg_rbtreenode.h>
 #include <bslalg_rbtreeanchor.h>
@@ -16,6 +17,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_types.h>
 
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_stdtestallocator.h>
@@ -44,6 +46,9 @@ using namespace bslstl;
 //: o No memory is ever allocated.
 //: o Precondition violations are detected in appropriate build modes.
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 5] static void deleteNode(AllocatorType *, bslalg::RbTreeNode *);
+//
 // CREATORS
 // [ 2] explicit TreeNodePool(const ALLOCATOR& allocator);
 //
@@ -52,14 +57,24 @@ using namespace bslstl;
 // [ 2] bslalg::RbTreeNode *createNode();
 // [ 7] bslalg::RbTreeNode *createNode(const bslalg::RbTreeNode& original);
 // [ 7] bslalg::RbTreeNode *createNode(const VALUE& value);
+// [ 7] bslalg::RbTreeNode *createNode(const FIRST_ARG&, const SECOND_ARG&);
+// [ 7] bslalg::RbTreeNode *createNodeWithKey(const KEY& key);
 // [ 5] void deleteNode(bslalg::RbTreeNode *node);
+// [ 5] void deallocateNode(bslalg::RbTreeNode *node);
 // [ 6] void reserveNodes(std::size_t numNodes);
+// [ 9] bslalg::RbTreeNode *emplaceIntoNewNode(ARGS&&... args);
 // [ 8] void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
+//
+// TreeNodePoolProctor
+// [ 9] TreeNodePoolProctor(FACTORY *factory, bslalg::RbTreeNode *node);
+// [ 9] ~TreeNodePoolProctor();
+// [ 9] void release();
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [10] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 //=============================================================================
 
@@ -128,20 +143,6 @@ static bool veryVeryVeryVerbose;
 
 typedef bslalg::RbTreeNode RbNode;
 
-namespace {
-
-bool expectToAllocate(int n)
-    // Return 'true' if the container is expected to allocate memory on the
-    // specified 'n'th element, and 'false' otherwise.
-{
-    if (n > 32) {
-        return (0 == n % 32);                                         // RETURN
-    }
-    return (((n - 1) & n) == 0);  // Allocate when 'n' is a power of 2
-}
-
-}  // close unnamed namespace
-
 //=============================================================================
 //                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -277,12 +278,15 @@ class TestDriver {
 
   public:
     // TEST CASES
-    // static void testCase10();
+    // static void testCase11();
         // Reserved for BSLX.
 
-    static void testCase9();
+    static void testCase10();
         // Test usage example.
 
+    static void testCase9();
+        // Test 'emplaceIntoNewNode' and 'TreeNodePoolProctor'.
+
     static void testCase8();
         // Test 'swap' member.
 
@@ -346,13 +350,6 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
         usedBlocks->push(ptr);
     }
 
-    // Use up all the free blocks.
-
-    while (!expectToAllocate(usedBlocks->size() + 1)) {
-        RbNode *ptr = result->createNode();
-        usedBlocks->push(ptr);
-    }
-
     // Free up the necessary number of blocks.
 
     for (int i = 0; i < numBlocks; ++i) {
@@ -361,6 +358,123 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase9()
+{
+    // -----------------------------------------------------------------------
+    // MANIPULATOR 'emplaceIntoNewNode' AND CLASS 'TreeNodePoolProctor'
+    //
+    // Concerns:
+    //: 1 'emplaceIntoNewNode' constructs the value of the new node from the
+    //:   supplied arguments, passing the object allocator to a value type
+    //:   that uses 'bslma::Allocator'.
+    //:
+    //: 2 'emplaceIntoNewNode' creates no temporary object, and hence does not
+    //:   allocate from the default allocator.
+    //:
+    //: 3 Any memory allocation is from the object allocator.
+    //:
+    //: 4 A 'TreeNodePoolProctor' deletes the node it manages on destruction,
+    //:   unless 'release' has been called.
+    //
+    // Plan:
+    //: 1 Using a pool of 'bsl::pair<const int, VALUE>', call
+    //:   'emplaceIntoNewNode' with zero and two arguments, and verify the
+    //:   value of each node and the allocations from the object and default
+    //:   allocators.  (C-1..3)
+    //:
+    //: 2 Create a node, manage it by a 'TreeNodePoolProctor', and verify the
+    //:   memory in use is reduced when the proctor goes out of scope.  Repeat,
+    //:   calling 'release', and verify the node survives.  (C-4)
+    //
+    // Testing:
+    //   bslalg::RbTreeNode *emplaceIntoNewNode(ARGS&&... args);
+    //   TreeNodePoolProctor(FACTORY *factory, bslalg::RbTreeNode *node);
+    //   ~TreeNodePoolProctor();
+    //   void TreeNodePoolProctor::release();
+    // -----------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'emplaceIntoNewNode'"
+                        "\n================================\n");
+
+    typedef bsl::pair<const int, VALUE>                               PairType;
+    typedef bslstl::TreeNodePool<PairType, bsl::allocator<PairType> > PairPool;
+    typedef bslstl::TreeNode<PairType>                                PairNode;
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<VALUE>::value;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    {
+        bsltf::TestValuesArray<VALUE> VALUES(&oa);
+
+        PairPool mX(&oa);
+
+        Stack usedX;
+
+        for (int i = 0; i < 16; ++i) {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            RbNode *ptr = mX.emplaceIntoNewNode(i, VALUES[i]);
+
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
+            usedX.push(ptr);
+
+            const PairType& value = static_cast<PairNode *>(ptr)->value();
+            ASSERTV(i, i         == value.first);
+            ASSERTV(i, VALUES[i] == value.second);
+        }
+
+        RbNode *ptr = mX.emplaceIntoNewNode();
+        usedX.push(ptr);
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        const PairType& value = static_cast<PairNode *>(ptr)->value();
+        ASSERTV(value.first, 0       == value.first);
+        ASSERTV(             VALUE() == value.second);
+
+        while(!usedX.empty()) {
+            mX.deleteNode(usedX.back());
+            usedX.pop();
+        }
+    }
+
+    if (verbose) printf("\nTesting 'TreeNodePoolProctor'.\n");
+    {
+        Obj mX(&oa);
+
+        RbNode *kept = 0;
+        {
+            RbNode *ptr = mX.createNode();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            {
+                bslstl::TreeNodePoolProctor<Obj> proctor(&mX, ptr);
+            }
+            ASSERTV(-TYPE_ALLOC == oam.numBlocksInUseChange());
+        }
+        {
+            kept = mX.createNode();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            {
+                bslstl::TreeNodePoolProctor<Obj> proctor(&mX, kept);
+                proctor.release();
+            }
+            ASSERTV(oam.isInUseSame());
+        }
+        mX.deleteNode(kept);
+    }
+
+    // Verify all memory is released on object destruction.
+
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase8()
 {
@@ -368,7 +482,7 @@ void TestDriver<VALUE>::testCase8()
     // MANIPULATOR 'swap'
     //
     // Concerns:
-    //: 1 'swap' exchange the free list and chunk list of the objects.
+    //: 1 'swap' exchange the free lists of the objects.
     //:
     //: 2 The common object allocator address held by both objects is
     //:   unchanged.
@@ -378,7 +492,8 @@ void TestDriver<VALUE>::testCase8()
     //: 4 Swapping an object with itself does not affect the value of the
     //:   object (alias-safety).
     //:
-    //: 5 Memory is deallocated on the destruction of the object.
+    //: 5 The free blocks are deallocated on the destruction of the object,
+    //:   and the blocks in use are not.
     //:
     //: 6 QoI: Asserted precondition violations are detected when enabled.
     //
@@ -458,6 +573,8 @@ void TestDriver<VALUE>::testCase8()
 
             Stack usedY;
             Stack freeY;
+
+            bsls::Types::Int64 numBlocksInUse;
             {
                 Obj mY(&oa);
                 const Obj& Y = init(&mY, &usedY, &freeY, ALLOCS2, DEALLOCS2);
@@ -495,21 +612,18 @@ void TestDriver<VALUE>::testCase8()
                     mX.deleteNode(usedX.back());
                     usedX.pop();
                 }
+
+                numBlocksInUse = oa.numBlocksInUse();
             }
 
-            // 'Y' is now destroyed, its blocks should be deallocated.  Verify
-            // Blocks in 'X' (which used to be in 'Y' before the swap) is not
-            // deallocated.
+            // 'Y' is now destroyed, its free blocks should be deallocated.
+            // Verify Blocks in 'X' (which used to be in 'Y' before the swap)
+            // is not deallocated.
 
-            char SCRIBBLED_MEMORY[sizeof(VALUE)];
-            memset(SCRIBBLED_MEMORY, 0xA5, sizeof(VALUE));
-            while (!usedY.empty()) {
-                RbNode *ptr = usedY.back();
-                ASSERTV(0 != strncmp((char *)ptr,
-                                     SCRIBBLED_MEMORY,
-                                     sizeof(VALUE)));
+            ASSERTV(LINE1, LINE2, numBlocksInUse == oa.numBlocksInUse());
 
-                mX.deleteNode(ptr);
+            while (!usedY.empty()) {
+                mX.deleteNode(usedY.back());
                 usedY.pop();
             }
         }
@@ -575,6 +689,8 @@ void TestDriver<VALUE>::testCase7()
     // Testing:
     //   bslalg::RbTreeNode *createNode(const bslalg::RbTreeNode& original);
     //   bslalg::RbTreeNode *createNode(const VALUE& value);
+    //   bslalg::RbTreeNode *createNode(const FIRST_ARG&, const SECOND_ARG&);
+    //   bslalg::RbTreeNode *createNodeWithKey(const KEY& key);
     // -----------------------------------------------------------------------
 
     if (verbose) printf("\nMANIPULATOR 'createNode'"
@@ -598,14 +714,8 @@ void TestDriver<VALUE>::testCase7()
 
             RbNode *ptr = mX.createNode(VALUES[i]);
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
             usedX.push(ptr);
 
             ValueNode *node = static_cast<ValueNode *>(ptr);
@@ -621,14 +731,8 @@ void TestDriver<VALUE>::testCase7()
 
             RbNode *ptr = mY.createNode(*usedX[i]);
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
             usedY.push(ptr);
 
             ValueNode *nodeY = static_cast<ValueNode *>(ptr);
@@ -649,6 +753,89 @@ void TestDriver<VALUE>::testCase7()
         }
     }
 
+    if (verbose) printf("\nTesting 'createNode' with two arguments.\n");
+    {
+        typedef bsl::pair<const int, VALUE>                       PairType;
+        typedef bslstl::TreeNodePool<PairType, bsl::allocator<PairType> >
+                                                                  PairPool;
+        typedef bslstl::TreeNode<PairType>                        PairNode;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsltf::TestValuesArray<VALUE> VALUES;
+
+        PairPool mX(&oa);
+
+        Stack usedX;
+
+        for (int i = 0; i < 16; ++i) {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            RbNode *ptr = mX.createNode(i, VALUES[i]);
+
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
+            usedX.push(ptr);
+
+            const PairType& value = static_cast<PairNode *>(ptr)->value();
+            ASSERTV(i, i         == value.first);
+            ASSERTV(i, VALUES[i] == value.second);
+        }
+
+        // No temporary pair, hence no allocation from the default allocator.
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        while(!usedX.empty()) {
+            mX.deleteNode(usedX.back());
+            usedX.pop();
+        }
+    }
+
+    if (verbose) printf("\nTesting 'createNodeWithKey'.\n");
+    {
+        typedef bsl::pair<const int, VALUE>                       PairType;
+        typedef bslstl::TreeNodePool<PairType, bsl::allocator<PairType> >
+                                                                  PairPool;
+        typedef bslstl::TreeNode<PairType>                        PairNode;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        PairPool mX(&oa);
+
+        Stack usedX;
+
+        for (int i = 0; i < 16; ++i) {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            RbNode *ptr = mX.createNodeWithKey(i);
+
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
+            usedX.push(ptr);
+
+            ASSERTV(i, i == static_cast<PairNode *>(ptr)->value().first);
+        }
+
+        // No temporary 'VALUE', hence no allocation from the default
+        // allocator.
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        const VALUE DEFAULT_VALUE;
+        for (int i = 0; i < usedX.size(); ++i) {
+            const PairType& value = static_cast<PairNode *>(usedX[i])->value();
+            ASSERTV(i, DEFAULT_VALUE == value.second);
+        }
+
+        while(!usedX.empty()) {
+            mX.deleteNode(usedX.back());
+            usedX.pop();
+        }
+    }
+
     // Verify all memory is released on object destruction.
 
     ASSERTV(oa.numBlocksInUse(),  0 ==  oa.numBlocksInUse());
@@ -767,13 +954,20 @@ void TestDriver<VALUE>::testCase5()
     //:
     //: 3 'createNode' retrieve the last block that was deallocated.
     //:
-    //: 4 'allocate' will retrieve memory from the heap once so that the next
-    //:   allocation will not allocate from the heap.
+    //: 4 'createNode' will retrieve memory from the heap if the free list is
+    //:   empty.
     //:
     //: 5 'deleteNode' does not allocate or release any memory other than those
     //:   caused by the destructor of the value.
     //:
     //: 6 QoI: Asserted precondition violations are detected when enabled.
+    //:
+    //: 7 'deallocateNode' returns a node to the free list without invoking
+    //:   the destructor of its value.
+    //:
+    //: 8 The 'deleteNode' class method invokes the destructor of the value
+    //:   and returns the memory of the node to the allocator, even after the
+    //:   pool that created the node is destroyed.
     //
     // Plan:
     //: 1 Create a list of sequences to allocate and deallocate memory.  For
@@ -787,11 +981,24 @@ void TestDriver<VALUE>::testCase5()
     //:   3 Verify no memory was allocated from the heap on 'deleteNode'.
     //:     (C-5)
     //:
-    //:   4 Verify 'createNode' will get memory from the heap only when
-    //:     expected.
+    //:   4 Verify 'createNode' will get memory from the heap only when the
+    //:     free list is empty.  (C-4)
     //:
-    //: 2 Verify that, in appropriate build modes, defensive checks are
+    //: 2 Create a node, destroy its value explicitly, and call
+    //:   'deallocateNode'.  Verify no memory is released, and that the next
+    //:   'createNode' reuses the node without allocating memory.  (C-7)
+    //:
+    //: 3 Create a node from a pool, destroy the pool, and call the
+    //:   'deleteNode' class method with the allocator of another pool.
+    //:   Verify all memory of the node and its value is released.  (C-8)
+    //:
+    //: 4 Verify that, in appropriate build modes, defensive checks are
     //:   triggered (using the 'BSLS_ASSERTTEST_*' macros).  (C-6)
+    //
+    // Testing:
+    //   static void deleteNode(AllocatorType *, bslalg::RbTreeNode *);
+    //   void deleteNode(bslalg::RbTreeNode *node);
+    //   void deallocateNode(bslalg::RbTreeNode *node);
     // --------------------------------------------------------------------
 
     if (verbose) printf("\nMANIPULATOR 'deleteNode'"
@@ -845,14 +1052,8 @@ void TestDriver<VALUE>::testCase5()
                     freeBlocks.pop();
                 }
                 else {
-                    if (expectToAllocate(usedBlocks.size())) {
-                        ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                        ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-                    }
-                    else {
-                        ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                        ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-                    }
+                    ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+                    ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
                 }
             }
             else {
@@ -878,6 +1079,51 @@ void TestDriver<VALUE>::testCase5()
         }
     }
 
+    if (verbose) printf("\nTesting 'deallocateNode'.\n");
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);
+
+        RbNode *ptr = mX.createNode();
+
+        static_cast<ValueNode *>(ptr)->value().~VALUE();
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        mX.deallocateNode(ptr);
+
+        ASSERTV(oam.isTotalSame());
+        ASSERTV(oam.isInUseSame());
+
+        ASSERTV(ptr == mX.createNode());
+
+        ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
+        ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
+
+        mX.deleteNode(ptr);
+    }
+
+    if (verbose) printf("\nTesting class method 'deleteNode'.\n");
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);
+
+        RbNode *ptr;
+        {
+            Obj mY(&oa);
+
+            ptr = mY.createNode();
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 1 + TYPE_ALLOC == oa.numBlocksInUse());
+
+        Obj::deleteNode(&mX.allocator(), ptr);
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
     if (verbose) printf("\nNegative Testing.\n");
     {
         bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
@@ -1009,7 +1255,8 @@ void TestDriver<VALUE>::testCase2()
     //:
     //: 4 Every object releases any allocated memory at destruction.
     //:
-    //: 5 Allocation starts at one block, up to a maximum of 32 blocks.
+    //: 5 Every node created while the free list is empty is a separate
+    //:   allocation.
     //:
     //: 6 Constructor allocates no memory.
     //:
@@ -1023,12 +1270,8 @@ void TestDriver<VALUE>::testCase2()
     //:   2 Call 'allocate' 96 times in the presence of exception, for each
     //:     time:
     //:
-    //:     1 Verify memory is only allocated from object allocator and only
-    //:       when expected.  (C-2..3, 6, 9)
-    //:
-    //:     2 If memory is not allocated, the address is the max of
-    //:       'sizeof(VALUE)' and 'sizeof(void *) larger than the previous
-    //:       address.  (C-7)
+    //:     1 Verify memory is only allocated from object allocator, one
+    //:       block for each node.  (C-2..3, 5, 7)
     //:
     //:   3 Delete the object and verify all memory is deallocated.  (C-4)
     //
@@ -1096,14 +1339,8 @@ void TestDriver<VALUE>::testCase2()
 
             RbNode *ptr = mX.createNode();
 
-            if (expectToAllocate(i + 1)) {
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
-            else {
-                ASSERTV(TYPE_ALLOC == oam.numBlocksTotalChange());
-                ASSERTV(TYPE_ALLOC == oam.numBlocksInUseChange());
-            }
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksTotalChange());
+            ASSERTV(1 + TYPE_ALLOC == oam.numBlocksInUseChange());
             usedBlocks.push(ptr);
         }
 
@@ -1204,7 +1441,7 @@ void TestDriver<VALUE>::testCase2()
             // supply memory.  If 'allocator' is not specified, a default
             // constructed 'ALLOCATOR' object is used.
 //
-        //! ~IntSet() = 0;
+        ~IntSet();
             // Destroy this object.
 //
         // MANIPULATORS
@@ -1234,6 +1471,18 @@ void TestDriver<VALUE>::testCase2()
     , d_nodePool(allocator)
     {
     }
+//..
+// Notice that the pool returns to the allocator only the memory of the nodes
+// that it holds for reuse, so the destructor deletes the nodes of the set:
+//..
+    template <class ALLOCATOR>
+    inline
+    IntSet<ALLOCATOR>::~IntSet()
+    {
+        if (d_tree.rootNode()) {
+            bslalg::RbTreeUtil::deleteTree(&d_tree, &d_nodePool);
+        }
+    }
 //
     // MANIPULATORS
     template <class ALLOCATOR>
@@ -1309,7 +1558,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         if (verbose) printf("\nUSAGE EXAMPLE"
                             "\n=============\n");
 
@@ -1344,6 +1593,10 @@ int main(int argc, char *argv[])
     ASSERT(0 <  objectAllocator.numBytesInUse());
 //..
       } break;
+      case 9: {
+        TestDriver<bsltf::AllocTestType>::testCase9();
+        TestDriver<int>::testCase9();
+      } break;
       case 8: {
         TestDriver<bsltf::AllocTestType>::testCase8();
       } break;
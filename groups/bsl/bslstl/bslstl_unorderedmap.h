@@ -37,10 +37,27 @@ BSLS_IDENT("$Id: $")
 // 'unordered_map' implemented here adheres to the C++11 standard, except that
 // it may rehash when setting the 'max_load_factor' in order to preserve the
 // property that the value is always respected (which is a potentially throwing
-// operation) and it does not have interfaces that take rvalue references,
-// 'initializer_list', 'emplace', or operations taking a variadic number of
-// template parameters.  Note that excluded C++11 features are those that
-// require (or are greatly simplified by) C++11 compiler support.
+// operation) and it does not have interfaces that take rvalue references or
+// 'initializer_list'.  Note that excluded C++11 features are those that
+// require (or are greatly simplified by) C++11 compiler support.  The
+// 'emplace', 'emplace_hint', and 'try_emplace' methods construct elements in
+// place from a variadic list of arguments, which is limited to five arguments
+// on compilers that do not support variadic templates.
+//
+// The 'extract' methods unlink an element from an unordered map and pass the
+// node holding it to a 'node_type' object (see 'bslstl_nodehandle'), the
+// 'insert' method taking a 'node_type' object links such a node into an
+// unordered map again, and the 'merge' method moves into an unordered map the
+// elements of another unordered map having keys not yet present.  An element
+// extracted from an unordered map and inserted into the same unordered map
+// again is neither copied nor destroyed, and no memory is allocated for it
+// (other than buckets).  The same holds when the node is inserted into a
+// *different* unordered map using an equal allocator, since a node does not
+// depend on the unordered map that created it (see 'bslstl_nodehandle'), and
+// for the elements moved by 'merge' between unordered maps using equal
+// allocators. Inserting a 'node_type' object into an unordered map using a
+// different allocator copies the element into a newly created node and deletes
+// the extracted node.
 //
 ///Requirements on 'KEY' and 'VALUE'
 ///---------------------------------
@@ -130,6 +147,17 @@ BSLS_IDENT("$Id: $")
 // (template parameter) types 'KEY' and 'VALUE' having the
 // 'bslalg::TypeTraitUsesBslmaAllocator' trait.
 //
+///Node Memory
+/// - - - - - -
+// An 'unordered_map' allocates each of its nodes from the allocator, and keeps
+// the nodes of erased elements in a pool for reuse, so no memory is returned
+// to the allocator when an element is erased, and 'reserve' pre-allocates the
+// nodes for the requested number of elements.  As an extension to the
+// standard, 'clearAndReleaseMemory' removes all the elements and returns the
+// memory of all the nodes, including those kept for reuse, and of the buckets
+// to the allocator; if 'value_type' is trivially copyable (see
+// 'bslmf_istriviallycopyable'), the elements are not destroyed.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -151,6 +179,7 @@ BSLS_IDENT("$Id: $")
 //  'k'               - an object of type 'K'
 //  'v'               - an object of type 'value_type'
 //  'p1', 'p2'        - two iterators belonging to 'a'
+//  'h'               - an object of type 'unordered_map<K, V>::node_type'
 //  'distance(i1,i2)' - the number of elements in the range [i1, i2)
 //  'distance(p1,p2)' - the number of elements in the range [p1, p2)
 //  'z'               - a floating point value representing a load factor
@@ -231,8 +260,22 @@ BSLS_IDENT("$Id: $")
 //  |                                                    |   distance(p1, p2)]|
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.extract(&h, p1)                                  | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(&h, k)                                   | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(h)                                        | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.merge(b)                                         | Average: O[m]      |
+//  |                                                    | Worst:   O[n * m]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.clearAndReleaseMemory()                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -915,6 +958,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_CSTDDEF
 #include <cstddef>  // for 'std::size_t'
 #define INCLUDED_CSTDDEF
@@ -1017,6 +1064,8 @@ class unordered_map {
     typedef BloombergLP::bslstl::HashTableBucketIterator<
                        const value_type, difference_type> const_local_iterator;
 
+    typedef typename HashTable::NodeHandleType         node_type;
+
   private:
     // DATA
     HashTable d_impl;  // underlying hash table used by this unordered map
@@ -1177,6 +1226,145 @@ class unordered_map {
         // unordered map will be empty after this call, but allocated memory
         // may be retained for future use.
 
+    void clearAndReleaseMemory();
+        // Remove all entries from this unordered map, and return the memory of
+        // all its nodes, including those kept for reuse, and buckets to the
+        // allocator, leaving this unordered map with the bucket count of a
+        // default-constructed object.  The elements are not destroyed if
+        // 'value_type' is trivially copyable.  Note that this method is an
+        // extension to the standard (see {Node Memory}).
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    pair<iterator, bool> emplace(ARGS&&... args);
+        // Insert into this unordered map a newly created 'value_type' object,
+        // constructed in place from the specified 'args', if no element having
+        // the same key as the new object is already present; otherwise destroy
+        // the new object and leave this unordered map unchanged.  Return a
+        // 'pair' whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) element whose key is the same as that of
+        // the new object, and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' otherwise.  Note that the object is built
+        // directly in its node, so no temporary 'value_type' is copied, but a
+        // node is allocated even if the key is already present.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+    pair<iterator, bool> emplace();
+
+    template <class ARGS_1>
+    pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    pair<iterator, bool> emplace(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    pair<iterator, bool> emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          ARGS&&... args);
+        // Insert into this unordered map a newly created 'value_type' object,
+        // constructed in place from the specified 'args', if no element having
+        // the same key is already present; otherwise destroy the new object.
+        // Return an iterator referring to the (possibly newly inserted)
+        // element whose key is the same as that of the new object.  The
+        // behavior is undefined unless the specified 'hint' is a valid
+        // iterator into this unordered map.  Note that 'hint' is not used by
+        // this method.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+    iterator emplace_hint(const_iterator hint);
+
+    template <class ARGS_1>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     iterator erase(const_iterator position);
         // Remove from this unordered map the 'value_type' object at the
         // specified 'position', and return an iterator referring to the
@@ -1249,6 +1437,148 @@ class unordered_map {
         // (template parameter) types 'KEY' and 'VALUE' both be
         // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    pair<iterator, bool> try_emplace(const key_type& key,
+                                     ARGS&&... args);
+        // If a key equivalent to the specified 'key' already exists in this
+        // unordered map, return a pair whose 'first' member is an iterator
+        // referring to that element and whose 'second' member is 'false',
+        // without using the specified 'args' or allocating memory.  Otherwise,
+        // insert a 'value_type' object whose key is 'key' and whose mapped
+        // value is constructed from 'args', and return a pair whose 'first'
+        // member refers to the new element and whose 'second' member is
+        // 'true'.  Note that, unlike 'emplace', no node is allocated when the
+        // key is already present.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+    pair<iterator, bool> try_emplace(const key_type& key);
+
+    template <class ARGS_1>
+    pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    pair<iterator, bool> try_emplace(
+                             const key_type& key,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    pair<iterator, bool> try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         ARGS&&... args);
+        // Behave as 'try_emplace' without a hint, for the specified 'key' and
+        // 'args', but return only the iterator referring to the element whose
+        // key is 'key'.  The behavior is undefined unless the specified 'hint'
+        // is a valid iterator into this unordered map.  Note that 'hint' is
+        // not used by this method.
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key);
+
+    template <class ARGS_1>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1);
+
+    template <class ARGS_1,
+              class ARGS_2>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4);
+
+    template <class ARGS_1,
+              class ARGS_2,
+              class ARGS_3,
+              class ARGS_4,
+              class ARGS_5>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5);
+
+#else
+    template <class... ARGS>
+    iterator try_emplace(const_iterator  hint,
+                         const key_type& key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this unordered map having the
@@ -1288,6 +1618,50 @@ class unordered_map {
         // or the hash function allocate memory.  Also note that this operation
         // has no effect if 'numElements <= size()'.
 
+    void extract(node_type *result, const_iterator position);
+        // Unlink from this unordered map the element at the specified
+        // 'position', and load into the specified 'result' the node holding
+        // that element, after deleting the node held by 'result', if any.  The
+        // element is neither copied nor destroyed, and iterators referring to
+        // other elements of this unordered map remain valid.  The behavior is
+        // undefined unless 'position' refers to an element in this unordered
+        // map.
+
+    void extract(node_type *result, const key_type& key);
+        // Unlink from this unordered map the element having the specified
+        // 'key', if such an element exists, and load into the specified
+        // 'result' the node holding that element, after deleting the node held
+        // by 'result', if any; otherwise, leave 'result' empty.
+
+    bsl::pair<iterator, bool> insert(node_type& node);
+        // Insert into this unordered map the element held by the specified
+        // 'node' and leave 'node' empty, if 'node' is not empty and this
+        // unordered map does not already contain an element having the same
+        // key; otherwise, leave 'node' unchanged.  Return a pair whose 'first'
+        // member is an iterator referring to the element in this unordered map
+        // having that key (or to the past-the-end position if 'node' is
+        // empty), and whose 'second' member is 'true' if the element was
+        // inserted and 'false' otherwise.  If the allocator of 'node' compares
+        // equal to that of this unordered map (e.g., 'node' holds a node
+        // extracted from this unordered map), link the node held by 'node'
+        // into this unordered map without copying its value; otherwise, insert
+        // a copy of the value and delete the node held by 'node'.  If an
+        // exception is thrown, this method has no effect other than to
+        // possibly allocate more buckets.
+
+    void merge(unordered_map& source);
+        // Move into this unordered map each element of the specified 'source'
+        // having a key not already present in this unordered map, and leave
+        // the other elements in 'source'.  If 'source' uses an allocator equal
+        // to that of this unordered map, unlink the nodes holding the moved
+        // elements from 'source' and link them into this unordered map without
+        // copying the elements; otherwise, insert copies of the moved elements
+        // and erase them from 'source'.  Iterators referring to the moved
+        // elements are invalidated.  If an exception is thrown, the elements
+        // moved so far remain in this unordered map, and the others in
+        // 'source'.  This method has no effect if 'source' is this unordered
+        // map.
+
     void swap(unordered_map& other);
         // Exchange the value of this object as well as its hasher,
         // key-equality functor, and 'max_load_factor' with those of the
@@ -1616,6 +1990,374 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::clear()
     d_impl.removeAll();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::clearAndReleaseMemory()
+{
+    d_impl.removeAllAndReleaseMemory();
+}
+
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace(ARGS&&... args)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                           &isInsertedFlag,
+                                           native_std::forward<ARGS>(args)...);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace()
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(&isInsertedFlag);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+#else
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                 &isInsertedFlag,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(
+                                                                const_iterator,
+                                                                ARGS&&... args)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                           &isInsertedFlag,
+                                           native_std::forward<ARGS>(args)...);
+
+    return iterator(result);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(const_iterator)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(&isInsertedFlag);
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(
+                              const_iterator,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(
+                              const_iterator,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(
+                              const_iterator,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(
+                              const_iterator,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(
+                              const_iterator,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                &isInsertedFlag,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+
+    return iterator(result);
+}
+
+#else
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::emplace_hint(
+                               const_iterator,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    // As for the hinted overloads of 'insert', the hint is of no use in
+    // locating a duplicate key.
+
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.emplaceIfMissing(
+                                 &isInsertedFlag,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+
+    return iterator(result);
+}
+// }}} END GENERATED CODE
+#endif
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
@@ -1733,6 +2475,374 @@ void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
     }
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                                           const key_type& key,
+                                                           ARGS&&... args)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                           &isInsertedFlag,
+                                           key,
+                                           native_std::forward<ARGS>(args)...);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                                           const key_type& key)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(&isInsertedFlag, key);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+#else
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                               const key_type& key,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                 &isInsertedFlag,
+                                 key,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+// }}} END GENERATED CODE
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                                           const_iterator,
+                                                           const key_type& key,
+                                                           ARGS&&... args)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                           &isInsertedFlag,
+                                           key,
+                                           native_std::forward<ARGS>(args)...);
+
+    return iterator(result);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_unorderedmap.h
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                                           const_iterator,
+                                                           const key_type& key)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(&isInsertedFlag, key);
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const_iterator,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const_iterator,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const_iterator,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const_iterator,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARGS_1,
+          class ARGS_2,
+          class ARGS_3,
+          class ARGS_4,
+          class ARGS_5>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                              const_iterator,
+                              const key_type& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_1) args_1,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_2) args_2,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_3) args_3,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_4) args_4,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_5) args_5)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                &isInsertedFlag,
+                                key,
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_1, args_1),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_2, args_2),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_3, args_3),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_4, args_4),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS_5, args_5));
+
+    return iterator(result);
+}
+
+#else
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class... ARGS>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                               const_iterator,
+                               const key_type& key,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                 &isInsertedFlag,
+                                 key,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+
+    return iterator(result);
+}
+// }}} END GENERATED CODE
+#endif
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
           typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator>
@@ -1774,6 +2884,58 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::reserve(
     d_impl.reserveForNumElements(numElements);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(
+                                                   node_type      *result,
+                                                   const_iterator  position)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    d_impl.extractNode(result, position.node());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(
+                                                   node_type       *result,
+                                                   const key_type&  key)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    if (HashTableLink *target = d_impl.find(key)) {
+        d_impl.extractNode(result, target);
+    }
+    else {
+        result->reset();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(node_type& node)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.insertNodeIfMissing(&isInsertedFlag,
+                                                       &node);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::merge(unordered_map& source)
+{
+    d_impl.mergeIfMissing(&source.d_impl);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void
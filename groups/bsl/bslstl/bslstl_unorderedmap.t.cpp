@@ -55,10 +55,18 @@ using namespace BloombergLP;
 // instantiation and test obvious boundary conditions and iterator stability
 // guarantees.
 //-----------------------------------------------------------------------------
-// [ ]
+// [17] pair<iterator, bool> emplace(ARGS&&... args);
+// [17] iterator emplace_hint(const_iterator hint, ARGS&&... args);
+// [17] pair<iterator, bool> try_emplace(const key_type& key, ARGS&&...);
+// [17] iterator try_emplace(const_iterator, const key_type&, ARGS&&...);
+// [18] void extract(node_type *result, const_iterator position);
+// [18] void extract(node_type *result, const key_type& key);
+// [18] pair<iterator, bool> insert(node_type& node);
+// [18] void merge(unordered_map& source);
+// [19] void clearAndReleaseMemory();
 //-----------------------------------------------------------------------------
-// [1] BREATHING TEST
-// [2] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+// [20] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -5979,6 +5987,15 @@ class TestDriver {
   public:
     // TEST CASES
 
+    static void testCase19();
+        // Testing 'clearAndReleaseMemory'
+
+    static void testCase18();
+        // Testing 'extract', 'insert(node_type&)', and 'merge'
+
+    static void testCase17();
+        // Testing 'emplace', 'emplace_hint', and 'try_emplace'
+
     static void testCase16();
         // Testing Typedefs
 
@@ -6118,6 +6135,462 @@ void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::matchFirstValues(
     delete[] foundValues;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase19()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'clearAndReleaseMemory'
+    //
+    // Concerns:
+    //: 1 'clearAndReleaseMemory' leaves the unordered map empty, with the
+    //:   bucket count of a default-constructed object, and returns all the
+    //:   memory allocated by the map (and by its elements) to the allocator.
+    //:
+    //: 2 The maximum load factor is retained.
+    //:
+    //: 3 The unordered map remains usable after 'clearAndReleaseMemory'.
+    //
+    // Plan:
+    //: 1 For each row of the default data table, populate an object, having
+    //:   a non-default maximum load factor, after reserving room for its
+    //:   elements, call 'clearAndReleaseMemory', and verify the size, bucket
+    //:   count, and maximum load factor of the object, and that no memory
+    //:   remains in use.  (C-1..2)
+    //:
+    //: 2 Populate the object again, and verify its value.  (C-3)
+    //
+    // Testing:
+    //   void clearAndReleaseMemory();
+    // ------------------------------------------------------------------------
+
+    const size_t NUM_DATA                  = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    const Obj      DEFAULT(&scratch);
+    const SizeType NUM_BUCKETS     = DEFAULT.bucket_count();
+    const float    MAX_LOAD_FACTOR = 2.0f;
+
+    for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE    = DATA[ti].d_line;
+        const char *const SPEC    = DATA[ti].d_spec;
+        const char *const RESULTS = DATA[ti].d_results;
+        const size_t      LENGTH  = strlen(SPEC);
+
+        if (veryVerbose) { P_(LINE) P(SPEC) }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        mX.max_load_factor(MAX_LOAD_FACTOR);
+        mX.reserve(LENGTH);
+        gg(&mX, SPEC);
+
+        ASSERTV(LINE, verifySpec(X, RESULTS));
+
+        mX.clearAndReleaseMemory();
+
+        ASSERTV(LINE, X.empty());
+        ASSERTV(LINE, X.begin() == X.end());
+        ASSERTV(LINE, NUM_BUCKETS     == X.bucket_count());
+        ASSERTV(LINE, MAX_LOAD_FACTOR == X.max_load_factor());
+        ASSERTV(LINE, 0               == oa.numBlocksInUse());
+
+        mX.clearAndReleaseMemory();
+
+        ASSERTV(LINE, X.empty());
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+        gg(&mX, SPEC);
+
+        ASSERTV(LINE, verifySpec(X, RESULTS));
+        ASSERTV(LINE, MAX_LOAD_FACTOR == X.max_load_factor());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase18()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+    //
+    // Concerns:
+    //: 1 'extract' unlinks the element at the supplied position, or having
+    //:   the supplied key, and passes the node holding it to the supplied
+    //:   'node_type' object without copying the element or releasing memory.
+    //:
+    //: 2 'extract' leaves the 'node_type' object empty if no element has the
+    //:   supplied key.
+    //:
+    //: 3 'insert' links a node extracted from the same container without
+    //:   copying the element or allocating memory, and leaves the
+    //:   'node_type' object empty.
+    //:
+    //: 4 'insert' has no effect, and leaves the 'node_type' object unchanged,
+    //:   if the object is empty or an element having the same key exists.
+    //:
+    //: 5 'insert' copies the element held by a node extracted from a
+    //:   container using another allocator, and is exception neutral.
+    //:
+    //: 6 'merge' moves into the container each element of the source having
+    //:   a key not present, and leaves the other elements in the source.
+    //:
+    //: 7 'merge' neither copies nor destroys the moved elements if both
+    //:   containers use the same allocator, and the moved elements remain
+    //:   valid after the source is destroyed.
+    //:
+    //: 8 'merge' provides the strong exception-safety guarantee w.r.t. memory
+    //:   allocation if both containers use the same allocator.
+    //
+    // Plan:
+    //: 1 For each element of a set of objects, extract the element by
+    //:   position and by key, and verify the address of the element, the
+    //:   value of the object, and the memory in use.  Extract the same key
+    //:   again, and verify that the 'node_type' object is empty.  (C-1..2)
+    //:
+    //: 2 Insert the extracted node, and verify the address of the element,
+    //:   the value of the object, and the memory in use.  Insert the empty
+    //:   'node_type' object, and a node holding a duplicate key, and verify
+    //:   that neither has an effect.  (C-3..4)
+    //:
+    //: 3 Insert the node holding a duplicate key into an object using a
+    //:   different allocator under the presence of exceptions, and verify
+    //:   the value of both the object and the 'node_type' object.  (C-5)
+    //:
+    //: 4 Using a table of pairs of specifications, merge the second object
+    //:   into the first, both when they use the same and different
+    //:   allocators, and verify the values of both objects and (when the
+    //:   allocators are the same) the addresses of the moved elements after
+    //:   the source object is destroyed.  Repeat the merge under the presence
+    //:   of exceptions when the allocators are the same.  (C-6..8)
+    //
+    // Testing:
+    //   void extract(node_type *result, const_iterator position);
+    //   void extract(node_type *result, const key_type& key);
+    //   pair<iterator, bool> insert(node_type& node);
+    //   void merge(unordered_map& source);
+    // ------------------------------------------------------------------------
+
+    typedef typename Obj::node_type NodeType;
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    if (verbose) printf("\nTesting 'extract' and 'insert(node_type&)'.\n");
+    {
+        static const struct {
+            int         d_line;  // source line number
+            const char *d_spec;  // specification string (unique keys)
+        } DATA[] = {
+            //line  spec
+            //----  ----
+
+            { L_,   "A"          },
+            { L_,   "AB"         },
+            { L_,   "CBA"        },
+            { L_,   "ACBED"      },
+            { L_,   "HGFEDCBA"   }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const size_t      LENGTH = strlen(SPEC);
+
+            TestValues values(SPEC, &scratch);
+
+            if (veryVerbose) { P_(LINE) P(SPEC); }
+
+            for (size_t tj = 0; tj < LENGTH; ++tj) {
+            for (int byKey = 0; byKey < 2; ++byKey) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC);
+
+                const KEY&  K       = values[tj].first;
+                const Pair *ADDRESS = &*X.find(K);
+
+                const bsls::Types::Int64 B = oa.numBlocksInUse();
+
+                NodeType node;
+                if (byKey) {
+                    mX.extract(&node, K);
+                }
+                else {
+                    mX.extract(&node, X.find(K));
+                }
+
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == node.value().first);
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+                ASSERTV(LINE, tj, byKey, X.end()     == X.find(K));
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+
+                NodeType missing;
+                mX.extract(&missing, K);
+
+                ASSERTV(LINE, tj, byKey, missing.empty());
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+
+                bsl::pair<Iter, bool> R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &*R.first);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey, verifySpec(X, SPEC));
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, X.end()     == R.first);
+                ASSERTV(LINE, tj, byKey, LENGTH      == X.size());
+
+                // Insert a node holding a key that is already present.
+
+                mX.extract(&node, K);
+                mX.insert(values[tj]);
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == R.first->first);
+                ASSERTV(LINE, tj, byKey, verifySpec(X, SPEC));
+
+                // Insert the node into an object using another allocator.
+
+                bslma::TestAllocator za("other", veryVeryVeryVerbose);
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                    ASSERTV(LINE, tj, byKey, !node.empty());
+                    ASSERTV(LINE, tj, byKey, 0 == Z.size());
+
+                    R = mZ.insert(node);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, 1 == Z.size());
+                ASSERTV(LINE, tj, byKey, K == Z.begin()->first);
+                ASSERTV(LINE, tj, byKey, values[tj].second == R.first->second);
+
+                // The copy of the element inserted into 'X' above may have
+                // required a new block for the node pool of 'X'.
+
+                ASSERTV(LINE, tj, byKey, B     <= oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey, B + 1 >= oa.numBlocksInUse());
+            }
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting 'merge'.\n");
+    {
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_specX;    // specification of the target
+            const char *d_specY;    // specification of the source
+            const char *d_resultX;  // expected value of the target
+            const char *d_resultY;  // expected value of the source
+        } DATA[] = {
+            //line  specX     specY       resultX     resultY
+            //----  -----     -----       -------     -------
+
+            { L_,   "",       "",         "",         ""     },
+            { L_,   "",       "ABC",      "ABC",      ""     },
+            { L_,   "ABC",    "",         "ABC",      ""     },
+            { L_,   "ABC",    "CBA",      "ABC",      "ABC"  },
+            { L_,   "ACE",    "BCD",      "ABCDE",    "C"    },
+            { L_,   "AB",     "CDEFGH",   "ABCDEFGH", ""     },
+            { L_,   "BDFH",   "HGFEDCBA", "ABCDEFGH", "BDFH" },
+            { L_,   "ABCDEFG", "H",       "ABCDEFGH", ""     }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MAX_LENGTH = 10;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const SPEC_X   = DATA[ti].d_specX;
+            const char *const SPEC_Y   = DATA[ti].d_specY;
+            const char *const RESULT_X = DATA[ti].d_resultX;
+            const char *const RESULT_Y = DATA[ti].d_resultY;
+
+            if (veryVerbose) { P_(LINE) P_(SPEC_X) P(SPEC_Y); }
+
+            for (int sameAlloc = 0; sameAlloc < 2; ++sameAlloc) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+
+                const Pair *ADDRESSES[MAX_LENGTH];
+                int numMoved = 0;
+                {
+                    Obj mY(sameAlloc ? &oa : &za);
+                    const Obj& Y = gg(&mY, SPEC_Y);
+
+                    for (CIter it = Y.begin(); it != Y.end(); ++it) {
+                        if (X.end() == X.find(it->first)) {
+                            ADDRESSES[numMoved++] = &*it;
+                        }
+                    }
+
+                    mX.merge(mY);
+
+                    ASSERTV(LINE, sameAlloc, verifySpec(X, RESULT_X));
+                    ASSERTV(LINE, sameAlloc, verifySpec(Y, RESULT_Y));
+
+                    mX.merge(mX);
+
+                    ASSERTV(LINE, sameAlloc, verifySpec(X, RESULT_X));
+                }
+
+                ASSERTV(LINE, sameAlloc, verifySpec(X, RESULT_X));
+
+                if (sameAlloc) {
+                    for (int k = 0; k < numMoved; ++k) {
+                        ASSERTV(LINE, k,
+                                ADDRESSES[k] == &*X.find(ADDRESSES[k]->first));
+                    }
+                }
+
+                mX.clear();
+
+                ASSERTV(LINE, sameAlloc, 0 == za.numBlocksInUse());
+            }
+
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+                Obj mY(&oa);  const Obj& Y = gg(&mY, SPEC_Y);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, verifySpec(X, SPEC_X));
+                    ASSERTV(LINE, verifySpec(Y, SPEC_Y));
+
+                    mX.merge(mY);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, verifySpec(X, RESULT_X));
+                ASSERTV(LINE, verifySpec(Y, RESULT_Y));
+            }
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase17()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace', 'emplace_hint', AND 'try_emplace'
+    //
+    // Concerns:
+    //: 1 Each method inserts a new element, constructed from the supplied
+    //:   arguments, if and only if no element having the same key exists.
+    //:
+    //: 2 The iterator returned refers to the element having the key of the
+    //:   supplied arguments, and the 'bool' returned (if any) is 'true' if
+    //:   and only if a new element was inserted.
+    //:
+    //: 3 No memory remains in use when an element with a duplicate key is not
+    //:   inserted, and 'try_emplace' allocates no memory at all in that case.
+    //:
+    //: 4 Each method provides the strong exception guarantee.
+    //
+    // Plan:
+    //: 1 For each method, and for each row of the default data table, insert
+    //:   each value of the 'spec' (passing its key and mapped value as
+    //:   separate arguments) into an initially empty object under the
+    //:   presence of injected exceptions, and verify the size of the object
+    //:   after each attempt.  (C-4)
+    //:
+    //: 2 Verify the return value of each call, and the number of allocations
+    //:   made when the key is already present.  (C-2..3)
+    //:
+    //: 3 Verify the final value of the object against the expected 'results'
+    //:   of the row.  (C-1)
+    //
+    // Testing:
+    //   pair<iterator, bool> emplace(ARGS&&... args);
+    //   iterator emplace_hint(const_iterator hint, ARGS&&... args);
+    //   pair<iterator, bool> try_emplace(const key_type& key, ARGS&&...);
+    //   iterator try_emplace(const_iterator, const key_type&, ARGS&&...);
+    // ------------------------------------------------------------------------
+
+    const size_t NUM_DATA                  = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    enum { e_EMPLACE, e_EMPLACE_HINT, e_TRY_EMPLACE, e_TRY_EMPLACE_HINT,
+           e_NUM_METHODS };
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    for (int method = 0; method < e_NUM_METHODS; ++method) {
+        for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const SPEC    = DATA[ti].d_spec;
+            const char *const RESULTS = DATA[ti].d_results;
+            const size_t      LENGTH  = strlen(SPEC);
+
+            if (veryVerbose) { P_(method) P_(LINE) P(SPEC) }
+
+            TestValues values(SPEC, &scratch);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);    const Obj& X = mX;
+
+            for (size_t tj = 0; tj < LENGTH; ++tj) {
+                const KEY&   K       = values[tj].first;
+                const VALUE& V       = values[tj].second;
+                const bool   IS_UNIQ = X.end() == X.find(K);
+                const size_t SIZE    = X.size();
+
+                bsl::pair<Iter, bool> result(mX.end(), IS_UNIQ);
+
+                const bsls::Types::Int64 BB = sa.numBlocksTotal();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    ASSERTV(LINE, tj, SIZE == X.size());
+
+                    switch (method) {
+                      case e_EMPLACE: {
+                        result = mX.emplace(K, V);
+                      } break;
+                      case e_EMPLACE_HINT: {
+                        result.first = mX.emplace_hint(X.begin(), K, V);
+                      } break;
+                      case e_TRY_EMPLACE: {
+                        result = mX.try_emplace(K, V);
+                      } break;
+                      case e_TRY_EMPLACE_HINT: {
+                        result.first = mX.try_emplace(X.begin(), K, V);
+                      } break;
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(method, LINE, tj, IS_UNIQ == result.second);
+                ASSERTV(method, LINE, tj, K == result.first->first);
+                ASSERTV(method, LINE, tj, SIZE + IS_UNIQ == X.size());
+
+                if (!IS_UNIQ && (e_TRY_EMPLACE      == method
+                              || e_TRY_EMPLACE_HINT == method)) {
+                    ASSERTV(method, LINE, tj, BB == sa.numBlocksTotal());
+                }
+            }
+
+            ASSERTV(method, LINE, verifySpec(X, RESULTS));
+        }
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase16()
 {
@@ -9567,7 +10040,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
 #if !defined(BSLSTL_UNORDEREDMAP_DO_NOT_TEST_USAGE)
-        case 17: {
+        case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9588,6 +10061,42 @@ int main(int argc, char *argv[])
         usage();
       } break;
 #endif
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING 'clearAndReleaseMemory'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing 'clearAndReleaseMemory'\n"
+                            "===============================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase19,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing 'extract', 'insert', and 'merge'\n"
+                            "========================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase18,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'emplace', 'emplace_hint', AND 'try_emplace'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing 'emplace' and 'try_emplace'\n"
+                            "===================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase17,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
@@ -59,10 +59,11 @@ using namespace BloombergLP;
 // MULTIMAP TEST SHOULD MAP *DIFFERENT* VALUES AGAINST DUPLICATE KEYS AND TEST
 // ACCORDINGLY.
 //-----------------------------------------------------------------------------
-// [ ]
+// [17] iterator emplace(ARGS&&... args);
+// [17] iterator emplace_hint(const_iterator hint, ARGS&&... args);
 //-----------------------------------------------------------------------------
-// [1] BREATHING TEST
-// [2] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+// [18] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -879,6 +880,9 @@ class TestDriver {
   public:
     // TEST CASES
 
+    static void testCase17();
+        // Testing 'emplace' and 'emplace_hint'
+
     static void testCase16();
         // Testing Typedefs
 
@@ -1013,6 +1017,81 @@ bool TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::matchFirstValues(
     return true;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase17()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace' AND 'emplace_hint'
+    //
+    // Concerns:
+    //: 1 Each method inserts a new element, constructed from the supplied
+    //:   arguments, whether or not elements having the same key exist.
+    //:
+    //: 2 The iterator returned refers to the newly inserted element.
+    //:
+    //: 3 Each method provides the strong exception guarantee.
+    //
+    // Plan:
+    //: 1 For each method, and for each row of the default data table, insert
+    //:   each value of the 'spec' into an initially empty object under the
+    //:   presence of injected exceptions, and verify the size of the object
+    //:   at the start of each attempt.  (C-3)
+    //:
+    //: 2 Verify the returned value, and the number of elements having the
+    //:   key of the value, after each call.  (C-1..2)
+    //
+    // Testing:
+    //   iterator emplace(ARGS&&... args);
+    //   iterator emplace_hint(const_iterator hint, ARGS&&... args);
+    // ------------------------------------------------------------------------
+
+    enum { e_EMPLACE, e_EMPLACE_HINT, e_NUM_METHODS };
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    for (int method = 0; method < e_NUM_METHODS; ++method) {
+        for (int ti = 0; ti < (int)DEFAULT_NUM_DATA; ++ti) {
+            const int         LINE   = DEFAULT_DATA[ti].d_line;
+            const char *const SPEC   = DEFAULT_DATA[ti].d_spec;
+            const size_t      LENGTH = strlen(SPEC);
+
+            if (veryVerbose) { P_(method) P_(LINE) P(SPEC) }
+
+            TestValues values(SPEC, &scratch);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);    const Obj& X = mX;
+
+            for (size_t tj = 0; tj < LENGTH; ++tj) {
+                const KEY&   K     = values[tj].first;
+                const VALUE& V     = values[tj].second;
+                const size_t COUNT = X.count(K);
+                const size_t SIZE  = X.size();
+
+                Iter result;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    ASSERTV(method, LINE, tj, SIZE == X.size());
+
+                    if (e_EMPLACE == method) {
+                        result = mX.emplace(K, V);
+                    }
+                    else {
+                        result = mX.emplace_hint(X.begin(), K, V);
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(method, LINE, tj, K         == result->first);
+                ASSERTV(method, LINE, tj, SIZE + 1  == X.size());
+                ASSERTV(method, LINE, tj, COUNT + 1 == X.count(K));
+            }
+
+            ASSERTV(method, LINE, LENGTH == X.size());
+        }
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase16()
 {
@@ -5529,7 +5608,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5552,6 +5631,18 @@ int main(int argc, char *argv[])
             usage();
         }
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'emplace' AND 'emplace_hint'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing 'emplace'\n"
+                            "=================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase17,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
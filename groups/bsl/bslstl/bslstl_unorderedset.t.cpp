@@ -150,6 +150,12 @@ using namespace BloombergLP;
 //*[15] bsl::pair<iterator, bool> insert(const value_type& value);
 //*[15] iterator insert(const_iterator position, const value_type& value);
 //*[17] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+//*[28] bsl::pair<iterator, bool> emplace(ARGS&&... args);
+//*[28] iterator emplace_hint(const_iterator hint, ARGS&&... args);
+// [29] void extract(node_type *result, const_iterator position);
+// [29] void extract(node_type *result, const key_type& key);
+// [29] bsl::pair<iterator, bool> insert(node_type& node);
+// [29] void merge(unordered_set& source);
 //
 //*[18] iterator erase(const_iterator position);
 //*[18] size_type erase(const key_type& key);
@@ -198,7 +204,7 @@ using namespace BloombergLP;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [29] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -691,15 +697,15 @@ void testErase(CONTAINER& mX)
     // range-erase all matching values for a given key value
     size = x.size();
     cIter = x.begin();
-    key = keyForValue<CONTAINER>(*cIter);
+    bucketA = x.bucket(keyForValue<CONTAINER>(*cIter));
     next = cIter;
-    while (key == keyForValue<CONTAINER>(*++next)) {
+    while (bucketA == x.bucket(keyForValue<CONTAINER>(*++next))) {
         cIter = next;
     }
     key = keyForValue<CONTAINER>(*next);
-    while (key == keyForValue<CONTAINER>(*++next)) {}
-    ++next;
-    // cIter/next now point to elements either side of a key-range
+    const size_t bucketB = x.bucket(key);
+    while (bucketB == x.bucket(keyForValue<CONTAINER>(*++next))) {}
+    // cIter/next now point to elements either side of a bucket
     // confirm they are not in the same bucket:
     ASSERT(x.bucket(key) != x.bucket(keyForValue<CONTAINER>(*cIter)));
     ASSERT(x.bucket(key) != x.bucket(keyForValue<CONTAINER>(*next)));
@@ -1210,9 +1216,20 @@ class TestDriver {
         // Return the iterator relating to the specified 'obj' with specified
         // index 'idx'.  It is an error if 'idx >= obj.size()'.
 
+    static bool verifySpec(const Obj& object, const char *spec);
+        // Return 'true' if the specified 'object' holds exactly the values
+        // corresponding to the characters of the specified 'spec', which must
+        // not contain duplicates, and 'false' otherwise.
+
   public:
     // TEST CASES
 
+    static void testCase29();
+        // Testing 'extract', 'insert(node_type&)', and 'merge'
+
+    static void testCase28();
+        // Testing 'emplace' and 'emplace_hint'
+
     static void testCase99();
         // Test spread of nodes into different buckets
 
@@ -1366,6 +1383,28 @@ bsl::unordered_set<KEY, HASH, EQUAL, ALLOC>
     return gg(&object, spec);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOC>
+bool TestDriver<KEY, HASH, EQUAL, ALLOC>::verifySpec(const Obj&  object,
+                                                     const char *spec)
+{
+    const size_t LENGTH = strlen(spec);
+
+    if (LENGTH != object.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+    TestValues           values(spec, &scratch);
+
+    for (size_t i = 0; i < LENGTH; ++i) {
+        if (1 != object.count(values[i])) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
 template <typename TYPE>
 bool isConstValue(TYPE&)
     // Template method to determine whether a returned value is declared
@@ -1416,6 +1455,361 @@ TestDriver<KEY, HASH, EQUAL, ALLOC>::getIterForIndex(const Obj& obj,
     return ret;
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase29()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+    //
+    // Concerns:
+    //: 1 'extract' unlinks the element at the supplied position, or having
+    //:   the supplied key, and passes the node holding it to the supplied
+    //:   'node_type' object without copying the element or releasing memory.
+    //:
+    //: 2 'extract' leaves the 'node_type' object empty if no element has the
+    //:   supplied key.
+    //:
+    //: 3 'insert' links a node extracted from the same container without
+    //:   copying the element or allocating memory, and leaves the
+    //:   'node_type' object empty.
+    //:
+    //: 4 'insert' has no effect, and leaves the 'node_type' object unchanged,
+    //:   if the object is empty or an element having the same key exists.
+    //:
+    //: 5 'insert' copies the element held by a node extracted from a
+    //:   container using another allocator, and is exception neutral.
+    //:
+    //: 6 'merge' moves into the container each element of the source having
+    //:   a key not present, and leaves the other elements in the source.
+    //:
+    //: 7 'merge' neither copies nor destroys the moved elements if both
+    //:   containers use the same allocator, and the moved elements remain
+    //:   valid after the source is destroyed.
+    //:
+    //: 8 'merge' provides the strong exception-safety guarantee w.r.t. memory
+    //:   allocation if both containers use the same allocator.
+    //
+    // Plan:
+    //: 1 For each element of a set of objects, extract the element by
+    //:   position and by key, and verify the address of the element, the
+    //:   value of the object, and the memory in use.  Extract the same key
+    //:   again, and verify that the 'node_type' object is empty.  (C-1..2)
+    //:
+    //: 2 Insert the extracted node, and verify the address of the element,
+    //:   the value of the object, and the memory in use.  Insert the empty
+    //:   'node_type' object, and a node holding a duplicate key, and verify
+    //:   that neither has an effect.  (C-3..4)
+    //:
+    //: 3 Insert the node holding a duplicate key into an object using a
+    //:   different allocator under the presence of exceptions, and verify
+    //:   the value of both the object and the 'node_type' object.  (C-5)
+    //:
+    //: 4 Using a table of pairs of specifications, merge the second object
+    //:   into the first, both when they use the same and different
+    //:   allocators, and verify the values of both objects and (when the
+    //:   allocators are the same) the addresses of the moved elements after
+    //:   the source object is destroyed.  Repeat the merge under the presence
+    //:   of exceptions when the allocators are the same.  (C-6..8)
+    //
+    // Testing:
+    //   void extract(node_type *result, const_iterator position);
+    //   void extract(node_type *result, const key_type& key);
+    //   bsl::pair<iterator, bool> insert(node_type& node);
+    //   void merge(unordered_set& source);
+    // ------------------------------------------------------------------------
+
+    typedef typename Obj::node_type NodeType;
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    if (verbose) printf("\nTesting 'extract' and 'insert(node_type&)'.\n");
+    {
+        static const struct {
+            int         d_line;  // source line number
+            const char *d_spec;  // specification string (unique keys)
+        } DATA[] = {
+            //line  spec
+            //----  ----
+
+            { L_,   "A"          },
+            { L_,   "AB"         },
+            { L_,   "CBA"        },
+            { L_,   "ACBED"      },
+            { L_,   "HGFEDCBA"   }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const size_t      LENGTH = strlen(SPEC);
+
+            TestValues values(SPEC, &scratch);
+
+            if (veryVerbose) { P_(LINE) P(SPEC); }
+
+            for (size_t tj = 0; tj < LENGTH; ++tj) {
+            for (int byKey = 0; byKey < 2; ++byKey) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC);
+
+                const KEY&  K       = values[tj];
+                const KEY  *ADDRESS = &*X.find(K);
+
+                const bsls::Types::Int64 B = oa.numBlocksInUse();
+
+                NodeType node;
+                if (byKey) {
+                    mX.extract(&node, K);
+                }
+                else {
+                    mX.extract(&node, X.find(K));
+                }
+
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == node.value());
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+                ASSERTV(LINE, tj, byKey, X.end()     == X.find(K));
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+
+                NodeType missing;
+                mX.extract(&missing, K);
+
+                ASSERTV(LINE, tj, byKey, missing.empty());
+                ASSERTV(LINE, tj, byKey, LENGTH - 1  == X.size());
+
+                bsl::pair<Iter, bool> R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &*R.first);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, B           == oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey, verifySpec(X, SPEC));
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, X.end()     == R.first);
+                ASSERTV(LINE, tj, byKey, LENGTH      == X.size());
+
+                // Insert a node holding a key that is already present.
+
+                mX.extract(&node, K);
+                mX.insert(values[tj]);
+
+                R = mX.insert(node);
+
+                ASSERTV(LINE, tj, byKey, !R.second);
+                ASSERTV(LINE, tj, byKey, !node.empty());
+                ASSERTV(LINE, tj, byKey, ADDRESS     == &node.value());
+                ASSERTV(LINE, tj, byKey, K           == *R.first);
+                ASSERTV(LINE, tj, byKey, verifySpec(X, SPEC));
+
+                // Insert the node into an object using another allocator.
+
+                bslma::TestAllocator za("other", veryVeryVeryVerbose);
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                    ASSERTV(LINE, tj, byKey, !node.empty());
+                    ASSERTV(LINE, tj, byKey, 0 == Z.size());
+
+                    R = mZ.insert(node);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, tj, byKey, R.second);
+                ASSERTV(LINE, tj, byKey, node.empty());
+                ASSERTV(LINE, tj, byKey, 1 == Z.size());
+                ASSERTV(LINE, tj, byKey, K == *Z.begin());
+                ASSERTV(LINE, tj, byKey, K == *R.first);
+
+                // The copy of the element inserted into 'X' above may have
+                // required a new block for the node pool of 'X'.
+
+                ASSERTV(LINE, tj, byKey, B     <= oa.numBlocksInUse());
+                ASSERTV(LINE, tj, byKey, B + 1 >= oa.numBlocksInUse());
+            }
+            }
+        }
+    }
+
+    if (verbose) printf("\nTesting 'merge'.\n");
+    {
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_specX;    // specification of the target
+            const char *d_specY;    // specification of the source
+            const char *d_resultX;  // expected value of the target
+            const char *d_resultY;  // expected value of the source
+        } DATA[] = {
+            //line  specX     specY       resultX     resultY
+            //----  -----     -----       -------     -------
+
+            { L_,   "",       "",         "",         ""     },
+            { L_,   "",       "ABC",      "ABC",      ""     },
+            { L_,   "ABC",    "",         "ABC",      ""     },
+            { L_,   "ABC",    "CBA",      "ABC",      "ABC"  },
+            { L_,   "ACE",    "BCD",      "ABCDE",    "C"    },
+            { L_,   "AB",     "CDEFGH",   "ABCDEFGH", ""     },
+            { L_,   "BDFH",   "HGFEDCBA", "ABCDEFGH", "BDFH" },
+            { L_,   "ABCDEFG", "H",       "ABCDEFGH", ""     }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MAX_LENGTH = 10;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const SPEC_X   = DATA[ti].d_specX;
+            const char *const SPEC_Y   = DATA[ti].d_specY;
+            const char *const RESULT_X = DATA[ti].d_resultX;
+            const char *const RESULT_Y = DATA[ti].d_resultY;
+
+            if (veryVerbose) { P_(LINE) P_(SPEC_X) P(SPEC_Y); }
+
+            for (int sameAlloc = 0; sameAlloc < 2; ++sameAlloc) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+
+                const KEY *ADDRESSES[MAX_LENGTH];
+                int numMoved = 0;
+                {
+                    Obj mY(sameAlloc ? &oa : &za);
+                    const Obj& Y = gg(&mY, SPEC_Y);
+
+                    for (CIter it = Y.begin(); it != Y.end(); ++it) {
+                        if (X.end() == X.find(*it)) {
+                            ADDRESSES[numMoved++] = &*it;
+                        }
+                    }
+
+                    mX.merge(mY);
+
+                    ASSERTV(LINE, sameAlloc, verifySpec(X, RESULT_X));
+                    ASSERTV(LINE, sameAlloc, verifySpec(Y, RESULT_Y));
+
+                    mX.merge(mX);
+
+                    ASSERTV(LINE, sameAlloc, verifySpec(X, RESULT_X));
+                }
+
+                ASSERTV(LINE, sameAlloc, verifySpec(X, RESULT_X));
+
+                if (sameAlloc) {
+                    for (int k = 0; k < numMoved; ++k) {
+                        ASSERTV(LINE, k,
+                                ADDRESSES[k] == &*X.find(*ADDRESSES[k]));
+                    }
+                }
+
+                mX.clear();
+
+                ASSERTV(LINE, sameAlloc, 0 == za.numBlocksInUse());
+            }
+
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC_X);
+                Obj mY(&oa);  const Obj& Y = gg(&mY, SPEC_Y);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, verifySpec(X, SPEC_X));
+                    ASSERTV(LINE, verifySpec(Y, SPEC_Y));
+
+                    mX.merge(mY);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, verifySpec(X, RESULT_X));
+                ASSERTV(LINE, verifySpec(Y, RESULT_Y));
+            }
+        }
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase28()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'emplace' AND 'emplace_hint'
+    //
+    // Concerns:
+    //: 1 Each method inserts a new element, constructed from the supplied
+    //:   arguments, if and only if no element having the same key exists.
+    //:
+    //: 2 The iterator returned refers to the element having the key of the
+    //:   supplied arguments, and the 'bool' returned by 'emplace' is 'true' if
+    //:   and only if a new element was inserted.
+    //:
+    //: 3 Each method provides the strong exception guarantee.
+    //
+    // Plan:
+    //: 1 For each method, and for each row of the default data table, insert
+    //:   each value of the 'spec' into an initially empty object under the
+    //:   presence of injected exceptions, and verify the size of the object
+    //:   at the start of each attempt.  (C-3)
+    //:
+    //: 2 Verify the returned value, and the number of elements having the
+    //:   key of the value, after each call.  (C-1..2)
+    //
+    // Testing:
+    //   pair<iterator, bool> emplace(ARGS&&... args);
+    //   iterator emplace_hint(const_iterator hint, ARGS&&... args);
+    // ------------------------------------------------------------------------
+
+    enum { e_EMPLACE, e_EMPLACE_HINT, e_NUM_METHODS };
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    for (int method = 0; method < e_NUM_METHODS; ++method) {
+        for (int ti = 0; ti < (int)DEFAULT_NUM_DATA; ++ti) {
+            const int         LINE    = DEFAULT_DATA[ti].d_line;
+            const char *const SPEC    = DEFAULT_DATA[ti].d_spec;
+            const char *const RESULTS = DEFAULT_DATA[ti].d_results;
+            const size_t      LENGTH  = strlen(SPEC);
+
+            if (veryVerbose) { P_(method) P_(LINE) P(SPEC) }
+
+            TestValues values(SPEC, &scratch);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);    const Obj& X = mX;
+
+            for (size_t tj = 0; tj < LENGTH; ++tj) {
+                const KEY&   K     = values[tj];
+                const size_t COUNT = X.count(K);
+                const size_t SIZE  = X.size();
+
+                bsl::pair<Iter, bool> result(mX.end(), 0 == COUNT);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    ASSERTV(method, LINE, tj, SIZE == X.size());
+
+                    if (e_EMPLACE == method) {
+                        result = mX.emplace(K);
+                    }
+                    else {
+                        result.first = mX.emplace_hint(X.begin(), K);
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                const bool IS_UNIQ = 0 == COUNT;
+
+                ASSERTV(method, LINE, tj, IS_UNIQ       == result.second);
+                ASSERTV(method, LINE, tj, K             == *result.first);
+                ASSERTV(method, LINE, tj, SIZE + IS_UNIQ == X.size());
+                ASSERTV(method, LINE, tj, 1             == X.count(K));
+            }
+
+            ASSERTV(method, LINE, strlen(RESULTS) == X.size());
+        }
+    }
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase99()
 {
@@ -6378,7 +6772,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 28: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6533,6 +6927,30 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING 'extract', 'insert(node_type&)', AND 'merge'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing 'extract', 'insert', and 'merge'\n"
+                            "========================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase29,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING 'emplace' AND 'emplace_hint'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing 'emplace'\n"
+                            "=================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase28,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // TESTING SPREAD
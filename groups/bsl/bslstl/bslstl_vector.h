@@ -192,6 +192,21 @@ BSLS_IDENT("$Id: $")
 //  |-----------------------------------------+-------------------------------|
 //..
 //
+///Parallel Construction and Destruction
+///-------------------------------------
+// As an extension to the standard, the sized constructors, 'assign(k, v)',
+// 'resize', and 'clear' have overloads taking a 'bsls::ParallelPolicy' as
+// their last argument (before the allocator, for the constructors).  When the
+// policy allows it, these overloads split the construction or destruction of
+// a large number of elements across several threads (see
+// 'bslalg_parallelarrayprimitives'), and otherwise behave as the overloads
+// without a policy.  Since the destructor of a vector cannot take a policy, a
+// large vector of elements having non-trivial destructors can be torn down in
+// parallel by calling 'clear' with a policy before it is destroyed.  Note that
+// with such a policy, the constructors and destructor of 'VALUE_TYPE', and the
+// allocator supplied to the elements, must be safe to call concurrently on
+// distinct objects.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -508,10 +523,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_arrayprimitives.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_AUTOARRAYDESTRUCTOR
+#include <bslalg_autoarraydestructor.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_CONSTRUCTORPROXY
 #include <bslalg_constructorproxy.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_PARALLELARRAYPRIMITIVES
+#include <bslalg_parallelarrayprimitives.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_RANGECOMPARE
 #include <bslalg_rangecompare.h>
 #endif
@@ -564,6 +587,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_compilerfeatures.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PARALLELUTIL
+#include <bsls_parallelutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_PERFORMANCEHINT
 #include <bsls_performancehint.h>
 #endif
@@ -572,6 +599,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_types.h>
 #endif
 
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_CSTDDEF
 #include <cstddef>
 #define INCLUDED_CSTDDEF
@@ -901,6 +932,22 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // Reserve exactly the specified 'numElements'.  The behavior is
         // undefined unless this vector is empty and has no capacity.
 
+    void privateConstruct(VALUE_TYPE                              *begin,
+                          size_type                                numElements,
+                          const VALUE_TYPE                        *value,
+                          const BloombergLP::bsls::ParallelPolicy&  policy);
+        // Construct the specified 'numElements' elements in the uninitialized
+        // array starting at the specified 'begin' address as copies of the
+        // object at the specified 'value' address, or default-constructed if
+        // 'value' is 0, using the specified 'policy'.
+
+    void privateResize(size_type                                newSize,
+                       const VALUE_TYPE                        *value,
+                       const BloombergLP::bsls::ParallelPolicy&  policy);
+        // Change the size of this vector to the specified 'newSize', as if by
+        // 'resize(newSize, *value, policy)', or by 'resize(newSize, policy)'
+        // if the specified 'value' is 0.
+
   public:
     // CREATORS
 
@@ -935,6 +982,28 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // parameter) type 'VALUE_TYPE' be "copy-constructible" (see
         // {Requirements on 'VALUE_TYPE'}).
 
+    Vector_Imp(size_type                                initialSize,
+               const BloombergLP::bsls::ParallelPolicy& policy,
+               const ALLOCATOR&                         allocator =
+                                                                  ALLOCATOR());
+    Vector_Imp(size_type                                initialSize,
+               const VALUE_TYPE&                        value,
+               const BloombergLP::bsls::ParallelPolicy& policy,
+               const ALLOCATOR&                         allocator =
+                                                                  ALLOCATOR());
+        // Create a vector of the specified 'initialSize' whose every element
+        // is default-constructed or, if specified, equals the specified
+        // 'value', splitting the construction of the elements across threads
+        // as allowed by the specified 'policy'.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not specified,
+        // a default-constructed allocator is used.  Throw 'std::length_error'
+        // if 'initialSize > max_size()'.  This method requires that the
+        // (template parameter) type 'VALUE_TYPE' be "copy-constructible" if
+        // 'value' is specified and "default-constructible" otherwise (see
+        // {Requirements on 'VALUE_TYPE'}).  Note that these constructors are
+        // an extension to the standard (see {Parallel Construction and
+        // Destruction}).
+
     template <class INPUT_ITER>
     Vector_Imp(INPUT_ITER       first,
                INPUT_ITER       last,
@@ -994,6 +1063,21 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // parameter) type 'VALUE_TYPE' be "copy-constructible" (see
         // {Requirements on 'VALUE_TYPE'}).
 
+    void assign(size_type                                numElements,
+                const VALUE_TYPE&                        value,
+                const BloombergLP::bsls::ParallelPolicy& policy);
+        // Assign to this vector the value of the vector of the specified
+        // 'numElements' size whose every elements equal the specified 'value',
+        // splitting the destruction of the current elements and the
+        // construction of the new ones across threads as allowed by the
+        // specified 'policy'.  Throw 'std::length_error' if
+        // 'numElements > max_size()'.  Note that this vector will be left in
+        // an empty state in case an exception is thrown.  This method
+        // requires that the (template parameter) type 'VALUE_TYPE' be
+        // "copy-constructible" (see {Requirements on 'VALUE_TYPE'}).  Also
+        // note that this method is an extension to the standard (see
+        // {Parallel Construction and Destruction}).
+
                          // *** 23.2.4.2 capacity: ***
 
     void resize(size_type newSize);
@@ -1008,6 +1092,19 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // specified and "default-constructible" otherwise (see {Requirements
         // on 'VALUE_TYPE'}).
 
+    void resize(size_type                                newSize,
+                const BloombergLP::bsls::ParallelPolicy& policy);
+    void resize(size_type                                newSize,
+                const VALUE_TYPE&                        value,
+                const BloombergLP::bsls::ParallelPolicy& policy);
+        // Change the size of this vector to the specified 'newSize', as if by
+        // 'resize(newSize)' or 'resize(newSize, value)' with the optionally
+        // specified 'value', splitting the destruction or construction of the
+        // elements across threads as allowed by the specified 'policy'.  If
+        // an exception is thrown, this vector is left unchanged.  Note that
+        // these methods are an extension to the standard (see {Parallel
+        // Construction and Destruction}).
+
     void reserve(size_type newCapacity);
         // Change the capacity of this vector to the specified 'newCapacity'.
         // Note that the capacity of a vector is the maximum number of elements
@@ -1209,6 +1306,13 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // Remove all the elements from this vector.  Note that this vector is
         // empty after this call, but conserves the same capacity.
 
+    void clear(const BloombergLP::bsls::ParallelPolicy& policy);
+        // Remove all the elements from this vector, splitting their
+        // destruction across threads as allowed by the specified 'policy'.
+        // Note that this vector is empty after this call, but conserves the
+        // same capacity.  Also note that this method is an extension to the
+        // standard (see {Parallel Construction and Destruction}).
+
     // ACCESSORS
 
                   // *** 23.2.4.1 construct/copy/assignment: ***
@@ -1335,6 +1439,25 @@ class vector : public Vector_Imp<VALUE_TYPE, ALLOCATOR>
         // the (template parameter) type 'VALUE_TYPE' be "copy-constructible"
         // (see {Requirements on 'VALUE_TYPE'}).
 
+    vector(size_type                                n,
+           const BloombergLP::bsls::ParallelPolicy& policy,
+           const ALLOCATOR&                         alloc = ALLOCATOR());
+    vector(size_type                                n,
+           const VALUE_TYPE&                        value,
+           const BloombergLP::bsls::ParallelPolicy& policy,
+           const ALLOCATOR&                         alloc = ALLOCATOR());
+        // Create a vector of the specified size 'n' whose every element is
+        // default-constructed or, if specified, equals the specified 'value',
+        // splitting the construction of the elements across threads as
+        // allowed by the specified 'policy'.  Optionally specify an allocator
+        // 'alloc' used to supply memory.  If 'alloc' is not specified, a
+        // default-constructed allocator is used.  This method requires that
+        // the (template parameter) type 'VALUE_TYPE' be "copy-constructible"
+        // if 'value' is specified and "default-constructible" otherwise (see
+        // {Requirements on 'VALUE_TYPE'}).  Note that these constructors are
+        // an extension to the standard (see {Parallel Construction and
+        // Destruction}).
+
     template <class INPUT_ITER>
     vector(INPUT_ITER       first,
            INPUT_ITER       last,
@@ -1446,6 +1569,17 @@ class vector< VALUE_TYPE *, ALLOCATOR >
            const ALLOCATOR&  alloc = ALLOCATOR())
     : Base(n, (void *)value, BaseAlloc(alloc)) { }
 
+    vector(size_type                                n,
+           const BloombergLP::bsls::ParallelPolicy& policy,
+           const ALLOCATOR&                         alloc = ALLOCATOR())
+    : Base(n, policy, BaseAlloc(alloc)) { }
+
+    vector(size_type                                n,
+           VALUE_TYPE                              *value,
+           const BloombergLP::bsls::ParallelPolicy& policy,
+           const ALLOCATOR&                         alloc = ALLOCATOR())
+    : Base(n, (void *)value, policy, BaseAlloc(alloc)) { }
+
     template <class INPUT_ITER>
     vector(INPUT_ITER       first,
            INPUT_ITER       last,
@@ -1472,6 +1606,11 @@ class vector< VALUE_TYPE *, ALLOCATOR >
     void assign(size_type numElements, VALUE_TYPE *value)
         { Base::assign(numElements, (void *)value); }
 
+    void assign(size_type                                numElements,
+                VALUE_TYPE                              *value,
+                const BloombergLP::bsls::ParallelPolicy& policy)
+        { Base::assign(numElements, (void *)value, policy); }
+
                              // *** iterators: ***
 
     iterator begin()
@@ -1503,6 +1642,13 @@ class vector< VALUE_TYPE *, ALLOCATOR >
         { Base::resize(newLength); }
     void resize(size_type newLength, VALUE_TYPE *value)
         { Base::resize(newLength, (void *)value); }
+    void resize(size_type                                newLength,
+                const BloombergLP::bsls::ParallelPolicy& policy)
+        { Base::resize(newLength, policy); }
+    void resize(size_type                                newLength,
+                VALUE_TYPE                              *value,
+                const BloombergLP::bsls::ParallelPolicy& policy)
+        { Base::resize(newLength, (void *)value, policy); }
 
     // void reserve(size_type newCapacity);
     // can be inherited from Base without cast
@@ -1679,6 +1825,17 @@ class vector< const VALUE_TYPE *, ALLOCATOR >
            const ALLOCATOR&  alloc = ALLOCATOR())
     : Base(n, (const void *)value, BaseAlloc(alloc)) { }
 
+    vector(size_type                                n,
+           const BloombergLP::bsls::ParallelPolicy& policy,
+           const ALLOCATOR&                         alloc = ALLOCATOR())
+    : Base(n, policy, BaseAlloc(alloc)) { }
+
+    vector(size_type                                n,
+           const VALUE_TYPE                        *value,
+           const BloombergLP::bsls::ParallelPolicy& policy,
+           const ALLOCATOR&                         alloc = ALLOCATOR())
+    : Base(n, (const void *)value, policy, BaseAlloc(alloc)) { }
+
     template <class INPUT_ITER>
     vector(INPUT_ITER       first,
            INPUT_ITER       last,
@@ -1705,6 +1862,11 @@ class vector< const VALUE_TYPE *, ALLOCATOR >
     void assign(size_type numElements, const VALUE_TYPE *value)
         { Base::assign(numElements, (const void *)value); }
 
+    void assign(size_type                                numElements,
+                const VALUE_TYPE                        *value,
+                const BloombergLP::bsls::ParallelPolicy& policy)
+        { Base::assign(numElements, (const void *)value, policy); }
+
                              // *** iterators: ***
 
     iterator begin()
@@ -1736,6 +1898,13 @@ class vector< const VALUE_TYPE *, ALLOCATOR >
         { Base::resize(newLength); }
     void resize(size_type newLength, const VALUE_TYPE *value)
         { Base::resize(newLength, (const void *)value); }
+    void resize(size_type                                newLength,
+                const BloombergLP::bsls::ParallelPolicy& policy)
+        { Base::resize(newLength, policy); }
+    void resize(size_type                                newLength,
+                const VALUE_TYPE                        *value,
+                const BloombergLP::bsls::ParallelPolicy& policy)
+        { Base::resize(newLength, (const void *)value, policy); }
 
     // void reserve(size_type newCapacity);
     // can be inherited from Base without cast.
@@ -2410,6 +2579,87 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateReserveEmpty(
     this->d_capacity = numElements;
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateConstruct(
+                          VALUE_TYPE                              *begin,
+                          size_type                                numElements,
+                          const VALUE_TYPE                        *value,
+                          const BloombergLP::bsls::ParallelPolicy&  policy)
+{
+    if (value) {
+        BloombergLP::bslalg::ParallelArrayPrimitives::uninitializedFillN(
+                                                       begin,
+                                                       numElements,
+                                                       *value,
+                                                       this->bslmaAllocator(),
+                                                       policy);
+    }
+    else {
+        BloombergLP::bslalg::ParallelArrayPrimitives::defaultConstruct(
+                                                       begin,
+                                                       numElements,
+                                                       this->bslmaAllocator(),
+                                                       policy);
+    }
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateResize(
+                              size_type                                newSize,
+                              const VALUE_TYPE                        *value,
+                              const BloombergLP::bsls::ParallelPolicy&  policy)
+{
+    if (newSize <= this->size()) {
+        BloombergLP::bslalg::ParallelArrayPrimitives::destroy(
+                                                   this->d_dataBegin + newSize,
+                                                   this->d_dataEnd,
+                                                   policy);
+        this->d_dataEnd = this->d_dataBegin + newSize;
+        return;                                                       // RETURN
+    }
+
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > maxSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                  "vector<...>::resize(n,p): vector too long");
+    }
+
+    const size_type numElements = newSize - this->size();
+
+    if (newSize <= this->d_capacity) {
+        privateConstruct(this->d_dataEnd, numElements, value, policy);
+        this->d_dataEnd += numElements;
+        return;                                                       // RETURN
+    }
+
+    // Construct the new elements in the new array before moving the existing
+    // elements there, so that 'value' may be one of the existing elements.
+
+    Vector_Imp temp(this->get_allocator());
+    temp.privateReserveEmpty(Vector_Util::computeNewCapacity(newSize,
+                                                             this->d_capacity,
+                                                             maxSize));
+
+    VALUE_TYPE *tail = temp.d_dataBegin + this->size();
+    privateConstruct(tail, numElements, value, policy);
+
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE> guard(
+                                                          tail,
+                                                          tail + numElements);
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       temp.d_dataBegin,
+                                                       this->d_dataBegin,
+                                                       this->d_dataEnd,
+                                                       this->bslmaAllocator());
+    guard.release();
+
+    temp.d_dataEnd += newSize;
+    this->d_dataEnd = this->d_dataBegin;
+    Vector_Util::swap(&this->d_dataBegin, &temp.d_dataBegin);
+}
+
 // CREATORS
 
                   // *** 23.2.4.1 construct/copy/destroy: ***
@@ -2477,6 +2727,62 @@ Vector_Imp<VALUE_TYPE, ALLOCATOR>::Vector_Imp(size_type         initialSize,
     }
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+Vector_Imp<VALUE_TYPE, ALLOCATOR>::Vector_Imp(
+                          size_type                                initialSize,
+                          const BloombergLP::bsls::ParallelPolicy& policy,
+                          const ALLOCATOR&                         allocator)
+: Vector_ImpBase<VALUE_TYPE>()
+, VectorContainerBase(allocator)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(initialSize > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                  "vector<...>::vector(n,p): vector too long");
+    }
+    if (initialSize > 0) {
+        privateReserveEmpty(initialSize);
+        Guard guard(this->d_dataBegin,
+                    this->d_capacity,
+                    static_cast<VectorContainerBase *>(this));
+
+        privateConstruct(this->d_dataBegin, initialSize, 0, policy);
+
+        guard.release();
+        this->d_dataEnd += initialSize;
+    }
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+Vector_Imp<VALUE_TYPE, ALLOCATOR>::Vector_Imp(
+                          size_type                                initialSize,
+                          const VALUE_TYPE&                        value,
+                          const BloombergLP::bsls::ParallelPolicy& policy,
+                          const ALLOCATOR&                         allocator)
+: Vector_ImpBase<VALUE_TYPE>()
+, VectorContainerBase(allocator)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(initialSize > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                "vector<...>::vector(n,v,p): vector too long");
+    }
+    if (initialSize > 0) {
+        privateReserveEmpty(initialSize);
+        Guard guard(this->d_dataBegin,
+                    this->d_capacity,
+                    static_cast<VectorContainerBase *>(this));
+
+        privateConstruct(this->d_dataBegin,
+                         initialSize,
+                         BSLS_UTIL_ADDRESSOF(value),
+                         policy);
+
+        guard.release();
+        this->d_dataEnd += initialSize;
+    }
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITER>
 Vector_Imp<VALUE_TYPE, ALLOCATOR>::Vector_Imp(INPUT_ITER       first,
@@ -2590,6 +2896,39 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::assign(size_type         numElements,
     insert(this->begin(), numElements, value);
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::assign(
+                          size_type                                numElements,
+                          const VALUE_TYPE&                        value,
+                          const BloombergLP::bsls::ParallelPolicy& policy)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                "vector<...>::assign(n,v,p): vector too long");
+    }
+
+    const VALUE_TYPE *valuePtr = BSLS_UTIL_ADDRESSOF(value);
+    if (this->d_dataBegin <= valuePtr && valuePtr < this->d_dataEnd) {
+
+        // 'value' is one of the elements about to be destroyed: assign from a
+        // copy.
+
+        BloombergLP::bslalg::ConstructorProxy<VALUE_TYPE> copy(
+                                     value,
+                                     BloombergLP::bslma::Default::allocator());
+        assign(numElements, copy.object(), policy);
+        return;                                                       // RETURN
+    }
+
+    clear(policy);
+    if (numElements > this->d_capacity) {
+        reserve(numElements);
+    }
+    privateConstruct(this->d_dataBegin, numElements, valuePtr, policy);
+    this->d_dataEnd += numElements;
+}
+
                          // *** 23.2.4.2 capacity: ***
 template <class VALUE_TYPE, class ALLOCATOR>
 void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize(size_type newSize)
@@ -2599,35 +2938,56 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize(size_type newSize)
                                                    this->d_dataBegin + newSize,
                                                    this->d_dataEnd);
         this->d_dataEnd = this->d_dataBegin + newSize;
+        return;                                                       // RETURN
+    }
+
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > maxSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                    "vector<...>::resize(n): vector too long");
     }
-    else {
 
-        // Check whether there's room at the end of the list.  If there is,
-        // build the temporary directly there.  Note that 'newSize' cannot
-        // be 0, since it is always true that 'this->size() >= 0'.
+    // Default-construct the new elements where they belong, rather than
+    // copying them from a default-constructed temporary, so that types with a
+    // trivial default constructor are zero-filled by a single 'memset'.
 
-        if (newSize < this->d_capacity) {
+    const size_type numElements = newSize - this->size();
 
-            BloombergLP::bslalg::ScalarPrimitives::defaultConstruct(
+    if (newSize <= this->d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::defaultConstruct(
                                                        this->d_dataEnd,
+                                                       numElements,
                                                        this->bslmaAllocator());
+        this->d_dataEnd += numElements;
+        return;                                                       // RETURN
+    }
 
-            const VALUE_TYPE& defaultValue = *(this->d_dataEnd);
-            ++this->d_dataEnd;  // prevent memory leak in case of exception
+    Vector_Imp temp(this->get_allocator());
+    temp.privateReserveEmpty(Vector_Util::computeNewCapacity(newSize,
+                                                             this->d_capacity,
+                                                             maxSize));
 
-            insert(this->d_dataEnd,
-                   newSize - this->size(),
-                   defaultValue);
-        }
-        else {
+    VALUE_TYPE *tail = temp.d_dataBegin + this->size();
+    BloombergLP::bslalg::ArrayPrimitives::defaultConstruct(
+                                                       tail,
+                                                       numElements,
+                                                       this->bslmaAllocator());
 
-            BloombergLP::bslalg::ConstructorProxy<VALUE_TYPE> defaultValue(
-                                     BloombergLP::bslma::Default::allocator());
-            insert(this->d_dataEnd,
-                   newSize - this->size(),
-                   defaultValue.object());
-        }
-    }
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE> guard(
+                                                          tail,
+                                                          tail + numElements);
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       temp.d_dataBegin,
+                                                       this->d_dataBegin,
+                                                       this->d_dataEnd,
+                                                       this->bslmaAllocator());
+    guard.release();
+
+    temp.d_dataEnd += newSize;
+    this->d_dataEnd = this->d_dataBegin;
+    Vector_Util::swap(&this->d_dataBegin, &temp.d_dataBegin);
 }
 
 template <class VALUE_TYPE, class ALLOCATOR>
@@ -2645,6 +3005,25 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize(size_type         newSize,
     }
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize(
+                              size_type                                newSize,
+                              const BloombergLP::bsls::ParallelPolicy& policy)
+{
+    privateResize(newSize, 0, policy);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize(
+                              size_type                                newSize,
+                              const VALUE_TYPE&                        value,
+                              const BloombergLP::bsls::ParallelPolicy& policy)
+{
+    privateResize(newSize, BSLS_UTIL_ADDRESSOF(value), policy);
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 void Vector_Imp<VALUE_TYPE, ALLOCATOR>::reserve(size_type newCapacity)
 {
@@ -3764,6 +4143,17 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::clear()
     BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::clear(
+                               const BloombergLP::bsls::ParallelPolicy& policy)
+{
+    BloombergLP::bslalg::ParallelArrayPrimitives::destroy(this->d_dataBegin,
+                                                          this->d_dataEnd,
+                                                          policy);
+    this->d_dataEnd = this->d_dataBegin;
+}
+
 // ACCESSORS
 template <class VALUE_TYPE, class ALLOCATOR>
 inline
@@ -3871,6 +4261,27 @@ vector<VALUE_TYPE, ALLOCATOR>::vector(size_type         n,
 {
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+vector<VALUE_TYPE, ALLOCATOR>::vector(
+                               size_type                                n,
+                               const BloombergLP::bsls::ParallelPolicy& policy,
+                               const ALLOCATOR&                         alloc)
+: Base(n, policy, alloc)
+{
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+vector<VALUE_TYPE, ALLOCATOR>::vector(
+                               size_type                                n,
+                               const VALUE_TYPE&                        value,
+                               const BloombergLP::bsls::ParallelPolicy& policy,
+                               const ALLOCATOR&                         alloc)
+: Base(n, value, policy, alloc)
+{
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITER>
 inline
@@ -21,11 +21,13 @@
 #include <bsls_bsltestutil.h>
 #include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_parallelutil.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 #include <bsls_stopwatch.h>                // for testing only
 #include <bsls_util.h>
 
+#include <bsltf_alloctesttype.h>
 #include <bsltf_nontypicaloverloadstesttype.h>
 
 #include <iterator>   // 'iterator_traits'
@@ -91,6 +93,8 @@ using namespace bsl;
 // [12] vector<T,A>(size_type n, const T& val, const A& a = A());
 // [12] template<class InputIter>
 //        vector<T,A>(InputIter first, InputIter last, const A& a = A());
+// [24] vector<T,A>(size_type n, const ParallelPolicy& p, const A& a = A());
+// [24] vector<T,A>(size_type n, const T& v, const ParallelPolicy& p, a);
 // [ 7] vector<T,A>(const vector<T,A>& orig, const A& = A());
 // [12] vector(vector<T,A>&& original);
 // [ 2] ~vector<T,A>();
@@ -99,6 +103,7 @@ using namespace bsl;
 // [13] template <class InputIter>
 //        void assign(InputIter first, InputIter last);
 // [13] void assign(size_type numElements, const T& val);
+// [24] void assign(size_type n, const T& val, const ParallelPolicy& p);
 // [ 9] operator=(vector<T,A>&);
 // [15] reference operator[](size_type pos);
 // [15] reference at(size_type pos);
@@ -108,9 +113,12 @@ using namespace bsl;
 // [16] reverse_iterator rend();
 // [14] void resize(size_type n);
 // [14] void resize(size_type n, const T& val);
+// [24] void resize(size_type n, const ParallelPolicy& p);
+// [24] void resize(size_type n, const T& val, const ParallelPolicy& p);
 // [14] void reserve(size_type n);
 // [14] void shrink_to_fit();
 // [ 2] void clear();
+// [24] void clear(const ParallelPolicy& p);
 // [15] reference front();
 // [15] reference back();
 // [  ] VALUE_TYPE *data();
@@ -156,7 +164,7 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [18] USAGE EXAMPLE
+// [25] USAGE EXAMPLE
 // [21] CONCERN: 'std::length_error' is used properly
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
@@ -1315,6 +1323,9 @@ struct TestDriver {
     static void testCaseM1();
         // Performance test.
 
+    static void testCase24();
+        // Test parallel policy overloads.
+
     static void testCase22();
         // Test overloaded new/delete.
 
@@ -2119,6 +2130,319 @@ void TestDriver<TYPE,ALLOC>::testCaseM1()
     }
 }
 
+template <class TYPE, class ALLOC>
+void TestDriver<TYPE,ALLOC>::testCase24()
+{
+    // --------------------------------------------------------------------
+    // TESTING PARALLEL POLICY OVERLOADS
+    //
+    // Concerns:
+    //: 1 The constructors taking a 'bsls::ParallelPolicy' create a vector
+    //:   having the specified number of elements, each having the default
+    //:   value or the specified value, and using the specified allocator.
+    //:
+    //: 2 'assign(n, v, policy)' replaces the value of the vector with 'n'
+    //:   copies of 'v', even when 'v' is an element of the vector.
+    //:
+    //: 3 'resize(n, policy)' and 'resize(n, v, policy)' erase or append the
+    //:   appropriate number of elements, whether or not the vector has to
+    //:   grow, and even when 'v' is an element of the vector.
+    //:
+    //: 4 'clear(policy)' destroys all elements without releasing the
+    //:   capacity of the vector.
+    //:
+    //: 5 The result does not depend on the policy, including on the number
+    //:   of threads and on the minimum chunk size.
+    //:
+    //: 6 No memory is leaked, even in the presence of exceptions.
+    //:
+    //: 7 'std::length_error' is thrown if the requested size exceeds
+    //:   'max_size()'.
+    //
+    // Plan:
+    //: 1 For a table of sizes and a table of policies, exercise each of the
+    //:   overloads, starting from empty and non-empty vectors, and compare
+    //:   the resulting value element by element.  (C-1..5)
+    //:
+    //: 2 Verify the allocator of the vector and the number of blocks in use
+    //:   after each operation.  (C-1, 4, 6)
+    //:
+    //: 3 Repeat the construction and 'resize' tests within the
+    //:   'bslma::TestAllocator' exception test macros.  (C-6)
+    //:
+    //: 4 Request sizes exceeding 'max_size()' and verify that
+    //:   'std::length_error' is thrown.  (C-7)
+    //
+    // Testing:
+    //   vector<T,A>(size_type n, const ParallelPolicy& p, const A& a);
+    //   vector<T,A>(size_type n, const T& v, const ParallelPolicy& p, a);
+    //   void assign(size_type n, const T& val, const ParallelPolicy& p);
+    //   void resize(size_type n, const ParallelPolicy& p);
+    //   void resize(size_type n, const T& val, const ParallelPolicy& p);
+    //   void clear(const ParallelPolicy& p);
+    // --------------------------------------------------------------------
+
+    typedef bsls::ParallelPolicy Policy;
+
+    bslma::TestAllocator testAllocator(veryVeryVerbose);
+    const ALLOC          Z(&testAllocator);
+
+    const TYPE *VALUES;
+    getValues(&VALUES);
+
+    const TYPE DEFAULT = TYPE();
+
+    static const int SIZES[] = { 0, 1, 2, 7, 16, 33, 100, 257 };
+    enum { NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+    const Policy POLICIES[] = {
+        Policy(),
+        Policy(1),
+        Policy(2, 1),
+        Policy(3, 7),
+        Policy(4, 1),
+        Policy(8, 16),
+    };
+    enum { NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES };
+
+    if (verbose) printf("\tTesting constructors.\n");
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& P = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const size_t N = SIZES[si];
+
+            {
+                Obj mX(N, P, Z);  const Obj& X = mX;
+
+                LOOP2_ASSERT(pi, si, N == X.size());
+                LOOP2_ASSERT(pi, si, Z == X.get_allocator());
+                for (size_t i = 0; i < N; ++i) {
+                    LOOP3_ASSERT(pi, si, i, DEFAULT == X[i]);
+                }
+            }
+            {
+                Obj mX(N, VALUES[1], P, Z);  const Obj& X = mX;
+
+                LOOP2_ASSERT(pi, si, N == X.size());
+                LOOP2_ASSERT(pi, si, Z == X.get_allocator());
+                for (size_t i = 0; i < N; ++i) {
+                    LOOP3_ASSERT(pi, si, i, VALUES[1] == X[i]);
+                }
+            }
+            LOOP2_ASSERT(pi, si, 0 == testAllocator.numBlocksInUse());
+        }
+    }
+
+    if (verbose) printf("\tTesting 'assign'.\n");
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& P = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const size_t N = SIZES[si];
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const size_t INIT = SIZES[ti];
+
+                {
+                    Obj mX(INIT, VALUES[0], Z);  const Obj& X = mX;
+
+                    mX.assign(N, VALUES[2], P);
+
+                    LOOP3_ASSERT(pi, si, ti, N == X.size());
+                    for (size_t i = 0; i < N; ++i) {
+                        LOOP4_ASSERT(pi, si, ti, i, VALUES[2] == X[i]);
+                    }
+                }
+
+                if (0 == INIT) {
+                    continue;
+                }
+
+                {
+                    Obj mX(INIT, VALUES[0], Z);  const Obj& X = mX;
+                    mX.back() = VALUES[3];
+
+                    mX.assign(N, X.back(), P);                     // aliased
+
+                    LOOP3_ASSERT(pi, si, ti, N == X.size());
+                    for (size_t i = 0; i < N; ++i) {
+                        LOOP4_ASSERT(pi, si, ti, i, VALUES[3] == X[i]);
+                    }
+                }
+                LOOP3_ASSERT(pi, si, ti, 0 == testAllocator.numBlocksInUse());
+            }
+        }
+    }
+
+    if (verbose) printf("\tTesting 'resize'.\n");
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& P = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const size_t N = SIZES[si];
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const size_t INIT = SIZES[ti];
+
+                for (int reserved = 0; reserved < 2; ++reserved) {
+                    {
+                        Obj mX(INIT, VALUES[0], Z);  const Obj& X = mX;
+                        if (reserved) {
+                            mX.reserve(N);
+                        }
+
+                        mX.resize(N, P);
+
+                        LOOP3_ASSERT(pi, si, ti, N == X.size());
+                        for (size_t i = 0; i < N; ++i) {
+                            LOOP4_ASSERT(pi, si, ti, i,
+                                         (i < INIT ? VALUES[0] : DEFAULT)
+                                                                      == X[i]);
+                        }
+                    }
+                    {
+                        Obj mX(INIT, VALUES[0], Z);  const Obj& X = mX;
+                        if (reserved) {
+                            mX.reserve(N);
+                        }
+
+                        mX.resize(N, VALUES[4], P);
+
+                        LOOP3_ASSERT(pi, si, ti, N == X.size());
+                        for (size_t i = 0; i < N; ++i) {
+                            LOOP4_ASSERT(pi, si, ti, i,
+                                         (i < INIT ? VALUES[0] : VALUES[4])
+                                                                      == X[i]);
+                        }
+                    }
+                    if (0 < INIT) {
+                        Obj mX(INIT, VALUES[0], Z);  const Obj& X = mX;
+                        mX.back() = VALUES[1];
+                        if (reserved) {
+                            mX.reserve(N);
+                        }
+
+                        mX.resize(N, X.back(), P);                 // aliased
+
+                        LOOP3_ASSERT(pi, si, ti, N == X.size());
+                        for (size_t i = 0; i < N; ++i) {
+                            LOOP4_ASSERT(pi, si, ti, i,
+                                         (i < INIT - 1 ? VALUES[0]
+                                                       : VALUES[1]) == X[i]);
+                        }
+                    }
+                    LOOP3_ASSERT(pi,
+                                 si,
+                                 ti,
+                                 0 == testAllocator.numBlocksInUse());
+                }
+            }
+        }
+    }
+
+    if (verbose) printf("\tTesting 'clear'.\n");
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& P = POLICIES[pi];
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const size_t N = SIZES[si];
+
+            Obj mX(N, VALUES[2], Z);  const Obj& X = mX;
+            const size_t CAPACITY = X.capacity();
+
+            mX.clear(P);
+
+            LOOP2_ASSERT(pi, si, X.empty());
+            LOOP2_ASSERT(pi, si, CAPACITY == X.capacity());
+            LOOP2_ASSERT(pi, si, (0 < CAPACITY) ==
+                                        (1 == testAllocator.numBlocksInUse()));
+
+            mX.clear(P);
+
+            LOOP2_ASSERT(pi, si, X.empty());
+        }
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (verbose) printf("\tTesting exception safety.\n");
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& P = POLICIES[pi];
+
+#ifndef BSLALG_PARALLELARRAYPRIMITIVES_TRANSPORTS_EXCEPTIONS
+        if (1 != P.numThreads()) {
+            // The 'bslma::TestAllocatorException' thrown by a split range
+            // reaches the caller as a 'std::bad_exception'.
+
+            continue;                                               // CONTINUE
+        }
+#endif
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const size_t N = SIZES[si];
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+                Obj mX(N, VALUES[3], P, Z);  const Obj& X = mX;
+
+                LOOP2_ASSERT(pi, si, N == X.size());
+
+                mX.resize(2 * N + 1, VALUES[4], P);
+
+                LOOP2_ASSERT(pi, si, 2 * N + 1 == X.size());
+                LOOP2_ASSERT(pi, si, VALUES[4] == X.back());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            LOOP2_ASSERT(pi, si, 0 == testAllocator.numBlocksInUse());
+        }
+    }
+
+    if (verbose) printf("\tTesting 'std::length_error'.\n");
+
+    for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        const Policy& P = POLICIES[pi];
+
+        Obj mX(3, VALUES[0], Z);  const Obj& X = mX;
+        const size_t TOO_BIG = X.max_size() + 1;
+
+        bool caught = false;
+        try {
+            Obj mY(TOO_BIG, P, Z);
+        }
+        catch (std::length_error&) {
+            caught = true;
+        }
+        LOOP_ASSERT(pi, caught);
+
+        caught = false;
+        try {
+            mX.resize(TOO_BIG, VALUES[1], P);
+        }
+        catch (std::length_error&) {
+            caught = true;
+        }
+        LOOP_ASSERT(pi, caught);
+
+        caught = false;
+        try {
+            mX.assign(TOO_BIG, VALUES[1], P);
+        }
+        catch (std::length_error&) {
+            caught = true;
+        }
+        LOOP_ASSERT(pi, caught);
+
+        LOOP_ASSERT(pi, 3 == X.size());
+        LOOP_ASSERT(pi, VALUES[0] == X[2]);
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+#endif
+}
+
 template <class TYPE, class ALLOC>
 void TestDriver<TYPE,ALLOC>::testCase22()
 {
@@ -9202,7 +9526,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 24: {
+      case 25: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9246,6 +9570,82 @@ int main(int argc, char *argv[])
             ASSERT(4 == m1.theValue(1, 1));
         }
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // TESTING PARALLEL POLICY OVERLOADS
+        //
+        // Concerns:
+        //: 1 The overloads taking a 'bsls::ParallelPolicy' behave as the
+        //:   overloads without a policy, for element types that allocate and
+        //:   for the pointer specializations.
+        //
+        // Plan:
+        //: 1 Run the test with 'int' and 'bsltf::AllocTestType', whose
+        //:   constructors and destructors can be called concurrently.  Note
+        //:   that 'TestType' keeps non-atomic global counters and cannot be
+        //:   used here.
+        //:
+        //: 2 Exercise the forwarding overloads of the pointer
+        //:   specializations directly.  (C-1)
+        //
+        // Testing:
+        //   PARALLEL POLICY OVERLOADS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PARALLEL POLICY OVERLOADS"
+                            "\n=================================\n");
+
+        TestDriver<int>::testCase24();
+        TestDriver<bsltf::AllocTestType>::testCase24();
+
+        if (verbose) printf("\tTesting pointer specializations.\n");
+        {
+            typedef bsls::ParallelPolicy Policy;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            int a = 0, b = 1;
+
+            vector<int *> mX(100, Policy(4, 1), &oa);
+            const vector<int *>& X = mX;
+            ASSERT(100 == X.size());
+            ASSERT(0   == X[99]);
+
+            mX.assign(50, &a, Policy(3, 7));
+            ASSERT(50 == X.size());
+            ASSERT(&a == X[0]);
+            ASSERT(&a == X[49]);
+
+            mX.resize(200, &b, Policy(4, 1));
+            ASSERT(200 == X.size());
+            ASSERT(&a  == X[49]);
+            ASSERT(&b  == X[50]);
+            ASSERT(&b  == X[199]);
+
+            mX.resize(300, Policy(4, 1));
+            ASSERT(300 == X.size());
+            ASSERT(0   == X[299]);
+
+            mX.clear(Policy(4, 1));
+            ASSERT(X.empty());
+
+            vector<const int *> mY(20, &a, Policy(2, 1), &oa);
+            const vector<const int *>& Y = mY;
+            ASSERT(20 == Y.size());
+            ASSERT(&a == Y[19]);
+
+            mY.assign(30, &b, Policy(2, 1));
+            ASSERT(30 == Y.size());
+            ASSERT(&b == Y[0]);
+
+            mY.resize(40, &a, Policy(2, 1));
+            ASSERT(&b == Y[29]);
+            ASSERT(&a == Y[39]);
+
+            mY.resize(10, Policy(2, 1));
+            ASSERT(10 == Y.size());
+        }
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // RANGE INSERT FUNCTION PTR BUG
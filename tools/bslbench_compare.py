@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+
+# ----------------------------------------------------------------------------
+# Copyright (C) 2013 Bloomberg L.P.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+# Usage: bslbench_compare.py baseline.{csv,json} candidate.{csv,json}
+#                            [--threshold=<percent>]
+# Compare the median times of the benchmarks in two outputs of 'bslbench.m'
+# (written with '-f csv' or '-f json') and report each benchmark present in
+# both.  A benchmark whose median time grew by more than the threshold (5% by
+# default) is a regression, and the exit status is 1 if there is any.
+
+from __future__ import print_function
+
+import csv
+import json
+import sys
+
+from optparse import OptionParser
+
+def parseOptions():
+    parser = OptionParser(
+                 usage="%prog [options] baseline candidate")
+    parser.add_option("--threshold", type='float', default=5.0,
+                      dest="threshold",
+                      help="regression threshold in percent [default: 5]")
+    (options, args) = parser.parse_args()
+
+    if len(args) != 2:
+        parser.error("expected a baseline and a candidate file")
+
+    return options, args
+
+def readResults(path):
+    # Return a list of '(name, median_ns)' pairs, in file order, read from the
+    # CSV or JSON file at the specified 'path'.
+    with open(path) as f:
+        text = f.read()
+
+    if text.lstrip().startswith('{'):
+        rows = json.loads(text)['benchmarks']
+    else:
+        rows = list(csv.DictReader(text.splitlines()))
+
+    return [(row['name'], float(row['median_ns'])) for row in rows]
+
+def main():
+    options, (baselinePath, candidatePath) = parseOptions()
+
+    baseline  = dict(readResults(baselinePath))
+    candidate = readResults(candidatePath)
+
+    common = [(name, baseline[name], median)
+              for name, median in candidate if name in baseline]
+    if not common:
+        print("no benchmarks in common", file=sys.stderr)
+        return 2
+
+    nameWidth = max([len('benchmark')] + [len(c[0]) for c in common])
+    print("%-*s %12s %12s %8s" % (nameWidth, 'benchmark',
+                                  'baseline ns', 'candidate ns', 'change'))
+
+    numRegressions = 0
+    for name, before, after in common:
+        change = (after - before) / before * 100.0 if before > 0 else 0.0
+        mark = ''
+        if change > options.threshold:
+            mark = '  REGRESSION'
+            numRegressions += 1
+        print("%-*s %12.2f %12.2f %+7.1f%%%s" % (nameWidth, name, before,
+                                                 after, change, mark))
+
+    candidateNames = set(c[0] for c in candidate)
+    for name in sorted(set(baseline) - candidateNames):
+        print("%-*s only in baseline" % (nameWidth, name))
+    for name, _ in candidate:
+        if name not in baseline:
+            print("%-*s only in candidate" % (nameWidth, name))
+
+    if numRegressions:
+        print("\n%d regression(s) above %.1f%%" % (numRegressions,
+                                                   options.threshold))
+        return 1
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
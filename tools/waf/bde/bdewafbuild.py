@@ -258,6 +258,25 @@ class BdeWafBuild(object):
                         name         = c + '.t',
                         path         = package_node)
 
+            # A package may also provide an application, '<package>.m.cpp', that is linked with the package library as
+            # the target '<package>.m' (e.g., a benchmark program).
+
+            main_node = package_node.find_node(package_name + '.m.cpp')
+            if main_node:
+                self.ctx(name         = package_name + '.m',
+                         path         = package_node,
+                         source       = main_node.name,
+                         target       = package_name + '.m',
+                         features     = self.features + ['cxxprogram'],
+                         cxxflags     = cxxflags,
+                         linkflags    = linkflags,
+                         lib          = libs,
+                         includes     = '.',
+                         use          = package_name + '_lib',
+                         uselib       = group_external_deps,
+                         install_path = None
+                         )
+
 
         self.ctx(name       = package_name + '_tst',
                  depends_on = [c + '.t' for c in components]